@@ -11,6 +11,9 @@
 ################################################################################
 from __future__ import annotations
 
+import pickle
+import zlib
+
 from abc import ABC, abstractmethod
 from dataclasses import dataclass
 from functools import partial
@@ -90,6 +93,17 @@ class TaskResult:
     mergeables: Optional[List]
     entries_in_trees: Optional[Ranges.TaskTreeEntries]
 
+    def __getstate__(self) -> bytes:
+        """
+        Partial results are pickled one by one, each C++ object as an
+        uncompressed TBufferFile. Compress all of them together before sending
+        them over the network: histograms with many empty bins shrink a lot.
+        """
+        return zlib.compress(pickle.dumps((self.mergeables, self.entries_in_trees), pickle.HIGHEST_PROTOCOL), 1)
+
+    def __setstate__(self, state: bytes) -> None:
+        self.mergeables, self.entries_in_trees = pickle.loads(zlib.decompress(state))
+
 
 def distrdf_mapper(
         current_range: Union[Ranges.EmptySourceRange, Ranges.TreeRangePerc],
@@ -125,8 +139,18 @@ def merge_values(mergeables_out: Iterable, mergeables_in: Iterable) -> Iterable:
     """
     if mergeables_out is not None and mergeables_in is not None:
 
+        # Results of C++ actions are merged all at once in C++, possibly in
+        # parallel. The others (e.g. AsNumpy, Snapshot) are merged in Python.
+        cpp_out = ROOT.std.vector["ROOT::Detail::RDF::RMergeableValueBase*"]()
+        cpp_in = ROOT.std.vector["const ROOT::Detail::RDF::RMergeableValueBase*"]()
         for mergeable_out, mergeable_in in zip(mergeables_out, mergeables_in):
-            Utils.merge_values(mergeable_out, mergeable_in)
+            if isinstance(mergeable_out, ROOT.Detail.RDF.RMergeableValueBase):
+                cpp_out.push_back(mergeable_out)
+                cpp_in.push_back(mergeable_in)
+            else:
+                Utils.merge_values(mergeable_out, mergeable_in)
+        if not cpp_out.empty():
+            ROOT.Detail.RDF.MergeValueLists(cpp_out, cpp_in)
 
     elif mergeables_out is None and mergeables_in is not None:
         mergeables_out = mergeables_in
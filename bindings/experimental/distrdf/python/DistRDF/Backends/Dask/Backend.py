@@ -12,7 +12,7 @@
 from __future__ import annotations
 
 import os
-from typing import Any, Dict, Optional, TYPE_CHECKING
+from typing import Any, Dict, List, Optional, TYPE_CHECKING
 
 from DistRDF import DataFrame
 from DistRDF import HeadNode
@@ -90,6 +90,25 @@ def get_total_cores(client: Client) -> int:
     return get_total_cores_generic(client)
 
 
+def get_preferred_workers(nranges: int, workers: List[str]) -> List[Optional[str]]:
+    """
+    Assign each range to a worker of the cluster, so that neighbouring ranges
+    go to the same worker.
+
+    Ranges are ordered by their position in the dataset, thus neighbouring
+    ranges often share an input file. Giving them to the same worker spares
+    opening the same file in multiple workers. Since the assignment only
+    depends on the number of ranges and on the workers, repeated runs over the
+    same dataset find the same files in the same workers, where they are likely
+    still in the cache of the operating system, together with the workflow code
+    already compiled by previous runs.
+    """
+    if not workers:
+        return [None] * nranges
+    workers = sorted(workers)
+    return [workers[i * len(workers) // nranges] for i in range(nranges)]
+
+
 class DaskBackend(Base.BaseBackend):
     """Dask backend for distributed RDataFrame."""
 
@@ -173,7 +192,16 @@ class DaskBackend(Base.BaseBackend):
         dmapper = dask.delayed(dask_mapper)
         dreducer = dask.delayed(reducer)
 
-        mergeables_lists = [dmapper(range) for range in ranges]
+        # Prefer to run each task on the worker chosen for its range, but let
+        # the scheduler move it elsewhere if that worker is busy or gone
+        preferred_workers = get_preferred_workers(len(ranges), list(self.client.scheduler_info()["workers"]))
+        mergeables_lists = []
+        for current_range, worker in zip(ranges, preferred_workers):
+            if worker is None:
+                mergeables_lists.append(dmapper(current_range))
+                continue
+            with dask.annotate(workers=worker, allow_other_workers=True):
+                mergeables_lists.append(dmapper(current_range))
 
         while len(mergeables_lists) > 1:
             mergeables_lists.append(
@@ -188,7 +216,8 @@ class DaskBackend(Base.BaseBackend):
         # shown only if it's the last call in a cell. Since we're encapsulating
         # it in this class, it won't be shown. Full details at
         # https://docs.dask.org/en/latest/diagnostics-distributed.html#dask.distributed.progress
-        final_results = mergeables_lists.pop().persist()
+        # Graph optimization is disabled since it may drop the annotations
+        final_results = mergeables_lists.pop().persist(optimize_graph=False)
         progress(final_results)
 
         return final_results.compute()
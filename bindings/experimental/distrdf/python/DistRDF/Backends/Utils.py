@@ -24,6 +24,11 @@ from DistRDF.PythonMergeables import SnapshotResult
 
 logger = logging.getLogger(__name__)
 
+# Headers already declared in this process. Distributed tasks declare the
+# headers of the analysis every time they run, but a worker process that runs
+# many tasks only needs to parse them the first time.
+_DECLARED_HEADERS: Set[str] = set()
+
 
 def extend_include_path(include_path: str) -> None:
     """
@@ -54,6 +59,8 @@ def declare_headers(headers_to_include: Iterable[str]) -> None:
             necessary C++ headers as strings.
     """
     for header in headers_to_include:
+        if header in _DECLARED_HEADERS:
+            continue
         # Retrieve header directory
         header_dir = os.path.dirname(header)
         # Add directory to ROOT's include path
@@ -65,6 +72,7 @@ def declare_headers(headers_to_include: Iterable[str]) -> None:
         except Exception as e:
             msg = "There was an error in including \"{}\" !".format(header)
             raise e(msg)
+        _DECLARED_HEADERS.add(header)
 
 
 def declare_shared_libraries(libraries_to_include: Iterable[str]) -> None:
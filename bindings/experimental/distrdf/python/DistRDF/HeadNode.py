@@ -428,7 +428,14 @@ class TreeHeadNode(HeadNode):
                         "chunks the dataset can be split in. Some tasks could be doing no work. Consider "
                         "setting the 'npartitions' parameter of the RDataFrame constructor to a lower value.")
 
-        return Ranges.get_percentage_ranges(self.subtreenames, self.inputfiles, self.npartitions, self.friendinfo)
+        # Optionally balance the tasks by the compressed size of the trees, at
+        # the price of opening every input file once in the local session.
+        weights = None
+        if ROOT.RDF.Experimental.Distributed.weighted_ranges:
+            weights = Ranges.get_trees_zipbytes(self.subtreenames, self.inputfiles)
+
+        return Ranges.get_percentage_ranges(self.subtreenames, self.inputfiles, self.npartitions, self.friendinfo,
+                                            weights)
 
     def _generate_rdf_creator(self) -> Callable[[Ranges.DataRange], TaskObjects]:
         """
@@ -2,7 +2,7 @@ from __future__ import annotations
 
 import logging
 
-from bisect import bisect_left
+from bisect import bisect_left, bisect_right
 from dataclasses import dataclass, field
 from itertools import accumulate
 from math import floor
@@ -178,11 +178,63 @@ def get_clusters_and_entries(treename: str, filename: str) -> Tuple[List[int], i
     return clusters, entries
 
 
+def get_trees_zipbytes(treenames: List[str], filenames: List[str]) -> List[int]:
+    """
+    Retrieve the compressed size on disk of each tree in the dataset. It is used
+    as an estimate of the cost of processing each tree, see
+    `get_weighted_percentages`.
+    """
+    def get_zipbytes(treename: str, filename: str) -> int:
+        with ROOT.TFile.Open(filename, "READ_WITHOUT_GLOBALREGISTRATION") as tfile:
+            return tfile.Get(treename).GetZipBytes()
+
+    return [get_zipbytes(treename, filename) for treename, filename in zip(treenames, filenames)]
+
+
+def get_weighted_percentages(weights: List[int], npartitions: int) -> List[float]:
+    """
+    Compute the boundaries of the tasks in units of files, such that every task
+    gets the same share of the total weight of the dataset.
+
+    The integer part of each boundary is the index of a file, the fractional
+    part is the percentage of that file where the boundary lies. For example,
+    with weights = [30, 10] and npartitions = 2 the result is [0., 0.666, 2.],
+    i.e. the first task processes two thirds of the first file and the second
+    task processes the rest of the first file plus the whole second file.
+    """
+    nfiles = len(weights)
+    total = sum(weights)
+    if total <= 0:
+        # Nothing to weigh, fall back to the same share of files per task
+        return [nfiles / npartitions * i for i in range(npartitions+1)]
+
+    # Cumulative weight at the beginning of each file, plus the total
+    offsets = list(accumulate((0,) + tuple(weights)))
+    # The first task always starts at the beginning of the dataset, so that
+    # leading files with zero weight are also part of some task
+    percentages = [0.]
+    for i in range(1, npartitions):
+        target = total * i / npartitions
+        # The file containing the target, i.e. the last one starting at or
+        # before it. This is never a file with zero weight, since its start
+        # coincides with the start of the next file.
+        file_idx = bisect_right(offsets, target) - 1
+        percentages.append(file_idx + (target - offsets[file_idx]) / weights[file_idx])
+    percentages.append(float(nfiles))
+    return percentages
+
+
 def get_percentage_ranges(treenames: List[str], filenames: List[str], npartitions: int,
-                          friendinfo: Optional[ROOT.Internal.TreeUtils.RFriendInfo]) -> List[TreeRangePerc]:
+                          friendinfo: Optional[ROOT.Internal.TreeUtils.RFriendInfo],
+                          weights: Optional[List[int]] = None) -> List[TreeRangePerc]:
     """
     Create a list of tasks that will process the given trees partitioning them
     by percentages.
+
+    If weights are given, one per tree, the dataset is partitioned so that each
+    task gets the same share of the total weight rather than the same share of
+    files. With the compressed size of the trees as weights, a dataset with
+    files of very different sizes results in tasks with a similar cost.
     """
     nfiles = len(filenames)
     files_per_partition = nfiles / npartitions
@@ -196,7 +248,12 @@ def get_percentage_ranges(treenames: List[str], filenames: List[str], npartition
     # percentages = [0., 1.428, 2.857, 4.285, 5.714, 7.142, 8.571, 10.]
     # files_of_percentages = [0, 1, 2, 4, 5, 7, 8, 10]
     # percentages_wrt_files = [0., 0.428, 0.857, 0.285, 0.714, 0.142, 0.571, 0.]
-    percentages = [files_per_partition * i for i in range(npartitions+1)]
+    # With weights, the percentages are not evenly spaced but the rest of the
+    # computation is the same.
+    if weights is not None:
+        percentages = get_weighted_percentages(weights, npartitions)
+    else:
+        percentages = [files_per_partition * i for i in range(npartitions+1)]
     files_of_percentages = [floor(percentage) for percentage in percentages]
     percentages_wrt_files = [perc - file for perc, file in zip(percentages, files_of_percentages)]
 
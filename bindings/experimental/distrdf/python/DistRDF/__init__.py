@@ -157,4 +157,8 @@ def create_distributed_module(parentmodule):
     # Set non-optimized default mode
     distributed.optimized = False
 
+    # Split datasets in tasks with the same share of files by default, not by
+    # the size of the trees
+    distributed.weighted_ranges = False
+
     return distributed
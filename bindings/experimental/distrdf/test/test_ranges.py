@@ -518,3 +518,27 @@ class TreeRanges(unittest.TestCase):
         ]
 
         self.assertListEqual(ranges, ranges_reqd)
+
+    def test_three_files_weighted_partitions(self):
+        """
+        Create ranges with the same share of weight instead of files. The first
+        file weighs as much as the other two together.
+        """
+        nfiles = 3
+        treenames = [f"tree_{i}" for i in range(nfiles)]
+        filenames = [f"distrdf_unittests_file_{i}.root" for i in range(nfiles)]
+        npartitions = 4
+        weights = [2, 1, 1]
+
+        percranges = Ranges.get_percentage_ranges(treenames, filenames, npartitions, None, weights)
+        clusteredranges = [Ranges.get_clustered_range_from_percs(percrange)[0] for percrange in percranges]
+
+        ranges = treeranges_to_tuples(clusteredranges)
+        ranges_reqd = [
+            (0, 50, [filenames[0]]),
+            (50, 100, [filenames[0]]),
+            (0, 100, [filenames[1]]),
+            (0, 100, [filenames[2]]),
+        ]
+
+        self.assertListEqual(ranges, ranges_reqd)
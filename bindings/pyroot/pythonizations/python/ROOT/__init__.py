@@ -10,6 +10,9 @@
 
 from os import environ
 
+# Measure the phases of the import, reported if ROOT_PYTHON_STARTUP_REPORT is set
+from ._startup import startup_timer
+
 # Prevent cppyy's check for the PCH
 environ['CLING_STANDARD_PCH'] = 'none'
 
@@ -26,6 +29,7 @@ import cppyy
 if not 'ROOTSYS' in environ:
     # Revert setting made by cppyy
     cppyy.gbl.gROOT.SetBatch(False)
+startup_timer.mark('cppyy and interpreter')
 
 # import libROOTPythonizations with Python version number
 import sys, importlib
@@ -35,10 +39,10 @@ importlib.import_module(librootpyz_mod_name)
 
 # ensure 'import libROOTPythonizations' will find the versioned module
 sys.modules['libROOTPythonizations'] = sys.modules[librootpyz_mod_name]
+startup_timer.mark('libROOTPythonizations')
 
-# Trigger the addition of the pythonizations
-from ._pythonization import _register_pythonizations
-_register_pythonizations()
+# The pythonizations are registered by the facade on its first lookup, which
+# happens before any ROOT class can be obtained from it
 
 # Check if we are in the IPython shell
 if major == 3:
@@ -52,6 +56,7 @@ _is_ipython = hasattr(builtins, '__IPYTHON__')
 import sys
 from ._facade import ROOTFacade
 sys.modules[__name__] = ROOTFacade(sys.modules[__name__], _is_ipython)
+startup_timer.mark('facade')
 
 # Configuration for usage from Jupyter notebooks
 if _is_ipython:
@@ -60,6 +65,9 @@ if _is_ipython:
     if hasattr(ip,"kernel"):
         import JupyROOT
         import JsMVA
+        startup_timer.mark('Jupyter integration')
+
+startup_timer.report('import ROOT')
 
 # Register cleanup
 import atexit
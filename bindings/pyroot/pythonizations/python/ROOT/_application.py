@@ -86,9 +86,13 @@ class PyROOTApplication(object):
             self._inputhook_config()
         else:
             # Python in script mode, start a separate thread for the event processing
+            # Skip the event processing while the main thread runs a call into C++
+            # without the GIL, ROOT graphics are not meant to be used concurrently
+            from ._pythonization._pyz_utils import gil_released_calls
             def _process_root_events(self):
                 while self.keep_polling:
-                    gSystem.ProcessEvents()
+                    if not gil_released_calls.running():
+                        gSystem.ProcessEvents()
                     time.sleep(0.01)
             import threading
             self.keep_polling = True # Used to shut down the thread safely at teardown time
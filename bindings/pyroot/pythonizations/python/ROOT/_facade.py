@@ -8,15 +8,18 @@ import libcppyy as cppyy_backend
 from cppyy import gbl as gbl_namespace
 from cppyy import cppdef, include
 from libROOTPythonizations import gROOT, CreateBufferFromAddress
-from cppyy.gbl import gSystem
 
 from ._application import PyROOTApplication
+# Python <= 2.7.5 cannot use exec in an inner function
 _numba_pyversion = (2, 7, 5)
-if sys.version_info[:3] > _numba_pyversion:
-    # Python <= 2.7.5 cannot use exec in an inner function
-    from ._numbadeclare import _NumbaDeclareDecorator
 
-from ._pythonization import pythonization
+from ._pythonization import pythonization, _register_pythonizations
+from ._startup import startup_timer
+
+
+def _has_dataframe():
+    # Cheaper than asking root-config, which spawns a process
+    return 'dataframe' in gROOT.GetConfigFeatures().split()
 
 
 class PyROOTConfiguration(object):
@@ -198,11 +201,19 @@ class ROOTFacade(types.ModuleType):
     def _finalSetup(self):
         # Prevent this method from being re-entered through the gROOT wrapper
         self.__dict__['gROOT'] = gROOT
+        startup_timer.restart()
+
+        # Register the pythonizations with cppyy. Deferred until now to keep
+        # `import ROOT` fast; classes already loaded through cppyy are
+        # pythonized at registration
+        _register_pythonizations()
+        startup_timer.mark('pythonization modules')
 
         # Setup interactive usage from Python
         self.__dict__['app'] = PyROOTApplication(self.PyConfig, self._is_ipython)
         if not self.gROOT.IsBatch() and self.PyConfig.StartGUIThread:
             self.app.init_graphics()
+        startup_timer.mark('application')
 
         # Set memory policy to kUseHeuristics.
         # This restores the default in PyROOT which was changed
@@ -215,6 +226,13 @@ class ROOTFacade(types.ModuleType):
 
         # Run rootlogon if exists
         self._run_rootlogon()
+        startup_timer.mark('rootlogon')
+        startup_timer.report('first lookup in ROOT')
+
+    def _ensure_final_setup(self):
+        # For the lookups that do not go through _getattr, e.g. the properties below
+        if self.__dict__['gROOT'] is not gROOT:
+            self._finalSetup()
 
     def _getattr(self, name):
         # Special case, to allow "from ROOT import gROOT" w/o starting the graphics
@@ -311,6 +329,7 @@ class ROOTFacade(types.ModuleType):
     # namespace lazily.
     @property
     def VecOps(self):
+        self._ensure_final_setup()
         ns = self._fallback_getattr('VecOps')
         try:
             from libROOTPythonizations import AsRVec
@@ -323,12 +342,17 @@ class ROOTFacade(types.ModuleType):
     # Overload RDF namespace
     @property
     def RDF(self):
+        self._ensure_final_setup()
         ns = self._fallback_getattr('RDF')
         try:
             # Inject MakeNumpyDataFrame function
             from libROOTPythonizations import MakeNumpyDataFrame
             ns.MakeNumpyDataFrame = MakeNumpyDataFrame
 
+            # RunGraphs runs event loops, release the GIL meanwhile
+            from ._pythonization._pyz_utils import release_gil
+            release_gil(ns, 'RunGraphs')
+
             if sys.version_info >= (3, 7):
                 # Inject Experimental.Distributed package into namespace RDF
                 ns.Experimental.Distributed = _create_rdf_experimental_distributed_module(ns.Experimental)
@@ -340,6 +364,7 @@ class ROOTFacade(types.ModuleType):
     # Overload RooFit namespace
     @property
     def RooFit(self):
+        self._ensure_final_setup()
         from ._pythonization._roofit import pythonize_roofit_namespace
         ns = self._fallback_getattr('RooFit')
         try:
@@ -352,11 +377,11 @@ class ROOTFacade(types.ModuleType):
     # Overload TMVA namespace
     @property
     def TMVA(self):
+        self._ensure_final_setup()
         #this line is needed to import the pythonizations in _tmva directory
         from ._pythonization import _tmva
         ns = self._fallback_getattr('TMVA')
-        hasRDF = gSystem.GetFromPipe("root-config --has-dataframe") == "yes"
-        if hasRDF:
+        if _has_dataframe():
             try:
                 from libROOTPythonizations import AsRTensor
                 ns.Experimental.AsRTensor = AsRTensor
@@ -368,8 +393,10 @@ class ROOTFacade(types.ModuleType):
     # Create and overload Numba namespace
     @property
     def Numba(self):
+        self._ensure_final_setup()
         if sys.version_info[:3] <= _numba_pyversion:
             raise Exception('ROOT.Numba requires Python above version {}.{}.{}'.format(*_numba_pyversion))
+        from ._numbadeclare import _NumbaDeclareDecorator
         cppdef('namespace Numba {}')
         ns = self._fallback_getattr('Numba')
         ns.Declare = staticmethod(_NumbaDeclareDecorator)
@@ -379,6 +406,7 @@ class ROOTFacade(types.ModuleType):
     # Get TPyDispatcher for programming GUI callbacks
     @property
     def TPyDispatcher(self):
+        self._ensure_final_setup()
         include('ROOT/TPyDispatcher.h')
         tpd = gbl_namespace.TPyDispatcher
         type(self).TPyDispatcher = tpd
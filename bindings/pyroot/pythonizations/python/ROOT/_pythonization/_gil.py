@@ -0,0 +1,36 @@
+################################################################################
+# Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+from . import pythonization
+from ._pyz_utils import release_gil
+
+# Methods running long computations in C++ (event loops, fits, merges) that are
+# called without the GIL, see release_gil. They are listed for the class that
+# declares them, so that the overloads of derived classes are not hidden
+_release_gil_methods = {
+    'TTree': ['Draw', 'Process', 'CopyTree', 'UnbinnedFit'],
+    'TChain': ['Draw', 'Process', 'Merge'],
+    'TH1': ['Fit'],
+    'TGraph': ['Fit'],
+    'TGraph2D': ['Fit'],
+    'TMultiGraph': ['Fit'],
+    'TFileMerger': ['Merge', 'PartialMerge'],
+}
+
+
+@pythonization(list(_release_gil_methods))
+def pythonize_release_gil(klass, name):
+    for method_name in _release_gil_methods[name]:
+        release_gil(klass, method_name)
+
+
+# Getting the value of a result runs the RDataFrame event loop if needed
+@pythonization('RResultPtr<', ns='ROOT::RDF', is_prefix=True)
+def pythonize_rresultptr_release_gil(klass):
+    release_gil(klass, 'GetValue')
+    release_gil(klass, 'GetPtr')
@@ -10,6 +10,9 @@
 
 import abc
 import sys
+import threading
+
+import cppyy
 
 
 class MethodTemplateGetter(object):
@@ -134,3 +137,60 @@ class MethodTemplateWrapper(ABC):
         '''
         pass
 
+
+
+class _GILReleasedCalls(object):
+    '''
+    Counts the calls into C++ that are running without the GIL, so that the
+    thread processing the ROOT GUI events in script mode does not run
+    concurrently with them (see PyROOTApplication.init_graphics).
+    '''
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self._count = 0
+
+    def __enter__(self):
+        with self._lock:
+            self._count += 1
+
+    def __exit__(self, exc_type, exc_val, exc_tb):
+        with self._lock:
+            self._count -= 1
+
+    def running(self):
+        return self._count > 0
+
+
+gil_released_calls = _GILReleasedCalls()
+
+
+def release_gil(scope, method_name):
+    '''
+    Replaces a method of a class proxy, or a function of a namespace, with a
+    wrapper that calls it without holding the GIL, so that other Python
+    threads can run during long computations in C++. The Python callbacks
+    invoked by the method re-acquire the GIL.
+
+    The GIL is released only once the thread safety of ROOT is enabled, with
+    ROOT.EnableThreadSafety() or ROOT.EnableImplicitMT(): before that, other
+    Python threads calling into ROOT at the same time would not be safe.
+
+    Args:
+        scope (class type or namespace): cppyy proxy where the method is
+            declared.
+        method_name (string): name of the method.
+    '''
+    original = getattr(scope, method_name)
+
+    def wrapper(*args, **kwargs):
+        # Thread safety cannot be disabled once enabled, so the flag of the
+        # overload is set at most once
+        if not original.__release_gil__ and cppyy.gbl.gGlobalMutex:
+            original.__release_gil__ = True
+        with gil_released_calls:
+            return original(*args, **kwargs)
+
+    wrapper.__name__ = method_name
+    wrapper.__doc__ = original.__doc__
+    setattr(scope, method_name, wrapper)
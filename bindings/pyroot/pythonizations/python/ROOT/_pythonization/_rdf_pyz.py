@@ -40,9 +40,11 @@ class FunctionJitter:
     fil1 = rdf.Filter( "Numba::" + func_call, "x is greater than 2")
 
     """
-    # Variable to store previous functions so as to not rejit.
+    # Functions jitted so far, so as to not rejit. The key is the Python callable with its signature,
+    # the value the name of its C++ wrapper and the numba cfunc, which must be kept alive.
     function_cache = {}
-    lambda_function_counter = 0  # Counter to name the lambda functions
+    # Names of the C++ wrappers declared so far
+    declared_names = set()
 
     def __init__(self, rdf: 'RDataFrame') -> None:
         self.rdf = rdf
@@ -180,18 +182,39 @@ class FunctionJitter:
                 type_of_p = self.find_type(p)
             self.args_info[p] = (type_of_p, value_of_p)
 
-    def generate_function_call(self):
+    def generate_function_signature(self):
         """
-        Generates a function call and signature. Gives a unique name to the function if it is a lambda function.
-        Updates the class with new attributes func_call and func_sign to hold them,
+        Generates the function signature.
+        Updates the class with a new attribute func_sign to hold it.
         """
-        func = self.func
-        if func.__name__ == '<lambda>':
-            func.__name__ = f"_lambda_func_number_{FunctionJitter.lambda_function_counter}"
-            FunctionJitter.lambda_function_counter += 1
-        self.func_call = f"{func.__name__}({', '.join(str(arg_info[1]) for arg_info in self.args_info.values())})"
         self.func_sign = [str(self.args_info[p][0]) for p in self.params]
 
+    def generate_function_call(self, cpp_name):
+        """
+        Generates the call of the C++ wrapper of the function.
+        Updates the class with a new attribute func_call to hold it.
+
+        Arguments:
+        cpp_name: name of the C++ wrapper in the Numba namespace
+        """
+        self.func_call = f"{cpp_name}({', '.join(str(arg_info[1]) for arg_info in self.args_info.values())})"
+
+    @staticmethod
+    def get_unique_name(func):
+        """
+        Returns a name for the C++ wrapper of func which was not declared yet: functions
+        defined with the same name, e.g. lambdas or functions redefined in a loop, and
+        the same function jitted for different column types get different wrappers.
+        """
+        base = func.__name__ if func.__name__.isidentifier() else "_lambda_func"
+        name = base
+        counter = 0
+        while name in FunctionJitter.declared_names:
+            name = f"{base}_{counter}"
+            counter += 1
+        FunctionJitter.declared_names.add(name)
+        return name
+
     def get_function_params_args_call(self, func, cols_list, extra_args):
         """
         Function to generate the function params, args, signature and call.
@@ -199,12 +222,13 @@ class FunctionJitter:
         self.find_function_params(func)
         self.generate_func_args(cols_list, extra_args)
         self.find_function_signature()
-        self.generate_function_call()
+        self.generate_function_signature()
 
     def jit_function(self, func, cols_list, extra_args):
         """
         Jits the provided function using ROOT's NumbaDeclare.
-        Also checks if the function was jitted earlier in which case it won't jit again but if signature does not match. It raises an error.
+        A function is jitted once per signature: using it again with columns of the same types reuses the
+        jitted code, with columns of other types jits a new version.
 
         Arguments:
         func: A python callable
@@ -212,17 +236,15 @@ class FunctionJitter:
         extra_args: A dict of extra arguments that func requires.
         """
 
-        if func.__name__ in FunctionJitter.function_cache:
-            func_call, func_sign = FunctionJitter.function_cache[func.__name__]
-            self.get_function_params_args_call(func, cols_list, extra_args)
-            if self.func_sign != func_sign:
-                raise ValueError(
-                    "Trying to re-use a function. Do not change function signature.".format(func))
-            return self.func_call
-
         self.get_function_params_args_call(func, cols_list, extra_args)
-        _NumbaDeclareDecorator(self.func_sign, self.return_type)(self.func)
-        FunctionJitter.function_cache[self.func.__name__] = (self.func_call, self.func_sign)
+        key = (func, tuple(self.func_sign), self.return_type)
+        cached = FunctionJitter.function_cache.get(key)
+        if cached is None:
+            cpp_name = FunctionJitter.get_unique_name(func)
+            _NumbaDeclareDecorator(self.func_sign, self.return_type, name=cpp_name)(func)
+            cached = (cpp_name, func.__numba_cfunc__)
+            FunctionJitter.function_cache[key] = cached
+        self.generate_function_call(cached[0])
         return self.func_call
 
 def _convert_to_vector(args):
@@ -39,6 +39,15 @@ print(a[0]) # prints '0.2'
 for elem in a:
     print(elem)
 \endcode
+
+- They have the `__array_interface__` attribute, so NumPy can view their data without copying it:
+\code{.py}
+import numpy
+
+npy = numpy.asarray(a)
+a[0] = 42
+print(npy[0]) # prints '42.0'
+\endcode
 \htmlonly
 </div>
 \endhtmlonly
@@ -48,6 +57,47 @@ for elem in a:
 from . import pythonization
 
 from ._generic import _add_getitem_checked
+from libROOTPythonizations import GetEndianess, GetDataPointer, GetSizeOfType
+
+
+# NumPy kind and C++ element type of the TArray subclasses
+_tarray_element_types = {
+    "TArrayC": ("i", "Char_t"),
+    "TArrayS": ("i", "Short_t"),
+    "TArrayI": ("i", "Int_t"),
+    "TArrayL": ("i", "Long_t"),
+    "TArrayL64": ("i", "Long64_t"),
+    "TArrayF": ("f", "Float_t"),
+    "TArrayD": ("f", "Double_t"),
+}
+
+
+def _get_tarray_array_interface(self):
+    # Parameters:
+    # - self: TArray subclass or class inheriting from one (e.g. TH1D)
+    # Returns:
+    # - Flat NumPy array interface of the TArray data
+    for base in type(self).__mro__:
+        element_type = _tarray_element_types.get(base.__name__)
+        if element_type is not None:
+            break
+    else:
+        raise AttributeError("{} has no TArray data".format(type(self).__cpp_name__))
+
+    kind, cpptype = element_type
+    size = self.GetSize()
+    # Numpy breaks for data pointer of 0 even though the array is empty.
+    # We set the pointer to 1 but the value itself is arbitrary and never accessed.
+    if size == 0:
+        pointer = 1
+    else:
+        pointer = GetDataPointer(self, type(self).__cpp_name__, "GetArray")
+    return {
+        "shape": (size, ),
+        "typestr": "{}{}{}".format(GetEndianess(), kind, GetSizeOfType(cpptype)),
+        "version": 3,
+        "data": (pointer, False)
+    }
 
 
 @pythonization("TArray", is_prefix=True)
@@ -65,3 +115,6 @@ def pythonize_tarray(klass, name):
         # The new __getitem__ allows to throw pythonic IndexError when index
         # is out of range and to iterate over the array.
         _add_getitem_checked(klass)
+
+        # Allow NumPy to adopt the memory of the array without copying it
+        klass.__array_interface__ = property(_get_tarray_array_interface)
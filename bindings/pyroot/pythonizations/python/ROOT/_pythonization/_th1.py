@@ -8,7 +8,48 @@
 # For the list of contributors see $ROOTSYS/README/CREDITS.                    #
 ################################################################################
 
+r'''
+/**
+\class TH1
+\brief \parblock \endparblock
+\htmlonly
+<div class="pyrootbox">
+\endhtmlonly
+## PyROOT
+
+The histograms storing their contents in a TArray (TH1D, TH2F, TProfile, ...) have
+the `__array_interface__` attribute, so that NumPy can view the bin contents without
+copying them. The array includes the underflow and overflow bins and is indexed like
+GetBinContent(), i.e. `[x]`, `[x, y]` or `[x, y, z]`:
+
+\code{.py}
+h = ROOT.TH2D("h", "h", 10, 0, 1, 20, 0, 1)
+h.Fill(0.55, 0.15)
+contents = numpy.asarray(h)
+print(contents.shape) # (12, 22)
+print(contents[6, 4]) # 1.0, same as h.GetBinContent(6, 4)
+\endcode
+
+The view follows the histogram as long as its binning does not change.
+
+`Fill` also accepts NumPy arrays (or any sequence convertible to one) of coordinates,
+optionally followed by an array of weights or a single weight, and fills all the
+values with one call of FillN():
+
+\code{.py}
+h1 = ROOT.TH1D("h1", "h1", 100, -5, 5)
+h1.Fill(numpy.random.normal(size=10000))
+h2 = ROOT.TH2D("h2", "h2", 10, 0, 1, 10, 0, 1)
+h2.Fill(x_values, y_values, weights) # TH2 and TProfile: x and y arrays
+\endcode
+\htmlonly
+</div>
+\endhtmlonly
+*/
+'''
+
 from . import pythonization
+from ._tarray import _get_tarray_array_interface
 
 
 # Multiplication by constant
@@ -23,6 +64,63 @@ def _imul(self, c):
     return self
 
 
+# Fill with NumPy arrays
+
+def _fill_n(self, ncoords, args):
+    # Parameters:
+    # - self: histogram
+    # - ncoords: number of coordinate arrays expected by FillN
+    # - args: ncoords arrays of coordinates, optionally followed by the weights
+    import numpy
+
+    if len(args) > ncoords + 1:
+        raise TypeError("Fill with arrays takes {} arrays of coordinates and optional weights".format(ncoords))
+    coords = [numpy.ascontiguousarray(a, dtype=numpy.float64) for a in args[:ncoords]]
+    if len(coords) < ncoords or any(c.ndim != 1 for c in coords):
+        raise TypeError("Fill with arrays takes {} one-dimensional arrays of coordinates".format(ncoords))
+    n = len(coords[0])
+    if any(len(c) != n for c in coords):
+        raise ValueError("The arrays of coordinates passed to Fill have different lengths")
+    if len(args) > ncoords and args[ncoords] is not None:
+        weights = numpy.ascontiguousarray(numpy.broadcast_to(args[ncoords], (n, )), dtype=numpy.float64)
+    else:
+        weights = numpy.ones(n)
+    self.FillN(*([n] + coords + [weights]))
+
+
+def _make_fill(ncoords):
+    # Parameters:
+    # - ncoords: number of coordinate arrays expected by FillN
+    # Returns:
+    # - Fill method forwarding arrays to FillN and anything else to the C++ Fill
+    def Fill(self, *args):
+        if args and (hasattr(args[0], "__array_interface__") or isinstance(args[0], (list, tuple))):
+            return _fill_n(self, ncoords, args)
+        return self._Fill(*args)
+    return Fill
+
+
+# NumPy array interface
+
+def _get_th1_array_interface(self):
+    # Parameters:
+    # - self: histogram
+    # Returns:
+    # - NumPy array interface of the bin contents, including under- and
+    #   overflow bins, with one dimension per histogram axis
+    interface = _get_tarray_array_interface(self)
+    shape = (self.GetNbinsX() + 2, self.GetNbinsY() + 2, self.GetNbinsZ() + 2)[:self.GetDimension()]
+    # The bin number is x + (nx + 2) * (y + (ny + 2) * z): x varies fastest
+    itemsize = int(interface["typestr"][2:])
+    strides = []
+    for n in shape:
+        strides.append(itemsize)
+        itemsize *= n
+    interface["shape"] = shape
+    interface["strides"] = tuple(strides)
+    return interface
+
+
 @pythonization('TH1')
 def pythonize_th1(klass):
     # Parameters:
@@ -30,3 +128,21 @@ def pythonize_th1(klass):
 
     # Support hist *= scalar
     klass.__imul__ = _imul
+
+    # Allow NumPy to view the bin contents without copying them
+    klass.__array_interface__ = property(_get_th1_array_interface)
+
+    # Support hist.Fill(x_array[, weights])
+    klass._Fill = klass.Fill
+    klass.Fill = _make_fill(1)
+
+
+@pythonization(['TH2', 'TProfile'])
+def pythonize_th2_tprofile(klass):
+    # Parameters:
+    # klass: class to be pythonized
+
+    # These classes declare their own Fill overloads, hiding the one of TH1.
+    # Support hist.Fill(x_array, y_array[, weights])
+    klass._Fill = klass.Fill
+    klass.Fill = _make_fill(2)
@@ -0,0 +1,73 @@
+################################################################################
+# Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+r'''
+/**
+\class THnT
+\brief \parblock \endparblock
+\htmlonly
+<div class="pyrootbox">
+\endhtmlonly
+## PyROOT
+
+THnT (THnD, THnF, THnI, ...) has the `__array_interface__` attribute, so that NumPy can
+view the bin contents without copying them. The array has one dimension per axis,
+includes the underflow and overflow bins and is indexed like GetBinContent() with the
+bin indices of the axes:
+
+\code{.py}
+nbins = numpy.array([10, 20], dtype=numpy.int32)
+h = ROOT.THnD("h", "h", 2, nbins, numpy.zeros(2), numpy.ones(2))
+contents = numpy.asarray(h)
+print(contents.shape) # (12, 22)
+\endcode
+
+Getting the view allocates the storage of the bins if nothing was filled yet.
+\htmlonly
+</div>
+\endhtmlonly
+*/
+'''
+
+from . import pythonization
+from libROOTPythonizations import GetEndianess, GetDataPointer, GetSizeOfType
+
+
+def _get_thn_array_interface(self):
+    # Parameters:
+    # - self: THnT histogram
+    # Returns:
+    # - NumPy array interface of the bin contents, with one dimension per axis
+    cppname = type(self).__cpp_name__
+    element_type = cppname[cppname.index("<") + 1:cppname.rindex(">")].strip()
+    if element_type in ("float", "double", "Float_t", "Double_t"):
+        kind = "f"
+    elif element_type.startswith("unsigned") or element_type.startswith("U"):
+        kind = "u"
+    else:
+        kind = "i"
+
+    array = self.GetArray()
+    pointer = GetDataPointer(array, "TNDArrayT<{}>".format(element_type), "GetData")
+    shape = tuple(self.GetAxis(d).GetNbins() + 2 for d in range(self.GetNdimensions()))
+    return {
+        "shape": shape,
+        "typestr": "{}{}{}".format(GetEndianess(), kind, GetSizeOfType(element_type)),
+        "version": 3,
+        "data": (pointer, False)
+    }
+
+
+@pythonization("THnT<", is_prefix=True)
+def pythonize_thn(klass, name):
+    # Parameters:
+    # klass: class to be pythonized
+    # name: string containing the name of the class
+
+    # Allow NumPy to view the bin contents without copying them
+    klass.__array_interface__ = property(_get_thn_array_interface)
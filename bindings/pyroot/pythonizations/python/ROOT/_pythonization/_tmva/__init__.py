@@ -12,7 +12,7 @@
 
 import sys
 import cppyy
-from cppyy.gbl import gSystem
+from cppyy.gbl import gROOT
 
 from .. import pythonization
 
@@ -22,9 +22,10 @@ from ._crossvalidation import CrossValidation
 
 from ._rbdt import Compute, pythonize_rbdt
 
-hasRDF = gSystem.GetFromPipe("root-config --has-dataframe") == "yes"
+hasRDF = "dataframe" in gROOT.GetConfigFeatures().split()
 if hasRDF:
     from ._rtensor import get_array_interface, add_array_interface_property, RTensorGetitem, pythonize_rtensor
+    from ._batchgenerator import BatchGeneratorIter, BatchGeneratorValidationBatches, pythonize_batchgenerator
 
 #this should be available only when xgboost is there ?
 # We probably don't need a protection here since the code is run only when there is xgboost
@@ -0,0 +1,44 @@
+################################################################################
+# Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+from .. import pythonization
+
+
+def _iterate_batches(generator):
+    # Import numpy lazily
+    try:
+        import numpy as np
+    except:
+        raise ImportError("Failed to import numpy during the iteration over an RBatchGenerator.")
+
+    while True:
+        batch = generator.GetBatch()
+        if batch.GetShape()[0] == 0:
+            return
+        # The array shares the memory of the batch and keeps it alive, so that it can be handed
+        # without copy to PyTorch (torch.from_numpy) or to TensorFlow (DLPack)
+        yield np.asarray(batch)
+
+
+def BatchGeneratorIter(self):
+    self.StartEpoch()
+    return _iterate_batches(self)
+
+
+def BatchGeneratorValidationBatches(self):
+    self.StartValidation()
+    return _iterate_batches(self)
+
+
+@pythonization("RBatchGenerator<", ns="TMVA::Experimental", is_prefix=True)
+def pythonize_batchgenerator(klass):
+    # Parameters:
+    # klass: class to be pythonized
+
+    klass.__iter__ = BatchGeneratorIter
+    klass.validation_batches = BatchGeneratorValidationBatches
@@ -0,0 +1,50 @@
+################################################################################
+# Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+import os
+import sys
+import time
+
+
+class _StartupTimer(object):
+    """Measures the phases of the setup of the ROOT module.
+
+    The setup happens in two steps: `import ROOT` itself, and the final setup
+    (pythonizations, application, rootlogon) triggered by the first lookup in
+    the ROOT facade. If the environment variable ROOT_PYTHON_STARTUP_REPORT is
+    set to a non-zero value, the time spent in each phase of a step is printed
+    on stderr when the step is over.
+    """
+
+    def __init__(self):
+        self.enabled = os.environ.get('ROOT_PYTHON_STARTUP_REPORT', '0') not in ('', '0')
+        self._phases = []
+        self._last = time.time()
+
+    def restart(self):
+        """Start measuring a new step, ignoring the time elapsed since the last phase."""
+        self._phases = []
+        self._last = time.time()
+
+    def mark(self, phase):
+        """Record the time elapsed since the previous phase as the duration of `phase`."""
+        now = time.time()
+        self._phases.append((phase, now - self._last))
+        self._last = now
+
+    def report(self, step):
+        """Print the phases of `step` if enabled."""
+        if not self.enabled:
+            return
+        total = sum(duration for _, duration in self._phases)
+        sys.stderr.write('PyROOT startup, {}: {:.1f} ms\n'.format(step, total * 1e3))
+        for phase, duration in self._phases:
+            sys.stderr.write('   {:<40} {:8.1f} ms\n'.format(phase, duration * 1e3))
+
+
+startup_timer = _StartupTimer()
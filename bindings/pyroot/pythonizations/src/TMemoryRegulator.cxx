@@ -77,12 +77,20 @@ void PyROOT::TMemoryRegulator::RecursiveRemove(TObject *object)
    auto cppobj = (Cppyy::TCppObject_t)object;
    Cppyy::TCppType_t klass = 0;
 
+   // Objects without a Python proxy, e.g. most of those deleted by other threads, need no GIL
+   if (fObjectMap.find(cppobj) == fObjectMap.end())
+      return;
+
+   // Updating the proxy needs the GIL, which the caller may not hold: the object
+   // can be deleted by a method called from Python with __release_gil__ set
+   PyGILState_STATE state = PyGILState_Ensure();
    ObjectMap_t::iterator ppo = fObjectMap.find(cppobj);
    if (ppo != fObjectMap.end()) {
       klass = ppo->second;
       MemoryRegulator::RecursiveRemove(cppobj, klass);
       fObjectMap.erase(ppo);
    }
+   PyGILState_Release(state);
 }
 
 ////////////////////////////////////////////////////////////////////////////
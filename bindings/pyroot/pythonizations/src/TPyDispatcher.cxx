@@ -21,6 +21,20 @@
 // Standard
 #include <stdarg.h>
 
+namespace {
+
+// The callbacks can be invoked from C++ code that runs without the GIL, e.g. a
+// method called from Python with __release_gil__ set
+class PyGILRAII {
+   PyGILState_STATE fGILState;
+
+public:
+   PyGILRAII() : fGILState(PyGILState_Ensure()) {}
+   ~PyGILRAII() { PyGILState_Release(fGILState); }
+};
+
+} // unnamed namespace
+
 //______________________________________________________________________________
 //                         Python callback dispatcher
 //                         ==========================
@@ -31,6 +45,7 @@
 //- constructors/destructor --------------------------------------------------
 TPyDispatcher::TPyDispatcher(PyObject *callable) : fCallable(0)
 {
+   PyGILRAII gil;
    // Construct a TPyDispatcher from a callable python object. Applies python
    // object reference counting.
    Py_XINCREF(callable);
@@ -42,6 +57,7 @@ TPyDispatcher::TPyDispatcher(PyObject *callable) : fCallable(0)
 
 TPyDispatcher::TPyDispatcher(const TPyDispatcher &other) : TObject(other)
 {
+   PyGILRAII gil;
    Py_XINCREF(other.fCallable);
    fCallable = other.fCallable;
 }
@@ -51,6 +67,7 @@ TPyDispatcher::TPyDispatcher(const TPyDispatcher &other) : TObject(other)
 
 TPyDispatcher &TPyDispatcher::operator=(const TPyDispatcher &other)
 {
+   PyGILRAII gil;
    if (this != &other) {
       this->TObject::operator=(other);
 
@@ -67,12 +84,14 @@ TPyDispatcher &TPyDispatcher::operator=(const TPyDispatcher &other)
 
 TPyDispatcher::~TPyDispatcher()
 {
+   PyGILRAII gil;
    Py_XDECREF(fCallable);
 }
 
 //- public members -----------------------------------------------------------
 PyObject *TPyDispatcher::DispatchVA(const char *format, ...)
 {
+   PyGILRAII gil;
    // Dispatch the arguments to the held callable python object, using format to
    // interpret the types of the arguments. Note that format is in python style,
    // not in C printf style. See: https://docs.python.org/2/c-api/arg.html .
@@ -113,6 +132,7 @@ PyObject *TPyDispatcher::DispatchVA(const char *format, ...)
 
 PyObject *TPyDispatcher::DispatchVA1(const char *clname, void *obj, const char *format, ...)
 {
+   PyGILRAII gil;
    PyObject *pyobj = CPyCppyy::BindCppObject(obj, Cppyy::GetScope(clname), kFALSE /* isRef */);
    if (!pyobj) {
       PyErr_Print();
@@ -170,6 +190,7 @@ PyObject *TPyDispatcher::DispatchVA1(const char *clname, void *obj, const char *
 
 PyObject *TPyDispatcher::Dispatch(TPad *selpad, TObject *selected, Int_t event)
 {
+   PyGILRAII gil;
    PyObject *args = PyTuple_New(3);
    PyTuple_SET_ITEM(args, 0, CPyCppyy::BindCppObject(selpad, Cppyy::GetScope("TPad")));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::BindCppObject(selected, Cppyy::GetScope("TObject")));
@@ -190,6 +211,7 @@ PyObject *TPyDispatcher::Dispatch(TPad *selpad, TObject *selected, Int_t event)
 
 PyObject *TPyDispatcher::Dispatch(Int_t event, Int_t x, Int_t y, TObject *selected)
 {
+   PyGILRAII gil;
    PyObject *args = PyTuple_New(4);
    PyTuple_SET_ITEM(args, 0, PyInt_FromLong(event));
    PyTuple_SET_ITEM(args, 1, PyInt_FromLong(x));
@@ -211,6 +233,7 @@ PyObject *TPyDispatcher::Dispatch(Int_t event, Int_t x, Int_t y, TObject *select
 
 PyObject *TPyDispatcher::Dispatch(TVirtualPad *pad, TObject *obj, Int_t event)
 {
+   PyGILRAII gil;
    PyObject *args = PyTuple_New(3);
    PyTuple_SET_ITEM(args, 0, CPyCppyy::BindCppObject(pad, Cppyy::GetScope("TVirtualPad")));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::BindCppObject(obj, Cppyy::GetScope("TObject")));
@@ -231,6 +254,7 @@ PyObject *TPyDispatcher::Dispatch(TVirtualPad *pad, TObject *obj, Int_t event)
 
 PyObject *TPyDispatcher::Dispatch(TGListTreeItem *item, TDNDData *data)
 {
+   PyGILRAII gil;
    PyObject *args = PyTuple_New(2);
    PyTuple_SET_ITEM(args, 0, CPyCppyy::BindCppObject(item, Cppyy::GetScope("TGListTreeItem")));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::BindCppObject(data, Cppyy::GetScope("TDNDData")));
@@ -250,6 +274,7 @@ PyObject *TPyDispatcher::Dispatch(TGListTreeItem *item, TDNDData *data)
 
 PyObject *TPyDispatcher::Dispatch(const char *name, const TList *attr)
 {
+   PyGILRAII gil;
    PyObject *args = PyTuple_New(2);
    PyTuple_SET_ITEM(args, 0, PyBytes_FromString(name));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::BindCppObject((void *)attr, Cppyy::GetScope("TList")));
@@ -269,6 +294,7 @@ PyObject *TPyDispatcher::Dispatch(const char *name, const TList *attr)
 
 PyObject *TPyDispatcher::Dispatch(TSlave *slave, TProofProgressInfo *pi)
 {
+   PyGILRAII gil;
    PyObject *args = PyTuple_New(2);
    PyTuple_SET_ITEM(args, 0, CPyCppyy::BindCppObject(slave, Cppyy::GetScope("TSlave")));
    PyTuple_SET_ITEM(args, 1, CPyCppyy::BindCppObject(pi, Cppyy::GetScope("TProofProgressInfo")));
@@ -0,0 +1,82 @@
+from array import array
+import threading
+import unittest
+
+import ROOT
+
+
+def pyf_line(x, p):
+    return p[0] * x[0] + p[1]
+
+
+class GILRelease(unittest.TestCase):
+    """
+    Test the methods running long computations in C++ that are called without
+    the GIL once the thread safety of ROOT is enabled
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        ROOT.EnableThreadSafety()
+
+    @staticmethod
+    def _run_in_threads(func, nthreads=4):
+        results = [None] * nthreads
+
+        def target(i):
+            results[i] = func(i)
+
+        threads = [threading.Thread(target=target, args=(i,)) for i in range(nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        return results
+
+    def test_fit_python_callback(self):
+        """
+        Test a fit whose function is a Python callable, which re-acquires the GIL
+        """
+        def fit(i):
+            h = ROOT.TH1D("h_fit_{}".format(i), "", 10, 0, 10)
+            h.SetDirectory(ROOT.nullptr)
+            for x in range(10):
+                h.SetBinContent(x + 1, 2 * h.GetBinCenter(x + 1) + 1)
+            f = ROOT.TF1("f_fit_{}".format(i), pyf_line, 0, 10, 2)
+            f.SetParameters(1, 0)
+            h.Fit(f, "Q0N")
+            return f.GetParameter(0), f.GetParameter(1)
+
+        for slope, offset in self._run_in_threads(fit):
+            self.assertAlmostEqual(slope, 2, places=4)
+            self.assertAlmostEqual(offset, 1, places=4)
+
+    def test_tree_draw(self):
+        """
+        Test TTree.Draw called from several Python threads
+        """
+        def draw(i):
+            t = ROOT.TTree("t_draw_{}".format(i), "")
+            t.SetDirectory(ROOT.nullptr)
+            x = array("i", [0])
+            t.Branch("x", x, "x/I")
+            for j in range(100):
+                x[0] = j
+                t.Fill()
+            return t.Draw("x", "x >= 50", "goff")
+
+        self.assertEqual(self._run_in_threads(draw), [50] * 4)
+
+    def test_rdataframe_getvalue(self):
+        """
+        Test the event loop triggered by RResultPtr.GetValue
+        """
+        def count(i):
+            df = ROOT.RDataFrame(1000 * (i + 1))
+            return df.Count().GetValue()
+
+        self.assertEqual(self._run_in_threads(count), [1000, 2000, 3000, 4000])
+
+
+if __name__ == '__main__':
+    unittest.main()
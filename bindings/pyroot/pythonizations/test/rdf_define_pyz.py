@@ -107,6 +107,34 @@ class PyDefine(unittest.TestCase):
         for x,y in zip(rdf2.Take['ULong64_t']("rdfentry_"), rdf2.Take['ULong64_t']("x")):
            self.assertEqual(x*x, y)
 
+    def test_same_name_different_functions(self):
+        """
+        Test that functions with the same name, e.g. redefined in a loop, are
+        jitted separately.
+        """
+        rdf = ROOT.RDataFrame(5).Define("x", "(double) rdfentry_")
+        arr = np.arange(0, 5)
+        for scale in (2., 3.):
+            def scaled(x):
+                return x * scale
+            rdf_scaled = rdf.Define("x_scaled", scaled)
+            self.assertTrue(np.array_equal(rdf_scaled.AsNumpy()["x_scaled"], arr * scale))
+
+    def test_same_function_different_types(self):
+        """
+        Test that a function used with columns of different types is jitted
+        once per signature.
+        """
+        def square(v):
+            return v * v
+        rdf = ROOT.RDataFrame(5).Define("i", "(int) rdfentry_").Define("d", "0.5 * rdfentry_")
+        rdf = rdf.Define("i2", square, ["i"]).Define("d2", square, ["d"]).Define("i2_again", square, ["i"])
+        arr = np.arange(0, 5)
+        result = rdf.AsNumpy(["i2", "d2", "i2_again"])
+        self.assertTrue(np.array_equal(result["i2"], arr * arr))
+        self.assertTrue(np.array_equal(result["d2"], (0.5 * arr)**2))
+        self.assertTrue(np.array_equal(result["i2_again"], arr * arr))
+
     
 if __name__ == '__main__':
     unittest.main()
@@ -1,3 +1,5 @@
+import subprocess
+import sys
 import unittest
 
 
@@ -44,3 +46,16 @@ class ROOTModule(unittest.TestCase):
         import ROOT
         self.assertEqual(ROOT.PyConfig.IgnoreCommandLineOptions, True)
         ROOT.PyConfig.IgnoreCommandLineOptions = False
+
+
+    def test_lazy_pythonizations(self):
+        """
+        Test that the pythonization modules are imported on the first lookup
+        in the module, not by the import itself
+        """
+        code = ("import sys; import ROOT; "
+                "assert 'ROOT._pythonization._th1' not in sys.modules; "
+                "h = ROOT.TH1F('h', 'h', 10, 0, 1); "
+                "assert 'ROOT._pythonization._th1' in sys.modules; "
+                "assert hasattr(h, '__array_interface__')")
+        subprocess.check_call([sys.executable, "-c", code])
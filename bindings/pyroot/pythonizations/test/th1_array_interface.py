@@ -0,0 +1,89 @@
+import unittest
+
+import numpy
+
+import ROOT
+
+
+class TH1ArrayInterface(unittest.TestCase):
+    """
+    Test for the __array_interface__ of TArray, TH1 and THnT, which lets NumPy
+    view their contents without copying them.
+    """
+
+    # Tests
+    def test_tarray(self):
+        a = ROOT.TArrayI(3)
+        a[1] = 5
+        npy = numpy.asarray(a)
+        self.assertEqual(npy.dtype, numpy.int32)
+        self.assertEqual(list(npy), [0, 5, 0])
+        a[2] = 7
+        self.assertEqual(npy[2], 7)
+
+    def test_th1(self):
+        h = ROOT.TH1F("testTH1ArrayInterface", "", 4, 0, 4)
+        h.Fill(1.5, 3)
+        npy = numpy.asarray(h)
+        self.assertEqual(npy.dtype, numpy.float32)
+        self.assertEqual(npy.shape, (6, ))
+        self.assertEqual(npy[2], 3)
+        # The array is a view of the histogram contents
+        npy[3] = 2
+        self.assertEqual(h.GetBinContent(3), 2)
+        h.Fill(-1)
+        self.assertEqual(npy[0], 1)
+
+    def test_th2(self):
+        h = ROOT.TH2D("testTH2ArrayInterface", "", 3, 0, 3, 5, 0, 5)
+        h.Fill(0.5, 3.5, 2)
+        h.Fill(2.5, 0.5, 4)
+        npy = numpy.asarray(h)
+        self.assertEqual(npy.shape, (5, 7))
+        for x in range(5):
+            for y in range(7):
+                self.assertEqual(npy[x, y], h.GetBinContent(x, y))
+
+    def test_thn(self):
+        nbins = numpy.array([2, 3], dtype=numpy.int32)
+        xmin = numpy.zeros(2)
+        xmax = numpy.array([2., 3.])
+        h = ROOT.THnD("testTHnArrayInterface", "", 2, nbins, xmin, xmax)
+        npy = numpy.asarray(h)
+        self.assertEqual(npy.dtype, numpy.float64)
+        self.assertEqual(npy.shape, (4, 5))
+        self.assertEqual(npy.sum(), 0)
+        h.Fill(numpy.array([1.5, 0.5]), 2.)
+        self.assertEqual(npy[2, 1], 2)
+        self.assertEqual(npy.sum(), 2)
+
+    def test_fill_arrays(self):
+        h1 = ROOT.TH1D("testTH1FillArrays", "", 4, 0, 4)
+        h1.Fill(numpy.array([0.5, 1.5, 1.5, 7.]))
+        self.assertEqual([h1.GetBinContent(i) for i in range(6)], [0, 1, 2, 0, 0, 1])
+        h1.Fill([2.5, 3.5], numpy.array([2., 3.]))
+        self.assertEqual(h1.GetBinContent(3), 2)
+        self.assertEqual(h1.GetBinContent(4), 3)
+        h1.Fill(numpy.array([2.5]), 0.5)
+        self.assertEqual(h1.GetBinContent(3), 2.5)
+        # Scalar fills still go to the C++ overloads
+        h1.Fill(0.5, 4)
+        self.assertEqual(h1.GetBinContent(1), 5)
+        with self.assertRaises(ValueError):
+            h1.Fill(numpy.zeros(3), numpy.ones(2))
+
+        h2 = ROOT.TH2F("testTH2FillArrays", "", 2, 0, 2, 2, 0, 2)
+        h2.Fill(numpy.array([0.5, 1.5]), numpy.array([1.5, 1.5]), numpy.array([1., 2.]))
+        self.assertEqual(h2.GetBinContent(1, 2), 1)
+        self.assertEqual(h2.GetBinContent(2, 2), 2)
+        h2.Fill(0.5, 0.5, 3)
+        self.assertEqual(h2.GetBinContent(1, 1), 3)
+
+        p = ROOT.TProfile("testTProfileFillArrays", "", 2, 0, 2)
+        p.Fill(numpy.array([0.5, 0.5]), numpy.array([1., 3.]))
+        self.assertEqual(p.GetBinContent(1), 2)
+        self.assertEqual(p.GetBinEntries(1), 2)
+
+
+if __name__ == '__main__':
+    unittest.main()
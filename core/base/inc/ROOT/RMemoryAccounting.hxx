@@ -0,0 +1,90 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RMemoryAccounting
+#define ROOT_RMemoryAccounting
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ROOT {
+namespace Experimental {
+
+/// The subsystems whose heap usage is accounted by MemoryAccounting.
+enum class EMemoryTag : unsigned char {
+   kBasket,      ///< Buffers of the TBaskets of TTrees
+   kFileCache,   ///< Buffers of TFileCacheRead and TTreeCache
+   kPages,       ///< Pages of RNTuple columns, as held by the page pool
+   kClusterPool, ///< Packed and compressed pages of the RNTuple clusters loaded by the cluster pool
+   kBufferPool,  ///< TBufferFile objects kept for reuse by the I/O buffer pool (RBufferPool)
+   kUser,        ///< Free to use by applications
+   kNTags
+};
+
+/**
+\namespace ROOT::Experimental::MemoryAccounting
+\ingroup Base
+\brief Heap usage per subsystem, counted with atomic counters and without locks.
+
+The subsystems tagged by EMemoryTag report the memory they allocate and release, so that the memory of a job can be
+attributed to e.g. the basket buffers or the RNTuple page pool. The accounted sizes are the ones of the buffers as
+allocated; the bookkeeping overhead of the subsystems is not included.
+
+~~~{.cpp}
+ROOT::Experimental::MemoryAccounting::Print();
+auto usage = ROOT::Experimental::MemoryAccounting::GetUsage(ROOT::Experimental::EMemoryTag::kBasket);
+~~~
+*/
+namespace MemoryAccounting {
+
+struct RUsage {
+   /// The number of bytes currently in use
+   std::int64_t fCurrent = 0;
+   /// The largest value of fCurrent since the start or the last call to ResetPeaks()
+   std::int64_t fPeak = 0;
+   /// The number of reported allocations
+   std::uint64_t fNAllocations = 0;
+};
+
+/// Account for nbytes allocated (positive) or released (negative) by the subsystem tag.
+void Add(EMemoryTag tag, std::int64_t nbytes);
+RUsage GetUsage(EMemoryTag tag);
+const char *GetTagName(EMemoryTag tag);
+/// Set the peak of every tag to its current usage.
+void ResetPeaks();
+/// Print the usage of all tags on stdout.
+void Print();
+
+/// A size that changes over time, e.g. the capacity of a buffer, accounted for a tag; released on destruction.
+class RAccountedSize {
+   EMemoryTag fTag;
+   std::size_t fSize = 0;
+
+public:
+   explicit RAccountedSize(EMemoryTag tag) : fTag(tag) {}
+   RAccountedSize(const RAccountedSize &) = delete;
+   RAccountedSize &operator=(const RAccountedSize &) = delete;
+   ~RAccountedSize() { Set(0); }
+
+   void Set(std::size_t size)
+   {
+      if (size == fSize)
+         return;
+      Add(fTag, static_cast<std::int64_t>(size) - static_cast<std::int64_t>(fSize));
+      fSize = size;
+   }
+   std::size_t Get() const { return fSize; }
+};
+
+} // namespace MemoryAccounting
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -486,6 +486,7 @@ TString ToUpper(const TString &s);    // Return upper-case version of argument
 inline UInt_t Hash(const TString &s) { return s.Hash(); }
 inline UInt_t Hash(const TString *s) { return s->Hash(); }
        UInt_t Hash(const char *s);
+       UInt_t Hash(const char *s, Ssiz_t len);
 
 extern char *Form(const char *fmt, ...)      // format in circular buffer
 #if defined(__GNUC__) && !defined(__CINT__)
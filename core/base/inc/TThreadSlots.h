@@ -31,8 +31,9 @@ namespace ROOT {
       kDirectoryThreadSlot = 22,
       kFileThreadSlot      = 23,
       kPerfStatsThreadSlot = 24,
+      kPSThreadSlot        = 25,
 
-      kMaxThreadSlot       = 25  // Size of the array of thread local slots in TThread
+      kMaxThreadSlot       = 26  // Size of the array of thread local slots in TThread
    };
 }
 
@@ -69,6 +69,12 @@ public:
 
    virtual void UnzipEvent(TObject *tree, Long64_t pos, Double_t start, Int_t complen, Int_t objlen) = 0;
 
+   /// Called after TTree::GetEntry read one top-level branch, no-op by default
+   virtual void BranchReadEvent(TBranch * /*branch*/, Int_t /*nbytes*/, Double_t /*start*/) {}
+
+   /// Called after a basket of a branch was decompressed, no-op by default
+   virtual void BranchUnzipEvent(TBranch * /*branch*/, Double_t /*start*/, Int_t /*complen*/, Int_t /*objlen*/) {}
+
    virtual void RateEvent(Double_t proctime, Double_t deltatime,
                           Long64_t eventsprocessed, Long64_t bytesRead) = 0;
 
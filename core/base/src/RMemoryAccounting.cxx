@@ -0,0 +1,82 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RMemoryAccounting.hxx"
+
+#include "TString.h"
+
+#include <atomic>
+
+namespace {
+
+constexpr std::size_t kNTags = static_cast<std::size_t>(ROOT::Experimental::EMemoryTag::kNTags);
+
+/// One cache line per tag, so that subsystems do not contend with each other
+struct alignas(64) TagCounters {
+   std::atomic<std::int64_t> fCurrent{0};
+   std::atomic<std::int64_t> fPeak{0};
+   std::atomic<std::uint64_t> fNAllocations{0};
+};
+
+TagCounters gCounters[kNTags];
+
+const char *gTagNames[kNTags] = {"TBasket buffers",      "File/tree caches", "RNTuple pages",
+                                 "RNTuple cluster pool", "I/O buffer pool",  "User"};
+
+} // anonymous namespace
+
+void ROOT::Experimental::MemoryAccounting::Add(EMemoryTag tag, std::int64_t nbytes)
+{
+   auto &counters = gCounters[static_cast<std::size_t>(tag)];
+   const auto current = counters.fCurrent.fetch_add(nbytes, std::memory_order_relaxed) + nbytes;
+   if (nbytes <= 0)
+      return;
+   counters.fNAllocations.fetch_add(1, std::memory_order_relaxed);
+   auto peak = counters.fPeak.load(std::memory_order_relaxed);
+   while (current > peak && !counters.fPeak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+   }
+}
+
+ROOT::Experimental::MemoryAccounting::RUsage ROOT::Experimental::MemoryAccounting::GetUsage(EMemoryTag tag)
+{
+   const auto &counters = gCounters[static_cast<std::size_t>(tag)];
+   RUsage usage;
+   usage.fCurrent = counters.fCurrent.load(std::memory_order_relaxed);
+   usage.fPeak = counters.fPeak.load(std::memory_order_relaxed);
+   usage.fNAllocations = counters.fNAllocations.load(std::memory_order_relaxed);
+   return usage;
+}
+
+const char *ROOT::Experimental::MemoryAccounting::GetTagName(EMemoryTag tag)
+{
+   const auto idx = static_cast<std::size_t>(tag);
+   return idx < kNTags ? gTagNames[idx] : "";
+}
+
+void ROOT::Experimental::MemoryAccounting::ResetPeaks()
+{
+   for (auto &counters : gCounters)
+      counters.fPeak = counters.fCurrent.load(std::memory_order_relaxed);
+}
+
+void ROOT::Experimental::MemoryAccounting::Print()
+{
+   Printf("%-24s%16s%16s%16s", "Subsystem", "current [kB]", "peak [kB]", "allocations");
+   Printf("========================================================================");
+   std::int64_t total = 0;
+   for (std::size_t i = 0; i < kNTags; ++i) {
+      const auto usage = GetUsage(static_cast<EMemoryTag>(i));
+      total += usage.fCurrent;
+      Printf("%-24s%16lld%16lld%16llu", gTagNames[i], static_cast<long long>(usage.fCurrent / 1024),
+             static_cast<long long>(usage.fPeak / 1024), static_cast<unsigned long long>(usage.fNAllocations));
+   }
+   Printf("------------------------------------------------------------------------");
+   Printf("%-24s%16lld", "Total", static_cast<long long>(total / 1024));
+}
@@ -115,6 +115,7 @@ FARPROC dlsym(void *library, const char *function_name)
 
 #include <iostream>
 #include "ROOT/FoundationUtils.hxx"
+#include "ROOT/RStartupTrace.hxx"
 #include "TROOT.h"
 #include "TClass.h"
 #include "TClassEdit.h"
@@ -165,6 +166,7 @@ FARPROC dlsym(void *library, const char *function_name)
 #endif
 
 extern "C" void R__SetZipMode(int);
+extern "C" int R__SetUnzipBackend(const char *name);
 
 static DestroyInterpreter_t *gDestroyInterpreter = nullptr;
 static void *gInterpreterLib = nullptr;
@@ -643,6 +645,8 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
       return;
    }
 
+   ROOT::Internal::StartupTrace::RScope traceScope("TROOT", "TROOT::TROOT");
+
    R__LOCKGUARD(gROOTMutex);
 
    ROOT::Internal::gROOTLocal = this;
@@ -1975,6 +1979,11 @@ void TROOT::InitSystem()
       Int_t zipmode = gEnv->GetValue("Root.CompressionAlgorithm", oldzipmode);
       if (zipmode != 0) R__SetZipMode(zipmode);
 
+      const char *unzipBackend = gEnv->GetValue("Root.UnzipBackend", "auto");
+      if (!R__SetUnzipBackend(unzipBackend))
+         fprintf(stderr, "Warning in <TROOT::InitSystem>: unknown Root.UnzipBackend \"%s\", using the default!\n",
+                 unzipBackend);
+
       const char *sdeb;
       if ((sdeb = gSystem->Getenv("ROOTDEBUG")))
          gDebug = atoi(sdeb);
@@ -1990,6 +1999,8 @@ void TROOT::InitSystem()
       { TUrl dummy("/dummy"); }
 #endif
       TObject::SetObjectStat(gEnv->GetValue("Root.ObjectStat", 0));
+      if (gEnv->GetValue("Root.ObjectPool", 0))
+         TStorage::EnableObjectPool();
    }
 }
 
@@ -2009,6 +2020,8 @@ void TROOT::InitThreads()
 
 void TROOT::InitInterpreter()
 {
+   ROOT::Internal::StartupTrace::RScope traceScope("TROOT", "TROOT::InitInterpreter");
+
    // usedToIdentifyRootClingByDlSym is available when TROOT is part of
    // rootcling.
    if (!dlsym(RTLD_DEFAULT, "usedToIdentifyRootClingByDlSym")
@@ -2069,7 +2082,10 @@ void TROOT::InitInterpreter()
 #endif
       nullptr};
 
-   fInterpreter = CreateInterpreter(gInterpreterLib, interpArgs);
+   {
+      ROOT::Internal::StartupTrace::RScope createScope("TROOT", "CreateInterpreter");
+      fInterpreter = CreateInterpreter(gInterpreterLib, interpArgs);
+   }
 
    fCleanups->Add(fInterpreter);
    fInterpreter->SetBit(kMustCleanup);
@@ -2098,7 +2114,10 @@ void TROOT::InitInterpreter()
    }
    GetModuleHeaderInfoBuffer().clear();
 
-   fInterpreter->Initialize();
+   {
+      ROOT::Internal::StartupTrace::RScope initScope("TROOT", "TInterpreter::Initialize");
+      fInterpreter->Initialize();
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
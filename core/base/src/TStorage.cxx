@@ -39,6 +39,10 @@ and statistics gathering in the system.
 #include "TVirtualMutex.h"
 #include "TInterpreter.h"
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
 #if !defined(R__NOSTATS)
 #   define MEM_DEBUG
 #   define MEM_STAT
@@ -88,6 +92,271 @@ static Int_t    gTraceCapacity = 10, gTraceIndex = 0,
 ROOT::Internal::FreeIfTMapFile_t *ROOT::Internal::gFreeIfTMapFile = nullptr;
 void *ROOT::Internal::gMmallocDesc = nullptr; //is used and set in TMapFile
 
+namespace {
+
+/// Optional pool for TObject allocations, see TStorage::EnableObjectPool().
+///
+/// Blocks of up to kMaxSize bytes are served from size classes in multiples of
+/// kGranularity. Each thread keeps free lists per size class; batches of blocks
+/// move between them and a global depot, which carves new blocks out of aligned
+/// slabs. Slabs are never returned to the system. A two-level map from slab
+/// number to size class tells, from the address only, whether a block to be
+/// freed belongs to the pool; other addresses go back to ::operator delete.
+namespace ObjectPool {
+
+constexpr size_t kGranularity = 16;
+constexpr size_t kMaxSize = 512;
+constexpr unsigned kNumClasses = kMaxSize / kGranularity;
+constexpr unsigned kSlabShift = 18;
+constexpr size_t kSlabSize = size_t(1) << kSlabShift;
+constexpr unsigned kAddressBits = 48;
+constexpr unsigned kLeafBits = 15;
+constexpr unsigned kRootBits = kAddressBits - kSlabShift - kLeafBits;
+/// Number of blocks moved at once between a thread cache and the depot
+constexpr unsigned kBatch = 64;
+/// A thread cache gives a batch back to the depot above this number of free blocks
+constexpr unsigned kMaxCached = 4 * kBatch;
+
+struct FreeBlock {
+   FreeBlock *fNext;
+};
+
+/// Size class + 1 of each slab, 0 for memory that is not owned by the pool
+struct Leaf {
+   std::atomic<unsigned char> fSlabClass[size_t(1) << kLeafBits];
+};
+
+struct Depot {
+   std::mutex fMutex;
+   std::atomic<Leaf *> fPageMap[size_t(1) << kRootBits] = {};
+   FreeBlock *fFree[kNumClasses] = {};
+   ULong64_t fNAlloc[kNumClasses] = {};
+   ULong64_t fNFree[kNumClasses] = {};
+   ULong64_t fNSlabs[kNumClasses] = {};
+};
+
+std::atomic<bool> gEnabled{false};
+/// Set once the first slab is created; until then no address can belong to the pool
+std::atomic<bool> gHasSlabs{false};
+
+/// Leaked on purpose: pooled objects may be deleted during static destruction.
+Depot &GetDepot()
+{
+   static Depot *depot = new Depot;
+   return *depot;
+}
+
+unsigned GetSizeClass(size_t size)
+{
+   return size ? (size - 1) / kGranularity : 0;
+}
+
+/// Returns the size class + 1 of the slab containing addr, 0 if not in the pool.
+unsigned FindSlab(const void *addr)
+{
+   const auto slab = reinterpret_cast<std::uintptr_t>(addr) >> kSlabShift;
+   if (slab >> (kRootBits + kLeafBits))
+      return 0;
+   Leaf *leaf = GetDepot().fPageMap[slab >> kLeafBits].load(std::memory_order_acquire);
+   if (!leaf)
+      return 0;
+   return leaf->fSlabClass[slab & ((size_t(1) << kLeafBits) - 1)].load(std::memory_order_relaxed);
+}
+
+/// Carve a new slab into blocks of size class cls. Must be called with the depot mutex locked.
+bool AddSlab(Depot &depot, unsigned cls)
+{
+#ifdef WIN32
+   void *slab = _aligned_malloc(kSlabSize, kSlabSize);
+#else
+   void *slab = nullptr;
+   if (posix_memalign(&slab, kSlabSize, kSlabSize) != 0)
+      slab = nullptr;
+#endif
+   if (!slab)
+      return false;
+   const auto slabNumber = reinterpret_cast<std::uintptr_t>(slab) >> kSlabShift;
+   if (slabNumber >> (kRootBits + kLeafBits)) {
+      // Outside of the address range covered by the map
+#ifdef WIN32
+      _aligned_free(slab);
+#else
+      free(slab);
+#endif
+      return false;
+   }
+
+   auto &root = depot.fPageMap[slabNumber >> kLeafBits];
+   Leaf *leaf = root.load(std::memory_order_relaxed);
+   if (!leaf) {
+      leaf = new Leaf();
+      root.store(leaf, std::memory_order_release);
+   }
+   leaf->fSlabClass[slabNumber & ((size_t(1) << kLeafBits) - 1)].store(cls + 1, std::memory_order_relaxed);
+   gHasSlabs = true;
+
+   const size_t blockSize = (cls + 1) * kGranularity;
+   char *block = static_cast<char *>(slab);
+   for (size_t i = 0; i + blockSize <= kSlabSize; i += blockSize) {
+      auto freeBlock = reinterpret_cast<FreeBlock *>(block + i);
+      freeBlock->fNext = depot.fFree[cls];
+      depot.fFree[cls] = freeBlock;
+   }
+   depot.fNSlabs[cls]++;
+   return true;
+}
+
+struct ThreadCache {
+   FreeBlock *fFree[kNumClasses] = {};
+   unsigned fCount[kNumClasses] = {};
+   ULong64_t fNAlloc[kNumClasses] = {};
+   ULong64_t fNFree[kNumClasses] = {};
+
+   /// Add the counters to the depot statistics. Must be called with the depot mutex locked.
+   void FlushStatistics(Depot &depot, unsigned cls)
+   {
+      depot.fNAlloc[cls] += fNAlloc[cls];
+      depot.fNFree[cls] += fNFree[cls];
+      fNAlloc[cls] = fNFree[cls] = 0;
+   }
+
+   /// Take up to kBatch blocks from the depot, creating a slab if needed
+   bool Refill(unsigned cls)
+   {
+      auto &depot = GetDepot();
+      std::lock_guard<std::mutex> lock(depot.fMutex);
+      FlushStatistics(depot, cls);
+      if (!depot.fFree[cls] && !AddSlab(depot, cls))
+         return false;
+      while (depot.fFree[cls] && fCount[cls] < kBatch) {
+         FreeBlock *block = depot.fFree[cls];
+         depot.fFree[cls] = block->fNext;
+         block->fNext = fFree[cls];
+         fFree[cls] = block;
+         fCount[cls]++;
+      }
+      return true;
+   }
+
+   /// Give nBlocks free blocks back to the depot
+   void Spill(unsigned cls, unsigned nBlocks)
+   {
+      auto &depot = GetDepot();
+      std::lock_guard<std::mutex> lock(depot.fMutex);
+      FlushStatistics(depot, cls);
+      for (unsigned i = 0; i < nBlocks && fFree[cls]; ++i) {
+         FreeBlock *block = fFree[cls];
+         fFree[cls] = block->fNext;
+         block->fNext = depot.fFree[cls];
+         depot.fFree[cls] = block;
+         fCount[cls]--;
+      }
+   }
+
+   ~ThreadCache();
+};
+
+thread_local bool gThreadCacheDestroyed = false;
+
+/// Returns nullptr once the cache of this thread is destroyed, i.e. during thread exit.
+ThreadCache *GetThreadCache()
+{
+   if (gThreadCacheDestroyed)
+      return nullptr;
+   thread_local ThreadCache cache;
+   return &cache;
+}
+
+ThreadCache::~ThreadCache()
+{
+   for (unsigned cls = 0; cls < kNumClasses; ++cls)
+      Spill(cls, fCount[cls]);
+   gThreadCacheDestroyed = true;
+}
+
+/// Returns nullptr if the pool cannot serve this size.
+void *Alloc(size_t size)
+{
+   if (size > kMaxSize)
+      return nullptr;
+   const unsigned cls = GetSizeClass(size);
+   ThreadCache *cache = GetThreadCache();
+   if (!cache) {
+      auto &depot = GetDepot();
+      std::lock_guard<std::mutex> lock(depot.fMutex);
+      if (!depot.fFree[cls] && !AddSlab(depot, cls))
+         return nullptr;
+      FreeBlock *block = depot.fFree[cls];
+      depot.fFree[cls] = block->fNext;
+      depot.fNAlloc[cls]++;
+      return block;
+   }
+   if (!cache->fFree[cls] && !cache->Refill(cls))
+      return nullptr;
+   FreeBlock *block = cache->fFree[cls];
+   cache->fFree[cls] = block->fNext;
+   cache->fCount[cls]--;
+   cache->fNAlloc[cls]++;
+   return block;
+}
+
+/// Returns false if addr does not belong to the pool.
+bool Free(void *addr)
+{
+   if (!gHasSlabs.load(std::memory_order_relaxed))
+      return false;
+   const unsigned slabClass = FindSlab(addr);
+   if (!slabClass)
+      return false;
+   const unsigned cls = slabClass - 1;
+   auto block = static_cast<FreeBlock *>(addr);
+   ThreadCache *cache = GetThreadCache();
+   if (!cache) {
+      auto &depot = GetDepot();
+      std::lock_guard<std::mutex> lock(depot.fMutex);
+      block->fNext = depot.fFree[cls];
+      depot.fFree[cls] = block;
+      depot.fNFree[cls]++;
+      return true;
+   }
+   block->fNext = cache->fFree[cls];
+   cache->fFree[cls] = block;
+   cache->fNFree[cls]++;
+   if (++cache->fCount[cls] > kMaxCached)
+      cache->Spill(cls, kBatch);
+   return true;
+}
+
+void PrintStatistics()
+{
+   auto &depot = GetDepot();
+   ThreadCache *cache = GetThreadCache();
+   std::lock_guard<std::mutex> lock(depot.fMutex);
+   if (cache) {
+      for (unsigned cls = 0; cls < kNumClasses; ++cls)
+         cache->FlushStatistics(depot, cls);
+   }
+
+   Printf("Object pool statistics (counts of other running threads are partial)");
+   Printf("%12s%12s%12s%12s%12s", "size", "alloc", "free", "diff", "slabs");
+   Printf("============================================================");
+   ULong64_t nSlabs = 0;
+   for (unsigned cls = 0; cls < kNumClasses; ++cls) {
+      if (!depot.fNSlabs[cls])
+         continue;
+      nSlabs += depot.fNSlabs[cls];
+      Printf("%12u%12llu%12llu%12lld%12llu", unsigned((cls + 1) * kGranularity), depot.fNAlloc[cls],
+             depot.fNFree[cls], Long64_t(depot.fNAlloc[cls] - depot.fNFree[cls]), depot.fNSlabs[cls]);
+   }
+   Printf("------------------------------------------------------------");
+   Printf("Slab memory: %llu kB", nSlabs * (kSlabSize / 1024));
+   Printf("============================================================");
+   Printf(" ");
+}
+
+} // namespace ObjectPool
+} // anonymous namespace
+
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -331,7 +600,9 @@ Int_t *TStorage::ReAllocInt(Int_t *ovp, size_t size, size_t oldsize)
 
 void *TStorage::ObjectAlloc(size_t sz)
 {
-   void* space =  ::operator new(sz);
+   void *space = ObjectPool::gEnabled ? ObjectPool::Alloc(sz) : nullptr;
+   if (!space)
+      space = ::operator new(sz);
    memset(space, kObjectAllocMemValue, sz);
    return space;
 }
@@ -343,7 +614,9 @@ void *TStorage::ObjectAlloc(size_t sz)
 
 void *TStorage::ObjectAllocArray(size_t sz)
 {
-   void* space =  ::operator new(sz);
+   void *space = ObjectPool::gEnabled ? ObjectPool::Alloc(sz) : nullptr;
+   if (!space)
+      space = ::operator new(sz);
    return space;
 }
 
@@ -362,8 +635,8 @@ void *TStorage::ObjectAlloc(size_t , void *vp)
 
 void TStorage::ObjectDealloc(void *vp)
 {
-
-   ::operator delete(vp);
+   if (!ObjectPool::Free(vp))
+      ::operator delete(vp);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -381,7 +654,8 @@ void TStorage::ObjectDealloc(void *vp, void *ptr)
 
 void TStorage::ObjectDealloc(void *vp, size_t size)
 {
-   ::operator delete(vp, size);
+   if (!ObjectPool::Free(vp))
+      ::operator delete(vp, size);
 }
 #endif
 
@@ -412,6 +686,9 @@ void TStorage::PrintStatistics()
    // Needs to be protected by global mutex
    R__LOCKGUARD(gGlobalMutex);
 
+   if (ObjectPool::gHasSlabs)
+      ObjectPool::PrintStatistics();
+
 #if defined(MEM_DEBUG) && defined(MEM_STAT)
 
    if (!gMemStatistics || !HasCustomNewDelete())
@@ -462,6 +739,28 @@ void TStorage::EnableStatistics(int size, int ix)
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Serve the allocations of small TObjects (up to 512 bytes) from a pool with
+/// per-thread caches of free blocks, instead of the global ::operator new. This
+/// reduces the allocator contention of multi-threaded event processing that
+/// creates and deletes many small objects. Memory taken by the pool is kept for
+/// reuse and not returned to the system. Objects are freed correctly whether the
+/// pool was enabled at their allocation or not, so the pool can be switched on
+/// and off at any time. Also set by the resource Root.ObjectPool.
+
+void TStorage::EnableObjectPool(Bool_t enable)
+{
+   ObjectPool::gEnabled = enable;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return whether new TObjects are allocated from the pool, see EnableObjectPool().
+
+Bool_t TStorage::IsObjectPoolEnabled()
+{
+   return ObjectPool::gEnabled;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ULong_t TStorage::GetHeapBegin()
@@ -565,91 +565,72 @@ inline static void Mash(UInt_t& hash, UInt_t chars)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Return a case-sensitive hash value (endian independent).
+/// Read the next word of a string to hash (endian independent).
 
-UInt_t Hash(const char *str)
+inline static UInt_t HashWord(const char *p)
 {
-   UInt_t len = str ? strlen(str) : 0;
-   UInt_t hv  = len; // Mix in the string length.
-   UInt_t i   = hv*sizeof(char)/sizeof(UInt_t);
-
-   if (((ULongptr_t)str)%sizeof(UInt_t) == 0) {
-      // str is word aligned
-      const UInt_t *p = (const UInt_t*)str;
-
-      while (i--) {
+   UInt_t h;
+   memcpy(&h, p, sizeof(UInt_t));
 #ifndef R__BYTESWAP
-         UInt_t h = *p++;
-         Mash(hv, SwapInt(h));
+   return SwapInt(h);
 #else
-         Mash(hv, *p++);                   // XOR in the characters.
+   return h;
 #endif
-      }
-
-      // XOR in any remaining characters:
-      if ((i = len*sizeof(char)%sizeof(UInt_t)) != 0) {
-         UInt_t h = 0;
-         const char* c = (const char*)p;
-         while (i--)
-            h = ((h << kBitsPerByte*sizeof(char)) | *c++);
-         Mash(hv, h);
-      }
-   } else {
-      // str is not word aligned
-      UInt_t h;
-      const unsigned char *p = (const unsigned char*)str;
-
-      while (i--) {
-         memcpy(&h, p, sizeof(UInt_t));
-#ifndef R__BYTESWAP
-         Mash(hv, SwapInt(h));
-#else
-         Mash(hv, h);
-#endif
-         p += sizeof(UInt_t);
-      }
-
-      // XOR in any remaining characters:
-      if ((i = len*sizeof(char)%sizeof(UInt_t)) != 0) {
-         h = 0;
-         const char* c = (const char*)p;
-         while (i--)
-            h = ((h << kBitsPerByte*sizeof(char)) | *c++);
-         Mash(hv, h);
-      }
-   }
-   return hv;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Return a case-sensitive hash value (endian independent).
+/// Return a case-sensitive hash value (endian independent) of the first len
+/// characters of str. Same value as Hash(const char*) and TString::HashCase()
+/// for the same characters, without requiring a null terminated string.
 
-UInt_t TString::HashCase() const
+UInt_t Hash(const char *str, Ssiz_t len)
 {
-   UInt_t hv       = (UInt_t)Length(); // Mix in the string length.
-   UInt_t i        = hv*sizeof(char)/sizeof(UInt_t);
-   const UInt_t *p = (const UInt_t*)Data();
-   {
-      while (i--) {
-#ifndef R__BYTESWAP
-         UInt_t h = *p++;
-         Mash(hv, SwapInt(h));             // XOR in the characters.
-#else
-         Mash(hv, *p++);                   // XOR in the characters.
-#endif
-      }
+   const UInt_t n = (str && len > 0) ? (UInt_t)len : 0;
+   UInt_t hv = n; // Mix in the string length.
+   UInt_t i  = n*sizeof(char)/sizeof(UInt_t);
+   const char *p = str;
+
+   // Two words per iteration: Mash(Mash(hv, a), b) == b ^ rot(a) ^ rot(rot(hv)),
+   // which halves the dependency chain on hv compared to word by word.
+   const UInt_t kBits = kBitsPerByte*sizeof(UInt_t);
+   for (; i >= 2; i -= 2) {
+      UInt_t a = HashWord(p);
+      UInt_t b = HashWord(p + sizeof(UInt_t));
+      hv = b ^ ((a << kHashShift) | (a >> (kBits - kHashShift))) ^
+           ((hv << 2*kHashShift) | (hv >> (kBits - 2*kHashShift)));
+      p += 2*sizeof(UInt_t);
+   }
+   if (i) {
+      Mash(hv, HashWord(p));
+      p += sizeof(UInt_t);
    }
+
    // XOR in any remaining characters:
-   if ((i = Length()*sizeof(char)%sizeof(UInt_t)) != 0) {
+   if ((i = n*sizeof(char)%sizeof(UInt_t)) != 0) {
       UInt_t h = 0;
-      const char* c = (const char*)p;
       while (i--)
-         h = ((h << kBitsPerByte*sizeof(char)) | *c++);
+         h = ((h << kBitsPerByte*sizeof(char)) | *p++);
       Mash(hv, h);
    }
    return hv;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return a case-sensitive hash value (endian independent).
+
+UInt_t Hash(const char *str)
+{
+   return Hash(str, str ? strlen(str) : 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a case-sensitive hash value (endian independent).
+
+UInt_t TString::HashCase() const
+{
+   return ::Hash(Data(), Length());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return a case-insensitive hash value (endian independent).
 
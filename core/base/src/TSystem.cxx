@@ -22,6 +22,7 @@ allows a simple partial implementation for new OS'es.
 */
 
 #include <ROOT/FoundationUtils.hxx>
+#include <ROOT/RStartupTrace.hxx>
 #include "strlcpy.h"
 #include "TSystem.h"
 #include "TApplication.h"
@@ -44,6 +45,7 @@ allows a simple partial implementation for new OS'es.
 #include "compiledata.h"
 #include "RConfigure.h"
 #include "THashList.h"
+#include "TMD5.h"
 #include "ThreadLocalStorage.h"
 
 #include <functional>
@@ -54,6 +56,7 @@ allows a simple partial implementation for new OS'es.
 #include <string>
 #include <sys/stat.h>
 #include <set>
+#include <vector>
 
 #ifdef WIN32
 #include <io.h>
@@ -1857,6 +1860,8 @@ static bool R__MatchFilename(const char *left, const char *right)
 
 int TSystem::Load(const char *module, const char *entry, Bool_t system)
 {
+   ROOT::Internal::StartupTrace::RScope traceScope("TSystem", "TSystem::Load", module);
+
    // don't load libraries that have already been loaded
    TString libs( GetLibraries() );
    TString l(BaseName(module));
@@ -2716,6 +2721,172 @@ static void R__WriteDependencyFile(const TString & build_loc, const TString &dep
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Call onDependency for each file listed in a dependency file written by
+/// R__WriteDependencyFile, and for the ROOT version recorded in it, with
+/// isVersion set.
+
+static void R__ReadDependencyFile(FILE *depfile, const TString &version_var,
+                                  const std::function<void(const char *, Bool_t)> &onDependency)
+{
+   Int_t sz = 256;
+   char *line = new char[sz];
+   line[0] = 0;
+
+   int c;
+   Int_t current = 0;
+   Int_t nested = 0;
+   Bool_t hasversion = false;
+
+   while ((c = fgetc(depfile)) != EOF) {
+      if (c=='#') {
+         // skip comment
+         while ((c = fgetc(depfile)) != EOF) {
+            if (c=='\n') {
+               break;
+            }
+         }
+         continue;
+      }
+      if (current && line[current-1]=='=' && strncmp(version_var.Data(),line,current)==0) {
+
+         // The next word will be the version number.
+         hasversion = kTRUE;
+         line[0] = 0;
+         current = 0;
+      } else if (isspace(c) && !nested) {
+         if (current) {
+            if (line[current-1]!=':') {
+               // ignore target
+               line[current] = 0;
+               onDependency(line, hasversion);
+               hasversion = kFALSE;
+            }
+         }
+         current = 0;
+         line[0] = 0;
+      } else {
+         if (current==sz-1) {
+            sz = 2*sz;
+            char *newline = new char[sz];
+            memcpy(newline,line, current);
+            delete [] line;
+            line = newline;
+         }
+         if (c=='"') nested = !nested;
+         else {
+            line[current] = c;
+            current++;
+         }
+      }
+   }
+   delete [] line;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the directory of the shared cache of ACLiC libraries, set by the
+/// environment variable ROOT_ACLIC_CACHE or else by ACLiC.SharedCacheDir;
+/// empty if there is none.
+
+static TString R__GetACLiCCacheDir()
+{
+   const char *envDir = gSystem->Getenv("ROOT_ACLIC_CACHE");
+   TString dir = envDir ? envDir : (gEnv ? gEnv->GetValue("ACLiC.SharedCacheDir", "") : "");
+   gSystem->ExpandPathName(dir);
+   return dir;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the key of a library in the shared ACLiC cache: the hash of the
+/// compilation settings and of the content of all the files the script
+/// depends on, including the script itself, as listed in the dependency file.
+/// Only the content of the files is used, not their location, so that
+/// the key is the same for copies of the script in different directories.
+/// Returns an empty string if the dependency file can not be read.
+
+static TString R__GetACLiCCacheKey(const TString &depfilename, const TString &version_var, const TString &settings)
+{
+   FILE *depfile = fopen(depfilename.Data(), "r");
+   if (!depfile)
+      return "";
+
+   TString keySource = settings;
+   R__ReadDependencyFile(depfile, version_var, [&keySource](const char *dep, Bool_t isVersion) {
+      keySource += "\n";
+      std::unique_ptr<TMD5> checksum{isVersion ? nullptr : TMD5::FileChecksum(dep)};
+      keySource += checksum ? checksum->AsString() : dep;
+   });
+   fclose(depfile);
+
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keySource.Data()), keySource.Length());
+   md5.Final();
+   return md5.AsString();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the files of the shared ACLiC cache entry to build_loc.
+/// Returns false if the entry does not exist or can not be copied.
+
+static Bool_t R__FetchFromACLiCCache(const TString &entry, const TString &build_loc, const TString &libname_ext)
+{
+   TString cachedLib;
+   AssignAndDelete( cachedLib, gSystem->ConcatFileName(entry, libname_ext) );
+   if (gSystem->AccessPathName(cachedLib, kReadPermission))
+      return kFALSE;
+
+   void *dir = gSystem->OpenDirectory(entry);
+   if (!dir)
+      return kFALSE;
+   Bool_t copied = kTRUE;
+   while (const char *name = gSystem->GetDirEntry(dir)) {
+      if (!strcmp(name, ".") || !strcmp(name, ".."))
+         continue;
+      TString from, to;
+      AssignAndDelete( from, gSystem->ConcatFileName(entry, name) );
+      AssignAndDelete( to, gSystem->ConcatFileName(build_loc, name) );
+      copied &= gSystem->CopyFile(from, to, kTRUE) == 0;
+   }
+   gSystem->FreeDirectory(dir);
+   return copied;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store the files in the shared ACLiC cache entry. They are copied to a
+/// temporary directory which is then renamed, so that concurrent processes
+/// never see an incomplete entry. Nothing is stored if the cache is not
+/// writable, e.g. a read-only cache filled in advance.
+
+static void R__StoreInACLiCCache(const TString &entry, const std::vector<TString> &files)
+{
+   if (!gSystem->AccessPathName(entry))
+      return;
+   TString parent = gSystem->GetDirName(entry);
+   gSystem->mkdir(parent, kTRUE);
+   if (gSystem->AccessPathName(parent, kWritePermission))
+      return;
+
+   TString tmp = entry + TString::Format(".tmp%d", gSystem->GetPid());
+   if (gSystem->mkdir(tmp) != 0)
+      return;
+   std::vector<TString> copies;
+   Bool_t copied = kTRUE;
+   for (const auto &file : files) {
+      if (gSystem->AccessPathName(file))
+         continue;
+      TString to;
+      AssignAndDelete( to, gSystem->ConcatFileName(tmp, gSystem->BaseName(file)) );
+      copied &= gSystem->CopyFile(file, to, kTRUE) == 0;
+      copies.emplace_back(to);
+   }
+   if (!copied || gSystem->Rename(tmp, entry) != 0) {
+      // Another process may have stored the same entry in the meantime
+      for (const auto &copy : copies)
+         gSystem->Unlink(copy);
+      gSystem->Unlink(tmp);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This method compiles and loads a shared library containing
 /// the code from the file "filename".
@@ -2750,6 +2921,15 @@ static void R__WriteDependencyFile(const TString & build_loc, const TString &dep
 /// If dirmode is not zero and we need to create the target directory, the
 /// file mode bit will be change to 'dirmode' using chmod.
 ///
+/// If the environment variable ROOT_ACLIC_CACHE or the rootrc setting
+/// ACLiC.SharedCacheDir point to a directory, it is used as a cache of
+/// libraries shared by all the users and jobs pointing to it. A library that
+/// needs to be built is instead copied from the cache if it contains one built
+/// from identical content of the script and of all the headers it includes,
+/// with the same ROOT version, compiler and flags. Otherwise the library is built
+/// and stored in the cache, if it is writable; a read-only cache filled in
+/// advance works as well. The cache is not used with the 'f' option.
+///
 /// If library_specified is not specified, CompileMacro generate a default name
 /// for library by taking the name of the file "filename" but replacing the
 /// dot before the extension by an underscore and by adding the shared
@@ -3178,64 +3358,14 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
 
             TString version_var = libname + version_var_prefix;
 
-            Int_t sz = 256;
-            char *line = new char[sz];
-            line[0] = 0;
-
-            int c;
-            Int_t current = 0;
-            Int_t nested = 0;
-            Bool_t hasversion = false;
-
-            while ((c = fgetc(depfile)) != EOF) {
-               if (c=='#') {
-                  // skip comment
-                  while ((c = fgetc(depfile)) != EOF) {
-                     if (c=='\n') {
-                        break;
-                     }
-                  }
-                  continue;
+            R__ReadDependencyFile(depfile, version_var, [&modified, lib_time](const char *dep, Bool_t isVersion) {
+               Long_t filetime;
+               if (isVersion) {
+                  modified |= strcmp(ROOT_RELEASE,dep)!=0;
+               } else if ( gSystem->GetPathInfo( dep, nullptr, (Long_t*)nullptr, nullptr, &filetime ) == 0 ) {
+                  modified |= ( lib_time <= filetime );
                }
-               if (current && line[current-1]=='=' && strncmp(version_var.Data(),line,current)==0) {
-
-                  // The next word will be the version number.
-                  hasversion = kTRUE;
-                  line[0] = 0;
-                  current = 0;
-               } else if (isspace(c) && !nested) {
-                  if (current) {
-                     if (line[current-1]!=':') {
-                        // ignore target
-                        line[current] = 0;
-
-                        Long_t filetime;
-                        if (hasversion) {
-                           modified |= strcmp(ROOT_RELEASE,line)!=0;
-                           hasversion = kFALSE;
-                        } else if ( gSystem->GetPathInfo( line, nullptr, (Long_t*)nullptr, nullptr, &filetime ) == 0 ) {
-                           modified |= ( lib_time <= filetime );
-                        }
-                     }
-                  }
-                  current = 0;
-                  line[0] = 0;
-               } else {
-                  if (current==sz-1) {
-                     sz = 2*sz;
-                     char *newline = new char[sz];
-                     memcpy(newline,line, current);
-                     delete [] line;
-                     line = newline;
-                  }
-                  if (c=='"') nested = !nested;
-                  else {
-                     line[current] = c;
-                     current++;
-                  }
-               }
-            }
-            delete [] line;
+            });
             fclose(depfile);
             recompile = modified;
 
@@ -3367,6 +3497,32 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
       return !gSystem->Load(lib);
    };
 
+   // Look for the library in the shared cache, unless its recompilation was forced
+   const TString sharedCacheDir = R__GetACLiCCacheDir();
+   TString sharedCacheEntry;
+   Bool_t depfileWritten = kFALSE;
+   if (recompile && canWrite && !sharedCacheDir.IsNull() && !(opt && strchr(opt,'f')) &&
+       !(useCxxModules && produceRootmap)) {
+      R__WriteDependencyFile(build_loc, depfilename, filename_fullpath, library, libname, extension, version_var_prefix, includes, defines, incPath);
+      depfileWritten = kTRUE;
+
+      TString settings = TString(ROOT_RELEASE) + "\n" + GetBuildCompilerVersion() + "\n" + libname_ext + "\n" +
+                         extension + "\n" + GetMakeSharedLib() + "\n" + GetIncludePath() + "\n" +
+                         (gEnv ? gEnv->GetValue("ACLiC.IncludePaths","") : "") + "\n" + GetLinkedLibs() + "\n" + (mode==kDebug ? GetFlagsDebug() : GetFlagsOpt()) + "\n" +
+                         (gEnv ? gEnv->GetValue("ACLiC.ExtraRootclingFlags","") : "");
+      TString key = R__GetACLiCCacheKey(depfilename, libname + version_var_prefix, settings);
+      if (!key.IsNull()) {
+         AssignAndDelete( sharedCacheEntry, ConcatFileName(sharedCacheDir, key) );
+         if (R__FetchFromACLiCCache(sharedCacheEntry, build_loc, libname_ext)) {
+            if (withInfo) {
+               ::Info("ACLiC","using the shared library %s from the cache %s",
+                      libname_ext.Data(), sharedCacheDir.Data());
+            }
+            recompile = kFALSE;
+         }
+      }
+   }
+
    if (!recompile) {
       // The library already exist, let's just load it.
       if (loadLib) {
@@ -3406,7 +3562,8 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
       Info("ACLiC","creating shared library %s",library.Data());
    }
 
-   R__WriteDependencyFile(build_loc, depfilename, filename_fullpath, library, libname, extension, version_var_prefix, includes, defines, incPath);
+   if (!depfileWritten)
+      R__WriteDependencyFile(build_loc, depfilename, filename_fullpath, library, libname, extension, version_var_prefix, includes, defines, incPath);
 
    // ======= Select the dictionary name
    TString dict = libname + "_ACLiC_dict";
@@ -3801,6 +3958,13 @@ int TSystem::CompileMacro(const char *filename, Option_t *opt,
          result = ExecAndReport(relink_cmd);
       }
 
+      if (result && !sharedCacheEntry.IsNull()) {
+         TString rdictpcm = dict;
+         rdictpcm.Remove(rdictpcm.Length() - 4); // ".cxx"
+         rdictpcm += "_rdict.pcm";
+         R__StoreInACLiCCache(sharedCacheEntry, {library, rdictpcm, libmapfilename});
+      }
+
       TNamed *k = new TNamed(library,library);
       Long_t lib_time;
       gSystem->GetPathInfo( library, nullptr, (Long_t*)nullptr, nullptr, &lib_time );
@@ -19,13 +19,27 @@ TVirtualPS is an abstract interface to Postscript, PDF, SVG. TeX etc... drivers
 #include <fstream>
 #include "strlcpy.h"
 #include "TVirtualPS.h"
-
-TVirtualPS *gVirtualPS = nullptr;
+#include "TThreadSlots.h"
 
 const Int_t  kMaxBuffer = 250;
 
 ClassImp(TVirtualPS);
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the current PostScript (or other graphics file) driver.
+///
+/// Like gPad, gVirtualPS is thread local once ROOT::EnableThreadSafety()
+/// was called, so that several threads can print their own canvases.
+
+TVirtualPS *&TVirtualPS::PS()
+{
+   static TVirtualPS *currentPS = nullptr;
+   if (!gThreadTsd)
+      return currentPS;
+   else
+      return *(TVirtualPS**)(*gThreadTsd)(&currentPS,ROOT::kPSThreadSlot);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// VirtualPS default constructor.
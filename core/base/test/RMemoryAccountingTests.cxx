@@ -0,0 +1,25 @@
+#include "gtest/gtest.h"
+
+#include "ROOT/RMemoryAccounting.hxx"
+
+using namespace ROOT::Experimental;
+
+TEST(RMemoryAccounting, User)
+{
+   const auto before = MemoryAccounting::GetUsage(EMemoryTag::kUser);
+   {
+      MemoryAccounting::RAccountedSize size(EMemoryTag::kUser);
+      size.Set(1000);
+      size.Set(3000);
+      size.Set(2000);
+      auto usage = MemoryAccounting::GetUsage(EMemoryTag::kUser);
+      EXPECT_EQ(before.fCurrent + 2000, usage.fCurrent);
+      EXPECT_GE(usage.fPeak, before.fCurrent + 3000);
+      EXPECT_EQ(before.fNAllocations + 2, usage.fNAllocations);
+   }
+   EXPECT_EQ(before.fCurrent, MemoryAccounting::GetUsage(EMemoryTag::kUser).fCurrent);
+
+   MemoryAccounting::ResetPeaks();
+   EXPECT_EQ(before.fCurrent, MemoryAccounting::GetUsage(EMemoryTag::kUser).fPeak);
+   EXPECT_STREQ("User", MemoryAccounting::GetTagName(EMemoryTag::kUser));
+}
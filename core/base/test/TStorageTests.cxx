@@ -0,0 +1,39 @@
+#include "gtest/gtest.h"
+
+#include "TNamed.h"
+#include "TStorage.h"
+
+#include <thread>
+#include <vector>
+
+TEST(TStorage, ObjectPool)
+{
+   // Allocated before the pool is enabled, deleted while it is
+   auto before = new TNamed("before", "");
+
+   TStorage::EnableObjectPool();
+   EXPECT_TRUE(TStorage::IsObjectPoolEnabled());
+
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([] {
+         std::vector<TNamed *> objects;
+         for (int i = 0; i < 1000; ++i)
+            objects.push_back(new TNamed("n", "t"));
+         for (auto obj : objects) {
+            EXPECT_TRUE(obj->IsOnHeap());
+            EXPECT_STREQ("n", obj->GetName());
+            delete obj;
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   // Allocated by the pool, deleted by another thread after the pool is disabled
+   auto pooled = new TNamed("pooled", "");
+   delete before;
+   TStorage::EnableObjectPool(kFALSE);
+   EXPECT_FALSE(TStorage::IsObjectPoolEnabled());
+   std::thread([pooled] { delete pooled; }).join();
+}
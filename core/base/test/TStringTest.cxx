@@ -15,3 +15,21 @@ TEST(TString, Basics)
    ROOT_EXPECT_ERROR(a.Append("s", -5), "TString::Replace", "Negative number of replacement characters!");
    EXPECT_STREQ("test", a);
 }
+
+TEST(TString, Hash)
+{
+   // All the case-sensitive hash functions must agree: hashed collections mix them.
+   const char *text = "ab\xe9 a_name/with;several words";
+   for (Ssiz_t len = 0; len <= (Ssiz_t)strlen(text); ++len) {
+      TString s(text, len);
+      EXPECT_EQ(s.Hash(), ::Hash(s.Data()));
+      EXPECT_EQ(s.Hash(), ::Hash(text, len));
+      // Unaligned start
+      EXPECT_EQ(TString(text + 1, len > 0 ? len - 1 : 0).Hash(), ::Hash(text + 1, len > 0 ? len - 1 : 0));
+   }
+   // Reference values, which must not change across versions.
+   EXPECT_EQ(0u, ::Hash(""));
+   EXPECT_EQ(0u, ::Hash(static_cast<const char *>(nullptr)));
+   EXPECT_EQ(65u, ::Hash("a"));
+   EXPECT_EQ(1278023653u, ::Hash("abcdefghijkl"));
+}
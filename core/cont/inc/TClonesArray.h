@@ -32,6 +32,8 @@ protected:
    TClass       *fClass;       //!Pointer to the class of the elements
    TObjArray    *fKeep;        //!Saved copies of pointers to objects
 
+   void          CreateKept(Int_t first, Int_t last);
+
 public:
    enum EStatusBits {
       kBypassStreamer = BIT(12),  // Class Streamer not called (default)
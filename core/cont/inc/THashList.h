@@ -27,6 +27,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "TList.h"
+#include "TString.h"
 
 class THashTable;
 
@@ -50,9 +51,12 @@ public:
 
    TObject   *FindObject(const char *name) const override;
    TObject   *FindObject(const TObject *obj) const override;
+   TObject   *FindObject(std::string_view name) const;
+   TObject   *FindObject(const TString &name) const { return FindObject(name.Data()); }
 
    const TList *GetListForObject(const char *name) const;
    const TList *GetListForObject(const TObject *obj) const;
+   const TList *GetListForObject(std::string_view name) const;
 
    void       AddFirst(TObject *obj) override;
    void       AddFirst(TObject *obj, Option_t *opt) override;
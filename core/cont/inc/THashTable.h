@@ -46,6 +46,7 @@ private:
    Int_t       GetHashValue(const TObject *obj) const;
    Int_t       GetHashValue(TString &s) const { return s.Hash() % fSize; }
    Int_t       GetHashValue(const char *str) const { return ::Hash(str) % fSize; }
+   Int_t       GetHashValue(std::string_view str) const { return ::Hash(str.data(), str.size()) % fSize; }
 
    void        AddImpl(Int_t slot, TObject *object);
 
@@ -66,8 +67,11 @@ public:
    Bool_t        Empty() const { return fEntries == 0; }
    TObject      *FindObject(const char *name) const override;
    TObject      *FindObject(const TObject *obj) const override;
+   TObject      *FindObject(std::string_view name) const;
+   TObject      *FindObject(const TString &name) const { return FindObject(name.Data()); }
    const TList  *GetListForObject(const char *name) const;
    const TList  *GetListForObject(const TObject *obj) const;
+   const TList  *GetListForObject(std::string_view name) const;
    TObject     **GetObjectRef(const TObject *obj) const override;
    Int_t         GetRehashLevel() const { return fRehashLevel; }
    Int_t         GetSize() const override { return fEntries; }
@@ -166,7 +166,7 @@ static inline void R__ReleaseMemory(TClass *cl, TObject *obj)
       if (TObject::GetObjectStat() && gObjectTable) {
          gObjectTable->RemoveQuietly(obj);
       }
-      ::operator delete(obj);
+      TStorage::ObjectDealloc(obj);
    }
 }
 
@@ -491,6 +491,31 @@ void TClonesArray::Expand(Int_t newSize)
    fKeep->Expand(newSize);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Make the slots [first, last) of fCont point to constructed objects: the
+/// missing objects are allocated and the destructed ones are constructed again
+/// in place. Consecutive slots to construct are handed to TClass::NewObjects()
+/// in one go, the objects which are alive are kept as they are.
+
+void TClonesArray::CreateKept(Int_t first, Int_t last)
+{
+   TObject **keep = fKeep->fCont;
+   Int_t i = first;
+   while (i < last) {
+      if (keep[i] && !keep[i]->IsDestructed()) {
+         fCont[i] = keep[i];
+         ++i;
+         continue;
+      }
+      Int_t end = i + 1;
+      while (end < last && (!keep[end] || keep[end]->IsDestructed()))
+         ++end;
+      fClass->NewObjects(reinterpret_cast<void **>(keep + i), end - i);
+      for (; i < end; ++i)
+         fCont[i] = keep[i];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Expand or shrink the array to n elements and create the clone
 /// objects by calling their default ctor. If n is less than the current size
@@ -512,17 +537,9 @@ void TClonesArray::ExpandCreate(Int_t n)
    if (n > fSize)
       Expand(TMath::Max(n, GrowBy(fSize)));
 
-   Int_t i;
-   for (i = 0; i < n; i++) {
-      if (!fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
-      } else if (fKeep->fCont[i]->IsDestructed()) {
-         // The object has been deleted (or never initialized)
-         fClass->New(fKeep->fCont[i]);
-      }
-      fCont[i] = fKeep->fCont[i];
-   }
+   CreateKept(0, n);
 
+   Int_t i;
    for (i = n; i < fSize; i++)
       if (fKeep->fCont[i]) {
          R__ReleaseMemory(fClass,fKeep->fCont[i]);
@@ -549,16 +566,9 @@ void TClonesArray::ExpandCreateFast(Int_t n)
    if (n > fSize)
       Expand(TMath::Max(n, GrowBy(fSize)));
 
-   Int_t i;
-   for (i = 0; i < n; i++) {
-      if (i >= oldSize || !fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
-      } else if (fKeep->fCont[i]->IsDestructed()) {
-         // The object has been deleted (or never initialized)
-         fClass->New(fKeep->fCont[i]);
-      }
-      fCont[i] = fKeep->fCont[i];
-   }
+   for (Int_t i = oldSize; i < n; i++)
+      fKeep->fCont[i] = nullptr;
+   CreateKept(0, n);
    if (fLast >= n) {
       memset(fCont + n, 0, (fLast - n + 1) * sizeof(TObject*));
    }
@@ -798,16 +808,7 @@ void TClonesArray::Streamer(TBuffer &b)
 
       //TStreamerInfo *sinfo = fClass->GetStreamerInfo(clv);
       if (CanBypassStreamer() && !b.TestBit(TBuffer::kCannotHandleMemberWiseStreaming)) {
-         for (Int_t i = 0; i < nobjects; i++) {
-            if (!fKeep->fCont[i]) {
-               fKeep->fCont[i] = (TObject*)fClass->New();
-            } else if (fKeep->fCont[i]->IsDestructed()) {
-               // The object has been deleted (or never initialized)
-               fClass->New(fKeep->fCont[i]);
-            }
-
-            fCont[i] = fKeep->fCont[i];
-         }
+         CreateKept(0, nobjects);
          if (clv < 8 && classv == "TF1") {
             // To allow backward compatibility of TClonesArray of v5 TF1 objects
             // that were stored member-wise.
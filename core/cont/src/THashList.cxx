@@ -266,6 +266,20 @@ TObject *THashList::FindObject(const char *name) const
    return fTable->FindObject(name);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find object using its name, given as a string view which need not be null
+/// terminated; see THashTable::FindObject(std::string_view). Unlike
+/// FindObject(const char*), this is not virtual: lists deriving from THashList
+/// which look up missing names elsewhere (e.g. TListOfFunctions) are not
+/// consulted.
+
+TObject *THashList::FindObject(std::string_view name) const
+{
+   R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
+
+   return fTable->FindObject(name);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Find object using its hash value (returned by its Hash() member).
 
@@ -287,6 +301,17 @@ const TList *THashList::GetListForObject(const char *name) const
    return fTable->GetListForObject(name);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the THashTable's list (bucket) in which an object with the name
+/// given as a string view can be found; see THashTable::GetListForObject().
+
+const TList *THashList::GetListForObject(std::string_view name) const
+{
+   R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
+
+   return fTable->GetListForObject(name);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the THashTable's list (bucket) in which obj can be found based on
 /// its hash; see THashTable::GetListForObject().
@@ -245,6 +245,32 @@ TObject *THashTable::FindObject(const char *name) const
    return nullptr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find object using its name, given as a string view (which need not be null
+/// terminated). Same as FindObject(const char*), without a temporary string:
+/// works only for objects whose Hash() is the hash of their name.
+
+TObject *THashTable::FindObject(std::string_view name) const
+{
+   if (!name.data())
+      return nullptr;
+
+   Int_t slot = GetHashValue(name);
+
+   R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
+
+   if (!fCont[slot])
+      return nullptr;
+   for (TObjLink *lnk = fCont[slot]->FirstLink(); lnk; lnk = lnk->Next()) {
+      if (TObject *obj = lnk->GetObject()) {
+         const char *objname = obj->GetName();
+         if (objname && name == objname)
+            return obj;
+      }
+   }
+   return nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Find object using its hash value (returned by its Hash() member).
 
@@ -274,6 +300,19 @@ const TList *THashTable::GetListForObject(const char *name) const
    return fCont[slot];
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the TList corresponding to the hash value of the name given as a
+/// string view; see GetListForObject(const char*).
+
+const TList *THashTable::GetListForObject(std::string_view name) const
+{
+   Int_t slot = GetHashValue(name);
+
+   R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
+
+   return fCont[slot];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the TList corresponding to object's hash value.
 /// One can iterate this list "manually" to find, e.g. identical
@@ -0,0 +1,32 @@
+#include "TClonesArray.h"
+#include "TNamed.h"
+
+#include "gtest/gtest.h"
+
+TEST(TClonesArray, ExpandCreate)
+{
+   TClonesArray arr("TNamed");
+   arr.ExpandCreate(10);
+   ASSERT_EQ(10, arr.GetEntriesFast());
+   static_cast<TNamed *>(arr[3])->SetName("three");
+   TObject *third = arr.UncheckedAt(3);
+
+   // Destruct the objects but keep their memory, then create them again in place
+   arr.Delete();
+   EXPECT_EQ(0, arr.GetEntriesFast());
+   arr.ExpandCreateFast(20);
+   ASSERT_EQ(20, arr.GetEntriesFast());
+   EXPECT_EQ(third, arr.UncheckedAt(3));
+   for (Int_t i = 0; i < 20; ++i) {
+      auto obj = static_cast<TNamed *>(arr.UncheckedAt(i));
+      ASSERT_NE(nullptr, obj);
+      EXPECT_FALSE(obj->IsDestructed());
+      EXPECT_STREQ("", obj->GetName());
+   }
+
+   // Alive objects are kept as they are
+   static_cast<TNamed *>(arr[5])->SetName("five");
+   arr.ExpandCreateFast(8);
+   EXPECT_EQ(8, arr.GetEntriesFast());
+   EXPECT_STREQ("five", arr.UncheckedAt(5)->GetName());
+}
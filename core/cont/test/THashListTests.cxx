@@ -0,0 +1,46 @@
+#include "gtest/gtest.h"
+
+#include "THashList.h"
+#include "THashTable.h"
+#include "TNamed.h"
+#include "TString.h"
+
+#include <string>
+
+TEST(THashList, FindObjectStringView)
+{
+   THashList list;
+   list.SetOwner();
+   for (int i = 0; i < 100; ++i)
+      list.Add(new TNamed(TString::Format("hist_%d", i), "title"));
+
+   const std::string names = "hist_42;hist_7;nope";
+   auto obj = list.FindObject(std::string_view(names).substr(0, 7));
+   ASSERT_NE(nullptr, obj);
+   EXPECT_STREQ("hist_42", obj->GetName());
+   EXPECT_EQ(list.FindObject("hist_7"), list.FindObject(std::string_view(names).substr(8, 6)));
+   EXPECT_EQ(nullptr, list.FindObject(std::string_view(names).substr(15)));
+   // A prefix of a name is not a match.
+   EXPECT_EQ(nullptr, list.FindObject(std::string_view("hist_4")));
+
+   // TString and std::string arguments are accepted without copies.
+   TString tname("hist_99");
+   EXPECT_EQ(list.FindObject("hist_99"), list.FindObject(tname));
+   EXPECT_EQ(list.FindObject("hist_99"), list.FindObject(std::string("hist_99")));
+
+   const TList *bucket = list.GetListForObject(std::string_view(names).substr(0, 7));
+   ASSERT_NE(nullptr, bucket);
+   EXPECT_EQ(bucket, list.GetListForObject("hist_42"));
+   EXPECT_NE(nullptr, bucket->FindObject("hist_42"));
+}
+
+TEST(THashTable, FindObjectStringView)
+{
+   THashTable table;
+   table.SetOwner();
+   table.Add(new TNamed("a", ""));
+   table.Add(new TNamed("", ""));
+   EXPECT_STREQ("a", table.FindObject(std::string_view("abc", 1))->GetName());
+   EXPECT_NE(nullptr, table.FindObject(std::string_view("")));
+   EXPECT_EQ(nullptr, table.FindObject(std::string_view()));
+}
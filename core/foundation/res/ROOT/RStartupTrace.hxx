@@ -0,0 +1,72 @@
+/// \file RStartupTrace.hxx
+///
+/// \brief Opt-in timeline of the phases of ROOT's start-up (TROOT construction,
+/// interpreter initialization, library and dictionary loading, TClass creation).
+///
+/// Setting the environment variable ROOT_STARTUP_TRACE enables the recording;
+/// its value is the name of the output file (root_startup_trace.json if empty or
+/// "1"). The file is written at exit in the Chrome trace event format and can be
+/// opened with chrome://tracing or https://ui.perfetto.dev.
+///
+/// \date October, 2026
+///
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_CORE_FOUNDATION_RSTARTUPTRACE_HXX
+#define ROOT_CORE_FOUNDATION_RSTARTUPTRACE_HXX
+
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+namespace StartupTrace {
+
+   ///\returns true if ROOT_STARTUP_TRACE is set; the environment is read once.
+   bool IsEnabled();
+
+   ///\returns the microseconds elapsed since the trace was started.
+   long long Now();
+
+   /// Record a completed phase \c name of \c category that started at \c start
+   /// and lasted until now (both as returned by Now()).
+   void AddEvent(const char *category, const std::string &name, long long start);
+
+   /// Record the duration of the enclosing scope, if tracing is enabled.
+   class RScope {
+      const char *fCategory = nullptr;
+      std::string fName;
+      long long fStart = -1;
+
+   public:
+      RScope(const char *category, const char *name, const char *detail = nullptr)
+      {
+         if (!IsEnabled())
+            return;
+         fCategory = category;
+         fName = name;
+         if (detail && detail[0]) {
+            fName += ' ';
+            fName += detail;
+         }
+         fStart = Now();
+      }
+      RScope(const RScope &) = delete;
+      RScope &operator=(const RScope &) = delete;
+      ~RScope()
+      {
+         if (fStart >= 0)
+            AddEvent(fCategory, fName, fStart);
+      }
+   };
+
+} // namespace StartupTrace
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_CORE_FOUNDATION_RSTARTUPTRACE_HXX
@@ -0,0 +1,150 @@
+/// \file RStartupTrace.cxx
+///
+/// \brief Opt-in timeline of the phases of ROOT's start-up, written in the
+/// Chrome trace event format.
+///
+/// \date October, 2026
+///
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RStartupTrace.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define R__GETPID _getpid
+#else
+#include <unistd.h>
+#define R__GETPID getpid
+#endif
+
+namespace {
+
+struct TraceEvent {
+   const char *fCategory;
+   std::string fName;
+   long long fStart;
+   long long fDuration;
+   int fThread;
+};
+
+struct TraceState {
+   std::string fFileName;
+   std::chrono::steady_clock::time_point fOrigin = std::chrono::steady_clock::now();
+   std::mutex fMutex;
+   std::vector<TraceEvent> fEvents;
+   bool fWritten = false;
+};
+
+/// Leaked on purpose: phases may still be recorded during static destruction.
+TraceState *GetTraceState()
+{
+   static TraceState *state = []() -> TraceState * {
+      const char *env = std::getenv("ROOT_STARTUP_TRACE");
+      if (!env)
+         return nullptr;
+      auto *s = new TraceState;
+      s->fFileName = (!env[0] || !std::strcmp(env, "1")) ? "root_startup_trace.json" : env;
+      return s;
+   }();
+   return state;
+}
+
+int GetThreadNumber()
+{
+   static std::atomic<int> gNextThread{0};
+   thread_local int thread = gNextThread++;
+   return thread;
+}
+
+void WriteEscaped(FILE *f, const std::string &str)
+{
+   for (char c : str) {
+      if (c == '"' || c == '\\')
+         std::fputc('\\', f);
+      if (static_cast<unsigned char>(c) >= 0x20)
+         std::fputc(c, f);
+   }
+}
+
+void WriteTrace()
+{
+   TraceState *state = GetTraceState();
+   std::lock_guard<std::mutex> lock(state->fMutex);
+   if (state->fWritten)
+      return;
+   state->fWritten = true;
+
+   FILE *f = std::fopen(state->fFileName.c_str(), "w");
+   if (!f) {
+      std::fprintf(stderr, "Error in <ROOT_STARTUP_TRACE>: cannot write %s\n", state->fFileName.c_str());
+      return;
+   }
+   const int pid = R__GETPID();
+   std::fprintf(f, "{\"traceEvents\":[\n");
+   for (std::size_t i = 0; i < state->fEvents.size(); ++i) {
+      const auto &ev = state->fEvents[i];
+      std::fprintf(f, "{\"name\":\"");
+      WriteEscaped(f, ev.fName);
+      std::fprintf(f, "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":%d,\"tid\":%d}%s\n",
+                   ev.fCategory, ev.fStart, ev.fDuration, pid, ev.fThread,
+                   i + 1 < state->fEvents.size() ? "," : "");
+   }
+   std::fprintf(f, "],\"displayTimeUnit\":\"ms\"}\n");
+   std::fclose(f);
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace StartupTrace {
+
+bool IsEnabled()
+{
+   static const bool enabled = [] {
+      if (!GetTraceState())
+         return false;
+      std::atexit(WriteTrace);
+      return true;
+   }();
+   return enabled;
+}
+
+long long Now()
+{
+   TraceState *state = GetTraceState();
+   if (!state)
+      return 0;
+   return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - state->fOrigin)
+      .count();
+}
+
+void AddEvent(const char *category, const std::string &name, long long start)
+{
+   if (!IsEnabled())
+      return;
+   const long long end = Now();
+   TraceState *state = GetTraceState();
+   std::lock_guard<std::mutex> lock(state->fMutex);
+   if (state->fWritten)
+      return;
+   state->fEvents.push_back({category, name, start, end - start, GetThreadNumber()});
+}
+
+} // namespace StartupTrace
+} // namespace Internal
+} // namespace ROOT
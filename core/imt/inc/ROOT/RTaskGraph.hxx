@@ -0,0 +1,67 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTaskGraph
+#define ROOT_RTaskGraph
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+class RTaskGraphImpl;
+}
+
+namespace Experimental {
+
+class RTaskGraph {
+   /**
+   \class ROOT::Experimental::RTaskGraph
+   \ingroup Parallelism
+   \brief A dependency graph of work items executed in ROOT's task arena.
+
+   Each task starts as soon as all the tasks it depends on have completed. Tasks can be added at any time, also
+   from within running tasks, which allows to express continuations. Among the tasks that are ready to run, the
+   ones with a higher priority are started first.
+
+   ~~~{.cpp}
+   ROOT::Experimental::RTaskGraph graph;
+   auto read = graph.Add([&] { Read(); });
+   auto unzip = graph.Add([&] { Unzip(); }, {read});
+   graph.Add([&] { Process(); }, {unzip}, 1);
+   graph.Wait();
+   ~~~
+
+   If implicit multi-threading is not enabled, each task runs when it is added; its dependencies, being added
+   before it, have then already completed.
+   */
+public:
+   using TaskId_t = std::size_t;
+
+   RTaskGraph();
+   RTaskGraph(const RTaskGraph &) = delete;
+   RTaskGraph &operator=(const RTaskGraph &) = delete;
+   ~RTaskGraph();
+
+   TaskId_t Add(const std::function<void(void)> &task, const std::vector<TaskId_t> &dependencies = {},
+                int priority = 0);
+   TaskId_t Then(TaskId_t predecessor, const std::function<void(void)> &task, int priority = 0);
+   void Wait();
+
+private:
+   std::unique_ptr<ROOT::Internal::RTaskGraphImpl> fImpl;
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
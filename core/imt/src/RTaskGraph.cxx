@@ -0,0 +1,243 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RConfigure.h"
+
+#include "ROOT/RTaskGraph.hxx"
+
+#ifdef R__USE_IMT
+#include "ROOT/RTaskArena.hxx"
+#include "ROpaqueTaskArena.hxx"
+#include "TROOT.h"
+#include "tbb/task_group.h"
+#endif
+
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <string>
+
+/**
+\class ROOT::Experimental::RTaskGraph
+\ingroup Parallelism
+\brief A dependency graph of work items executed in ROOT's task arena.
+
+The tasks run in the global RTaskArenaWrapper, i.e. they share the worker
+threads with the rest of ROOT's implicit multi-threading. A task which becomes
+ready (all its dependencies completed) is put in a queue ordered by priority,
+and each completion schedules the execution of the highest-priority ready task.
+If a task throws, the tasks which did not start yet are skipped and the first
+exception is rethrown by Wait().
+*/
+
+namespace ROOT {
+namespace Internal {
+
+class RTaskGraphImpl {
+public:
+   using TaskId_t = ROOT::Experimental::RTaskGraph::TaskId_t;
+
+private:
+   struct Node {
+      std::function<void(void)> fTask;
+      int fPriority = 0;
+      unsigned fPending = 0;                ///< Number of dependencies not completed yet
+      bool fDone = false;
+      std::vector<TaskId_t> fSuccessors;
+   };
+
+   struct ReadyEntry {
+      int fPriority;
+      TaskId_t fId;
+      /// Highest priority first, then in order of addition.
+      bool operator<(const ReadyEntry &other) const
+      {
+         return fPriority < other.fPriority || (fPriority == other.fPriority && fId > other.fId);
+      }
+   };
+
+   std::mutex fMutex;                       ///< Protects all the members below
+   std::deque<Node> fNodes;                 ///< All the tasks ever added, indexed by TaskId_t
+   std::priority_queue<ReadyEntry> fReady;  ///< Tasks whose dependencies completed, not started yet
+   std::exception_ptr fException;           ///< First exception thrown by a task
+   bool fParallel = false;
+#ifdef R__USE_IMT
+   std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> fTaskArenaW;
+   tbb::task_group fTaskGroup;
+#endif
+
+   /// Mark the task as completed and queue its successors which became ready.
+   /// Must be called with fMutex locked. Returns the number of queued tasks.
+   unsigned Complete(TaskId_t id)
+   {
+      auto &node = fNodes[id];
+      node.fDone = true;
+      node.fTask = nullptr;
+      unsigned nReady = 0;
+      for (auto succ : node.fSuccessors) {
+         auto &succNode = fNodes[succ];
+         if (--succNode.fPending == 0) {
+            fReady.push({succNode.fPriority, succ});
+            ++nReady;
+         }
+      }
+      node.fSuccessors.clear();
+      return nReady;
+   }
+
+   /// Run the highest-priority ready task, then schedule the tasks it made ready.
+   void RunOne()
+   {
+      TaskId_t id;
+      std::function<void(void)> task;
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         id = fReady.top().fId;
+         fReady.pop();
+         if (!fException)
+            task = std::move(fNodes[id].fTask);
+      }
+
+      if (task) {
+         try {
+            task();
+         } catch (...) {
+            std::lock_guard<std::mutex> lock(fMutex);
+            if (!fException)
+               fException = std::current_exception();
+         }
+      }
+
+      unsigned nReady;
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         nReady = Complete(id);
+      }
+      Schedule(nReady);
+   }
+
+   /// Schedule n executions of RunOne, each picking the best ready task at that time.
+   void Schedule(unsigned n)
+   {
+      if (!fParallel) {
+         // Sequential mode: run them right away, in priority order.
+         for (unsigned i = 0; i < n; ++i)
+            RunOne();
+         return;
+      }
+#ifdef R__USE_IMT
+      for (unsigned i = 0; i < n; ++i)
+         fTaskArenaW->Access().execute([&] { fTaskGroup.run([this] { RunOne(); }); });
+#endif
+   }
+
+public:
+   RTaskGraphImpl()
+   {
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled()) {
+         fParallel = true;
+         fTaskArenaW = ROOT::Internal::GetGlobalTaskArena();
+      }
+#endif
+   }
+
+   TaskId_t Add(const std::function<void(void)> &task, const std::vector<TaskId_t> &dependencies, int priority)
+   {
+      TaskId_t id;
+      bool isReady;
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         id = fNodes.size();
+         for (auto dep : dependencies) {
+            if (dep >= id)
+               throw std::invalid_argument("RTaskGraph::Add: unknown dependency " + std::to_string(dep));
+         }
+         fNodes.emplace_back();
+         auto &node = fNodes.back();
+         node.fTask = task;
+         node.fPriority = priority;
+         for (auto dep : dependencies) {
+            auto &depNode = fNodes[dep];
+            if (!depNode.fDone) {
+               depNode.fSuccessors.push_back(id);
+               ++node.fPending;
+            }
+         }
+         isReady = node.fPending == 0;
+         if (isReady)
+            fReady.push({priority, id});
+      }
+      if (isReady)
+         Schedule(1);
+      return id;
+   }
+
+   void Wait(bool rethrow)
+   {
+#ifdef R__USE_IMT
+      if (fParallel)
+         fTaskArenaW->Access().execute([&] { fTaskGroup.wait(); });
+#endif
+      std::exception_ptr exception;
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         std::swap(exception, fException);
+      }
+      if (exception && rethrow)
+         std::rethrow_exception(exception);
+   }
+};
+
+} // namespace Internal
+
+namespace Experimental {
+
+RTaskGraph::RTaskGraph() : fImpl(new ROOT::Internal::RTaskGraphImpl()) {}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Wait for all the tasks to complete. Exceptions thrown by the tasks are
+/// not propagated: call Wait() beforehand to get them.
+RTaskGraph::~RTaskGraph()
+{
+   fImpl->Wait(/*rethrow=*/false);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Add a task which runs once all the given dependencies have completed.
+/// \param task the work item
+/// \param dependencies identifiers, as returned by Add(), of the tasks that must complete first
+/// \param priority among the ready tasks, the ones with the highest priority start first
+/// \return the identifier of the new task
+RTaskGraph::TaskId_t
+RTaskGraph::Add(const std::function<void(void)> &task, const std::vector<TaskId_t> &dependencies, int priority)
+{
+   return fImpl->Add(task, dependencies, priority);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Add a continuation: a task which runs once predecessor has completed.
+RTaskGraph::TaskId_t RTaskGraph::Then(TaskId_t predecessor, const std::function<void(void)> &task, int priority)
+{
+   return fImpl->Add(task, {predecessor}, priority);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Wait until all the tasks added so far, and their continuations, completed.
+/// This method is blocking. It rethrows the first exception thrown by a task.
+void RTaskGraph::Wait()
+{
+   fImpl->Wait(/*rethrow=*/true);
+}
+
+} // namespace Experimental
+} // namespace ROOT
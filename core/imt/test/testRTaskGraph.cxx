@@ -0,0 +1,59 @@
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/RTaskGraph.hxx"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace ROOT::Experimental;
+
+TEST(RTaskGraph, Dependencies)
+{
+   ROOT::EnableImplicitMT(4);
+   std::atomic<int> counter{0};
+   std::vector<int> order(4, -1);
+   RTaskGraph graph;
+   auto a = graph.Add([&] { order[0] = counter++; });
+   auto b = graph.Add([&] { order[1] = counter++; }, {a});
+   auto c = graph.Add([&] { order[2] = counter++; }, {a});
+   graph.Add([&] { order[3] = counter++; }, {b, c});
+   graph.Wait();
+   EXPECT_EQ(counter, 4);
+   EXPECT_EQ(order[0], 0);
+   EXPECT_LT(order[0], order[1]);
+   EXPECT_LT(order[0], order[2]);
+   EXPECT_EQ(order[3], 3);
+}
+
+TEST(RTaskGraph, Continuations)
+{
+   ROOT::EnableImplicitMT(4);
+   std::atomic<int> sum{0};
+   RTaskGraph graph;
+   for (int i = 0; i < 10; ++i) {
+      graph.Add([&graph, &sum, i] {
+         sum += i;
+         graph.Then(0, [&sum] { sum += 100; });
+      });
+   }
+   graph.Wait();
+   EXPECT_EQ(sum, 45 + 10 * 100);
+}
+
+TEST(RTaskGraph, Exception)
+{
+   ROOT::EnableImplicitMT(4);
+   RTaskGraph graph;
+   bool ran = false;
+   auto a = graph.Add([] { throw std::runtime_error("task failed"); });
+   graph.Then(a, [&] { ran = true; });
+   EXPECT_THROW(graph.Wait(), std::runtime_error);
+   EXPECT_FALSE(ran);
+   EXPECT_THROW(graph.Add([] {}, {42}), std::invalid_argument);
+}
+
+#endif
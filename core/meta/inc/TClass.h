@@ -526,6 +526,7 @@ public:
    void              *New(void *arena, ENewType defConstructor = kClassNew) const;
    void              *NewArray(Long_t nElements, ENewType defConstructor = kClassNew) const;
    void              *NewArray(Long_t nElements, void *arena, ENewType defConstructor = kClassNew) const;
+   void               NewObjects(void **addresses, Long_t nElements, ENewType defConstructor = kClassNew) const;
    ObjectPtr          NewObject(ENewType defConstructor = kClassNew, Bool_t quiet = kFALSE) const;
    ObjectPtr          NewObject(void *arena, ENewType defConstructor = kClassNew) const;
    ObjectPtr          NewObjectArray(Long_t nElements, ENewType defConstructor = kClassNew) const;
@@ -99,8 +99,11 @@ In order to access the name of a class within the ROOT type system, the method T
 #include <cassert>
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <unordered_map>
 
 #include "TSpinLockGuard.h"
+#include "ROOT/RStartupTrace.hxx"
 
 #ifdef WIN32
 #include <io.h>
@@ -488,6 +491,62 @@ DeclIdMap_t *TClass::GetDeclIdMap() {
 #endif
 }
 
+namespace {
+
+/// Incremented each time a TClass is added to, removed from or unloaded in the
+/// list of classes; it invalidates all the per-thread GetClass caches.
+std::atomic<ULong64_t> gClassCacheEpoch{0};
+
+/// Per-thread cache of the fully loaded TClass returned for a given name, so that
+/// repeated lookups of already resolved classes do not touch ROOT::gCoreMutex.
+thread_local bool gClassNameCacheDestroyed = false;
+
+struct TClassNameCache {
+   ULong64_t fEpoch = 0;
+   std::string fKey; // Reused lookup buffer, avoids an allocation per lookup.
+   std::unordered_map<std::string, TClass *> fClasses;
+
+   TClass *Find(const char *name)
+   {
+      auto epoch = gClassCacheEpoch.load(std::memory_order_acquire);
+      if (epoch != fEpoch) {
+         fClasses.clear();
+         fEpoch = epoch;
+         return nullptr;
+      }
+      fKey.assign(name);
+      auto iter = fClasses.find(fKey);
+      return iter == fClasses.end() ? nullptr : iter->second;
+   }
+
+   void Insert(const char *name, TClass *cl, ULong64_t epoch)
+   {
+      // Do not record a result obtained before the latest invalidation.
+      if (epoch != fEpoch)
+         return;
+      fClasses.emplace(name, cl);
+   }
+
+   ~TClassNameCache() { gClassNameCacheDestroyed = true; }
+};
+
+/// Return the cache of the current thread, or nullptr during thread (or process)
+/// teardown when it has already been destroyed.
+TClassNameCache *GetClassNameCache()
+{
+   if (gClassNameCacheDestroyed)
+      return nullptr;
+   TTHREAD_TLS_DECL(TClassNameCache, cache);
+   return &cache;
+}
+
+void InvalidateClassNameCaches()
+{
+   gClassCacheEpoch.fetch_add(1, std::memory_order_acq_rel);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// static: Add a class to the list and map of classes.
 
@@ -496,6 +555,7 @@ void TClass::AddClass(TClass *cl)
    if (!cl) return;
 
    R__LOCKGUARD(gInterpreterMutex);
+   InvalidateClassNameCaches();
    gROOT->GetListOfClasses()->Add(cl);
    if (cl->GetTypeInfo()) {
       GetIdMap()->Add(cl->GetTypeInfo()->name(),cl);
@@ -522,6 +582,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (!oldcl) return;
 
    R__LOCKGUARD(gInterpreterMutex);
+   InvalidateClassNameCaches();
    gROOT->GetListOfClasses()->Remove(oldcl);
    if (oldcl->GetTypeInfo()) {
       GetIdMap()->Remove(oldcl->GetTypeInfo()->name());
@@ -1372,6 +1433,8 @@ void TClass::Init(const char *name, Version_t cversion,
                   ClassInfo_t *givenInfo,
                   Bool_t silent)
 {
+   ROOT::Internal::StartupTrace::RScope traceScope("TClass", "TClass::Init", name);
+
    if (!gROOT)
       ::Fatal("TClass::TClass", "ROOT system not initialized");
    if (!name || !name[0]) {
@@ -1661,6 +1724,9 @@ TClass::~TClass()
 {
    R__LOCKGUARD(gInterpreterMutex);
 
+   // This TClass may still be referenced by the per-thread GetClass caches.
+   InvalidateClassNameCaches();
+
    // Remove from the typedef hashtables.
    if (fgClassTypedefHash && TestBit (kHasNameMapNode)) {
       TString resolvedThis = TClassEdit::ResolveTypedef (GetName(), kTRUE);
@@ -2981,6 +3047,12 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    if (!gROOT->GetListOfClasses())  return nullptr;
 
+   // Lock-free path for names already resolved by this thread to a loaded class.
+   auto nameCache = GetClassNameCache();
+   if (TClass *cached = nameCache ? nameCache->Find(name) : nullptr)
+      return cached;
+   const auto cacheEpoch = nameCache ? nameCache->fEpoch : 0;
+
    // FindObject will take the read lock before actually getting the
    // TClass pointer so we will need not get a partially initialized
    // object.
@@ -2988,7 +3060,11 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    // Early return to release the lock without having to execute the
    // long-ish normalization.
-   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) return cl;
+   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) {
+      if (nameCache && !cl->TestBit(kUnloading))
+         nameCache->Insert(name, cl, cacheEpoch);
+      return cl;
+   }
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -4600,6 +4676,14 @@ TVirtualStreamerInfo* TClass::GetStreamerInfo(Int_t version /* = 0 */, Bool_t is
    if (sinfo && sinfo->GetClassVersion() == version)
       return sinfo;
 
+   // When reading an older version while writing the current one, fLastReadInfo
+   // alternates; the compiled current info can be handed out without locking too.
+   if (version == fClassVersion) {
+      sinfo = fCurrentInfo.load();
+      if (sinfo && sinfo->GetClassVersion() == version && sinfo->IsCompiled())
+         return sinfo;
+   }
+
    // Note that the access to fClassVersion above is technically not thread-safe with a low probably of problems.
    // fClassVersion is not an atomic and is modified TClass::SetClassVersion (called from RootClassVersion via
    // ROOT::ResetClassVersion) and is 'somewhat' protected by the atomic fVersionUsed.
@@ -5173,6 +5257,33 @@ TClass::ObjectPtr TClass::NewObject(void *arena, ENewType defConstructor) const
    return p;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Construct nElements independent objects of this class: for each null entry
+/// of addresses a new object is allocated and its address stored, the other
+/// entries are constructed in place. Unlike NewArray(), each object can be
+/// deleted on its own. With a dictionary generated by rootcling this amounts
+/// to one call of the constructor wrapper per object; this is the path used
+/// by TClonesArray to create its elements in bulk. For meaning of
+/// defConstructor, see TClass::IsCallingNew().
+
+void TClass::NewObjects(void **addresses, Long_t nElements, ENewType defConstructor) const
+{
+   if (fNew) {
+      TClass__GetCallingNewRAII callingNew(defConstructor);
+      for (Long_t i = 0; i < nElements; ++i) {
+         void *p = fNew(addresses[i]);
+         if (!p) {
+            Error("NewObjects", "cannot create object of class %s at address %p", GetName(), addresses[i]);
+            return;
+         }
+         addresses[i] = p;
+      }
+      return;
+   }
+   for (Long_t i = 0; i < nElements; ++i)
+      addresses[i] = addresses[i] ? New(addresses[i], defConstructor) : New(defConstructor);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return a pointer to a newly allocated array of objects
 /// of this class.
@@ -6302,6 +6413,7 @@ void TClass::SetUnloaded()
       return;
    }
    SetBit(kUnloading);
+   InvalidateClassNameCaches();
 
    //R__ASSERT(fState == kLoaded);
    if (fState != kLoaded) {
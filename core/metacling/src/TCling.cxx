@@ -20,6 +20,7 @@ clang/LLVM technology.
 #include "TCling.h"
 
 #include "ROOT/FoundationUtils.hxx"
+#include "ROOT/RStartupTrace.hxx"
 
 #include "TClingBaseClassInfo.h"
 #include "TClingCallFunc.h"
@@ -1375,6 +1376,8 @@ TCling::TCling(const char *name, const char *title, const char* const argv[])
   fPrevLoadedDynLibInfo(0), fClingCallbacks(0), fAutoLoadCallBack(0),
   fTransactionCount(0), fHeaderParsingOnDemand(true), fIsAutoParsingSuspended(kFALSE)
 {
+   ROOT::Internal::StartupTrace::RScope traceScope("TCling", "TCling::TCling");
+
    fPrompt[0] = 0;
    const bool fromRootCling = IsFromRootCling();
 
@@ -1660,6 +1663,8 @@ TCling::~TCling()
 
 void TCling::Initialize()
 {
+   ROOT::Internal::StartupTrace::RScope traceScope("TCling", "TCling::Initialize");
+
    fClingCallbacks->Initialize();
 
    // We are set up. Enable ROOT's AutoLoading.
@@ -1673,10 +1678,46 @@ void TCling::Initialize()
    assert(GetRootMapFiles() == 0 && "Must be called before LoadLibraryMap!");
    TClass::ReadRules(); // Read the default customization rules ...
 
-   LoadLibraryMap();
+   // Compiled applications that only use generated dictionaries never need the
+   // rootmap information; ROOT_LAZY_ROOTMAP defers the scan of the dynamic path
+   // until the first autoload or library dependency lookup.
+   llvm::Optional<std::string> envLazyRootmap = llvm::sys::Process::GetEnv("ROOT_LAZY_ROOTMAP");
+   if (envLazyRootmap.hasValue() && (envLazyRootmap->empty() ||
+                                     (ROOT::FoundationUtils::CanConvertEnvValueToBool(*envLazyRootmap) &&
+                                      ROOT::FoundationUtils::ConvertEnvValueToBool(*envLazyRootmap))))
+      fLibraryMapPending = true;
+   else
+      LoadLibraryMap();
    SetClassAutoLoading(true);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the rootmap scan skipped by Initialize() in ROOT_LAZY_ROOTMAP mode.
+
+void TCling::LoadDeferredLibraryMap()
+{
+   if (fLibraryMapPending.load(std::memory_order_acquire))
+      LoadLibraryMap();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the association of classes to libraries read from the rootmap files.
+
+TEnv *TCling::GetMapfile() const
+{
+   const_cast<TCling *>(this)->LoadDeferredLibraryMap();
+   return fMapfile;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the list of the rootmap files read so far.
+
+TObjArray *TCling::GetRootMapFiles() const
+{
+   const_cast<TCling *>(this)->LoadDeferredLibraryMap();
+   return fRootmapFiles;
+}
+
 void TCling::ShutDown()
 {
    fIsShuttingDown = true;
@@ -1835,6 +1876,8 @@ void TCling::LoadPCMImpl(TFile &pcmFile)
 
 void TCling::LoadPCM(std::string pcmFileNameFullPath)
 {
+   ROOT::Internal::StartupTrace::RScope traceScope("TCling", "TCling::LoadPCM", pcmFileNameFullPath.c_str());
+
    SuspendAutoLoadingRAII autoloadOff(this);
    SuspendAutoParsing autoparseOff(this);
    assert(!pcmFileNameFullPath.empty());
@@ -2039,6 +2082,8 @@ void TCling::RegisterModule(const char* modulename,
                             Bool_t lateRegistration /*=false*/,
                             Bool_t hasCxxModule /*=false*/)
 {
+   ROOT::Internal::StartupTrace::RScope traceScope("TCling", "TCling::RegisterModule", modulename);
+
    const bool fromRootCling = IsFromRootCling();
    // We need the dictionary initialization but we don't want to inject the
    // declarations into the interpreter, except for those we really need for
@@ -5661,6 +5706,11 @@ Int_t TCling::LoadLibraryMap(const char* rootmapfile)
 
    R__LOCKGUARD(gInterpreterMutex);
 
+   ROOT::Internal::StartupTrace::RScope traceScope("TCling", "TCling::LoadLibraryMap", rootmapfile);
+
+   // Any call scans the dynamic path below, which also satisfies a deferred scan.
+   fLibraryMapPending = false;
+
    // open the [system].rootmap files
    if (!fMapfile) {
       fMapfile = new TEnv();
@@ -5931,6 +5981,7 @@ Int_t TCling::UnloadAllSharedLibraryMaps()
 
 Int_t TCling::UnloadLibraryMap(const char* library)
 {
+   LoadDeferredLibraryMap();
    if (!fMapfile || !library || !*library) {
       return 0;
    }
@@ -6040,6 +6091,7 @@ TClass *TCling::GetClass(const std::type_info& typeinfo, Bool_t load) const
 Int_t TCling::AutoLoad(const std::type_info& typeinfo, Bool_t knowDictNotLoaded /* = kFALSE */)
 {
    assert(IsClassAutoLoadingEnabled() && "Calling when AutoLoading is off!");
+   LoadDeferredLibraryMap();
 
    int err = 0;
    char* demangled_name_c = TClassEdit::DemangleTypeIdName(typeinfo, err);
@@ -6196,9 +6248,12 @@ Int_t TCling::AutoLoad(const char *cls, Bool_t knowDictNotLoaded /* = kFALSE */)
    }
 
    assert(IsClassAutoLoadingEnabled() && "Calling when AutoLoading is off!");
+   LoadDeferredLibraryMap();
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
+   ROOT::Internal::StartupTrace::RScope traceScope("TCling", "TCling::AutoLoad", cls);
+
    if (!knowDictNotLoaded && gClassTable->GetDictNorm(cls)) {
       // The library is already loaded as the class's dictionary is known.
       // Return success.
@@ -6450,6 +6505,9 @@ Int_t TCling::AutoParse(const char *cls)
    }
 
    R__LOCKGUARD(gInterpreterMutex);
+   LoadDeferredLibraryMap();
+
+   ROOT::Internal::StartupTrace::RScope traceScope("TCling", "TCling::AutoParse", cls);
 
    if (gDebug > 1) {
       Info("TCling::AutoParse",
@@ -7008,6 +7066,8 @@ static std::string GetClassSharedLibsForModule(const char *cls, cling::LookupHel
 
 const char* TCling::GetClassSharedLibs(const char* cls)
 {
+   LoadDeferredLibraryMap();
+
    if (fCxxModulesEnabled) {
       llvm::StringRef className = cls;
       // If we get a class name containing lambda, we cannot parse it and we
@@ -7198,6 +7258,8 @@ const char* TCling::GetSharedLibDeps(const char* lib, bool useDyld/* = false*/)
    if (llvm::sys::path::is_absolute(lib) && !llvm::sys::fs::exists(lib))
       return nullptr;
 
+   LoadDeferredLibraryMap();
+
    if (!hasParsedRootmapForLibrary(lib)) {
       llvm::SmallString<512> rootmapName(lib);
       llvm::sys::path::replace_extension(rootmapName, "rootmap");
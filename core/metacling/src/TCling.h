@@ -26,6 +26,7 @@
 
 #include "TInterpreter.h"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -124,6 +125,7 @@ private: // Data Members
    std::hash<std::string> fStringHashFunction; // A simple hashing function
    std::unordered_set<const clang::NamespaceDecl*> fNSFromRootmaps;   // Collection of namespaces fwd declared in the rootmaps
    TObjArray*      fRootmapFiles;     // Loaded rootmap files.
+   std::atomic<bool> fLibraryMapPending{false}; // True if the rootmap scan is deferred until first needed (ROOT_LAZY_ROOTMAP).
    Bool_t          fLockProcessLine;  // True if ProcessLine should lock gInterpreterMutex.
    Bool_t          fCxxModulesEnabled;// True if C++ modules was enabled
 
@@ -210,7 +212,7 @@ public: // Public Interface
    void    EndOfLineAction() final;
    TClass *GetClass(const std::type_info& typeinfo, Bool_t load) const final;
    Int_t   GetExitCode() const final { return fExitCode; }
-   TEnv*   GetMapfile() const final { return fMapfile; }
+   TEnv*   GetMapfile() const final;
    Int_t   GetMore() const final;
    TClass *GenerateTClass(const char *classname, Bool_t emulation, Bool_t silent = kFALSE) final;
    TClass *GenerateTClass(ClassInfo_t *classinfo, Bool_t silent = kFALSE) final;
@@ -221,7 +223,7 @@ public: // Public Interface
    const char* GetSharedLibDeps(const char* lib, bool tryDyld = false) final;
    const char* GetIncludePath() final;
    virtual const char* GetSTLIncludePath() const final;
-   TObjArray*  GetRootMapFiles() const final { return fRootmapFiles; }
+   TObjArray*  GetRootMapFiles() const final;
    unsigned long long GetInterpreterStateMarker() const final { return fTransactionCount;}
    virtual void Initialize() final;
    virtual void ShutDown() final;
@@ -586,6 +588,8 @@ private: // Private Utility Functions and Classes
                                         TListOfFunctionTemplates*,
                                         TListOfEnums*> &Lists, const clang::Decl *D);
 
+   void LoadDeferredLibraryMap();
+
    class SuspendAutoLoadingRAII {
       TCling *fTCling = nullptr;
       bool fOldValue;
@@ -17,6 +17,7 @@
 
 #pragma link C++ class TMPClient;
 #pragma link C++ class TMPWorker;
+#pragma link C++ class ROOT::TForkServer;
 #pragma link C++ class ROOT::TProcessExecutor;
 #pragma link C++ class TProcPool;  // Deprecated but still needed for backward compatibility
 
@@ -0,0 +1,49 @@
+/* @(#)root/multiproc:$Id$ */
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TForkServer
+#define ROOT_TForkServer
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+
+//////////////////////////////////////////////////////////////////////////
+///
+/// \class ROOT::TForkServer
+/// \brief Initialize the interpreter once and fork independent jobs from it.
+///
+/// Running many single-process ROOT jobs on one node duplicates the
+/// interpreter state (modules, AST, dictionaries) in each process. A
+/// TForkServer initializes it once in the parent, preloading the classes
+/// the jobs will use, and then forks the jobs: the pages holding that state
+/// are shared copy-on-write between all of them.
+///
+/// ~~~{.cpp}
+/// ROOT::TForkServer server({"TTree", "MyEvent"});
+/// int nFailed = server.Run(128, [](unsigned slot) { return RunSkim(slot); });
+/// ~~~
+///
+//////////////////////////////////////////////////////////////////////////
+class TForkServer {
+public:
+   explicit TForkServer(const std::vector<std::string> &preloadClasses = {});
+   TForkServer(const TForkServer &) = delete;
+   TForkServer &operator=(const TForkServer &) = delete;
+
+   void Preload(const std::string &className);
+   unsigned Run(unsigned nWorkers, const std::function<int(unsigned)> &job);
+};
+
+} // namespace ROOT
+
+#endif
@@ -11,9 +11,58 @@
  
 #include "MPSendRecv.h"
 #include "TBufferFile.h"
+#include "TEnv.h"
+#include "TSystem.h"
 #include "MPCode.h"
+#include <cstdio> //fwrite, fread
 #include <memory> //unique_ptr
 
+namespace {
+/// Set in the size field of a message whose object is in a shared memory file.
+/// The field then holds the size of the name of the file, which is sent instead of the object.
+const ULong_t kShmFlag = ULong_t(1) << (8 * sizeof(ULong_t) - 1);
+
+//////////////////////////////////////////////////////////////////////////
+/// Store the content of a buffer in a new file in shared memory.
+/// /dev/shm is used if available, otherwise the temporary directory.
+/// \return the name of the file, empty in case of failure
+std::string WriteShmFile(const TBufferFile &objBuf)
+{
+   const char *dir = gSystem->AccessPathName("/dev/shm", kWritePermission) ? gSystem->TempDirectory() : "/dev/shm";
+   TString name = "rootmp";
+   FILE *f = gSystem->TempFileName(name, dir);
+   if (!f)
+      return "";
+   bool ok = fwrite(objBuf.Buffer(), 1, objBuf.Length(), f) == (size_t)objBuf.Length();
+   ok = (fclose(f) == 0) && ok;
+   if (!ok) {
+      gSystem->Unlink(name);
+      return "";
+   }
+   return name.Data();
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Read back and remove a file written by WriteShmFile().
+/// \return a buffer with the content of the file, null in case of failure
+std::unique_ptr<TBufferFile> ReadShmFile(const char *name)
+{
+   std::unique_ptr<TBufferFile> objBuf;
+   FileStat_t st;
+   FILE *f = gSystem->GetPathInfo(name, st) ? nullptr : fopen(name, "rb");
+   if (f) {
+      char *classBuf = new char[st.fSize];
+      if (fread(classBuf, 1, st.fSize, f) == (size_t)st.fSize)
+         objBuf.reset(new TBufferFile(TBuffer::kRead, st.fSize, classBuf, true)); //the buffer is deleted by TBuffer's dtor
+      else
+         delete [] classBuf;
+      fclose(f);
+   }
+   gSystem->Unlink(name);
+   return objBuf;
+}
+} // anonymous namespace
+
 //////////////////////////////////////////////////////////////////////////
 /// Send a message with the specified code on the specified socket.
 /// This standalone function can be used to send a code
@@ -38,6 +87,38 @@ int MPSend(TSocket *s, unsigned code)
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+/// Send a message with the specified code and an already streamed object.
+/// Objects larger than `MultiProc.ShmThreshold` bytes (default 1 MB, 0 to
+/// disable) are not written to the socket but to a file in shared memory,
+/// and only the name of the file is sent: the sender does not wait until the
+/// receiver, which serves all workers from a single thread, reads the whole
+/// object from the socket. MPRecv() reads and removes the file.
+/// \param s a pointer to a valid TSocket. No validity checks are performed\n
+/// \param code the code to be sent
+/// \param objBuf the streamed object, can be empty
+/// \return the number of bytes sent, as per TSocket::SendRaw
+int MPSendObjBuf(TSocket *s, unsigned code, const TBufferFile &objBuf)
+{
+   static const Long_t shmThreshold = gEnv->GetValue("MultiProc.ShmThreshold", 1024 * 1024);
+
+   TBufferFile wBuf(TBuffer::kWrite);
+   wBuf.WriteUInt(code);
+   if (shmThreshold > 0 && objBuf.Length() >= shmThreshold) {
+      std::string name = WriteShmFile(objBuf);
+      if (!name.empty()) {
+         wBuf.WriteULong(kShmFlag | (name.length() + 1));
+         wBuf.WriteString(name.c_str());
+         return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+      }
+   }
+   wBuf.WriteULong(objBuf.Length());
+   if (objBuf.Length())
+      wBuf.WriteBuf(objBuf.Buffer(), objBuf.Length());
+   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 /// Receive message from a socket.
 /// This standalone function can be used to read a message that
@@ -76,7 +157,18 @@ MPCodeBufPair MPRecv(TSocket *s)
 
    //receive object if needed
    std::unique_ptr<TBufferFile> objBuf; //defaults to nullptr
-   if (classBufSize != 0) {
+   if (classBufSize & kShmFlag) {
+      //the object is in a shared memory file, see MPSendObjBuf
+      classBufSize &= ~kShmFlag;
+      char *nameBuf = new char[classBufSize];
+      s->RecvRaw(nameBuf, classBufSize);
+      TBufferFile nameReader(TBuffer::kRead, classBufSize, nameBuf, true);
+      std::string name(classBufSize, '\0');
+      nameReader.ReadString(&name[0], classBufSize);
+      objBuf = ReadShmFile(name.c_str());
+      if (!objBuf)
+         Error("MPRecv", "[E] Could not read object from shared memory file %s", name.c_str());
+   } else if (classBufSize != 0) {
       char *classBuf = new char[classBufSize];
       s->RecvRaw(classBuf, classBufSize);
       objBuf.reset(new TBufferFile(TBuffer::kRead, classBufSize, classBuf, true)); //the buffer is deleted by TBuffer's dtor
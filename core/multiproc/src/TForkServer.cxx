@@ -0,0 +1,88 @@
+/* @(#)root/multiproc:$Id$ */
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/TForkServer.hxx"
+#include "TClass.h"
+#include "TError.h"
+#include "TInterpreter.h"
+#include "TROOT.h" //gROOT
+#include "TSystem.h" //gSystem
+#include <errno.h>
+#include <sys/wait.h> // waitpid
+#include <unistd.h> // fork
+
+//////////////////////////////////////////////////////////////////////////
+/// Class constructor.
+/// Initialize the interpreter in this process and preload the given classes,
+/// so that the forked jobs find them already resolved.
+/// \param preloadClasses names of the classes the jobs are going to use
+ROOT::TForkServer::TForkServer(const std::vector<std::string> &preloadClasses)
+{
+   // Accessing gInterpreter triggers the initialization of the interpreter
+   // and of its modules.
+   if (!gInterpreter)
+      Error("TForkServer::TForkServer", "The interpreter could not be initialized");
+
+   for (const auto &name : preloadClasses)
+      Preload(name);
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Resolve a class in this process before forking.
+/// This loads its library and dictionary (autoloading them if needed), its
+/// interpreter information and the StreamerInfo of its current version.
+/// \param className the name of the class
+void ROOT::TForkServer::Preload(const std::string &className)
+{
+   TClass *cl = TClass::GetClass(className.c_str());
+   if (!cl) {
+      Warning("TForkServer::Preload", "Cannot find class %s", className.c_str());
+      return;
+   }
+   cl->GetClassInfo();
+   if (cl->IsLoaded())
+      cl->GetStreamerInfo();
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Fork nWorkers processes, each running the given job, and wait for them.
+/// The job receives the index of its worker in [0, nWorkers) and returns
+/// the exit code of the process. Graphics are disabled in the workers.
+/// \param nWorkers the number of processes to fork
+/// \param job the function executed by each worker
+/// \return the number of workers that could not be started or did not exit with code 0
+unsigned ROOT::TForkServer::Run(unsigned nWorkers, const std::function<int(unsigned)> &job)
+{
+   // Flush buffered output so that it is not duplicated in the children.
+   fflush(stdout);
+   fflush(stderr);
+
+   std::vector<pid_t> pids;
+   unsigned nFailed = 0;
+   for (unsigned nWorker = 0; nWorker < nWorkers; ++nWorker) {
+      pid_t pid = fork();
+      if (pid == 0) {
+         gROOT->SetBatch();
+         gSystem->Exit(job(nWorker));
+      } else if (pid < 0) {
+         Error("TForkServer::Run", "Could not fork worker %u. Error n. %d", nWorker, errno);
+         ++nFailed;
+      } else {
+         pids.push_back(pid);
+      }
+   }
+
+   for (auto pid : pids) {
+      int status = 0;
+      if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+         ++nFailed;
+   }
+   return nFailed;
+}
@@ -146,6 +146,11 @@ namespace ROOT {
     * In case an elaborate thread management is in place, e.g. in presence of
     * stream of operations or "processing slots", it is also possible to
     * manually select the correct object pointer explicitly.
+    *
+    * The object of a slot is copied from the model by the thread which first
+    * accesses that slot, so that its memory is first touched, and therefore
+    * placed, on the NUMA node the thread runs on. Merge() and SnapshotMerge()
+    * can combine the slots hierarchically, in parallel groups.
     */
    template<class T>
    class TThreadedObject {
@@ -291,13 +296,26 @@ namespace ROOT {
       /// Merge all the thread private objects. Can be called once: it does not
       /// create any new object but destroys the present bookkeping collapsing
       /// all objects into the one at slot 0.
-      std::shared_ptr<T> Merge(TThreadedObjectUtils::MergeFunctionType<T> mergeFunction = TThreadedObjectUtils::MergeTObjects<T>)
+      ///
+      /// If nGroups is larger than 1, the merge is hierarchical: the slots are split
+      /// in nGroups groups of contiguous slots, each group is merged into its first
+      /// object in its own thread, and the group results are then merged into slot 0.
+      /// The merge function must then be safe to call concurrently on disjoint sets
+      /// of objects (for ROOT objects, see ROOT::EnableThreadSafety()).
+      std::shared_ptr<T> Merge(TThreadedObjectUtils::MergeFunctionType<T> mergeFunction = TThreadedObjectUtils::MergeTObjects<T>,
+                               unsigned nGroups = 1)
       {
          // We do not return if we already merged.
          if (fIsMerged) {
             Warning("TThreadedObject::Merge", "This object was already merged. Returning the previous result.");
             return fObjPointers[0];
          }
+         if (nGroups > 1 && fObjPointers[0]) {
+            auto partials = MergeGroups(mergeFunction, nGroups, /*inPlace=*/true);
+            mergeFunction(fObjPointers[0], partials);
+            fIsMerged = true;
+            return fObjPointers[0];
+         }
          // need to convert to std::vector because historically mergeFunction requires a vector
          auto vecOfObjPtrs = std::vector<std::shared_ptr<T>>(fObjPointers.begin(), fObjPointers.end());
          mergeFunction(fObjPointers[0], vecOfObjPtrs);
@@ -309,7 +327,11 @@ namespace ROOT {
       /// does create a new instance of class T to represent the "Sum" object.
       /// This method is not thread safe: correct or acceptable behaviours
       /// depend on the nature of T and of the merging function.
-      std::unique_ptr<T> SnapshotMerge(TThreadedObjectUtils::MergeFunctionType<T> mergeFunction = TThreadedObjectUtils::MergeTObjects<T>)
+      ///
+      /// nGroups has the same meaning as for Merge(); the groups are merged into
+      /// new instances, leaving the thread private objects untouched.
+      std::unique_ptr<T> SnapshotMerge(TThreadedObjectUtils::MergeFunctionType<T> mergeFunction = TThreadedObjectUtils::MergeTObjects<T>,
+                                       unsigned nGroups = 1)
       {
          if (fIsMerged) {
             Warning("TThreadedObject::SnapshotMerge", "This object was already merged. Returning the previous result.");
@@ -317,6 +339,11 @@ namespace ROOT {
          }
          auto targetPtr = Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get());
          std::shared_ptr<T> targetPtrShared(targetPtr, [](T *) {});
+         if (nGroups > 1) {
+            auto partials = MergeGroups(mergeFunction, nGroups, /*inPlace=*/false);
+            mergeFunction(targetPtrShared, partials);
+            return std::unique_ptr<T>(targetPtr);
+         }
          // need to convert to std::vector because historically mergeFunction requires a vector
          auto vecOfObjPtrs = std::vector<std::shared_ptr<T>>(fObjPointers.begin(), fObjPointers.end());
          mergeFunction(targetPtrShared, vecOfObjPtrs);
@@ -334,6 +361,42 @@ namespace ROOT {
       mutable ROOT::TSpinMutex fSpinMutex;               ///< Protects concurrent access to fThrIDSlotMap, fObjPointers
       bool fIsMerged : 1;                                ///< Remember if the objects have been merged already
 
+      /// Merge the non-empty slots by groups of contiguous slots, one thread per group, and
+      /// return the partial results. If inPlace, each group is merged into its first object
+      /// (slot 0 for the first group), otherwise into a new copy of the model.
+      std::vector<std::shared_ptr<T>> MergeGroups(const TThreadedObjectUtils::MergeFunctionType<T> &mergeFunction,
+                                                  unsigned nGroups, bool inPlace)
+      {
+         std::vector<std::shared_ptr<T>> objs;
+         for (auto &obj : fObjPointers)
+            if (obj)
+               objs.emplace_back(obj);
+         nGroups = std::max(1u, std::min<unsigned>(nGroups, objs.size()));
+         const auto groupSize = (objs.size() + nGroups - 1) / nGroups;
+
+         std::vector<std::vector<std::shared_ptr<T>>> groups;
+         std::vector<std::shared_ptr<T>> partials;
+         for (std::size_t begin = 0; begin < objs.size(); begin += groupSize) {
+            const auto end = std::min(begin + groupSize, objs.size());
+            groups.emplace_back(objs.begin() + begin, objs.begin() + end);
+            if (inPlace)
+               partials.emplace_back(groups.back().front());
+            else
+               partials.emplace_back(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get()));
+         }
+
+         // The first group runs in this thread.
+         std::vector<std::thread> workers;
+         for (std::size_t i = 1; i < groups.size(); ++i)
+            workers.emplace_back([&, i] { mergeFunction(partials[i], groups[i]); });
+         if (!groups.empty())
+            mergeFunction(partials[0], groups[0]);
+         for (auto &worker : workers)
+            worker.join();
+
+         return partials;
+      }
+
       /// Get the slot number for this threadID, make a slot if needed
       unsigned GetThisSlotNumber()
       {
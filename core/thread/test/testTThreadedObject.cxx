@@ -149,6 +149,24 @@ TEST(TThreadedObject, GrowSlots)
    EXPECT_EQ(*tto.Merge(sum_ints), 4);
 }
 
+TEST(TThreadedObject, HierarchicalMerge)
+{
+   ROOT::TThreadedObject<int> tto(ROOT::TNumSlots{7}, 0);
+   for (auto i = 0u; i < 7u; ++i)
+      *tto.GetAtSlot(i) = i + 1;
+
+   auto sum_ints = [](std::shared_ptr<int> first, std::vector<std::shared_ptr<int>> &all) {
+      for (auto &e : all)
+         if (e != first)
+            *first += *e;
+   };
+   EXPECT_EQ(*tto.SnapshotMerge(sum_ints, 3), 28);
+   EXPECT_EQ(*tto.SnapshotMerge(sum_ints, 16), 28);
+   // the snapshots leave the slots untouched
+   EXPECT_EQ(*tto.GetAtSlot(6), 7);
+   EXPECT_EQ(*tto.Merge(sum_ints, 3), 28);
+}
+
 TEST(TThreadedObject, GetNSlots)
 {
    // default ctor produces fgMaxSlots slots
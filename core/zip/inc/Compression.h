@@ -39,6 +39,7 @@ namespace ROOT {
 ///   [207 - 208]
 ///  - LZ4 is recommended to be used with compression level 4 [404]
 ///  - ZSTD is recommended to be used with compression level 5 [505]
+///  - ZSTD with per-branch dictionaries (kZSTDDict) pays off for baskets of a few KB [605]
 
 struct RCompressionSetting {
    struct EDefaults { /// Note: this is only temporarily a struct and will become a enum class hence the name convention
@@ -96,6 +97,9 @@ struct RCompressionSetting {
          kLZ4,
          /// Use ZSTD compression
          kZSTD,
+         /// Use ZSTD compression with dictionaries trained on the first buffers (TTree branches only;
+         /// plain ZSTD elsewhere). Meant for the many small baskets of low-rate branches.
+         kZSTDDict,
          /// Undefined compression algorithm (must be kept the last of the list in case a new algorithm is added).
          kUndefined
       };
@@ -118,6 +122,8 @@ enum ECompressionAlgorithm {
    /// Deprecated name, do *not* use:
    kZSTD = RCompressionSetting::EAlgorithm::kZSTD,
    /// Deprecated name, do *not* use:
+   kZSTDDict = RCompressionSetting::EAlgorithm::kZSTDDict,
+   /// Deprecated name, do *not* use:
    kUndefinedCompressionAlgorithm = RCompressionSetting::EAlgorithm::kUndefined
 };
 
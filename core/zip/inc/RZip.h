@@ -10,6 +10,8 @@
  *************************************************************************/
 #include "Compression.h"
 
+#include <stddef.h>
+
 /**
  * These are definitions of various free functions for the C-style compression routines in ROOT.
  */
@@ -29,10 +31,36 @@ extern "C" void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, in
  */
 extern "C" void R__zip(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 
+/// Compress with the ZSTD dictionary `dictID` (see R__zipRegisterDictionary); plain ZSTD if `dictID` is 0 or unknown.
+extern "C" void R__zipWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned dictID);
+
+/// Train a ZSTD dictionary of at most `*dictSize` bytes on `nSamples` concatenated samples; returns its identifier
+/// (0 on failure) and sets `*dictSize` to its actual size. The dictionary is not registered.
+extern "C" unsigned R__zipTrainDictionary(char *dict, size_t *dictSize, const char *samples, const size_t *sampleSizes, unsigned nSamples);
+
+/// Make a ZSTD dictionary usable by R__zipWithDictionary and R__unzip in this process; returns its identifier.
+extern "C" unsigned R__zipRegisterDictionary(const char *dict, size_t dictSize);
+
 extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
+/// A decompression backend: same contract as R__unzip, for one block of the algorithm it was registered for.
+typedef void (*R__unzip_backend_t)(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+/// Register a decompression backend for `algorithm` (ZLIB, LZMA, LZ4 or ZSTD). Among the backends of an
+/// algorithm, the "auto" selection picks the one with the highest priority; the builtin ones have priority 0.
+/// Returns 0 on success.
+extern "C" int R__RegisterUnzipBackend(ROOT::RCompressionSetting::EAlgorithm::EValues algorithm, const char *name,
+                                       int priority, R__unzip_backend_t func);
+
+/// Select the backend called `name` for every algorithm that has one, or the highest priority backends
+/// for "auto" (the default). Returns the number of algorithms whose backend was selected.
+extern "C" int R__SetUnzipBackend(const char *name);
+
+/// Name of the backend currently used for `algorithm`, or nullptr if the algorithm has none.
+extern "C" const char *R__GetUnzipBackend(ROOT::RCompressionSetting::EAlgorithm::EValues algorithm);
+
 enum { kMAXZIPBUF = 0xffffff };
 
 #endif
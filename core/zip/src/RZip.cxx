@@ -16,8 +16,16 @@
 
 #include "zlib.h"
 
+#include <atomic>
 #include <cstdio>
+#include <cstring>
 #include <cassert>
+#include <memory>
+#include <mutex>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
 
 // The size of the ROOT block framing headers for compression:
 // - 3 bytes to identify the compression algorithm and version.
@@ -98,7 +106,9 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
      R__zipLZMA(cxlevel, srcsize, src, tgtsize, tgt, irep);
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kLZ4) {
      R__zipLZ4(cxlevel, srcsize, src, tgtsize, tgt, irep);
-  } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD) {
+  } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD ||
+             compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTDDict) {
+     // Without a dictionary at hand kZSTDDict is plain ZSTD; see R__zipWithDictionary.
      R__zipZSTD(cxlevel, srcsize, src, tgtsize, tgt, irep);
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kOldCompressionAlgo || compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal) {
      R__zipOld(cxlevel, srcsize, src, tgtsize, tgt, irep);
@@ -110,6 +120,26 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
   }
 }
 
+/* Same as R__zipMultipleAlgorithm with ZSTD, using the registered dictionary dictID (0: none). */
+void R__zipWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned dictID)
+{
+  if (*srcsize < 1 + HDRSIZE + 1 || cxlevel <= 0) {
+     *irep = 0;
+     return;
+  }
+  R__zipZSTDWithDictionary(cxlevel, srcsize, src, tgtsize, tgt, irep, dictID);
+}
+
+unsigned R__zipTrainDictionary(char *dict, size_t *dictSize, const char *samples, const size_t *sampleSizes, unsigned nSamples)
+{
+  return R__ZSTDTrainDictionary(dict, dictSize, samples, sampleSizes, nSamples);
+}
+
+unsigned R__zipRegisterDictionary(const char *dict, size_t dictSize)
+{
+  return R__ZSTDRegisterDictionary(dict, dictSize);
+}
+
   // The very old algorithm for backward compatibility
   // 0 for selecting with R__ZipMode in a backward compatible way
   // 3 for selecting in other cases
@@ -300,6 +330,174 @@ int R__unzip_header(int *srcsize, uch *src, int *tgtsize)
 }
 
 
+/* ===========================================================================
+   Decompression backends.
+
+   R__unzip hands each block to the backend selected for its algorithm. The
+   builtin libraries are always registered; faster implementations can be
+   registered at run time with R__RegisterUnzipBackend (the selection is a
+   single atomic load per block). For ZLIB the "libdeflate" backend is added
+   when the shared library is found: it has vectorized (AVX2, BMI2, NEON)
+   inflate kernels chosen for the CPU at run time, so the same ROOT binary
+   uses them wherever they are available. The selection is controlled by the
+   rootrc variable Root.UnzipBackend, see R__SetUnzipBackend.
+ */
+namespace {
+
+struct RUnzipBackend {
+   const char *fName;
+   int fPriority;
+   R__unzip_backend_t fFunc;
+};
+
+struct RUnzipAlgorithm {
+   static constexpr int kMaxBackends = 8;
+   RUnzipBackend fBackends[kMaxBackends];
+   int fNBackends = 0;
+   std::atomic<const RUnzipBackend *> fSelected{nullptr};
+};
+
+using RUnzipAlgorithms = RUnzipAlgorithm[ROOT::RCompressionSetting::EAlgorithm::kUndefined];
+
+std::mutex &GetUnzipBackendMutex()
+{
+   static std::mutex mutex;
+   return mutex;
+}
+
+#ifndef _WIN32
+// Minimal subset of the libdeflate API, resolved with dlopen so that ROOT neither needs it at build time nor
+// depends on it at run time.
+using LibdeflateAlloc_t = void *(*)();
+using LibdeflateZlibDecompress_t = int (*)(void *, const void *, size_t, void *, size_t, size_t *);
+using LibdeflateFree_t = void (*)(void *);
+
+struct RLibdeflate {
+   LibdeflateAlloc_t fAlloc = nullptr;
+   LibdeflateZlibDecompress_t fZlibDecompress = nullptr;
+   LibdeflateFree_t fFree = nullptr;
+};
+
+const RLibdeflate &GetLibdeflate()
+{
+   static const RLibdeflate lib = []() {
+      RLibdeflate result;
+      for (const char *name : {"libdeflate.so.0", "libdeflate.so", "libdeflate.0.dylib", "libdeflate.dylib"}) {
+         void *handle = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+         if (!handle)
+            continue;
+         result.fAlloc = reinterpret_cast<LibdeflateAlloc_t>(dlsym(handle, "libdeflate_alloc_decompressor"));
+         result.fZlibDecompress =
+            reinterpret_cast<LibdeflateZlibDecompress_t>(dlsym(handle, "libdeflate_zlib_decompress"));
+         result.fFree = reinterpret_cast<LibdeflateFree_t>(dlsym(handle, "libdeflate_free_decompressor"));
+         if (result.fAlloc && result.fZlibDecompress && result.fFree)
+            break;
+         result = RLibdeflate();
+         dlclose(handle);
+      }
+      return result;
+   }();
+   return lib;
+}
+
+void R__unzipLibdeflate(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
+{
+   const RLibdeflate &lib = GetLibdeflate();
+   // A decompressor holds the decoding tables (a few KB); keep one per thread.
+   struct RDeleter {
+      void operator()(void *d) const { GetLibdeflate().fFree(d); }
+   };
+   thread_local std::unique_ptr<void, RDeleter> decompressor(lib.fAlloc());
+
+   size_t nout = 0;
+   if (decompressor &&
+       lib.fZlibDecompress(decompressor.get(), &src[HDRSIZE], *srcsize - HDRSIZE, tgt, *tgtsize, &nout) == 0) {
+      *irep = nout;
+      return;
+   }
+   // Let zlib deal with (and report) what libdeflate does not accept.
+   R__unzipZLIB(srcsize, src, tgtsize, tgt, irep);
+}
+#endif
+
+void AddUnzipBackend(RUnzipAlgorithm &algo, const char *name, int priority, R__unzip_backend_t func)
+{
+   algo.fBackends[algo.fNBackends++] = {name, priority, func};
+   const RUnzipBackend *selected = algo.fSelected.load();
+   if (!selected || priority > selected->fPriority)
+      algo.fSelected = &algo.fBackends[algo.fNBackends - 1];
+}
+
+RUnzipAlgorithms &GetUnzipAlgorithms()
+{
+   static RUnzipAlgorithms algorithms;
+   static const bool init = []() {
+      AddUnzipBackend(algorithms[ROOT::RCompressionSetting::EAlgorithm::kZLIB], "zlib", 0, R__unzipZLIB);
+      AddUnzipBackend(algorithms[ROOT::RCompressionSetting::EAlgorithm::kLZMA], "lzma", 0, R__unzipLZMA);
+      AddUnzipBackend(algorithms[ROOT::RCompressionSetting::EAlgorithm::kLZ4], "lz4", 0, R__unzipLZ4);
+      AddUnzipBackend(algorithms[ROOT::RCompressionSetting::EAlgorithm::kZSTD], "zstd", 0, R__unzipZSTD);
+#ifndef _WIN32
+      if (GetLibdeflate().fAlloc)
+         AddUnzipBackend(algorithms[ROOT::RCompressionSetting::EAlgorithm::kZLIB], "libdeflate", 10, R__unzipLibdeflate);
+#endif
+      return true;
+   }();
+   (void)init;
+   return algorithms;
+}
+
+inline void R__unzipWithBackend(ROOT::RCompressionSetting::EAlgorithm::EValues algorithm, int *srcsize,
+                                unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
+{
+   GetUnzipAlgorithms()[algorithm].fSelected.load(std::memory_order_acquire)->fFunc(srcsize, src, tgtsize, tgt, irep);
+}
+
+} // anonymous namespace
+
+int R__RegisterUnzipBackend(ROOT::RCompressionSetting::EAlgorithm::EValues algorithm, const char *name, int priority,
+                            R__unzip_backend_t func)
+{
+   if (algorithm <= ROOT::RCompressionSetting::EAlgorithm::kUseGlobal ||
+       algorithm >= ROOT::RCompressionSetting::EAlgorithm::kUndefined || !func)
+      return 1;
+   RUnzipAlgorithm &algo = GetUnzipAlgorithms()[algorithm];
+   std::lock_guard<std::mutex> lock(GetUnzipBackendMutex());
+   if (!algo.fSelected.load() || algo.fNBackends == RUnzipAlgorithm::kMaxBackends)
+      return 1; // the algorithm has no block format of its own
+   AddUnzipBackend(algo, name, priority, func);
+   return 0;
+}
+
+int R__SetUnzipBackend(const char *name)
+{
+   const bool automatic = !name || !*name || !strcmp(name, "auto");
+   int nselected = 0;
+   std::lock_guard<std::mutex> lock(GetUnzipBackendMutex());
+   for (RUnzipAlgorithm &algo : GetUnzipAlgorithms()) {
+      const RUnzipBackend *selected = nullptr;
+      for (int i = 0; i < algo.fNBackends; ++i) {
+         const RUnzipBackend &backend = algo.fBackends[i];
+         if (automatic ? (!selected || backend.fPriority > selected->fPriority) : !strcmp(backend.fName, name))
+            selected = &backend;
+      }
+      if (selected) {
+         algo.fSelected = selected;
+         ++nselected;
+      }
+   }
+   return nselected;
+}
+
+const char *R__GetUnzipBackend(ROOT::RCompressionSetting::EAlgorithm::EValues algorithm)
+{
+   if (algorithm <= ROOT::RCompressionSetting::EAlgorithm::kUseGlobal ||
+       algorithm >= ROOT::RCompressionSetting::EAlgorithm::kUndefined)
+      return nullptr;
+   const RUnzipBackend *selected = GetUnzipAlgorithms()[algorithm].fSelected.load();
+   return selected ? selected->fName : nullptr;
+}
+
+
 /***********************************************************************
  *                                                                     *
  * Name: R__unzip                                    Date:    20.01.95 *
@@ -358,16 +556,16 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
 
    /* ZLIB and other standard compression algorithms */
    if (is_valid_header_zlib(src)) {
-      R__unzipZLIB(srcsize, src, tgtsize, tgt, irep);
+      R__unzipWithBackend(ROOT::RCompressionSetting::EAlgorithm::kZLIB, srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_lzma(src)) {
-      R__unzipLZMA(srcsize, src, tgtsize, tgt, irep);
+      R__unzipWithBackend(ROOT::RCompressionSetting::EAlgorithm::kLZMA, srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_lz4(src)) {
-      R__unzipLZ4(srcsize, src, tgtsize, tgt, irep);
+      R__unzipWithBackend(ROOT::RCompressionSetting::EAlgorithm::kLZ4, srcsize, src, tgtsize, tgt, irep);
       return;
    } else if (is_valid_header_zstd(src)) {
-      R__unzipZSTD(srcsize, src, tgtsize, tgt, irep);
+      R__unzipWithBackend(ROOT::RCompressionSetting::EAlgorithm::kZSTD, srcsize, src, tgtsize, tgt, irep);
       return;
    }
 
@@ -12,11 +12,25 @@
 
 // NOTE: the ROOT compression libraries aren't consistently written in C++; hence the
 // #ifdef's to avoid problems with C code.
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+/// Compress with the dictionary `dictID` previously registered with R__ZSTDRegisterDictionary;
+/// falls back to R__zipZSTD if the dictionary is unknown. R__unzipZSTD finds the dictionary
+/// from the identifier stored in the compressed frame.
+void R__zipZSTDWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned dictID);
+/// Train a dictionary of at most `*dictSize` bytes from the `nSamples` concatenated samples; on return `*dictSize`
+/// is the size of the dictionary. Returns the dictionary identifier, 0 on failure.
+unsigned R__ZSTDTrainDictionary(char *dict, size_t *dictSize, const char *samples, const size_t *sampleSizes,
+                                unsigned nSamples);
+/// Make a dictionary available for compression and decompression in this process; returns its identifier
+/// (0 if `dict` is not a valid dictionary). Registering the same dictionary again is a no-op.
+unsigned R__ZSTDRegisterDictionary(const char *dict, size_t dictSize);
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,11 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include <iostream>
 
@@ -22,17 +26,65 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+namespace {
+
+/// A dictionary registered with R__ZSTDRegisterDictionary, kept for the lifetime of the process
+/// since baskets compressed with it can be read at any time.
+struct RZSTDDictionary {
+    std::string fContent;
+    ZSTD_DDict *fDDict = nullptr;
+    std::map<int, ZSTD_CDict *> fCDicts; ///< Digested dictionaries, per compression level
+};
+
+std::mutex &GetDictionaryMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::unordered_map<unsigned, RZSTDDictionary> &GetDictionaries()
+{
+    static std::unordered_map<unsigned, RZSTDDictionary> dictionaries;
+    return dictionaries;
+}
+
+const ZSTD_CDict *GetCDict(unsigned dictID, int level)
+{
+    std::lock_guard<std::mutex> lock(GetDictionaryMutex());
+    auto it = GetDictionaries().find(dictID);
+    if (it == GetDictionaries().end())
+        return nullptr;
+    auto &cdict = it->second.fCDicts[level];
+    if (!cdict)
+        cdict = ZSTD_createCDict(it->second.fContent.data(), it->second.fContent.size(), level);
+    return cdict;
+}
+
+const ZSTD_DDict *GetDDict(unsigned dictID)
+{
+    std::lock_guard<std::mutex> lock(GetDictionaryMutex());
+    auto it = GetDictionaries().find(dictID);
+    return it == GetDictionaries().end() ? nullptr : it->second.fDDict;
+}
+
+void ZipZSTDImpl(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, const ZSTD_CDict *cdict)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
     Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
 
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    size_t retval;
+    if (cdict) {
+        retval = ZSTD_compress_usingCDict(fCtx.get(),
+                                          &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                          src, static_cast<size_t>(*srcsize), cdict);
+    } else {
+        retval = ZSTD_compressCCtx(fCtx.get(),
+                                   &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                   src, static_cast<size_t>(*srcsize),
+                                   2*cxlevel);
+    }
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -58,6 +110,45 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
     tgt[8] = (inflate_size >> 16) & 0xff;
 }
 
+} // anonymous namespace
+
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    ZipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, nullptr);
+}
+
+void R__zipZSTDWithDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned dictID)
+{
+    const ZSTD_CDict *cdict = dictID ? GetCDict(dictID, 2*cxlevel) : nullptr;
+    ZipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, cdict);
+}
+
+unsigned R__ZSTDTrainDictionary(char *dict, size_t *dictSize, const char *samples, const size_t *sampleSizes,
+                                unsigned nSamples)
+{
+    size_t retval = ZDICT_trainFromBuffer(dict, *dictSize, samples, sampleSizes, nSamples);
+    if (ZDICT_isError(retval)) {
+        *dictSize = 0;
+        return 0;
+    }
+    *dictSize = retval;
+    return ZDICT_getDictID(dict, retval);
+}
+
+unsigned R__ZSTDRegisterDictionary(const char *dict, size_t dictSize)
+{
+    const unsigned dictID = ZDICT_getDictID(dict, dictSize);
+    if (dictID == 0)
+        return 0;
+    std::lock_guard<std::mutex> lock(GetDictionaryMutex());
+    auto &entry = GetDictionaries()[dictID];
+    if (!entry.fDDict) {
+        entry.fContent.assign(dict, dictSize);
+        entry.fDDict = ZSTD_createDDict(entry.fContent.data(), entry.fContent.size());
+    }
+    return dictID;
+}
+
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
@@ -77,9 +168,25 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    // Frames compressed with a dictionary carry its identifier; the dictionary must have been
+    // registered beforehand (e.g. when reading the branch that owns it).
+    const unsigned dictID = ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    size_t retval;
+    if (dictID) {
+      const ZSTD_DDict *ddict = GetDDict(dictID);
+      if (R__unlikely(!ddict)) {
+        std::cerr << "R__unzipZSTD: the buffer was compressed with the dictionary " << dictID <<
+        " that is not registered." << std::endl;
+        return;
+      }
+      retval = ZSTD_decompress_usingDDict(fCtx.get(),
+                                          (char *)tgt, static_cast<size_t>(*tgtsize),
+                                          (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize), ddict);
+    } else {
+      retval = ZSTD_decompressDCtx(fCtx.get(),
+                                   (char *)tgt, static_cast<size_t>(*tgtsize),
+                                   (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    }
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
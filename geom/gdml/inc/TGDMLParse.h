@@ -19,6 +19,7 @@
 #include "TGeoElement.h"
 
 #include <map>
+#include <unordered_map>
 #include <iostream>
 
 class TGDMLMatrix;
@@ -55,7 +56,7 @@ private:
  * TGDMLParse - base class for the import of GDML to ROOT.               *
  *************************************************************************/
 
-class TGDMLBaseTGDMMapHelper : public std::map<std::string, const void *> {
+class TGDMLBaseTGDMMapHelper : public std::unordered_map<std::string, const void *> {
 };
 
 //map's [] operator returns reference.
@@ -65,21 +66,20 @@ template<typename T>
 
 class TGDMAssignmentHelper {
 private:
-   TGDMLBaseTGDMMapHelper::iterator fPosInMap;
+   const void **fValue; // references to elements stay valid when the map is rehashed, iterators do not
 
 public:
    TGDMAssignmentHelper(TGDMLBaseTGDMMapHelper &baseMap, const std::string &key) {
-      baseMap[key];//if we do not have this key-value pair before, insert it now (with zero for pointer).
-      //find iterator for this key now :)
-      fPosInMap = baseMap.find(key);
+      //if we do not have this key-value pair before, insert it now (with zero for pointer).
+      fValue = &baseMap[key];
    }
 
    operator T * ()const {
-      return (T*)fPosInMap->second;//const_cast<T*>(static_cast<const T *>(fPosInMap->second));
+      return (T*)*fValue;//const_cast<T*>(static_cast<const T *>(*fValue));
    }
 
    TGDMAssignmentHelper & operator = (const T * ptr) {
-      fPosInMap->second = ptr;
+      *fValue = ptr;
       return *this;
    }
 };
@@ -198,10 +198,10 @@ private:
    typedef TGDMMapHelper<TGDMLMatrix> MatrixMap;
    typedef TGDMMapHelper<TGDMLRefl> ReflSolidMap;
    typedef TGDMMapHelper<const char> FileMap;
-   typedef std::map<std::string, std::string> ReflectionsMap;
-   typedef std::map<std::string, std::string> ReflVolMap;
+   typedef std::unordered_map<std::string, std::string> ReflectionsMap;
+   typedef std::unordered_map<std::string, std::string> ReflVolMap;
    typedef std::map<std::string, double> FracMap;
-   typedef std::map<std::string, double> ConstMap;
+   typedef std::unordered_map<std::string, double> ConstMap;
 
    PosMap fposmap;                //!Map containing position names and the TGeoTranslation for it
    RotMap frotmap;                //!Map containing rotation names and the TGeoRotation for it
@@ -117,6 +117,7 @@ When most solids or volumes are added to the geometry they
 #include <cstdlib>
 #include <string>
 #include <sstream>
+#include <vector>
 #include <locale>
 
 ClassImp(TGDMLParse);
@@ -749,6 +750,121 @@ Double_t TGDMLParse::GetScaleVal(const char *sunit)
    return retunit;
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Recursive descent evaluation of the most common GDML expressions: numbers and
+/// known constants combined with + - * / and parentheses. Operations are done in
+/// the same order as in the TFormula generated code, therefore results are identical.
+/// Anything else (functions, powers, unknown names) makes Eval() fail.
+
+class TGDMLSimpleExpression {
+   const char *fPos;
+   const std::unordered_map<std::string, double> &fConsts;
+   bool fOk = true;
+
+   void SkipSpaces()
+   {
+      while (*fPos != 0 && isspace(*fPos))
+         ++fPos;
+   }
+
+   double Primary()
+   {
+      SkipSpaces();
+      if (*fPos == '(') {
+         ++fPos;
+         double val = Sum();
+         SkipSpaces();
+         if (*fPos != ')')
+            fOk = false;
+         else
+            ++fPos;
+         return val;
+      }
+      if (isdigit(*fPos) || *fPos == '.') {
+         char *end;
+         double val = strtod(fPos, &end);
+         if (end == fPos)
+            fOk = false;
+         fPos = end;
+         return val;
+      }
+      if (isalpha(*fPos) || *fPos == '_') {
+         const char *beg = fPos;
+         while (isalnum(*fPos) || *fPos == '_')
+            ++fPos;
+         auto it = fConsts.find(std::string(beg, fPos - beg));
+         if (it != fConsts.end())
+            return it->second;
+      }
+      fOk = false;
+      return 0;
+   }
+
+   double Unary()
+   {
+      SkipSpaces();
+      if (*fPos == '-') {
+         ++fPos;
+         return -Unary();
+      }
+      if (*fPos == '+') {
+         ++fPos;
+         return Unary();
+      }
+      return Primary();
+   }
+
+   double Product()
+   {
+      double val = Unary();
+      while (fOk) {
+         SkipSpaces();
+         if (*fPos == '*' && fPos[1] != '*') {
+            ++fPos;
+            val *= Unary();
+         } else if (*fPos == '/') {
+            ++fPos;
+            val /= Unary();
+         } else {
+            break;
+         }
+      }
+      return val;
+   }
+
+   double Sum()
+   {
+      double val = Product();
+      while (fOk) {
+         SkipSpaces();
+         if (*fPos == '+') {
+            ++fPos;
+            val += Product();
+         } else if (*fPos == '-') {
+            ++fPos;
+            val -= Product();
+         } else {
+            break;
+         }
+      }
+      return val;
+   }
+
+public:
+   TGDMLSimpleExpression(const char *expr, const std::unordered_map<std::string, double> &consts) : fPos(expr), fConsts(consts) {}
+
+   bool Eval(double &val)
+   {
+      val = Sum();
+      SkipSpaces();
+      return fOk && *fPos == 0;
+   }
+};
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Convert number in string format to double value.
 
@@ -766,6 +882,15 @@ Double_t TGDMLParse::Value(const char *svalue) const
    if (*end == 0)
       return val;
 
+   // Most expressions only combine constants with arithmetic operators, evaluate
+   // them directly: building a TFormula for each value dominates the import time
+   // of large geometries.
+   if (TGDMLSimpleExpression(svalue, fconsts).Eval(val)) {
+      if (std::isnan(val) || std::isinf(val))
+         Fatal("Value", "Got bad value %lf from string '%s'", val, svalue);
+      return val;
+   }
+
    // Otherwise we'll use TFormula to evaluate the string, having first found
    // all the GDML variable names in it and marked them with [] so that
    // TFormula will recognize them as parameters.
@@ -777,6 +902,9 @@ Double_t TGDMLParse::Value(const char *svalue) const
    // "alphanumeric"
    const std::locale &loc = std::locale::classic(); // "C" locale
 
+   // Names of the parameters, i.e. all the text put in brackets
+   std::vector<std::string> params;
+
    // Walk through the string inserting '[' and ']' where necessary
    const char *p = svalue;
    while (*p) {
@@ -794,6 +922,7 @@ Double_t TGDMLParse::Value(const char *svalue) const
                         expanded += *p;
                      break;
                   } else {
+                     params.emplace_back(p, pe - p);
                      expanded += '[';
                      for (; p < pe; ++p)
                         expanded += *p;
@@ -803,6 +932,7 @@ Double_t TGDMLParse::Value(const char *svalue) const
                }
             }
             if (*pe == 0) {
+               params.emplace_back(p, pe - p);
                expanded += '[';
                for (; p < pe; ++p)
                   expanded += *p;
@@ -815,9 +945,12 @@ Double_t TGDMLParse::Value(const char *svalue) const
 
    TFormula f("TFormula", expanded.c_str());
 
-   // Tell the TFormula about every parameter we know about
-   for (auto &it : fconsts)
-      f.SetParameter(it.first.c_str(), it.second);
+   // Tell the TFormula about the parameters it uses that we know about
+   for (auto &name : params) {
+      auto it = fconsts.find(name);
+      if (it != fconsts.end())
+         f.SetParameter(name.c_str(), it->second);
+   }
 
    val = f.Eval(0);
 
@@ -57,6 +57,8 @@ public:
    virtual void          DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t *step) const;
    static  Double_t      DistFromOutside(const Double_t *point,const Double_t *dir,
                                    Double_t dx, Double_t dy, Double_t dz, const Double_t *origin, Double_t stepmax=TGeoShape::Big());
+   static  void          DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t dx, Double_t dy, Double_t dz,
+                                   const Double_t *origin, const Double_t *stepmax, Double_t *dists, Int_t vecsize);
    virtual TGeoVolume   *Divide(TGeoVolume *voldiv, const char *divname, Int_t iaxis, Int_t ndiv,
                                 Double_t start, Double_t step);
    virtual const char   *GetAxisName(Int_t iaxis) const;
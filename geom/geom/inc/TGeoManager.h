@@ -365,6 +365,8 @@ public:
    TGeoPhysicalNode      *MakeAlignablePN(const char *name);
    TGeoPhysicalNode      *MakeAlignablePN(TGeoPNEntry *entry);
    TGeoPhysicalNode      *MakePhysicalNode(const char *path=nullptr);
+   Int_t                  AlignPhysicalNodes(Int_t npnodes, TGeoPhysicalNode **pnodes, TGeoMatrix **matrices,
+                                             TGeoShape **shapes=nullptr);
    void                   ClearPhysicalNodes(Bool_t mustdelete=kFALSE);
    void                   RefreshPhysicalNodes(Bool_t lock=kTRUE);
    TVirtualGeoTrack      *MakeTrack(Int_t id, Int_t pdgcode, TObject *particle);
@@ -379,6 +381,7 @@ public:
    TGeoNode              *FindNextBoundaryAndStep(Double_t stepmax=TGeoShape::Big(), Bool_t compsafe=kFALSE);
    TGeoNode              *FindNode(Bool_t safe_start=kTRUE);
    TGeoNode              *FindNode(Double_t x, Double_t y, Double_t z);
+   void                   FindNodes(const Double_t *points, TGeoNode **nodes, Int_t npoints);
    Double_t              *FindNormal(Bool_t forward=kTRUE);
    Double_t              *FindNormalFast();
    TGeoNode              *InitTrack(const Double_t *point, const Double_t *dir);
@@ -106,9 +106,12 @@ public :
    TGeoNode              *CrossBoundaryAndLocate(Bool_t downwards, TGeoNode *skipnode);
    TGeoNode              *FindNextBoundary(Double_t stepmax=TGeoShape::Big(),const char *path="", Bool_t frombdr=kFALSE);
    TGeoNode              *FindNextDaughterBoundary(Double_t *point, Double_t *dir, Int_t &idaughter, Bool_t compmatrix=kFALSE);
+   void                   FindNextBoundary_v(TGeoVolume *vol, const Double_t *points, const Double_t *dirs, Double_t *steps,
+                                             Int_t *idaughter, Int_t vecsize) const;
    TGeoNode              *FindNextBoundaryAndStep(Double_t stepmax=TGeoShape::Big(), Bool_t compsafe=kFALSE);
    TGeoNode              *FindNode(Bool_t safe_start=kTRUE);
    TGeoNode              *FindNode(Double_t x, Double_t y, Double_t z);
+   void                   FindNodes(const Double_t *points, TGeoNode **nodes, Int_t npoints, const Int_t *order=nullptr);
    Double_t              *FindNormal(Bool_t forward=kTRUE);
    Double_t              *FindNormalFast();
    TGeoNode              *InitTrack(const Double_t *point, const Double_t *dir);
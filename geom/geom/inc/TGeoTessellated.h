@@ -116,9 +116,30 @@ private:
    std::vector<Vertex_t> fVertices; // List of vertices
    std::vector<TGeoFacet> fFacets;  // List of facets
 
+   /// Triangle of a facet, as used by the navigation
+   struct Triangle_t {
+      Vertex_t fV0;     // first vertex
+      Vertex_t fE1;     // edge from first to second vertex
+      Vertex_t fE2;     // edge from first to third vertex
+      Vertex_t fNormal; // unit normal pointing outside
+   };
+   /// Node of the bounding volume hierarchy of the triangles
+   struct BVHNode_t {
+      double fMin[3];   // lower corner of the bounding box
+      double fMax[3];   // upper corner of the bounding box
+      int fFirst;       // first triangle for a leaf, index of the first child otherwise (second is next)
+      int fCount;       // number of triangles for a leaf, 0 otherwise
+   };
+   std::vector<Triangle_t> fTriangles; //! Triangles ordered by the leaves of fBVH
+   std::vector<BVHNode_t> fBVH;        //! Bounding volume hierarchy, root first
+
    TGeoTessellated(const TGeoTessellated&) = delete;
    TGeoTessellated& operator=(const TGeoTessellated&) = delete;
 
+   void BuildBVH();
+   double DistToTriangles(const double *point, const double *dir, int sense, double stepmax, int *itri = nullptr) const;
+   double SafetyToTriangles(const double *point, int *itri = nullptr) const;
+
 public:
    // constructors
    TGeoTessellated() {}
@@ -145,13 +166,20 @@ public:
    const Vertex_t &GetVertex(int i) { return fVertices[i]; }
 
    virtual void AfterStreamer();
+   virtual void ComputeNormal(const double *point, const double *dir, double *norm);
+   virtual bool Contains(const double *point) const;
    virtual int DistancetoPrimitive(int, int) { return 99999; }
+   virtual double DistFromInside(const double *point, const double *dir, int iact = 1, double step = TGeoShape::Big(),
+                                 double *safe = nullptr) const;
+   virtual double DistFromOutside(const double *point, const double *dir, int iact = 1, double step = TGeoShape::Big(),
+                                  double *safe = nullptr) const;
    virtual const TBuffer3D &GetBuffer3D(int reqSections, Bool_t localFrame) const;
    virtual void GetMeshNumbers(int &nvert, int &nsegs, int &npols) const;
    virtual int GetNmeshVertices() const { return fNvert; }
    virtual void InspectShape() const {}
    virtual TBuffer3D *MakeBuffer3D() const;
    virtual void Print(Option_t *option = "") const;
+   virtual double Safety(const double *point, bool in = true) const;
    virtual void SavePrimitive(std::ostream &, Option_t *) {}
    virtual void SetPoints(double *points) const;
    virtual void SetPoints(Float_t *points) const;
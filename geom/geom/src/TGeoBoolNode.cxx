@@ -46,6 +46,33 @@ implementations for Boolean nodes are:
 
 ClassImp(TGeoBoolNode);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check if the local point is inside the bounding box of a component shape,
+/// which is a cheap necessary condition for the point to be inside the shape.
+
+inline Bool_t InsideBBox(const TGeoShape *shape, const Double_t *local)
+{
+   if (shape->TestShapeBit(TGeoShape::kGeoHalfSpace)) return kTRUE;
+   const TGeoBBox *box = (const TGeoBBox*)shape;
+   return TGeoBBox::Contains(local, box->GetDX(), box->GetDY(), box->GetDZ(), box->GetOrigin());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance to the bounding box of a component shape, a lower limit for the distance
+/// to the shape itself; 0 for points inside the box and Big() if the box is missed.
+
+inline Double_t DistToBBox(const TGeoShape *shape, const Double_t *local, const Double_t *ldir)
+{
+   if (shape->TestShapeBit(TGeoShape::kGeoHalfSpace)) return 0.;
+   const TGeoBBox *box = (const TGeoBBox*)shape;
+   return TGeoBBox::DistFromOutside(local, ldir, box->GetDX(), box->GetDY(), box->GetDZ(), box->GetOrigin());
+}
+
+} // anonymous namespace
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor.
 
@@ -525,10 +552,10 @@ Bool_t TGeoUnion::Contains(const Double_t *point) const
 {
    Double_t local[3];
    fLeftMat->MasterToLocal(point, &local[0]);
-   Bool_t inside = fLeft->Contains(&local[0]);
+   Bool_t inside = InsideBBox(fLeft, &local[0]) && fLeft->Contains(&local[0]);
    if (inside) return kTRUE;
    fRightMat->MasterToLocal(point, &local[0]);
-   inside = fRight->Contains(&local[0]);
+   inside = InsideBBox(fRight, &local[0]) && fRight->Contains(&local[0]);
    return inside;
 }
 
@@ -723,9 +750,33 @@ Double_t TGeoUnion::DistFromOutside(const Double_t *point, const Double_t *dir,
    fLeftMat->MasterToLocal(point, &local[0]);
    fLeftMat->MasterToLocalVect(dir, &ldir[0]);
    fRightMat->MasterToLocalVect(dir, &rdir[0]);
-   d1 = fLeft->DistFromOutside(&local[0], &ldir[0], iact, step, safe);
-   fRightMat->MasterToLocal(point, &local[0]);
-   d2 = fRight->DistFromOutside(&local[0], &rdir[0], iact, step, safe);
+   if (iact==3) {
+      // compute first the distance to the component having the closest bounding box, the
+      // other one is skipped if its bounding box is farther than the distance found
+      Double_t rlocal[3];
+      fRightMat->MasterToLocal(point, &rlocal[0]);
+      Double_t b1 = DistToBBox(fLeft, &local[0], &ldir[0]);
+      Double_t b2 = DistToBBox(fRight, &rlocal[0], &rdir[0]);
+      if (b1 <= b2) {
+         d1 = fLeft->DistFromOutside(&local[0], &ldir[0], iact, step, safe);
+         if (b2 > d1+TGeoShape::Tolerance()) {
+            node->SetSelected(1);
+            return d1;
+         }
+         d2 = fRight->DistFromOutside(&rlocal[0], &rdir[0], iact, step, safe);
+      } else {
+         d2 = fRight->DistFromOutside(&rlocal[0], &rdir[0], iact, step, safe);
+         if (b1 > d2+TGeoShape::Tolerance()) {
+            node->SetSelected(2);
+            return d2;
+         }
+         d1 = fLeft->DistFromOutside(&local[0], &ldir[0], iact, step, safe);
+      }
+   } else {
+      d1 = fLeft->DistFromOutside(&local[0], &ldir[0], iact, step, safe);
+      fRightMat->MasterToLocal(point, &local[0]);
+      d2 = fRight->DistFromOutside(&local[0], &rdir[0], iact, step, safe);
+   }
    if (d1<d2) {
       snxt = d1;
       node->SetSelected(1);
@@ -968,10 +1019,10 @@ Bool_t TGeoSubtraction::Contains(const Double_t *point) const
 {
    Double_t local[3];
    fLeftMat->MasterToLocal(point, &local[0]);
-   Bool_t inside = fLeft->Contains(&local[0]);
+   Bool_t inside = InsideBBox(fLeft, &local[0]) && fLeft->Contains(&local[0]);
    if (!inside) return kFALSE;
    fRightMat->MasterToLocal(point, &local[0]);
-   inside = !fRight->Contains(&local[0]);
+   inside = !(InsideBBox(fRight, &local[0]) && fRight->Contains(&local[0]));
    return inside;
 }
 
@@ -1003,6 +1054,11 @@ Double_t TGeoSubtraction::DistFromInside(const Double_t *point, const Double_t *
    fRightMat->MasterToLocalVect(dir, &rdir[0]);
    d1 = fLeft->DistFromInside(&local[0], &ldir[0], iact, step, safe);
    fRightMat->MasterToLocal(point, &local[0]);
+   // the subtracted shape is not reached if its bounding box is farther than the exit point
+   if (iact==3 && DistToBBox(fRight, &local[0], &rdir[0]) > d1+TGeoShape::Tolerance()) {
+      node->SetSelected(1);
+      return d1;
+   }
    d2 = fRight->DistFromOutside(&local[0], &rdir[0], iact, step, safe);
    if (d1<d2) {
       snxt = d1;
@@ -1370,10 +1426,10 @@ Bool_t TGeoIntersection::Contains(const Double_t *point) const
 {
    Double_t local[3];
    fLeftMat->MasterToLocal(point, &local[0]);
-   Bool_t inside = fLeft->Contains(&local[0]);
+   Bool_t inside = InsideBBox(fLeft, &local[0]) && fLeft->Contains(&local[0]);
    if (!inside) return kFALSE;
    fRightMat->MasterToLocal(point, &local[0]);
-   inside = fRight->Contains(&local[0]);
+   inside = InsideBBox(fRight, &local[0]) && fRight->Contains(&local[0]);
    return inside;
 }
 
@@ -1439,9 +1495,11 @@ Double_t TGeoIntersection::DistFromOutside(const Double_t *point, const Double_t
    fRightMat->MasterToLocal(point, rpt);
    fLeftMat->MasterToLocalVect(dir, ldir);
    fRightMat->MasterToLocalVect(dir, rdir);
+   node->SetSelected(0);
+   // the intersection cannot be reached if the ray misses any of the bounding boxes
+   if (DistToBBox(fLeft, lpt, ldir) > 1E20 || DistToBBox(fRight, rpt, rdir) > 1E20) return TGeoShape::Big();
    Bool_t inleft = fLeft->Contains(lpt);
    Bool_t inright = fRight->Contains(rpt);
-   node->SetSelected(0);
    Double_t snext = 0.0;
    if (inleft && inright) {
       // It is vey likely to have a numerical issue and the point should
@@ -320,6 +320,7 @@ void TGeoCompositeShape::ComputeNormal(const Double_t *point, const Double_t *di
 
 Bool_t TGeoCompositeShape::Contains(const Double_t *point) const
 {
+   if (!TGeoBBox::Contains(point, fDX, fDY, fDZ, fOrigin)) return kFALSE;
    if (fNode) return fNode->Contains(point);
    return kFALSE;
 }
@@ -1187,7 +1187,11 @@ void TGeoCone::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 
 void TGeoCone::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoCone::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInsideS(&points[3*i], &dirs[3*i], fDz, fRmin1, fRmax1, fRmin2, fRmax2);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1195,7 +1199,16 @@ void TGeoCone::DistFromInside_v(const Double_t *points, const Double_t *dirs, Do
 
 void TGeoCone::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoCone::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   // check in one pass which points cross the bounding box within the requested distance
+   TGeoBBox::DistFromOutside_v(points, dirs, fDX, fDY, fDZ, fOrigin, step, dists, vecsize);
+   for (Int_t i=0; i<vecsize; i++) {
+      if (dists[i] >= step[i]) dists[i] = TGeoShape::Big();
+      else                     dists[i] = DistFromOutsideS(&points[3*i], &dirs[3*i], fDz, fRmin1, fRmax1, fRmin2, fRmax2);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
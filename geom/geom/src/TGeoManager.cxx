@@ -234,9 +234,12 @@ in order to enhance rays.
 \image html geom_random2.jpg
 */
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 #include "TROOT.h"
 #include "TGeoManager.h"
@@ -284,6 +287,10 @@ in order to enhance rays.
 #include "TGDMLMatrix.h"
 #include "TGeoOpticalSurface.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 // statics and globals
 
 TGeoManager *gGeoManager = nullptr;
@@ -303,6 +310,60 @@ TGeoManager::EDefaultUnits TGeoManager::fgDefaultUnits = TGeoManager::kRootUnits
 TGeoManager::ThreadsMap_t *TGeoManager::fgThreadId = 0;
 static Bool_t gGeometryLocked = kTRUE;
 
+namespace {
+
+/// Incremented whenever navigators are added, removed or switched and when the
+/// threads map is cleared: invalidates the values cached by every thread.
+std::atomic<UInt_t> gNavigatorsVersion{1};
+std::atomic<UInt_t> gThreadsMapVersion{1};
+
+/// Current navigator of the calling thread for a given manager, cached in thread
+/// local storage so that GetCurrentNavigator() does not need any lookup or lock
+struct ThreadNavigator_t {
+   const TGeoManager *fManager;
+   UInt_t fVersion;
+   TGeoNavigator *fNavigator;
+};
+
+/// Ordinal number of the calling thread, valid for fVersion of the threads map
+struct ThreadOrdinal_t {
+   UInt_t fVersion;
+   Int_t fId;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Voxelize the volumes, or rebuild their existing voxels if rebuild is set, in
+/// parallel with implicit multi-threading enabled. Assemblies and volumes having
+/// assembly daughters compute the bounding boxes of these assemblies: they are
+/// done first, sequentially.
+
+void VoxelizeVolumes(const std::vector<TGeoVolume *> &volumes, Option_t *option, Bool_t rebuild)
+{
+   auto voxelize = [option, rebuild](TGeoVolume *vol) {
+      if (rebuild) vol->GetVoxels()->Voxelize(option);
+      else vol->Voxelize(option);
+   };
+   std::vector<TGeoVolume *> independent;
+   for (auto vol : volumes) {
+      Int_t nd = vol->GetNdaughters();
+      Bool_t sequential = !nd || vol->GetFinder() || vol->IsAssembly();
+      for (Int_t i=0; i<nd && !sequential; i++)
+         sequential = vol->GetNode(i)->GetVolume()->IsAssembly();
+      if (sequential) voxelize(vol);
+      else independent.push_back(vol);
+   }
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && independent.size() > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(voxelize, independent);
+      return;
+   }
+#endif
+   for (auto vol : independent) voxelize(vol);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor.
 
@@ -718,6 +779,7 @@ Int_t TGeoManager::AddVolume(TGeoVolume *volume)
 TGeoNavigator *TGeoManager::AddNavigator()
 {
    if (fMultiThread) { TGeoManager::ThreadId(); fgMutex.lock(); }
+   ++gNavigatorsVersion;
    std::thread::id threadId = std::this_thread::get_id();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
    TGeoNavigatorArray *array = 0;
@@ -734,19 +796,23 @@ TGeoNavigator *TGeoManager::AddNavigator()
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns current navigator for the calling thread.
+///
+/// In multi-threaded mode the navigator is cached per thread and the cache is
+/// validated with a version number changed by any modification of the navigators,
+/// so that the lookup in the map of navigators, done under lock, only happens
+/// after such a modification.
 
 TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 {
-   TTHREAD_TLS(TGeoNavigator*) tnav = 0;
    if (!fMultiThread) return fCurrentNavigator;
-   TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
-   if (nav) return nav;
-   std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) return 0;
-   TGeoNavigatorArray *array = it->second;
-   nav = array->GetCurrentNavigator();
-   tnav = nav; // TTHREAD_TLS_SET(TGeoNavigator*,tnav,nav);
+   TTHREAD_TLS(ThreadNavigator_t) tnav = {nullptr, 0, nullptr};
+   UInt_t version = gNavigatorsVersion.load(std::memory_order_acquire);
+   if (tnav.fManager == this && tnav.fVersion == version) return tnav.fNavigator;
+   TGeoNavigatorArray *array = GetListOfNavigators();
+   TGeoNavigator *nav = array ? array->GetCurrentNavigator() : nullptr;
+   tnav.fManager = this;
+   tnav.fVersion = version;
+   tnav.fNavigator = nav;
    return nav;
 }
 
@@ -756,6 +822,8 @@ TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 {
    std::thread::id threadId = std::this_thread::get_id();
+   std::unique_lock<std::mutex> lock(fgMutex, std::defer_lock);
+   if (fMultiThread) lock.lock();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
    if (it == fNavigators.end()) return 0;
    TGeoNavigatorArray *array = it->second;
@@ -768,14 +836,14 @@ TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 Bool_t TGeoManager::SetCurrentNavigator(Int_t index)
 {
    std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) {
+   TGeoNavigatorArray *array = GetListOfNavigators();
+   if (!array) {
       Error("SetCurrentNavigator", "No navigator defined for this thread\n");
       std::cout << "  thread id: " << threadId << std::endl;
       return kFALSE;
    }
-   TGeoNavigatorArray *array = it->second;
    TGeoNavigator *nav = array->SetCurrentNavigator(index);
+   ++gNavigatorsVersion;
    if (!nav) {
       Error("SetCurrentNavigator", "Navigator %d not existing for this thread\n", index);
       std::cout << "  thread id: " << threadId << std::endl;
@@ -799,6 +867,7 @@ void TGeoManager::SetNavigatorsLock(Bool_t flag)
 void TGeoManager::ClearNavigators()
 {
    if (fMultiThread) fgMutex.lock();
+   ++gNavigatorsVersion;
    TGeoNavigatorArray *arr = 0;
    for (NavigatorsMap_t::iterator it = fNavigators.begin();
         it != fNavigators.end(); ++it) {
@@ -815,6 +884,7 @@ void TGeoManager::ClearNavigators()
 void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
 {
    if (fMultiThread) fgMutex.lock();
+   ++gNavigatorsVersion;
    for (NavigatorsMap_t::iterator it = fNavigators.begin(); it != fNavigators.end(); ++it) {
       TGeoNavigatorArray *arr = (*it).second;
       if (arr) {
@@ -895,28 +965,36 @@ void TGeoManager::ClearThreadsMap()
    fgMutex.lock();
    if (!fgThreadId->empty()) fgThreadId->clear();
    fgNumThreads = 0;
+   ++gThreadsMapVersion;
    fgMutex.unlock();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Translates the current thread id to an ordinal number. This can be used to
 /// manage data which is specific for a given thread.
+///
+/// The number is cached per thread, the map of threads is only accessed, under
+/// lock, on the first call of a thread or after ClearThreadsMap().
 
 Int_t TGeoManager::ThreadId()
 {
-   TTHREAD_TLS(Int_t) tid = -1;
-   Int_t ttid = tid; // TTHREAD_TLS_GET(Int_t,tid);
-   if (ttid > -1) return ttid;
+   TTHREAD_TLS(ThreadOrdinal_t) tid = {0, -1};
+   UInt_t version = gThreadsMapVersion.load(std::memory_order_acquire);
+   if (tid.fId > -1 && tid.fVersion == version) return tid.fId;
    if (gGeoManager && !gGeoManager->IsMultiThread()) return 0;
    std::thread::id threadId = std::this_thread::get_id();
+   std::lock_guard<std::mutex> lock(fgMutex);
    TGeoManager::ThreadsMapIt_t it = fgThreadId->find(threadId);
-   if (it != fgThreadId->end()) return it->second;
-   // Map needs to be updated.
-   fgMutex.lock();
-   (*fgThreadId)[threadId] = fgNumThreads;
-   tid = fgNumThreads; // TTHREAD_TLS_SET(Int_t,tid,fgNumThreads);
-   ttid = fgNumThreads++;
-   fgMutex.unlock();
+   Int_t ttid;
+   if (it != fgThreadId->end()) {
+      ttid = it->second;
+   } else {
+      // Map needs to be updated.
+      ttid = fgNumThreads++;
+      (*fgThreadId)[threadId] = ttid;
+   }
+   tid.fVersion = gThreadsMapVersion.load(std::memory_order_acquire);
+   tid.fId = ttid;
    return ttid;
 }
 
@@ -2582,6 +2660,65 @@ TGeoNode *TGeoManager::FindNode(Double_t x, Double_t y, Double_t z)
    return GetCurrentNavigator()->FindNode(x, y, z);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Locates a batch of points given as (x,y,z) triplets in the master frame and fills
+/// nodes[i] with the deepest node containing point i (nullptr when outside the top
+/// volume), e.g. for material or field maps. The points are visited along a Morton
+/// (Z-order) curve, so that each search starts from the location of a close point,
+/// see TGeoNavigator::FindNodes. The state of the current navigator is not changed.
+///
+/// With implicit multi-threading enabled and a multi-threaded geometry (see
+/// SetMaxThreads, which must allow for all the threads of the ROOT thread pool)
+/// consecutive parts of the curve are located in parallel, each thread using its
+/// own navigator.
+
+void TGeoManager::FindNodes(const Double_t *points, TGeoNode **nodes, Int_t npoints)
+{
+   if (npoints <= 0) return;
+   Double_t lo[3], hi[3];
+   for (Int_t j=0; j<3; j++) lo[j] = hi[j] = points[j];
+   for (Int_t i=1; i<npoints; i++) {
+      for (Int_t j=0; j<3; j++) {
+         lo[j] = TMath::Min(lo[j], points[3*i+j]);
+         hi[j] = TMath::Max(hi[j], points[3*i+j]);
+      }
+   }
+   // 21 bits per coordinate, bits interleaved as zyxzyx...
+   const Double_t nbins = (1 << 21) - 1;
+   std::vector<std::pair<ULong64_t, Int_t>> keys(npoints);
+   for (Int_t i=0; i<npoints; i++) {
+      ULong64_t key = 0;
+      for (Int_t j=0; j<3; j++) {
+         Double_t range = hi[j] - lo[j];
+         ULong64_t bin = (range > 0) ? (ULong64_t)(nbins * (points[3*i+j] - lo[j]) / range) : 0;
+         for (Int_t b=0; b<21; b++) key |= ((bin >> b) & 1ULL) << (3*b + j);
+      }
+      keys[i] = std::make_pair(key, i);
+   }
+   std::sort(keys.begin(), keys.end());
+   std::vector<Int_t> order(npoints);
+   for (Int_t i=0; i<npoints; i++) order[i] = keys[i].second;
+
+#ifdef R__USE_IMT
+   const Int_t chunk = 4096;
+   if (fMultiThread && ROOT::IsImplicitMTEnabled() && npoints > chunk &&
+       (Int_t)ROOT::GetThreadPoolSize() < GetMaxThreads()) {
+      const Int_t nchunks = (npoints + chunk - 1) / chunk;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Int_t ichunk) {
+         TGeoNavigator *tnav = GetCurrentNavigator();
+         if (!tnav) tnav = AddNavigator();
+         Int_t first = ichunk * chunk;
+         tnav->FindNodes(points, nodes, TMath::Min(chunk, npoints - first), &order[first]);
+      }, ROOT::TSeqI(nchunks));
+      return;
+   }
+#endif
+   TGeoNavigator *nav = GetCurrentNavigator();
+   if (!nav) nav = AddNavigator();
+   nav->FindNodes(points, nodes, npoints, order.data());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes fast normal to next crossed boundary, assuming that the current point
 /// is close enough to the boundary. Works only after calling FindNextBoundary.
@@ -2897,6 +3034,20 @@ void TGeoManager::Voxelize(Option_t *option)
    if (!fStreamVoxels && fgVerboseLevel>0) Info("Voxelize","Voxelizing...");
 //   Int_t nentries = fVolumes->GetSize();
    TIter next(fVolumes);
+#ifdef R__USE_IMT
+   if (!fStreamVoxels && ROOT::IsImplicitMTEnabled()) {
+      std::vector<TGeoVolume *> volumes;
+      while ((vol = (TGeoVolume*)next())) {
+         if (!fIsGeomReading) vol->SortNodes();
+         volumes.push_back(vol);
+      }
+      VoxelizeVolumes(volumes, option, kFALSE);
+      if (!fIsGeomReading) {
+         for (auto v : volumes) v->FindOverlaps();
+      }
+      return;
+   }
+#endif
    while ((vol = (TGeoVolume*)next())) {
       if (!fIsGeomReading) vol->SortNodes();
       if (!fStreamVoxels) {
@@ -3296,6 +3447,37 @@ void TGeoManager::RefreshPhysicalNodes(Bool_t lock)
    if (lock) LockGeometry();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Align a set of physical nodes in one go: pnodes[i] gets the new local matrix
+/// matrices[i] and/or the new shape shapes[i], see TGeoPhysicalNode::Align (any of
+/// the arrays and their entries may be null). Instead of being rebuilt one by one
+/// when navigation reaches them, the voxels of all the volumes affected are rebuilt
+/// at the end, in parallel with implicit multi-threading enabled, then all the
+/// registered physical nodes are refreshed. Returns the number of aligned nodes.
+
+Int_t TGeoManager::AlignPhysicalNodes(Int_t npnodes, TGeoPhysicalNode **pnodes, TGeoMatrix **matrices,
+                                      TGeoShape **shapes)
+{
+   Int_t naligned = 0;
+   for (Int_t i=0; i<npnodes; i++) {
+      if (!pnodes || !pnodes[i]) continue;
+      if (pnodes[i]->Align(matrices ? matrices[i] : nullptr, shapes ? shapes[i] : nullptr)) naligned++;
+   }
+   if (!naligned) return 0;
+   std::vector<TGeoVolume *> volumes;
+   TIter next(fVolumes);
+   TGeoVolume *vol;
+   while ((vol = (TGeoVolume*)next())) {
+      TGeoVoxelFinder *voxels = vol->GetVoxels();
+      if (voxels && voxels->NeedRebuild()) volumes.push_back(vol);
+   }
+   VoxelizeVolumes(volumes, "", kTRUE);
+   for (auto v : volumes) v->FindOverlaps();
+   RefreshPhysicalNodes(kFALSE);
+   CdTop();
+   return naligned;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Clear the current list of physical nodes, so that we can start over with a new list.
 /// If MUSTDELETE is true, delete previous nodes.
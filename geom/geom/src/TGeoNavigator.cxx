@@ -34,6 +34,7 @@ gGeoManager->SetCurrentNavigator(0);
 #include "TGeoNavigator.h"
 
 #include "TGeoManager.h"
+#include "TGeoBBox.h"
 #include "TGeoMatrix.h"
 #include "TGeoNode.h"
 #include "TGeoVolume.h"
@@ -43,6 +44,8 @@ gGeoManager->SetCurrentNavigator(0);
 #include "TGeoParallelWorld.h"
 #include "TGeoPhysicalNode.h"
 
+#include <vector>
+
 static Double_t gTolerance = TGeoShape::Tolerance();
 const char *kGeoOutsidePath = " ";
 const Int_t kN3 = 3*sizeof(Double_t);
@@ -1114,6 +1117,97 @@ TGeoNode *TGeoNavigator::FindNextDaughterBoundary(Double_t *point, Double_t *dir
    return nodefound;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the distances to the next boundary for a basket of tracks located inside
+/// the volume VOL (the current volume if null), without changing the navigator state.
+///
+/// Input: points and directions in the local frame of VOL (3*vecsize values each) and
+/// the maximum steps. Output: STEPS contains the distance to the next boundary, or the
+/// unchanged step if no boundary is found within it, and IDAUGHTER the index of the crossed
+/// daughter of VOL, or -1 if none is crossed (exiting VOL or step limited).
+///
+/// The daughters are processed one after another for all the tracks: each track is first
+/// checked against the bounding box of the daughter, then the distance to the daughter shape
+/// is computed only for the tracks which can reach it, with the vector methods of the shapes
+/// (DistFromInside_v, DistFromOutside_v). The voxel structure is not used, the method is
+/// intended for baskets of tracks in volumes with a moderate number of daughters. The method
+/// is const and can be used concurrently from several threads.
+
+void TGeoNavigator::FindNextBoundary_v(TGeoVolume *vol, const Double_t *points, const Double_t *dirs, Double_t *steps,
+                                       Int_t *idaughter, Int_t vecsize) const
+{
+   if (vecsize <= 0) return;
+   if (!vol) vol = fCurrentNode->GetVolume();
+   std::vector<Double_t> dists(vecsize);
+   std::vector<Double_t> stepmax(steps, steps + vecsize);
+   // distance to exit the volume
+   vol->GetShape()->DistFromInside_v(points, dirs, dists.data(), vecsize, stepmax.data());
+   for (Int_t i=0; i<vecsize; i++) {
+      idaughter[i] = -1;
+      if (dists[i] < steps[i]) steps[i] = dists[i];
+   }
+   Int_t nd = vol->GetNdaughters();
+   if (!nd) return;
+   if (fGeometry->IsActivityEnabled() && !vol->IsActiveDaughters()) return;
+
+   std::vector<Double_t> lpoints(3*vecsize), ldirs(3*vecsize);
+   std::vector<Double_t> cpoints(3*vecsize), cdirs(3*vecsize);
+   std::vector<Int_t> candidates(vecsize);
+   for (Int_t id=0; id<nd; id++) {
+      TGeoNode *node = vol->GetNode(id);
+      TGeoVolume *dvol = node->GetVolume();
+      if (fGeometry->IsActivityEnabled() && !dvol->IsActive()) continue;
+      // transform the basket in the daughter frame
+      TGeoMatrix *mat = node->GetMatrix();
+      if (mat->IsScale()) {
+         for (Int_t i=0; i<vecsize; i++) {
+            mat->MasterToLocal(&points[3*i], &lpoints[3*i]);
+            mat->MasterToLocalVect(&dirs[3*i], &ldirs[3*i]);
+         }
+      } else {
+         const Double_t *tr = mat->GetTranslation();
+         const Double_t *rot = mat->GetRotationMatrix();
+         for (Int_t i=0; i<vecsize; i++) {
+            const Double_t mt0 = points[3*i]-tr[0], mt1 = points[3*i+1]-tr[1], mt2 = points[3*i+2]-tr[2];
+            const Double_t *d = &dirs[3*i];
+            lpoints[3*i]   = mt0*rot[0] + mt1*rot[3] + mt2*rot[6];
+            lpoints[3*i+1] = mt0*rot[1] + mt1*rot[4] + mt2*rot[7];
+            lpoints[3*i+2] = mt0*rot[2] + mt1*rot[5] + mt2*rot[8];
+            ldirs[3*i]     = d[0]*rot[0] + d[1]*rot[3] + d[2]*rot[6];
+            ldirs[3*i+1]   = d[0]*rot[1] + d[1]*rot[4] + d[2]*rot[7];
+            ldirs[3*i+2]   = d[0]*rot[2] + d[1]*rot[5] + d[2]*rot[8];
+         }
+      }
+      // keep only the tracks crossing the bounding box within their current step
+      TGeoShape *shape = dvol->GetShape();
+      const TGeoBBox *box = (const TGeoBBox*)shape;
+      TGeoBBox::DistFromOutside_v(lpoints.data(), ldirs.data(), box->GetDX(), box->GetDY(), box->GetDZ(),
+                                  box->GetOrigin(), steps, dists.data(), vecsize);
+      Int_t ncand = 0;
+      for (Int_t i=0; i<vecsize; i++) {
+         if (dists[i] >= steps[i]) continue;
+         if (node->IsOverlapping()) {
+            // same as in FindNextDaughterBoundary: ignore overlapping nodes the point is well inside
+            const Double_t *lpoint = &lpoints[3*i];
+            if (dvol->Contains(lpoint) && shape->Safety(lpoint, kTRUE) > gTolerance) continue;
+         }
+         memcpy(&cpoints[3*ncand], &lpoints[3*i], kN3);
+         memcpy(&cdirs[3*ncand], &ldirs[3*i], kN3);
+         stepmax[ncand] = steps[i];
+         candidates[ncand++] = i;
+      }
+      if (!ncand) continue;
+      shape->DistFromOutside_v(cpoints.data(), cdirs.data(), dists.data(), ncand, stepmax.data());
+      for (Int_t ic=0; ic<ncand; ic++) {
+         Int_t i = candidates[ic];
+         if (dists[ic] < steps[i]-gTolerance) {
+            steps[i] = dists[ic];
+            idaughter[i] = id;
+         }
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance to next boundary within STEPMAX. If no boundary is found,
 /// propagate current point along current direction with fStep=STEPMAX. Otherwise
@@ -1519,6 +1613,30 @@ TGeoNode *TGeoNavigator::FindNode(Double_t x, Double_t y, Double_t z)
    return found;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Locates a batch of points given as (x,y,z) triplets in the master frame and fills
+/// nodes[i] with the deepest node containing point i (nullptr when outside the top
+/// volume). The search for each point starts from the location of the previous one,
+/// therefore visiting close points one after the other, in the order given by the
+/// npoints indices of order (0 to npoints-1 when null), avoids most of the descent
+/// from the top volume. The current point and path are restored at the end.
+
+void TGeoNavigator::FindNodes(const Double_t *points, TGeoNode **nodes, Int_t npoints, const Int_t *order)
+{
+   if (npoints <= 0) return;
+   Bool_t outside = fIsOutside;
+   Bool_t samelocation = fIsSameLocation;
+   PushPoint();
+   for (Int_t i=0; i<npoints; i++) {
+      Int_t ipoint = order ? order[i] : i;
+      const Double_t *point = &points[3*ipoint];
+      nodes[ipoint] = FindNode(point[0], point[1], point[2]);
+   }
+   PopPoint();
+   fIsOutside = outside;
+   fIsSameLocation = samelocation;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes fast normal to next crossed boundary, assuming that the current point
 /// is close enough to the boundary. Works only after calling FindNextBoundary.
@@ -1543,7 +1543,11 @@ void TGeoPcon::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 
 void TGeoPcon::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoPcon::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   for (Int_t i=0; i<vecsize; i++) dists[i] = TGeoPcon::DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1551,7 +1555,16 @@ void TGeoPcon::DistFromInside_v(const Double_t *points, const Double_t *dirs, Do
 
 void TGeoPcon::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoPcon::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   // check in one pass which points cross the bounding box within the requested distance
+   TGeoBBox::DistFromOutside_v(points, dirs, fDX, fDY, fDZ, fOrigin, step, dists, vecsize);
+   for (Int_t i=0; i<vecsize; i++) {
+      if (dists[i] >= step[i]) dists[i] = TGeoShape::Big();
+      else                     dists[i] = TGeoPcon::DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -437,10 +437,34 @@ void TGeoPhysicalNode::Print(Option_t * /*option*/) const
 ////////////////////////////////////////////////////////////////////////////////
 /// Refresh this physical node. Called for all registered physical nodes
 /// after an Align() call.
+///
+/// The stored branch is followed from the top node: nodes replaced in their mother
+/// by an alignment are looked up by name, and the global matrices are recomputed as
+/// the navigator does, so that the path string does not have to be parsed again.
 
 void TGeoPhysicalNode::Refresh()
 {
-   SetPath(fName.Data());
+   if (fLevel <= 0 || GetNode(0) != gGeoManager->GetTopNode()) {
+      SetPath(fName.Data());
+      return;
+   }
+   TGeoVolume *vm = GetVolume(0);
+   for (Int_t i=1; i<=fLevel; i++) {
+      TGeoNode *node = GetNode(i);
+      if (vm->GetIndex(node) < 0) {
+         node = vm->GetNode(node->GetName());
+         if (!node) {
+            SetPath(fName.Data());
+            return;
+         }
+         fNodes->AddAt(node, i);
+      }
+      TGeoHMatrix *global = GetMatrix(i);
+      const TGeoMatrix *local = node->GetMatrix();
+      global->CopyFrom(GetMatrix(i-1));
+      if (!local->IsIdentity()) global->Multiply(local);
+      vm = node->GetVolume();
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -14,8 +14,13 @@
 \ingroup Geometry_classes
 
 Tessellated solid class. It is composed by a set of planar faces having triangular or
-quadrilateral shape. The class does not provide navigation functionality, it just wraps the data
-for the composing faces.
+quadrilateral shape.
+
+Navigation is available once the shape is closed (CloseShape()) or read from a file: the facets
+are split in triangles, organized in a bounding volume hierarchy (BVH), so that the distance and
+containment queries only test the triangles close to the point or to the ray. The orientation of
+the facets is taken from the first one (see CheckClosure()), the normals are made to point outside
+according to the sign of the enclosed volume. Contains() assumes a closed body.
 */
 
 #include <iostream>
@@ -30,6 +35,7 @@ for the composing faces.
 #include "TBuffer3DTypes.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <array>
 #include <vector>
 
@@ -208,9 +214,10 @@ TGeoTessellated::TGeoTessellated(const char *name, const std::vector<Vertex_t> &
 void TGeoTessellated::AfterStreamer()
 {
    // The pointer to the array of vertices is not streamed so update it to facets
-   for (auto facet : fFacets)
+   for (auto &facet : fFacets)
       facet.SetVertices(&fVertices);
    fDefined = true;
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -332,14 +339,14 @@ void TGeoTessellated::CloseShape(bool check, bool fixFlipped, bool verbose)
 
    if (fVertices.size() > 0) {
       fDefined = true;
-      if (!check)
-         return;
-
-      // Check facets
-      for (auto &facet : fFacets) {
-         facet.Check();
+      if (check) {
+         // Check facets
+         for (auto &facet : fFacets) {
+            facet.Check();
+         }
+         fClosedBody = CheckClosure(fixFlipped, verbose);
       }
-      fClosedBody = CheckClosure(fixFlipped, verbose);
+      BuildBVH();
       return;
    }
 
@@ -411,15 +418,15 @@ void TGeoTessellated::CloseShape(bool check, bool fixFlipped, bool verbose)
    fNvert = fVertices.size();
    fNfacets = fFacets.size();
    fDefined = true;
-   if (!check)
-      return;
+   if (check) {
+      // Check facets
+      for (auto &facet : fFacets) {
+         facet.Check();
+      }
 
-   // Check facets
-   for (auto &facet : fFacets) {
-      facet.Check();
+      fClosedBody = CheckClosure(fixFlipped, verbose);
    }
-
-   fClosedBody = CheckClosure(fixFlipped, verbose);
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -511,6 +518,384 @@ void TGeoTessellated::ComputeBBox()
       fOrigin[i] = 0.5 * (vmax[i] + vmin[i]);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Split the facets in triangles and build the bounding volume hierarchy used by
+/// the navigation methods. Called when the shape is closed or read from file.
+
+void TGeoTessellated::BuildBVH()
+{
+   constexpr int kMaxLeafSize = 4;
+   fTriangles.clear();
+   fBVH.clear();
+
+   // Split facets in triangles, orient the normals outside using the sign of the volume
+   double volume = 0.;
+   for (const auto &facet : fFacets) {
+      for (int i = 1; i < facet.GetNvert() - 1; ++i) {
+         Triangle_t tri;
+         tri.fV0 = facet.GetVertex(0);
+         tri.fE1 = facet.GetVertex(i) - tri.fV0;
+         tri.fE2 = facet.GetVertex(i + 1) - tri.fV0;
+         tri.fNormal = Vertex_t::Cross(tri.fE1, tri.fE2);
+         if (tri.fNormal.Mag2() < 1.e-40)
+            continue; // degenerated
+         volume += tri.fV0.Dot(tri.fNormal);
+         tri.fNormal.Normalize();
+         fTriangles.push_back(tri);
+      }
+   }
+   if (volume < 0) {
+      for (auto &tri : fTriangles)
+         tri.fNormal *= -1.;
+   }
+   int ntri = fTriangles.size();
+   if (!ntri)
+      return;
+
+   std::vector<Vertex_t> centers(ntri);
+   std::vector<int> order(ntri);
+   for (int i = 0; i < ntri; ++i) {
+      const auto &tri = fTriangles[i];
+      centers[i] = tri.fV0 + (tri.fE1 + tri.fE2) * (1. / 3.);
+      order[i] = i;
+   }
+
+   // Top-down build, splitting each node at the median of its longest extent
+   auto makeNode = [&](int first, int count) {
+      BVHNode_t node;
+      const double tol = TGeoShape::Tolerance();
+      for (int j = 0; j < 3; ++j) {
+         node.fMin[j] = TGeoShape::Big();
+         node.fMax[j] = -TGeoShape::Big();
+      }
+      for (int i = first; i < first + count; ++i) {
+         const auto &tri = fTriangles[order[i]];
+         for (const auto &v : {tri.fV0, tri.fV0 + tri.fE1, tri.fV0 + tri.fE2}) {
+            for (int j = 0; j < 3; ++j) {
+               node.fMin[j] = TMath::Min(node.fMin[j], v[j] - tol);
+               node.fMax[j] = TMath::Max(node.fMax[j], v[j] + tol);
+            }
+         }
+      }
+      node.fFirst = first;
+      node.fCount = count;
+      return node;
+   };
+
+   fBVH.reserve(2 * ntri / kMaxLeafSize + 1);
+   fBVH.push_back(makeNode(0, ntri));
+   std::vector<int> stack{0};
+   while (!stack.empty()) {
+      int inode = stack.back();
+      stack.pop_back();
+      int first = fBVH[inode].fFirst;
+      int count = fBVH[inode].fCount;
+      if (count <= kMaxLeafSize)
+         continue;
+      int axis = 0;
+      double extent = 0.;
+      for (int j = 0; j < 3; ++j) {
+         if (fBVH[inode].fMax[j] - fBVH[inode].fMin[j] > extent) {
+            extent = fBVH[inode].fMax[j] - fBVH[inode].fMin[j];
+            axis = j;
+         }
+      }
+      int half = count / 2;
+      std::nth_element(order.begin() + first, order.begin() + first + half, order.begin() + first + count,
+                       [&](int a, int b) { return centers[a][axis] < centers[b][axis]; });
+      int ichild = fBVH.size();
+      fBVH.push_back(makeNode(first, half));
+      fBVH.push_back(makeNode(first + half, count - half));
+      fBVH[inode].fFirst = ichild;
+      fBVH[inode].fCount = 0;
+      stack.push_back(ichild);
+      stack.push_back(ichild + 1);
+   }
+
+   // Store the triangles in the order of the leaves
+   std::vector<Triangle_t> sorted(ntri);
+   for (int i = 0; i < ntri; ++i)
+      sorted[i] = fTriangles[order[i]];
+   fTriangles.swap(sorted);
+}
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along the ray to the entry in the box, Big() if the box is missed within stepmax
+
+double DistToBox(const double *bmin, const double *bmax, const double *point, const double *dir, double stepmax)
+{
+   double tmin = 0.;
+   double tmax = stepmax;
+   for (int j = 0; j < 3; ++j) {
+      if (dir[j] == 0.) {
+         if (point[j] < bmin[j] || point[j] > bmax[j])
+            return TGeoShape::Big();
+         continue;
+      }
+      double inv = 1. / dir[j];
+      double t1 = (bmin[j] - point[j]) * inv;
+      double t2 = (bmax[j] - point[j]) * inv;
+      if (t1 > t2)
+         std::swap(t1, t2);
+      tmin = TMath::Max(tmin, t1);
+      tmax = TMath::Min(tmax, t2);
+      if (tmin > tmax)
+         return TGeoShape::Big();
+   }
+   return tmin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from point to the box, 0 if inside
+
+double SafetyToBox2(const double *bmin, const double *bmax, const double *point)
+{
+   double d2 = 0.;
+   for (int j = 0; j < 3; ++j) {
+      double d = TMath::Max(TMath::Max(bmin[j] - point[j], point[j] - bmax[j]), 0.);
+      d2 += d * d;
+   }
+   return d2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Closest point to p on the triangle (a, a+ab, a+ac), see C. Ericson, Real-Time Collision Detection
+
+Vertex_t ClosestOnTriangle(const Vertex_t &p, const Vertex_t &a, const Vertex_t &ab, const Vertex_t &ac)
+{
+   Vertex_t ap = p - a;
+   double d1 = ab.Dot(ap), d2 = ac.Dot(ap);
+   if (d1 <= 0. && d2 <= 0.)
+      return a;
+   Vertex_t bp = ap - ab;
+   double d3 = ab.Dot(bp), d4 = ac.Dot(bp);
+   if (d3 >= 0. && d4 <= d3)
+      return a + ab;
+   double vc = d1 * d4 - d3 * d2;
+   if (vc <= 0. && d1 >= 0. && d3 <= 0.)
+      return a + ab * (d1 / (d1 - d3));
+   Vertex_t cp = ap - ac;
+   double d5 = ab.Dot(cp), d6 = ac.Dot(cp);
+   if (d6 >= 0. && d5 <= d6)
+      return a + ac;
+   double vb = d5 * d2 - d1 * d6;
+   if (vb <= 0. && d2 >= 0. && d6 <= 0.)
+      return a + ac * (d2 / (d2 - d6));
+   double va = d3 * d6 - d5 * d4;
+   if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.)
+      return a + ab + (ac - ab) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+   double denom = 1. / (va + vb + vc);
+   return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance from point along dir to the closest triangle crossed within stepmax.
+/// Only triangles crossed outwards (sense>0), inwards (sense<0) or both (sense=0) are considered.
+/// Returns Big() if no triangle is crossed, the index of the crossed triangle is stored in itri.
+
+double TGeoTessellated::DistToTriangles(const double *point, const double *dir, int sense, double stepmax,
+                                        int *itri) const
+{
+   constexpr double kEpsilon = 1.e-10; // barycentric tolerance, avoids leaks between triangles
+   const double tol = TGeoShape::Tolerance();
+   double snext = TGeoShape::Big();
+   int ifound = -1;
+   if (fBVH.empty())
+      return snext;
+   Vertex_t pt(point[0], point[1], point[2]);
+   Vertex_t vdir(dir[0], dir[1], dir[2]);
+   double smax = TMath::Min(stepmax, TGeoShape::Big());
+
+   int stack[64];
+   int nstack = 0;
+   if (DistToBox(fBVH[0].fMin, fBVH[0].fMax, point, dir, smax) < smax)
+      stack[nstack++] = 0;
+   while (nstack) {
+      const auto &node = fBVH[stack[--nstack]];
+      if (node.fCount == 0) {
+         // visit the closest child first
+         double d1 = DistToBox(fBVH[node.fFirst].fMin, fBVH[node.fFirst].fMax, point, dir, snext);
+         double d2 = DistToBox(fBVH[node.fFirst + 1].fMin, fBVH[node.fFirst + 1].fMax, point, dir, snext);
+         int first = (d1 <= d2) ? node.fFirst : node.fFirst + 1;
+         double dfirst = TMath::Min(d1, d2);
+         double dsecond = TMath::Max(d1, d2);
+         if (dsecond < snext && nstack < 63)
+            stack[nstack++] = (first == node.fFirst) ? node.fFirst + 1 : node.fFirst;
+         if (dfirst < snext && nstack < 63)
+            stack[nstack++] = first;
+         continue;
+      }
+      for (int i = node.fFirst; i < node.fFirst + node.fCount; ++i) {
+         const auto &tri = fTriangles[i];
+         double dn = vdir.Dot(tri.fNormal);
+         if ((sense > 0 && dn <= 0.) || (sense < 0 && dn >= 0.))
+            continue;
+         // Moller-Trumbore ray-triangle intersection
+         Vertex_t p = Vertex_t::Cross(vdir, tri.fE2);
+         double det = tri.fE1.Dot(p);
+         if (TMath::Abs(det) < 1.e-30)
+            continue;
+         double inv = 1. / det;
+         Vertex_t s = pt - tri.fV0;
+         double u = s.Dot(p) * inv;
+         if (u < -kEpsilon || u > 1. + kEpsilon)
+            continue;
+         Vertex_t q = Vertex_t::Cross(s, tri.fE1);
+         double v = vdir.Dot(q) * inv;
+         if (v < -kEpsilon || u + v > 1. + kEpsilon)
+            continue;
+         double t = tri.fE2.Dot(q) * inv;
+         if (t < -tol)
+            continue;
+         t = TMath::Max(t, 0.);
+         if (t < snext) {
+            snext = t;
+            ifound = i;
+         }
+      }
+   }
+   if (itri)
+      *itri = ifound;
+   return (snext < smax) ? snext : TGeoShape::Big();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance from point to the closest triangle, the index of which is stored in itri.
+
+double TGeoTessellated::SafetyToTriangles(const double *point, int *itri) const
+{
+   double safe2 = TGeoShape::Big();
+   int ifound = -1;
+   if (fBVH.empty())
+      return TGeoShape::Big();
+   Vertex_t pt(point[0], point[1], point[2]);
+
+   int stack[64];
+   int nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack) {
+      const auto &node = fBVH[stack[--nstack]];
+      if (SafetyToBox2(node.fMin, node.fMax, point) >= safe2)
+         continue;
+      if (node.fCount == 0) {
+         double d1 = SafetyToBox2(fBVH[node.fFirst].fMin, fBVH[node.fFirst].fMax, point);
+         double d2 = SafetyToBox2(fBVH[node.fFirst + 1].fMin, fBVH[node.fFirst + 1].fMax, point);
+         // visit the closest child first
+         if (nstack < 62) {
+            stack[nstack++] = (d1 <= d2) ? node.fFirst + 1 : node.fFirst;
+            stack[nstack++] = (d1 <= d2) ? node.fFirst : node.fFirst + 1;
+         }
+         continue;
+      }
+      for (int i = node.fFirst; i < node.fFirst + node.fCount; ++i) {
+         const auto &tri = fTriangles[i];
+         double d2 = (ClosestOnTriangle(pt, tri.fV0, tri.fE1, tri.fE2) - pt).Mag2();
+         if (d2 < safe2) {
+            safe2 = d2;
+            ifound = i;
+         }
+      }
+   }
+   if (itri)
+      *itri = ifound;
+   return TMath::Sqrt(safe2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute normal to the closest facet, oriented so that norm.dot.dir is positive
+
+void TGeoTessellated::ComputeNormal(const double *point, const double *dir, double *norm)
+{
+   int itri = -1;
+   SafetyToTriangles(point, &itri);
+   if (itri < 0) {
+      TGeoBBox::ComputeNormal(point, dir, norm);
+      return;
+   }
+   const auto &normal = fTriangles[itri].fNormal;
+   double sign = (normal[0] * dir[0] + normal[1] * dir[1] + normal[2] * dir[2] < 0) ? -1. : 1.;
+   for (int i = 0; i < 3; ++i)
+      norm[i] = sign * normal[i];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check if the point is inside the tessellated solid, assumed to be a closed body.
+/// A ray is shot from the point: the point is inside if the first crossed facet is exiting.
+
+bool TGeoTessellated::Contains(const double *point) const
+{
+   if (fBVH.empty())
+      return TGeoBBox::Contains(point);
+   if (!TGeoBBox::Contains(point, fDX, fDY, fDZ, fOrigin))
+      return false;
+   // direction not aligned with the axes, to avoid crossing the facets at their edges in regular meshes
+   static const double kDir[3] = {0.26726124191242440, 0.53452248382484879, 0.80178372573727319};
+   int itri = -1;
+   DistToTriangles(point, kDir, 0, TGeoShape::Big(), &itri);
+   if (itri < 0)
+      return false;
+   const auto &normal = fTriangles[itri].fNormal;
+   return (normal[0] * kDir[0] + normal[1] * kDir[1] + normal[2] * kDir[2]) > 0.;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from inside point to the exiting facets
+
+double TGeoTessellated::DistFromInside(const double *point, const double *dir, int iact, double step,
+                                       double *safe) const
+{
+   if (fBVH.empty())
+      return TGeoBBox::DistFromInside(point, dir, iact, step, safe);
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kTRUE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   double snext = DistToTriangles(point, dir, 1, TGeoShape::Big());
+   // no exiting facet: the point is actually outside or on the boundary
+   if (snext >= TGeoShape::Big())
+      return 0.;
+   return snext;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from outside point to the entering facets
+
+double TGeoTessellated::DistFromOutside(const double *point, const double *dir, int iact, double step,
+                                        double *safe) const
+{
+   if (fBVH.empty())
+      return TGeoBBox::DistFromOutside(point, dir, iact, step, safe);
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kFALSE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   // Check if the bounding box is crossed within the requested distance
+   double sdist = TGeoBBox::DistFromOutside(point, dir, fDX, fDY, fDZ, fOrigin, step);
+   if (sdist >= step)
+      return TGeoShape::Big();
+   return DistToTriangles(point, dir, -1, step);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Safe distance from the point to the closest facet
+
+double TGeoTessellated::Safety(const double *point, bool in) const
+{
+   if (fBVH.empty())
+      return TGeoBBox::Safety(point, in);
+   return SafetyToTriangles(point);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns numbers of vertices, segments and polygons composing the shape mesh.
 
@@ -622,6 +1007,7 @@ void TGeoTessellated::ResizeCenter(double maxsize)
    fDX *= scale;
    fDY *= scale;
    fDZ *= scale;
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -756,7 +756,11 @@ void TGeoTrd1::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 
 void TGeoTrd1::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoTrd1::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   for (Int_t i=0; i<vecsize; i++) dists[i] = TGeoTrd1::DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -764,7 +768,11 @@ void TGeoTrd1::DistFromInside_v(const Double_t *points, const Double_t *dirs, Do
 
 void TGeoTrd1::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoTrd1::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   for (Int_t i=0; i<vecsize; i++) dists[i] = TGeoTrd1::DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -785,7 +785,11 @@ void TGeoTrd2::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 
 void TGeoTrd2::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoTrd2::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   for (Int_t i=0; i<vecsize; i++) dists[i] = TGeoTrd2::DistFromInside(&points[3*i], &dirs[3*i], 3, step[i]);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -793,7 +797,11 @@ void TGeoTrd2::DistFromInside_v(const Double_t *points, const Double_t *dirs, Do
 
 void TGeoTrd2::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize, Double_t* step) const
 {
-   for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+   if (IsA() != TGeoTrd2::Class()) {
+      for (Int_t i=0; i<vecsize; i++) dists[i] = DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
+      return;
+   }
+   for (Int_t i=0; i<vecsize; i++) dists[i] = TGeoTrd2::DistFromOutside(&points[3*i], &dirs[3*i], 3, step[i]);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
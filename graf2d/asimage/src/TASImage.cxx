@@ -79,6 +79,7 @@ ROOT tutorials: `$ROOTSYS/tutorials/image/`
 #include "TPoint.h"
 #include "TFrame.h"
 #include "TTF.h"
+#include "TVirtualMutex.h"
 #include "TRandom.h"
 #include <iostream>
 #include "THashTable.h"
@@ -496,13 +497,17 @@ void TASImage::ReadImage(const char *filename, EImageFileTypes /*type*/)
       return;
    }
 
-   if (!gIconPaths[0]) {
-      init_icon_paths();
+   {
+      R__LOCKGUARD(gROOTMutex);
+      if (!gIconPaths[0]) {
+         init_icon_paths();
+      }
    }
    // suppress the "root : looking for image ..." messages
    set_output_threshold(0);
 
-   static ASImageImportParams iparams;
+   ASImageImportParams iparams;
+   memset(&iparams, 0, sizeof(iparams));
    iparams.flags = 0;
    iparams.width = 0;
    iparams.height = 0;
@@ -686,9 +691,9 @@ void TASImage::WriteImage(const char *file, EImageFileTypes type)
    EImageQuality quality = GetImageQuality();
    MapQuality(quality, aquality);
 
-   static TString fname;
-   fname = file;
-   static ASImageExportParams parms;
+   TString fname = file;
+   ASImageExportParams parms;
+   memset(&parms, 0, sizeof(parms));
    ASImage *im = fScaledImage ? fScaledImage->fImage : fImage;
 
    switch (type) {
@@ -2198,6 +2203,8 @@ void TASImage::GetZoomPosition(UInt_t &x, UInt_t &y, UInt_t &w, UInt_t &h) const
 
 Bool_t TASImage::InitVisual()
 {
+   R__LOCKGUARD(gROOTMutex);
+
    Bool_t inbatch = fgVisual && (fgVisual->dpy == (void*)1); // was in batch
    Bool_t noX = gROOT->IsBatch() || gVirtualX->InheritsFrom("TGWin32");
 
@@ -5826,6 +5833,9 @@ void TASImage::DrawText(TText *text, Int_t x, Int_t y)
       BeginPaint();
    }
 
+   // TTF keeps the font, size and glyphs of the current string in static data
+   R__LOCKGUARD(gROOTMutex);
+
    if (!TTF::IsInitialized()) TTF::Init();
 
    // set text font
@@ -5957,6 +5967,8 @@ void TASImage::DrawText(TText *text, Int_t x, Int_t y)
 void TASImage::DrawTextTTF(Int_t x, Int_t y, const char *text, Int_t size,
                            UInt_t color, const char *font_name, Float_t angle)
 {
+   R__LOCKGUARD(gROOTMutex);
+
    if (!TTF::IsInitialized()) TTF::Init();
 
    TTF::SetTextFont(font_name);
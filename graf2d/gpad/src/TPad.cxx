@@ -4170,11 +4170,11 @@ void TPad::PaintLine(Double_t x1, Double_t y1, Double_t x2, Double_t y2)
 
 void TPad::PaintLineNDC(Double_t u1, Double_t v1,Double_t u2, Double_t v2)
 {
-   static Double_t xw[2], yw[2];
    if (!gPad->IsBatch() && GetPainter())
       GetPainter()->DrawLineNDC(u1, v1, u2, v2);
 
    if (gVirtualPS) {
+      Double_t xw[2], yw[2];
       xw[0] = fX1 + u1*(fX2 - fX1);
       xw[1] = fX1 + u2*(fX2 - fX1);
       yw[0] = fY1 + v1*(fY2 - fY1);
@@ -4939,7 +4939,10 @@ void TPad::Print(const char *filename, Option_t *option)
 
    //==============Save pad/canvas as a SVG file================================
    if (strstr(opt,"svg")) {
-      gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+      {
+         R__LOCKGUARD(gROOTMutex);
+         gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+      }
 
       Bool_t noScreen = kFALSE;
       if (!GetCanvas()->IsBatch() && GetCanvas()->GetCanvasID() == -1) {
@@ -4981,7 +4984,10 @@ void TPad::Print(const char *filename, Option_t *option)
 
    //==============Save pad/canvas as a TeX file================================
    if (strstr(opt,"tex") || strstr(opt,"Standalone")) {
-      gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+      {
+         R__LOCKGUARD(gROOTMutex);
+         gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+      }
 
       Bool_t noScreen = kFALSE;
       if (!GetCanvas()->IsBatch() && GetCanvas()->GetCanvasID() == -1) {
@@ -5046,7 +5052,10 @@ void TPad::Print(const char *filename, Option_t *option)
       copenb  = psname.EndsWith("["); if (copenb)  psname[psname.Length()-1] = 0;
       ccloseb = psname.EndsWith("]"); if (ccloseb) psname[psname.Length()-1] = 0;
    }
-   gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+   {
+      R__LOCKGUARD(gROOTMutex);
+      gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+   }
    if (gVirtualPS) {mustOpen = kFALSE; mustClose = kFALSE;}
    if (copen  || copenb)  mustClose = kFALSE;
    if (cclose || ccloseb) mustClose = kTRUE;
@@ -5108,11 +5117,17 @@ void TPad::Print(const char *filename, Option_t *option)
       if (noScreen) GetCanvas()->SetBatch(kFALSE);
 
       if (mustClose) {
-         gROOT->GetListOfSpecials()->Remove(gVirtualPS);
+         {
+            R__LOCKGUARD(gROOTMutex);
+            gROOT->GetListOfSpecials()->Remove(gVirtualPS);
+         }
          delete gVirtualPS;
          gVirtualPS = psave;
       } else {
-         gROOT->GetListOfSpecials()->Add(gVirtualPS);
+         {
+            R__LOCKGUARD(gROOTMutex);
+            gROOT->GetListOfSpecials()->Add(gVirtualPS);
+         }
          gVirtualPS = 0;
       }
 
@@ -5136,7 +5151,10 @@ void TPad::Print(const char *filename, Option_t *option)
       if (mustClose) {
          if (cclose) Info("Print", "Current canvas added to %s file %s and file closed", opt.Data(), psname.Data());
          else        Info("Print", "%s file %s has been closed", opt.Data(), psname.Data());
-         gROOT->GetListOfSpecials()->Remove(gVirtualPS);
+         {
+            R__LOCKGUARD(gROOTMutex);
+            gROOT->GetListOfSpecials()->Remove(gVirtualPS);
+         }
          delete gVirtualPS;
          gVirtualPS = nullptr;
       } else {
@@ -15,6 +15,8 @@
 
 #include "TVirtualPS.h"
 
+#include <vector>
+
 class TImage;
 class TColor;
 class TPoint;
@@ -23,6 +25,13 @@ class TImageDump : public TVirtualPS {
 protected:
    TImage           *fImage;     ///< Image
    Int_t             fType;      ///< PostScript workstation type
+   std::vector<UInt_t> fCellArrayColors; ///<! colors of the cell array being filled
+   Int_t             fCellArrayW{0};     ///<! cell array width
+   Int_t             fCellArrayH{0};     ///<! cell array height
+   Int_t             fCellArrayX1{0};    ///<! cell array left edge in pixels
+   Int_t             fCellArrayX2{0};    ///<! cell array right edge in pixels
+   Int_t             fCellArrayY1{0};    ///<! cell array top edge in pixels
+   Int_t             fCellArrayY2{0};    ///<! cell array bottom edge in pixels
 
    Int_t  XtoPixel(Double_t x);
    Int_t  YtoPixel(Double_t y);
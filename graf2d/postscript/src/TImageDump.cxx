@@ -125,7 +125,7 @@ void TImageDump::DrawBox(Double_t x1, Double_t y1, Double_t x2, Double_t  y2)
 
    fImage->BeginPaint();
 
-   static Double_t x[4], y[4];
+   Double_t x[4], y[4];
    Int_t ix1 = x1 < x2 ? XtoPixel(x1) : XtoPixel(x2);
    Int_t ix2 = x1 < x2 ? XtoPixel(x2) : XtoPixel(x1);
    Int_t iy1 = y1 < y2 ? YtoPixel(y1) : YtoPixel(y2);
@@ -292,7 +292,7 @@ void TImageDump::DrawPolyMarker(Int_t n, Double_t *xw, Double_t *yw)
 
    fMarkerStyle = TMath::Abs(fMarkerStyle);
    Int_t ms = TAttMarker::GetMarkerStyleBase(fMarkerStyle);
-   static TPoint pt[20];
+   TPoint pt[20];
 
    if (ms == 4)
       ms = 24;
@@ -656,15 +656,15 @@ void TImageDump::DrawPS(Int_t nn, Double_t *x, Double_t *y)
    fasi = fFillStyle%1000;
 
    Short_t px1, py1, px2, py2;
-   static const UInt_t gCachePtSize = 200;
-   static TPoint gPointCache[gCachePtSize];
+   const UInt_t gCachePtSize = 200;
+   TPoint gPointCache[gCachePtSize];
    Bool_t del = kTRUE;
 
 
    // SetLineStyle
    Int_t ndashes = 0;
    char *dash = 0;
-   static char dashList[10];
+   char dashList[10];
    Int_t dashSize = 0;
 
    if (line) {
@@ -885,17 +885,6 @@ void TImageDump::Text(Double_t x, Double_t y, const wchar_t *chars)
 }
 
 
-////////////////////////// CellArray code ////////////////////////////////////
-static UInt_t *gCellArrayColors = 0;
-static Int_t   gCellArrayN = 0;
-static Int_t   gCellArrayW = 0;
-static Int_t   gCellArrayH = 0;
-static Int_t   gCellArrayX1 = 0;
-static Int_t   gCellArrayX2 = 0;
-static Int_t   gCellArrayY1 = 0;
-static Int_t   gCellArrayY2 = 0;
-static Int_t   gCellArrayIdx = 0;
-
 ////////////////////////////////////////////////////////////////////////////////
 ///cell array begin
 
@@ -906,23 +895,17 @@ void TImageDump::CellArrayBegin(Int_t w, Int_t h, Double_t x1, Double_t x2,
       return;
    }
 
-   if (gCellArrayColors) {
-      delete [] gCellArrayColors;
-   }
-
    fImage->BeginPaint();
 
-   gCellArrayN = w * h;
-   gCellArrayW = w;
-   gCellArrayH = h;
-   gCellArrayColors = new UInt_t[gCellArrayN];
-
-   gCellArrayX1 = x1 < x2 ? XtoPixel(x1) : XtoPixel(x2);
-   gCellArrayX2 = x1 > x2 ? XtoPixel(x2) : XtoPixel(x1);
-   gCellArrayY1 = y1 < y2 ? YtoPixel(y1) : YtoPixel(y2);
-   gCellArrayY2 = y1 < y2 ? YtoPixel(y2) : YtoPixel(y1);
+   fCellArrayW = w;
+   fCellArrayH = h;
+   fCellArrayColors.clear();
+   fCellArrayColors.reserve(w * h);
 
-   gCellArrayIdx = 0;
+   fCellArrayX1 = x1 < x2 ? XtoPixel(x1) : XtoPixel(x2);
+   fCellArrayX2 = x1 > x2 ? XtoPixel(x2) : XtoPixel(x1);
+   fCellArrayY1 = y1 < y2 ? YtoPixel(y1) : YtoPixel(y2);
+   fCellArrayY2 = y1 < y2 ? YtoPixel(y2) : YtoPixel(y1);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -930,12 +913,11 @@ void TImageDump::CellArrayBegin(Int_t w, Int_t h, Double_t x1, Double_t x2,
 
 void TImageDump::CellArrayFill(Int_t r, Int_t g, Int_t b)
 {
-   if (gCellArrayIdx >= gCellArrayN) return;
+   if ((Int_t)fCellArrayColors.size() >= fCellArrayW * fCellArrayH) return;
 
    fImage->BeginPaint();
 
-   gCellArrayColors[gCellArrayIdx] = ((r & 0xFF) << 16) + ((g & 0xFF) << 8) + (b & 0xFF);
-   gCellArrayIdx++;
+   fCellArrayColors.push_back(((r & 0xFF) << 16) + ((g & 0xFF) << 8) + (b & 0xFF));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -943,25 +925,24 @@ void TImageDump::CellArrayFill(Int_t r, Int_t g, Int_t b)
 
 void TImageDump::CellArrayEnd()
 {
-   if (!fImage || !gCellArrayColors || !gCellArrayW || !gCellArrayH) {
+   if (!fImage || !fCellArrayW || !fCellArrayH) {
       return;
    }
 
    fImage->BeginPaint();
 
-   fImage->DrawCellArray(gCellArrayX1, gCellArrayX2, gCellArrayY1, gCellArrayY2,
-                         gCellArrayW, gCellArrayH, gCellArrayColors);
-
-   delete [] gCellArrayColors;
-   gCellArrayColors = 0;
-   gCellArrayN = 0;
-   gCellArrayW = 0;
-   gCellArrayH = 0;
-   gCellArrayX1 = 0;
-   gCellArrayX2 = 0;
-   gCellArrayY1 = 0;
-   gCellArrayY2 = 0;
-   gCellArrayIdx = 0;
+   // cells which were not filled are drawn black
+   fCellArrayColors.resize(fCellArrayW * fCellArrayH, 0);
+   fImage->DrawCellArray(fCellArrayX1, fCellArrayX2, fCellArrayY1, fCellArrayY2,
+                         fCellArrayW, fCellArrayH, fCellArrayColors.data());
+
+   fCellArrayColors.clear();
+   fCellArrayW = 0;
+   fCellArrayH = 0;
+   fCellArrayX1 = 0;
+   fCellArrayX2 = 0;
+   fCellArrayY1 = 0;
+   fCellArrayY2 = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,8 @@
 #include "TGLRnrCtx.h"
 #include "TGLSelectRecord.h"
 
+#include <vector>
+
 /** \class TEveStraightLineSetGL
 \ingroup TEve
 GL-renderer for TEveStraightLineSet class.
@@ -137,14 +139,20 @@ void TEveStraightLineSetGL::DirectDraw(TGLRnrCtx& rnrCtx) const
       }
       else
       {
-         glBegin(GL_LINES);
+         // Copy end-points into one array and draw them with a single call.
+         std::vector<Float_t> verts;
+         verts.reserve(6 * mL.GetLinePlex().Size());
          while (li.next())
          {
             TEveStraightLineSet::Line_t& l = * (TEveStraightLineSet::Line_t*) li();
-            glVertex3f(l.fV1[0], l.fV1[1], l.fV1[2]);
-            glVertex3f(l.fV2[0], l.fV2[1], l.fV2[2]);
+            verts.insert(verts.end(), l.fV1, l.fV1 + 3);
+            verts.insert(verts.end(), l.fV2, l.fV2 + 3);
          }
-         glEnd();
+         glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+         glVertexPointer(3, GL_FLOAT, 0, &verts[0]);
+         glEnableClientState(GL_VERTEX_ARRAY);
+         glDrawArrays(GL_LINES, 0, verts.size() / 3);
+         glPopClientAttrib();
       }
 
       if (changePM)
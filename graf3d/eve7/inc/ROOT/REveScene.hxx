@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 namespace ROOT {
 namespace Experimental {
@@ -77,6 +78,10 @@ protected:
    std::string fOutputJson;               ///<!
    std::vector<char> fOutputBinary;       ///<!
    Int_t fTotalBinarySize;                ///<!
+   Bool_t fOutputIsFullStream{kFALSE};    ///<! output buffers hold full stream of unchanged scene
+
+   // Hash of core json and render data last sent for an element, unchanged elements are not sent again.
+   std::unordered_map<ElementId_t, std::size_t> fSentHashes; ///<!
 
    std::vector<SceneCommand> fCommands;   ///<!
 
@@ -18,6 +18,7 @@
 #include <ROOT/RWebWindow.hxx>
 
 #include <cassert>
+#include <functional>
 
 #include <nlohmann/json.hpp>
 
@@ -77,6 +78,12 @@ void REveScene::RemoveSubscriber(unsigned id)
    };
 
    fSubscribers.erase(std::remove_if(fSubscribers.begin(), fSubscribers.end(), pred), fSubscribers.end());
+
+   // Without subscribers changes are not recorded, streamed data can not be reused.
+   if (fSubscribers.empty()) {
+      fOutputIsFullStream = kFALSE;
+      fSentHashes.clear();
+   }
 }
 
 // Add Button in client gui with this command
@@ -86,6 +93,7 @@ void REveScene::AddCommand(const std::string &name, const std::string &icon, con
    if (element->GetElementId() && element->IsA())
    {
       fCommands.emplace_back(name, icon, element, action);
+      fOutputIsFullStream = kFALSE;
    }
    else
    {
@@ -133,8 +141,18 @@ void REveScene::ProcessChanges()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare data for sending the complete scene to a new subscriber.
+///
+/// If the scene was not changed since previous call, the streamed data is
+/// kept and reused. Static scenes like detector geometry are then streamed
+/// only once, independently of the number of connecting clients.
+
 void REveScene::StreamElements()
 {
+   if (fOutputIsFullStream && !IsChanged())
+      return;
+
    fOutputJson.clear();
    fOutputBinary.clear();
 
@@ -181,6 +199,8 @@ void REveScene::StreamElements()
    jarr.front()["fTotalBinarySize"] = fTotalBinarySize;
 
    fOutputJson = jarr.dump();
+
+   fOutputIsFullStream = kTRUE;
 }
 
 void REveScene::StreamJsonRecurse(REveElement *el, nlohmann::json &jarr)
@@ -235,6 +255,8 @@ void REveScene::StreamJsonRecurse(REveElement *el, nlohmann::json &jarr)
 
 void REveScene::StreamRepresentationChanges()
 {
+   fOutputIsFullStream = kFALSE;
+
    fOutputJson.clear();
    fOutputBinary.clear();
 
@@ -248,12 +270,12 @@ void REveScene::StreamRepresentationChanges()
    jhdr["fSceneId"] = fElementId;
 
    jhdr["removedElements"] = nlohmann::json::array();
-   for (auto &re : fRemovedElements)
+   for (auto &re : fRemovedElements) {
       jhdr["removedElements"].push_back(re);
+      fSentHashes.erase(re);
+   }
 
-   jhdr["numRepresentationChanged"] = fChangedElements.size();
-
-   // jarr.push_back(jhdr);
+   std::string rnr_buf;
 
    for (auto &el: fChangedElements)
    {
@@ -272,6 +294,28 @@ void REveScene::StreamRepresentationChanges()
          }
 
          Int_t rd_size = el->WriteCoreJson(jobj, fTotalBinarySize);
+
+         // Elements are often re-filled with the same content, e.g. for each
+         // event. Skip the ones for which the client already has identical data.
+         auto rd = jobj.find("render_data");
+         if (rd != jobj.end())
+            rd->erase("rnr_offset");
+         std::size_t hash = std::hash<std::string>{}(jobj.dump());
+         if (rd_size) {
+            rnr_buf.resize(rd_size);
+            el->fRenderData->Write(&rnr_buf[0], rd_size);
+            hash = hash * 31 + std::hash<std::string>{}(rnr_buf);
+         }
+         if (rd != jobj.end())
+            (*rd)["rnr_offset"] = fTotalBinarySize;
+
+         auto iter = fSentHashes.find(el->GetElementId());
+         if (!(bits & kCBElementAdded) && (iter != fSentHashes.end()) && (iter->second == hash)) {
+            el->ClearStamps();
+            continue;
+         }
+         fSentHashes[el->GetElementId()] = hash;
+
          if (rd_size) {
             assert (rd_size % 4 == 0);
             fTotalBinarySize += rd_size;
@@ -316,6 +360,7 @@ void REveScene::StreamRepresentationChanges()
    assert(off == fTotalBinarySize);
 
    jhdr["fTotalBinarySize"] = fTotalBinarySize;
+   jhdr["numRepresentationChanged"] = jarr.size();
 
    nlohmann::json msg = { {"header", jhdr}, {"arr", jarr}};
    fOutputJson = msg.dump();
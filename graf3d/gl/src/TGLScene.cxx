@@ -900,6 +900,39 @@ void TGLScene::RenderElements(TGLRnrCtx&           rnrCtx,
 
    Int_t drawCount = 0;
 
+   // Shapes drawn as a single pixel do not need per-shape names or matrices,
+   // collect them and draw all with one vertex-array call.
+   const Bool_t batchPixels = !rnrCtx.Selection() && !rnrCtx.Highlight() &&
+                              !rnrCtx.IsDrawPassOutlineLine();
+   std::vector<Double_t> pixVerts;
+   std::vector<Float_t>  pixColors;
+
+   auto flushPixels = [&]()
+   {
+      if (pixVerts.empty())
+         return;
+      glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+      glVertexPointer(3, GL_DOUBLE, 0, &pixVerts[0]);
+      glColorPointer(4, GL_FLOAT, 0, &pixColors[0]);
+      glEnableClientState(GL_VERTEX_ARRAY);
+      glEnableClientState(GL_COLOR_ARRAY);
+      { // Circumvent bug in ATI's linux drivers, as in TGLUtil::RenderPoints().
+         Int_t nleft = pixVerts.size() / 3;
+         Int_t ndone = 0;
+         const Int_t maxChunk = 8192;
+         while (nleft > maxChunk)
+         {
+            glDrawArrays(GL_POINTS, ndone, maxChunk);
+            nleft -= maxChunk;
+            ndone += maxChunk;
+         }
+         glDrawArrays(GL_POINTS, ndone, nleft);
+      }
+      glPopClientAttrib();
+      pixVerts.clear();
+      pixColors.clear();
+   };
+
    for (DrawElementPtrVec_i i = elVec.begin(); i != elVec.end(); ++i)
    {
       const TGLPhysicalShape * drawShape = (*i)->fPhysical;
@@ -915,9 +948,20 @@ void TGLScene::RenderElements(TGLRnrCtx&           rnrCtx,
       {
          rnrCtx.SetShapeLOD((*i)->fFinalLOD);
          rnrCtx.SetShapePixSize((*i)->fPixelSize);
-         glPushName(drawShape->ID());
-         drawShape->Draw(rnrCtx);
-         glPopName();
+         if (batchPixels && rnrCtx.ShapeLOD() == TGLRnrCtx::kLODPixel)
+         {
+            const TGLVertex3 t = drawShape->GetTranslation();
+            pixVerts.insert(pixVerts.end(), t.CArr(), t.CArr() + 3);
+            pixColors.insert(pixColors.end(), drawShape->Color(), drawShape->Color() + 4);
+         }
+         else
+         {
+            // Keep drawing order, it matters for transparent shapes.
+            flushPixels();
+            glPushName(drawShape->ID());
+            drawShape->Draw(rnrCtx);
+            glPopName();
+         }
          ++drawCount;
          sinfo->UpdateDrawStats(*drawShape, rnrCtx.ShapeLOD());
       }
@@ -933,6 +977,8 @@ void TGLScene::RenderElements(TGLRnrCtx&           rnrCtx,
          break;
       }
    }
+
+   flushPixels();
 }
 
 
@@ -22,8 +22,10 @@
 #include <vector>
 #include <string>
 #include <queue>
+#include <map>
 #include <functional>
 
+class TH1;
 class TPad;
 class TPadWebSnapshot;
 class TWebPS;
@@ -54,9 +56,15 @@ protected:
       Long64_t fSendVersion{0};        ///<! canvas version send to the client
       Long64_t fDrawVersion{0};        ///<! canvas version drawn (confirmed) by client
       std::queue<std::string> fSend;   ///<! send queue, processed after sending draw data
+      std::map<std::string, ULong_t> fBinaryHashes; ///<! hashes of binary arrays, which client already has
       WebConn(unsigned id) : fConnId(id) {}
    };
 
+   struct BinaryHist {
+      std::string fId;                 ///<! snapshot id of histogram
+      TH1 *fHist{nullptr};             ///<! histogram, which bins content delivered as binary data
+   };
+
    std::vector<WebConn> fWebConn;  ///<! connections
 
    std::shared_ptr<ROOT::Experimental::RWebWindow> fWindow; ///!< configured display
@@ -70,6 +78,8 @@ protected:
    Int_t fPaletteDelivery{1};      ///<! colors palette delivery 0:never, 1:once, 2:always, 3:per subpad
    Int_t fPrimitivesMerge{100};    ///<! number of PS primitives, which will be merged together
    Int_t fJsonComp{0};             ///<! compression factor for messages send to the client
+   Int_t fBinaryThreshold{10000};  ///<! minimal number of bins to deliver histogram content as binary data, 0 - never
+   std::vector<BinaryHist> fBinaryHists; ///<! histograms with binary content in the snapshot being created
    std::string fCustomScripts;     ///<! custom JavaScript code or URL on JavaScript files to load before start drawing
    std::vector<std::string> fCustomClasses;  ///<! list of custom classes, which can be delivered as is to client
    Bool_t fCanCreateObjects{kTRUE}; ///<! indicates if canvas allowed to create extra objects for interactive painting
@@ -99,6 +109,8 @@ protected:
 
    Bool_t AddToSendQueue(unsigned connid, const std::string &msg);
 
+   UInt_t DetachBinaryArrays(WebConn &conn, std::string &arrays, std::vector<std::function<void()>> &restore);
+
    void CheckDataToSend(unsigned connid = 0);
 
    Bool_t WaitWhenCanvasPainted(Long64_t ver);
@@ -186,6 +198,9 @@ public:
    void SetPrimitivesMerge(Int_t cnt) { fPrimitivesMerge = cnt; }
    Int_t GetPrimitivesMerge() const { return fPrimitivesMerge; }
 
+   void SetBinaryThreshold(Int_t nbins) { fBinaryThreshold = nbins; }
+   Int_t GetBinaryThreshold() const { return fBinaryThreshold; }
+
    void SetLongerPolling(Bool_t on) { fLongerPolling = on; }
    Bool_t GetLongerPolling() const { return fLongerPolling; }
 
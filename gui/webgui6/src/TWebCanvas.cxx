@@ -26,7 +26,12 @@
 #include "TClass.h"
 #include "TColor.h"
 #include "TObjArray.h"
+#include "TArrayC.h"
+#include "TArrayS.h"
 #include "TArrayI.h"
+#include "TArrayL64.h"
+#include "TArrayF.h"
+#include "TArrayD.h"
 #include "TList.h"
 #include "TH1.h"
 #include "TEnv.h"
@@ -51,8 +56,70 @@ Basic TCanvasImp ABI implementation for Web-based GUI
 Provides painting of main ROOT6 classes in web browsers
 Major interactive features implemented in TWebCanvasFull class.
 
+Content of histograms with many bins (see SetBinaryThreshold(), default 10000 bins,
+configurable with `WebGui.BinaryThreshold` in rootrc) is not converted to JSON.
+Such snapshots are sent as one binary message:
+
+| offset | type     | content                                                    |
+|--------|----------|------------------------------------------------------------|
+| 0      | char[4]  | "SNB6"                                                     |
+| 4      | uint32   | length of JSON snapshot J                                  |
+| 8      | uint32   | number of arrays M                                         |
+| 12     | uint32   | reserved, 0                                                |
+| 16     | char[J]  | JSON snapshot as in "SNAP6:" message, zero padded to 8     |
+
+followed by M arrays, each as uint32 length of id L, uint32 kind (0 - fArray, 1 - fSumw2),
+uint32 number of values N, uint32 reserved, char[L] snapshot id zero padded to 8 and double[N] values.
+In the JSON snapshot these arrays are empty. An array is only sent when it was changed since
+previous snapshot delivered to the same connection, otherwise client reuses the values it already has.
 */
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy values of array and detach them from array object, restore function reattach them
+
+template <class ARR>
+Bool_t DetachArray(TArray *arr, std::vector<Double_t> &values, std::vector<std::function<void()>> &restore)
+{
+   auto tarr = dynamic_cast<ARR *>(arr);
+   if (!tarr)
+      return kFALSE;
+
+   values.assign(tarr->fArray, tarr->fArray + tarr->fN);
+
+   auto ptr = tarr->fArray;
+   auto len = tarr->fN;
+   tarr->fArray = nullptr;
+   tarr->fN = 0;
+   restore.emplace_back([tarr, ptr, len]() {
+      tarr->fArray = ptr;
+      tarr->fN = len;
+   });
+
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append raw value to the buffer
+
+template <typename T>
+void AppendValue(std::string &buf, const T &value)
+{
+   buf.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append string to the buffer, zero padded to multiple of 8
+
+void AppendPadded(std::string &buf, const std::string &str)
+{
+   buf.append(str);
+   buf.append((8 - str.length() % 8) % 8, '\0');
+}
+
+} // anonymous namespace
+
 using namespace std::string_literals;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -66,6 +133,7 @@ TWebCanvas::TWebCanvas(TCanvas *c, const char *name, Int_t x, Int_t y, UInt_t wi
    fPaletteDelivery = gEnv->GetValue("WebGui.PaletteDelivery", 1);
    fPrimitivesMerge = gEnv->GetValue("WebGui.PrimitivesMerge", 100);
    fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kSameSuppression + TBufferJSON::kNoSpaces);
+   fBinaryThreshold = gEnv->GetValue("WebGui.BinaryThreshold", 10000);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -421,7 +489,11 @@ void TWebCanvas::CreatePadSnapshot(TPadWebSnapshot &paddata, TPad *pad, Long64_t
 
          if (palette) hopt.Append(";;use_pad_palette");
 
-         paddata.NewPrimitive(obj, hopt.Data()).SetSnapshot(TWebSnapshot::kObject, obj);
+         auto &histsnap = paddata.NewPrimitive(obj, hopt.Data());
+         histsnap.SetSnapshot(TWebSnapshot::kObject, obj);
+
+         if ((fBinaryThreshold > 0) && (hist->GetNcells() >= fBinaryThreshold))
+            fBinaryHists.emplace_back(BinaryHist{histsnap.GetObjectID(), hist});
 
          // do not extract objects from list of functions - stats and func need to be handled together with hist
          //
@@ -538,6 +610,63 @@ Bool_t TWebCanvas::AddToSendQueue(unsigned connid, const std::string &msg)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Detach bins content of histograms collected in fBinaryHists, so that it is not stored in JSON
+/// Arrays which were changed since last delivery to the connection are appended to arrays buffer.
+/// Returns number of arrays in the buffer, restore functions have to be called after JSON is created
+
+UInt_t TWebCanvas::DetachBinaryArrays(WebConn &conn, std::string &arrays, std::vector<std::function<void()>> &restore)
+{
+   UInt_t narrays = 0;
+   std::map<std::string, ULong_t> hashes;
+   std::vector<Double_t> values;
+
+   auto store = [&](const std::string &id, UInt_t kind) {
+      std::string key = kind ? id + ":sumw2" : id;
+      ULong_t hash = TString::Hash(values.data(), values.size() * sizeof(Double_t)) + values.size();
+      hashes[key] = hash;
+      auto iter = conn.fBinaryHashes.find(key);
+      if ((iter != conn.fBinaryHashes.end()) && (iter->second == hash))
+         return;
+      AppendValue<UInt_t>(arrays, id.length());
+      AppendValue<UInt_t>(arrays, kind);
+      AppendValue<UInt_t>(arrays, values.size());
+      AppendValue<UInt_t>(arrays, 0);
+      AppendPadded(arrays, id);
+      arrays.append(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(Double_t));
+      narrays++;
+   };
+
+   for (auto &entry : fBinaryHists) {
+      // same histogram may be drawn several times
+      if (hashes.count(entry.fId))
+         continue;
+
+      auto arr = dynamic_cast<TArray *>(entry.fHist);
+      if (!DetachArray<TArrayD>(arr, values, restore) && !DetachArray<TArrayF>(arr, values, restore) &&
+          !DetachArray<TArrayI>(arr, values, restore) && !DetachArray<TArrayS>(arr, values, restore) &&
+          !DetachArray<TArrayC>(arr, values, restore) && !DetachArray<TArrayL64>(arr, values, restore))
+         continue;
+
+      store(entry.fId, 0);
+
+      if (entry.fHist->GetSumw2N() > 0) {
+         DetachArray<TArrayD>(entry.fHist->GetSumw2(), values, restore);
+         store(entry.fId, 1);
+      } else if (conn.fBinaryHashes.count(entry.fId + ":sumw2")) {
+         // sumw2 was removed, client has to forget it
+         values.clear();
+         store(entry.fId, 1);
+         hashes.erase(entry.fId + ":sumw2");
+      }
+   }
+
+   // forget about histograms which are no longer displayed
+   std::swap(conn.fBinaryHashes, hashes);
+
+   return narrays;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// Check if any data should be send to client
 /// If connid != 0, only selected connection will be checked
@@ -556,10 +685,12 @@ void TWebCanvas::CheckDataToSend(unsigned connid)
          continue;
 
       std::string buf;
+      Bool_t binary = kFALSE;
 
       if ((conn.fSendVersion < fCanvVersion) && (conn.fSendVersion == conn.fDrawVersion)) {
 
          buf = "SNAP6:";
+         fBinaryHists.clear();
 
          TCanvasWebSnapshot holder(IsReadOnly(), fCanvVersion);
 
@@ -569,10 +700,30 @@ void TWebCanvas::CheckDataToSend(unsigned connid)
 
          holder.SetHighlightConnect(Canvas()->HasConnection("Highlighted(TVirtualPad*,TObject*,Int_t,Int_t)"));
 
-         CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, [&buf,this](TPadWebSnapshot *snap) {
-            buf.append(TBufferJSON::ToJSON(snap, fJsonComp).Data());
+         CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, [&buf, &binary, &conn, this](TPadWebSnapshot *snap) {
+            if (fBinaryHists.empty()) {
+               buf.append(TBufferJSON::ToJSON(snap, fJsonComp).Data());
+               return;
+            }
+
+            std::string arrays;
+            std::vector<std::function<void()>> restore;
+            UInt_t narrays = DetachBinaryArrays(conn, arrays, restore);
+            TString json = TBufferJSON::ToJSON(snap, fJsonComp);
+            for (auto &func : restore)
+               func();
+
+            buf = "SNB6";
+            AppendValue<UInt_t>(buf, json.Length());
+            AppendValue<UInt_t>(buf, narrays);
+            AppendValue<UInt_t>(buf, 0);
+            AppendPadded(buf, json.Data());
+            buf.append(arrays);
+            binary = kTRUE;
          });
 
+         fBinaryHists.clear();
+
          conn.fSendVersion = fCanvVersion;
 
       } else if (!conn.fSend.empty()) {
@@ -582,7 +733,9 @@ void TWebCanvas::CheckDataToSend(unsigned connid)
 
       }
 
-      if (!buf.empty())
+      if (binary)
+         fWindow->SendBinary(conn.fConnId, std::move(buf));
+      else if (!buf.empty())
          fWindow->Send(conn.fConnId, buf);
    }
 }
@@ -1209,6 +1362,7 @@ TString TWebCanvas::CreateCanvasJSON(TCanvas *c, Int_t json_compression)
 
    {
       auto imp = std::make_unique<TWebCanvas>(c, c->GetName(), 0, 0, 1000, 500);
+      imp->SetBinaryThreshold(0); // complete JSON is required
 
       TCanvasWebSnapshot holder(true, 1); // always readonly
 
@@ -1237,6 +1391,7 @@ Int_t TWebCanvas::StoreCanvasJSON(TCanvas *c, const char *filename, const char *
 
    {
       auto imp = std::make_unique<TWebCanvas>(c, c->GetName(), 0, 0, 1000, 500);
+      imp->SetBinaryThreshold(0); // complete JSON is required
 
       TCanvasWebSnapshot holder(true, 1); // always readonly
 
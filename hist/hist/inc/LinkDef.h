@@ -97,6 +97,8 @@
 #pragma link C++ class TNDArrayT<ULong_t>+;
 #pragma link C++ class TNDArrayT<UInt_t>+;
 #pragma link C++ class TNDArrayT<UShort_t>+;
+#pragma link C++ class TNDArrayChunkedT<Float_t>+;
+#pragma link C++ class TNDArrayChunkedT<Double_t>+;
 #pragma link C++ class TNDArrayRef<Float_t>+;
 //#pragma link C++ class TNDArrayRef<Float16_t>+;
 #pragma link C++ class TNDArrayRef<Double_t>+;
@@ -140,6 +142,8 @@
 #pragma link C++ class THnT<ULong_t>+;
 #pragma link C++ class THnT<UInt_t>+;
 #pragma link C++ class THnT<UShort_t>+;
+#pragma link C++ class THnChunkedT<Float_t>+;
+#pragma link C++ class THnChunkedT<Double_t>+;
 #pragma link C++ class THnSparse+;
 #pragma link C++ class THnSparseT<TArrayD>+;
 #pragma link C++ class THnSparseT<TArrayF>+;
@@ -188,6 +192,8 @@
 #pragma link C++ typedef THnI;
 #pragma link C++ typedef THnS;
 #pragma link C++ typedef THnC;
+#pragma link C++ typedef THnChunkedD;
+#pragma link C++ typedef THnChunkedF;
 
 
 // for autoloading of typedef's (make some dummy ifdef)
@@ -206,6 +212,8 @@
 #pragma link C++ class THnI;
 #pragma link C++ class THnS;
 #pragma link C++ class THnC;
+#pragma link C++ class THnChunkedD;
+#pragma link C++ class THnChunkedF;
 #endif
 
 
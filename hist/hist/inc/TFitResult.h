@@ -75,6 +75,9 @@ public:
       return ParError(i);
    }
 
+   // set the model function, used when the fit was done with a vectorized copy of the function
+   using ROOT::Fit::FitResult::SetModelFunction;
+
 private:
    ClassDefOverride(TFitResult, 0);  // Class holding the result of the fit
 };
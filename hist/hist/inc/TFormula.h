@@ -107,8 +107,10 @@ private:
    CallFuncSignature fHessFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
+   static std::atomic<Bool_t> fgLazyJitting;       ///<! Compile the formulas created from now on at their first evaluation
 
    void     InputFormulaIntoCling();
+   void     LazyInitializeEvalMethod();
    Bool_t   PrepareEvalMethod();
    void     FillDefaults();
    void     HandlePolN(TString &formula);
@@ -265,8 +267,9 @@ public:
    Double_t       GetVariable(const char *name) const;
    Int_t          GetVarNumber(const char *name) const;
    TString        GetVarName(Int_t ivar) const;
-   Bool_t         IsValid() const { return fReadyToExecute && fClingInitialized; }
+   Bool_t         IsValid() const { return fReadyToExecute && (fClingInitialized || fLazyInitialization); }
    Bool_t IsVectorized() const { return fVectorized; }
+   Bool_t         CanBeVectorized() const;
    Bool_t         IsLinear() const { return TestBit(kLinear); }
    void           Print(Option_t *option = "") const override;
    void           SetName(const char* name) override;
@@ -286,6 +289,8 @@ public:
    void           SetVariables(const std::pair<TString,Double_t> *vars, const Int_t size);
    void SetVectorized(Bool_t vectorized);
 
+   static Bool_t  DefaultLazyJitting(Bool_t on = kTRUE);
+
    ClassDefOverride(TFormula,13)
 };
 #endif
@@ -0,0 +1,250 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TH1ConcurrentFill
+#define ROOT_TH1ConcurrentFill
+
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TError.h"
+
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+
+namespace ROOT {
+
+template <class HIST>
+class TH1ConcurrentFillManager;
+
+namespace Internal {
+
+/// Add value to target with a compare-and-swap loop, target being concurrently updated by other threads
+template <class T>
+inline void TH1AtomicAdd(T &target, T value)
+{
+   static_assert(sizeof(std::atomic<T>) == sizeof(T), "the atomic type must have the layout of the bin content");
+   auto &atomicTarget = reinterpret_cast<std::atomic<T> &>(target);
+   T old = atomicTarget.load(std::memory_order_relaxed);
+   while (!atomicTarget.compare_exchange_weak(old, old + value, std::memory_order_relaxed)) {
+   }
+}
+
+} // namespace Internal
+
+/**
+ \class ROOT::TH1ConcurrentFiller
+ Fills a histogram of the TH1 family from one thread, concurrently with the other
+ fillers of the same TH1ConcurrentFillManager.
+
+ The bin contents (and sums of squares of weights) are updated directly in the
+ histogram with atomic additions, so that there is a single copy of the bins
+ whatever the number of threads. The statistics (sums of weights and of the
+ moments, number of entries) are accumulated by the filler and added to the
+ histogram by Flush(), which is called by the destructor.
+ */
+template <class HIST>
+class TH1ConcurrentFiller {
+public:
+   static constexpr int kDim = std::is_base_of<TH3, HIST>::value ? 3 : (std::is_base_of<TH2, HIST>::value ? 2 : 1);
+
+private:
+   static constexpr int kNStats = kDim == 3 ? 11 : (kDim == 2 ? 7 : 4);
+
+   TH1ConcurrentFillManager<HIST> *fManager;
+   Double_t fStats[11]; ///< statistics of the fills since the last Flush(), the first kNStats as in TH1::GetStats
+   Double_t fEntries;   ///< number of fills since the last Flush()
+
+   void Fill(const Double_t *x, Double_t w);
+
+public:
+   explicit TH1ConcurrentFiller(TH1ConcurrentFillManager<HIST> &manager) : fManager(&manager), fEntries(0)
+   {
+      for (auto &s : fStats)
+         s = 0;
+   }
+   TH1ConcurrentFiller(TH1ConcurrentFiller &&other) : fManager(other.fManager), fEntries(other.fEntries)
+   {
+      for (int i = 0; i < 11; ++i)
+         fStats[i] = other.fStats[i];
+      other.fManager = nullptr;
+   }
+   TH1ConcurrentFiller(const TH1ConcurrentFiller &) = delete;
+   TH1ConcurrentFiller &operator=(const TH1ConcurrentFiller &) = delete;
+   ~TH1ConcurrentFiller() { Flush(); }
+
+   /// Same as HIST::Fill(x, w)
+   template <int D = kDim, std::enable_if_t<D == 1, int> = 0>
+   void Fill(Double_t x, Double_t w = 1.)
+   {
+      Fill(&x, w);
+   }
+
+   /// Same as HIST::Fill(x, y, w)
+   template <int D = kDim, std::enable_if_t<D == 2, int> = 0>
+   void Fill(Double_t x, Double_t y, Double_t w = 1.)
+   {
+      const Double_t xy[2] = {x, y};
+      Fill(xy, w);
+   }
+
+   /// Same as HIST::Fill(x, y, z, w)
+   template <int D = kDim, std::enable_if_t<D == 3, int> = 0>
+   void Fill(Double_t x, Double_t y, Double_t z, Double_t w = 1.)
+   {
+      const Double_t xyz[3] = {x, y, z};
+      Fill(xyz, w);
+   }
+
+   /// Add the statistics of the fills since the last call to the histogram
+   void Flush();
+};
+
+/**
+ \class ROOT::TH1ConcurrentFillManager
+ Allows several threads to fill the same histogram of the TH1 family at the same
+ time, without a copy of the histogram per thread as with ROOT::TThreadedObject:
+
+ ~~~ {.cpp}
+ TH3D h("h", "h", 500, -5, 5, 500, -5, 5, 100, 0, 10);
+ ROOT::TH1ConcurrentFillManager<TH3D> manager(h);
+ auto work = [&](int) {
+    auto filler = manager.MakeFiller();
+    for (...)
+       filler.Fill(x, y, z, w);
+ };
+ ROOT::TThreadExecutor().Foreach(work, ROOT::TSeqI(nTasks));
+ // all the fillers are destroyed (flushed): h now has all the entries
+ ~~~
+
+ Each thread uses its own filler returned by MakeFiller(). The bin contents are
+ immediately in the histogram; the statistics (entries, mean, ...) once the
+ fillers are flushed or destroyed. The histogram must not be used otherwise while
+ it is filled.
+
+ The fills of a bin are atomic additions: this is efficient when the threads
+ rarely fill the same bins at the same time, as for large multi-dimensional
+ histograms. For a few bins filled by all the threads, the additions contend
+ and TThreadedObject is faster.
+
+ HIST must have floating point bin contents (e.g. TH1D, TH2F, TH3D). Axes which
+ can be extended are not supported and their extension is switched off. For
+ weights different from one, TH1::Sumw2() must be called before the filling.
+ */
+template <class HIST>
+class TH1ConcurrentFillManager {
+   friend class TH1ConcurrentFiller<HIST>;
+
+   using Content_t = std::remove_pointer_t<decltype(std::declval<HIST &>().GetArray())>;
+   static_assert(std::is_floating_point<Content_t>::value,
+                 "TH1ConcurrentFillManager can only fill histograms with floating point bin contents");
+   static constexpr int kDim = TH1ConcurrentFiller<HIST>::kDim;
+
+   HIST &fHist;
+   const TAxis *fAxes[3];
+   Int_t fNbins[3];       ///< number of bins of each axis
+   Int_t fStride[3];      ///< distance in the global bin number between two bins of each axis
+   Bool_t fStatOverflows; ///< use the underflows and overflows in the statistics
+   Double_t fStats[11];   ///< statistics of the histogram, updated by the fillers
+   Double_t fEntries;     ///< number of entries of the histogram, updated by the fillers
+   std::mutex fMutex;     ///< protects the statistics
+
+public:
+   explicit TH1ConcurrentFillManager(HIST &hist) : fHist(hist)
+   {
+      if (fHist.CanExtendAllAxes() || fHist.GetXaxis()->CanExtend() || fHist.GetYaxis()->CanExtend() ||
+          fHist.GetZaxis()->CanExtend()) {
+         ::Warning("TH1ConcurrentFillManager", "The axes of %s can't be extended while it is filled concurrently",
+                   fHist.GetName());
+         fHist.SetCanExtend(TH1::kNoAxis);
+      }
+      fAxes[0] = fHist.GetXaxis();
+      fAxes[1] = fHist.GetYaxis();
+      fAxes[2] = fHist.GetZaxis();
+      Int_t stride = 1;
+      for (int i = 0; i < 3; ++i) {
+         fNbins[i] = fAxes[i]->GetNbins();
+         fStride[i] = stride;
+         stride *= fNbins[i] + 2;
+      }
+      // the behaviour of TH1::GetStatOverflowsBehaviour() at the start of the filling
+      fStatOverflows = fHist.GetStatOverflowsBehaviour();
+      for (auto &s : fStats)
+         s = 0;
+      // also empties the buffer
+      fHist.GetStats(fStats);
+      fEntries = fHist.GetEntries();
+   }
+
+   /// Return a filler for a thread
+   TH1ConcurrentFiller<HIST> MakeFiller() { return TH1ConcurrentFiller<HIST>(*this); }
+
+   HIST &GetHist() { return fHist; }
+};
+
+template <class HIST>
+void TH1ConcurrentFiller<HIST>::Fill(const Double_t *x, Double_t w)
+{
+   R__ASSERT(fManager && "the filler was moved from");
+   TH1ConcurrentFillManager<HIST> &manager = *fManager;
+   fEntries += 1;
+   Int_t bin = 0;
+   Bool_t inRange = kTRUE;
+   for (int i = 0; i < kDim; ++i) {
+      const Int_t axisBin = manager.fAxes[i]->FindFixBin(x[i]);
+      bin += axisBin * manager.fStride[i];
+      inRange = inRange && axisBin > 0 && axisBin <= manager.fNbins[i];
+   }
+   using Content_t = typename TH1ConcurrentFillManager<HIST>::Content_t;
+   Internal::TH1AtomicAdd(manager.fHist.GetArray()[bin], static_cast<Content_t>(w));
+   TArrayD *sumw2 = manager.fHist.GetSumw2();
+   if (sumw2->fN)
+      Internal::TH1AtomicAdd(sumw2->fArray[bin], w * w);
+   if (!inRange && !manager.fStatOverflows)
+      return;
+   // same order as in TH1::GetStats
+   fStats[0] += w;
+   fStats[1] += w * w;
+   fStats[2] += w * x[0];
+   fStats[3] += w * x[0] * x[0];
+   if (kDim >= 2) {
+      fStats[4] += w * x[1];
+      fStats[5] += w * x[1] * x[1];
+      fStats[6] += w * x[0] * x[1];
+   }
+   if (kDim == 3) {
+      fStats[7] += w * x[2];
+      fStats[8] += w * x[2] * x[2];
+      fStats[9] += w * x[0] * x[2];
+      fStats[10] += w * x[1] * x[2];
+   }
+}
+
+template <class HIST>
+void TH1ConcurrentFiller<HIST>::Flush()
+{
+   if (!fManager || fEntries == 0)
+      return;
+   TH1ConcurrentFillManager<HIST> &manager = *fManager;
+   std::lock_guard<std::mutex> lock(manager.fMutex);
+   for (int i = 0; i < kNStats; ++i) {
+      manager.fStats[i] += fStats[i];
+      fStats[i] = 0;
+   }
+   manager.fEntries += fEntries;
+   fEntries = 0;
+   manager.fHist.PutStats(manager.fStats);
+   manager.fHist.SetEntries(manager.fEntries);
+}
+
+} // namespace ROOT
+
+#endif
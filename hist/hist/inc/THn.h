@@ -240,6 +240,104 @@ protected:
    ClassDefOverride(THnT, 1);   ///< Multi-dimensional histogram with templated storage
 };
 
+//______________________________________________________________________________
+/** \class THnChunkedT
+ Implementation of THn with the bin contents and the sums of squared weights
+ stored in a TNDArrayChunkedT: chunks of chunkSize consecutive bins are only
+ allocated once one of their bins is filled, and the sums of squared weights
+ of a chunk only once it is filled after Sumw2() was called.
+
+ This is the storage of choice for many histograms which are mostly empty,
+ e.g. for monitoring: their memory is proportional to the filled regions, while
+ the bins are still addressed as in a THn, without the bin index of a
+ THnSparse. Reset() releases the storage.
+
+ Templated name         |     Typedef      |    Bin content type
+ -----------------------|------------------|--------------------
+   THnChunkedT<Float_t> |   THnChunkedF    |     Float_t
+   THnChunkedT<Double_t>|   THnChunkedD    |     Double_t
+*/
+
+template <typename T>
+class THnChunkedT: public THn {
+protected:
+   void InitStorage(Int_t* nbins, Int_t chunkSize) override {
+      THn::InitStorage(nbins, chunkSize);
+      fArray.SetChunkSize(chunkSize);
+      fSumw2Chunks.Init(fNdimensions, nbins, true /*addOverflow*/);
+      fSumw2Chunks.SetChunkSize(chunkSize);
+   }
+
+public:
+   THnChunkedT() {}
+
+   THnChunkedT(const char* name, const char* title,
+               Int_t dim, const Int_t* nbins,
+               const Double_t* xmin, const Double_t* xmax, Int_t chunkSize = 1024):
+   THn(name, title, dim, nbins, xmin, xmax),
+   fArray(dim, nbins, true, chunkSize), fSumw2Chunks(dim, nbins, true, chunkSize) {}
+
+   THnChunkedT(const char *name, const char *title, Int_t dim, const Int_t *nbins,
+               const std::vector<std::vector<double>> &xbins, Int_t chunkSize = 1024)
+      : THn(name, title, dim, nbins, xbins), fArray(dim, nbins, true, chunkSize),
+        fSumw2Chunks(dim, nbins, true, chunkSize)
+   {
+   }
+
+   void FillBin(Long64_t bin, Double_t w) override {
+      fArray.AddAt(bin, w);
+      if (GetCalculateErrors()) {
+         fSumw2Chunks.AddAt(bin, w * w);
+      }
+      FillBinBase(w);
+   }
+   void SetBinError2(Long64_t bin, Double_t e2) override {
+      if (!GetCalculateErrors()) Sumw2();
+      fSumw2Chunks.SetAsDouble(bin, e2);
+   }
+   void AddBinError2(Long64_t bin, Double_t e2) override {
+      fSumw2Chunks.AddAt(bin, e2);
+   }
+   Double_t GetBinError2(Long64_t linidx) const override {
+      return GetCalculateErrors() ? fSumw2Chunks.AtAsDouble(linidx) : GetBinContent(linidx);
+   }
+
+   /// Enable calculation of errors; as THn::Sumw2(), but only touching the allocated chunks.
+   void Sumw2() override {
+      if (!GetCalculateErrors()) {
+         fTsumw2 = 0.;
+      }
+      const Int_t chunkSize = fArray.GetChunkSize();
+      for (Long64_t ichunk = 0, nchunks = fArray.GetNChunks(); ichunk < nchunks; ++ichunk) {
+         const T* content = fArray.GetChunk(ichunk);
+         if (!content) continue;
+         const Long64_t first = ichunk * chunkSize;
+         const Long64_t n = std::min<Long64_t>(chunkSize, GetNbins() - first);
+         for (Long64_t i = 0; i < n; ++i)
+            fSumw2Chunks.SetAsDouble(first + i, content[i]);
+      }
+   }
+
+   void Reset(Option_t* option = "") override {
+      fArray.Reset(option);
+      fSumw2Chunks.Reset(option);
+   }
+
+   const TNDArray& GetArray() const override { return fArray; }
+   TNDArray& GetArray() override { return fArray; }
+
+   Int_t GetChunkSize() const { return fArray.GetChunkSize(); }
+   /// Fraction of the chunks of bin contents which are allocated.
+   Double_t GetAllocatedFraction() const {
+      return fArray.GetNChunks() ? fArray.GetNAllocatedChunks() / (Double_t)fArray.GetNChunks() : 0.;
+   }
+
+protected:
+   TNDArrayChunkedT<T> fArray;              ///< Bin content
+   TNDArrayChunkedT<Double_t> fSumw2Chunks; ///< Bin error, replacing THn::fSumw2 which stays empty
+   ClassDefOverride(THnChunkedT, 1);         ///< Multi-dimensional histogram allocated by chunks
+};
+
 typedef THnT<Float_t>  THnF;
 typedef THnT<Double_t> THnD;
 typedef THnT<Char_t>   THnC;
@@ -248,4 +346,7 @@ typedef THnT<Int_t>    THnI;
 typedef THnT<Long_t>   THnL;
 typedef THnT<Long64_t> THnL64;
 
+typedef THnChunkedT<Float_t>  THnChunkedF;
+typedef THnChunkedT<Double_t> THnChunkedD;
+
 #endif // ROOT_THN
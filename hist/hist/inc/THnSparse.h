@@ -21,7 +21,6 @@
 
 
 #include "THnBase.h"
-#include "TExMap.h"
 #include "THnSparse_Internal.h"
 
 // needed only for template instantiations of THnSparseT:
@@ -31,6 +30,8 @@
 #include "TArrayS.h"
 #include "TArrayC.h"
 
+#include <vector>
+
 class THnSparseCompactBinCoord;
 
 class THnSparse: public THnBase {
@@ -38,8 +39,7 @@ class THnSparse: public THnBase {
    Int_t      fChunkSize;                   ///<  Number of entries for each chunk
    Long64_t   fFilledBins;                  ///<  Number of filled bins
    TObjArray  fBinContent;                  ///<  Array of THnSparseArrayChunk
-   TExMap     fBins;                        ///<! Filled bins
-   TExMap     fBinsContinued;               ///<! Filled bins for non-unique hashes, containing pairs of (bin index 0, bin index 1)
+   std::vector<ULong64_t> fBinIndex;        ///<! Open addressing hash table of the filled bins: pairs of (hash, bin index + 1)
    THnSparseCompactBinCoord *fCompactCoord; ///<! Compact coordinate
 
    THnSparse(const THnSparse&) = delete;
@@ -57,7 +57,8 @@ class THnSparse: public THnBase {
 
    THnSparseArrayChunk* AddChunk();
    void Reserve(Long64_t nbins) override;
-   void FillExMap();
+   void FillBinIndex();
+   void ResizeBinIndex(Long64_t nslots);
    virtual TArray* GenerateArray() const = 0;
    Long64_t GetBinIndexForCurrentBin(Bool_t allocate);
 
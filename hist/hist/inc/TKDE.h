@@ -164,6 +164,12 @@ public:
       TKDE *fKDE;
       UInt_t fNWeights;               ///< Number of kernel weights (bandwidth as vectorized for binning)
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
+      Double_t fSupport;                 ///< Half width of the kernel support in units of bandwidth (0 if unknown)
+      Double_t fMaxWeight;               ///< Largest kernel weight
+      std::vector<Double_t> fSortedData; ///< Data points in increasing order, to sum only over the kernel support
+      std::vector<UInt_t> fSortedIndex;  ///< Index in the data of the sorted points
+      void AddSupport(Double_t x, Double_t centre, Bool_t reflect, Double_t mirror, Bool_t useCount,
+                      Double_t &result) const;
    public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
@@ -15,6 +15,9 @@
 #include "TObject.h"
 #include "TError.h"
 
+#include <algorithm>
+#include <vector>
+
 /** \class TNDArray
 
 N-Dim array class.
@@ -82,6 +85,9 @@ public:
    virtual void SetAsDouble(ULong64_t linidx, Double_t value) = 0;
    virtual void AddAt(ULong64_t linidx, Double_t value) = 0;
 
+   /// Number of bins allocated together, 0 if the whole array is allocated at once
+   virtual Int_t GetChunkSize() const { return 0; }
+
 protected:
    std::vector<Long64_t> fSizes; ///< bin count
    ClassDefOverride(TNDArray, 2);        ///< Base for n-dimensional array
@@ -168,11 +174,114 @@ public:
       fData[linidx] += (T) value;
    }
 
+   /// Pointer to the contiguous storage of all bins, allocated if needed
+   /// (e.g. to expose the content without copy).
+   T *GetData() {
+      if (fData.empty())
+         fData.resize(fSizes[0], T());
+      return fData.data();
+   }
+
 protected:
    std::vector<T> fData;   // data
    ClassDefOverride(TNDArrayT, 2); // N-dimensional array
 };
 
+/** \class TNDArrayChunkedT
+
+N-dim array like TNDArrayT, but with the storage allocated by chunks of
+consecutive bins, each chunk only when a non-zero value is written to one of
+its bins. Reading a bin of a chunk which is not allocated gives 0; Reset()
+releases all the chunks.
+
+This keeps the memory of arrays with large empty regions, e.g. of mostly empty
+histograms, proportional to the filled regions, at the cost of one division
+per access.
+*/
+
+template <typename T>
+class TNDArrayChunkedT: public TNDArray {
+public:
+   TNDArrayChunkedT() : fChunkSize(1024), fChunks() {}
+
+   TNDArrayChunkedT(Int_t ndim, const Int_t *nbins, bool addOverflow = false, Int_t chunkSize = 1024)
+      : TNDArray(ndim, nbins, addOverflow), fChunkSize(std::max(chunkSize, 1)), fChunks()
+   {
+   }
+
+   void Init(Int_t ndim, const Int_t* nbins, bool addOverflow = false) override {
+      fChunks.clear();
+      TNDArray::Init(ndim, nbins, addOverflow);
+   }
+
+   /// Set the number of bins per chunk; releases the storage.
+   void SetChunkSize(Int_t chunkSize) {
+      fChunks.clear();
+      fChunkSize = std::max(chunkSize, 1);
+   }
+   Int_t GetChunkSize() const override { return fChunkSize; }
+
+   Long64_t GetNChunks() const { return (GetNbins() + fChunkSize - 1) / fChunkSize; }
+   Long64_t GetNAllocatedChunks() const {
+      return std::count_if(fChunks.begin(), fChunks.end(), [](const std::vector<T> &chunk) { return !chunk.empty(); });
+   }
+   /// Return the bins of chunk ichunk, nullptr if the chunk is not allocated.
+   const T* GetChunk(Long64_t ichunk) const {
+      if (ichunk >= (Long64_t)fChunks.size() || fChunks[ichunk].empty())
+         return nullptr;
+      return fChunks[ichunk].data();
+   }
+
+   void Reset(Option_t* /*option*/ = "") override {
+      // Reset the content, releasing the storage
+      fChunks.clear();
+   }
+
+   T At(const Int_t* idx) const {
+      return At(GetBin(idx));
+   }
+   T& At(const Int_t* idx) {
+      return At(GetBin(idx));
+   }
+   T At(ULong64_t linidx) const {
+      const T *chunk = GetChunk(linidx / fChunkSize);
+      return chunk ? chunk[linidx % fChunkSize] : T();
+   }
+   /// Return a reference to the bin, allocating its chunk if needed.
+   T& At(ULong64_t linidx) {
+      return AllocChunk(linidx / fChunkSize)[linidx % fChunkSize];
+   }
+
+   Double_t AtAsDouble(ULong64_t linidx) const override {
+      return At(linidx);
+   }
+   void SetAsDouble(ULong64_t linidx, Double_t value) override {
+      if (value == 0. && !GetChunk(linidx / fChunkSize))
+         return;
+      At(linidx) = (T) value;
+   }
+   void AddAt(ULong64_t linidx, Double_t value) override {
+      if (value == 0.)
+         return;
+      At(linidx) += (T) value;
+   }
+
+private:
+   T* AllocChunk(Long64_t ichunk) {
+      if (fChunks.empty())
+         fChunks.resize(GetNChunks());
+      std::vector<T> &chunk = fChunks[ichunk];
+      if (chunk.empty())
+         chunk.resize(std::min<Long64_t>(fChunkSize, GetNbins() - ichunk * fChunkSize), T());
+      return chunk.data();
+   }
+
+protected:
+   Int_t fChunkSize;                    ///< Number of bins per chunk
+   std::vector<std::vector<T>> fChunks; ///< Bins by chunk, empty for the chunks which are not allocated
+   ClassDefOverride(TNDArrayChunkedT, 1); // N-dimensional array allocated by chunks
+};
+
 // FIXME: Remove once we implement https://sft.its.cern.ch/jira/browse/ROOT-6284
 // When building with -fmodules, it instantiates all pending instantiations,
 // instead of delaying them until the end of the translation unit.
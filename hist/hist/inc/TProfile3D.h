@@ -107,6 +107,8 @@ public:
    void      ExtendAxis(Double_t x, TAxis *axis) override;
    Int_t     Fill(Double_t x, Double_t y, Double_t z, Double_t t) override;
    virtual Int_t     Fill(Double_t x, Double_t y, Double_t z, Double_t t, Double_t w);
+   virtual void      FillN(Int_t n, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *t,
+                           const Double_t *w, Int_t stride = 1);
    Double_t  GetBinContent(Int_t bin) const override;
    Double_t  GetBinContent(Int_t,Int_t) const override
                      { MayNotUse("GetBinContent(Int_t, Int_t"); return -1; }
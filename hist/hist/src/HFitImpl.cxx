@@ -25,6 +25,7 @@
 #include "Math/WrappedTF1.h"
 #include "Math/WrappedMultiTF1.h"
 
+#include "TEnv.h"
 #include "TList.h"
 #include "TMath.h"
 #include "TROOT.h"
@@ -79,6 +80,11 @@ namespace HFit {
    template <class FitObject>
    double ComputeChi2(const FitObject & h1, TF1 &f1, bool useRange, bool usePL );
 
+#ifdef R__HAS_VECCORE
+   std::unique_ptr<TF1> CreateVectorizedFunction(const TF1 &f1, const Foption_t &fitOption,
+                                                 const ROOT::Fit::BinData &data,
+                                                 const ROOT::Math::MinimizerOptions &minOption);
+#endif
 
 
 }
@@ -117,6 +123,40 @@ int HFit::CheckFitFunction(const TF1 * f1, int dim) {
 }
 
 
+#ifdef R__HAS_VECCORE
+std::unique_ptr<TF1> HFit::CreateVectorizedFunction(const TF1 &f1, const Foption_t &fitOption,
+                                                    const ROOT::Fit::BinData &data,
+                                                    const ROOT::Math::MinimizerOptions &minOption)
+{
+   // Return a vectorized copy of a formula function, to evaluate the chi2 or the likelihood on
+   // ROOT::Double_v, or a null pointer when the function or the fit do not support it.
+   // Can be switched off with Fit.VectorizeFormula: no in the .rootrc
+
+   if (!gEnv->GetValue("Fit.VectorizeFormula", 1))
+      return nullptr;
+   const TFormula *formula = f1.GetFormula();
+   if (!formula || formula->IsVectorized() || !formula->CanBeVectorized())
+      return nullptr;
+   // these options are not implemented by the vectorized evaluation in FitUtil
+   if (fitOption.User || fitOption.Integral || fitOption.PChi2 || fitOption.BinVolume)
+      return nullptr;
+   if (data.GetErrorType() == ROOT::Fit::BinData::kCoordError && data.Opt().fCoordErrors)
+      return nullptr;
+   // nor are the residuals and the point-wise likelihood, used by the least-square minimizers
+   const std::string &type = minOption.MinimizerType();
+   const std::string &algo = minOption.MinimizerAlgorithm();
+   if (type.find("Fumili") != std::string::npos || algo.find("Fumili") != std::string::npos ||
+       type == "GSLMultiFit")
+      return nullptr;
+
+   std::unique_ptr<TF1> vecFunc(ROOT::Math::Internal::CopyTF1Ptr(&f1));
+   vecFunc->SetVectorized(true);
+   if (!vecFunc->IsVectorized() || !vecFunc->GetFormula()->IsValid())
+      return nullptr;
+   return vecFunc;
+}
+#endif
+
 void HFit::GetFunctionRange(const TF1 & f1, ROOT::Fit::DataRange & range) {
    // get the range form the function and fill and return the DataRange object
    Double_t fxmin, fymin, fzmin, fxmax, fymax, fzmax;
@@ -232,11 +272,19 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
 
    // set the fit function
    // if option grad is specified use gradient
+   // formula functions are evaluated with a vectorized copy when possible
+   std::unique_ptr<TF1> vecFunc;
    if ( (linear || fitOption.Gradient) )
       fitter->SetFunction(ROOT::Math::WrappedMultiTF1(*f1));
 #ifdef R__HAS_VECCORE
    else if(f1->IsVectorized())
       fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunctionTempl<ROOT::Double_v> &>(ROOT::Math::WrappedMultiTF1Templ<ROOT::Double_v>(*f1)));
+   else if ((vecFunc = HFit::CreateVectorizedFunction(*f1, fitOption, *fitdata, minOption))) {
+      // the fitter keeps a copy of the wrapper, which must own its function
+      ROOT::Math::WrappedMultiTF1Templ<ROOT::Double_v> vecWrapper(*vecFunc);
+      vecWrapper.SetAndCopyFunction();
+      fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunctionTempl<ROOT::Double_v> &>(vecWrapper));
+   }
 #endif
    else
       fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunction &>(ROOT::Math::WrappedMultiTF1(*f1) ) );
@@ -389,6 +437,13 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
       if ( int( fitResult.Errors().size()) >= f1->GetNpar() )
          f1->SetParErrors( &(fitResult.Errors().front()) );
 
+      // the fitter used the vectorized copy: keep the scalar function in the result
+      // (e.g. for the confidence intervals)
+      if (vecFunc) {
+         auto modelFunc = std::make_shared<ROOT::Math::WrappedMultiTF1>(*f1);
+         modelFunc->SetAndCopyFunction();
+         tfr->SetModelFunction(modelFunc);
+      }
 
    }
 
@@ -2323,6 +2323,74 @@ void TEfficiency::FillWeighted(Bool_t bPassed,Double_t weight,Double_t x,Double_
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// This function is used for filling the two histograms with n events at once.
+///
+/// \param[in] n number of events
+/// \param[in] bPassed array of the flags whether the events passed the selection
+/// \param[in] x array of the x-values
+/// \param[in] y array of the y-values (may be null for 1-D efficiencies)
+/// \param[in] z array of the z-values (may be null for 2-D or 1-D efficiencies)
+/// \param[in] w array of the weights of the events (null if the events are not weighted)
+///
+/// The result is the same as calling Fill() (or FillWeighted() if w is given) for each event,
+/// but for 1-D and 2-D efficiencies the histograms are filled with TH1::FillN, which is faster.
+///
+/// Note: - if w is given, this function will call SetUseWeightedEvents if it was not called by the user before
+
+void TEfficiency::FillN(Int_t n, const Bool_t *bPassed, const Double_t *x, const Double_t *y, const Double_t *z,
+                        const Double_t *w)
+{
+   if (n <= 0)
+      return;
+   const Int_t dim = GetDimension();
+   if ((dim > 1 && !y) || (dim > 2 && !z)) {
+      Error("FillN", "the coordinates of the %d dimensions must be given", dim);
+      return;
+   }
+   if (w && !TestBit(kUseWeights))
+      SetUseWeightedEvents();
+
+   if (dim == 3) {
+      for (Int_t i = 0; i < n; ++i) {
+         if (w)
+            FillWeighted(bPassed[i], w[i], x[i], y[i], z[i]);
+         else
+            Fill(bPassed[i], x[i], y[i], z[i]);
+      }
+      return;
+   }
+
+   // the values of the events which passed the selection, for the passed histogram
+   std::vector<Double_t> px, py, pw;
+   px.reserve(n);
+   if (dim == 2)
+      py.reserve(n);
+   if (w)
+      pw.reserve(n);
+   for (Int_t i = 0; i < n; ++i) {
+      if (!bPassed[i])
+         continue;
+      px.push_back(x[i]);
+      if (dim == 2)
+         py.push_back(y[i]);
+      if (w)
+         pw.push_back(w[i]);
+   }
+   const Int_t np = px.size();
+   const Double_t *passedW = w ? pw.data() : nullptr;
+
+   if (dim == 1) {
+      fTotalHistogram->FillN(n, x, w);
+      if (np > 0)
+         fPassedHistogram->FillN(np, px.data(), passedW);
+   } else {
+      fTotalHistogram->FillN(n, x, y, w, 1);
+      if (np > 0)
+         fPassedHistogram->FillN(np, px.data(), py.data(), passedW, 1);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the global bin number containing the given values
 ///
@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <iostream>
 #include "strlcpy.h"
 #include "snprintf.h"
@@ -1544,6 +1545,56 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at out.size() points, as EvalPar(x, params) for each
+/// of them: x holds the points one after the other, each with GetNdim()
+/// coordinates, and out receives the function values.
+///
+/// Vectorized functions (see IsVectorized()) are evaluated on ROOT::Double_v
+/// packs of points, the others point by point. InitArgs is called as needed
+/// for interpreted functions.
+
+void TF1::EvalParBatch(std::span<const Double_t> x, std::span<Double_t> out, const Double_t *params)
+{
+   const std::size_t ndim = std::max(fNdim, 1);
+   const std::size_t n = out.size();
+   if (x.size() != n * ndim) {
+      Error("EvalParBatch", "%zu coordinates given for %zu points of dimension %zu", x.size(), n, ndim);
+      return;
+   }
+   std::size_t first = 0;
+
+#ifdef R__HAS_VECCORE
+   if (IsVectorized() && (fType == EFType::kFormula || fFunctor)) {
+      if (fType == EFType::kTemplVec && !params)
+         params = fParams->GetParameters();
+      const std::size_t vecSize = vecCore::VectorSize<ROOT::Double_v>();
+      std::vector<ROOT::Double_v> xv(ndim);
+      for (; first + vecSize <= n; first += vecSize) {
+         for (std::size_t d = 0; d < ndim; ++d)
+            for (std::size_t j = 0; j < vecSize; ++j)
+               vecCore::Set<ROOT::Double_v>(xv[d], j, x[(first + j) * ndim + d]);
+         ROOT::Double_v res = fType == EFType::kFormula
+                                 ? fFormula->EvalParVec(xv.data(), params)
+                                 : ((TF1FunctorPointerImpl<ROOT::Double_v> *)fFunctor.get())->fImpl(xv.data(), params);
+         if (fNormalized && fNormIntegral != 0)
+            res = res / fNormIntegral;
+         for (std::size_t j = 0; j < vecSize; ++j)
+            out[first + j] = vecCore::Get<ROOT::Double_v>(res, j);
+      }
+   }
+#endif
+
+   // the remaining points, one by one
+   std::vector<Double_t> xv(ndim);
+   if (fMethodCall)
+      InitArgs(xv.data(), params ? params : GetParameters());
+   for (std::size_t i = first; i < n; ++i) {
+      std::copy(x.begin() + i * ndim, x.begin() + (i + 1) * ndim, xv.begin());
+      out[i] = EvalPar(xv.data(), params);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -2792,12 +2843,23 @@ Double_t TF1::IntegralFast(Int_t num, Double_t * /* x */, Double_t * /* w */, Do
 {
    // Now x and w are not used!
 
-   ROOT::Math::WrappedTF1 wf1(*this);
+   if (num <= 0)
+      return 0;
+   // as ROOT::Math::GaussLegendreIntegrator on a WrappedTF1, with the function evaluated in one batch
    if (params)
-      wf1.SetParameters(params);
+      SetParameters(params);
    ROOT::Math::GaussLegendreIntegrator gli(num, epsilon);
-   gli.SetFunction(wf1);
-   return gli.Integral(a, b);
+   std::vector<Double_t> xx(num), ww(num), values(num);
+   gli.GetWeightVectors(xx.data(), ww.data());
+   const Double_t a0 = (b + a) / 2;
+   const Double_t b0 = (b - a) / 2;
+   for (Int_t i = 0; i < num; i++)
+      xx[i] = a0 + b0 * xx[i];
+   EvalParBatch(xx, values);
+   Double_t result = 0;
+   for (Int_t i = 0; i < num; i++)
+      result += ww[i] * values[i];
+   return result * b0;
 
 }
 
@@ -3065,7 +3127,6 @@ void TF1::Paint(Option_t *choptin)
 TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
 {
    Int_t i;
-   Double_t xv[1];
 
    TH1 *histogram = 0;
 
@@ -3135,11 +3196,12 @@ TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
    histogram->GetYaxis()->SetTitle(ytitle.Data());
    Double_t *parameters = GetParameters();
 
-   InitArgs(xv, parameters);
-   for (i = 1; i <= fNpx; i++) {
-      xv[0] = histogram->GetBinCenter(i);
-      histogram->SetBinContent(i, EvalPar(xv, parameters));
-   }
+   std::vector<Double_t> xv(fNpx), values(fNpx);
+   for (i = 1; i <= fNpx; i++)
+      xv[i - 1] = histogram->GetBinCenter(i);
+   EvalParBatch(xv, values, parameters);
+   for (i = 1; i <= fNpx; i++)
+      histogram->SetBinContent(i, values[i - 1]);
 
    // Copy Function attributes to histogram attributes.
    histogram->SetBit(TH1::kNoStats);
@@ -3188,13 +3250,10 @@ void TF1::Save(Double_t xmin, Double_t xmax, Double_t, Double_t, Double_t, Doubl
          int fNsave = bin2 - bin1 + 4;
          //fSave  = new Double_t[fNsave];
          fSave.resize(fNsave);
-         Double_t xv[1];
-
-         InitArgs(xv, parameters);
-         for (Int_t i = bin1; i <= bin2; i++) {
-            xv[0]    = h->GetXaxis()->GetBinCenter(i);
-            fSave[i - bin1] = EvalPar(xv, parameters);
-         }
+         std::vector<Double_t> xv(bin2 - bin1 + 1);
+         for (Int_t i = bin1; i <= bin2; i++)
+            xv[i - bin1] = h->GetXaxis()->GetBinCenter(i);
+         EvalParBatch(xv, std::span<Double_t>(fSave.data(), xv.size()), parameters);
          fSave[fNsave - 3] = xmin;
          fSave[fNsave - 2] = xmax;
          fSave[fNsave - 1] = xmax;
@@ -3214,12 +3273,10 @@ void TF1::Save(Double_t xmin, Double_t xmax, Double_t, Double_t, Double_t, Doubl
       xmin = fXmin + 0.5 * dx;
       xmax = fXmax - 0.5 * dx;
    }
-   Double_t xv[1];
-   InitArgs(xv, parameters);
-   for (Int_t i = 0; i <= fNpx; i++) {
-      xv[0]    = xmin + dx * i;
-      fSave[i] = EvalPar(xv, parameters);
-   }
+   std::vector<Double_t> xv(fNpx + 1);
+   for (Int_t i = 0; i <= fNpx; i++)
+      xv[i] = xmin + dx * i;
+   EvalParBatch(xv, std::span<Double_t>(fSave.data(), fNpx + 1), parameters);
    fSave[fNpx + 1] = xmin;
    fSave[fNpx + 2] = xmax;
 }
@@ -24,6 +24,7 @@
 
 #include "ROOT/StringUtils.hxx"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <iostream>
@@ -247,6 +248,14 @@ ClassImp(TFormula);
     function. That means the expression `x@2` will be expanded to
     ```[n]*x + [n+1]*2``` where n is the first previously unused parameter number.
 
+    ### Compilation of the expressions
+
+    The expressions are compiled with Cling, once per process: formulas with the same
+    expression share the compiled function. Applications creating many formulas, e.g.
+    a TF1 per channel of a detector of which only a few are fitted, can defer the
+    compilation to the first evaluation with TFormula::DefaultLazyJitting(). The
+    errors of an expression which cannot be compiled are then reported at that time.
+
     \class TFormulaFunction
     Helper class for TFormula
 
@@ -494,6 +503,7 @@ TFormula::TFormula(const char *name, const char *formula, bool addToGlobList, bo
 #ifndef R__HAS_VECCORE
    fVectorized = false;
 #endif
+   fLazyInitialization = fgLazyJitting;
 
    FillDefaults();
 
@@ -963,14 +973,9 @@ void TFormula::FillDefaults()
    }
 }
 
-////////////////////////////////////////////////////////////////////////////////
-///    Fill the shortcuts for vectorized functions
-///    We will replace for example sin with vecCore::Mat::Sin
-///
-
-void TFormula::FillVecFunctionsShurtCuts() {
+// functions which have a vectorized version, used for the shortcuts and by CanBeVectorized
 #ifdef R__HAS_VECCORE
-   const pair<TString,TString> vecFunShortcuts[] =
+static const pair<TString,TString> gVecFunShortcuts[] =
       { {"sin","vecCore::math::Sin" },
         {"cos","vecCore::math::Cos" }, {"exp","vecCore::math::Exp"}, {"log","vecCore::math::Log"}, {"log10","vecCore::math::Log10"},
         {"tan","vecCore::math::Tan"},
@@ -984,8 +989,17 @@ void TFormula::FillVecFunctionsShurtCuts() {
         {"min","vecCore::math::Min"},{"max","vecCore::math::Max"},{"sign","vecCore::math::Sign" }
         //{"sq","TMath::Sq"}, {"binomial","TMath::Binomial"}  // this last two functions will not work in vectorized mode
       };
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+///    Fill the shortcuts for vectorized functions
+///    We will replace for example sin with vecCore::Mat::Sin
+///
+
+void TFormula::FillVecFunctionsShurtCuts() {
+#ifdef R__HAS_VECCORE
    // replace in the data member maps fFunctionsShortcuts
-   for (auto fun : vecFunShortcuts) {
+   for (auto fun : gVecFunShortcuts) {
       fFunctionsShortcuts[fun.first] = fun.second;
    }
 #endif
@@ -1812,7 +1826,7 @@ Bool_t TFormula::PrepareFormula(TString &formula)
    // for pre-defined functions (need after processing)
    if (fNumber != 0) SetPredefinedParamNames();
 
-   return fReadyToExecute && fClingInitialized;
+   return IsValid();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3120,6 +3134,40 @@ void TFormula::SetVectorized(Bool_t vectorized)
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the formula can be evaluated on vectors of type ROOT::Double_v, i.e. if
+/// calling SetVectorized(true) is expected to produce a valid vectorized expression.
+/// This is the case when ROOT is built with VecCore and the expression only uses
+/// arithmetic operators and the functions with a vectorized version (sin, exp, pow, ...).
+/// Conditional or logical operators, lambda expressions, linear formulas and calls to other
+/// functions (e.g. TMath::Landau) are not supported.
+
+Bool_t TFormula::CanBeVectorized() const
+{
+#ifdef R__HAS_VECCORE
+   if (fVectorized)
+      return true;
+   if (fNdim == 0 || TestBit(kLambda) || !fLinearParts.empty() || fFormula.IsNull())
+      return false;
+   // comparisons and logical operators produce masks on vectors
+   if (fFormula.First("?<>!&|%") != kNPOS)
+      return false;
+   // fFuncs is not streamed: without it the used functions are unknown
+   if (fFuncs.empty() && fFormula.First('(') != kNPOS)
+      return false;
+   for (auto &fun : fFuncs) {
+      if (!fun.IsFuncCall())
+         continue;
+      auto isVec = [&fun](const pair<TString, TString> &sc) { return sc.first == fun.GetName(); };
+      if (std::none_of(std::begin(gVecFunShortcuts), std::end(gVecFunShortcuts), isVec))
+         return false;
+   }
+   return true;
+#else
+   return false;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 {
@@ -3165,6 +3213,7 @@ Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 }
 
 bool TFormula::fIsCladRuntimeIncluded = false;
+std::atomic<Bool_t> TFormula::fgLazyJitting(kFALSE);
 
 static bool functionExists(const string &Name) {
    return gInterpreter->GetFunction(/*cl*/0, Name.c_str());
@@ -3254,6 +3303,11 @@ bool TFormula::GenerateGradientPar() {
    if (HasGradientGenerationFailed())
       return false;
 
+   // the gradient is generated from the compiled formula
+   LazyInitializeEvalMethod();
+   if (!fClingInitialized)
+      return false;
+
    IncludeCladRuntime(fIsCladRuntimeIncluded);
 
    // Check if the gradient request was made as part of another TFormula.
@@ -3319,6 +3373,11 @@ bool TFormula::GenerateHessianPar()
    if (HasHessianGenerationFailed())
       return false;
 
+   // the hessian is generated from the compiled formula
+   LazyInitializeEvalMethod();
+   if (!fClingInitialized)
+      return false;
+
    IncludeCladRuntime(fIsCladRuntimeIncluded);
 
    // Check if the hessian request was made as part of another TFormula.
@@ -3551,6 +3610,34 @@ ROOT::Double_v TFormula::DoEvalVec(const ROOT::Double_v *x, const double *params
 #endif // R__HAS_VECCORE
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compile the formula now if its compilation was deferred (lazy initialization),
+/// as DoEval does at the first evaluation.
+
+void TFormula::LazyInitializeEvalMethod()
+{
+   if (fClingInitialized || !fLazyInitialization)
+      return;
+   R__LOCKGUARD(gROOTMutex);
+   // check again in case another thread has initialized the formula
+   if (!fClingInitialized)
+      ReInitializeEvalMethod();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static method to compile the expressions of the formulas (and of the TF1s based
+/// on a formula) at their first evaluation instead of at their construction.
+/// After having called this static method, all the formulas created afterwards
+/// will follow the desired behaviour. Identical expressions are only compiled once.
+///
+/// By default the expressions are compiled immediately.
+/// It returns the previous status (true if the compilation is deferred)
+
+Bool_t TFormula::DefaultLazyJitting(Bool_t on)
+{
+   return fgLazyJitting.exchange(on);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /// Re-initialize eval method
 ///
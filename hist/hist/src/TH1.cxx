@@ -3473,22 +3473,30 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
    fEntries += ntimes;
    Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
-   ntimes *= stride;
-   for (i=0;i<ntimes;i+=stride) {
-      bin =fXaxis.FindBin(x[i]);
-      if (bin <0) continue;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin, ww);
-      if (bin == 0 || bin > nbins) {
-         if (!GetStatOverflowsBehaviour()) continue;
-      }
-      Double_t z= ww;
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
+   // if the axis can't be extended, the bins are found for chunks of values at a time
+   constexpr Int_t kChunk = 256;
+   Int_t bins[kChunk];
+   const Bool_t findBins = !fXaxis.CanExtend();
+   for (Int_t first = 0; first < ntimes; first += kChunk) {
+      const Int_t nchunk = TMath::Min(kChunk, ntimes - first);
+      if (findBins) fXaxis.FindFixBins(nchunk, &x[first*stride], bins, stride);
+      for (Int_t j = 0; j < nchunk; ++j) {
+         i = (first+j)*stride;
+         bin = (findBins) ? bins[j] : fXaxis.FindBin(x[i]);
+         if (bin <0) continue;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin, ww);
+         if (bin == 0 || bin > nbins) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         Double_t z= ww;
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
+      }
    }
 }
 
@@ -8,14 +8,100 @@
 #include "TError.h"
 #include "THashList.h"
 #include "TClass.h"
+#include <algorithm>
+#include <initializer_list>
 #include <iostream>
 #include <limits>
 #include <utility>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 #define PRINTRANGE(a, b, bn)                                                                                          \
    Printf(" base: %f %f %d, %s: %f %f %d", a->GetXmin(), a->GetXmax(), a->GetNbins(), bn, b->GetXmin(), b->GetXmax(), \
           b->GetNbins());
 
+namespace {
+
+/// Minimum number of bins times histograms of a merge for which it is worth to split it between threads
+constexpr Long64_t kMinParallelMergeCells = 1000000;
+/// Number of bins merged by a task
+constexpr Int_t kMergeBlockCells = 16384;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(first, last) for consecutive blocks of the ncells bins, on the threads of
+/// the IMT pool if ROOT::EnableImplicitMT() was called and the merge is large enough.
+
+template <class F>
+void ForCellBlocks(Int_t ncells, Long64_t nops, F &&func)
+{
+#ifdef R__USE_IMT
+   const Int_t nBlocks = (ncells + kMergeBlockCells - 1) / kMergeBlockCells;
+   if (nBlocks > 1 && nops >= kMinParallelMergeCells && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](Int_t b) {
+            const Int_t first = b * kMergeBlockCells;
+            func(first, std::min(ncells, first + kMergeBlockCells));
+         },
+         ROOT::TSeqI(nBlocks));
+      return;
+   }
+#else
+   (void)nops;
+#endif
+   func(0, ncells);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bin contents and sums of squares of weights of hists to h, with loops
+/// on their arrays of type ARRAY (holding T) which can be vectorized. Each block
+/// of bins adds the histograms in the order of the list, so the result does not
+/// depend on the number of threads and is the same as with TH1::AddBinContent.
+/// Return kFALSE without merging if the histograms are not all of the same class
+/// among `classes`, whose bin contents are just the ARRAY.
+
+template <class ARRAY, class T>
+Bool_t MergeCellArrays(TH1 *h, const std::vector<TH1 *> &hists, std::initializer_list<TClass *> classes)
+{
+   TClass *cl = h->IsA();
+   if (std::find(classes.begin(), classes.end(), cl) == classes.end())
+      return kFALSE;
+   std::vector<const T *> contents;
+   std::vector<const Double_t *> sumw2s;
+   for (auto hist : hists) {
+      if (hist->IsA() != cl)
+         return kFALSE;
+      contents.push_back(dynamic_cast<ARRAY *>(hist)->fArray);
+      sumw2s.push_back(hist->GetSumw2N() ? hist->GetSumw2()->fArray : nullptr);
+   }
+   T *out = dynamic_cast<ARRAY *>(h)->fArray;
+   Double_t *outSumw2 = h->GetSumw2N() ? h->GetSumw2()->fArray : nullptr;
+
+   ForCellBlocks(h->GetNcells(), Long64_t(h->GetNcells()) * hists.size(), [&](Int_t first, Int_t last) {
+      for (size_t ih = 0; ih < contents.size(); ++ih) {
+         const T *in = contents[ih];
+         for (Int_t i = first; i < last; ++i)
+            out[i] += in[i];
+         if (!outSumw2)
+            continue;
+         if (const Double_t *inSumw2 = sumw2s[ih]) {
+            for (Int_t i = first; i < last; ++i)
+               outSumw2[i] += inSumw2[i];
+         } else {
+            for (Int_t i = first; i < last; ++i)
+               outSumw2[i] += in[i];
+         }
+      }
+   });
+   return kTRUE;
+}
+
+} // namespace
+
 Bool_t TH1Merger::AxesHaveLimits(const TH1 * h) {
    Bool_t hasLimits = h->GetXaxis()->GetXmin() < h->GetXaxis()->GetXmax();
    if (h->GetDimension() > 1) hasLimits &=  h->GetYaxis()->GetXmin() < h->GetYaxis()->GetXmax();
@@ -762,6 +848,7 @@ Bool_t TH1Merger::SameAxesMerge() {
    fH0->GetStats(totstats);
    Double_t nentries = fH0->GetEntries();
 
+   std::vector<TH1 *> hists;
    TIter next(&fInputList);
    while (TH1* hist=(TH1*)next()) {
       // process only if the histogram has limits; otherwise it was processed before
@@ -778,11 +865,19 @@ Bool_t TH1Merger::SameAxesMerge() {
       for (Int_t i=0; i<TH1::kNstat; i++)
          totstats[i] += stats[i];
       nentries += hist->GetEntries();
+      hists.push_back(hist);
+   }
 
-         //Int_t nx = hist->GetXaxis()->GetNbins();
+   // fast path for the histograms of doubles or floats: merge the arrays, in parallel for large ones
+   Bool_t merged = !fIsProfileMerge &&
+                   (MergeCellArrays<TArrayD, Double_t>(fH0, hists, {TH1D::Class(), TH2D::Class(), TH3D::Class()}) ||
+                    MergeCellArrays<TArrayF, Float_t>(fH0, hists, {TH1F::Class(), TH2F::Class(), TH3F::Class()}));
+   if (!merged) {
+      for (auto hist : hists) {
          // loop on bins of the histogram and do the merge
-      for (Int_t ibin = 0; ibin < hist->fNcells; ibin++) {
-         MergeBin(hist, ibin, ibin);
+         for (Int_t ibin = 0; ibin < hist->fNcells; ibin++) {
+            MergeBin(hist, ibin, ibin);
+         }
       }
    }
    //copy merged stats
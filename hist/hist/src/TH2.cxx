@@ -617,30 +617,44 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
    }
 
    Double_t ww = 1;
-   for (i=ifirst;i<ntimes;i+=stride) {
-      fEntries++;
-      binx = fXaxis.FindBin(x[i]);
-      biny = fYaxis.FindBin(y[i]);
-      if (binx <0 || biny <0) continue;
-      bin  = biny*(fXaxis.GetNbins()+2) + binx;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin,ww);
-      if (binx == 0 || binx > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   // if the axes can't be extended, the bins are found for chunks of values at a time
+   constexpr Int_t kChunk = 256;
+   Int_t binsx[kChunk], binsy[kChunk];
+   const Bool_t findBins = !fXaxis.CanExtend() && !fYaxis.CanExtend();
+   const Int_t nfill = (ntimes - ifirst) / stride;
+   for (Int_t first = 0; first < nfill; first += kChunk) {
+      const Int_t nchunk = TMath::Min(kChunk, nfill - first);
+      const Int_t ichunk = ifirst + first*stride;
+      if (findBins) {
+         fXaxis.FindFixBins(nchunk, &x[ichunk], binsx, stride);
+         fYaxis.FindFixBins(nchunk, &y[ichunk], binsy, stride);
       }
-      if (biny == 0 || biny > fYaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+      for (Int_t j = 0; j < nchunk; ++j) {
+         i = ichunk + j*stride;
+         fEntries++;
+         binx = (findBins) ? binsx[j] : fXaxis.FindBin(x[i]);
+         biny = (findBins) ? binsy[j] : fYaxis.FindBin(y[i]);
+         if (binx <0 || biny <0) continue;
+         bin  = biny*(fXaxis.GetNbins()+2) + binx;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin,ww);
+         if (binx == 0 || binx > fXaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         if (biny == 0 || biny > fYaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         Double_t z= ww; //(ww > 0 ? ww : -ww);
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
+         fTsumwy  += z*y[i];
+         fTsumwy2 += z*y[i]*y[i];
+         fTsumwxy += z*x[i]*y[i];
       }
-      Double_t z= ww; //(ww > 0 ? ww : -ww);
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
-      fTsumwy  += z*y[i];
-      fTsumwy2 += z*y[i]*y[i];
-      fTsumwxy += z*x[i]*y[i];
    }
 }
 
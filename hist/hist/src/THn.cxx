@@ -143,6 +143,12 @@ classes:
     THnS (typedef for THnT<Short_t>): bin content held by a Short_t,
     THnC (typedef for THnT<Char_t>): bin content held by a Char_t,
 
+or, for histograms of which large regions stay empty, of THnChunkedT which
+only allocates the chunks of bins which are filled:
+
+    THnChunkedD (typedef for THnChunkedT<Double_t>): bin content held by a Double_t,
+    THnChunkedF (typedef for THnChunkedT<Float_t>): bin content held by a Float_t,
+
 They take name and title, the number of dimensions, and for each dimension
 the number of bins, the minimal, and the maximal value on the dimension's
 axis. A TH2F h("h","h",10, 0., 10., 20, -5., 5.) would correspond to
@@ -31,6 +31,9 @@
 #include "Math/MinimizerOptions.h"
 #include "Math/WrappedMultiTF1.h"
 
+#include <algorithm>
+#include <vector>
+
 
 /** \class THnBase
     \ingroup Hist
@@ -181,6 +184,8 @@ THnBase* THnBase::CloneEmpty(const char* name, const char* title,
    Int_t chunkSize = 1024 * 16;
    if (InheritsFrom(THnSparse::Class())) {
       chunkSize = ((const THnSparse*)this)->GetChunkSize();
+   } else if (InheritsFrom(THn::Class()) && ((const THn*)this)->GetArray().GetChunkSize() > 0) {
+      chunkSize = ((const THn*)this)->GetArray().GetChunkSize();
    }
    ret->Init(name, title, axes, keepTargetAxis, chunkSize);
    return ret;
@@ -727,6 +732,34 @@ void THnBase::Scale(Double_t c)
    SetEntries(nEntries);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the n points of fNdimensions coordinates stored one after the other in
+/// x, i.e. x[i * fNdimensions + d] is the coordinate of point i on axis d, with
+/// the weights w (or 1 if w is null).
+/// The result is the same as calling Fill(x + i * fNdimensions, w[i]) for each
+/// point, but the bins of each axis are computed by batches with
+/// TAxis::FindFixBins.
+
+void THnBase::FillN(Long64_t n, const Double_t *x, const Double_t *w /*= nullptr*/)
+{
+   constexpr Int_t kChunk = 256;
+   std::vector<Int_t> axisBins(kChunk * fNdimensions);
+   std::vector<Int_t> coord(fNdimensions);
+   for (Long64_t first = 0; first < n; first += kChunk) {
+      const Int_t nchunk = (Int_t)std::min<Long64_t>(kChunk, n - first);
+      const Double_t *xchunk = x + first * fNdimensions;
+      for (Int_t d = 0; d < fNdimensions; ++d)
+         GetAxis(d)->FindFixBins(nchunk, xchunk + d, &axisBins[d * kChunk], fNdimensions);
+      for (Int_t i = 0; i < nchunk; ++i) {
+         for (Int_t d = 0; d < fNdimensions; ++d)
+            coord[d] = axisBins[d * kChunk + i];
+         const Double_t wi = w ? w[first + i] : 1.;
+         UpdateXStat(xchunk + i * fNdimensions, wi);
+         FillBin(GetBin(coord.data(), kTRUE /*alloc*/), wi);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add() implementation for both rebinned histograms and those with identical
 /// binning. See THnBase::Add().
@@ -318,9 +318,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin index.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the hash of the bin index.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -570,14 +570,14 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the member fBinIndex, an open
+addressing hash table with linear probing that stores the hash next to the
+linear index of each filled bin, so that a lookup usually reads a single cache
+line. The slots following the one of the hash are compared until an empty
+slot is found; if the stored hash is the same, the coordinates of the bin are
+compared to the coordinates passed to GetBin(). They can only differ for the
+case where the compact bin coordinates are larger than 8 bytes, which is
+extremely unlikely but possible. The table is kept at most half full.
 */
 
 
@@ -649,36 +649,61 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
    fCompactCoord = new THnSparseCompactBinCoord(fNdimensions, nbins);
 }
 
+namespace {
+/// Position of a hash in the bin index: the compact coordinates used as hashes
+/// differ mostly in their low bits, spread them over all bits.
+inline ULong64_t BinIndexSlot(ULong64_t hash, ULong64_t mask)
+{
+   hash *= 0x9E3779B97F4A7C15ULL;
+   return (hash ^ (hash >> 29)) & mask;
+}
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rebuild the bin index with at least nslots slots (rounded up to a power of two)
+
+void THnSparse::ResizeBinIndex(Long64_t nslots)
+{
+   ULong64_t size = 16;
+   while ((Long64_t)size < nslots)
+      size *= 2;
+   std::vector<ULong64_t> oldIndex(2 * size, 0);
+   oldIndex.swap(fBinIndex);
+   const ULong64_t mask = size - 1;
+   for (size_t i = 0; i < oldIndex.size(); i += 2) {
+      if (!oldIndex[i + 1])
+         continue;
+      ULong64_t slot = BinIndexSlot(oldIndex[i], mask);
+      while (fBinIndex[2 * slot + 1])
+         slot = (slot + 1) & mask;
+      fBinIndex[2 * slot] = oldIndex[i];
+      fBinIndex[2 * slot + 1] = oldIndex[i + 1];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+///We have been streamed; set up fBinIndex
 
-void THnSparse::FillExMap()
+void THnSparse::FillBinIndex()
 {
    TIter iChunk(&fBinContent);
    THnSparseArrayChunk* chunk = 0;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   ResizeBinIndex(4 * GetNbins());
+   const ULong64_t mask = fBinIndex.size() / 2 - 1;
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
       for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
+         ULong64_t hash = compactCoord.GetHashFromBuffer(buf);
+         ULong64_t slot = BinIndexSlot(hash, mask);
+         while (fBinIndex[2 * slot + 1])
+            slot = (slot + 1) & mask;
+         fBinIndex[2 * slot] = hash;
+         fBinIndex[2 * slot + 1] = idx + 1;
       }
    }
 }
@@ -687,11 +712,11 @@ void THnSparse::FillExMap()
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
-      FillExMap();
+   if (fBinIndex.empty() && fBinContent.GetSize()) {
+      FillBinIndex();
    }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
+   if (2 * nbins > (Long64_t)fBinIndex.size() / 2) {
+      ResizeBinIndex(4 * nbins);
    }
 }
 
@@ -790,19 +815,22 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
-      FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
+   if (fBinIndex.empty()) {
+      if (fBinContent.GetSize())
+         FillBinIndex();
+      else
+         ResizeBinIndex(0);
+   }
+   const ULong64_t mask = fBinIndex.size() / 2 - 1;
+   ULong64_t slot = BinIndexSlot(hash, mask);
+   while (Long64_t linidx = (Long64_t) fBinIndex[2 * slot + 1]) {
+      // fBinIndex stores index + 1, 0 is an empty slot
+      if (fBinIndex[2 * slot] == hash) {
+         THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
+         if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
+            return linidx - 1;
+      }
+      slot = (slot + 1) & mask;
    }
    if (!allocate) return -1;
 
@@ -817,18 +845,12 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
    }
    chunk->AddBin(newidx, cc->GetBuffer());
 
-   // store translation between hash and bin
+   // store translation between hash and bin in the empty slot ending the probe
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBinIndex[2 * slot] = hash;
+   fBinIndex[2 * slot + 1] = newidx + 1;
+   if (2 * GetNbins() > (Long64_t)(mask + 1))
+      ResizeBinIndex(4 * GetNbins());
    return newidx;
 }
 
@@ -880,7 +902,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += sizeof(ULong64_t) * fBinIndex.size() /* fBinIndex */;
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +984,7 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   std::vector<ULong64_t>().swap(fBinIndex);
    fBinContent.Delete();
    ResetBase(option);
 }
@@ -31,6 +31,7 @@
 #include <numeric>
 #include <limits>
 #include <cassert>
+#include <cmath>
 
 #include "Math/Error.h"
 #include "TMath.h"
@@ -770,8 +771,32 @@ TKDE::TKernel::TKernel(Double_t weight, TKDE* kde) :
 // Internal class constructor
 fKDE(kde),
 fNWeights(kde->fData.size()),
-fWeights(1, weight)
-{}
+fWeights(1, weight),
+fSupport(0),
+fMaxWeight(weight)
+{
+   // The internal kernels are zero beyond a known number of bandwidths: the density is then computed only from the
+   // data points within this distance, found by binary search in the sorted data, instead of all of them
+   switch (kde->fKernelType) {
+      case kGaussian: fSupport = 9.; break;
+      case kEpanechnikov:
+      case kBiweight:
+      case kCosineArch: fSupport = 1.; break;
+      default: return;
+   }
+   const std::vector<Double_t> &data = kde->fData;
+   if (std::find_if(data.begin(), data.end(), [](Double_t d) { return !std::isfinite(d); }) != data.end()) {
+      fSupport = 0;
+      return;
+   }
+   fSortedIndex.resize(data.size());
+   std::iota(fSortedIndex.begin(), fSortedIndex.end(), 0);
+   // stable: the binned data (bin centres) are summed in the same order as without the sorting
+   std::stable_sort(fSortedIndex.begin(), fSortedIndex.end(), [&](UInt_t i, UInt_t j) { return data[i] < data[j]; });
+   fSortedData.resize(data.size());
+   for (UInt_t i = 0; i < data.size(); ++i)
+      fSortedData[i] = data[fSortedIndex[i]];
+}
 
 void TKDE::TKernel::ComputeAdaptiveWeights() {
    // Gets the adaptive weights (bandwidths) for TKernel internal computation
@@ -808,6 +833,7 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    fWeights.resize(n);
    transform(weights.begin(), weights.end(), fWeights.begin(),
              std::bind(std::multiplies<Double_t>(), std::placeholders::_1, fKDE->fAdaptiveBandwidthFactor));
+   fMaxWeight = n > 0 ? *std::max_element(fWeights.begin(), fWeights.end()) : fWeights[0];
    //printf("adaptive bandwidth factor % f weight 0 %f , %f \n",fKDE->fAdaptiveBandwidthFactor, weights[0],fWeights[0] );
 }
 
@@ -1019,6 +1045,18 @@ Double_t TKDE::TKernel::operator()(Double_t x) const {
    //if (!useCount) nSum = fKDE->fNEvents;
    // in case of non-adaptive fWeights is a vector of size 1
    Bool_t hasAdaptiveWeights = (fWeights.size() == n);
+   if (fSupport > 0 && fSortedData.size() == n) {
+      // only the data points (or their reflections) within the kernel support
+      AddSupport(x, x, kFALSE, 0., useCount, result);
+      if (fKDE->fAsymLeft)
+         AddSupport(x, 2. * fKDE->fXMin - x, kTRUE, 2. * fKDE->fXMin, useCount, result);
+      if (fKDE->fAsymRight)
+         AddSupport(x, 2. * fKDE->fXMax - x, kTRUE, 2. * fKDE->fXMax, useCount, result);
+      if ( TMath::IsNaN(result) ) {
+         fKDE->Warning("operator()","Result is NaN for  x %f \n",x);
+      }
+      return result / nSum;
+   }
    Double_t invWeight = (!hasAdaptiveWeights) ? 1. / fWeights[0] : 0;
    for (UInt_t i = 0; i < n; ++i) {
       Double_t binCount = (useCount) ? fKDE->fBinCount[i] : 1.0;
@@ -1045,6 +1083,30 @@ Double_t TKDE::TKernel::operator()(Double_t x) const {
    return result / nSum;
 }
 
+////////////////////////////////////////////////////
+/// Add to result the kernels at x of the data points d within the kernel support around centre, or of their
+/// reflections mirror - d if reflect is true. These are the only non-zero terms of the sum in operator()
+
+void TKDE::TKernel::AddSupport(Double_t x, Double_t centre, Bool_t reflect, Double_t mirror, Bool_t useCount,
+                               Double_t &result) const
+{
+   const Double_t halfWidth = fSupport * fMaxWeight;
+   const Bool_t hasAdaptiveWeights = (fWeights.size() == fSortedData.size());
+   Double_t invWeight = (!hasAdaptiveWeights) ? 1. / fWeights[0] : 0;
+   auto first = std::lower_bound(fSortedData.begin(), fSortedData.end(), centre - halfWidth);
+   auto last = std::upper_bound(first, fSortedData.end(), centre + halfWidth);
+   for (auto it = first; it != last; ++it) {
+      const UInt_t i = fSortedIndex[it - fSortedData.begin()];
+      Double_t binCount = (useCount) ? fKDE->fBinCount[i] : 1.0;
+      if (hasAdaptiveWeights) {
+         if (fWeights[i] == 0) continue;
+         invWeight = 1. / fWeights[i];
+      }
+      const Double_t d = fKDE->fData[i];
+      result += binCount * invWeight * (*fKDE->fKernelFunction)((x - (reflect ? mirror - d : d)) * invWeight);
+   }
+}
+
 ////////////////////////////////////////////////////
 /// compute the bin index given a data point x
 UInt_t TKDE::Index(Double_t x) const {
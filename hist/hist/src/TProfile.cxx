@@ -768,7 +768,9 @@ Int_t TProfile::Fill(const char *namex, Double_t y, Double_t w)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Fill a Profile histogram with weights.
+/// Fill a Profile histogram with ntimes values x[i*stride], y[i*stride] and (if w is not null) the
+/// weights w[i*stride]. When the axis can't be extended, the bins are found for many values at a time,
+/// which is faster than calling Fill() for each of them.
 
 void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *w, Int_t stride)
 {
@@ -790,28 +792,39 @@ void TProfile::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const D
          return;
    }
 
-   for (i=ifirst;i<ntimes;i+=stride) {
-      if (fYmin != fYmax) {
-         if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
-      }
+   // if the axis can't be extended, the bins are found for chunks of values at a time
+   const Int_t n = (ntimes - ifirst + stride - 1) / stride;
+   constexpr Int_t kChunk = 256;
+   Int_t bins[kChunk];
+   const Bool_t findBins = !fXaxis.CanExtend();
+   for (Int_t first = 0; first < n; first += kChunk) {
+      const Int_t nchunk = TMath::Min(kChunk, n - first);
+      if (findBins) fXaxis.FindFixBins(nchunk, &x[ifirst + first*stride], bins, stride);
+      for (Int_t j = 0; j < nchunk; ++j) {
+         i = ifirst + (first+j)*stride;
+         if (fYmin != fYmax) {
+            if (y[i] <fYmin || y[i]> fYmax || TMath::IsNaN(y[i])) continue;
+         }
 
-      Double_t u = (w) ? w[i] : 1; // (w[i] > 0 ? w[i] : -w[i]);
-      fEntries++;
-      bin =fXaxis.FindBin(x[i]);
-      AddBinContent(bin, u*y[i]);
-      fSumw2.fArray[bin] += u*y[i]*y[i];
-      if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();  // must be called before accumulating the entries
-      if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
-      fBinEntries.fArray[bin] += u;
-      if (bin == 0 || bin > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+         Double_t u = (w) ? w[i] : 1; // (w[i] > 0 ? w[i] : -w[i]);
+         fEntries++;
+         bin = (findBins) ? bins[j] : fXaxis.FindBin(x[i]);
+         AddBinContent(bin, u*y[i]);
+         fSumw2.fArray[bin] += u*y[i]*y[i];
+         if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))
+            Sumw2(); // must be called before accumulating the entries
+         if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if (bin == 0 || bin > fXaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         fTsumw   += u;
+         fTsumw2  += u*u;
+         fTsumwx  += u*x[i];
+         fTsumwx2 += u*x[i]*x[i];
+         fTsumwy  += u*y[i];
+         fTsumwy2 += u*y[i]*y[i];
       }
-      fTsumw   += u;
-      fTsumw2  += u*u;
-      fTsumwx  += u*x[i];
-      fTsumwx2 += u*x[i]*x[i];
-      fTsumwy  += u*y[i];
-      fTsumwy2 += u*y[i]*y[i];
    }
 }
 
@@ -685,6 +685,75 @@ Int_t TProfile3D::Fill(Double_t x, Double_t y, Double_t z, Double_t t, Double_t
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a Profile3D histogram with n values x[i*stride], y[i*stride], z[i*stride], t[i*stride] and (if w
+/// is not null) the weights w[i*stride]. The result is the same as calling Fill() for each value, but when
+/// the axes can't be extended the bins are found for many values at a time, which is faster.
+
+void TProfile3D::FillN(Int_t n, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *t,
+                       const Double_t *w, Int_t stride)
+{
+   if (fBuffer || fXaxis.CanExtend() || fYaxis.CanExtend() || fZaxis.CanExtend()) {
+      for (Int_t i = 0; i < n; ++i) {
+         const Int_t k = i*stride;
+         Fill(x[k], y[k], z[k], t[k], w ? w[k] : 1.);
+      }
+      return;
+   }
+
+   const Int_t nx = fXaxis.GetNbins();
+   const Int_t ny = fYaxis.GetNbins();
+   const Int_t nz = fZaxis.GetNbins();
+   constexpr Int_t kChunk = 256;
+   Int_t binsx[kChunk];
+   Int_t binsy[kChunk];
+   Int_t binsz[kChunk];
+   for (Int_t first = 0; first < n; first += kChunk) {
+      const Int_t nchunk = TMath::Min(kChunk, n - first);
+      fXaxis.FindFixBins(nchunk, &x[first*stride], binsx, stride);
+      fYaxis.FindFixBins(nchunk, &y[first*stride], binsy, stride);
+      fZaxis.FindFixBins(nchunk, &z[first*stride], binsz, stride);
+      for (Int_t j = 0; j < nchunk; ++j) {
+         const Int_t k = (first+j)*stride;
+         const Double_t tk = t[k];
+         if (fTmin != fTmax) {
+            if (tk <fTmin || tk> fTmax || TMath::IsNaN(tk) ) continue;
+         }
+         const Double_t u = w ? w[k] : 1.;
+         fEntries++;
+         const Int_t binx = binsx[j];
+         const Int_t biny = binsy[j];
+         const Int_t binz = binsz[j];
+         const Int_t bin  = GetBin(binx,biny,binz);
+         AddBinContent(bin, u*tk);
+         fSumw2.fArray[bin] += u*tk*tk;
+         if (!fBinSumw2.fN && u != 1.0 && !TestBit(TH1::kIsNotW))
+            Sumw2(); // must be called before accumulating the entries
+         if (fBinSumw2.fN)  fBinSumw2.fArray[bin] += u*u;
+         fBinEntries.fArray[bin] += u;
+         if (binx == 0 || binx > nx || biny == 0 || biny > ny || binz == 0 || binz > nz) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         const Double_t xk = x[k];
+         const Double_t yk = y[k];
+         const Double_t zk = z[k];
+         fTsumw   += u;
+         fTsumw2  += u*u;
+         fTsumwx  += u*xk;
+         fTsumwx2 += u*xk*xk;
+         fTsumwy  += u*yk;
+         fTsumwy2 += u*yk*yk;
+         fTsumwxy += u*xk*yk;
+         fTsumwz  += u*zk;
+         fTsumwz2 += u*zk*zk;
+         fTsumwxz += u*xk*zk;
+         fTsumwyz += u*yk*zk;
+         fTsumwt  += u*tk;
+         fTsumwt2 += u*tk*tk;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return bin content of a Profile3D histogram.
 
@@ -1,8 +1,13 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TRandom3.h"
+
+#include <memory>
+#include <vector>
 
 // Filling THn
 TEST(THn, Fill) {
@@ -111,3 +116,113 @@ TEST(THn, Projection) {
    }
 
 }
+
+// Filling THnSparse, with compact coordinates shorter and longer than 8 bytes
+TEST(THnSparse, FillN) {
+   for (Int_t dim : {3, 10}) {
+      std::vector<Int_t> bins(dim, 100);
+      std::vector<Double_t> xmin(dim, -3.);
+      std::vector<Double_t> xmax(dim, 3.);
+      THnSparseD hs("hs", "hs", dim, bins.data(), xmin.data(), xmax.data());
+      THnSparseD hsn("hsn", "hsn", dim, bins.data(), xmin.data(), xmax.data());
+      THnD hn("hn", "hn", 3, bins.data(), xmin.data(), xmax.data());
+      THnD hnn("hnn", "hnn", 3, bins.data(), xmin.data(), xmax.data());
+      hs.Sumw2();
+      hsn.Sumw2();
+
+      TRandom3 r(dim);
+      const Long64_t n = 5000;
+      std::vector<Double_t> x(n * dim), x3(n * 3), w(n);
+      for (Long64_t i = 0; i < n; ++i) {
+         for (Int_t d = 0; d < dim; ++d)
+            x[i * dim + d] = r.Gaus(0., 1.);
+         for (Int_t d = 0; d < 3; ++d)
+            x3[i * 3 + d] = x[i * dim + d];
+         w[i] = r.Uniform(0.5, 1.5);
+      }
+      // fill each point twice, so that most bins are found again after being allocated
+      for (Int_t pass = 0; pass < 2; ++pass) {
+         for (Long64_t i = 0; i < n; ++i) {
+            hs.Fill(&x[i * dim], w[i]);
+            hn.Fill(&x3[i * 3], w[i]);
+         }
+         hsn.FillN(n, x.data(), w.data());
+         hnn.FillN(n, x3.data(), w.data());
+      }
+
+      EXPECT_EQ(hsn.GetNbins(), hs.GetNbins());
+      EXPECT_EQ(hsn.GetEntries(), hs.GetEntries());
+      EXPECT_DOUBLE_EQ(hsn.GetWeightSum(), hs.GetWeightSum());
+      std::vector<Int_t> coord(dim);
+      for (Long64_t bin = 0; bin < hs.GetNbins(); ++bin) {
+         Double_t content = hs.GetBinContent(bin, coord.data());
+         Long64_t binn = hsn.GetBin(coord.data(), kFALSE);
+         ASSERT_GE(binn, 0);
+         EXPECT_DOUBLE_EQ(hsn.GetBinContent(binn), content);
+         EXPECT_DOUBLE_EQ(hsn.GetBinError2(binn), hs.GetBinError2(bin));
+         // the bins are allocated once
+         EXPECT_EQ(hs.GetBin(coord.data(), kFALSE), bin);
+      }
+      for (Long64_t bin = 0; bin < hn.GetNbins(); ++bin)
+         EXPECT_DOUBLE_EQ(hnn.GetBinContent(bin), hn.GetBinContent(bin));
+
+      // an empty bin is not found
+      coord.assign(dim, 1);
+      EXPECT_EQ(hs.GetBin(coord.data(), kFALSE), -1);
+      EXPECT_EQ(hs.GetBin(coord.data()), hs.GetNbins() - 1);
+
+      // adding allocates the bins missing in the target
+      THnSparseD hsum("hsum", "hsum", dim, bins.data(), xmin.data(), xmax.data());
+      hsum.Add(&hsn);
+      hsum.Add(&hs, -1.);
+      EXPECT_EQ(hsum.GetNbins(), hs.GetNbins());
+      for (Long64_t bin = 0; bin < hsum.GetNbins(); ++bin)
+         EXPECT_NEAR(hsum.GetBinContent(bin), 0., 1e-12);
+   }
+}
+
+// THnChunked only allocates the filled chunks, with the contents and errors of a THn
+TEST(THnChunked, Fill) {
+   Int_t bins[3] = {100, 100, 100};
+   Double_t xmin[3] = {0., 0., 0.};
+   Double_t xmax[3] = {1., 1., 1.};
+   THnChunkedF hc("hc", "hc", 3, bins, xmin, xmax, 1000);
+   THnF hn("hn", "hn", 3, bins, xmin, xmax);
+   EXPECT_EQ(hc.GetChunkSize(), 1000);
+   EXPECT_EQ(hc.GetAllocatedFraction(), 0.);
+
+   TRandom3 r(1);
+   Long64_t lastBin = -1;
+   for (Int_t i = 0; i < 1000; ++i) {
+      Double_t x[3] = {r.Uniform(0.2, 0.25), r.Uniform(0.5, 0.52), r.Uniform()};
+      // errors are enabled after some fills
+      if (i == 500) {
+         hc.Sumw2();
+         hn.Sumw2();
+      }
+      Double_t w = 1. + i % 3;
+      lastBin = hc.Fill(x, w);
+      hn.Fill(x, w);
+   }
+   EXPECT_GT(hc.GetAllocatedFraction(), 0.);
+   EXPECT_LT(hc.GetAllocatedFraction(), 0.01);
+   EXPECT_EQ(hc.GetEntries(), hn.GetEntries());
+   for (Long64_t bin = 0; bin < hn.GetNbins(); ++bin) {
+      EXPECT_FLOAT_EQ(hc.GetBinContent(bin), hn.GetBinContent(bin));
+      EXPECT_FLOAT_EQ(hc.GetBinError2(bin), hn.GetBinError2(bin));
+   }
+
+   // projections keep the chunk size
+   Int_t dims[2] = {0, 2};
+   std::unique_ptr<THn> proj(hc.Projection(2, dims));
+   ASSERT_TRUE(dynamic_cast<THnChunkedF *>(proj.get()));
+   EXPECT_EQ(proj->GetArray().GetChunkSize(), 1000);
+   std::unique_ptr<TH1D> projX(hc.Projection(0));
+   std::unique_ptr<TH1D> projXn(hn.Projection(0));
+   for (Int_t bin = 0; bin <= 101; ++bin)
+      EXPECT_FLOAT_EQ(projX->GetBinContent(bin), projXn->GetBinContent(bin));
+
+   hc.Reset();
+   EXPECT_EQ(hc.GetAllocatedFraction(), 0.);
+   EXPECT_EQ(hc.GetBinContent(lastBin), 0.);
+}
@@ -2,9 +2,12 @@
 #include "TGraphAsymmErrors.h"
 #include "TRandom.h"
 #include "TH1.h"
+#include "TH2.h"
 #include "Math/QuantFuncMathCore.h"
 
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -399,4 +402,39 @@ TEST(TFEfficiency, ConfIntervals)
 TEST(TFEfficiency, ConsistencyWithTGraph)
 {
    testConsistencyWithTGraph();
-}
\ No newline at end of file
+}
+TEST(TFEfficiency, FillN)
+{
+   TRandom r(4);
+   const Int_t n = 1000;
+   std::vector<Double_t> x(n), y(n), w(n);
+   std::unique_ptr<Bool_t[]> passed(new Bool_t[n]);
+   for (Int_t i = 0; i < n; ++i) {
+      x[i] = r.Gaus(0., 2.);
+      y[i] = r.Gaus(0., 2.);
+      w[i] = r.Uniform(0.5, 1.5);
+      passed[i] = r.Rndm() < 0.3 + 0.1 * std::abs(x[i]);
+   }
+
+   TEfficiency e1("e1", "e1", 20, -3., 3.);
+   TEfficiency e1n("e1n", "e1n", 20, -3., 3.);
+   TEfficiency e2("e2", "e2", 20, -3., 3., 10, -3., 3.);
+   TEfficiency e2n("e2n", "e2n", 20, -3., 3., 10, -3., 3.);
+   for (Int_t i = 0; i < n; ++i) {
+      e1.Fill(passed[i], x[i]);
+      e2.FillWeighted(passed[i], w[i], x[i], y[i]);
+   }
+   e1n.FillN(n, passed.get(), x.data());
+   e2n.FillN(n, passed.get(), x.data(), y.data(), nullptr, w.data());
+
+   EXPECT_TRUE(e2n.UsesWeights());
+   for (Int_t bin = 0; bin < e1.GetTotalHistogram()->GetNcells(); ++bin) {
+      EXPECT_EQ(e1n.GetTotalHistogram()->GetBinContent(bin), e1.GetTotalHistogram()->GetBinContent(bin));
+      EXPECT_EQ(e1n.GetPassedHistogram()->GetBinContent(bin), e1.GetPassedHistogram()->GetBinContent(bin));
+   }
+   for (Int_t bin = 0; bin < e2.GetTotalHistogram()->GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(e2n.GetTotalHistogram()->GetBinContent(bin), e2.GetTotalHistogram()->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(e2n.GetPassedHistogram()->GetBinContent(bin), e2.GetPassedHistogram()->GetBinContent(bin));
+   }
+   EXPECT_EQ(e1n.GetTotalHistogram()->GetEntries(), e1.GetTotalHistogram()->GetEntries());
+}
@@ -1,9 +1,84 @@
 #include "gtest/gtest.h"
 
+#include "TEnv.h"
+#include "TF1.h"
+#include "TFitResult.h"
 #include "TFormula.h"
+#include "TH1.h"
+
+#include <cmath>
 
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+TEST(TFormula, CanBeVectorized)
+{
+  TFormula f1("f1", "[0]*exp(-0.5*((x-[1])/[2])^2)");
+  TFormula f2("f2", "x > 0 ? [0]*x : [1]");
+  TFormula f3("f3", "[0]*TMath::Landau(x,[1],[2])");
+#ifdef R__HAS_VECCORE
+  EXPECT_TRUE(f1.CanBeVectorized());
+#else
+  EXPECT_FALSE(f1.CanBeVectorized());
+#endif
+  EXPECT_FALSE(f2.CanBeVectorized());
+  EXPECT_FALSE(f3.CanBeVectorized());
+}
+
+// Fits of formula functions use a vectorized copy of the formula by default
+TEST(TFormula, VectorizedFit)
+{
+  TH1D h("h", "h", 100, -5, 5);
+  TF1 gen("gen", "gaus", -5, 5);
+  gen.SetParameters(1, 0.5, 1.2);
+  h.FillRandom("gen", 10000);
+
+  TF1 fvec("fvec", "[0]*exp(-0.5*((x-[1])/[2])^2)", -5, 5);
+  fvec.SetParameters(100, 0, 1);
+  TF1 fscalar(fvec);
+  fscalar.SetName("fscalar");
+
+  auto resVec = h.Fit(&fvec, "Q N S");
+  gEnv->SetValue("Fit.VectorizeFormula", 0);
+  auto resScalar = h.Fit(&fscalar, "Q N S");
+  gEnv->SetValue("Fit.VectorizeFormula", 1);
+
+  ASSERT_EQ(resVec->Status(), 0);
+  ASSERT_EQ(resScalar->Status(), 0);
+  EXPECT_FALSE(fvec.IsVectorized());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(resVec->Parameter(i), resScalar->Parameter(i), 1e-3 * resScalar->ParError(i));
+  }
+  EXPECT_NEAR(resVec->Chi2(), resScalar->Chi2(), 1e-5 * resScalar->Chi2());
+
+  // the result keeps a scalar model function
+  double x = 0.5, ci = 0;
+  resVec->GetConfidenceIntervals(1, 1, 1, &x, &ci, 0.683, false);
+  EXPECT_GT(ci, 0.);
+}
+
+// With lazy jitting the expressions are compiled at the first evaluation
+TEST(TFormula, LazyJitting)
+{
+  bool wasLazy = TFormula::DefaultLazyJitting(true);
+  TFormula f("lazyf", "[0]*x*x + 3.5", false);
+  EXPECT_TRUE(f.IsValid());
+  f.SetParameter(0, 2.);
+  // copies compile their expression at their first evaluation too
+  TFormula fcopy(f);
+  EXPECT_DOUBLE_EQ(f.Eval(2.), 11.5);
+  EXPECT_DOUBLE_EQ(fcopy.Eval(1.), 5.5);
+
+  TF1 f1("lazyf1", "[0]*sin(x) + [1]", 0, 1);
+  f1.SetParameters(2., 1.);
+  EXPECT_DOUBLE_EQ(f1.Eval(0.5), 2. * std::sin(0.5) + 1.);
+  TFormula::DefaultLazyJitting(wasLazy);
+
+  // the formulas with the same expression share the compiled function
+  TFormula same("lazysame", "[0]*x*x + 3.5", false);
+  same.SetParameter(0, 1.);
+  EXPECT_DOUBLE_EQ(same.Eval(1.), 4.5);
+}
@@ -1,8 +1,21 @@
 #include "gtest/gtest.h"
 
 #include "TH1.h"
+#include "TH1ConcurrentFill.h"
+#include "TList.h"
 #include "TH1F.h"
+#include "TH2D.h"
+#include "TH3D.h"
 #include "THLimitsFinder.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TProfile3D.h"
+#include "TRandom3.h"
+
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <vector>
 
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
@@ -46,3 +59,212 @@ TEST(THLimitsFinder, Degenerate)
    EXPECT_LE(xmin, centralValue - 5.);
    EXPECT_GE(xmax, centralValue + 5.);
 }
+
+// the batch bin search gives the same bins as FindFixBin
+TEST(TAxis, FindFixBins)
+{
+   const Double_t edges[] = {-1., -0.5, 0., 0., 0.3, 1., 2.5, 4.};
+   TAxis fixed(7, -1., 4.);
+   TAxis variable(7, edges);
+
+   TRandom3 r(1);
+   std::vector<Double_t> x(1000);
+   for (auto &xi : x)
+      xi = r.Uniform(-2., 5.);
+   // edges, overflows and NaN
+   x.insert(x.end(), std::begin(edges), std::end(edges));
+   x.insert(x.end(), {std::nextafter(4., 0.), std::numeric_limits<Double_t>::infinity(),
+                      -std::numeric_limits<Double_t>::infinity(), std::numeric_limits<Double_t>::quiet_NaN(), 1.e300});
+
+   for (const TAxis *axis : {&fixed, &variable}) {
+      std::vector<Int_t> bins(x.size());
+      axis->FindFixBins(x.size(), x.data(), bins.data());
+      for (std::size_t i = 0; i < x.size(); ++i)
+         EXPECT_EQ(bins[i], axis->FindFixBin(x[i])) << "x = " << x[i];
+
+      // every other value
+      std::vector<Int_t> bins2(x.size() / 2);
+      axis->FindFixBins(bins2.size(), x.data(), bins2.data(), 2);
+      for (std::size_t i = 0; i < bins2.size(); ++i)
+         EXPECT_EQ(bins2[i], bins[2 * i]);
+   }
+}
+
+// FillN fills the same bins and statistics as Fill
+TEST(TH1, FillN)
+{
+   TRandom3 r(2);
+   const Int_t n = 1000;
+   std::vector<Double_t> x(n), y(n), w(n);
+   for (Int_t i = 0; i < n; ++i) {
+      x[i] = r.Gaus(0., 2.);
+      y[i] = r.Gaus(0., 2.);
+      w[i] = r.Uniform(0.5, 1.5);
+   }
+
+   TH1D h1("h1", "h1", 20, -3., 3.);
+   TH1D h1n("h1n", "h1n", 20, -3., 3.);
+   TH2D h2("h2", "h2", 20, -3., 3., 10, -3., 3.);
+   TH2D h2n("h2n", "h2n", 20, -3., 3., 10, -3., 3.);
+   for (Int_t i = 0; i < n; ++i) {
+      h1.Fill(x[i], w[i]);
+      h2.Fill(x[i], y[i], w[i]);
+   }
+   h1n.FillN(n, x.data(), w.data());
+   h2n.FillN(n, x.data(), y.data(), w.data());
+
+   for (Int_t bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(h1n.GetBinContent(bin), h1.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(h1n.GetBinError(bin), h1.GetBinError(bin));
+   }
+   for (Int_t bin = 0; bin < h2.GetNcells(); ++bin)
+      EXPECT_DOUBLE_EQ(h2n.GetBinContent(bin), h2.GetBinContent(bin));
+   EXPECT_DOUBLE_EQ(h1n.GetMean(), h1.GetMean());
+   EXPECT_DOUBLE_EQ(h2n.GetCovariance(), h2.GetCovariance());
+   EXPECT_EQ(h1n.GetEntries(), h1.GetEntries());
+   EXPECT_EQ(h2n.GetEntries(), h2.GetEntries());
+}
+
+TEST(TProfile, FillN)
+{
+   TRandom3 r(3);
+   const Int_t n = 1000;
+   std::vector<Double_t> x(n), y(n), z(n), t(n), w(n);
+   for (Int_t i = 0; i < n; ++i) {
+      x[i] = r.Gaus(0., 2.);
+      y[i] = r.Gaus(0., 2.);
+      z[i] = r.Gaus(0., 2.);
+      t[i] = r.Gaus(1., 1.);
+      w[i] = r.Uniform(0.5, 1.5);
+   }
+
+   TProfile p1("p1", "p1", 20, -3., 3.);
+   TProfile p1n("p1n", "p1n", 20, -3., 3.);
+   TProfile2D p2("p2", "p2", 20, -3., 3., 10, -3., 3.);
+   TProfile2D p2n("p2n", "p2n", 20, -3., 3., 10, -3., 3.);
+   TProfile3D p3("p3", "p3", 10, -3., 3., 10, -3., 3., 5, -3., 3.);
+   TProfile3D p3n("p3n", "p3n", 10, -3., 3., 10, -3., 3., 5, -3., 3.);
+   for (Int_t i = 0; i < n; ++i) {
+      p1.Fill(x[i], y[i], w[i]);
+      p2.Fill(x[i], y[i], z[i], w[i]);
+      p3.Fill(x[i], y[i], z[i], t[i], w[i]);
+   }
+   p1n.FillN(n, x.data(), y.data(), w.data());
+   p2n.FillN(n, x.data(), y.data(), z.data(), w.data());
+   p3n.FillN(n, x.data(), y.data(), z.data(), t.data(), w.data());
+
+   for (Int_t bin = 0; bin < p1.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(p1n.GetBinContent(bin), p1.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(p1n.GetBinError(bin), p1.GetBinError(bin));
+   }
+   for (Int_t bin = 0; bin < p2.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(p2n.GetBinContent(bin), p2.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(p2n.GetBinError(bin), p2.GetBinError(bin));
+   }
+   for (Int_t bin = 0; bin < p3.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(p3n.GetBinContent(bin), p3.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(p3n.GetBinEntries(bin), p3.GetBinEntries(bin));
+   }
+   EXPECT_DOUBLE_EQ(p1n.GetMean(2), p1.GetMean(2));
+   EXPECT_DOUBLE_EQ(p2n.GetMean(3), p2.GetMean(3));
+   EXPECT_DOUBLE_EQ(p3n.GetCovariance(1, 3), p3.GetCovariance(1, 3));
+   EXPECT_EQ(p1n.GetEntries(), p1.GetEntries());
+   EXPECT_EQ(p2n.GetEntries(), p2.GetEntries());
+   EXPECT_EQ(p3n.GetEntries(), p3.GetEntries());
+}
+
+TEST(TH1, ConcurrentFill)
+{
+   TRandom3 r(3);
+   const Int_t n = 40000;
+   const Int_t nThreads = 4;
+   std::vector<Double_t> x(n), y(n), z(n), w(n);
+   for (Int_t i = 0; i < n; ++i) {
+      x[i] = r.Gaus(0., 2.);
+      y[i] = r.Gaus(0., 2.);
+      z[i] = r.Gaus(0., 2.);
+      // the sums of these weights are exact whatever the order of the additions
+      w[i] = 0.5 * (1 + i % 3);
+   }
+
+   TH1D h1("h1", "h1", 20, -3., 3.);
+   TH1D h1c("h1c", "h1c", 20, -3., 3.);
+   TH3D h3("h3", "h3", 20, -3., 3., 10, -3., 3., 5, -3., 3.);
+   TH3D h3c("h3c", "h3c", 20, -3., 3., 10, -3., 3., 5, -3., 3.);
+   h1c.Sumw2();
+   h3c.Sumw2();
+   for (Int_t i = 0; i < n; ++i) {
+      h1.Fill(x[i], w[i]);
+      h3.Fill(x[i], y[i], z[i], w[i]);
+   }
+
+   ROOT::TH1ConcurrentFillManager<TH1D> manager1(h1c);
+   ROOT::TH1ConcurrentFillManager<TH3D> manager3(h3c);
+   std::vector<std::thread> threads;
+   for (Int_t t = 0; t < nThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         auto filler1 = manager1.MakeFiller();
+         auto filler3 = manager3.MakeFiller();
+         for (Int_t i = t; i < n; i += nThreads) {
+            filler1.Fill(x[i], w[i]);
+            filler3.Fill(x[i], y[i], z[i], w[i]);
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+
+   for (Int_t bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_EQ(h1c.GetBinContent(bin), h1.GetBinContent(bin));
+      EXPECT_EQ(h1c.GetBinError(bin), h1.GetBinError(bin));
+   }
+   for (Int_t bin = 0; bin < h3.GetNcells(); ++bin)
+      EXPECT_EQ(h3c.GetBinContent(bin), h3.GetBinContent(bin));
+   EXPECT_EQ(h1c.GetEntries(), h1.GetEntries());
+   EXPECT_EQ(h3c.GetEntries(), h3.GetEntries());
+   EXPECT_EQ(h1c.GetSumOfWeights(), h1.GetSumOfWeights());
+   EXPECT_NEAR(h1c.GetMean(), h1.GetMean(), 1e-12);
+   EXPECT_NEAR(h1c.GetStdDev(), h1.GetStdDev(), 1e-12);
+   EXPECT_NEAR(h3c.GetMean(3), h3.GetMean(3), 1e-12);
+   EXPECT_NEAR(h3c.GetCovariance(2, 3), h3.GetCovariance(2, 3), 1e-12);
+}
+
+TEST(TH1, MergeSameAxes)
+{
+   TRandom3 r(4);
+   TH2D h2("h2", "h2", 40, -3., 3., 30, -3., 3.);
+   TH2D h2add("h2add", "h2add", 40, -3., 3., 30, -3., 3.);
+   TH1F h1("h1", "h1", 50, -3., 3.);
+   TH1F h1add("h1add", "h1add", 50, -3., 3.);
+   h2.Sumw2();
+   h2add.Sumw2();
+   TList list2, list1;
+   list2.SetOwner();
+   list1.SetOwner();
+   for (Int_t i = 0; i < 5; ++i) {
+      auto in2 = new TH2D(TString::Format("in2_%d", i), "in2", 40, -3., 3., 30, -3., 3.);
+      auto in1 = new TH1F(TString::Format("in1_%d", i), "in1", 50, -3., 3.);
+      // inputs with and without sum of squares of weights
+      if (i % 2)
+         in2->Sumw2();
+      for (Int_t j = 0; j < 1000; ++j) {
+         in2->Fill(r.Gaus(), r.Gaus(), (i % 2) ? r.Uniform(0.5, 1.5) : 1.);
+         in1->Fill(r.Gaus(), r.Uniform(0.5, 1.5));
+      }
+      h2add.Add(in2);
+      h1add.Add(in1);
+      list2.Add(in2);
+      list1.Add(in1);
+   }
+   EXPECT_EQ(h2.Merge(&list2), h2add.GetEntries());
+   EXPECT_EQ(h1.Merge(&list1), h1add.GetEntries());
+
+   for (Int_t bin = 0; bin < h2.GetNcells(); ++bin) {
+      EXPECT_EQ(h2.GetBinContent(bin), h2add.GetBinContent(bin));
+      EXPECT_EQ(h2.GetBinError(bin), h2add.GetBinError(bin));
+   }
+   for (Int_t bin = 0; bin < h1.GetNcells(); ++bin)
+      EXPECT_EQ(h1.GetBinContent(bin), h1add.GetBinContent(bin));
+   EXPECT_DOUBLE_EQ(h2.GetCovariance(), h2add.GetCovariance());
+   EXPECT_DOUBLE_EQ(h1.GetMean(), h1add.GetMean());
+}
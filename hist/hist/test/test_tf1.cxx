@@ -1,11 +1,15 @@
 #include "TF1.h"
+#include "TF2.h"
 #include "TF1NormSum.h"
+#include "Math/GaussLegendreIntegrator.h"
+#include "Math/WrappedTF1.h"
 #include "TObjString.h"
 #include "TObjArray.h"
 
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <vector>
 
 using namespace std;
 
@@ -223,3 +227,54 @@ TEST(TF1, Constructors)
    for (auto tf1 : vtf1)
       EXPECT_EQ(tf1(&x, &p), 2);
 }
+
+// Batch evaluation gives the values of EvalPar, also for vectorized and multi-dimensional functions
+TEST(TF1, EvalParBatch)
+{
+   TF1 fgaus("fgaus", "gaus", -5, 5);
+   fgaus.SetParameters(2, 0.5, 1.2);
+#ifdef R__HAS_VECCORE
+   TF1 fvec("fvec", "[0]*exp(-0.5*((x-[1])/[2])^2)", -5, 5, "VEC");
+   fvec.SetParameters(2, 0.5, 1.2);
+   auto vecFunctor = [](ROOT::Double_v *x, double *p) -> ROOT::Double_v { return p[0] * x[0]; };
+   TF1 fvecFunctor("fvecFunctor", vecFunctor, -5, 5, 1);
+   fvecFunctor.SetParameter(0, 2.);
+#endif
+   TF1 flambda("flambda", [](double *x, double *p) { return p[0] * x[0] * x[0]; }, -5, 5, 1);
+   flambda.SetParameter(0, 3.);
+   TF2 f2("f2", "[0]*x*y", -5, 5, -5, 5);
+   f2.SetParameter(0, 1.5);
+
+   // an odd number of points, for the vectorized case
+   const int n = 103;
+   std::vector<double> x(n), x2(2 * n), out(n), out2(n);
+   for (int i = 0; i < n; ++i) {
+      x[i] = -5 + 0.1 * i;
+      x2[2 * i] = x[i];
+      x2[2 * i + 1] = 0.3 * i;
+   }
+#ifdef R__HAS_VECCORE
+   std::vector<TF1 *> functions{&fgaus, &flambda, &fvec, &fvecFunctor};
+#else
+   std::vector<TF1 *> functions{&fgaus, &flambda};
+#endif
+   for (TF1 *f : functions) {
+      f->EvalParBatch(x, out);
+      for (int i = 0; i < n; ++i)
+         EXPECT_DOUBLE_EQ(out[i], f->EvalPar(&x[i])) << f->GetName() << " at " << x[i];
+   }
+   const double p[3] = {1., -1., 0.5};
+   fgaus.EvalParBatch(x, out, p);
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(out[i], fgaus.EvalPar(&x[i], p));
+
+   f2.EvalParBatch(x2, out2);
+   for (int i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(out2[i], 1.5 * x2[2 * i] * x2[2 * i + 1]);
+
+   // the Gauss-Legendre integral is unchanged
+   ROOT::Math::WrappedTF1 wf(fgaus);
+   ROOT::Math::GaussLegendreIntegrator gli(20, 1e-12);
+   gli.SetFunction(wf);
+   EXPECT_DOUBLE_EQ(fgaus.IntegralFast(20, nullptr, nullptr, -1, 2), gli.Integral(-1, 2));
+}
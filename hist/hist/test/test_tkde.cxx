@@ -496,4 +496,40 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+// the internal kernels are summed only over the data within their support: compare with the sum over all the data
+TEST(TKDE, tkde_kernel_support)
+{
+   const int n = 2000;
+   TRandom3 r(2222);
+   std::vector<double> data(n);
+   for (int i = 0; i < n; ++i) {
+      do {
+         data[i] = r.Gaus(10, 3);
+      } while (data[i] < 0 || data[i] >= 20);
+   }
+   auto gaus = [](double u) { return (u > -9. && u < 9.) ? std::exp(-0.5 * u * u) / std::sqrt(2. * M_PI) : 0.; };
+   auto epan = [](double u) { return (u > -1. && u < 1.) ? 0.75 * (1. - u * u) : 0.; };
+
+   for (const char *iteration : {"Fixed", "Adaptive"}) {
+      for (const char *kernel : {"Gaussian", "Epanechnikov"}) {
+         TString opt =
+            TString::Format("KernelType:%s;Iteration:%s;Mirror:noMirror;Binning:Unbinned", kernel, iteration);
+         TKDE kde(n, data.data(), 0., 20., opt, 1);
+         const bool adaptive = TString(iteration) == "Adaptive";
+         const double *weights = adaptive ? kde.GetAdaptiveWeights() : nullptr;
+         const double fixedWeight = adaptive ? 0. : kde.GetFixedWeight();
+         for (double x = 0.25; x < 20; x += 0.5) {
+            double sum = 0;
+            for (int i = 0; i < n; ++i) {
+               const double w = adaptive ? weights[i] : fixedWeight;
+               if (w == 0)
+                  continue;
+               const double u = (x - data[i]) / w;
+               sum += (TString(kernel) == "Gaussian" ? gaus(u) : epan(u)) / w;
+            }
+            EXPECT_NEAR(kde(x), sum / n, 1e-12 * sum / n) << kernel << " " << iteration << " x = " << x;
+         }
+      }
+   }
+}
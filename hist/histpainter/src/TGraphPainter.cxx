@@ -10,6 +10,7 @@
  *************************************************************************/
 
 #include "TROOT.h"
+#include "TEnv.h"
 #include "TGraphPainter.h"
 #include "TMath.h"
 #include "TGraph.h"
@@ -40,6 +41,41 @@
 
 Int_t TGraphPainter::fgMaxPointsPerLine = 50;
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce in place a polyline given in pad coordinates (u horizontal, v vertical) to
+/// at most four points per pixel column: for each run of consecutive points in the
+/// same column the first, the lowest, the highest and the last points are kept,
+/// in their original order, so that the painted line is unchanged at the pad
+/// resolution. Returns the new number of points.
+
+Int_t DecimatePolyLine(Int_t n, Double_t *u, Double_t *v)
+{
+   Int_t nout = 0;
+   Int_t first = 0;
+   while (first < n) {
+      Int_t col = gPad->XtoAbsPixel(u[first]);
+      Int_t last = first, imin = first, imax = first;
+      while (last+1 < n && gPad->XtoAbsPixel(u[last+1]) == col) {
+         last++;
+         if (v[last] < v[imin]) imin = last;
+         if (v[last] > v[imax]) imax = last;
+      }
+      Int_t keep[4] = {first, TMath::Min(imin, imax), TMath::Max(imin, imax), last};
+      for (Int_t k=0; k<4; k++) {
+         if (k > 0 && keep[k] == keep[k-1]) continue;
+         u[nout] = u[keep[k]];
+         v[nout] = v[keep[k]];
+         nout++;
+      }
+      first = last+1;
+   }
+   return nout;
+}
+
+} // anonymous namespace
+
 static Int_t    gHighlightPoint  = -1;         // highlight point of graph
 static TGraph  *gHighlightGraph  = nullptr;    // pointer to graph with highlight point
 static std::unique_ptr<TMarker> gHighlightMarker;    // highlight marker
@@ -1469,23 +1505,28 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
          if (i == nloop) {
             ComputeLogs(npt, optionZ);
             Int_t bord = gStyle->GetDrawBorder();
+            // With many more points than pixels, only the extremes in each pixel column are visible
+            Int_t npaint = npt;
+            if (npt > 1000 && gEnv->GetValue("Canvas.Decimation", 1))
+               npaint = optionR ? DecimatePolyLine(npt, gyworkl.data(), gxworkl.data())
+                                : DecimatePolyLine(npt, gxworkl.data(), gyworkl.data());
             if (optionR) {
                if (optionFill) {
-                  gPad->PaintFillArea(npt,gyworkl.data(),gxworkl.data());
-                  if (bord) gPad->PaintPolyLine(npt,gyworkl.data(),gxworkl.data());
+                  gPad->PaintFillArea(npaint,gyworkl.data(),gxworkl.data());
+                  if (bord) gPad->PaintPolyLine(npaint,gyworkl.data(),gxworkl.data());
                }
                if (optionLine) {
-                  if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npt, gyworkl.data(), gxworkl.data());
-                  gPad->PaintPolyLine(npt,gyworkl.data(),gxworkl.data());
+                  if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npaint, gyworkl.data(), gxworkl.data());
+                  gPad->PaintPolyLine(npaint,gyworkl.data(),gxworkl.data());
                }
             } else {
                if (optionFill) {
-                  gPad->PaintFillArea(npt,gxworkl.data(),gyworkl.data());
-                  if (bord) gPad->PaintPolyLine(npt,gxworkl.data(),gyworkl.data());
+                  gPad->PaintFillArea(npaint,gxworkl.data(),gyworkl.data());
+                  if (bord) gPad->PaintPolyLine(npaint,gxworkl.data(),gyworkl.data());
                }
                if (optionLine) {
-                  if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npt, gxworkl.data(), gyworkl.data());
-                  gPad->PaintPolyLine(npt,gxworkl.data(),gyworkl.data());
+                  if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npaint, gxworkl.data(), gyworkl.data());
+                  gPad->PaintPolyLine(npaint,gxworkl.data(),gyworkl.data());
                }
             }
             gxwork[0] = gxwork[npt-1];  gywork[0] = gywork[npt-1];
@@ -1199,6 +1199,14 @@ COL2 option renders the histogram as a bitmap. Therefore it cannot be saved in v
 graphics file format like PostScript or PDF (an empty image will be generated). It can
 be saved only in bitmap files like PNG format for instance.
 
+With the COL option, when the histogram has more bins than the pad has pixels
+along an axis, the bins falling in the same pixel are painted as a single box
+colored after the highest of them, and the adjacent boxes of the same color in
+a row are merged, which keeps PostScript, PDF and SVG files small. This can be
+disabled with `Canvas.Decimation: false` in the `.rootrc` file; graphs drawn
+with a line or a fill area with many more points than pixels are then also
+painted point by point.
+
 
 \anchor HP140
 ### The CANDLE and VIOLIN options
@@ -5809,86 +5817,150 @@ void THistPainter::PaintColorLevels(Option_t*)
    if (!fH->TestBit(TH1::kUserContour)) fH->SetContour(ndiv);
    Double_t scale = (dz ? ndivz / dz : 1.0);
 
-   Int_t color;
    TProfile2D* prof2d = dynamic_cast<TProfile2D*>(fH);
-   for (Int_t j=Hparam.yfirst; j<=Hparam.ylast;j++) {
+
+   // Value of bin (i,j) on the color scale, false if the bin is not drawn
+   auto binZ = [&](Int_t i, Int_t j, Double_t &z) -> Bool_t {
+      Int_t bin = j*(fXaxis->GetNbins()+2) + i;
+      Double_t xk = fXaxis->GetBinLowEdge(i);
+      if (Hoption.System == kPOLAR && xk<0) xk= 2*TMath::Pi()+xk;
+      if (!IsInside(xk+0.5*fXaxis->GetBinWidth(i),fYaxis->GetBinLowEdge(j)+0.5*fYaxis->GetBinWidth(j))) return kFALSE;
+      z = fH->GetBinContent(bin);
+      // if fH is a profile histogram do not draw empty bins
+      if (prof2d) {
+         const Double_t binEntries = prof2d->GetBinEntries(bin);
+         if (binEntries == 0)
+            return kFALSE;
+      } else {
+         // don't draw the empty bins for non-profile histograms
+         // with positive content
+         if (z == 0) {
+            if (zmin >= 0 || Hoption.Logz) return kFALSE;
+            if (Hoption.Color == 2) return kFALSE;
+         }
+      }
+
+      if (Hoption.Logz) {
+         if (z > 0) z = TMath::Log10(z);
+         else       z = zmin;
+      }
+      if (z < zmin && !Hoption.Zero) return kFALSE;
+      return kTRUE;
+   };
+
+   // Index in the palette for a value on the color scale, -1 if not drawn
+   auto paletteIndex = [&](Double_t z) -> Int_t {
+      Int_t color;
+      if (fH->TestBit(TH1::kUserContour)) {
+         zc = fH->GetContourLevelPad(0);
+         if (z < zc) return -1;
+         color = -1;
+         for (Int_t k=0; k<ndiv; k++) {
+            zc = fH->GetContourLevelPad(k);
+            if (z < zc) {
+               continue;
+            } else {
+               color++;
+            }
+         }
+      } else {
+         color = Int_t(0.01+(z-zmin)*scale);
+      }
+
+      Int_t theColor = Int_t((color+0.99)*Float_t(ncolors)/Float_t(ndivz));
+      if (theColor > ncolors-1) theColor = ncolors-1;
+      return theColor;
+   };
+
+   // With more bins than pixels, the bins within one pixel are painted as a single box
+   // colored after the highest of them, and adjacent boxes of the same color in a row
+   // are merged. Both are disabled by Canvas.Decimation: false in the rootrc file.
+   Bool_t decimate = (Hoption.System != kPOLAR) && gEnv->GetValue("Canvas.Decimation", 1);
+   Int_t xgroup = 1, ygroup = 1;
+   if (decimate) {
+      Int_t npx = TMath::Abs(gPad->XtoAbsPixel(gPad->GetUxmax()) - gPad->XtoAbsPixel(gPad->GetUxmin()));
+      Int_t npy = TMath::Abs(gPad->YtoAbsPixel(gPad->GetUymax()) - gPad->YtoAbsPixel(gPad->GetUymin()));
+      Int_t nbx = Hparam.xlast - Hparam.xfirst + 1;
+      Int_t nby = Hparam.ylast - Hparam.yfirst + 1;
+      if (npx > 0 && nbx > npx) xgroup = (nbx + npx - 1) / npx;
+      if (npy > 0 && nby > npy) ygroup = (nby + npy - 1) / npy;
+   }
+
+   // Box waiting to be extended by the next one in the row
+   Int_t pendingColor = -1;
+   Double_t pxlow = 0, pylow = 0, pxup = 0, pyup = 0;
+   auto flush = [&]() {
+      if (pendingColor < 0) return;
+      fH->SetFillColor(gStyle->GetColorPalette(pendingColor));
+      fH->TAttFill::Modify();
+      gPad->PaintBox(pxlow, pylow, pxup, pyup);
+      pendingColor = -1;
+   };
+
+   for (Int_t j=Hparam.yfirst; j<=Hparam.ylast;j+=ygroup) {
+      Int_t jlast = TMath::Min(j+ygroup-1, Hparam.ylast);
       yk    = fYaxis->GetBinLowEdge(j);
-      ystep = fYaxis->GetBinWidth(j);
-      for (Int_t i=Hparam.xfirst; i<=Hparam.xlast;i++) {
-         Int_t bin  = j*(fXaxis->GetNbins()+2) + i;
+      ystep = (jlast == j) ? fYaxis->GetBinWidth(j) : fYaxis->GetBinUpEdge(jlast) - yk;
+      for (Int_t i=Hparam.xfirst; i<=Hparam.xlast;i+=xgroup) {
+         Int_t ilast = TMath::Min(i+xgroup-1, Hparam.xlast);
          xk    = fXaxis->GetBinLowEdge(i);
-         xstep = fXaxis->GetBinWidth(i);
+         xstep = (ilast == i) ? fXaxis->GetBinWidth(i) : fXaxis->GetBinUpEdge(ilast) - xk;
          if (Hoption.System == kPOLAR && xk<0) xk= 2*TMath::Pi()+xk;
-         if (!IsInside(xk+0.5*xstep,yk+0.5*ystep)) continue;
-         z     = fH->GetBinContent(bin);
-         // if fH is a profile histogram do not draw empty bins
-         if (prof2d) {
-            const Double_t binEntries = prof2d->GetBinEntries(bin);
-            if (binEntries == 0)
-               continue;
-         } else {
-            // don't draw the empty bins for non-profile histograms
-            // with positive content
-            if (z == 0) {
-               if (zmin >= 0 || Hoption.Logz) continue;
-               if (Hoption.Color == 2) continue;
+         Bool_t found = kFALSE;
+         for (Int_t jj=j; jj<=jlast; jj++) {
+            for (Int_t ii=i; ii<=ilast; ii++) {
+               Double_t zbin;
+               if (!binZ(ii, jj, zbin)) continue;
+               if (!found || zbin > z) z = zbin;
+               found = kTRUE;
             }
          }
-
-         if (Hoption.Logz) {
-            if (z > 0) z = TMath::Log10(z);
-            else       z = zmin;
+         if (!found) {
+            flush();
+            continue;
          }
-         if (z < zmin && !Hoption.Zero) continue;
          xup  = xk + xstep;
          xlow = xk;
          if (Hoption.Logx) {
             if (xup > 0)  xup  = TMath::Log10(xup);
-            else continue;
+            else { flush(); continue; }
             if (xlow > 0) xlow = TMath::Log10(xlow);
-            else continue;
+            else { flush(); continue; }
          }
          yup  = yk + ystep;
          ylow = yk;
          if (Hoption.System != kPOLAR) {
             if (Hoption.Logy) {
                if (yup > 0)  yup  = TMath::Log10(yup);
-               else continue;
+               else { flush(); continue; }
                if (ylow > 0) ylow = TMath::Log10(ylow);
-               else continue;
+               else { flush(); continue; }
+            }
+            if (xup  < gPad->GetUxmin() || yup  < gPad->GetUymin() ||
+                xlow > gPad->GetUxmax() || ylow > gPad->GetUymax()) {
+               flush();
+               continue;
             }
-            if (xup  < gPad->GetUxmin()) continue;
-            if (yup  < gPad->GetUymin()) continue;
-            if (xlow > gPad->GetUxmax()) continue;
-            if (ylow > gPad->GetUymax()) continue;
             if (xlow < gPad->GetUxmin()) xlow = gPad->GetUxmin();
             if (ylow < gPad->GetUymin()) ylow = gPad->GetUymin();
             if (xup  > gPad->GetUxmax()) xup  = gPad->GetUxmax();
             if (yup  > gPad->GetUymax()) yup  = gPad->GetUymax();
          }
 
-         if (fH->TestBit(TH1::kUserContour)) {
-            zc = fH->GetContourLevelPad(0);
-            if (z < zc) continue;
-            color = -1;
-            for (Int_t k=0; k<ndiv; k++) {
-               zc = fH->GetContourLevelPad(k);
-               if (z < zc) {
-                  continue;
-               } else {
-                  color++;
-               }
-            }
-         } else {
-            color = Int_t(0.01+(z-zmin)*scale);
+         Int_t theColor = paletteIndex(z);
+         if (theColor < 0) {
+            flush();
+            continue;
          }
-
-         Int_t theColor = Int_t((color+0.99)*Float_t(ncolors)/Float_t(ndivz));
-         if (theColor > ncolors-1) theColor = ncolors-1;
-         fH->SetFillColor(gStyle->GetColorPalette(theColor));
-         fH->TAttFill::Modify();
          if (Hoption.System != kPOLAR) {
-            gPad->PaintBox(xlow, ylow, xup, yup);
+            if (decimate && theColor == pendingColor && xlow == pxup) {
+               pxup = xup;
+               continue;
+            }
+            flush();
+            pendingColor = theColor;
+            pxlow = xlow; pylow = ylow; pxup = xup; pyup = yup;
+            if (!decimate) flush();
          } else  {
             TCrown crown(0,0,ylow,yup,xlow*TMath::RadToDeg(),xup*TMath::RadToDeg());
             crown.SetFillColor(gStyle->GetColorPalette(theColor));
@@ -5898,6 +5970,7 @@ void THistPainter::PaintColorLevels(Option_t*)
             crown.Paint();
          }
       }
+      flush();
    }
 
    if (Hoption.Zscale) PaintPalette();
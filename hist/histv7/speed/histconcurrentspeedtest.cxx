@@ -0,0 +1,256 @@
+/// \file histconcurrentspeedtest.cxx
+///
+/// Throughput of several threads filling one histogram, for:
+///  - R7: RHist through RHistConcurrentFillManager (buffered fills under a lock),
+///  - TThreadedObject: a TH1 copy per thread, merged at the end (the merge is timed),
+///  - TH1ConcurrentFill: a single TH1 with ROOT::TH1ConcurrentFillManager (atomic bin additions),
+/// in 1, 2 and 3 dimensions, with fixed and variable bin sizes, and with 1 to 128 threads.
+///
+///     g++ -O3 -o histconcurrentspeedtest histconcurrentspeedtest.cxx `root-config --cflags --libs`
+///     ./histconcurrentspeedtest [fills per thread, 1e6] [maximum number of threads, 128]
+///
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "TH1ConcurrentFill.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+#include "ROOT/TThreadedObject.hxx"
+
+#include "ROOT/RHist.hxx"
+#include "ROOT/RHistConcurrentFill.hxx"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ROOT;
+
+namespace {
+
+/// The coordinates filled by the threads, in [0, 1): a pool of points read by each thread from its own offset,
+/// so that the random number generation is not timed and the memory does not grow with the number of threads.
+struct Input {
+   static constexpr size_t kSize = 1 << 20;
+   std::vector<double> fX;
+
+   Input() : fX(3 * kSize)
+   {
+      TRandom3 r(1);
+      for (auto &x : fX)
+         x = r.Rndm();
+   }
+
+   const double *Point(size_t i) const { return &fX[3 * (i & (kSize - 1))]; }
+};
+
+/// Number of bins per axis, so that the histograms have O(1e4 - 1e5) bins in all dimensions
+constexpr int GetNBins(int ndim)
+{
+   return ndim == 1 ? 10000 : (ndim == 2 ? 200 : 40);
+}
+
+/// Edges of nbins bins in [0, 1) getting wider with x
+std::vector<double> MakeEdges(int nbins)
+{
+   std::vector<double> edges(nbins + 1);
+   for (int i = 0; i <= nbins; ++i)
+      edges[i] = double(i) * i / (double(nbins) * nbins);
+   return edges;
+}
+
+/// Run work(thread index) on nThreads threads, then finish(); return the elapsed time in seconds
+template <class WORK, class FINISH>
+double RunThreads(unsigned int nThreads, WORK &&work, FINISH &&finish)
+{
+   const auto start = std::chrono::steady_clock::now();
+   std::vector<std::thread> threads;
+   for (unsigned int t = 0; t < nThreads; ++t)
+      threads.emplace_back(work, t);
+   for (auto &thread : threads)
+      thread.join();
+   finish();
+   return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void Report(const std::string &what, int ndim, bool variable, unsigned int nThreads, size_t nFills, double seconds)
+{
+   std::cout << what << " " << ndim << "D " << (variable ? "variable" : "fixed   ") << " bins " << nThreads
+             << " threads: " << seconds << " seconds, \t" << nThreads * nFills / 1e6 / seconds
+             << " millions per second\n";
+}
+
+/// The RHist and TH1 types of each dimension, and how to construct and fill them
+template <int NDIM>
+struct Hists;
+
+template <>
+struct Hists<1> {
+   using R7_t = Experimental::RH1D;
+   using TH1_t = TH1D;
+   static std::unique_ptr<R7_t> MakeR7(bool variable)
+   {
+      const int n = GetNBins(1);
+      return variable ? std::make_unique<R7_t>(Experimental::RAxisConfig(MakeEdges(n)))
+                      : std::make_unique<R7_t>(Experimental::RAxisConfig(n, 0., 1.));
+   }
+   static std::unique_ptr<TH1_t> MakeTH1(const char *name, bool variable)
+   {
+      const int n = GetNBins(1);
+      return variable ? std::make_unique<TH1_t>(name, name, n, MakeEdges(n).data())
+                      : std::make_unique<TH1_t>(name, name, n, 0., 1.);
+   }
+   template <class H>
+   static void Fill(H &h, const double *x)
+   {
+      h.Fill(x[0]);
+   }
+};
+
+template <>
+struct Hists<2> {
+   using R7_t = Experimental::RH2D;
+   using TH1_t = TH2D;
+   static std::unique_ptr<R7_t> MakeR7(bool variable)
+   {
+      const int n = GetNBins(2);
+      return variable ? std::make_unique<R7_t>(Experimental::RAxisConfig(MakeEdges(n)),
+                                               Experimental::RAxisConfig(MakeEdges(n)))
+                      : std::make_unique<R7_t>(Experimental::RAxisConfig(n, 0., 1.),
+                                               Experimental::RAxisConfig(n, 0., 1.));
+   }
+   static std::unique_ptr<TH1_t> MakeTH1(const char *name, bool variable)
+   {
+      const int n = GetNBins(2);
+      const auto edges = MakeEdges(n);
+      return variable ? std::make_unique<TH1_t>(name, name, n, edges.data(), n, edges.data())
+                      : std::make_unique<TH1_t>(name, name, n, 0., 1., n, 0., 1.);
+   }
+   template <class H>
+   static void Fill(H &h, const double *x)
+   {
+      h.Fill(x[0], x[1]);
+   }
+};
+
+template <>
+struct Hists<3> {
+   using R7_t = Experimental::RH3D;
+   using TH1_t = TH3D;
+   static std::unique_ptr<R7_t> MakeR7(bool variable)
+   {
+      const int n = GetNBins(3);
+      return variable ? std::make_unique<R7_t>(Experimental::RAxisConfig(MakeEdges(n)),
+                                               Experimental::RAxisConfig(MakeEdges(n)),
+                                               Experimental::RAxisConfig(MakeEdges(n)))
+                      : std::make_unique<R7_t>(Experimental::RAxisConfig(n, 0., 1.),
+                                               Experimental::RAxisConfig(n, 0., 1.),
+                                               Experimental::RAxisConfig(n, 0., 1.));
+   }
+   static std::unique_ptr<TH1_t> MakeTH1(const char *name, bool variable)
+   {
+      const int n = GetNBins(3);
+      const auto edges = MakeEdges(n);
+      return variable ? std::make_unique<TH1_t>(name, name, n, edges.data(), n, edges.data(), n, edges.data())
+                      : std::make_unique<TH1_t>(name, name, n, 0., 1., n, 0., 1., n, 0., 1.);
+   }
+   template <class H>
+   static void Fill(H &h, const double *x)
+   {
+      h.Fill(x[0], x[1], x[2]);
+   }
+};
+
+/// RHist filled through its RHistConcurrentFiller, which take coordinate arrays
+template <int NDIM>
+struct R7Filler {
+   template <class FILLER>
+   static void Fill(FILLER &filler, const double *x)
+   {
+      typename Hists<NDIM>::R7_t::CoordArray_t coord;
+      for (int d = 0; d < NDIM; ++d)
+         coord[d] = x[d];
+      filler.Fill(coord);
+   }
+};
+
+template <int NDIM>
+void SpeedTest(const Input &input, bool variable, unsigned int nThreads, size_t nFills)
+{
+   using H = Hists<NDIM>;
+   const size_t offset = Input::kSize / 128;
+
+   {
+      auto hist = H::MakeR7(variable);
+      Experimental::RHistConcurrentFillManager<typename H::R7_t> manager(*hist);
+      double seconds = RunThreads(
+         nThreads,
+         [&](unsigned int t) {
+            auto filler = manager.MakeFiller();
+            for (size_t i = 0; i < nFills; ++i)
+               R7Filler<NDIM>::Fill(filler, input.Point(t * offset + i));
+         },
+         [] {});
+      Report("R7 RHistConcurrentFill ", NDIM, variable, nThreads, nFills, seconds);
+   }
+
+   {
+      auto model = H::MakeTH1("threaded", variable);
+      model->SetDirectory(nullptr);
+      TThreadedObject<typename H::TH1_t> hist(TNumSlots{nThreads}, *model);
+      double seconds = RunThreads(
+         nThreads,
+         [&](unsigned int t) {
+            auto h = hist.Get();
+            for (size_t i = 0; i < nFills; ++i)
+               H::Fill(*h, input.Point(t * offset + i));
+         },
+         [&] { hist.Merge(); });
+      Report("TH1 TThreadedObject    ", NDIM, variable, nThreads, nFills, seconds);
+   }
+
+   {
+      auto hist = H::MakeTH1("concurrent", variable);
+      hist->SetDirectory(nullptr);
+      TH1ConcurrentFillManager<typename H::TH1_t> manager(*hist);
+      double seconds = RunThreads(
+         nThreads,
+         [&](unsigned int t) {
+            auto filler = manager.MakeFiller();
+            for (size_t i = 0; i < nFills; ++i)
+               H::Fill(filler, input.Point(t * offset + i));
+         },
+         [] {});
+      Report("TH1 TH1ConcurrentFill  ", NDIM, variable, nThreads, nFills, seconds);
+   }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+   size_t nFills = 1e6;
+   unsigned int maxThreads = 128;
+   if (argc > 1)
+      nFills = atof(argv[1]);
+   if (argc > 2)
+      maxThreads = atoi(argv[2]);
+
+   ROOT::EnableThreadSafety();
+   TH1::AddDirectory(false);
+   const Input input;
+   for (unsigned int nThreads = 1; nThreads <= maxThreads; nThreads *= 2) {
+      for (bool variable : {false, true}) {
+         SpeedTest<1>(input, variable, nThreads, nFills);
+         SpeedTest<2>(input, variable, nThreads, nFills);
+         SpeedTest<3>(input, variable, nThreads, nFills);
+      }
+   }
+}
@@ -75,6 +75,14 @@ public:
    static Int_t        StaticSearch(const TH1 *hist, Double_t sigma=2, Option_t *option="goff", Double_t threshold=0.05);
    static TH1         *StaticBackground(const TH1 *hist,Int_t niter=20, Option_t *option="");
 
+   static const char  *BackgroundBatch(Int_t nspectra, Double_t **spectra, Int_t ssize, Int_t numberIterations,
+                                       Int_t direction, Int_t filterOrder, bool smoothing, Int_t smoothWindow,
+                                       bool compton);
+   static void         SearchHighResBatch(Int_t nspectra, Double_t **source, Double_t **destVector, Int_t ssize,
+                                          Double_t sigma, Double_t threshold, bool backgroundRemove,
+                                          Int_t deconIterations, bool markov, Int_t averWindow, Int_t maxPeaks,
+                                          Int_t *npeaks, Double_t **positions);
+
    ClassDefOverride(TSpectrum,3)  //Peak Finder, background estimator, Deconvolution
 };
 
@@ -8,6 +8,9 @@
 #include "TH1.h"
 #include "TMath.h"
 #include "snprintf.h"
+#include "TSpectrumParallel.h"
+
+#include <vector>
 
 /** \class TSpectrum
     \ingroup Spectrum
@@ -23,6 +26,9 @@
  -   One-dimensional deconvolution
  -   One-dimensional peak search
 
+ Many spectra of the same size can be processed at once with BackgroundBatch() and SearchHighResBatch(): the spectra
+ are then processed in parallel if ROOT::EnableImplicitMT() was called.
+
  The algorithms in this class have been published in the following references:
 
  1.  M.Morhac et al.: Background elimination methods for multidimensional coincidence gamma-ray spectra. Nuclear Instruments and Methods in Physics Research A 401 (1997) 113-132.
@@ -2592,3 +2598,49 @@ TH1 *TSpectrum::StaticBackground(const TH1 *hist,Int_t niter, Option_t *option)
    TSpectrum s;
    return s.Background(hist,niter,option);
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function, estimates the background of nspectra spectra of ssize channels, spectra[i] being replaced by
+/// its background as with TSpectrum::Background(Double_t *, ...), with the same parameters for all the spectra.
+/// The spectra are processed in parallel if ROOT::EnableImplicitMT() was called.
+///
+/// Returns 0 if all the spectra were processed, otherwise the error message of the first one which could not.
+
+const char *TSpectrum::BackgroundBatch(Int_t nspectra, Double_t **spectra, Int_t ssize, Int_t numberIterations,
+                                       Int_t direction, Int_t filterOrder, bool smoothing, Int_t smoothWindow,
+                                       bool compton)
+{
+   std::vector<const char *> errors(nspectra > 0 ? nspectra : 0, nullptr);
+   TSpectrumParallel::ForEach(nspectra, [&](Int_t i) {
+      TSpectrum s(1);
+      errors[i] =
+         s.Background(spectra[i], ssize, numberIterations, direction, filterOrder, smoothing, smoothWindow, compton);
+   });
+   for (auto error : errors) {
+      if (error)
+         return error;
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function, searches the peaks of nspectra spectra of ssize channels as TSpectrum::SearchHighRes does, with
+/// the same parameters for all the spectra and at most maxPeaks peaks per spectrum. The spectra are processed in
+/// parallel if ROOT::EnableImplicitMT() was called.
+///
+///   - source[i], destVector[i]: the spectrum i and its deconvolved spectrum, of ssize channels
+///   - npeaks[i]: filled with the number of peaks found in spectrum i
+///   - positions[i]: filled with the positions of these peaks (see GetPositionX()), arrays of maxPeaks values
+
+void TSpectrum::SearchHighResBatch(Int_t nspectra, Double_t **source, Double_t **destVector, Int_t ssize,
+                                   Double_t sigma, Double_t threshold, bool backgroundRemove, Int_t deconIterations,
+                                   bool markov, Int_t averWindow, Int_t maxPeaks, Int_t *npeaks, Double_t **positions)
+{
+   TSpectrumParallel::ForEach(nspectra, [&](Int_t i) {
+      TSpectrum s(maxPeaks);
+      npeaks[i] = s.SearchHighRes(source[i], destVector[i], ssize, sigma, threshold, backgroundRemove,
+                                  deconIterations, markov, averWindow);
+      for (Int_t p = 0; p < npeaks[i]; ++p)
+         positions[i][p] = s.GetPositionX()[p];
+   });
+}
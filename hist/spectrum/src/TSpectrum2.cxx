@@ -46,6 +46,7 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TSpectrumParallel.h"
 #define PEAK_WINDOW 1024
 
 Int_t TSpectrum2::fgIterations    = 3;
@@ -945,41 +946,45 @@ const char *TSpectrum2::Deconvolution(Double_t **source, Double_t **resp,
          }
       }
       for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i2 = 0; i2 < ssizey; i2++) {
-            for (i1 = 0; i1 < ssizex; i1++) {
-               ldb = 0;
-               j2min = i2;
-               if (j2min > lhy - 1)
-                  j2min = lhy - 1;
-               j2min = -j2min;
-               j2max = ssizey - i2 - 1;
-               if (j2max > lhy - 1)
-                  j2max = lhy - 1;
-               j1min = i1;
-               if (j1min > lhx - 1)
-                  j1min = lhx - 1;
-               j1min = -j1min;
-               j1max = ssizex - i1 - 1;
-               if (j1max > lhx - 1)
-                  j1max = lhx - 1;
-               for (j2 = j2min; j2 <= j2max; j2++) {
-                  for (j1 = j1min; j1 <= j1max; j1++) {
-                     ldc =  working_space[j1 - i1min][j2 - i2min + 2 * ssizey];
-                     lda = working_space[i1 + j1][i2 + j2 + 3 * ssizey];
-                     ldb = ldb + lda * ldc;
+         // the rows of the new estimate are independent: they are computed in parallel with IMT
+         const Double_t nops = Double_t(ssizex) * ssizey * (2 * lhx - 1) * (2 * lhy - 1);
+         TSpectrumParallel::ForBlocks(0, ssizey, 4, nops, [&](Int_t begin, Int_t end) {
+            for (Int_t i2 = begin; i2 < end; i2++) {
+               for (Int_t i1 = 0; i1 < ssizex; i1++) {
+                  Double_t ldb = 0;
+                  Int_t j2min = i2;
+                  if (j2min > lhy - 1)
+                     j2min = lhy - 1;
+                  j2min = -j2min;
+                  Int_t j2max = ssizey - i2 - 1;
+                  if (j2max > lhy - 1)
+                     j2max = lhy - 1;
+                  Int_t j1min = i1;
+                  if (j1min > lhx - 1)
+                     j1min = lhx - 1;
+                  j1min = -j1min;
+                  Int_t j1max = ssizex - i1 - 1;
+                  if (j1max > lhx - 1)
+                     j1max = lhx - 1;
+                  for (Int_t j2 = j2min; j2 <= j2max; j2++) {
+                     for (Int_t j1 = j1min; j1 <= j1max; j1++) {
+                        Double_t ldc =  working_space[j1 - i1min][j2 - i2min + 2 * ssizey];
+                        Double_t lda = working_space[i1 + j1][i2 + j2 + 3 * ssizey];
+                        ldb = ldb + lda * ldc;
+                     }
+                  }
+                  Double_t lda = working_space[i1][i2 + 3 * ssizey];
+                  Double_t ldc = working_space[i1][i2 + 1 * ssizey];
+                  if (ldc * lda != 0 && ldb != 0) {
+                     lda = lda * ldc / ldb;
                   }
-               }
-               lda = working_space[i1][i2 + 3 * ssizey];
-               ldc = working_space[i1][i2 + 1 * ssizey];
-               if (ldc * lda != 0 && ldb != 0) {
-                  lda = lda * ldc / ldb;
-               }
 
-               else
-                  lda = 0;
-               working_space[i1][i2 + 4 * ssizey] = lda;
+                  else
+                     lda = 0;
+                  working_space[i1][i2 + 4 * ssizey] = lda;
+               }
             }
-         }
+         });
          for (i2 = 0; i2 < ssizey; i2++) {
             for (i1 = 0; i1 < ssizex; i1++)
                working_space[i1][i2 + 3 * ssizey] =
@@ -1566,50 +1571,54 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
    }
    //START OF ITERATIONS
    for(lindex = 0; lindex < deconIterations; lindex++){
-      for(i2 = 0; i2 < ssizey_ext; i2++){
-         for(i1 = 0; i1 < ssizex_ext; i1++){
-            lda = working_space[i1][i2 + ssizey_ext];
-            ldc = working_space[i1][i2 + 14 * ssizey_ext];
-            if(lda > 0.000001 && ldc > 0.000001){
-               ldb=0;
-               j2min=i2;
-               if(j2min > lhy - 1)
-                  j2min = lhy - 1;
-
-               j2min = -j2min;
-               j2max = ssizey_ext - i2 - 1;
-               if(j2max > lhy - 1)
-                  j2max = lhy - 1;
-
-               j1min = i1;
-               if(j1min > lhx - 1)
-                  j1min = lhx - 1;
-
-               j1min = -j1min;
-               j1max = ssizex_ext - i1 - 1;
-               if(j1max > lhx - 1)
-                  j1max = lhx - 1;
-
-               for(j2 = j2min; j2 <= j2max; j2++){
-                  for(j1 = j1min; j1 <= j1max; j1++){
-                     k = (j1 + ssizex_ext) / ssizex_ext;
-                     ldc = working_space[(j1 + ssizex_ext) % ssizex_ext][j2 + ssizey_ext + 10 * ssizey_ext + k * 2 * ssizey_ext];
-                     lda = working_space[i1 + j1][i2 + j2 + ssizey_ext];
-                     ldb = ldb + lda * ldc;
+      // the rows of the new estimate are independent: they are computed in parallel with IMT
+      const Double_t nops = Double_t(ssizex_ext) * ssizey_ext * (2 * lhx - 1) * (2 * lhy - 1);
+      TSpectrumParallel::ForBlocks(0, ssizey_ext, 4, nops, [&](Int_t begin, Int_t end) {
+         for(Int_t i2 = begin; i2 < end; i2++){
+            for(Int_t i1 = 0; i1 < ssizex_ext; i1++){
+               Double_t lda = working_space[i1][i2 + ssizey_ext];
+               Double_t ldc = working_space[i1][i2 + 14 * ssizey_ext];
+               if(lda > 0.000001 && ldc > 0.000001){
+                  Double_t ldb=0;
+                  Int_t j2min=i2;
+                  if(j2min > lhy - 1)
+                     j2min = lhy - 1;
+
+                  j2min = -j2min;
+                  Int_t j2max = ssizey_ext - i2 - 1;
+                  if(j2max > lhy - 1)
+                     j2max = lhy - 1;
+
+                  Int_t j1min = i1;
+                  if(j1min > lhx - 1)
+                     j1min = lhx - 1;
+
+                  j1min = -j1min;
+                  Int_t j1max = ssizex_ext - i1 - 1;
+                  if(j1max > lhx - 1)
+                     j1max = lhx - 1;
+
+                  for(Int_t j2 = j2min; j2 <= j2max; j2++){
+                     for(Int_t j1 = j1min; j1 <= j1max; j1++){
+                        Int_t k = (j1 + ssizex_ext) / ssizex_ext;
+                        ldc = working_space[(j1 + ssizex_ext) % ssizex_ext][j2 + ssizey_ext + 10 * ssizey_ext + k * 2 * ssizey_ext];
+                        lda = working_space[i1 + j1][i2 + j2 + ssizey_ext];
+                        ldb = ldb + lda * ldc;
+                     }
+                  }
+                  lda = working_space[i1][i2 + ssizey_ext];
+                  ldc = working_space[i1][i2 + 14 * ssizey_ext];
+                  if(ldc * lda != 0 && ldb != 0){
+                     lda =lda * ldc / ldb;
                   }
-               }
-               lda = working_space[i1][i2 + ssizey_ext];
-               ldc = working_space[i1][i2 + 14 * ssizey_ext];
-               if(ldc * lda != 0 && ldb != 0){
-                  lda =lda * ldc / ldb;
-               }
 
-               else
-                  lda=0;
-               working_space[i1][i2 + 2 * ssizey_ext] = lda;
+                  else
+                     lda=0;
+                  working_space[i1][i2 + 2 * ssizey_ext] = lda;
+               }
             }
          }
-      }
+      });
       for(i2 = 0; i2 < ssizey_ext; i2++){
          for(i1 = 0; i1 < ssizex_ext; i1++)
             working_space[i1][i2 + ssizey_ext] = working_space[i1][i2 + 2 * ssizey_ext];
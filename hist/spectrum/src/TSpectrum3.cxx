@@ -50,6 +50,7 @@
 #include "TSpectrum3.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TSpectrumParallel.h"
 #define PEAK_WINDOW 1024
 
 ClassImp(TSpectrum3);
@@ -1736,52 +1737,56 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
          }
       }
       for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i3 = 0; i3 < ssizez; i3++) {
-            for (i2 = 0; i2 < ssizey; i2++) {
-               for (i1 = 0; i1 < ssizex; i1++) {
-                  ldb = 0;
-                  j3min = i3;
-                  if (j3min > lhz - 1)
-                     j3min = lhz - 1;
-                  j3min = -j3min;
-                  j3max = ssizez - i3 - 1;
-                  if (j3max > lhz - 1)
-                     j3max = lhz - 1;
-                  j2min = i2;
-                  if (j2min > lhy - 1)
-                     j2min = lhy - 1;
-                  j2min = -j2min;
-                  j2max = ssizey - i2 - 1;
-                  if (j2max > lhy - 1)
-                     j2max = lhy - 1;
-                  j1min = i1;
-                  if (j1min > lhx - 1)
-                     j1min = lhx - 1;
-                  j1min = -j1min;
-                  j1max = ssizex - i1 - 1;
-                  if (j1max > lhx - 1)
-                     j1max = lhx - 1;
-                  for (j3 = j3min; j3 <= j3max; j3++) {
-                     for (j2 = j2min; j2 <= j2max; j2++) {
-                        for (j1 = j1min; j1 <= j1max; j1++) {
-                           ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * ssizez];
-                           lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * ssizez];
-                           ldb = ldb + lda * ldc;
+         // the planes of the new estimate are independent: they are computed in parallel with IMT
+         const Double_t nops = Double_t(ssizex) * ssizey * ssizez * (2 * lhx - 1) * (2 * lhy - 1) * (2 * lhz - 1);
+         TSpectrumParallel::ForBlocks(0, ssizez, 1, nops, [&](Int_t begin, Int_t end) {
+            for (Int_t i3 = begin; i3 < end; i3++) {
+               for (Int_t i2 = 0; i2 < ssizey; i2++) {
+                  for (Int_t i1 = 0; i1 < ssizex; i1++) {
+                     Double_t ldb = 0;
+                     Int_t j3min = i3;
+                     if (j3min > lhz - 1)
+                        j3min = lhz - 1;
+                     j3min = -j3min;
+                     Int_t j3max = ssizez - i3 - 1;
+                     if (j3max > lhz - 1)
+                        j3max = lhz - 1;
+                     Int_t j2min = i2;
+                     if (j2min > lhy - 1)
+                        j2min = lhy - 1;
+                     j2min = -j2min;
+                     Int_t j2max = ssizey - i2 - 1;
+                     if (j2max > lhy - 1)
+                        j2max = lhy - 1;
+                     Int_t j1min = i1;
+                     if (j1min > lhx - 1)
+                        j1min = lhx - 1;
+                     j1min = -j1min;
+                     Int_t j1max = ssizex - i1 - 1;
+                     if (j1max > lhx - 1)
+                        j1max = lhx - 1;
+                     for (Int_t j3 = j3min; j3 <= j3max; j3++) {
+                        for (Int_t j2 = j2min; j2 <= j2max; j2++) {
+                           for (Int_t j1 = j1min; j1 <= j1max; j1++) {
+                              Double_t ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * ssizez];
+                              Double_t lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * ssizez];
+                              ldb = ldb + lda * ldc;
+                           }
                         }
                      }
-                  }
-                  lda = working_space[i1][i2][i3 + 3 * ssizez];
-                  ldc = working_space[i1][i2][i3 + 1 * ssizez];
-                  if (ldc * lda != 0 && ldb != 0) {
-                     lda = lda * ldc / ldb;
-                  }
+                     Double_t lda = working_space[i1][i2][i3 + 3 * ssizez];
+                     Double_t ldc = working_space[i1][i2][i3 + 1 * ssizez];
+                     if (ldc * lda != 0 && ldb != 0) {
+                        lda = lda * ldc / ldb;
+                     }
 
-                  else
-                     lda = 0;
-                  working_space[i1][i2][i3 + 4 * ssizez] = lda;
+                     else
+                        lda = 0;
+                     working_space[i1][i2][i3 + 4 * ssizez] = lda;
+                  }
                }
             }
-         }
+         });
          for (i3 = 0; i3 < ssizez; i3++) {
             for (i2 = 0; i2 < ssizey; i2++) {
                for (i1 = 0; i1 < ssizex; i1++)
@@ -3028,60 +3033,64 @@ Int_t TSpectrum3::SearchHighRes(const Double_t***source,Double_t***dest, Int_t s
 
 //START OF ITERATIONS
    for (lindex=0;lindex<deconIterations;lindex++){
-      for (i3 = 0; i3 < sizez_ext; i3++) {
-         for (i2 = 0; i2 < sizey_ext; i2++) {
-            for (i1 = 0; i1 < sizex_ext; i1++) {
-               if (TMath::Abs(working_space[i1][i2][i3 + 3 * sizez_ext])>1e-6 && TMath::Abs(working_space[i1][i2][i3 + 1 * sizez_ext])>1e-6){
-                  ldb = 0;
-                  j3min = i3;
-                  if (j3min > lhz - 1)
-                     j3min = lhz - 1;
-
-                  j3min = -j3min;
-                  j3max = sizez_ext - i3 - 1;
-                  if (j3max > lhz - 1)
-                     j3max = lhz - 1;
-
-                  j2min = i2;
-                  if (j2min > lhy - 1)
-                     j2min = lhy - 1;
-
-                  j2min = -j2min;
-                  j2max = sizey_ext - i2 - 1;
-                  if (j2max > lhy - 1)
-                     j2max = lhy - 1;
-
-                  j1min = i1;
-                  if (j1min > lhx - 1)
-                     j1min = lhx - 1;
-
-                  j1min = -j1min;
-                  j1max = sizex_ext - i1 - 1;
-                  if (j1max > lhx - 1)
-                     j1max = lhx - 1;
-
-                  for (j3 = j3min; j3 <= j3max; j3++) {
-                     for (j2 = j2min; j2 <= j2max; j2++) {
-                        for (j1 = j1min; j1 <= j1max; j1++) {
-                           ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * sizez_ext];
-                           lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * sizez_ext];
-                           ldb = ldb + lda * ldc;
+      // the planes of the new estimate are independent: they are computed in parallel with IMT
+      const Double_t nops = Double_t(sizex_ext) * sizey_ext * sizez_ext * (2 * lhx - 1) * (2 * lhy - 1) * (2 * lhz - 1);
+      TSpectrumParallel::ForBlocks(0, sizez_ext, 1, nops, [&](Int_t begin, Int_t end) {
+         for (Int_t i3 = begin; i3 < end; i3++) {
+            for (Int_t i2 = 0; i2 < sizey_ext; i2++) {
+               for (Int_t i1 = 0; i1 < sizex_ext; i1++) {
+                  if (TMath::Abs(working_space[i1][i2][i3 + 3 * sizez_ext])>1e-6 && TMath::Abs(working_space[i1][i2][i3 + 1 * sizez_ext])>1e-6){
+                     Double_t ldb = 0;
+                     Int_t j3min = i3;
+                     if (j3min > lhz - 1)
+                        j3min = lhz - 1;
+
+                     j3min = -j3min;
+                     Int_t j3max = sizez_ext - i3 - 1;
+                     if (j3max > lhz - 1)
+                        j3max = lhz - 1;
+
+                     Int_t j2min = i2;
+                     if (j2min > lhy - 1)
+                        j2min = lhy - 1;
+
+                     j2min = -j2min;
+                     Int_t j2max = sizey_ext - i2 - 1;
+                     if (j2max > lhy - 1)
+                        j2max = lhy - 1;
+
+                     Int_t j1min = i1;
+                     if (j1min > lhx - 1)
+                        j1min = lhx - 1;
+
+                     j1min = -j1min;
+                     Int_t j1max = sizex_ext - i1 - 1;
+                     if (j1max > lhx - 1)
+                        j1max = lhx - 1;
+
+                     for (Int_t j3 = j3min; j3 <= j3max; j3++) {
+                        for (Int_t j2 = j2min; j2 <= j2max; j2++) {
+                           for (Int_t j1 = j1min; j1 <= j1max; j1++) {
+                              Double_t ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * sizez_ext];
+                              Double_t lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * sizez_ext];
+                              ldb = ldb + lda * ldc;
+                           }
                         }
                      }
-                  }
-                  lda = working_space[i1][i2][i3 + 3 * sizez_ext];
-                  ldc = working_space[i1][i2][i3 + 1 * sizez_ext];
-                  if (ldc * lda != 0 && ldb != 0) {
-                     lda = lda * ldc / ldb;
-                  }
+                     Double_t lda = working_space[i1][i2][i3 + 3 * sizez_ext];
+                     Double_t ldc = working_space[i1][i2][i3 + 1 * sizez_ext];
+                     if (ldc * lda != 0 && ldb != 0) {
+                        lda = lda * ldc / ldb;
+                     }
 
-                  else
-                     lda = 0;
-                  working_space[i1][i2][i3 + 4 * sizez_ext] = lda;
+                     else
+                        lda = 0;
+                     working_space[i1][i2][i3 + 4 * sizez_ext] = lda;
+                  }
                }
             }
          }
-      }
+      });
       for (i3 = 0; i3 < sizez_ext; i3++) {
          for (i2 = 0; i2 < sizey_ext; i2++) {
             for (i1 = 0; i1 < sizex_ext; i1++)
@@ -0,0 +1,79 @@
+// @(#)root/spectrum:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TSpectrumParallel
+#define ROOT_TSpectrumParallel
+
+// Helper of the spectrum package (not installed) to split the loops of the iterative algorithms on the IMT thread pool.
+
+#include "RtypesCore.h"
+
+#include <algorithm>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+namespace TSpectrumParallel {
+
+/// Minimum number of floating point operations of a loop for which it is worth to split it between threads
+constexpr Double_t kMinParallelOps = 1.e6;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(begin, end) for the consecutive ranges of `block` indices in [first, last), on the threads of the
+/// IMT pool if ROOT::EnableImplicitMT() was called and the loop is worth it, i.e. it takes about `nops` operations.
+/// The ranges must be independent: the results then don't depend on the number of threads.
+
+template <class F>
+void ForBlocks(Int_t first, Int_t last, Int_t block, Double_t nops, F &&func)
+{
+   if (last <= first)
+      return;
+#ifdef R__USE_IMT
+   const Int_t nBlocks = (last - first + block - 1) / block;
+   if (nBlocks > 1 && nops >= kMinParallelOps && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](Int_t b) {
+            const Int_t begin = first + b * block;
+            func(begin, std::min(last, begin + block));
+         },
+         ROOT::TSeqI(nBlocks));
+      return;
+   }
+#else
+   (void)block;
+   (void)nops;
+#endif
+   func(first, last);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(i) for all i in [0, n), on the threads of the IMT pool if ROOT::EnableImplicitMT() was called.
+/// Used for the batches of independent spectra.
+
+template <class F>
+void ForEach(Int_t n, F &&func)
+{
+#ifdef R__USE_IMT
+   if (n > 1 && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Int_t i) { func(i); }, ROOT::TSeqI(n));
+      return;
+   }
+#endif
+   for (Int_t i = 0; i < n; ++i)
+      func(i);
+}
+
+} // namespace TSpectrumParallel
+
+#endif
@@ -207,6 +207,12 @@ class TUnfold : public TObject {
    TMatrixDSparse *fEinv;
    /// matrix E
    TMatrixDSparse *fE;
+   /// cached A<sup>T</sup>Vyy<sup>-1</sup>, does not depend on tau
+   TMatrixDSparse *fAtVyyInv; //!
+   /// cached A<sup>T</sup>Vyy<sup>-1</sup>A, does not depend on tau
+   TMatrixDSparse *fAtVyyInvA; //!
+   /// cached L<sup>T</sup>L, does not depend on tau
+   TMatrixDSparse *fLSquared; //!
  protected:
    // Int_t IsNotSymmetric(TMatrixDSparse const &m) const;
    virtual Double_t DoUnfold(void);     // the unfolding algorithm
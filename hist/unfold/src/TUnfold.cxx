@@ -140,6 +140,9 @@ TUnfold::~TUnfold(void)
    DeleteMatrix(&fY);
    DeleteMatrix(&fX0);
    DeleteMatrix(&fVyyInv);
+   DeleteMatrix(&fAtVyyInv);
+   DeleteMatrix(&fAtVyyInvA);
+   DeleteMatrix(&fLSquared);
 
    ClearResults();
 }
@@ -181,6 +184,9 @@ void TUnfold::InitTUnfold(void)
    fDXDY = 0;
    fEinv = 0;
    fE = 0;
+   fAtVyyInv = 0;
+   fAtVyyInvA = 0;
+   fLSquared = 0;
    fEpsMatrix=1.E-13;
    fIgnoredBins=0;
 }
@@ -272,6 +278,8 @@ TUnfold::TUnfold(void)
 ///  - Data members modified:
 ///      - fVyyInv: inverse of input data covariance matrix
 ///      - fNdf: number of degrees of freedom
+///      - fAtVyyInv, fAtVyyInvA, fLSquared: products of the input matrices
+///        which do not depend on tau, computed once and kept for scans of tau
 ///      - fEinv: inverse of the matrix needed for unfolding calculations
 ///      - fE:    the matrix needed for unfolding calculations
 ///      - fX:    unfolded data points
@@ -300,18 +308,33 @@ Double_t TUnfold::DoUnfold(void)
       }
    }
    //
-   // get matrix
+   // get matrices
    //              T
    //            fA fV  = mAt_V
    //
-   TMatrixDSparse *AtVyyinv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+   //              T
+   //           (fA fV)fA
+   //
+   //              T
+   //            fL fL  = lSquared
+   //
+   // they do not depend on tau, so they are kept for the next call,
+   // e.g. in a scan of tau, until the input or regularisation changes
+   if(!fAtVyyInv) {
+      fAtVyyInv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+      fAtVyyInvA=MultiplyMSparseMSparse(fAtVyyInv,fA);
+   }
+   if(!fLSquared) {
+      fLSquared=MultiplyMSparseTranspMSparse(fL,fL);
+   }
+   const TMatrixDSparse *AtVyyinv=fAtVyyInv;
+   const TMatrixDSparse *lSquared=fLSquared;
    //
    // get
    //       T
    //     fA fVyyinv fY + fTauSquared fBiasScale Lsquared fX0 = rhs
    //
    TMatrixDSparse *rhs=MultiplyMSparseM(AtVyyinv,fY);
-   TMatrixDSparse *lSquared=MultiplyMSparseTranspMSparse(fL,fL);
    if (fBiasScale != 0.0) {
      TMatrixDSparse *rhs2=MultiplyMSparseM(lSquared,fX0);
       AddMSparse(rhs, fTauSquared * fBiasScale ,rhs2);
@@ -322,7 +345,7 @@ Double_t TUnfold::DoUnfold(void)
    // get matrix
    //              T
    //           (fA fV)fA + fTauSquared*fLsquared  = fEinv
-   fEinv=MultiplyMSparseMSparse(AtVyyinv,fA);
+   fEinv=new TMatrixDSparse(*fAtVyyInvA);
    AddMSparse(fEinv,fTauSquared,lSquared);
 
    //
@@ -428,7 +451,6 @@ Double_t TUnfold::DoUnfold(void)
       DeleteMatrix(&corr);
    }
 
-   DeleteMatrix(&AtVyyinv);
 
    //
    // get error matrix on x
@@ -492,7 +514,6 @@ Double_t TUnfold::DoUnfold(void)
    DeleteMatrix(&epsilon);
 
    DeleteMatrix(&LsquaredDx);
-   DeleteMatrix(&lSquared);
 
    // calculate/store matrices defining the derivatives dx/dA
    fDXDAM[0]=new TMatrixDSparse(*fE);
@@ -2016,6 +2037,7 @@ Bool_t TUnfold::AddRegularisationCondition
    // replace the old matrix fL
    if(r) {
       DeleteMatrix(&fL);
+      DeleteMatrix(&fLSquared);
       fL=CreateSparseMatrix(rowMax+1,GetNx(),nF,l_row,l_col,l_data);
    }
    delete [] l_row;
@@ -2303,6 +2325,8 @@ Int_t TUnfold::SetInput(const TH1 *input, Double_t scaleBias,
                         const TH2 *hist_vyy_inv)
 {
   DeleteMatrix(&fVyyInv);
+  DeleteMatrix(&fAtVyyInv);
+  DeleteMatrix(&fAtVyyInvA);
   fNdf=0;
 
   fBiasScale = scaleBias;
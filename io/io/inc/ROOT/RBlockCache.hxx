@@ -0,0 +1,86 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RBlockCache
+#define ROOT_RBlockCache
+
+#include <ROOT/RRawFile.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RBlockCache RBlockCache.hxx
+ * \ingroup IO
+ *
+ * A persistent cache of the blocks of remote files in a local directory, shared by all the processes using the
+ * same directory. The remote file is split in blocks of fixed size; each block is stored in its own file, named
+ * after the URL, the size and the modification time of the remote file (so that a modified file is not served from
+ * stale blocks) and the block index. Blocks are written to a temporary file and renamed into place, so concurrent
+ * processes never see partial blocks. Reading a block refreshes its modification time; when the cache grows beyond
+ * its maximum size, the least recently used blocks are removed.
+ *
+ * The remote file classes (TNetXNGFile, TDavixFile, RRawFileNetXNG, RRawFileDavix) use the cache configured by the
+ * rootrc settings TFile.BlockCacheDir and TFile.BlockCacheSize, see Get(), for files opened read-only.
+ */
+class RBlockCache {
+public:
+   using RIOVec = RRawFile::RIOVec;
+   /// Reads the given ranges from the remote file and sets their fOutBytes; throws on failure
+   using FetchFunc_t = std::function<void(RIOVec *ioVec, unsigned int nReq)>;
+
+   static constexpr std::size_t kDefaultBlockSize = 256 * 1024;
+
+private:
+   std::string fDirectory;
+   std::uint64_t fMaxSize;
+   std::size_t fBlockSize;
+
+   std::mutex fLock;            ///< Protects the members below
+   std::uint64_t fUsedSize = 0; ///< Estimate of the cache size, refreshed by Evict()
+   bool fUsedSizeKnown = false;
+
+   std::string GetBlockPath(const std::string &fileKey, std::uint64_t blockIdx) const;
+   bool LoadBlock(const std::string &path, char *buffer, std::size_t size);
+   void StoreBlock(const std::string &path, const char *buffer, std::size_t size);
+   void Evict();
+
+public:
+   RBlockCache(const std::string &directory, std::uint64_t maxSize, std::size_t blockSize = kDefaultBlockSize);
+   RBlockCache(const RBlockCache &) = delete;
+   RBlockCache &operator=(const RBlockCache &) = delete;
+
+   /// The process-wide cache configured with TFile.BlockCacheDir (disabled if empty, the default) and
+   /// TFile.BlockCacheSize (in MB, 10000 by default); nullptr if disabled.
+   static RBlockCache *Get();
+
+   /// Identifies a version of a remote file; an unknown modification time can be given as 0.
+   static std::string MakeFileKey(const std::string &url, std::uint64_t fileSize, std::int64_t modTime);
+
+   /// Serve the vector read from the cached blocks; the missing blocks are fetched, in a single vector read, and
+   /// stored. Requests beyond the end of the file are truncated, as reflected by their fOutBytes.
+   void ReadV(const std::string &fileKey, std::uint64_t fileSize, RIOVec *ioVec, unsigned int nReq,
+              const FetchFunc_t &fetch);
+
+   const std::string &GetDirectory() const { return fDirectory; }
+   std::size_t GetBlockSize() const { return fBlockSize; }
+   std::uint64_t GetMaxSize() const { return fMaxSize; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,93 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RBufferPool
+#define ROOT_RBufferPool
+
+#include "ROOT/RMemoryAccounting.hxx"
+#include "TBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+class TBufferFile;
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RBufferPool RBufferPool.hxx
+ * \ingroup IO
+ *
+ * A process-wide pool of TBufferFile objects, so that the large buffers of the TBaskets and of the TBufferMerger
+ * are recycled instead of being allocated and freed over and over, e.g. when reading many branches of the many
+ * files of a TChain. Buffers are kept in size classes, powers of two between kMinSize and kMaxSize; a released
+ * buffer goes to the class of the largest power of two not above its capacity and a request is served from the
+ * class of the smallest power of two not below the requested size. Released buffers are deleted when the pool
+ * would hold more than its maximum size, or when they do not own their memory.
+ *
+ * The pool used by TBasket and TBufferMerger is configured by the rootrc setting TFile.BufferPoolSize (in MB,
+ * 64 by default, 0 disables the pool), see Get(). The memory held is accounted as EMemoryTag::kBufferPool.
+ */
+class RBufferPool {
+public:
+   static constexpr Int_t kMinSize = 1024;
+   static constexpr Int_t kMaxSize = 64 * 1024 * 1024;
+
+   struct RStats {
+      std::uint64_t fNHits = 0;     ///< Requests served by a pooled buffer
+      std::uint64_t fNMisses = 0;   ///< Requests for which a buffer was allocated
+      std::uint64_t fNReleased = 0; ///< Buffers given back and kept in the pool
+      std::uint64_t fNDropped = 0;  ///< Buffers given back and deleted
+      std::uint64_t fHeldBytes = 0; ///< Capacity of the buffers currently in the pool
+   };
+
+private:
+   static constexpr int kNClasses = 17; // 2^10 ... 2^26
+
+   std::uint64_t fMaxSize;
+   mutable std::mutex fLock; ///< Protects the members below
+   std::vector<TBufferFile *> fFree[kNClasses];
+   RStats fStats;
+   ROOT::Experimental::MemoryAccounting::RAccountedSize fAccounted{ROOT::Experimental::EMemoryTag::kBufferPool};
+
+   void DeleteBuffers();
+
+public:
+   explicit RBufferPool(std::uint64_t maxSize);
+   RBufferPool(const RBufferPool &) = delete;
+   RBufferPool &operator=(const RBufferPool &) = delete;
+   ~RBufferPool();
+
+   /// The process-wide pool configured with TFile.BufferPoolSize; nullptr if disabled.
+   static RBufferPool *Get();
+
+   /// A buffer of at least size bytes, reset and in the given mode, owned by the caller until Release().
+   TBufferFile *Acquire(TBuffer::EMode mode, Int_t size);
+   /// Give back a buffer obtained with Acquire() or allocated with new; the pool takes ownership.
+   void Release(TBuffer *buffer);
+   /// Delete the buffers held by the pool.
+   void Clear();
+
+   RStats GetStats() const;
+   std::uint64_t GetMaxSize() const { return fMaxSize; }
+
+   /// Acquire from the pool returned by Get() if any, otherwise allocate a new buffer.
+   static TBufferFile *AcquireBuffer(TBuffer::EMode mode, Int_t size);
+   /// Release to the pool returned by Get() if any, otherwise delete the buffer.
+   static void ReleaseBuffer(TBuffer *buffer);
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -9,6 +9,7 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
@@ -167,6 +168,53 @@ public:
       }
       return;
    }
+
+   /// Submit up to GetQueueDepth() read events without waiting for them. Returns the number of submitted events,
+   /// the first ones of readEvents, which must then be reaped by WaitReads().
+   unsigned int SubmitReads(RReadEvent *readEvents, unsigned int nReads) {
+      unsigned int nSubmit = std::min(nReads, fDepth);
+      for (std::size_t i = 0; i < nSubmit; ++i) {
+         struct io_uring_sqe *sqe = io_uring_get_sqe(&fRing);
+         if (!sqe) {
+            throw std::runtime_error("get SQE failed for read request '" + std::to_string(i)
+               + "', error: " + std::string(strerror(errno)));
+         }
+         if (readEvents[i].fFileDes == -1 || readEvents[i].fBuffer == nullptr) {
+            throw std::runtime_error("bad fd or null read buffer for read request '" + std::to_string(i) + "'");
+         }
+         io_uring_prep_read(sqe, readEvents[i].fFileDes, readEvents[i].fBuffer, readEvents[i].fSize,
+                            readEvents[i].fOffset);
+         sqe->flags |= IOSQE_ASYNC;
+         sqe->user_data = i;
+      }
+      int submitted = io_uring_submit(&fRing);
+      if (submitted != static_cast<int>(nSubmit)) {
+         throw std::runtime_error("ring submitted " + std::to_string(submitted) +
+            " events but requested " + std::to_string(nSubmit));
+      }
+      return nSubmit;
+   }
+
+   /// Wait for the completion of the nSubmitted events returned by SubmitReads() for the same readEvents.
+   void WaitReads(RReadEvent *readEvents, unsigned int nSubmitted) {
+      struct io_uring_cqe *cqe;
+      for (unsigned int i = 0; i < nSubmitted; ++i) {
+         int ret = io_uring_wait_cqe(&fRing, &cqe);
+         if (ret < 0) {
+            throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
+         }
+         auto index = reinterpret_cast<std::size_t>(io_uring_cqe_get_data(cqe));
+         if (index >= nSubmitted) {
+            throw std::runtime_error("bad cqe user data: " + std::to_string(index));
+         }
+         if (cqe->res < 0) {
+            throw std::runtime_error("read failed for ReadEvent[" + std::to_string(index) + "], "
+               "error: " + std::string(std::strerror(-cqe->res)));
+         }
+         readEvents[index].fOutBytes = static_cast<std::size_t>(cqe->res);
+         io_uring_cqe_seen(&fRing, cqe);
+      }
+   }
 };
 
 } // namespace Internal
@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -52,7 +53,7 @@ public:
    static constexpr int kFeatureHasSize = 0x01;
    /// Map() and Unmap() are implemented
    static constexpr int kFeatureHasMmap = 0x02;
-   /// File supports async IO
+   /// File supports async IO, i.e. ReadVAsync() issues the reads without blocking
    static constexpr int kFeatureHasAsyncIo = 0x04;
 
    /// On construction, an ROptions parameter can customize the RRawFile behavior
@@ -63,7 +64,14 @@ public:
        * that the protocol-dependent default block size should be used.
        */
       int fBlockSize;
-      ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1) {}
+      /**
+       * Map the entire file into memory when it is opened and serve reads from the mapping. Only honored for
+       * regular local files by implementations that support mmap; otherwise the option is silently ignored.
+       * The mapped bytes can be accessed without a copy through GetMappedData(). The file must not be truncated
+       * while it is mapped.
+       */
+      bool fUseMmap;
+      ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1), fUseMmap(false) {}
    };
 
    /// Used for vector reads from multiple offsets into multiple buffers. This is unlike readv(), which scatters a
@@ -134,9 +142,15 @@ protected:
    virtual void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset);
    /// Derived classes with mmap support must be able to unmap the memory area handed out by Map()
    virtual void UnmapImpl(void *region, size_t nbytes);
+   /// Derived classes that map the entire file (see ROptions::fUseMmap) return a pointer into the mapping.
+   /// The default implementation returns nullptr.
+   virtual const unsigned char *GetMappedDataImpl(size_t nbytes, std::uint64_t offset);
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// Derived classes that set kFeatureHasAsyncIo start the reads and return a future that becomes ready once the
+   /// buffers are filled. The default implementation defers a call to ReadVImpl until the future is waited for.
+   virtual std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -172,6 +186,10 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and calls ReadVAsyncImpl. The ioVec array and the buffers must stay valid until
+   /// the returned future is ready; errors are reported by std::future::get(). Without kFeatureHasAsyncIo, the
+   /// reads are carried out by the thread that waits for the future.
+   std::future<void> ReadVAsync(RIOVec *ioVec, unsigned int nReq);
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
@@ -179,6 +197,10 @@ public:
    void *Map(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset);
    /// Receives a pointer returned by Map() and should have nbytes set to the full length of the mapping
    void Unmap(void *region, size_t nbytes);
+   /// If the file was opened with ROptions::fUseMmap and the mapping succeeded, returns a pointer to the
+   /// nbytes starting at offset. The pointer stays valid as long as the RRawFile object is alive. Returns nullptr
+   /// if the file is not mapped or if the range exceeds the mapped file, in which case ReadAt() has to be used.
+   const unsigned char *GetMappedData(size_t nbytes, std::uint64_t offset);
 
    /// Derived classes shall inform the user about the supported functionality, which can possibly depend
    /// on the file at hand
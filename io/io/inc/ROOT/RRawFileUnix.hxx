@@ -15,30 +15,59 @@
 #include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include "RConfigure.h"
+
 #include <cstddef>
 #include <cstdint>
+#ifdef R__HAS_URING
+#include <memory>
+#include <mutex>
+#endif
 
 namespace ROOT {
 namespace Internal {
 
+#ifdef R__HAS_URING
+class RIoUring;
+#endif
+
 /**
  * \class RRawFileUnix RRawFileUnix.hxx
  * \ingroup IO
  *
  * The RRawFileUnix class uses POSIX calls to read from a mounted file system. Thus the path name can refer,
  * for instance, to a named pipe instead of a regular file.
+ *
+ * With ROptions::fUseMmap, regular files are mapped as a whole when opened. Reads are then served by copying from
+ * the mapping and GetMappedData() hands out pointers into it, so that the data is shared with the page cache.
+ *
+ * If ROOT is built with io_uring support, ReadVAsync() submits the reads to a dedicated ring and returns right away;
+ * the completions are reaped when the future is waited for.
  */
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+   /// The read-only mapping of the entire file if fOptions.fUseMmap is set and the file could be mapped
+   unsigned char *fMmapRegion = nullptr;
+   /// The length of fMmapRegion, i.e. the file size at the time of opening
+   std::uint64_t fMmapSize = 0;
+#ifdef R__HAS_URING
+   /// Created on the first vector read and reused by all following ones: setting up a ring (mapping its submission
+   /// and completion queues) costs about as much as a batch of reads from a fast device
+   std::unique_ptr<RIoUring> fIoUring;
+   /// Protects fIoUring; concurrent vector reads from other threads use a temporary ring instead of waiting
+   std::mutex fIoUringMutex;
+#endif
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) final;
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
+   const unsigned char *GetMappedDataImpl(size_t nbytes, std::uint64_t offset) final;
 
 public:
    RRawFileUnix(std::string_view url, RRawFile::ROptions options);
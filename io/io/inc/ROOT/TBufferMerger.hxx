@@ -15,10 +15,13 @@
 #include "TFileMerger.h"
 #include "TMemFile.h"
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <vector>
 
 namespace ROOT {
 
@@ -35,6 +38,15 @@ class TBufferMergerFile;
  * socket, TBufferMerger uses threads that each write to a
  * TBufferMergerFile, which in turn push data into a queue
  * managed by the TBufferMerger.
+ *
+ * The merging is done by the writing threads themselves, by the
+ * first one that finds an output file that no other thread is
+ * merging into. With several output files, as many threads can
+ * merge concurrently; each merge goes to the output that has
+ * received the fewest bytes so far, which keeps the outputs of
+ * similar size. The queue can be bounded with SetMaxBuffered(),
+ * in which case writing threads that would exceed the bound wait
+ * for an output and merge the queue themselves.
  */
 
 class TBufferMerger {
@@ -47,11 +59,24 @@ public:
    TBufferMerger(const char *name, Option_t *option = "RECREATE",
                  Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
 
+   /** Constructor for several output files, merged into concurrently
+    * @param name Output file name; for more than one output file, "_<index>" is inserted before the extension
+    * @param option Output file creation options
+    * @param compress Output file compression level
+    * @param nOutputFiles Number of output files
+    */
+   TBufferMerger(const char *name, Option_t *option, Int_t compress, unsigned int nOutputFiles);
+
    /** Constructor
     * @param output Output \c TFile
     */
    TBufferMerger(std::unique_ptr<TFile> output);
 
+   /** Constructor for several output files, merged into concurrently
+    * @param outputs Output \c TFiles
+    */
+   TBufferMerger(std::vector<std::unique_ptr<TFile>> outputs);
+
    /** Destructor */
    virtual ~TBufferMerger();
 
@@ -79,6 +104,37 @@ public:
    /** Returns the current value of the auto save setting in bytes (default = 0). */
    size_t GetAutoSave() const;
 
+   /** Returns the bound on the number of bytes in the queue, 0 if unbounded (default). */
+   size_t GetMaxBuffered() const
+   {
+      return fMaxBuffered;
+   }
+
+   /** Returns the number of output files. */
+   size_t GetNOutputFiles() const
+   {
+      return fOutputs.size();
+   }
+
+   /** Returns the i-th output file. */
+   TFile *GetOutputFile(size_t i = 0) const
+   {
+      return fOutputs[i]->fMerger.GetOutputFile();
+   }
+
+   /** Counters of the work done by the merging threads */
+   struct MergeStats {
+      size_t fNMerges = 0;         //< Number of partial merges
+      size_t fNBuffers = 0;        //< Number of buffers and files merged
+      size_t fBytesMerged = 0;     //< Number of bytes of the merged buffers and files
+      double fMergeSeconds = 0;    //< Wall clock time spent merging, summed over the threads
+      double fBlockedSeconds = 0;  //< Wall clock time writing threads waited because the queue was full
+      size_t fMaxQueueBytes = 0;   //< Highest number of bytes observed in the queue
+   };
+
+   /** Returns the merge statistics accumulated so far. */
+   MergeStats GetMergeStats() const;
+
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
@@ -92,6 +148,16 @@ public:
     */
    void SetAutoSave(size_t size);
 
+   /** Bounds the number of bytes held in the queue. A write that would push the
+    *  queue beyond size bytes blocks until an output file is free and then merges
+    *  the queue in the writing thread, so that producers cannot outrun the merging.
+    *  A value of 0 (the default) leaves the queue unbounded.
+    */
+   void SetMaxBuffered(size_t size)
+   {
+      fMaxBuffered = size;
+   }
+
    /** Sets the merge options. SetMergeOptions("fast") will disable
     * recompression of input data into the output if they have different
     * compression settings.
@@ -103,14 +169,15 @@ public:
     * and thus that steps that are specific to TTree can be skipped */
    void SetNotrees(Bool_t notrees=kFALSE)
    {
-      fMerger.SetNotrees(notrees);
+      for (auto &output : fOutputs)
+         output->fMerger.SetNotrees(notrees);
    }
 
    /** Returns whether the file has been marked as not containing any TTree objects
     * and thus that steps that are specific to TTree can be skipped */
    Bool_t GetNotrees() const
    {
-      return fMerger.GetNotrees();
+      return fOutputs[0]->fMerger.GetNotrees();
    }
 
    /** Indicates that the temporary keys (corresponding to the object held by the directories
@@ -149,21 +216,33 @@ private:
    /** TBufferMerger has no copy operator */
    TBufferMerger &operator=(const TBufferMerger &);
 
-   void Init(std::unique_ptr<TFile>);
+   /** An output file and the merger writing into it */
+   struct Output {
+      TFileMerger fMerger{false, false};  //< TFileMerger used to merge buffers into this output
+      std::mutex fMergeMutex;             //< Mutex used to lock fMerger
+      std::atomic<size_t> fBytesMerged{0}; //< Number of bytes merged into this output so far
+   };
+
+   void Init(std::vector<std::unique_ptr<TFile>>);
 
-   void MergeImpl();
+   void MergeImpl(Output &output, TBufferMergerFile *memfile = nullptr);
 
+   Output *TryLockOutput();
    void Merge();
    void Push(TBufferFile *buffer);
    bool TryMerge(TBufferMergerFile *memfile);
 
    bool fCompressTemporaryKeys{false};                           //< Enable compression of the TKeys in the TMemFile (save memory at the expense of time, end result is unchanged)
    size_t fAutoSave{0};                                          //< AutoSave only every fAutoSave bytes
+   size_t fMaxBuffered{0};                                       //< Bound on fBuffered, 0 if unbounded
    std::atomic<size_t> fBuffered{0};                             //< Number of bytes currently buffered
-   TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
-   std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
+   std::vector<std::unique_ptr<Output>> fOutputs;                //< The output files, at least one
+   std::mutex fOutputMutex;                                      //< Mutex used with fOutputFreed
+   std::condition_variable fOutputFreed;                         //< Notified whenever a merge into an output ends
    mutable std::mutex fQueueMutex;                               //< Mutex used to lock fQueue
    std::queue<TBufferFile *> fQueue;                             //< Queue to which data is pushed and merged
+   mutable std::mutex fStatsMutex;                               //< Mutex used to lock fStats
+   MergeStats fStats;                                            //< Merge statistics
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
 };
 
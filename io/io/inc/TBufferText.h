@@ -129,6 +129,8 @@ public:
    static const char *GetDoubleFormat();
 
    static void CompactFloatString(char *buf, unsigned len);
+   static Int_t ConvertInteger(Long64_t v, char *buf);
+   static Int_t ConvertInteger(ULong64_t v, char *buf);
    static const char *ConvertFloat(Float_t v, char *buf, unsigned len, Bool_t not_optimize = kFALSE);
    static const char *ConvertDouble(Double_t v, char *buf, unsigned len, Bool_t not_optimize = kFALSE);
 
@@ -26,6 +26,8 @@
 #include "TDatime.h"
 #include "TList.h"
 
+#include <vector>
+
 class TKey;
 class TFile;
 
@@ -45,9 +47,24 @@ protected:
    TFile      *fFile{nullptr};           ///< Pointer to current file in memory
    TList      *fKeys{nullptr};           ///< Pointer to keys list in memory
 
+   /// Entry of the index of a keys record, see TDirectoryFile::WriteKeys()
+   struct KeyIndexEntry {
+      UInt_t fHash{0};                   ///< Hash of the key name
+      Int_t  fOffset{0};                 ///< Offset of the key header in the keys record
+      Int_t  fKeylen{0};                 ///< Length of the key header
+      TKey  *fKey{nullptr};              ///< The key, once read (owned by fKeys)
+   };
+   mutable Bool_t fKeysLoaded{kTRUE};    ///<! False while only the index of the keys record has been read
+   mutable std::vector<KeyIndexEntry> fKeyIndex; ///<! Index of the keys on file, sorted by hash, while !fKeysLoaded
+
    void        CleanTargets();
    void        InitDirectoryFile(TClass *cl = nullptr);
    void        BuildDirectoryFile(TFile* motherFile, TDirectory* motherDir);
+   TKey       *FindKeyInIndex(const char *name, Short_t cycle, Bool_t exactCycle) const;
+   void        LoadKeys() const;
+   Bool_t      ReadKeyIndex();
+   Int_t       ReadKeysRecord(std::vector<TKey *> *known);
+   void        ResetKeyIndex();
 
 private:
    TDirectoryFile(const TDirectoryFile &directory) = delete;  //Directories cannot be copied
@@ -90,10 +107,10 @@ public:
    const TDatime      &GetCreationDate() const { return fDatimeC; }
            TFile      *GetFile() const override { return fFile; }
            TKey       *GetKey(const char *name, Short_t cycle=9999) const override;
-           TList      *GetListOfKeys() const override { return fKeys; }
+           TList      *GetListOfKeys() const override { if (!fKeysLoaded) LoadKeys(); return fKeys; }
    const TDatime      &GetModificationDate() const { return fDatimeM; }
            Int_t       GetNbytesKeys() const override { return fNbytesKeys; }
-           Int_t       GetNkeys() const override { return fKeys->GetSize(); }
+           Int_t       GetNkeys() const override { return fKeysLoaded ? fKeys->GetSize() : (Int_t)fKeyIndex.size(); }
            Long64_t    GetSeekDir() const override { return fSeekDir; }
            Long64_t    GetSeekParent() const override { return fSeekParent; }
            Long64_t    GetSeekKeys() const override { return fSeekKeys; }
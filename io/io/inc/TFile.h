@@ -54,6 +54,7 @@ class TFilePrefetch;
 class TFile : public TDirectoryFile {
   friend class TDirectoryFile;
   friend class TFilePrefetch;
+  friend class TFileCacheWrite;
 // TODO: We need to make sure only one TBasket is being written at a time
 // if we are writing multiple baskets in parallel.
 #ifdef R__USE_IMT
@@ -106,6 +107,8 @@ protected:
    Bool_t           fInitDone{kFALSE};        ///<!True if the file has been initialized
    Bool_t           fMustFlush{kTRUE};        ///<!True if the file buffers must be flushed
    Bool_t           fIsPcmFile{kFALSE};       ///<!True if the file is a ROOT pcm file.
+   char            *fMemoryMap{nullptr};      ///<!Read-only mapping of the whole file (if any), see EnableMemoryMap()
+   Long64_t         fMemoryMapSize{0};        ///<!Length of fMemoryMap
    TFileOpenHandle *fAsyncHandle{nullptr};    ///<!For proper automatic cleanup
    EAsyncOpenStatus fAsyncOpenStatus{kAOSNotAsync}; ///<!Status of an asynchronous open request
    TUrl             fUrl;                     ///<!URL of file
@@ -117,8 +120,8 @@ protected:
 
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
-   static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
 #endif
+   static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
 
    static TList    *fgAsyncOpenRequests; //List of handles for pending open requests
 
@@ -139,6 +142,8 @@ protected:
    virtual void        Init(Bool_t create);
            Bool_t      FlushWriteCache();
            Int_t       ReadBufferViaCache(char *buf, Int_t len);
+           Bool_t      ReadBufferViaMemoryMap(char *buf, Long64_t pos, Int_t len);
+           void        ReleaseMemoryMap();
            Int_t       WriteBufferViaCache(const char *buf, Int_t len);
 
    ////////////////////////////////////////////////////////////////////////////////
@@ -150,6 +155,7 @@ protected:
    };
 
    virtual InfoListRet GetStreamerInfoListImpl(bool lookupSICache);
+           void        SetClassIndexFromStreamerInfoCache(const ROOT::Internal::RConcurrentHashColl::HashValue &hash);
 
    // Creating projects
            Int_t       MakeProjectParMake(const char *packname, const char *filename);
@@ -209,11 +215,13 @@ public:
            void        Delete(const char *namecycle="") override;
            void        Draw(Option_t *option="") override;
    virtual void        DrawMap(const char *keys="*",Option_t *option=""); // *MENU*
+           Bool_t      EnableMemoryMap();
            void        FillBuffer(char *&buffer) override;
    virtual void        Flush();
          TArchiveFile *GetArchive() const { return fArchive; }
            Long64_t    GetArchiveOffset() const { return fArchiveOffset; }
            Int_t       GetBestBuffer() const;
+           const char *GetMemoryMappedBuffer(Long64_t pos, Int_t len);
    virtual Int_t       GetBytesToPrefetch() const;
        TFileCacheRead *GetCacheRead(const TObject* tree = nullptr) const;
       TFileCacheWrite *GetCacheWrite() const;
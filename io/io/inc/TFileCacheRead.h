@@ -16,6 +16,8 @@
 
 #include "TFile.h"
 
+#include "ROOT/RMemoryAccounting.hxx"
+
 class TBranch;
 class TFilePrefetch;
 
@@ -70,6 +72,11 @@ protected:
    Bool_t         fBIsSorted;
    Bool_t         fBIsTransferred;
 
+   /// Size of fBuffer, reported to ROOT::Experimental::MemoryAccounting
+   ROOT::Experimental::MemoryAccounting::RAccountedSize fAccountedBuffer{ROOT::Experimental::EMemoryTag::kFileCache}; //!
+
+   void AccountBuffer() { fAccountedBuffer.Set(fBuffer ? fBufferSize : 0); }
+
    void SetEnablePrefetchingImpl(Bool_t setPrefetching = kFALSE); // Can not be virtual as it is called from the constructor.
 
 private:
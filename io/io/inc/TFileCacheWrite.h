@@ -14,8 +14,16 @@
 
 #include "TObject.h"
 
+#include <memory>
+
 class TFile;
 
+namespace ROOT {
+namespace Internal {
+class RFileWriteBehind;
+}
+} // namespace ROOT
+
 class TFileCacheWrite : public TObject {
 
 protected:
@@ -25,17 +33,22 @@ protected:
    TFile        *fFile;           ///< Pointer to file
    char         *fBuffer;         ///< [fBufferSize] buffer of contiguous prefetched blocks
    Bool_t        fRecursive;      ///< flag to avoid recursive calls
+   std::unique_ptr<ROOT::Internal::RFileWriteBehind> fWriteBehind; ///<! Background writer in write-behind mode
 
 private:
    TFileCacheWrite(const TFileCacheWrite &) = delete;            //cannot be copied
    TFileCacheWrite& operator=(const TFileCacheWrite &) = delete;
 
+   Bool_t FlushBuffer();
+   void   InitWriteBehind(Int_t nInFlight);
+
 public:
    TFileCacheWrite();
-   TFileCacheWrite(TFile *file, Int_t buffersize);
+   TFileCacheWrite(TFile *file, Int_t buffersize, Int_t nInFlight = 0);
    virtual ~TFileCacheWrite();
    virtual Bool_t      Flush();
    virtual Int_t       GetBytesInCache() const { return fNtot; }
+           Bool_t      IsWriteBehind() const { return fWriteBehind != nullptr; }
            void        Print(Option_t *option="") const override;
    virtual Int_t       ReadBuffer(char *buf, Long64_t pos, Int_t len);
    virtual Int_t       WriteBuffer(const char *buf, Long64_t pos, Int_t len);
@@ -83,6 +83,8 @@ protected:
    bool NeedsExistingFile(EMode mode) const { return mode == EMode::kUpdate || mode == EMode::kRead; }
 
    EMode ParseOption(Option_t *option);
+   void  OpenImpl(const char *path, Option_t *option, const char *buffer, Long64_t size);
+   void  ResetBookkeeping();
 
    TMemFile &operator=(const TMemFile&) = delete; // Not implemented.
 
@@ -94,6 +96,9 @@ public:
    TMemFile(const char *name, ExternalDataPtr_t data);
    TMemFile(const char *name, const ZeroCopyView_t &datarange);
    TMemFile(const char *name, std::unique_ptr<TBufferFile> buffer);
+   TMemFile(const char *name, std::unique_ptr<char[]> buffer, Long64_t size, Option_t *option = "",
+            const char *ftitle = "", Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault,
+            Long64_t defBlockSize = 0LL);
    TMemFile(const TMemFile &orig);
    virtual ~TMemFile();
 
@@ -102,6 +107,7 @@ public:
            Long64_t GetSize() const override;
 
            void ResetAfterMerge(TFileMergeInfo *) override;
+           void ResetForReuse(const char *buffer = nullptr, Long64_t size = 0);
            void ResetErrno() const override;
 
            void        Print(Option_t *option="") const override;
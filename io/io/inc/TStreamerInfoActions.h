@@ -205,10 +205,14 @@ namespace TStreamerInfoActions {
       TVirtualStreamerInfo *fStreamerInfo; ///< StreamerInfo used to derive these actions.
       TLoopConfiguration   *fLoopConfig;   ///< If this is a bundle of memberwise streaming action, this configures the looping
       ActionContainer_t     fActions;
+      ActionContainer_t     fFusedActions; ///< Same as fActions with runs of basic type members merged, see FuseBasicTypeActions (can be empty)
 
       void AddToOffset(Int_t delta);
       void SetMissing();
 
+      void FuseBasicTypeActions();
+      static Bool_t IsFuseBasicTypesEnabled();
+
       TActionSequence *CreateCopy();
       static TActionSequence *CreateReadMemberWiseActions(TVirtualStreamerInfo *info, TVirtualCollectionProxy &proxy);
       static TActionSequence *CreateWriteMemberWiseActions(TVirtualStreamerInfo *info, TVirtualCollectionProxy &proxy);
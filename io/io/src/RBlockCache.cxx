@@ -0,0 +1,210 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RBlockCache.hxx"
+
+#include "TEnv.h"
+#include "TError.h"
+#include "TMD5.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace {
+/// Suffix of the blocks being written, see StoreBlock()
+const char *const kTmpSuffix = ".tmp.";
+} // anonymous namespace
+
+ROOT::Internal::RBlockCache::RBlockCache(const std::string &directory, std::uint64_t maxSize, std::size_t blockSize)
+   : fDirectory(directory), fMaxSize(maxSize), fBlockSize(blockSize > 0 ? blockSize : kDefaultBlockSize)
+{
+   gSystem->mkdir(fDirectory.c_str(), kTRUE);
+}
+
+ROOT::Internal::RBlockCache *ROOT::Internal::RBlockCache::Get()
+{
+   // Leaked on purpose: files may still be read during static destruction
+   static RBlockCache *cache = []() -> RBlockCache * {
+      TString dir = gEnv->GetValue("TFile.BlockCacheDir", "");
+      if (dir.IsNull())
+         return nullptr;
+      gSystem->ExpandPathName(dir);
+      const std::uint64_t maxSize = gEnv->GetValue("TFile.BlockCacheSize", 10000) * std::uint64_t(1024 * 1024);
+      return new RBlockCache(dir.Data(), maxSize);
+   }();
+   return cache;
+}
+
+std::string ROOT::Internal::RBlockCache::MakeFileKey(const std::string &url, std::uint64_t fileSize,
+                                                     std::int64_t modTime)
+{
+   const std::string id = url + '\n' + std::to_string(fileSize) + '\n' + std::to_string(modTime);
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(id.data()), id.size());
+   md5.Final();
+   return md5.AsString();
+}
+
+std::string ROOT::Internal::RBlockCache::GetBlockPath(const std::string &fileKey, std::uint64_t blockIdx) const
+{
+   // Spread the blocks over 256 subdirectories
+   return fDirectory + '/' + fileKey.substr(0, 2) + '/' + fileKey + '.' + std::to_string(blockIdx);
+}
+
+/// Read a complete block; refreshes its modification time, which orders the blocks for eviction.
+bool ROOT::Internal::RBlockCache::LoadBlock(const std::string &path, char *buffer, std::size_t size)
+{
+   FILE *f = std::fopen(path.c_str(), "rb");
+   if (!f)
+      return false;
+   const bool complete = (std::fread(buffer, 1, size, f) == size) && (std::fgetc(f) == EOF);
+   std::fclose(f);
+   if (complete)
+      gSystem->Utime(path.c_str(), std::time(nullptr), 0);
+   return complete;
+}
+
+/// Write the block under a temporary name and move it into place, so that other processes only ever find
+/// complete blocks.
+void ROOT::Internal::RBlockCache::StoreBlock(const std::string &path, const char *buffer, std::size_t size)
+{
+   static std::atomic<unsigned> gNTmp{0};
+   gSystem->mkdir(path.substr(0, path.rfind('/')).c_str(), kTRUE);
+   const std::string tmpPath =
+      path + kTmpSuffix + std::to_string(gSystem->GetPid()) + '.' + std::to_string(gNTmp++);
+   FILE *f = std::fopen(tmpPath.c_str(), "wb");
+   if (!f)
+      return;
+   const bool written = (std::fwrite(buffer, 1, size, f) == size);
+   if (std::fclose(f) != 0 || !written || gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0) {
+      gSystem->Unlink(tmpPath.c_str());
+      return;
+   }
+
+   std::lock_guard<std::mutex> guard(fLock);
+   fUsedSize += size;
+   if (!fUsedSizeKnown || fUsedSize > fMaxSize)
+      Evict();
+}
+
+/// Measure the cache, including the blocks written by other processes, and remove the least recently used blocks
+/// until it is back under 90% of its maximum size. Must be called with fLock locked.
+void ROOT::Internal::RBlockCache::Evict()
+{
+   std::vector<std::tuple<Long_t, Long64_t, std::string>> blocks; // modification time, size, path
+   std::uint64_t usedSize = 0;
+
+   void *dir = gSystem->OpenDirectory(fDirectory.c_str());
+   if (!dir)
+      return;
+   while (const char *subdirName = gSystem->GetDirEntry(dir)) {
+      if (subdirName[0] == '.')
+         continue;
+      const std::string subdirPath = fDirectory + '/' + subdirName;
+      void *subdir = gSystem->OpenDirectory(subdirPath.c_str());
+      if (!subdir)
+         continue;
+      while (const char *name = gSystem->GetDirEntry(subdir)) {
+         if (name[0] == '.' || std::strstr(name, kTmpSuffix))
+            continue;
+         std::string path = subdirPath + '/' + name;
+         FileStat_t stat;
+         if (gSystem->GetPathInfo(path.c_str(), stat) != 0)
+            continue;
+         usedSize += stat.fSize;
+         blocks.emplace_back(stat.fMtime, stat.fSize, std::move(path));
+      }
+      gSystem->FreeDirectory(subdir);
+   }
+   gSystem->FreeDirectory(dir);
+
+   if (usedSize > fMaxSize) {
+      std::sort(blocks.begin(), blocks.end());
+      const std::uint64_t targetSize = fMaxSize / 10 * 9;
+      for (const auto &block : blocks) {
+         if (usedSize <= targetSize)
+            break;
+         // Another process may remove the same block at the same time, which is fine
+         gSystem->Unlink(std::get<2>(block).c_str());
+         usedSize -= std::get<1>(block);
+      }
+   }
+
+   fUsedSize = usedSize;
+   fUsedSizeKnown = true;
+}
+
+void ROOT::Internal::RBlockCache::ReadV(const std::string &fileKey, std::uint64_t fileSize, RIOVec *ioVec,
+                                        unsigned int nReq, const FetchFunc_t &fetch)
+{
+   // The content of all the blocks touched by the requests, by block index
+   std::map<std::uint64_t, std::vector<char>> blocks;
+   for (unsigned int i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = 0;
+      if (ioVec[i].fSize == 0 || ioVec[i].fOffset >= fileSize)
+         continue;
+      const std::uint64_t end = std::min<std::uint64_t>(ioVec[i].fOffset + ioVec[i].fSize, fileSize);
+      for (std::uint64_t b = ioVec[i].fOffset / fBlockSize; b <= (end - 1) / fBlockSize; ++b)
+         blocks[b];
+   }
+
+   std::vector<RIOVec> missing;
+   std::vector<std::string> missingPaths;
+   for (auto &block : blocks) {
+      const std::uint64_t offset = block.first * fBlockSize;
+      block.second.resize(std::min<std::uint64_t>(fBlockSize, fileSize - offset));
+      std::string path = GetBlockPath(fileKey, block.first);
+      if (LoadBlock(path, block.second.data(), block.second.size()))
+         continue;
+      RIOVec req;
+      req.fBuffer = block.second.data();
+      req.fOffset = offset;
+      req.fSize = block.second.size();
+      missing.emplace_back(req);
+      missingPaths.emplace_back(std::move(path));
+   }
+
+   if (!missing.empty()) {
+      fetch(missing.data(), missing.size());
+      for (std::size_t i = 0; i < missing.size(); ++i) {
+         if (missing[i].fOutBytes == missing[i].fSize) {
+            StoreBlock(missingPaths[i], static_cast<const char *>(missing[i].fBuffer), missing[i].fSize);
+         } else {
+            // Short read, e.g. the remote file was truncated: serve what we got, but do not cache it
+            blocks[missing[i].fOffset / fBlockSize].resize(missing[i].fOutBytes);
+         }
+      }
+   }
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      if (ioVec[i].fSize == 0 || ioVec[i].fOffset >= fileSize)
+         continue;
+      const std::uint64_t end = std::min<std::uint64_t>(ioVec[i].fOffset + ioVec[i].fSize, fileSize);
+      std::uint64_t pos = ioVec[i].fOffset;
+      while (pos < end) {
+         const auto &content = blocks[pos / fBlockSize];
+         const std::size_t inBlock = pos % fBlockSize;
+         if (inBlock >= content.size())
+            break;
+         const std::size_t n = std::min<std::uint64_t>(end - pos, content.size() - inBlock);
+         memcpy(static_cast<char *>(ioVec[i].fBuffer) + (pos - ioVec[i].fOffset), content.data() + inBlock, n);
+         pos += n;
+      }
+      ioVec[i].fOutBytes = pos - ioVec[i].fOffset;
+   }
+}
@@ -0,0 +1,153 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RBufferPool.hxx"
+
+#include "TBufferFile.h"
+#include "TEnv.h"
+#include "TStorage.h"
+
+namespace {
+
+/// Index of the size class of the smallest power of two not below size, -1 if too large for the pool
+int GetCeilClass(Int_t size)
+{
+   if (size > ROOT::Internal::RBufferPool::kMaxSize)
+      return -1;
+   int idx = 0;
+   while ((ROOT::Internal::RBufferPool::kMinSize << idx) < size)
+      ++idx;
+   return idx;
+}
+
+/// Index of the size class of the largest power of two not above capacity, -1 if outside of the pool range
+int GetFloorClass(Int_t capacity)
+{
+   // Much larger buffers than the largest class would waste memory when reused
+   if (capacity < ROOT::Internal::RBufferPool::kMinSize || capacity / 2 >= ROOT::Internal::RBufferPool::kMaxSize)
+      return -1;
+   int idx = 0;
+   while ((ROOT::Internal::RBufferPool::kMinSize << (idx + 1)) <= capacity)
+      ++idx;
+   return idx;
+}
+
+} // anonymous namespace
+
+ROOT::Internal::RBufferPool::RBufferPool(std::uint64_t maxSize) : fMaxSize(maxSize) {}
+
+ROOT::Internal::RBufferPool::~RBufferPool()
+{
+   DeleteBuffers();
+}
+
+ROOT::Internal::RBufferPool *ROOT::Internal::RBufferPool::Get()
+{
+   // Leaked on purpose: baskets may still be deleted during static destruction
+   static RBufferPool *pool = []() -> RBufferPool * {
+      const std::uint64_t maxSize = gEnv->GetValue("TFile.BufferPoolSize", 64) * std::uint64_t(1024 * 1024);
+      if (maxSize == 0)
+         return nullptr;
+      return new RBufferPool(maxSize);
+   }();
+   return pool;
+}
+
+TBufferFile *ROOT::Internal::RBufferPool::Acquire(TBuffer::EMode mode, Int_t size)
+{
+   const int idx = GetCeilClass(size);
+   TBufferFile *buffer = nullptr;
+   if (idx >= 0) {
+      std::lock_guard<std::mutex> guard(fLock);
+      if (!fFree[idx].empty()) {
+         buffer = fFree[idx].back();
+         fFree[idx].pop_back();
+         fStats.fHeldBytes -= buffer->BufferSize();
+         fAccounted.Set(fStats.fHeldBytes);
+         ++fStats.fNHits;
+      } else {
+         ++fStats.fNMisses;
+      }
+   }
+   if (!buffer)
+      return new TBufferFile(mode, idx >= 0 ? (kMinSize << idx) : size);
+
+   if (mode == TBuffer::kRead)
+      buffer->SetReadMode();
+   else
+      buffer->SetWriteMode();
+   buffer->Reset();
+   buffer->ResetMap();
+   buffer->SetParent(nullptr);
+   buffer->SetPidOffset(0);
+   buffer->SetBufferDisplacement();
+   buffer->ResetBit(TBufferIO::kNotDecompressed);
+   return buffer;
+}
+
+void ROOT::Internal::RBufferPool::Release(TBuffer *buffer)
+{
+   if (!buffer)
+      return;
+   const int idx = (buffer->IsA() == TBufferFile::Class() && buffer->TestBit(TBuffer::kIsOwner) &&
+                    buffer->GetReAllocFunc() == TStorage::ReAllocChar)
+                      ? GetFloorClass(buffer->BufferSize())
+                      : -1;
+   if (idx >= 0) {
+      std::lock_guard<std::mutex> guard(fLock);
+      if (fStats.fHeldBytes + buffer->BufferSize() <= fMaxSize) {
+         fFree[idx].emplace_back(static_cast<TBufferFile *>(buffer));
+         fStats.fHeldBytes += buffer->BufferSize();
+         fAccounted.Set(fStats.fHeldBytes);
+         ++fStats.fNReleased;
+         return;
+      }
+      ++fStats.fNDropped;
+   }
+   delete buffer;
+}
+
+void ROOT::Internal::RBufferPool::DeleteBuffers()
+{
+   for (auto &buffers : fFree) {
+      for (auto buffer : buffers)
+         delete buffer;
+      buffers.clear();
+   }
+   fStats.fHeldBytes = 0;
+   fAccounted.Set(0);
+}
+
+void ROOT::Internal::RBufferPool::Clear()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   DeleteBuffers();
+}
+
+ROOT::Internal::RBufferPool::RStats ROOT::Internal::RBufferPool::GetStats() const
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fStats;
+}
+
+TBufferFile *ROOT::Internal::RBufferPool::AcquireBuffer(TBuffer::EMode mode, Int_t size)
+{
+   if (auto pool = Get())
+      return pool->Acquire(mode, size);
+   return new TBufferFile(mode, size);
+}
+
+void ROOT::Internal::RBufferPool::ReleaseBuffer(TBuffer *buffer)
+{
+   if (auto pool = Get())
+      pool->Release(buffer);
+   else
+      delete buffer;
+}
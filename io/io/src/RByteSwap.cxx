@@ -0,0 +1,219 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/**
+\file RByteSwap.cxx
+\ingroup IO
+
+Byte swapping of arrays of basic types, used by TBufferFile to convert between the big endian
+on-file representation and the in-memory representation on little endian machines.
+
+On x86-64 the SSSE3 and AVX2 kernels are compiled with function level target attributes and
+selected at run time with `__builtin_cpu_supports`, so that the library keeps running on CPUs
+without these extensions. On aarch64 NEON is part of the base ISA and used unconditionally.
+All kernels fall back to the scalar loop for the tail of the array.
+*/
+
+#include "RByteSwap.h"
+
+#include "Byteswap.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define R__BYTESWAP_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON) && !defined(__ARM_BIG_ENDIAN)
+#define R__BYTESWAP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+using CopyFunc_t = void (*)(void *, const void *, std::size_t);
+
+struct RKernels {
+   CopyFunc_t fCopy16;
+   CopyFunc_t fCopy32;
+   CopyFunc_t fCopy64;
+   const char *fName;
+};
+
+// The memcpy calls let the compiler emit plain (possibly unaligned) loads and stores; the buffer
+// positions handed in by TBufferFile have no alignment guarantee.
+
+void Copy16Scalar(void *to, const void *from, std::size_t n)
+{
+   auto dst = static_cast<unsigned char *>(to);
+   auto src = static_cast<const unsigned char *>(from);
+   for (std::size_t i = 0; i < n; ++i, dst += 2, src += 2) {
+      std::uint16_t x;
+      memcpy(&x, src, 2);
+      x = Rbswap_16(x);
+      memcpy(dst, &x, 2);
+   }
+}
+
+void Copy32Scalar(void *to, const void *from, std::size_t n)
+{
+   auto dst = static_cast<unsigned char *>(to);
+   auto src = static_cast<const unsigned char *>(from);
+   for (std::size_t i = 0; i < n; ++i, dst += 4, src += 4) {
+      std::uint32_t x;
+      memcpy(&x, src, 4);
+      x = Rbswap_32(x);
+      memcpy(dst, &x, 4);
+   }
+}
+
+void Copy64Scalar(void *to, const void *from, std::size_t n)
+{
+   auto dst = static_cast<unsigned char *>(to);
+   auto src = static_cast<const unsigned char *>(from);
+   for (std::size_t i = 0; i < n; ++i, dst += 8, src += 8) {
+      std::uint64_t x;
+      memcpy(&x, src, 8);
+      x = Rbswap_64(x);
+      memcpy(dst, &x, 8);
+   }
+}
+
+void CopyScalar(unsigned char *dst, const unsigned char *src, std::size_t nbytes, int width)
+{
+   switch (width) {
+   case 2: Copy16Scalar(dst, src, nbytes / 2); break;
+   case 4: Copy32Scalar(dst, src, nbytes / 4); break;
+   default: Copy64Scalar(dst, src, nbytes / 8); break;
+   }
+}
+
+#ifdef R__BYTESWAP_X86
+
+// Byte permutations reversing each 2, 4 and 8 byte group of a 16 byte lane.
+alignas(16) const unsigned char gShuffle16[16] = {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+alignas(16) const unsigned char gShuffle32[16] = {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+alignas(16) const unsigned char gShuffle64[16] = {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8};
+
+const unsigned char *GetShuffle(int width)
+{
+   return width == 2 ? gShuffle16 : (width == 4 ? gShuffle32 : gShuffle64);
+}
+
+__attribute__((target("ssse3")))
+void CopySSSE3(void *to, const void *from, std::size_t n, int width)
+{
+   auto dst = static_cast<unsigned char *>(to);
+   auto src = static_cast<const unsigned char *>(from);
+   const std::size_t nbytes = n * width;
+   const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i *>(GetShuffle(width)));
+   std::size_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_shuffle_epi8(v, mask));
+   }
+   CopyScalar(dst + i, src + i, nbytes - i, width);
+}
+
+__attribute__((target("avx2")))
+void CopyAVX2(void *to, const void *from, std::size_t n, int width)
+{
+   auto dst = static_cast<unsigned char *>(to);
+   auto src = static_cast<const unsigned char *>(from);
+   const std::size_t nbytes = n * width;
+   // vpshufb permutes within each 128 bit lane, so the same lane mask serves both halves.
+   const __m128i lane = _mm_load_si128(reinterpret_cast<const __m128i *>(GetShuffle(width)));
+   const __m256i mask = _mm256_broadcastsi128_si256(lane);
+   std::size_t i = 0;
+   for (; i + 64 <= nbytes; i += 64) {
+      __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+      __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 32));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(v0, mask));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 32), _mm256_shuffle_epi8(v1, mask));
+   }
+   for (; i + 16 <= nbytes; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_shuffle_epi8(v, lane));
+   }
+   CopyScalar(dst + i, src + i, nbytes - i, width);
+}
+
+void Copy16SSSE3(void *to, const void *from, std::size_t n) { CopySSSE3(to, from, n, 2); }
+void Copy32SSSE3(void *to, const void *from, std::size_t n) { CopySSSE3(to, from, n, 4); }
+void Copy64SSSE3(void *to, const void *from, std::size_t n) { CopySSSE3(to, from, n, 8); }
+void Copy16AVX2(void *to, const void *from, std::size_t n) { CopyAVX2(to, from, n, 2); }
+void Copy32AVX2(void *to, const void *from, std::size_t n) { CopyAVX2(to, from, n, 4); }
+void Copy64AVX2(void *to, const void *from, std::size_t n) { CopyAVX2(to, from, n, 8); }
+
+#endif // R__BYTESWAP_X86
+
+#ifdef R__BYTESWAP_NEON
+
+void CopyNEON(void *to, const void *from, std::size_t n, int width)
+{
+   auto dst = static_cast<unsigned char *>(to);
+   auto src = static_cast<const unsigned char *>(from);
+   const std::size_t nbytes = n * width;
+   std::size_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      uint8x16_t v = vld1q_u8(src + i);
+      v = (width == 2) ? vrev16q_u8(v) : ((width == 4) ? vrev32q_u8(v) : vrev64q_u8(v));
+      vst1q_u8(dst + i, v);
+   }
+   CopyScalar(dst + i, src + i, nbytes - i, width);
+}
+
+void Copy16NEON(void *to, const void *from, std::size_t n) { CopyNEON(to, from, n, 2); }
+void Copy32NEON(void *to, const void *from, std::size_t n) { CopyNEON(to, from, n, 4); }
+void Copy64NEON(void *to, const void *from, std::size_t n) { CopyNEON(to, from, n, 8); }
+
+#endif // R__BYTESWAP_NEON
+
+RKernels SelectKernels()
+{
+#if defined(R__BYTESWAP_X86)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return {Copy16AVX2, Copy32AVX2, Copy64AVX2, "avx2"};
+   if (__builtin_cpu_supports("ssse3"))
+      return {Copy16SSSE3, Copy32SSSE3, Copy64SSSE3, "ssse3"};
+#elif defined(R__BYTESWAP_NEON)
+   return {Copy16NEON, Copy32NEON, Copy64NEON, "neon"};
+#endif
+   return {Copy16Scalar, Copy32Scalar, Copy64Scalar, "scalar"};
+}
+
+const RKernels &GetKernels()
+{
+   static const RKernels kernels = SelectKernels();
+   return kernels;
+}
+
+} // anonymous namespace
+
+void ROOT::Internal::ByteSwap::Copy16(void *to, const void *from, std::size_t n)
+{
+   GetKernels().fCopy16(to, from, n);
+}
+
+void ROOT::Internal::ByteSwap::Copy32(void *to, const void *from, std::size_t n)
+{
+   GetKernels().fCopy32(to, from, n);
+}
+
+void ROOT::Internal::ByteSwap::Copy64(void *to, const void *from, std::size_t n)
+{
+   GetKernels().fCopy64(to, from, n);
+}
+
+const char *ROOT::Internal::ByteSwap::GetImplementation()
+{
+   return GetKernels().fName;
+}
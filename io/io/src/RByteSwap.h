@@ -0,0 +1,34 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RByteSwap
+#define ROOT_RByteSwap
+
+#include <cstddef>
+
+namespace ROOT {
+namespace Internal {
+namespace ByteSwap {
+
+/// Copy `n` elements of 2, 4 or 8 bytes from `from` to `to`, reversing the byte order of each element.
+/// Neither pointer needs to be aligned; the ranges must either be identical or not overlap.
+/// The implementation (scalar, SSSE3, AVX2 or NEON) is selected once at run time according to the CPU.
+void Copy16(void *to, const void *from, std::size_t n);
+void Copy32(void *to, const void *from, std::size_t n);
+void Copy64(void *to, const void *from, std::size_t n);
+
+/// Name of the selected implementation, for diagnostics and tests.
+const char *GetImplementation();
+
+} // namespace ByteSwap
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -102,6 +102,11 @@ void *ROOT::Internal::RRawFile::MapImpl(size_t /* nbytes */, std::uint64_t /* of
    throw std::runtime_error("Memory mapping unsupported");
 }
 
+const unsigned char *ROOT::Internal::RRawFile::GetMappedDataImpl(size_t /* nbytes */, std::uint64_t /* offset */)
+{
+   return nullptr;
+}
+
 void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
    for (unsigned i = 0; i < nReq; ++i) {
@@ -109,6 +114,11 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+std::future<void> ROOT::Internal::RRawFile::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   return std::async(std::launch::deferred, [this, ioVec, nReq] { ReadVImpl(ioVec, nReq); });
+}
+
 void ROOT::Internal::RRawFile::UnmapImpl(void * /* region */, size_t /* nbytes */)
 {
    throw std::runtime_error("Memory mapping unsupported");
@@ -155,6 +165,14 @@ void *ROOT::Internal::RRawFile::Map(size_t nbytes, std::uint64_t offset, std::ui
    return MapImpl(nbytes, offset, mapdOffset);
 }
 
+const unsigned char *ROOT::Internal::RRawFile::GetMappedData(size_t nbytes, std::uint64_t offset)
+{
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   return GetMappedDataImpl(nbytes, offset);
+}
+
 size_t ROOT::Internal::RRawFile::Read(void *buffer, size_t nbytes)
 {
    size_t res = ReadAt(buffer, nbytes, fFilePos);
@@ -216,6 +234,14 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+std::future<void> ROOT::Internal::RRawFile::ReadVAsync(RIOVec *ioVec, unsigned int nReq)
+{
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   return ReadVAsyncImpl(ioVec, nReq);
+}
+
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
 {
    if (fOptions.fLineBreak == ELineBreaks::kAuto) {
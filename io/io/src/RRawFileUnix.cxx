@@ -18,9 +18,13 @@
 
 #include "TError.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <memory>
+#ifdef R__HAS_URING
+#include <mutex>
+#endif
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -42,6 +46,8 @@ ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions option
 
 ROOT::Internal::RRawFileUnix::~RRawFileUnix()
 {
+   if (fMmapRegion)
+      munmap(fMmapRegion, fMmapSize);
    if (fFileDes >= 0)
       close(fFileDes);
 }
@@ -52,7 +58,11 @@ std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone()
 }
 
 int ROOT::Internal::RRawFileUnix::GetFeatures() const {
+#ifdef R__HAS_URING
+   return kFeatureHasSize | kFeatureHasMmap | kFeatureHasAsyncIo;
+#else
    return kFeatureHasSize | kFeatureHasMmap;
+#endif
 }
 
 std::uint64_t ROOT::Internal::RRawFileUnix::GetSizeImpl()
@@ -81,6 +91,13 @@ void *ROOT::Internal::RRawFileUnix::MapImpl(size_t nbytes, std::uint64_t offset,
    return result;
 }
 
+const unsigned char *ROOT::Internal::RRawFileUnix::GetMappedDataImpl(size_t nbytes, std::uint64_t offset)
+{
+   if (!fMmapRegion || (offset > fMmapSize) || (nbytes > fMmapSize - offset))
+      return nullptr;
+   return fMmapRegion + offset;
+}
+
 void ROOT::Internal::RRawFileUnix::OpenImpl()
 {
 #ifdef R__SEEK64
@@ -92,7 +109,7 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
       throw std::runtime_error("Cannot open '" + fUrl + "', error: " + std::string(strerror(errno)));
    }
 
-   if (fOptions.fBlockSize >= 0)
+   if (fOptions.fBlockSize >= 0 && !fOptions.fUseMmap)
       return;
 
 #ifdef R__SEEK64
@@ -105,6 +122,22 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
    if (res != 0) {
       throw std::runtime_error("Cannot call fstat on '" + fUrl + "', error: " + std::string(strerror(errno)));
    }
+
+   if (fOptions.fUseMmap && S_ISREG(info.st_mode) && info.st_size > 0) {
+      void *region = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fFileDes, 0);
+      if (region != MAP_FAILED) {
+         fMmapRegion = static_cast<unsigned char *>(region);
+         fMmapSize = info.st_size;
+         // The mapping already is the buffer; the block buffers would only add another copy
+         if (fOptions.fBlockSize < 0)
+            fOptions.fBlockSize = 0;
+      } else {
+         Warning("RRawFileUnix", "cannot map '%s' (%s), falling back to pread", fUrl.c_str(), strerror(errno));
+      }
+   }
+
+   if (fOptions.fBlockSize >= 0)
+      return;
    if (info.st_blksize > 0) {
       fOptions.fBlockSize = info.st_blksize;
    } else {
@@ -114,11 +147,27 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
 
 void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
+   if (fMmapRegion) {
+      for (unsigned int i = 0; i < nReq; ++i)
+         ioVec[i].fOutBytes = ReadAtImpl(ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset);
+      return;
+   }
+
 #ifdef R__HAS_URING
    thread_local bool uring_failed = false;
    if (!uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
+         std::unique_lock<std::mutex> lock(fIoUringMutex, std::try_to_lock);
+         std::unique_ptr<RIoUring> tmpRing;
+         RIoUring *ring;
+         if (lock.owns_lock()) {
+            if (!fIoUring)
+               fIoUring = std::make_unique<RIoUring>(); // throws std::runtime_error
+            ring = fIoUring.get();
+         } else {
+            tmpRing = std::make_unique<RIoUring>(); // throws std::runtime_error
+            ring = tmpRing.get();
+         }
          std::vector<RIoUring::RReadEvent> reads;
          reads.reserve(nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
@@ -129,7 +178,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
             ev.fFileDes = fFileDes;
             reads.push_back(ev);
          }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
+         ring->SubmitReadsAndWait(reads.data(), nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
             ioVec[i].fOutBytes = reads.at(i).fOutBytes;
          }
@@ -146,8 +195,47 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    RRawFile::ReadVImpl(ioVec, nReq);
 }
 
+std::future<void> ROOT::Internal::RRawFileUnix::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+#ifdef R__HAS_URING
+   if (!fMmapRegion && nReq > 0) {
+      try {
+         // Every asynchronous request owns its ring, so that it can be reaped by any thread
+         auto ring = std::make_unique<RIoUring>(std::min(nReq, 1024u)); // throws std::runtime_error
+         std::vector<RIoUring::RReadEvent> reads(nReq);
+         for (std::size_t i = 0; i < nReq; ++i) {
+            reads[i].fBuffer = ioVec[i].fBuffer;
+            reads[i].fOffset = ioVec[i].fOffset;
+            reads[i].fSize = ioVec[i].fSize;
+            reads[i].fFileDes = fFileDes;
+         }
+         const unsigned int nSubmitted = ring->SubmitReads(reads.data(), nReq);
+         return std::async(std::launch::deferred,
+                           [ioVec, nReq, nSubmitted, ring = std::move(ring), reads = std::move(reads)]() mutable {
+                              ring->WaitReads(reads.data(), nSubmitted);
+                              if (nSubmitted < nReq)
+                                 ring->SubmitReadsAndWait(reads.data() + nSubmitted, nReq - nSubmitted);
+                              for (std::size_t i = 0; i < nReq; ++i)
+                                 ioVec[i].fOutBytes = reads[i].fOutBytes;
+                           });
+      } catch (const std::runtime_error &e) {
+         Warning("RRawFileUnix", "io_uring setup failed, deferring blocking I/O in ReadVAsync:\n%s", e.what());
+      }
+   }
+#endif
+   return RRawFile::ReadVAsyncImpl(ioVec, nReq);
+}
+
 size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
+   if (fMmapRegion) {
+      if (offset >= fMmapSize)
+         return 0;
+      nbytes = std::min<std::uint64_t>(nbytes, fMmapSize - offset);
+      memcpy(buffer, fMmapRegion + offset, nbytes);
+      return nbytes;
+   }
+
    size_t total_bytes = 0;
    while (nbytes) {
 #ifdef R__SEEK64
@@ -20,6 +20,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include <string.h>
 #include <typeinfo>
 #include <string>
+#include <algorithm>
 
 #include "TFile.h"
 #include "TBufferFile.h"
@@ -35,14 +36,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include "TInterpreter.h"
 #include "TVirtualMutex.h"
 
-#if (defined(__linux) || defined(__APPLE__)) && defined(__i386__) && \
-     defined(__GNUC__)
-#define USE_BSWAPCPY
-#endif
-
-#ifdef USE_BSWAPCPY
-#include "Bswapcpy.h"
-#endif
+#include "RByteSwap.h"
 
 
 const UInt_t kNewClassTag       = 0xFFFFFFFF;
@@ -56,6 +50,150 @@ const Int_t  kMapOffset         = 2;   // first 2 map entries are taken by null
 
 ClassImp(TBufferFile);
 
+namespace {
+
+/// Number of elements converted per block by the Float16_t/Double32_t array routines.
+/// The intermediate on-file words are kept on the stack so that the byte swapping
+/// runs over contiguous blocks instead of one element at a time.
+constexpr Int_t kPackBlockSize = 256;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read n integers from buf and convert them back with factor and minvalue,
+/// see TBufferFile::WriteFloat16.
+
+template <typename T>
+void ReadArrayWithFactor(char *&buf, T *ptr, Int_t n, Double_t factor, Double_t minvalue)
+{
+   UInt_t aint[kPackBlockSize];
+   for (Int_t j = 0; j < n; j += kPackBlockSize) {
+      const Int_t m = std::min(n - j, kPackBlockSize);
+#ifdef R__BYTESWAP
+      ROOT::Internal::ByteSwap::Copy32(aint, buf, m);
+#else
+      memcpy(aint, buf, m * sizeof(UInt_t));
+#endif
+      buf += m * sizeof(UInt_t);
+      for (Int_t k = 0; k < m; k++)
+         ptr[j + k] = (T)(aint[k] / factor + minvalue);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read n floats from buf and widen them, see TBufferFile::WriteDouble32.
+
+template <typename T>
+void ReadArrayFromFloat(char *&buf, T *ptr, Int_t n)
+{
+   Float_t afloat[kPackBlockSize];
+   for (Int_t j = 0; j < n; j += kPackBlockSize) {
+      const Int_t m = std::min(n - j, kPackBlockSize);
+#ifdef R__BYTESWAP
+      ROOT::Internal::ByteSwap::Copy32(afloat, buf, m);
+#else
+      memcpy(afloat, buf, m * sizeof(Float_t));
+#endif
+      buf += m * sizeof(Float_t);
+      for (Int_t k = 0; k < m; k++)
+         ptr[j + k] = (T)afloat[k];
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read n (exponent, truncated mantissa) pairs from buf and rebuild the floats,
+/// see TBufferFile::WriteFloat16.
+
+template <typename T>
+void ReadArrayWithNbits(char *&buf, T *ptr, Int_t n, Int_t nbits)
+{
+   union {
+      Float_t fFloatValue;
+      Int_t   fIntValue;
+   };
+   UChar_t  theExp;
+   UShort_t theMan;
+   for (Int_t i = 0; i < n; i++) {
+      frombuf(buf, &theExp);
+      frombuf(buf, &theMan);
+      fIntValue = theExp;
+      fIntValue <<= 23;
+      fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
+      if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
+      ptr[i] = (T)fFloatValue;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Normalize n values to [xmin,xmax] and write them to buf as integers,
+/// see TBufferFile::WriteFloat16. The caller makes sure buf is large enough.
+
+template <typename T>
+void WriteArrayWithFactor(char *&buf, const T *ptr, Int_t n, Double_t factor, Double_t xmin, Double_t xmax)
+{
+   UInt_t aint[kPackBlockSize];
+   for (Int_t j = 0; j < n; j += kPackBlockSize) {
+      const Int_t m = std::min(n - j, kPackBlockSize);
+      for (Int_t k = 0; k < m; k++) {
+         T x = ptr[j + k];
+         if (x < xmin) x = xmin;
+         if (x > xmax) x = xmax;
+         aint[k] = UInt_t(0.5+factor*(x-xmin));
+      }
+#ifdef R__BYTESWAP
+      ROOT::Internal::ByteSwap::Copy32(buf, aint, m);
+#else
+      memcpy(buf, aint, m * sizeof(UInt_t));
+#endif
+      buf += m * sizeof(UInt_t);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write n values to buf as floats, see TBufferFile::WriteDouble32.
+/// The caller makes sure buf is large enough.
+
+template <typename T>
+void WriteArrayAsFloat(char *&buf, const T *ptr, Int_t n)
+{
+   Float_t afloat[kPackBlockSize];
+   for (Int_t j = 0; j < n; j += kPackBlockSize) {
+      const Int_t m = std::min(n - j, kPackBlockSize);
+      for (Int_t k = 0; k < m; k++)
+         afloat[k] = (Float_t)ptr[j + k];
+#ifdef R__BYTESWAP
+      ROOT::Internal::ByteSwap::Copy32(buf, afloat, m);
+#else
+      memcpy(buf, afloat, m * sizeof(Float_t));
+#endif
+      buf += m * sizeof(Float_t);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write n values to buf as exponent and mantissa truncated to nbits,
+/// see TBufferFile::WriteFloat16. The caller makes sure buf is large enough.
+
+template <typename T>
+void WriteArrayWithNbits(char *&buf, const T *ptr, Int_t n, Int_t nbits)
+{
+   union {
+      Float_t fFloatValue;
+      Int_t   fIntValue;
+   };
+   for (Int_t i = 0; i < n; i++) {
+      fFloatValue = (Float_t)ptr[i];
+      UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
+      UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
+      theMan++;
+      theMan = theMan>>1;
+      if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
+      if (fFloatValue < 0) theMan |= 1<<(nbits+1);
+      tobuf(buf, theExp);
+      tobuf(buf, theMan);
+   }
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Thread-safe check on StreamerInfos of a TClass
 
@@ -762,13 +900,8 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
    if (!h) h = new Short_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
+   ROOT::Internal::ByteSwap::Copy16(h, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -795,13 +928,8 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
    if (!ii) ii = new Int_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
+   ROOT::Internal::ByteSwap::Copy32(ii, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -854,8 +982,8 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::ByteSwap::Copy64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -882,13 +1010,8 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
    if (!f) f = new Float_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
+   ROOT::Internal::ByteSwap::Copy32(f, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -915,8 +1038,8 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::ByteSwap::Copy64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1035,13 +1158,8 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
    if (!h) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
+   ROOT::Internal::ByteSwap::Copy16(h, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -1067,13 +1185,8 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
    if (!ii) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
-   fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
+   ROOT::Internal::ByteSwap::Copy32(ii, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -1124,8 +1237,8 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::ByteSwap::Copy64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1151,13 +1264,8 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
    if (!f) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
-   fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
+   ROOT::Internal::ByteSwap::Copy32(f, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -1183,8 +1291,8 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::ByteSwap::Copy64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1301,13 +1409,8 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
    if (n <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
-   fBufCur += sizeof(Short_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
+   ROOT::Internal::ByteSwap::Copy16(h, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -1323,13 +1426,8 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
-   fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
+   ROOT::Internal::ByteSwap::Copy32(ii, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -1361,8 +1459,8 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ROOT::Internal::ByteSwap::Copy64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1378,13 +1476,8 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
-   fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
+   ROOT::Internal::ByteSwap::Copy32(f, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -1400,8 +1493,8 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ROOT::Internal::ByteSwap::Copy64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1418,33 +1511,14 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a float
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; f[j] = (Float_t)(aint/factor + xmin);
-      }
+      ReadArrayWithFactor(fBufCur, f, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the new float.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         f[i] = fFloatValue;
-      }
+      ReadArrayWithNbits(fBufCur, f, n, nbits);
    }
 }
 
@@ -1457,9 +1531,7 @@ void TBufferFile::ReadFastArrayWithFactor(Float_t *ptr, Int_t n, Double_t factor
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a float
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; ptr[j] = (Float_t)(aint/factor + minvalue);
-   }
+   ReadArrayWithFactor(fBufCur, ptr, n, factor, minvalue);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1473,21 +1545,7 @@ void TBufferFile::ReadFastArrayWithNbits(Float_t *ptr, Int_t n, Int_t nbits)
    if (!nbits) nbits = 12;
    //we read the exponent and the truncated mantissa of the float
    //and rebuild the new float.
-   union {
-      Float_t fFloatValue;
-      Int_t   fIntValue;
-   };
-   UChar_t  theExp;
-   UShort_t theMan;
-   for (Int_t i = 0; i < n; i++) {
-      *this >> theExp;
-      *this >> theMan;
-      fIntValue = theExp;
-      fIntValue <<= 23;
-      fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-      if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-      ptr[i] = fFloatValue;
-   }
+   ReadArrayWithNbits(fBufCur, ptr, n, nbits);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1500,40 +1558,17 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a double.
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + xmin);
-      }
+      ReadArrayWithFactor(fBufCur, d, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) {
          //we read a float and convert it to double
-         Float_t afloat;
-         for (i = 0; i < n; i++) {
-            *this >> afloat;
-            d[i] = (Double_t)afloat;
-         }
+         ReadArrayFromFloat(fBufCur, d, n);
       } else {
          //we read the exponent and the truncated mantissa of the float
          //and rebuild the double.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         UChar_t  theExp;
-         UShort_t theMan;
-         for (i = 0; i < n; i++) {
-            *this >> theExp;
-            *this >> theMan;
-            fIntValue = theExp;
-            fIntValue <<= 23;
-            fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-            if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-            d[i] = (Double_t)fFloatValue;
-         }
+         ReadArrayWithNbits(fBufCur, d, n, nbits);
       }
    }
 }
@@ -1547,9 +1582,7 @@ void TBufferFile::ReadFastArrayWithFactor(Double_t *d, Int_t n, Double_t factor,
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a double.
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + minvalue);
-   }
+   ReadArrayWithFactor(fBufCur, d, n, factor, minvalue);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1562,29 +1595,11 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
 
    if (!nbits) {
       //we read a float and convert it to double
-      Float_t afloat;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> afloat;
-         d[i] = (Double_t)afloat;
-      }
+      ReadArrayFromFloat(fBufCur, d, n);
    } else {
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the double.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         d[i] = (Double_t)fFloatValue;
-      }
+      ReadArrayWithNbits(fBufCur, d, n, nbits);
    }
 }
 
@@ -1734,13 +1749,8 @@ void TBufferFile::WriteArray(const Short_t *h, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(fBufCur, h, n);
+   ROOT::Internal::ByteSwap::Copy16(fBufCur, h, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
 #else
    memcpy(fBufCur, h, l);
    fBufCur += l;
@@ -1764,13 +1774,8 @@ void TBufferFile::WriteArray(const Int_t *ii, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, ii, n);
+   ROOT::Internal::ByteSwap::Copy32(fBufCur, ii, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
 #else
    memcpy(fBufCur, ii, l);
    fBufCur += l;
@@ -1832,8 +1837,8 @@ void TBufferFile::WriteArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   ROOT::Internal::ByteSwap::Copy64(fBufCur, ll, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -1857,13 +1862,8 @@ void TBufferFile::WriteArray(const Float_t *f, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, f, n);
+   ROOT::Internal::ByteSwap::Copy32(fBufCur, f, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
 #else
    memcpy(fBufCur, f, l);
    fBufCur += l;
@@ -1887,8 +1887,8 @@ void TBufferFile::WriteArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   ROOT::Internal::ByteSwap::Copy64(fBufCur, d, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2000,13 +2000,8 @@ void TBufferFile::WriteFastArray(const Short_t *h, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(fBufCur, h, n);
+   ROOT::Internal::ByteSwap::Copy16(fBufCur, h, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
 #else
    memcpy(fBufCur, h, l);
    fBufCur += l;
@@ -2024,13 +2019,8 @@ void TBufferFile::WriteFastArray(const Int_t *ii, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, ii, n);
+   ROOT::Internal::ByteSwap::Copy32(fBufCur, ii, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
 #else
    memcpy(fBufCur, ii, l);
    fBufCur += l;
@@ -2076,8 +2066,8 @@ void TBufferFile::WriteFastArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   ROOT::Internal::ByteSwap::Copy64(fBufCur, ll, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -2095,13 +2085,8 @@ void TBufferFile::WriteFastArray(const Float_t *f, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, f, n);
+   ROOT::Internal::ByteSwap::Copy32(fBufCur, f, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
 #else
    memcpy(fBufCur, f, l);
    fBufCur += l;
@@ -2119,8 +2104,8 @@ void TBufferFile::WriteFastArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   ROOT::Internal::ByteSwap::Copy64(fBufCur, d, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2142,39 +2127,16 @@ void TBufferFile::WriteFastArrayFloat16(const Float_t *f, Int_t n, TStreamerElem
       //A range is specified. We normalize the float to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Float_t x = f[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      WriteArrayWithFactor(fBufCur, f, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
-      Int_t i;
       //a range is not specified, but nbits is.
       //In this case we truncate the mantissa to nbits and we stream
       //the exponent as a UChar_t and the mantissa as a UShort_t.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      for (i = 0; i < n; i++) {
-         fFloatValue = f[i];
-         UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-         UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-         theMan++;
-         theMan = theMan>>1;
-         if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
-         if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-         *this << theExp;
-         *this << theMan;
-      }
+      WriteArrayWithNbits(fBufCur, f, n, nbits);
    }
 }
 
@@ -2193,45 +2155,19 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
       //A range is specified. We normalize the double to the range and
       //convert it to an integer using a scaling factor that is a function of nbits.
       //see TStreamerElement::GetRange.
-      Double_t factor = ele->GetFactor();
-      Double_t xmin = ele->GetXmin();
-      Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Double_t x = d[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
-      }
+      WriteArrayWithFactor(fBufCur, d, n, ele->GetFactor(), ele->GetXmin(), ele->GetXmax());
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
-      Int_t i;
       if (!nbits) {
          //if no range and no bits specified, we convert from double to float
-         for (i = 0; i < n; i++) {
-            Float_t afloat = (Float_t)d[i];
-            *this << afloat;
-         }
+         WriteArrayAsFloat(fBufCur, d, n);
       } else {
          //a range is not specified, but nbits is.
          //In this case we truncate the mantissa to nbits and we stream
          //the exponent as a UChar_t and the mantissa as a UShort_t.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         for (i = 0; i < n; i++) {
-            fFloatValue = (Float_t)d[i];
-            UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-            UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-            theMan++;
-            theMan = theMan>>1;
-            if(theMan&1<<nbits) theMan = (1<<nbits) - 1;
-            if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-            *this << theExp;
-            *this << theMan;
-         }
+         WriteArrayWithNbits(fBufCur, d, n, nbits);
       }
    }
 }
@@ -3303,6 +3239,13 @@ Int_t TBufferFile::ReadClassBuffer(const TClass *cl, void *pointer, Int_t versio
    /// The StreamerInfo should exist at this point.
 
    else {
+      // The last read StreamerInfo is guaranteed to be compiled, so the common
+      // case of reading the same version again does not need the lock.
+      TStreamerInfo *guess = (TStreamerInfo*)cl->GetLastReadInfo();
+      if (guess && guess->GetClassVersion() == version)
+         sinfo = guess;
+   }
+   if (!sinfo) {
       R__READ_LOCKGUARD(ROOT::gCoreMutex);
       auto infos = cl->GetStreamerInfos();
       auto ninfos = infos->GetSize();
@@ -3572,9 +3515,13 @@ Int_t TBufferFile::ApplySequence(const TStreamerInfoActions::TActionSequence &se
       }
 
    } else {
+      // The fused actions access the buffer directly, they cannot be used by derived
+      // classes that stream basic types differently (e.g. TBufferSQL).
+      const TStreamerInfoActions::ActionContainer_t &actions =
+         (sequence.fFusedActions.empty() || IsA() != TBufferFile::Class()) ? sequence.fActions : sequence.fFusedActions;
       //loop on all active members
-      TStreamerInfoActions::ActionContainer_t::const_iterator end = sequence.fActions.end();
-      for(TStreamerInfoActions::ActionContainer_t::const_iterator iter = sequence.fActions.begin();
+      TStreamerInfoActions::ActionContainer_t::const_iterator end = actions.end();
+      for(TStreamerInfoActions::ActionContainer_t::const_iterator iter = actions.begin();
           iter != end;
           ++iter) {
          (*iter)(*this,obj);
@@ -92,6 +92,7 @@ class Container {
 
 #include "TBufferJSON.h"
 
+#include <algorithm>
 #include <typeinfo>
 #include <string>
 #include <cstring>
@@ -2799,31 +2800,47 @@ R__ALWAYS_INLINE void TBufferJSON::JsonReadFastArray(T *arr, Int_t arrsize, bool
       }
 
       int p = 0, id = 0;
-      std::string idname = "", pname, vname, nname;
+      std::string pname = "p", vname = "v", nname = "n";
       while (p < arrsize) {
-         pname = std::string("p") + idname;
-         if (json->count(pname) == 1)
-            p = json->at(pname).get<int>();
-         vname = std::string("v") + idname;
-         if (json->count(vname) != 1)
+         auto iter = json->find(pname);
+         if (iter != json->end())
+            p = iter->get<int>();
+         iter = json->find(vname);
+         if ((iter == json->end()) || (p < 0))
             break;
-         nlohmann::json &v = json->at(vname);
+         const nlohmann::json &v = *iter;
          if (v.is_array()) {
-            for (unsigned sub = 0; sub < v.size(); ++sub)
-               arr[p++] = v[sub].get<T>();
+            if (p + (int)v.size() > arrsize) {
+               Error("ReadFastArray", "Compressed array data exceed array size %d", arrsize);
+               break;
+            }
+            for (auto &elem : v)
+               arr[p++] = elem.get<T>();
          } else {
-            nname = std::string("n") + idname;
-            unsigned ncopy = (json->count(nname) == 1) ? json->at(nname).get<unsigned>() : 1;
-            for (unsigned sub = 0; sub < ncopy; ++sub)
-               arr[p++] = v.get<T>();
+            iter = json->find(nname);
+            int ncopy = (iter != json->end()) ? iter->get<int>() : 1;
+            if ((ncopy < 0) || (p + ncopy > arrsize)) {
+               Error("ReadFastArray", "Compressed array data exceed array size %d", arrsize);
+               break;
+            }
+            T value = v.get<T>();
+            std::fill(arr + p, arr + p + ncopy, value);
+            p += ncopy;
          }
-         idname = std::to_string(++id);
+         auto suffix = std::to_string(++id);
+         pname = "p" + suffix;
+         vname = "v" + suffix;
+         nname = "n" + suffix;
       }
    } else {
       if ((int)json->size() != arrsize)
          Error("ReadFastArray", "Mismatch array sizes %d %d", arrsize, (int)json->size());
-      for (int cnt = 0; cnt < arrsize; ++cnt)
-         arr[cnt] = json->at(cnt).get<T>();
+      int cnt = 0;
+      for (auto &elem : *json) {
+         if (cnt >= arrsize)
+            break;
+         arr[cnt++] = elem.get<T>();
+      }
    }
 }
 
@@ -3035,19 +3052,34 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
 {
    bool is_base64 = Stack()->fBase64 || (fArrayCompact == kBase64);
 
+   // appends separator, "key<suffix>":value without temporary strings
+   auto appendKey = [this](const char *key, Int_t suffixcnt, Int_t value) {
+      char buf[32];
+      fValue.Append(fArraySepar);
+      fValue.Append('"');
+      fValue.Append(key);
+      if (suffixcnt > 0)
+         fValue.Append(buf, ConvertInteger(static_cast<Long64_t>(suffixcnt), buf));
+      fValue.Append("\":", 2);
+      if (value >= 0)
+         fValue.Append(buf, ConvertInteger(static_cast<Long64_t>(value), buf));
+   };
+
    if (!is_base64 && ((fArrayCompact == 0) || (arrsize < 6))) {
-      fValue.Append("[");
+      fValue.Append('[');
       for (Int_t indx = 0; indx < arrsize; indx++) {
          if (indx > 0)
-            fValue.Append(fArraySepar.Data());
+            fValue.Append(fArraySepar);
          JsonWriteBasic(vname[indx]);
       }
-      fValue.Append("]");
+      fValue.Append(']');
    } else if (is_base64 && !arrsize) {
       fValue.Append("[]");
    } else {
-      fValue.Append("{");
-      fValue.Append(TString::Format("\"$arr\":\"%s\"%s\"len\":%d", typname, fArraySepar.Data(), arrsize));
+      fValue.Append("{\"$arr\":\"");
+      fValue.Append(typname);
+      fValue.Append('"');
+      appendKey("len", 0, arrsize);
       Int_t aindx(0), bindx(arrsize);
       while ((aindx < arrsize) && (vname[aindx] == 0))
          aindx++;
@@ -3060,7 +3092,7 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
             aindx = 0;
 
          if ((aindx > 0) && (aindx < bindx))
-            fValue.Append(TString::Format("%s\"o\":%ld", fArraySepar.Data(), (long) (aindx * (int) sizeof(T))));
+            appendKey("o", 0, aindx * (int) sizeof(T));
 
          fValue.Append(fArraySepar);
          fValue.Append("\"b\":\"");
@@ -3070,7 +3102,6 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
 
          fValue.Append("\"");
       } else if (aindx < bindx) {
-         TString suffix("");
          Int_t p(aindx), suffixcnt(-1), lastp(0);
          while (p < bindx) {
             if (vname[p] == 0) {
@@ -3106,24 +3137,23 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
             }
             if (pp <= p0)
                continue;
-            if (++suffixcnt > 0)
-               suffix.Form("%d", suffixcnt);
+            ++suffixcnt;
             if (p0 != lastp)
-               fValue.Append(TString::Format("%s\"p%s\":%d", fArraySepar.Data(), suffix.Data(), p0));
+               appendKey("p", suffixcnt, p0);
             lastp = pp; /* remember cursor, it may be the same */
-            fValue.Append(TString::Format("%s\"v%s\":", fArraySepar.Data(), suffix.Data()));
+            appendKey("v", suffixcnt, -1);
             if ((nsame > 1) || (pp - p0 == 1)) {
                JsonWriteBasic(vname[p0]);
                if (nsame > 1)
-                  fValue.Append(TString::Format("%s\"n%s\":%d", fArraySepar.Data(), suffix.Data(), nsame));
+                  appendKey("n", suffixcnt, nsame);
             } else {
-               fValue.Append("[");
+               fValue.Append('[');
                for (Int_t indx = p0; indx < pp; indx++) {
                   if (indx > p0)
-                     fValue.Append(fArraySepar.Data());
+                     fValue.Append(fArraySepar);
                   JsonWriteBasic(vname[indx]);
                }
-               fValue.Append("]");
+               fValue.Append(']');
             }
          }
       }
@@ -3880,9 +3910,8 @@ void TBufferJSON::WriteCharStar(char *s)
 
 void TBufferJSON::JsonWriteBasic(Char_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(static_cast<Long64_t>(value), buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3890,9 +3919,8 @@ void TBufferJSON::JsonWriteBasic(Char_t value)
 
 void TBufferJSON::JsonWriteBasic(Short_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hd", value);
-   fValue.Append(buf);
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(static_cast<Long64_t>(value), buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3900,9 +3928,8 @@ void TBufferJSON::JsonWriteBasic(Short_t value)
 
 void TBufferJSON::JsonWriteBasic(Int_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(static_cast<Long64_t>(value), buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3910,9 +3937,8 @@ void TBufferJSON::JsonWriteBasic(Int_t value)
 
 void TBufferJSON::JsonWriteBasic(Long_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%ld", value);
-   fValue.Append(buf);
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(static_cast<Long64_t>(value), buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3920,7 +3946,8 @@ void TBufferJSON::JsonWriteBasic(Long_t value)
 
 void TBufferJSON::JsonWriteBasic(Long64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(value, buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3934,8 +3961,7 @@ void TBufferJSON::JsonWriteBasic(Float_t value)
       fValue.Append("null");
    } else {
       char buf[200];
-      ConvertFloat(value, buf, sizeof(buf));
-      fValue.Append(buf);
+      fValue.Append(ConvertFloat(value, buf, sizeof(buf)));
    }
 }
 
@@ -3950,8 +3976,7 @@ void TBufferJSON::JsonWriteBasic(Double_t value)
       fValue.Append("null");
    } else {
       char buf[200];
-      ConvertDouble(value, buf, sizeof(buf));
-      fValue.Append(buf);
+      fValue.Append(ConvertDouble(value, buf, sizeof(buf)));
    }
 }
 
@@ -3968,9 +3993,8 @@ void TBufferJSON::JsonWriteBasic(Bool_t value)
 
 void TBufferJSON::JsonWriteBasic(UChar_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(static_cast<ULong64_t>(value), buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3978,9 +4002,8 @@ void TBufferJSON::JsonWriteBasic(UChar_t value)
 
 void TBufferJSON::JsonWriteBasic(UShort_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hu", value);
-   fValue.Append(buf);
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(static_cast<ULong64_t>(value), buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3988,9 +4011,8 @@ void TBufferJSON::JsonWriteBasic(UShort_t value)
 
 void TBufferJSON::JsonWriteBasic(UInt_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(static_cast<ULong64_t>(value), buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3998,9 +4020,8 @@ void TBufferJSON::JsonWriteBasic(UInt_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%lu", value);
-   fValue.Append(buf);
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(static_cast<ULong64_t>(value), buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4008,7 +4029,8 @@ void TBufferJSON::JsonWriteBasic(ULong_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   char buf[32];
+   fValue.Append(buf, ConvertInteger(value, buf));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -10,13 +10,34 @@
  *************************************************************************/
 
 #include "ROOT/TBufferMerger.hxx"
+#include "ROOT/RBufferPool.hxx"
 
 #include "TBufferFile.h"
 #include "TError.h"
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
+#include <algorithm>
+#include <chrono>
+#include <string>
 #include <utility>
+#include <vector>
+
+namespace {
+
+/// Name of the i-th output file: "_<i>" is inserted before the extension of name
+std::string GetIndexedFileName(const char *name, unsigned int i)
+{
+   std::string fileName(name);
+   const auto dot = fileName.rfind('.');
+   const auto slash = fileName.rfind('/');
+   const auto suffix = "_" + std::to_string(i);
+   if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+      return fileName + suffix;
+   return fileName.insert(dot, suffix);
+}
+
+} // anonymous namespace
 
 namespace ROOT {
 
@@ -25,20 +46,48 @@ TBufferMerger::TBufferMerger(const char *name, Option_t *option, Int_t compress)
    // We cannot chain constructors or use in-place initialization here because
    // instantiating a TBufferMerger should not alter gDirectory's state.
    TDirectory::TContext ctxt;
-   Init(std::unique_ptr<TFile>(TFile::Open(name, option, /* title */ name, compress)));
+   std::vector<std::unique_ptr<TFile>> outputs;
+   outputs.emplace_back(TFile::Open(name, option, /* title */ name, compress));
+   Init(std::move(outputs));
+}
+
+TBufferMerger::TBufferMerger(const char *name, Option_t *option, Int_t compress, unsigned int nOutputFiles)
+{
+   TDirectory::TContext ctxt;
+   std::vector<std::unique_ptr<TFile>> outputs;
+   for (unsigned int i = 0; i < std::max(nOutputFiles, 1u); ++i) {
+      const auto fileName = nOutputFiles > 1 ? GetIndexedFileName(name, i) : std::string(name);
+      outputs.emplace_back(TFile::Open(fileName.c_str(), option, /* title */ fileName.c_str(), compress));
+   }
+   Init(std::move(outputs));
 }
 
 TBufferMerger::TBufferMerger(std::unique_ptr<TFile> output)
 {
-   Init(std::move(output));
+   std::vector<std::unique_ptr<TFile>> outputs;
+   outputs.emplace_back(std::move(output));
+   Init(std::move(outputs));
 }
 
-void TBufferMerger::Init(std::unique_ptr<TFile> output)
+TBufferMerger::TBufferMerger(std::vector<std::unique_ptr<TFile>> outputs)
 {
-   if (!output || !output->IsWritable() || output->IsZombie())
-      Error("TBufferMerger", "cannot write to output file");
+   Init(std::move(outputs));
+}
+
+void TBufferMerger::Init(std::vector<std::unique_ptr<TFile>> outputs)
+{
+   if (outputs.empty()) {
+      Error("TBufferMerger", "no output file");
+      outputs.emplace_back(nullptr);
+   }
+
+   for (auto &file : outputs) {
+      if (!file || !file->IsWritable() || file->IsZombie())
+         Error("TBufferMerger", "cannot write to output file");
 
-   fMerger.OutputFile(std::move(output));
+      fOutputs.emplace_back(std::make_unique<Output>());
+      fOutputs.back()->fMerger.OutputFile(std::move(file));
+   }
 }
 
 TBufferMerger::~TBufferMerger()
@@ -52,8 +101,9 @@ TBufferMerger::~TBufferMerger()
    // Since we support purely incremental merging, Merge does not write the target objects
    // that are attached to the file (TTree and histograms) and thus we need to write them
    // now.
-   if (TFile *out = fMerger.GetOutputFile())
-      out->Write("",TObject::kOverwrite);
+   for (auto &output : fOutputs)
+      if (TFile *out = output->fMerger.GetOutputFile())
+         out->Write("",TObject::kOverwrite);
 }
 
 std::shared_ptr<TBufferMergerFile> TBufferMerger::GetFile()
@@ -71,15 +121,43 @@ size_t TBufferMerger::GetQueueSize() const
    return fQueue.size();
 }
 
+TBufferMerger::MergeStats TBufferMerger::GetMergeStats() const
+{
+   std::lock_guard<std::mutex> lock(fStatsMutex);
+   return fStats;
+}
+
 void TBufferMerger::Push(TBufferFile *buffer)
 {
+   size_t buffered;
    {
       std::lock_guard<std::mutex> lock(fQueueMutex);
-      fBuffered += buffer->BufferSize();
+      buffered = (fBuffered += buffer->BufferSize());
       fQueue.push(buffer);
    }
+   {
+      std::lock_guard<std::mutex> lock(fStatsMutex);
+      fStats.fMaxQueueBytes = std::max(fStats.fMaxQueueBytes, buffered);
+   }
+
+   if (fMaxBuffered > 0 && buffered > fMaxBuffered) {
+      // Backpressure: wait for any output to become free and drain the queue into it ourselves
+      const auto start = std::chrono::steady_clock::now();
+      Output *output = nullptr;
+      {
+         std::unique_lock<std::mutex> lock(fOutputMutex);
+         fOutputFreed.wait(lock, [&] { return (output = TryLockOutput()) != nullptr; });
+      }
+      const std::chrono::duration<double> blocked = std::chrono::steady_clock::now() - start;
+      {
+         std::lock_guard<std::mutex> lock(fStatsMutex);
+         fStats.fBlockedSeconds += blocked.count();
+      }
+      MergeImpl(*output);
+      return;
+   }
 
-   if (fBuffered > fAutoSave)
+   if (buffered > fAutoSave)
       Merge();
 }
 
@@ -90,7 +168,7 @@ size_t TBufferMerger::GetAutoSave() const
 
 const char *TBufferMerger::GetMergeOptions()
 {
-   return fMerger.GetMergeOptions();
+   return fOutputs[0]->fMerger.GetMergeOptions();
 }
 
 
@@ -101,19 +179,51 @@ void TBufferMerger::SetAutoSave(size_t size)
 
 void TBufferMerger::SetMergeOptions(const TString& options)
 {
-   fMerger.SetMergeOptions(options);
+   for (auto &output : fOutputs)
+      output->fMerger.SetMergeOptions(options);
 }
 
-void TBufferMerger::Merge()
+/// Lock the merge mutex of the output with the fewest merged bytes among those that are not being
+/// merged into, or return nullptr if all of them are busy.
+TBufferMerger::Output *TBufferMerger::TryLockOutput()
 {
-   if (fMergeMutex.try_lock()) {
-      MergeImpl();
-      fMergeMutex.unlock();
+   if (fOutputs.size() == 1)
+      return fOutputs[0]->fMergeMutex.try_lock() ? fOutputs[0].get() : nullptr;
+
+   std::vector<Output *> candidates;
+   candidates.reserve(fOutputs.size());
+   for (auto &output : fOutputs)
+      candidates.push_back(output.get());
+   std::stable_sort(candidates.begin(), candidates.end(),
+                    [](const Output *a, const Output *b) { return a->fBytesMerged < b->fBytesMerged; });
+   for (auto output : candidates) {
+      if (output->fMergeMutex.try_lock())
+         return output;
    }
+   return nullptr;
 }
 
-void TBufferMerger::MergeImpl()
+void TBufferMerger::Merge()
 {
+   if (auto output = TryLockOutput())
+      MergeImpl(*output);
+}
+
+/// Merge memfile, if any, and the queued buffers into output, whose merge mutex must be locked
+/// by the caller. The mutex is released on return.
+void TBufferMerger::MergeImpl(Output &output, TBufferMergerFile *memfile)
+{
+   const auto start = std::chrono::steady_clock::now();
+
+   size_t nBuffers = 0;
+   size_t nBytes = 0;
+   if (memfile) {
+      memfile->WriteStreamerInfo();
+      output.fMerger.AddFile(memfile);
+      ++nBuffers;
+      nBytes += memfile->GetSize();
+   }
+
    std::queue<TBufferFile *> queue;
    {
       std::lock_guard<std::mutex> q(fQueueMutex);
@@ -121,27 +231,50 @@ void TBufferMerger::MergeImpl()
       fBuffered = 0;
    }
 
+   // The TMemFiles only view the buffers, which go back to the buffer pool once the files are merged and deleted
+   std::vector<TBufferFile *> buffers;
+   buffers.reserve(queue.size());
    while (!queue.empty()) {
-      std::unique_ptr<TBufferFile> buffer{queue.front()};
-      fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
+      TBufferFile *buffer = queue.front();
+      buffers.push_back(buffer);
+      ++nBuffers;
+      nBytes += buffer->Length();
+      output.fMerger.AddAdoptFile(new TMemFile(output.fMerger.GetOutputFileName(),
+                                               TMemFile::ZeroCopyView_t(buffer->Buffer(), buffer->Length())));
       queue.pop();
    }
 
-   fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
-                        TFileMerger::kKeepCompression);
-   fMerger.Reset();
+   if (nBuffers > 0) {
+      output.fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
+                                  TFileMerger::kKeepCompression);
+      output.fMerger.Reset();
+      for (auto buffer : buffers)
+         ROOT::Internal::RBufferPool::ReleaseBuffer(buffer);
+      output.fBytesMerged += nBytes;
+
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      std::lock_guard<std::mutex> lock(fStatsMutex);
+      ++fStats.fNMerges;
+      fStats.fNBuffers += nBuffers;
+      fStats.fBytesMerged += nBytes;
+      fStats.fMergeSeconds += elapsed.count();
+   }
+
+   output.fMergeMutex.unlock();
+   {
+      // Taking the lock orders the notification after a waiter has checked the outputs
+      std::lock_guard<std::mutex> lock(fOutputMutex);
+   }
+   fOutputFreed.notify_all();
 }
 
 bool TBufferMerger::TryMerge(ROOT::TBufferMergerFile *memfile)
 {
-   if (fMergeMutex.try_lock()) {
-      memfile->WriteStreamerInfo();
-      fMerger.AddFile(memfile);
-      MergeImpl();
-      fMergeMutex.unlock();
-      return true;
-   } else
+   auto output = TryLockOutput();
+   if (!output)
       return false;
+   MergeImpl(*output, memfile);
+   return true;
 }
 
 } // namespace ROOT
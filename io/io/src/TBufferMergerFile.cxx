@@ -10,14 +10,14 @@
  *************************************************************************/
 
 #include "ROOT/TBufferMerger.hxx"
+#include "ROOT/RBufferPool.hxx"
 
 #include "TBufferFile.h"
 
 namespace ROOT {
 
 TBufferMergerFile::TBufferMergerFile(TBufferMerger &m)
-   : TMemFile(m.fMerger.GetOutputFile()->GetName(), "RECREATE", "",
-              m.fMerger.GetOutputFile()->GetCompressionSettings()),
+   : TMemFile(m.GetOutputFile()->GetName(), "RECREATE", "", m.GetOutputFile()->GetCompressionSettings()),
      fMerger(m)
 {
 }
@@ -48,7 +48,7 @@ Int_t TBufferMergerFile::Write(const char *name, Int_t opt, Int_t bufsize)
    SetCompressionLevel(oldCompLevel);
 
    if (nbytes) {
-      TBufferFile *buffer = new TBufferFile(TBuffer::kWrite, GetSize());
+      TBufferFile *buffer = ROOT::Internal::RBufferPool::AcquireBuffer(TBuffer::kWrite, GetSize());
       CopyTo(*buffer);
       buffer->SetReadMode();
       fMerger.Push(buffer);
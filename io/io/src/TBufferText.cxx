@@ -32,6 +32,8 @@ actions list for both are the same.
 #include "TError.h"
 #include "snprintf.h"
 
+#include <cmath>
+
 ClassImp(TBufferText);
 
 const char *TBufferText::fgFloatFmt = "%e";
@@ -791,6 +793,37 @@ void TBufferText::CompactFloatString(char *sbuf, unsigned len)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// convert integer to decimal string, same as "%lld" format but much faster
+/// buf should have at least 21 bytes, returns length of produced string
+
+Int_t TBufferText::ConvertInteger(Long64_t value, char *buf)
+{
+   if (value >= 0)
+      return ConvertInteger(static_cast<ULong64_t>(value), buf);
+   *buf = '-';
+   // negate in unsigned arithmetic, valid also for the minimal value
+   return ConvertInteger(0ULL - static_cast<ULong64_t>(value), buf + 1) + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// convert unsigned integer to decimal string, same as "%llu" format but much faster
+/// buf should have at least 21 bytes, returns length of produced string
+
+Int_t TBufferText::ConvertInteger(ULong64_t value, char *buf)
+{
+   char tmp[20];
+   Int_t len = 0;
+   do {
+      tmp[len++] = '0' + (value % 10);
+      value /= 10;
+   } while (value);
+   for (Int_t n = 0; n < len; ++n)
+      buf[n] = tmp[len - n - 1];
+   buf[len] = 0;
+   return len;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// set printf format for float/double members, default "%e"
 /// to change format only for doubles, use SetDoubleFormat
@@ -838,7 +871,11 @@ const char *TBufferText::ConvertFloat(Float_t value, char *buf, unsigned len, Bo
    if (not_optimize) {
       snprintf(buf, len, fgFloatFmt, value);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e15)) {
-      snprintf(buf, len, "%1.0f", value);
+      // integral value, same as "%1.0f" format
+      if ((len > 24) && ((value != 0) || !std::signbit(value)))
+         ConvertInteger(static_cast<Long64_t>(value), buf);
+      else
+         snprintf(buf, len, "%1.0f", value);
    } else {
       snprintf(buf, len, fgFloatFmt, value);
       CompactFloatString(buf, len);
@@ -854,7 +891,11 @@ const char *TBufferText::ConvertDouble(Double_t value, char *buf, unsigned len,
    if (not_optimize) {
       snprintf(buf, len, fgFloatFmt, value);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e25)) {
-      snprintf(buf, len, "%1.0f", value);
+      // integral value, same as "%1.0f" format; exact conversion only below 2^63
+      if ((len > 24) && (std::abs(value) < 1e18) && ((value != 0) || !std::signbit(value)))
+         ConvertInteger(static_cast<Long64_t>(value), buf);
+      else
+         snprintf(buf, len, "%1.0f", value);
    } else {
       snprintf(buf, len, fgDoubleFmt, value);
       CompactFloatString(buf, len);
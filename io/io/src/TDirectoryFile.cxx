@@ -48,10 +48,36 @@ End_Macro
 #include "TProcessUUID.h"
 #include "TVirtualMutex.h"
 #include "TEmulatedCollectionProxy.h"
+#include "TEnv.h"
+
+#include <algorithm>
 
 const UInt_t kIsBigFile = BIT(16);
 const Int_t  kMaxLen = 2048;
 
+namespace {
+
+/// Marks the index at the end of a keys record ("KIDX"), see TDirectoryFile::WriteKeys()
+constexpr Int_t kKeyIndexMagic = 0x4B494458;
+/// On-file size of an index entry: name hash, offset and length of the key header
+constexpr Int_t kKeyIndexEntrySize = 12;
+/// On-file size of the index trailer: offset of the index, number of entries and magic
+constexpr Int_t kKeyIndexTrailerSize = 12;
+
+/// Hash of a key name stored in the key index. Unlike TString::Hash() it must not depend on the platform.
+UInt_t KeyNameHash(const char *name)
+{
+   // 32 bit FNV-1a
+   UInt_t hash = 2166136261u;
+   for (auto c = reinterpret_cast<const unsigned char *>(name); *c; ++c) {
+      hash ^= *c;
+      hash *= 16777619u;
+   }
+   return hash;
+}
+
+} // anonymous namespace
+
 ClassImp(TDirectoryFile);
 
 
@@ -177,6 +203,7 @@ void TDirectoryFile::InitDirectoryFile(TClass *cl)
 
 TDirectoryFile::~TDirectoryFile()
 {
+   ResetKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
       SafeDelete(fKeys);
@@ -230,6 +257,10 @@ Int_t TDirectoryFile::AppendKey(TKey *key)
       return 0;
    }
 
+   // The new key must go into the complete list, or the keys not looked up yet would be lost by WriteKeys()
+   if (!fKeysLoaded)
+      LoadKeys();
+
    fModified = kTRUE;
 
    key->SetMotherDir(this);
@@ -575,6 +606,7 @@ void TDirectoryFile::Close(Option_t *option)
    }
 
    // Delete keys from key list (but don't delete the list header)
+   ResetKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -944,7 +976,7 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 //                        ========================
    TObject *idcur = fList ? fList->FindObject(namobj) : nullptr;
    if (idcur) {
-      if (idcur==this && strlen(namobj)!=0) {
+      if (idcur==this && nch!=0) {
          // The object has the same name has the directory and
          // that's what we picked-up!  We just need to ignore
          // it ...
@@ -961,13 +993,21 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
+   if (!fKeysLoaded) {
+      TKey *key = FindKeyInIndex(namobj, cycle, kTRUE);
+      if (!key)
+         return nullptr;
+      TDirectory::TContext ctxt(this);
+      return key->ReadObj();
+   }
+
    auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
    if (!listOfKeys) {
       Error("Get", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
    }
 
-   if (const TList *keyList = listOfKeys->GetListForObject(namobj)) {
+   if (const TList *keyList = listOfKeys->GetListForObject(std::string_view(namobj, nch))) {
       for (auto key: TRangeDynCast<TKey>(*keyList)) {
          if (key && !strcmp(key->GetName(), namobj)
              && (cycle == 9999 || cycle == key->GetCycle())) {
@@ -1084,13 +1124,21 @@ void *TDirectoryFile::GetObjectChecked(const char *namecycle, const TClass* expe
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
+   if (!fKeysLoaded) {
+      TKey *key = FindKeyInIndex(namobj, cycle, kTRUE);
+      if (!key)
+         return nullptr;
+      TDirectory::TContext ctxt(this);
+      return key->ReadObjectAny(expectedClass);
+   }
+
    auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
    if (!listOfKeys) {
       Error("GetObjectChecked", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
    }
 
-   if (const TList *keyList = listOfKeys->GetListForObject(namobj)) {
+   if (const TList *keyList = listOfKeys->GetListForObject(std::string_view(namobj, nch))) {
       for (auto key: TRangeDynCast<TKey>(*keyList)) {
          if (key && !strcmp(key->GetName(), namobj)
              && (cycle == 9999 || cycle == key->GetCycle())) {
@@ -1125,6 +1173,9 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
 {
    if (!fKeys) return nullptr;
 
+   if (!fKeysLoaded)
+      return FindKeyInIndex(name, cycle, kFALSE);
+
    auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
    if (!listOfKeys) {
       Error("GetKey", "Unexpected type of TDirectoryFile::fKeys!");
@@ -1372,6 +1423,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
    char *buffer;
    if (forceRead) {
+      ResetKeyIndex();
       fKeys->Delete();
       //In case directory was updated by another process, read new
       //position for the keys
@@ -1404,6 +1456,24 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
       delete [] header;
    }
 
+   // Large directories of read-only files can be opened with only the index of their keys
+   if (fSeekKeys > 0 && !fFile->IsWritable() && gEnv->GetValue("TFile.LazyKeys", 0) && ReadKeyIndex())
+      return fKeyIndex.size();
+
+   return ReadKeysRecord(nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the keys record and add all its keys to fKeys.
+///
+/// Keys in known, sorted by their seek key, are added instead of the keys
+/// read from the record at the same location, which are dropped.
+
+Int_t TDirectoryFile::ReadKeysRecord(std::vector<TKey *> *known)
+{
+   auto bySeekKey = [](const TKey *key, Long64_t seek) { return key->GetSeekKey() < seek; };
+
+   char *buffer;
    Int_t nkeys = 0;
    Long64_t fsize = fFile->GetSize();
    if ( fSeekKeys >  0) {
@@ -1429,6 +1499,14 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
             nkeys = i;
             break;
          }
+         if (known) {
+            auto it = std::lower_bound(known->begin(), known->end(), key->GetSeekKey(), bySeekKey);
+            if (it != known->end() && (*it)->GetSeekKey() == key->GetSeekKey()) {
+               delete key;
+               key = *it;
+               *it = nullptr;
+            }
+         }
          fKeys->Add(key);
       }
       delete headerkey;
@@ -1437,6 +1515,119 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
    return nkeys;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the index at the end of the keys record, if there is one, instead of the keys themselves.
+///
+/// On success, the keys are looked up and read one by one from the index by GetKey() and Get(),
+/// until something needs the complete list of keys (see LoadKeys()).
+
+Bool_t TDirectoryFile::ReadKeyIndex()
+{
+   if (fNbytesKeys < kKeyIndexTrailerSize + (Int_t)sizeof(Int_t))
+      return kFALSE;
+
+   char trailer[kKeyIndexTrailerSize];
+   if (fFile->ReadBuffer(trailer, fSeekKeys + fNbytesKeys - kKeyIndexTrailerSize, kKeyIndexTrailerSize))
+      return kFALSE;
+   char *buffer = trailer;
+   Int_t indexOffset, nentries, magic;
+   frombuf(buffer, &indexOffset);
+   frombuf(buffer, &nentries);
+   frombuf(buffer, &magic);
+   if (magic != kKeyIndexMagic || nentries < 0 || indexOffset <= 0 ||
+       (Long64_t)indexOffset + (Long64_t)nentries * kKeyIndexEntrySize > fNbytesKeys - kKeyIndexTrailerSize)
+      return kFALSE;
+
+   std::vector<char> data((std::size_t)nentries * kKeyIndexEntrySize);
+   if (nentries > 0 && fFile->ReadBuffer(data.data(), fSeekKeys + indexOffset, data.size()))
+      return kFALSE;
+
+   std::vector<KeyIndexEntry> index(nentries);
+   buffer = data.data();
+   for (auto &entry : index) {
+      frombuf(buffer, &entry.fHash);
+      frombuf(buffer, &entry.fOffset);
+      frombuf(buffer, &entry.fKeylen);
+      if (entry.fOffset <= 0 || entry.fKeylen <= 0 ||
+          (Long64_t)entry.fOffset + entry.fKeylen > indexOffset)
+         return kFALSE;
+   }
+
+   fKeyIndex = std::move(index);
+   fKeysLoaded = kFALSE;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the first key with the given name and a matching cycle in the key index, reading it from the file
+/// if needed; the key is added to fKeys. See GetKey() for the meaning of the cycle if exactCycle is false,
+/// Get() otherwise.
+
+TKey *TDirectoryFile::FindKeyInIndex(const char *name, Short_t cycle, Bool_t exactCycle) const
+{
+   const UInt_t hash = KeyNameHash(name);
+   auto it = std::lower_bound(fKeyIndex.begin(), fKeyIndex.end(), hash,
+                              [](const KeyIndexEntry &entry, UInt_t h) { return entry.fHash < h; });
+   // Entries with the same hash are in the order of the keys record, i.e. the highest cycle comes first
+   for (; it != fKeyIndex.end() && it->fHash == hash; ++it) {
+      if (!it->fKey) {
+         std::vector<char> header(it->fKeylen);
+         if (fFile->ReadBuffer(header.data(), fSeekKeys + it->fOffset, it->fKeylen)) {
+            Error("FindKeyInIndex", "cannot read the key at offset %d of the keys record", it->fOffset);
+            continue;
+         }
+         char *buffer = header.data();
+         auto key = new TKey(const_cast<TDirectoryFile *>(this));
+         key->ReadKeyBuffer(buffer);
+         fKeys->Add(key);
+         it->fKey = key;
+      }
+      TKey *key = it->fKey;
+      if (strcmp(key->GetName(), name))
+         continue;
+      if (cycle == 9999 || (exactCycle ? cycle == key->GetCycle() : cycle >= key->GetCycle()))
+         return key;
+   }
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the complete list of keys of a directory whose keys have so far been looked up through the key index.
+///
+/// The keys already looked up are kept, so pointers to them stay valid.
+
+void TDirectoryFile::LoadKeys() const
+{
+   if (fKeysLoaded)
+      return;
+   fKeysLoaded = kTRUE;
+
+   std::vector<TKey *> known;
+   for (auto &entry : fKeyIndex) {
+      if (entry.fKey)
+         known.push_back(entry.fKey);
+   }
+   fKeyIndex.clear();
+   fKeyIndex.shrink_to_fit();
+   std::sort(known.begin(), known.end(),
+             [](const TKey *a, const TKey *b) { return a->GetSeekKey() < b->GetSeekKey(); });
+
+   fKeys->Clear("nodelete");
+   const_cast<TDirectoryFile *>(this)->ReadKeysRecord(&known);
+   for (auto key : known)
+      delete key; // not in the keys record, cannot happen unless the file is inconsistent
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget the key index; to be called when the keys in fKeys are about to be deleted.
+
+void TDirectoryFile::ResetKeyIndex()
+{
+   fKeyIndex.clear();
+   fKeyIndex.shrink_to_fit();
+   fKeysLoaded = kTRUE;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Read object with keyname from the current directory
@@ -1450,6 +1641,12 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 Int_t TDirectoryFile::ReadTObject(TObject *obj, const char *keyname)
 {
    if (!fFile) { Error("ReadTObject","No file open"); return 0; }
+   if (!fKeysLoaded) {
+      if (TKey *key = FindKeyInIndex(keyname, 9999, kFALSE))
+         return key->Read(obj);
+      Error("ReadTObject","Key not found");
+      return 0;
+   }
    auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
    if (!listOfKeys) {
       Error("ReadTObject", "Unexpected type of TDirectoryFile::fKeys!");
@@ -1498,6 +1695,7 @@ void TDirectoryFile::ResetAfterMerge(TFileMergeInfo *info)
    }
    // NOTE: We should check that the content is really mergeable and in
    // the in-mmeory list, before deleting the keys.
+   ResetKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -2159,6 +2357,10 @@ void TDirectoryFile::WriteKeys()
       return;
    }
 
+   // Never write an incomplete list of keys
+   if (!fKeysLoaded)
+      LoadKeys();
+
 //*-* Delete the old keys structure if it exists
    if (fSeekKeys != 0) {
       f->MakeFree(fSeekKeys, fSeekKeys + fNbytesKeys -1);
@@ -2172,16 +2374,50 @@ void TDirectoryFile::WriteKeys()
    while ((key = (TKey*)next())) {
       nbytes += key->Sizeof();
    }
+   // Directories with many keys get an index of the keys appended to the record, which lets readers
+   // look up single keys without reading all of them (see TFile.LazyKeys). Readers not knowing about
+   // the index stop after the nkeys keys and ignore it.
+   const Int_t indexThreshold = gEnv->GetValue("TFile.KeyIndexThreshold", 10000);
+   const bool writeIndex = indexThreshold > 0 && nkeys >= indexThreshold;
+   if (writeIndex)
+      nbytes += nkeys * kKeyIndexEntrySize + kKeyIndexTrailerSize;
    TKey *headerkey  = new TKey(fName,fTitle,IsA(),nbytes,this);
    if (headerkey->GetSeekKey() == 0) {
       delete headerkey;
       return;
    }
    char *buffer = headerkey->GetBuffer();
+   char *start = buffer;
+   std::vector<KeyIndexEntry> index;
+   if (writeIndex)
+      index.reserve(nkeys);
    next.Reset();
    tobuf(buffer, nkeys);
    while ((key = (TKey*)next())) {
+      char *keyStart = buffer;
       key->FillBuffer(buffer);
+      if (writeIndex) {
+         KeyIndexEntry entry;
+         entry.fHash = KeyNameHash(key->GetName());
+         entry.fOffset = headerkey->GetKeylen() + (keyStart - start);
+         entry.fKeylen = buffer - keyStart;
+         index.push_back(entry);
+      }
+   }
+   if (writeIndex) {
+      // Stable, so that keys with the same hash stay in the order of the record
+      std::stable_sort(index.begin(), index.end(),
+                       [](const KeyIndexEntry &a, const KeyIndexEntry &b) { return a.fHash < b.fHash; });
+      const Int_t indexOffset = headerkey->GetKeylen() + (buffer - start);
+      for (const auto &entry : index) {
+         tobuf(buffer, entry.fHash);
+         tobuf(buffer, entry.fOffset);
+         tobuf(buffer, entry.fKeylen);
+      }
+      buffer = start + nbytes - kKeyIndexTrailerSize;
+      tobuf(buffer, indexOffset);
+      tobuf(buffer, nkeys);
+      tobuf(buffer, kKeyIndexMagic);
    }
 
    fSeekKeys     = headerkey->GetSeekKey();
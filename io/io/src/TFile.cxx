@@ -77,6 +77,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include <sys/stat.h>
 #ifndef WIN32
 #   include <unistd.h>
+#   include <sys/mman.h>
 #else
 #   define ssize_t int
 #   include <io.h>
@@ -130,7 +131,10 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TThreadSlots.h"
 #include "TGlobal.h"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 using std::sqrt;
 
@@ -146,12 +150,27 @@ Bool_t   TFile::fgCacheFileForce = kFALSE;
 Bool_t   TFile::fgCacheFileDisconnected = kTRUE;
 UInt_t   TFile::fgOpenTimeout = TFile::kEternalTimeout;
 Bool_t   TFile::fgOnlyStaged = kFALSE;
-#ifdef R__USE_IMT
 ROOT::Internal::RConcurrentHashColl TFile::fgTsSIHashes;
-#endif
 
 const Int_t kBEGIN = 100;
 
+namespace {
+
+/// The fClassIndex slots set by each StreamerInfo record processed by TFile::ReadStreamerInfo(),
+/// keyed by the hash of the record payload (see TFile::fgTsSIHashes)
+struct RStreamerInfoRecordCache {
+   std::mutex fMutex;
+   std::map<ROOT::Internal::RConcurrentHashColl::HashValue, std::vector<Int_t>> fClassIndexSlots;
+};
+
+RStreamerInfoRecordCache &GetStreamerInfoRecordCache()
+{
+   static RStreamerInfoRecordCache cache;
+   return cache;
+}
+
+} // anonymous namespace
+
 ClassImp(TFile);
 
 //*-*x17 macros/layout_file
@@ -845,7 +864,7 @@ void TFile::Init(Bool_t create)
             }
          } else if (fVersion != gROOT->GetVersionInt() && fVersion > 30000) {
             // Don't complain about missing streamer info for empty files.
-            if (fKeys->GetSize()) {
+            if (GetNkeys()) {
                Warning("Init","no StreamerInfo found in %s therefore preventing schema evolution when reading this file."
                               " The file was produced with version %d.%02d/%02d of ROOT.",
                               GetName(),  fVersion / 10000, (fVersion / 100) % (100), fVersion  % 100);
@@ -855,7 +874,12 @@ void TFile::Init(Bool_t create)
    }
 
    // Count number of TProcessIDs in this file
-   {
+   if (!fKeysLoaded) {
+      // Don't read all keys for this: TProcessIDs are written as ProcessID0, ProcessID1, ...
+      while (GetKey(TString::Format("ProcessID%d", fNProcessIDs)))
+         fNProcessIDs++;
+      fProcessIDs = new TObjArray(fNProcessIDs+1);
+   } else {
       TIter next(fKeys);
       TKey *key;
       while ((key = (TKey*)next())) {
@@ -899,6 +923,7 @@ void TFile::Close(Option_t *option)
 
    if (fIsArchive || !fIsRootFile) {
       FlushWriteCache();
+      ReleaseMemoryMap();
       SysClose(fD);
       fD = -1;
 
@@ -954,6 +979,7 @@ void TFile::Close(Option_t *option)
    }
 
    if (IsOpen()) {
+      ReleaseMemoryMap();
       SysClose(fD);
       fD = -1;
    }
@@ -1095,6 +1121,47 @@ Bool_t TFile::FlushWriteCache()
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Map the whole file read-only into memory.
+///
+/// Afterwards, ReadBuffer() and ReadBuffers() copy from the mapping instead of
+/// issuing read system calls and GetMemoryMappedBuffer() hands out pointers into
+/// the mapping, which lets TBasket unstream and decompress baskets without first
+/// copying them to a heap buffer. The mapped pages are those of the kernel page
+/// cache, so that repeated passes over the file do not add another copy of the
+/// data to the resident memory of the process.
+///
+/// Only local files of class TFile opened in READ mode can be mapped. The mapping
+/// is released when the file is closed or reopened. TFile::Open() maps local files
+/// if the rootrc variable `TFile.MemoryMap` is set. The file must not be truncated
+/// while it is mapped.
+///
+/// Returns kTRUE if the file is mapped.
+
+Bool_t TFile::EnableMemoryMap()
+{
+#ifndef WIN32
+   if (fMemoryMap)
+      return kTRUE;
+   if (!IsOpen() || IsWritable() || IsA() != TFile::Class())
+      return kFALSE;
+
+   struct stat info;
+   if (fstat(fD, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0)
+      return kFALSE;
+   void *region = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fD, 0);
+   if (region == MAP_FAILED) {
+      SysError("EnableMemoryMap", "cannot map file %s", GetName());
+      return kFALSE;
+   }
+   fMemoryMap = static_cast<char *>(region);
+   fMemoryMapSize = info.st_size;
+   return kTRUE;
+#else
+   return kFALSE;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Encode file output buffer.
 ///
@@ -1126,6 +1193,31 @@ Int_t TFile::GetBestBuffer() const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return a pointer to the len bytes at offset pos of a memory-mapped file.
+///
+/// Returns nullptr if the file is not mapped (see EnableMemoryMap()) or if the
+/// range is outside of the mapping. The pointer stays valid until the file is
+/// closed. The access is accounted like a ReadBuffer() call.
+
+const char *TFile::GetMemoryMappedBuffer(Long64_t pos, Int_t len)
+{
+   const Long64_t offset = pos + fArchiveOffset;
+   if (!fMemoryMap || len < 0 || offset < 0 || offset + len > fMemoryMapSize)
+      return nullptr;
+
+   fBytesRead  += len;
+   fgBytesRead += len;
+   fReadCalls++;
+   fgReadCalls++;
+
+   if (gMonitoringWriter)
+      gMonitoringWriter->SendFileReadProgress(this);
+   if (gPerfStats)
+      gPerfStats->FileReadEvent(this, len, TTimeStamp());
+   return fMemoryMap + offset;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the file compression factor.
 ///
@@ -1326,7 +1418,6 @@ TFile::InfoListRet TFile::GetStreamerInfoListImpl(bool lookupSICache)
          return {nullptr, 1, hash};
       }
 
-#ifdef R__USE_IMT
       if (lookupSICache) {
          // key data must be excluded from the hash, otherwise the timestamp will
          // always lead to unique hashes for each file
@@ -1336,9 +1427,6 @@ TFile::InfoListRet TFile::GetStreamerInfoListImpl(bool lookupSICache)
             return {nullptr, 0, hash};
          }
       }
-#else
-      (void) lookupSICache;
-#endif
       key->ReadKeyBuffer(buf);
       list = dynamic_cast<TList*>(key->ReadObjWithBuffer(buffer.data()));
       if (list) list->SetOwner();
@@ -1666,6 +1754,9 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
          return kFALSE;
       }
 
+      if (fMemoryMap)
+         return ReadBufferViaMemoryMap(buf, pos, len);
+
       Seek(pos);
       ssize_t siz;
 
@@ -1763,6 +1854,14 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
       return kFALSE;
    }
 
+   if (fMemoryMap) {
+      for (Int_t j = 0, k = 0; j < nbuf; k += len[j], j++) {
+         if (ReadBufferViaMemoryMap(&buf[k], pos[j], len[j]))
+            return kTRUE;
+      }
+      return kFALSE;
+   }
+
    Int_t k = 0;
    Bool_t result = kTRUE;
    TFileCacheRead *old = fCacheRead;
@@ -1848,6 +1947,35 @@ Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Copy a buffer from the memory mapping of the file.
+/// Returns kTRUE in case of failure, like ReadBuffer().
+
+Bool_t TFile::ReadBufferViaMemoryMap(char *buf, Long64_t pos, Int_t len)
+{
+   const char *mapped = GetMemoryMappedBuffer(pos, len);
+   if (!mapped) {
+      Error("ReadBuffer", "error reading all requested bytes from file %s, %d bytes at %lld are beyond the end of file",
+            GetName(), len, pos);
+      return kTRUE;
+   }
+   memcpy(buf, mapped, len);
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the memory mapping created by EnableMemoryMap(), if any.
+
+void TFile::ReleaseMemoryMap()
+{
+#ifndef WIN32
+   if (fMemoryMap)
+      munmap(fMemoryMap, fMemoryMapSize);
+#endif
+   fMemoryMap = nullptr;
+   fMemoryMapSize = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read the FREE linked list.
 ///
@@ -2153,6 +2281,7 @@ Int_t TFile::ReOpen(Option_t *mode)
 
       // close readonly file
       if (IsOpen()) {
+         ReleaseMemoryMap();
          SysClose(fD);
          fD = -1;
       }
@@ -3537,11 +3666,18 @@ Int_t TFile::MakeProjectParProofInf(const char *pack, const char *proofinf)
 
 void TFile::ReadStreamerInfo()
 {
-   auto listRetcode = GetStreamerInfoListImpl(/*lookupSICache*/ true);  // NOLINT: silence clang-tidy warnings
+   // Files written before 5.34/19 need their base class checksums fixed up, which depends on the
+   // file version rather than on the record; don't share their records with other files.
+   Int_t version = fVersion;
+   if (version > 1000000) version -= 1000000;
+   const bool needsBaseCheckSum = version < 53419 || (59900 < version && version < 59907);
+
+   auto listRetcode = GetStreamerInfoListImpl(/*lookupSICache*/ !needsBaseCheckSum);  // NOLINT: silence clang-tidy warnings
    TList *list = listRetcode.fList;
    auto retcode = listRetcode.fReturnCode;
    if (!list) {
       if (retcode) MakeZombie();
+      else SetClassIndexFromStreamerInfoCache(listRetcode.fHash);
       return;
    }
 
@@ -3550,10 +3686,9 @@ void TFile::ReadStreamerInfo()
    if (gDebug > 0) Info("ReadStreamerInfo", "called for file %s",GetName());
 
    TStreamerInfo *info;
+   std::vector<Int_t> classIndexSlots;
 
-   Int_t version = fVersion;
-   if (version > 1000000) version -= 1000000;
-   if (version < 53419 || (59900 < version && version < 59907)) {
+   if (needsBaseCheckSum) {
       // We need to update the fCheckSum field of the TStreamerBase.
 
       // loop on all TStreamerInfo classes
@@ -3629,8 +3764,10 @@ void TFile::ReadStreamerInfo()
             Int_t uid = info->GetNumber();
             Int_t asize = fClassIndex->GetSize();
             if (uid >= asize && uid <100000) fClassIndex->Set(2*asize);
-            if (uid >= 0 && uid < fClassIndex->GetSize()) fClassIndex->fArray[uid] = 1;
-            else if (!isstl && !info->GetClass()->IsSyntheticPair()) {
+            if (uid >= 0 && uid < fClassIndex->GetSize()) {
+               fClassIndex->fArray[uid] = 1;
+               classIndexSlots.push_back(uid);
+            } else if (!isstl && !info->GetClass()->IsSyntheticPair()) {
                printf("ReadStreamerInfo, class:%s, illegal uid=%d\n",info->GetName(),uid);
             }
             if (gDebug > 0) printf(" -class: %s version: %d info read at slot %d\n",info->GetName(), info->GetClassVersion(),uid);
@@ -3642,11 +3779,38 @@ void TFile::ReadStreamerInfo()
    list->Clear();  //this will delete all TStreamerInfo objects with kCanDelete bit set
    delete list;
 
-#ifdef R__USE_IMT
-   // We are done processing the record, let future calls and other threads that it
-   // has been done.
-   fgTsSIHashes.Insert(listRetcode.fHash);
-#endif
+   if (!needsBaseCheckSum) {
+      // We are done processing the record, let future calls and other threads know that it
+      // has been done. The slots go first: a thread finding the hash must also find them.
+      {
+         auto &cache = GetStreamerInfoRecordCache();
+         std::lock_guard<std::mutex> lock(cache.fMutex);
+         cache.fClassIndexSlots.emplace(listRetcode.fHash, std::move(classIndexSlots));
+      }
+      fgTsSIHashes.Insert(listRetcode.fHash);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Mark the StreamerInfo of this file as known in fClassIndex, for a record that has already
+/// been read, checked and registered by ReadStreamerInfo() for another file.
+///
+/// This is what keeps the StreamerInfo of the skipped record in the file when it is later
+/// updated, see WriteStreamerInfo().
+
+void TFile::SetClassIndexFromStreamerInfoCache(const ROOT::Internal::RConcurrentHashColl::HashValue &hash)
+{
+   auto &cache = GetStreamerInfoRecordCache();
+   std::lock_guard<std::mutex> lock(cache.fMutex);
+   auto it = cache.fClassIndexSlots.find(hash);
+   if (it == cache.fClassIndexSlots.end())
+      return;
+   for (auto uid : it->second) {
+      while (uid >= fClassIndex->GetSize())
+         fClassIndex->Set(2 * fClassIndex->GetSize());
+      fClassIndex->fArray[uid] = 1;
+   }
+   fClassIndex->fArray[0] = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4223,6 +4387,16 @@ TFile *TFile::Open(const char *url, Option_t *options, const char *ftitle,
    if (type != kLocal && type != kFile &&
        f && f->IsWritable() && !f->IsRaw()) {
       new TFileCacheWrite(f, 1);
+   } else if (f && f->IsWritable() && !f->IsRaw() && f->IsA() == TFile::Class()) {
+      // For local (or mounted network) files, optionally hand the writes over to a
+      // background thread with at most TFile.WriteBehind buffers of 4 MB in flight.
+      Int_t writeBehind = gEnv->GetValue("TFile.WriteBehind", 0);
+      if (writeBehind > 0)
+         new TFileCacheWrite(f, 4 * 1024 * 1024, writeBehind);
+   } else if (f && !f->IsWritable() && !f->IsRaw() && f->IsA() == TFile::Class() &&
+              gEnv->GetValue("TFile.MemoryMap", 0)) {
+      // Local read-only files can be served from a memory mapping instead of read system calls
+      f->EnableMemoryMap();
    }
 
    return f;
@@ -551,6 +551,7 @@ void TFileCacheRead::SetFile(TFile *file, TFile::ECacheAction action)
       if (file && file->ReadBufferAsync(0, 0)) {
          fAsyncReading = kFALSE;
          fBuffer       = new char[fBufferSize];
+         AccountBuffer();
       }
    }
 
@@ -598,6 +599,7 @@ void TFileCacheRead::Sort()
       // it means that we are using sync primitives, hence we need the local buffer
       if (!fAsyncReading)
          fBuffer = new char[fBufferSize];
+      AccountBuffer();
    }
    fPos[0]  = fSeekSort[0];
    fLen[0]  = fSeekSortLen[0];
@@ -656,6 +658,7 @@ void TFileCacheRead::SecondSort()
       // it means that we are using sync primitives, hence we need the local buffer
       if (!fAsyncReading)
          fBuffer = new char[fBufferSize];
+      AccountBuffer();
    }
    fBPos[0]  = fBSeekSort[0];
    fBLen[0]  = fBSeekSortLen[0];
@@ -749,6 +752,7 @@ Int_t TFileCacheRead::SetBufferSize(Int_t buffersize)
    fBuffer = np;
    fBufferSizeMin = buffersize;
    fBufferSize = buffersize;
+   AccountBuffer();
 
    if (inval) {
       return 1;
@@ -812,6 +816,7 @@ void TFileCacheRead::SetEnablePrefetchingImpl(Bool_t setPrefetching)
       if (!fAsyncReading && fBuffer == 0) {
          // we use sync primitives, hence we need the local buffer
          fBuffer = new char[fBufferSize];
+         AccountBuffer();
       }
    }
 }
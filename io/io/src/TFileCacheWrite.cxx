@@ -23,14 +23,171 @@ TXNetFile and TWebFile (via TFile::WriteBuffers()).
 
 The write cache is automatically created when writing a remote file
 (created in TFile::Open()).
+
+In write-behind mode (`nInFlight > 0` in the constructor, or the rootrc
+variable `TFile.WriteBehind` for the files created by TFile::Open()) a full
+buffer is handed to a background thread and the cache continues with a free
+one, so that the writing thread does not wait for the file system (e.g.
+network file systems such as EOS mounted via FUSE or Lustre). At most
+`nInFlight` buffers are queued; beyond that the writer waits. Flush(), and
+thus TFile::Flush() and TFile::Close(), wait for all the queued buffers to
+be written. Write-behind requires a plain (POSIX) TFile; for other file
+classes the cache stays synchronous.
 */
 
 
 #include "TFile.h"
 #include "TFileCacheWrite.h"
 
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef R__WIN32
+#include <unistd.h>
+#endif
+
 ClassImp(TFileCacheWrite);
 
+namespace ROOT {
+namespace Internal {
+
+/// Queue of buffers written to a file descriptor by a background thread, in submission order.
+/// The thread writes through its own duplicate of the descriptor with pwrite(), so that it
+/// neither moves the file offset used by TFile nor outlives the TFile descriptor.
+class RFileWriteBehind {
+   struct RBlock {
+      char *fBuffer;
+      Long64_t fPos;
+      Int_t fLen;
+   };
+
+   int fFd;                              ///< Duplicate of the TFile descriptor
+   Int_t fBufferSize;                    ///< Size of each buffer
+   std::size_t fMaxInFlight;             ///< Maximum number of queued buffers
+   std::mutex fMutex;
+   std::condition_variable fCondition;   ///< Signals both new work and completed writes
+   std::deque<RBlock> fQueue;            ///< Buffers to write, the front one is being written
+   std::vector<char *> fFree;            ///< Written buffers, ready for reuse
+   int fErrno = 0;                       ///< First error of the background writes
+   bool fStop = false;
+   std::thread fThread;
+
+   void Run()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      while (true) {
+         fCondition.wait(lock, [this] { return fStop || !fQueue.empty(); });
+         if (fQueue.empty())
+            return;
+         const RBlock block = fQueue.front();
+         lock.unlock();
+         int err = 0;
+         for (Int_t done = 0; done < block.fLen;) {
+            ssize_t siz = pwrite(fFd, block.fBuffer + done, block.fLen - done, block.fPos + done);
+            if (siz < 0 && errno == EINTR)
+               continue;
+            if (siz <= 0) {
+               err = siz < 0 ? errno : EIO;
+               break;
+            }
+            done += siz;
+         }
+         lock.lock();
+         if (err && !fErrno)
+            fErrno = err;
+         fFree.push_back(block.fBuffer);
+         fQueue.pop_front();
+         fCondition.notify_all();
+      }
+   }
+
+public:
+   RFileWriteBehind(int fd, Int_t bufferSize, Int_t maxInFlight)
+      : fFd(dup(fd)), fBufferSize(bufferSize), fMaxInFlight(maxInFlight)
+   {
+      if (fFd >= 0)
+         fThread = std::thread(&RFileWriteBehind::Run, this);
+   }
+
+   ~RFileWriteBehind()
+   {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fStop = true;
+      }
+      fCondition.notify_all();
+      if (fThread.joinable())
+         fThread.join();
+      for (char *buffer : fFree)
+         delete[] buffer;
+      if (fFd >= 0)
+         close(fFd);
+   }
+
+   bool IsValid() const { return fFd >= 0; }
+   Int_t GetMaxInFlight() const { return fMaxInFlight; }
+
+   /// Queue `len` bytes of `buffer` (which must have been allocated with new[] and fBufferSize bytes)
+   /// to be written at the absolute position `pos`; returns a free buffer to continue with.
+   char *Submit(char *buffer, Long64_t pos, Int_t len)
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCondition.wait(lock, [this] { return fQueue.size() < fMaxInFlight; });
+      fQueue.push_back({buffer, pos, len});
+      char *next;
+      if (fFree.empty()) {
+         next = new char[fBufferSize];
+      } else {
+         next = fFree.back();
+         fFree.pop_back();
+      }
+      lock.unlock();
+      fCondition.notify_all();
+      return next;
+   }
+
+   /// Wait until all the queued buffers are written; returns the first error (errno value), 0 if none.
+   int Wait()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fCondition.wait(lock, [this] { return fQueue.empty(); });
+      return fErrno;
+   }
+
+   int GetError()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      return fErrno;
+   }
+
+   /// Copy [pos, pos+len) from a queued buffer; returns 0 on success. If the range is only partly
+   /// queued, wait for the queue to be written and return -1 so that the caller reads the file.
+   Int_t ReadBuffer(char *buf, Long64_t pos, Int_t len)
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      bool overlap = false;
+      for (const RBlock &block : fQueue) {
+         if (pos >= block.fPos && pos + len <= block.fPos + block.fLen) {
+            memcpy(buf, block.fBuffer + (pos - block.fPos), len);
+            return 0;
+         }
+         if (pos < block.fPos + block.fLen && block.fPos < pos + len)
+            overlap = true;
+      }
+      if (overlap)
+         fCondition.wait(lock, [this] { return fQueue.empty(); });
+      return -1;
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
@@ -48,9 +205,11 @@ TFileCacheWrite::TFileCacheWrite() : TObject()
 /// Creates a TFileCacheWrite data structure.
 /// The write cache will be connected to file.
 /// The size of the cache will be buffersize,
-/// if buffersize < 10000 a default size of 512 Kbytes is used
+/// if buffersize < 10000 a default size of 512 Kbytes is used.
+/// If nInFlight > 0 the cache works in write-behind mode, with at most
+/// nInFlight full buffers queued for the background thread.
 
-TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
+TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize, Int_t nInFlight)
            : TObject()
 {
    if (buffersize < 10000) buffersize = 512000;
@@ -61,7 +220,9 @@ TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
    fRecursive   = kFALSE;
    fBuffer      = new char[fBufferSize];
    if (file) file->SetCacheWrite(this);
-   if (gDebug > 0) Info("TFileCacheWrite","Creating a write cache with buffersize=%d bytes",buffersize);
+   InitWriteBehind(nInFlight);
+   if (gDebug > 0) Info("TFileCacheWrite","Creating a write cache with buffersize=%d bytes%s",buffersize,
+                        fWriteBehind ? " in write-behind mode" : "");
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -69,15 +230,45 @@ TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
 
 TFileCacheWrite::~TFileCacheWrite()
 {
+   // Destroying the background writer waits for the queued buffers.
+   fWriteBehind.reset();
    delete [] fBuffer;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Start the background writer if nInFlight > 0 and the file supports it.
+
+void TFileCacheWrite::InitWriteBehind(Int_t nInFlight)
+{
+   fWriteBehind.reset();
+#ifndef R__WIN32
+   // Other file classes do not write through TFile::SysWrite on fD.
+   if (nInFlight <= 0 || !fFile || fFile->IsA() != TFile::Class() || fFile->GetFd() < 0)
+      return;
+   fWriteBehind.reset(new ROOT::Internal::RFileWriteBehind(fFile->GetFd(), fBufferSize, nInFlight));
+   if (!fWriteBehind->IsValid())
+      fWriteBehind.reset();
+#else
+   (void)nInFlight;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Flush the current write buffer to the file.
+/// In write-behind mode, also wait for all the queued buffers to be written.
 /// Returns kTRUE in case of error.
 
 Bool_t TFileCacheWrite::Flush()
 {
+   if (fWriteBehind) {
+      Bool_t status = FlushBuffer();
+      if (int err = fWriteBehind->Wait()) {
+         if (!status)
+            Error("Flush", "error writing to file %s in the background: %s", fFile->GetName(), strerror(err));
+         status = kTRUE;
+      }
+      return status;
+   }
    if (!fNtot) return kFALSE;
    fFile->Seek(fSeekStart);
    //printf("Flushing buffer at fSeekStart=%lld, fNtot=%d\n",fSeekStart,fNtot);
@@ -88,6 +279,27 @@ Bool_t TFileCacheWrite::Flush()
    return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Flush the current write buffer, without waiting for it to be written in
+/// write-behind mode. Returns kTRUE in case of error.
+
+Bool_t TFileCacheWrite::FlushBuffer()
+{
+   if (!fWriteBehind)
+      return Flush();
+   if (int err = fWriteBehind->GetError()) {
+      Error("Flush", "error writing to file %s in the background: %s", fFile->GetName(), strerror(err));
+      return kTRUE;
+   }
+   if (!fNtot) return kFALSE;
+   // Account for the bytes now, as TFile::WriteBuffer would.
+   fFile->fBytesWrite += fNtot;
+   TFile::fgBytesWrite += fNtot;
+   fBuffer = fWriteBehind->Submit(fBuffer, fSeekStart + fFile->fArchiveOffset, fNtot);
+   fNtot = 0;
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print class internal structure.
 
@@ -95,7 +307,8 @@ void TFileCacheWrite::Print(Option_t *option) const
 {
    TString opt = option;
    printf("Write cache for file %s\n",fFile->GetName());
-   printf("Size of write cache: %d bytes to be written at %lld\n",fNtot,fSeekStart);
+   printf("Size of write cache: %d bytes to be written at %lld%s\n",fNtot,fSeekStart,
+          fWriteBehind ? " (write-behind)" : "");
    opt.ToLower();
 }
 
@@ -107,7 +320,10 @@ void TFileCacheWrite::Print(Option_t *option) const
 
 Int_t TFileCacheWrite::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 {
-   if (pos < fSeekStart || pos+len > fSeekStart+fNtot) return -1;
+   if (pos < fSeekStart || pos+len > fSeekStart+fNtot) {
+      // The data might still be queued for the background writer.
+      return fWriteBehind ? fWriteBehind->ReadBuffer(buf, pos + fFile->fArchiveOffset, len) : -1;
+   }
    memcpy(buf,fBuffer+pos-fSeekStart,len);
    return 0;
 }
@@ -126,12 +342,14 @@ Int_t TFileCacheWrite::WriteBuffer(const char *buf, Long64_t pos, Int_t len)
 
    if (fSeekStart + fNtot != pos) {
       //we must flush the current cache
-      if (Flush()) return -1; //failure
+      if (FlushBuffer()) return -1; //failure
    }
    if (fNtot + len >= fBufferSize) {
-      if (Flush()) return -1; //failure
+      if (FlushBuffer()) return -1; //failure
       if (len >= fBufferSize) {
-         //buffer larger than the cache itself: direct write to file
+         //buffer larger than the cache itself: direct write to file,
+         //after the queued buffers in case they overlap
+         if (fWriteBehind && Flush()) return -1;
          fRecursive = kTRUE;
          fFile->Seek(pos); // Flush may have changed this
          if (fFile->WriteBuffer(buf,len)) return -1;  // failure
@@ -148,9 +366,17 @@ Int_t TFileCacheWrite::WriteBuffer(const char *buf, Long64_t pos, Int_t len)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the file using this cache.
-/// Any write not yet flushed will be lost.
+/// Any write not yet flushed will be lost; in write-behind mode the queued
+/// buffers are still written to the previous file.
 
 void TFileCacheWrite::SetFile(TFile *file)
 {
+   if (fWriteBehind) {
+      const Int_t nInFlight = fWriteBehind->GetMaxInFlight();
+      fWriteBehind.reset();
+      fFile = file;
+      InitWriteBehind(nInFlight);
+      return;
+   }
    fFile = file;
 }
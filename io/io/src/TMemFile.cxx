@@ -174,6 +174,37 @@ TMemFile::TMemFile(const char *path, char *buffer, Long64_t size, Option_t *opti
 {
    fDefaultBlockSize = defBlockSize == 0LL ? fgDefaultBlockSize : defBlockSize;
 
+   OpenImpl(path, option, buffer, size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor taking ownership of a buffer allocated with `new char[]`.
+///
+/// Contrary to the constructor taking a `char *`, the content is not copied:
+/// the buffer becomes the first block of the file and is deleted with it. With
+/// the "UPDATE" option the file can be extended; the additional blocks are
+/// allocated with a size of defBlockSize. With "CREATE" or "RECREATE" the
+/// content is discarded but the memory is used for the new file.
+
+TMemFile::TMemFile(const char *path, std::unique_ptr<char[]> buffer, Long64_t size, Option_t *option,
+                   const char *ftitle, Int_t compress, Long64_t defBlockSize)
+   : TFile(path, "WEB", ftitle, compress), fBlockList(reinterpret_cast<UChar_t *>(buffer.get()), buffer ? size : 0),
+     fIsOwnedByROOT(kTRUE), fSize(buffer ? size : 0), fBlockSeek(&(fBlockList))
+{
+   // TMemBlock now owns the memory and releases it with "delete []".
+   buffer.release();
+
+   fDefaultBlockSize = defBlockSize == 0LL ? fgDefaultBlockSize : defBlockSize;
+
+   OpenImpl(path, option, nullptr, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Open the file according to option, copy buffer (if any) at the beginning
+/// of the file and initialize the TFile part.
+
+void TMemFile::OpenImpl(const char *path, Option_t *option, const char *buffer, Long64_t size)
+{
    EMode optmode = ParseOption(option);
 
    if (NeedsToWrite(optmode)) {
@@ -321,6 +352,75 @@ void TMemFile::ResetAfterMerge(TFileMergeInfo *info)
 {
    ResetObjects(this,info);
 
+   ResetBookkeeping();
+
+   {
+      TDirectory::TContext ctxt(this);
+      Init(kTRUE);
+
+      // And now we need re-initilize the directories ...
+
+      TIter   next(this->GetList());
+      TObject *idcur;
+      while ((idcur = next())) {
+         if (idcur->IsA() == TDirectoryFile::Class()) {
+            ((TDirectoryFile*)idcur)->ResetAfterMerge(info);
+         }
+      }
+
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Discard the content of the file, objects in memory included, and start over
+/// on the already allocated blocks.
+///
+/// If buffer is null the file becomes a new, empty and writable file, as if
+/// re-opened with "RECREATE". Otherwise the size bytes at buffer are copied in
+/// place of the previous content (the blocks are extended only if buffer does
+/// not fit) and read back as an existing file, keeping the current access mode.
+/// This is much cheaper than deleting the TMemFile and constructing a new one
+/// for each chunk of data.
+
+void TMemFile::ResetForReuse(const char *buffer, Long64_t size)
+{
+   if (IsExternalData()) {
+      Error("ResetForReuse", "the memory of %s is not owned by the TMemFile and can not be reused", GetName());
+      return;
+   }
+
+   {
+      TDirectory::TContext ctxt(this);
+      // Objects and keys of the previous content are dropped without being written.
+      fList->Delete("slow");
+      ResetKeyIndex();
+      fKeys->Delete("slow");
+      CleanTargets();
+   }
+
+   ResetBookkeeping();
+
+   if (buffer) {
+      fOption = fWritable ? "UPDATE" : "READ";
+      SysWriteImpl(fD, buffer, size);
+      fSysOffset   = 0;
+      fBlockSeek   = &fBlockList;
+      fBlockOffset = 0;
+   } else {
+      fOption = "RECREATE";
+      fWritable = kTRUE;
+   }
+
+   TDirectory::TContext ctxt(this);
+   Init(/* create */ buffer == nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reset the bookkeeping of the TFile and the seek position, keeping the
+/// memory blocks, in preparation of a call to Init().
+
+void TMemFile::ResetBookkeeping()
+{
    fNbytesKeys = 0;
    fSeekKeys = 0;
 
@@ -349,11 +449,6 @@ void TMemFile::ResetAfterMerge(TFileMergeInfo *info)
    fCacheRead    = 0;
    fCacheWrite   = 0;
    fReadCalls    = 0;
-   if (fFree) {
-      fFree->Delete();
-      delete fFree;
-      fFree = nullptr;
-   }
 
    fSysOffset   = 0;
    fBlockSeek   = &fBlockList;
@@ -362,22 +457,6 @@ void TMemFile::ResetAfterMerge(TFileMergeInfo *info)
       R__LOCKGUARD(gROOTMutex);
       gROOT->GetListOfFiles()->Remove(this);
    }
-
-   {
-      TDirectory::TContext ctxt(this);
-      Init(kTRUE);
-
-      // And now we need re-initilize the directories ...
-
-      TIter   next(this->GetList());
-      TObject *idcur;
-      while ((idcur = next())) {
-         if (idcur->IsA() == TDirectoryFile::Class()) {
-            ((TDirectoryFile*)idcur)->ResetAfterMerge(info);
-         }
-      }
-
-   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -77,6 +77,7 @@ element type.
 
 #include <memory>
 #include <array>
+#include <unordered_map>
 
 std::atomic<Int_t> TStreamerInfo::fgCount{0};
 
@@ -255,6 +256,60 @@ namespace {
 
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the offset of a data member of cl from the TRealData in realData.
+/// Only the TRealData describing dm itself are relevant; realData may be the
+/// whole list of real data of the class or only those.
+
+template <typename RealDataRange>
+Int_t GetDataMemberOffsetImpl(TClass *cl, TDataMember *dm, const RealDataRange &realData, TMemberStreamer *&streamer)
+{
+   char dmbracket[256];
+   snprintf(dmbracket,255,"%s[",dm->GetName());
+   Int_t offset = TStreamerInfo::kMissing;
+   if (!cl->IsLoaded()) {
+      // If the 'class' is not loaded, we do not have a TClass bootstrap and thus
+      // the 'RealData' might not have enough information because of the lack
+      // of proper ShowMember implementation.
+      if (! (dm->Property() & kIsStatic) ) {
+         // Give an offset only to non-static members.
+         offset = dm->GetOffset();
+      }
+   }
+   for (auto obj : realData) {
+      TRealData *rdm = static_cast<TRealData*>(obj);
+      if (rdm->GetDataMember() != dm) continue;
+
+      char *rdmc = (char*)rdm->GetName();
+      //next statement required in case a class and one of its parent class
+      //have data members with the same name
+      if (dm->IsaPointer() && rdmc[0] == '*') rdmc++;
+
+      if (strcmp(rdmc,dm->GetName()) == 0) {
+         offset   = rdm->GetThisOffset();
+         streamer = rdm->GetStreamer();
+         break;
+      }
+      if (strcmp(rdm->GetName(),dm->GetName()) == 0) {
+         if (rdm->IsObject()) {
+            offset = rdm->GetThisOffset();
+            streamer = rdm->GetStreamer();
+            break;
+         }
+      }
+      if (strstr(rdm->GetName(),dmbracket)) {
+         offset   = rdm->GetThisOffset();
+         streamer = rdm->GetStreamer();
+         break;
+      }
+   }
+   return offset;
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Build the I/O data structure for the current class version.
 ///
@@ -403,6 +458,19 @@ void TStreamerInfo::Build(Bool_t isTransient)
    TDataMember* dm = 0;
    std::string typeNameBuf;
    std::string trueTypeNameBuf;
+
+   // Group the real data by data member once, instead of scanning the whole
+   // list of real data for each data member. For classes set up from their
+   // TProtoClass, this is all the layout information Build needs.
+   std::unordered_map<const TDataMember*, std::vector<TRealData*>> realDataOfMember;
+   if (fClass->GetListOfRealData()) {
+      for (auto obj : *fClass->GetListOfRealData()) {
+         TRealData *rd = static_cast<TRealData*>(obj);
+         realDataOfMember[rd->GetDataMember()].push_back(rd);
+      }
+   }
+   const std::vector<TRealData*> noRealData;
+
    TIter nextd(fClass->GetListOfDataMembers());
    while ((dm = (TDataMember*) nextd())) {
       if (fClass->GetClassVersion() == 0) {
@@ -415,7 +483,10 @@ void TStreamerInfo::Build(Bool_t isTransient)
          continue;
       }
       TMemberStreamer* streamer = 0;
-      Int_t offset = GetDataMemberOffset(dm, streamer);
+      auto iterRealData = realDataOfMember.find(dm);
+      Int_t offset = GetDataMemberOffsetImpl(fClass, dm,
+                                             iterRealData != realDataOfMember.end() ? iterRealData->second : noRealData,
+                                             streamer);
       if (offset == kMissing) {
          continue;
       }
@@ -2632,11 +2703,17 @@ void TStreamerInfo::Clear(Option_t *option)
          element->SetOffset(0);
       }
 
-      if (fReadObjectWise) fReadObjectWise->fActions.clear();
+      if (fReadObjectWise) {
+         fReadObjectWise->fActions.clear();
+         fReadObjectWise->fFusedActions.clear();
+      }
       if (fReadMemberWise) fReadMemberWise->fActions.clear();
       if (fReadMemberWiseVecPtr) fReadMemberWiseVecPtr->fActions.clear();
       if (fReadText) fReadText->fActions.clear();
-      if (fWriteObjectWise) fWriteObjectWise->fActions.clear();
+      if (fWriteObjectWise) {
+         fWriteObjectWise->fActions.clear();
+         fWriteObjectWise->fFusedActions.clear();
+      }
       if (fWriteMemberWise) fWriteMemberWise->fActions.clear();
       if (fWriteMemberWiseVecPtr) fWriteMemberWiseVecPtr->fActions.clear();
       if (fWriteText) fWriteText->fActions.clear();
@@ -4122,46 +4199,9 @@ Int_t TStreamerInfo::GenerateHeaderFile(const char *dirname, const TList *subCla
 
 Int_t TStreamerInfo::GetDataMemberOffset(TDataMember *dm, TMemberStreamer *&streamer) const
 {
-   TIter nextr(fClass->GetListOfRealData());
-   char dmbracket[256];
-   snprintf(dmbracket,255,"%s[",dm->GetName());
-   Int_t offset = kMissing;
-   if (!fClass->IsLoaded()) {
-      // If the 'class' is not loaded, we do not have a TClass bootstrap and thus
-      // the 'RealData' might not have enough information because of the lack
-      // of proper ShowMember implementation.
-      if (! (dm->Property() & kIsStatic) ) {
-         // Give an offset only to non-static members.
-         offset = dm->GetOffset();
-      }
-   }
-   TRealData *rdm;
-   while ((rdm = (TRealData*)nextr())) {
-      char *rdmc = (char*)rdm->GetName();
-      //next statement required in case a class and one of its parent class
-      //have data members with the same name
-      if (dm->IsaPointer() && rdmc[0] == '*') rdmc++;
-
-      if (rdm->GetDataMember() != dm) continue;
-      if (strcmp(rdmc,dm->GetName()) == 0) {
-         offset   = rdm->GetThisOffset();
-         streamer = rdm->GetStreamer();
-         break;
-      }
-      if (strcmp(rdm->GetName(),dm->GetName()) == 0) {
-         if (rdm->IsObject()) {
-            offset = rdm->GetThisOffset();
-            streamer = rdm->GetStreamer();
-            break;
-         }
-      }
-      if (strstr(rdm->GetName(),dmbracket)) {
-         offset   = rdm->GetThisOffset();
-         streamer = rdm->GetStreamer();
-         break;
-      }
-   }
-   return offset;
+   if (!fClass->GetListOfRealData())
+      return GetDataMemberOffsetImpl(fClass, dm, std::vector<TRealData*>{}, streamer);
+   return GetDataMemberOffsetImpl(fClass, dm, *fClass->GetListOfRealData(), streamer);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,9 @@
 #include "TVirtualCollectionIterators.h"
 #include "TProcessID.h"
 #include "TFile.h"
+#include "TEnv.h"
+
+#include <typeinfo>
 
 static const Int_t kRegrouped = TStreamerInfo::kOffsetL;
 
@@ -254,6 +257,130 @@ namespace TStreamerInfoActions
       return 0;
    }
 
+   /// Configuration of a run of consecutive data members of basic type (or fixed size arrays thereof)
+   /// that is streamed by a single action, see TActionSequence::FuseBasicTypeActions.
+   class TBasicTypeRunConfiguration : public TConfiguration {
+   public:
+      struct TMember {
+         Int_t  fOffset; ///< Offset of the data member within the object
+         Int_t  fType;   ///< Basic type (TStreamerInfo::kInt, ...); the data member is an array when fLength > 1
+         UInt_t fLength; ///< Number of elements
+      };
+      std::vector<TMember> fMembers;
+      Int_t                fNbytes = 0; ///< Number of bytes taken by the run in the buffer
+
+      TBasicTypeRunConfiguration(TVirtualStreamerInfo *info, UInt_t id, TCompInfo_t *compinfo)
+         : TConfiguration(info, id, compinfo, 0) {}
+
+      void AddToOffset(Int_t delta) override
+      {
+         for (auto &member : fMembers)
+            if (member.fOffset != TVirtualStreamerInfo::kMissing)
+               member.fOffset += delta;
+      }
+
+      TConfiguration *Copy() override { return new TBasicTypeRunConfiguration(*this); }
+
+      void Print() const override
+      {
+         printf("StreamerInfoAction, class:%s, run of %d basic type members starting at elemnId=%d (%d bytes)\n",
+                fInfo->GetClass()->GetName(), (Int_t)fMembers.size(), fElemId, fNbytes);
+      }
+   };
+
+   /// Size in the buffer of the basic types that FuseBasicTypeActions knows how to stream directly.
+   static Int_t GetFusedBasicTypeSize(Int_t type)
+   {
+      switch (type) {
+         case TStreamerInfo::kBool:
+         case TStreamerInfo::kChar:
+         case TStreamerInfo::kUChar:   return 1;
+         case TStreamerInfo::kShort:
+         case TStreamerInfo::kUShort:  return 2;
+         case TStreamerInfo::kInt:
+         case TStreamerInfo::kUInt:
+         case TStreamerInfo::kFloat:   return 4;
+         case TStreamerInfo::kLong64:
+         case TStreamerInfo::kULong64:
+         case TStreamerInfo::kDouble:  return 8;
+         // Long_t has a file version dependent representation, kBits, kCounter, Float16_t and
+         // Double32_t need extra processing: they keep their own action.
+         default:                      return 0;
+      }
+   }
+
+   template <typename T>
+   static inline void ReadFusedMember(char *&cur, void *where, UInt_t n)
+   {
+      T *x = (T *)where;
+      for (UInt_t i = 0; i < n; ++i)
+         frombuf(cur, x + i);
+   }
+
+   template <typename T>
+   static inline void WriteFusedMember(char *&cur, const void *where, UInt_t n)
+   {
+      const T *x = (const T *)where;
+      for (UInt_t i = 0; i < n; ++i)
+         tobuf(cur, x[i]);
+   }
+
+   /// Read a run of basic type data members straight from the buffer, bypassing the virtual
+   /// TBuffer::ReadInt and co. Only used by TBufferFile, see TBufferFile::ApplySequence.
+   Int_t ReadBasicTypeRun(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      const TBasicTypeRunConfiguration *conf = (const TBasicTypeRunConfiguration *)config;
+      char *obj = (char *)addr;
+      char *cur = buf.GetCurrent();
+      for (const auto &member : conf->fMembers) {
+         char *where = obj + member.fOffset;
+         switch (member.fType) {
+            case TStreamerInfo::kBool:    ReadFusedMember<Bool_t>(cur, where, member.fLength);    break;
+            case TStreamerInfo::kChar:    ReadFusedMember<Char_t>(cur, where, member.fLength);    break;
+            case TStreamerInfo::kUChar:   ReadFusedMember<UChar_t>(cur, where, member.fLength);   break;
+            case TStreamerInfo::kShort:   ReadFusedMember<Short_t>(cur, where, member.fLength);   break;
+            case TStreamerInfo::kUShort:  ReadFusedMember<UShort_t>(cur, where, member.fLength);  break;
+            case TStreamerInfo::kInt:     ReadFusedMember<Int_t>(cur, where, member.fLength);     break;
+            case TStreamerInfo::kUInt:    ReadFusedMember<UInt_t>(cur, where, member.fLength);    break;
+            case TStreamerInfo::kFloat:   ReadFusedMember<Float_t>(cur, where, member.fLength);   break;
+            case TStreamerInfo::kLong64:  ReadFusedMember<Long64_t>(cur, where, member.fLength);  break;
+            case TStreamerInfo::kULong64: ReadFusedMember<ULong64_t>(cur, where, member.fLength); break;
+            case TStreamerInfo::kDouble:  ReadFusedMember<Double_t>(cur, where, member.fLength);  break;
+         }
+      }
+      buf.SetBufferOffset(cur - buf.Buffer());
+      return 0;
+   }
+
+   /// Write a run of basic type data members straight into the buffer, bypassing the virtual
+   /// TBuffer::WriteInt and co. Only used by TBufferFile, see TBufferFile::ApplySequence.
+   Int_t WriteBasicTypeRun(TBuffer &buf, void *addr, const TConfiguration *config)
+   {
+      const TBasicTypeRunConfiguration *conf = (const TBasicTypeRunConfiguration *)config;
+      if (buf.Length() + conf->fNbytes > buf.BufferSize())
+         buf.AutoExpand(buf.BufferSize() + conf->fNbytes);
+      const char *obj = (const char *)addr;
+      char *cur = buf.GetCurrent();
+      for (const auto &member : conf->fMembers) {
+         const char *where = obj + member.fOffset;
+         switch (member.fType) {
+            case TStreamerInfo::kBool:    WriteFusedMember<Bool_t>(cur, where, member.fLength);    break;
+            case TStreamerInfo::kChar:    WriteFusedMember<Char_t>(cur, where, member.fLength);    break;
+            case TStreamerInfo::kUChar:   WriteFusedMember<UChar_t>(cur, where, member.fLength);   break;
+            case TStreamerInfo::kShort:   WriteFusedMember<Short_t>(cur, where, member.fLength);   break;
+            case TStreamerInfo::kUShort:  WriteFusedMember<UShort_t>(cur, where, member.fLength);  break;
+            case TStreamerInfo::kInt:     WriteFusedMember<Int_t>(cur, where, member.fLength);     break;
+            case TStreamerInfo::kUInt:    WriteFusedMember<UInt_t>(cur, where, member.fLength);    break;
+            case TStreamerInfo::kFloat:   WriteFusedMember<Float_t>(cur, where, member.fLength);   break;
+            case TStreamerInfo::kLong64:  WriteFusedMember<Long64_t>(cur, where, member.fLength);  break;
+            case TStreamerInfo::kULong64: WriteFusedMember<ULong64_t>(cur, where, member.fLength); break;
+            case TStreamerInfo::kDouble:  WriteFusedMember<Double_t>(cur, where, member.fLength);  break;
+         }
+      }
+      buf.SetBufferOffset(cur - buf.Buffer());
+      return 0;
+   }
+
    INLINE_TEMPLATE_ARGS Int_t WriteTextTNamed(TBuffer &buf, void *addr, const TConfiguration *config)
    {
       void *x = (void *)(((char *)addr) + config->fOffset);
@@ -3034,11 +3161,15 @@ void TStreamerInfo::Compile()
    Int_t ndata = fElements->GetEntriesFast();
 
 
-   if (fReadObjectWise) fReadObjectWise->fActions.clear();
-   else fReadObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
+   if (fReadObjectWise) {
+      fReadObjectWise->fActions.clear();
+      fReadObjectWise->fFusedActions.clear();
+   } else fReadObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
 
-   if (fWriteObjectWise) fWriteObjectWise->fActions.clear();
-   else fWriteObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
+   if (fWriteObjectWise) {
+      fWriteObjectWise->fActions.clear();
+      fWriteObjectWise->fFusedActions.clear();
+   } else fWriteObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
 
    if (fReadMemberWise) fReadMemberWise->fActions.clear();
    else fReadMemberWise = new TStreamerInfoActions::TActionSequence(this,ndata);
@@ -3231,6 +3362,10 @@ void TStreamerInfo::Compile()
       AddReadTextAction(fReadText, i, fCompFull[i]);
       AddWriteTextAction(fWriteText, i, fCompFull[i]);
    }
+   if (TStreamerInfoActions::TActionSequence::IsFuseBasicTypesEnabled()) {
+      fReadObjectWise->FuseBasicTypeActions();
+      fWriteObjectWise->FuseBasicTypeActions();
+   }
    ComputeSize();
 
    fOptimized = isOptimized;
@@ -4191,15 +4326,17 @@ void TStreamerInfoActions::TActionSequence::AddToOffset(Int_t delta)
    // Add the (potentially negative) delta to all the configuration's offset.  This is used by
    // TBranchElement in the case of split sub-object.
 
-   TStreamerInfoActions::ActionContainer_t::iterator end = fActions.end();
-   for(TStreamerInfoActions::ActionContainer_t::iterator iter = fActions.begin();
-       iter != end;
-       ++iter)
-   {
-      // (fElemId == -1) indications that the action is a Push or Pop DataCache.
-      if (iter->fConfiguration->fElemId != (UInt_t)-1 &&
-          !iter->fConfiguration->fInfo->GetElements()->At(iter->fConfiguration->fElemId)->TestBit(TStreamerElement::kCache))
-         iter->fConfiguration->AddToOffset(delta);
+   for (ActionContainer_t *actions : {&fActions, &fFusedActions}) {
+      TStreamerInfoActions::ActionContainer_t::iterator end = actions->end();
+      for(TStreamerInfoActions::ActionContainer_t::iterator iter = actions->begin();
+          iter != end;
+          ++iter)
+      {
+         // (fElemId == -1) indications that the action is a Push or Pop DataCache.
+         if (iter->fConfiguration->fElemId != (UInt_t)-1 &&
+             !iter->fConfiguration->fInfo->GetElements()->At(iter->fConfiguration->fElemId)->TestBit(TStreamerElement::kCache))
+            iter->fConfiguration->AddToOffset(delta);
+      }
    }
 }
 
@@ -4216,6 +4353,131 @@ void TStreamerInfoActions::TActionSequence::SetMissing()
       if (!iter->fConfiguration->fInfo->GetElements()->At(iter->fConfiguration->fElemId)->TestBit(TStreamerElement::kCache))
          iter->fConfiguration->SetMissing();
    }
+   // The fused actions cannot skip members, fall back to the per member actions.
+   fFusedActions.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the object-wise action sequences should stream runs of consecutive
+/// data members of basic type with a single action (see FuseBasicTypeActions).
+/// Controlled by the rootrc option `TStreamerInfo.FuseBasicTypes` (default: no).
+
+Bool_t TStreamerInfoActions::TActionSequence::IsFuseBasicTypesEnabled()
+{
+   static const Bool_t enabled = gEnv->GetValue("TStreamerInfo.FuseBasicTypes", 0) != 0;
+   return enabled;
+}
+
+namespace TStreamerInfoActions {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true and fill member if action streams a single data member of basic type or
+/// a fixed size array of basic type that ReadBasicTypeRun/WriteBasicTypeRun can handle.
+
+static Bool_t GetFusableMember(const TConfiguredAction &action, TBasicTypeRunConfiguration::TMember &member, Bool_t &isRead)
+{
+   struct TBasicActions {
+      TStreamerInfoAction_t fRead;
+      TStreamerInfoAction_t fWrite;
+      Int_t fType;
+   };
+   static const TBasicActions basicActions[] = {
+      {ReadBasicType<Bool_t>,    WriteBasicType<Bool_t>,    TStreamerInfo::kBool},
+      {ReadBasicType<Char_t>,    WriteBasicType<Char_t>,    TStreamerInfo::kChar},
+      {ReadBasicType<UChar_t>,   WriteBasicType<UChar_t>,   TStreamerInfo::kUChar},
+      {ReadBasicType<Short_t>,   WriteBasicType<Short_t>,   TStreamerInfo::kShort},
+      {ReadBasicType<UShort_t>,  WriteBasicType<UShort_t>,  TStreamerInfo::kUShort},
+      {ReadBasicType<Int_t>,     WriteBasicType<Int_t>,     TStreamerInfo::kInt},
+      {ReadBasicType<UInt_t>,    WriteBasicType<UInt_t>,    TStreamerInfo::kUInt},
+      {ReadBasicType<Float_t>,   WriteBasicType<Float_t>,   TStreamerInfo::kFloat},
+      {ReadBasicType<Long64_t>,  WriteBasicType<Long64_t>,  TStreamerInfo::kLong64},
+      {ReadBasicType<ULong64_t>, WriteBasicType<ULong64_t>, TStreamerInfo::kULong64},
+      {ReadBasicType<Double_t>,  WriteBasicType<Double_t>,  TStreamerInfo::kDouble}
+   };
+
+   const TConfiguration *conf = action.fConfiguration;
+   if (!conf || conf->fElemId == (UInt_t)-1 || conf->fOffset == TVirtualStreamerInfo::kMissing)
+      return kFALSE;
+
+   if (action.fAction == GenericReadAction || action.fAction == GenericWriteAction) {
+      // Fixed size arrays and regrouped consecutive members of the same basic type.
+      if (typeid(*conf) != typeid(TGenericConfiguration))
+         return kFALSE;
+      const Int_t type = conf->fCompInfo->fType - TStreamerInfo::kOffsetL;
+      if (conf->fCompInfo->fType <= TStreamerInfo::kOffsetL || conf->fCompInfo->fType >= TStreamerInfo::kOffsetP ||
+          !GetFusedBasicTypeSize(type) || conf->fCompInfo->fLength <= 0)
+         return kFALSE;
+      member.fOffset = conf->fOffset + conf->fCompInfo->fOffset;
+      member.fType = type;
+      member.fLength = conf->fCompInfo->fLength;
+      isRead = action.fAction == GenericReadAction;
+      return kTRUE;
+   }
+
+   if (typeid(*conf) != typeid(TConfiguration))
+      return kFALSE;
+   for (const auto &basic : basicActions) {
+      if (action.fAction == basic.fRead || action.fAction == basic.fWrite) {
+         member.fOffset = conf->fOffset;
+         member.fType = basic.fType;
+         member.fLength = 1;
+         isRead = action.fAction == basic.fRead;
+         return kTRUE;
+      }
+   }
+   return kFALSE;
+}
+
+} // namespace TStreamerInfoActions
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill fFusedActions with a copy of fActions where each run of at least two consecutive
+/// actions streaming data members of basic type (or fixed size arrays of basic type) is
+/// replaced by a single action that reads or writes the buffer directly, avoiding a
+/// function pointer call and a virtual TBuffer call per data member.
+///
+/// These actions bypass the TBuffer interface and are thus only used by
+/// TBufferFile::ApplySequence. fActions is left untouched so that copies and
+/// sub-sequences (see CreateSubSequence) still see one action per data member.
+/// fFusedActions stays empty if there is nothing to merge.
+
+void TStreamerInfoActions::TActionSequence::FuseBasicTypeActions()
+{
+   fFusedActions.clear();
+
+   Bool_t merged = kFALSE;
+   ActionContainer_t fused;
+   fused.reserve(fActions.size());
+   auto end = fActions.end();
+   for (auto iter = fActions.begin(); iter != end;) {
+      TBasicTypeRunConfiguration::TMember member;
+      Bool_t isRead;
+      if (!GetFusableMember(*iter, member, isRead)) {
+         fused.emplace_back(iter->fAction, iter->fConfiguration->Copy());
+         ++iter;
+         continue;
+      }
+      auto conf = new TBasicTypeRunConfiguration(iter->fConfiguration->fInfo, iter->fConfiguration->fElemId,
+                                                 iter->fConfiguration->fCompInfo);
+      auto first = iter;
+      const Bool_t runIsRead = isRead;
+      do {
+         conf->fMembers.push_back(member);
+         conf->fNbytes += GetFusedBasicTypeSize(member.fType) * member.fLength;
+         ++iter;
+      } while (iter != end && GetFusableMember(*iter, member, isRead) && isRead == runIsRead);
+
+      if (iter - first < 2) {
+         delete conf;
+         fused.emplace_back(first->fAction, first->fConfiguration->Copy());
+         continue;
+      }
+      fused.emplace_back(runIsRead ? ReadBasicTypeRun : WriteBasicTypeRun, conf);
+      merged = kTRUE;
+   }
+
+   if (merged)
+      fFusedActions.swap(fused);
 }
 
 TStreamerInfoActions::TActionSequence *TStreamerInfoActions::TActionSequence::CreateCopy()
@@ -0,0 +1,126 @@
+#include "ROOT/RBlockCache.hxx"
+
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ROOT::Internal::RBlockCache;
+
+namespace {
+
+/// A remote file, whose vector reads are counted
+struct FakeRemoteFile {
+   std::vector<char> fContent;
+   std::size_t fNBytesFetched = 0;
+   bool fFail = false;
+
+   explicit FakeRemoteFile(std::size_t size) : fContent(size)
+   {
+      for (std::size_t i = 0; i < size; ++i)
+         fContent[i] = static_cast<char>(i * 7);
+   }
+
+   RBlockCache::FetchFunc_t GetFetchFunc()
+   {
+      return [this](RBlockCache::RIOVec *ioVec, unsigned int nReq) {
+         if (fFail)
+            throw std::runtime_error("remote read failed");
+         for (unsigned int i = 0; i < nReq; ++i) {
+            memcpy(ioVec[i].fBuffer, &fContent[ioVec[i].fOffset], ioVec[i].fSize);
+            ioVec[i].fOutBytes = ioVec[i].fSize;
+            fNBytesFetched += ioVec[i].fSize;
+         }
+      };
+   }
+};
+
+struct CacheDirGuard {
+   std::string fPath;
+   CacheDirGuard() : fPath(std::string(gSystem->TempDirectory()) + "/RBlockCacheTest" + std::to_string(gSystem->GetPid()))
+   {
+   }
+   ~CacheDirGuard() { gSystem->Exec(("rm -rf " + fPath).c_str()); }
+};
+
+} // anonymous namespace
+
+TEST(RBlockCache, ReadV)
+{
+   CacheDirGuard dir;
+   FakeRemoteFile remote(1000);
+   RBlockCache cache(dir.fPath, 1024 * 1024, 64);
+   const auto key = RBlockCache::MakeFileKey("root://server//file.root", remote.fContent.size(), 42);
+
+   char buf1[100];
+   char buf2[50];
+   RBlockCache::RIOVec ioVec[2];
+   ioVec[0].fBuffer = buf1;
+   ioVec[0].fOffset = 10;
+   ioVec[0].fSize = sizeof(buf1);
+   ioVec[1].fBuffer = buf2;
+   ioVec[1].fOffset = 980;
+   ioVec[1].fSize = sizeof(buf2);
+
+   cache.ReadV(key, remote.fContent.size(), ioVec, 2, remote.GetFetchFunc());
+   EXPECT_EQ(100u, ioVec[0].fOutBytes);
+   EXPECT_EQ(20u, ioVec[1].fOutBytes); // truncated at the end of the file
+   EXPECT_EQ(0, memcmp(buf1, &remote.fContent[10], 100));
+   EXPECT_EQ(0, memcmp(buf2, &remote.fContent[980], 20));
+   // Blocks 0, 1 and the last, short one
+   EXPECT_EQ(64u + 64u + 40u, remote.fNBytesFetched);
+
+   // Second pass: served from disk, also by another cache object on the same directory
+   remote.fNBytesFetched = 0;
+   memset(buf1, 0, sizeof(buf1));
+   RBlockCache otherCache(dir.fPath, 1024 * 1024, 64);
+   otherCache.ReadV(key, remote.fContent.size(), ioVec, 2, remote.GetFetchFunc());
+   EXPECT_EQ(0u, remote.fNBytesFetched);
+   EXPECT_EQ(0, memcmp(buf1, &remote.fContent[10], 100));
+
+   // A modified file does not use the blocks of the old version
+   const auto newKey = RBlockCache::MakeFileKey("root://server//file.root", remote.fContent.size(), 43);
+   cache.ReadV(newKey, remote.fContent.size(), ioVec, 1, remote.GetFetchFunc());
+   EXPECT_EQ(128u, remote.fNBytesFetched);
+}
+
+TEST(RBlockCache, Eviction)
+{
+   CacheDirGuard dir;
+   FakeRemoteFile remote(1000);
+   RBlockCache cache(dir.fPath, 200, 64);
+   const auto key = RBlockCache::MakeFileKey("root://server//file.root", remote.fContent.size(), 0);
+
+   std::vector<char> buf(remote.fContent.size());
+   RBlockCache::RIOVec ioVec;
+   ioVec.fBuffer = buf.data();
+   ioVec.fOffset = 0;
+   ioVec.fSize = buf.size();
+   cache.ReadV(key, remote.fContent.size(), &ioVec, 1, remote.GetFetchFunc());
+   EXPECT_EQ(buf.size(), ioVec.fOutBytes);
+   EXPECT_EQ(remote.fContent, buf);
+
+   // Most blocks were evicted to stay below the maximum size
+   remote.fNBytesFetched = 0;
+   cache.ReadV(key, remote.fContent.size(), &ioVec, 1, remote.GetFetchFunc());
+   EXPECT_EQ(remote.fContent, buf);
+   EXPECT_GT(remote.fNBytesFetched, 800u);
+}
+
+TEST(RBlockCache, FetchError)
+{
+   CacheDirGuard dir;
+   FakeRemoteFile remote(100);
+   remote.fFail = true;
+   RBlockCache cache(dir.fPath, 1024 * 1024, 64);
+   char buf[10];
+   RBlockCache::RIOVec ioVec;
+   ioVec.fBuffer = buf;
+   ioVec.fOffset = 0;
+   ioVec.fSize = sizeof(buf);
+   EXPECT_THROW(cache.ReadV("key", 100, &ioVec, 1, remote.GetFetchFunc()), std::runtime_error);
+}
@@ -0,0 +1,71 @@
+#include "ROOT/RBufferPool.hxx"
+
+#include "TBufferFile.h"
+
+#include "gtest/gtest.h"
+
+using ROOT::Internal::RBufferPool;
+
+TEST(RBufferPool, ReuseReleasedBuffer)
+{
+   RBufferPool pool(1024 * 1024);
+
+   TBufferFile *buffer = pool.Acquire(TBuffer::kWrite, 3000);
+   ASSERT_NE(nullptr, buffer);
+   EXPECT_GE(buffer->BufferSize(), 3000);
+   buffer->WriteInt(42);
+   EXPECT_EQ(0u, pool.GetStats().fNHits);
+   EXPECT_EQ(1u, pool.GetStats().fNMisses);
+
+   pool.Release(buffer);
+   EXPECT_EQ(1u, pool.GetStats().fNReleased);
+   EXPECT_EQ(static_cast<std::uint64_t>(buffer->BufferSize()), pool.GetStats().fHeldBytes);
+
+   // A smaller request of the same size class gets the released buffer back, reset and in the requested mode
+   TBufferFile *reused = pool.Acquire(TBuffer::kRead, 2100);
+   EXPECT_EQ(buffer, reused);
+   EXPECT_TRUE(reused->IsReading());
+   EXPECT_EQ(0, reused->Length());
+   EXPECT_EQ(1u, pool.GetStats().fNHits);
+   EXPECT_EQ(0u, pool.GetStats().fHeldBytes);
+   delete reused;
+}
+
+TEST(RBufferPool, SizeClasses)
+{
+   RBufferPool pool(1024 * 1024);
+
+   // A buffer of 5000 bytes can serve requests of up to 4096 bytes but not more
+   pool.Release(new TBufferFile(TBuffer::kRead, 5000));
+   TBufferFile *large = pool.Acquire(TBuffer::kRead, 4097);
+   EXPECT_EQ(0u, pool.GetStats().fNHits);
+   TBufferFile *small = pool.Acquire(TBuffer::kRead, 4096);
+   EXPECT_EQ(1u, pool.GetStats().fNHits);
+   EXPECT_EQ(5000, small->BufferSize());
+   delete large;
+   delete small;
+
+   // Buffers too small for the pool or not owning their memory are deleted
+   pool.Release(new TBufferFile(TBuffer::kRead, 100));
+   char data[2048];
+   pool.Release(new TBufferFile(TBuffer::kRead, sizeof(data), data, kFALSE));
+   EXPECT_EQ(0u, pool.GetStats().fNReleased);
+   EXPECT_EQ(0u, pool.GetStats().fHeldBytes);
+}
+
+TEST(RBufferPool, MaxSize)
+{
+   RBufferPool pool(8192);
+
+   pool.Release(new TBufferFile(TBuffer::kRead, 4096));
+   pool.Release(new TBufferFile(TBuffer::kRead, 4096));
+   pool.Release(new TBufferFile(TBuffer::kRead, 4096));
+   EXPECT_EQ(2u, pool.GetStats().fNReleased);
+   EXPECT_EQ(1u, pool.GetStats().fNDropped);
+   EXPECT_EQ(8192u, pool.GetStats().fHeldBytes);
+
+   pool.Clear();
+   EXPECT_EQ(0u, pool.GetStats().fHeldBytes);
+   delete pool.Acquire(TBuffer::kRead, 4096);
+   EXPECT_EQ(0u, pool.GetStats().fNHits);
+}
@@ -138,6 +138,30 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVAsync)
+{
+   FileRaii readvGuard("test_rawfile_readv_async", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_readv_async");
+
+   char buffer[3] = {0, 0, 0};
+   RRawFile::RIOVec iovec[2];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 7;
+   iovec[0].fSize = 2;
+   iovec[1].fBuffer = &buffer[2];
+   iovec[1].fOffset = 11;
+   iovec[1].fSize = 2;
+   auto result = f->ReadVAsync(iovec, 2);
+   result.get();
+
+   EXPECT_EQ(2U, iovec[0].fOutBytes);
+   EXPECT_EQ(1U, iovec[1].fOutBytes);
+   EXPECT_EQ('W', buffer[0]);
+   EXPECT_EQ('o', buffer[1]);
+   EXPECT_EQ('d', buffer[2]);
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
@@ -228,3 +252,48 @@ TEST(RRawFile, Mmap)
    auto mapdLength = 2 + innerOffset;
    f->Unmap(region, mapdLength);
 }
+
+
+TEST(RRawFile, MmapWholeFile)
+{
+   std::unique_ptr<RRawFileMock> m(new RRawFileMock("foo", RRawFile::ROptions()));
+   EXPECT_EQ(nullptr, m->GetMappedData(1, 0));
+
+   FileRaii basicGuard("test_rawfile_mmap_whole", "foo\nbar");
+   RRawFile::ROptions options;
+   options.fUseMmap = true;
+   auto f = RRawFile::Create("test_rawfile_mmap_whole", options);
+   if (!(f->GetFeatures() & RRawFile::kFeatureHasMmap))
+      return;
+   auto data = f->GetMappedData(3, 4);
+   ASSERT_NE(nullptr, data);
+   EXPECT_EQ("bar", std::string(reinterpret_cast<const char *>(data), 3));
+   EXPECT_EQ(nullptr, f->GetMappedData(4, 4));
+   EXPECT_EQ(nullptr, f->GetMappedData(1, 8));
+
+   char buffer[8] = {0};
+   EXPECT_EQ(3u, f->ReadAt(buffer, 7, 4));
+   EXPECT_STREQ("bar", buffer);
+   EXPECT_EQ(0u, f->ReadAt(buffer, 1, 7));
+
+   RRawFile::RIOVec iovec[2];
+   char iobuf[5] = {0};
+   iovec[0].fBuffer = iobuf;
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 2;
+   iovec[1].fBuffer = iobuf + 2;
+   iovec[1].fOffset = 5;
+   iovec[1].fSize = 2;
+   f->ReadV(iovec, 2);
+   EXPECT_EQ(2u, iovec[0].fOutBytes);
+   EXPECT_EQ(2u, iovec[1].fOutBytes);
+   EXPECT_STREQ("foar", iobuf);
+
+   std::string line;
+   EXPECT_TRUE(f->Readln(line));
+   EXPECT_STREQ("foo", line.c_str());
+
+   // Without the option, no pointers into the file are handed out
+   auto g = RRawFile::Create("test_rawfile_mmap_whole");
+   EXPECT_EQ(nullptr, g->GetMappedData(1, 0));
+}
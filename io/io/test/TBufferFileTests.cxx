@@ -2,8 +2,12 @@
 
 #include "TBufferFile.h"
 #include "TClass.h"
+#include "TAttAxis.h"
+#include "TStreamerInfo.h"
+#include "TStreamerInfoActions.h"
 #include <vector>
 #include <iostream>
+#include <cstring>
 
 // Tests ROOT-8367
 TEST(TBufferFile, ROOT_8367)
@@ -26,3 +30,160 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+namespace {
+
+template <typename T>
+void CheckArrayRoundTrip()
+{
+   for (Int_t n : {1, 2, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100, 1001}) {
+      std::vector<T> in(n);
+      for (Int_t i = 0; i < n; ++i)
+         in[i] = static_cast<T>((i * 2654435761u) ^ 0x5a5a5a5a) / static_cast<T>(3);
+
+      TBufferFile wbuf(TBuffer::kWrite);
+      // Misalign the array with respect to the buffer start on purpose
+      wbuf << Char_t(42);
+      wbuf.WriteFastArray(in.data(), n);
+      wbuf.WriteArray(in.data(), n);
+
+      TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+      Char_t c;
+      rbuf >> c;
+      std::vector<T> out(n);
+      rbuf.ReadFastArray(out.data(), n);
+      EXPECT_EQ(in, out) << "n = " << n;
+      T *arr = nullptr;
+      EXPECT_EQ(n, rbuf.ReadArray(arr));
+      EXPECT_EQ(in, std::vector<T>(arr, arr + n)) << "n = " << n;
+      delete[] arr;
+   }
+}
+
+} // anonymous namespace
+
+TEST(TBufferFile, FastArrayRoundTrip)
+{
+   CheckArrayRoundTrip<Short_t>();
+   CheckArrayRoundTrip<UShort_t>();
+   CheckArrayRoundTrip<Int_t>();
+   CheckArrayRoundTrip<UInt_t>();
+   CheckArrayRoundTrip<Long64_t>();
+   CheckArrayRoundTrip<ULong64_t>();
+   CheckArrayRoundTrip<Float_t>();
+   CheckArrayRoundTrip<Double_t>();
+}
+
+TEST(TBufferFile, FastArrayBigEndian)
+{
+   const Int_t ii[5] = {0x01020304, 0x05060708, 0x090a0b0c, 0x0d0e0f10, 0x11121314};
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteFastArray(ii, 5);
+   ASSERT_EQ(20, buf.Length());
+   for (Int_t i = 0; i < 20; ++i)
+      EXPECT_EQ(i + 1, buf.Buffer()[i]);
+}
+
+// The array versions of the Float16_t/Double32_t streamers must produce the same bytes
+// as the element-wise ones
+TEST(TBufferFile, FastArrayFloat16Double32)
+{
+   const Int_t n = 300;
+   std::vector<Float_t> f(n);
+   std::vector<Double_t> d(n);
+   for (Int_t i = 0; i < n; ++i) {
+      f[i] = (i % 2 ? -1.f : 1.f) * 0.37f * i;
+      d[i] = (i % 3 ? -1. : 1.) * 1.1 * i;
+   }
+
+   TBufferFile warr(TBuffer::kWrite);
+   TBufferFile wone(TBuffer::kWrite);
+   warr.WriteFastArrayFloat16(f.data(), n);
+   warr.WriteFastArrayDouble32(d.data(), n);
+   for (Int_t i = 0; i < n; ++i)
+      wone.WriteFloat16(&f[i]);
+   for (Int_t i = 0; i < n; ++i)
+      wone.WriteDouble32(&d[i]);
+   ASSERT_EQ(wone.Length(), warr.Length());
+   EXPECT_EQ(0, memcmp(wone.Buffer(), warr.Buffer(), warr.Length()));
+
+   TBufferFile rarr(TBuffer::kRead, warr.Length(), warr.Buffer(), kFALSE);
+   TBufferFile rone(TBuffer::kRead, wone.Length(), wone.Buffer(), kFALSE);
+   std::vector<Float_t> fout(n);
+   std::vector<Double_t> dout(n);
+   rarr.ReadFastArrayFloat16(fout.data(), n);
+   rarr.ReadFastArrayDouble32(dout.data(), n);
+   for (Int_t i = 0; i < n; ++i) {
+      Float_t fone;
+      rone.ReadFloat16(&fone);
+      EXPECT_EQ(fone, fout[i]);
+   }
+   for (Int_t i = 0; i < n; ++i) {
+      Double_t done;
+      rone.ReadDouble32(&done);
+      EXPECT_EQ(done, dout[i]);
+      EXPECT_FLOAT_EQ(d[i], dout[i]);
+   }
+}
+
+TEST(TBufferFile, FastArrayWithFactor)
+{
+   const Int_t n = 513;
+   std::vector<UInt_t> packed(n);
+   for (Int_t i = 0; i < n; ++i)
+      packed[i] = 7 * i;
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf.WriteFastArray(packed.data(), n);
+   wbuf.WriteFastArray(packed.data(), n);
+
+   TBufferFile rbuf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+   std::vector<Float_t> f(n);
+   std::vector<Double_t> d(n);
+   rbuf.ReadFastArrayWithFactor(f.data(), n, 2., -10.);
+   rbuf.ReadFastArrayWithFactor(d.data(), n, 2., -10.);
+   for (Int_t i = 0; i < n; ++i) {
+      EXPECT_FLOAT_EQ(3.5f * i - 10.f, f[i]);
+      EXPECT_DOUBLE_EQ(3.5 * i - 10., d[i]);
+   }
+}
+
+// Streaming with the fused basic type actions must be byte for byte identical
+TEST(TBufferFile, FusedBasicTypeActions)
+{
+   TAttAxis att;
+   att.SetNdivisions(510);
+   att.SetLabelColor(3);
+   att.SetLabelSize(0.07);
+   att.SetTitleOffset(1.3);
+   att.SetTitleFont(62);
+
+   TBufferFile plain(TBuffer::kWrite);
+   att.Streamer(plain);
+
+   auto info = static_cast<TStreamerInfo *>(TAttAxis::Class()->GetStreamerInfo());
+   auto readActions = info->GetReadObjectWiseActions();
+   auto writeActions = info->GetWriteObjectWiseActions();
+   readActions->FuseBasicTypeActions();
+   writeActions->FuseBasicTypeActions();
+   ASSERT_FALSE(readActions->fFusedActions.empty());
+   ASSERT_FALSE(writeActions->fFusedActions.empty());
+   EXPECT_LT(readActions->fFusedActions.size(), readActions->fActions.size());
+
+   TBufferFile fused(TBuffer::kWrite);
+   att.Streamer(fused);
+   ASSERT_EQ(plain.Length(), fused.Length());
+   EXPECT_EQ(0, memcmp(plain.Buffer(), fused.Buffer(), plain.Length()));
+
+   TBufferFile rbuf(TBuffer::kRead, fused.Length(), fused.Buffer(), kFALSE);
+   TAttAxis in;
+   in.Streamer(rbuf);
+   EXPECT_EQ(plain.Length(), rbuf.Length());
+   EXPECT_EQ(510, in.GetNdivisions());
+   EXPECT_EQ(3, in.GetLabelColor());
+   EXPECT_FLOAT_EQ(0.07, in.GetLabelSize());
+   EXPECT_FLOAT_EQ(1.3, in.GetTitleOffset());
+   EXPECT_EQ(62, in.GetTitleFont());
+
+   readActions->fFusedActions.clear();
+   writeActions->fFusedActions.clear();
+}
@@ -1,6 +1,11 @@
 #include "TBufferJSON.h"
 #include "TNamed.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -47,3 +52,45 @@ TEST(TBufferJSON, utf8_3)
    EXPECT_EQ(str0, named1->GetTitle());
 }
 
+
+// integer formatting must produce the same output as printf
+TEST(TBufferJSON, ConvertNumbers)
+{
+   char buf[100], ref[100];
+   for (Long64_t v : {0LL, 1LL, -1LL, 9LL, 10LL, -10LL, 123456789LL, -9223372036854775807LL - 1, 9223372036854775807LL}) {
+      auto len = TBufferJSON::ConvertInteger(v, buf);
+      snprintf(ref, sizeof(ref), "%lld", v);
+      EXPECT_STREQ(buf, ref);
+      EXPECT_EQ(len, (Int_t)strlen(ref));
+   }
+
+   EXPECT_EQ(TBufferJSON::ConvertInteger(18446744073709551615ULL, buf), 20);
+   EXPECT_STREQ(buf, "18446744073709551615");
+
+   for (Double_t v : {0., -0., 1., -7., 1e14, 123456789012345., 1e17, 1e20, 0.5, -2.25}) {
+      TBufferJSON::ConvertDouble(v, buf, sizeof(buf));
+      if (v == std::nearbyint(v))
+         snprintf(ref, sizeof(ref), "%1.0f", v);
+      else
+         snprintf(ref, sizeof(ref), "%g", v);
+      EXPECT_STREQ(buf, ref);
+   }
+}
+
+// arrays with gaps and repetitions must survive compressed JSON coding
+TEST(TBufferJSON, CompressedArray)
+{
+   std::vector<double> vect0(1000, 0.);
+   for (int n = 100; n < 200; ++n)
+      vect0[n] = 5.;
+   for (int n = 300; n < 310; ++n)
+      vect0[n] = n * 0.5;
+   vect0[999] = -1.;
+
+   for (int compact : {0, TBufferJSON::kZeroSuppression, TBufferJSON::kSameSuppression}) {
+      auto json = TBufferJSON::ToJSON(&vect0, compact);
+      auto vect1 = TBufferJSON::FromJSON<std::vector<double>>(json.Data());
+      ASSERT_NE(vect1, nullptr);
+      EXPECT_EQ(vect0, *vect1);
+   }
+}
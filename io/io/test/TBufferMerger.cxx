@@ -266,3 +266,74 @@ TEST(TBufferMerger, SetMaxTreeSize)
 
    RemoveFile("tbuffermerger_setmaxtreesize.root");
 }
+
+TEST(TBufferMerger, MultipleOutputsWithBackpressure)
+{
+   const int nthreads = 4;
+   const int nwrites = 8;
+   const int nevents = 128;
+   const unsigned int noutputs = 2;
+
+   ROOT::EnableThreadSafety();
+
+   TBufferMerger::MergeStats stats;
+   {
+      TBufferMerger merger("tbuffermerger_outputs.root", "RECREATE", 1, noutputs);
+      EXPECT_EQ(merger.GetNOutputFiles(), noutputs);
+      EXPECT_STREQ(merger.GetOutputFile(1)->GetName(), "tbuffermerger_outputs_1.root");
+      merger.SetMaxBuffered(1);
+
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            int n = 0;
+            mytree->Branch("n", &n, "n/I");
+            for (int j = 0; j < nwrites; ++j) {
+               for (int k = 0; k < nevents; ++k) {
+                  n = (i * nwrites + j) * nevents + k;
+                  mytree->Fill();
+               }
+               myfile->Write();
+            }
+            mytree->ResetBranchAddresses();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+
+      // Every write beyond the one byte bound drains the queue before returning
+      EXPECT_EQ(merger.GetQueueSize(), 0u);
+      stats = merger.GetMergeStats();
+   }
+
+   EXPECT_EQ(stats.fNBuffers, static_cast<size_t>(nthreads * nwrites));
+   EXPECT_GT(stats.fNMerges, 0u);
+   EXPECT_GT(stats.fBytesMerged, 0u);
+
+   Long64_t entries = 0;
+   long long sum = 0;
+   for (unsigned int i = 0; i < noutputs; ++i) {
+      const auto name = "tbuffermerger_outputs_" + std::to_string(i) + ".root";
+      ASSERT_TRUE(FileExists(name.c_str()));
+      {
+         TFile f(name.c_str());
+         if (auto t = f.Get<TTree>("mytree")) {
+            int n;
+            t->SetBranchAddress("n", &n);
+            for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+               t->GetEntry(e);
+               sum += n;
+            }
+            entries += t->GetEntries();
+         }
+      }
+      RemoveFile(name.c_str());
+   }
+
+   const long long total = nthreads * nwrites * nevents;
+   EXPECT_EQ(entries, total);
+   EXPECT_EQ(sum, total * (total - 1) / 2);
+}
@@ -1,11 +1,18 @@
+#include <cstring>
 #include <memory>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "TDirectoryFile.h"
+#include "TEnv.h"
 #include "TFile.h"
+#include "TFileCacheWrite.h"
 #include "TKey.h"
+#include "TList.h"
+#include "TMemFile.h"
 #include "TNamed.h"
+#include "TObjString.h"
 #include "TPluginManager.h"
 #include "TROOT.h" // gROOT
 #include "TSystem.h"
@@ -135,3 +142,209 @@ TEST(TFile, ReadWithoutGlobalRegistrationNet)
    const auto netFile = "root://eospublic.cern.ch//eos/root-eos/h1/dstarmb.root";
    TestReadWithoutGlobalRegistrationIfPossible(netFile);
 }
+
+TEST(TFile, WriteBehind)
+{
+   auto filename{"tfile_writebehind.root"};
+   const int nObjects = 200;
+
+   {
+      TFile f{filename, "recreate"};
+      // Small buffers and at most two of them in flight, to exercise the queue.
+      auto cache = new TFileCacheWrite(&f, 16000, 2);
+      ASSERT_EQ(f.GetCacheWrite(), cache);
+      EXPECT_TRUE(cache->IsWriteBehind());
+      for (int i = 0; i < nObjects; ++i) {
+         TNamed named{TString::Format("named%d", i), TString('x', 100 + 37 * i)};
+         f.WriteObject(&named, named.GetName());
+      }
+      // Reading back what may still be queued must see the written content.
+      auto named = f.Get<TNamed>("named3");
+      ASSERT_NE(named, nullptr);
+      EXPECT_EQ(std::string(named->GetTitle()), std::string(100 + 3 * 37, 'x'));
+      f.Close();
+   }
+
+   TFile input{filename};
+   ASSERT_FALSE(input.IsZombie());
+   for (int i = 0; i < nObjects; ++i) {
+      auto named = input.Get<TNamed>(TString::Format("named%d", i));
+      ASSERT_NE(named, nullptr);
+      EXPECT_EQ(std::string(named->GetTitle()), std::string(100 + 37 * i, 'x'));
+   }
+   input.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, MemoryMap)
+{
+   auto filename{"tfile_memorymap.root"};
+   const int nObjects = 50;
+
+   {
+      TFile f{filename, "recreate"};
+      EXPECT_FALSE(f.EnableMemoryMap());
+      for (int i = 0; i < nObjects; ++i) {
+         TNamed named{TString::Format("named%d", i), TString('x', 100 + 37 * i)};
+         f.WriteObject(&named, named.GetName());
+      }
+      f.Close();
+   }
+
+   TFile input{filename};
+   ASSERT_FALSE(input.IsZombie());
+   EXPECT_EQ(input.GetMemoryMappedBuffer(0, 4), nullptr);
+   ASSERT_TRUE(input.EnableMemoryMap());
+   auto header = input.GetMemoryMappedBuffer(0, 4);
+   ASSERT_NE(header, nullptr);
+   EXPECT_EQ(std::string(header, 4), "root");
+   EXPECT_EQ(input.GetMemoryMappedBuffer(input.GetSize(), 1), nullptr);
+
+   const auto bytesRead = input.GetBytesRead();
+   for (int i = 0; i < nObjects; ++i) {
+      auto named = input.Get<TNamed>(TString::Format("named%d", i));
+      ASSERT_NE(named, nullptr);
+      EXPECT_EQ(std::string(named->GetTitle()), std::string(100 + 37 * i, 'x'));
+   }
+   EXPECT_GT(input.GetBytesRead(), bytesRead);
+
+   input.ReOpen("UPDATE");
+   EXPECT_EQ(input.GetMemoryMappedBuffer(0, 4), nullptr);
+   input.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, StreamerInfoRecordCache)
+{
+   const std::vector<std::string> filenames{"tfile_sirecordcache_1.root", "tfile_sirecordcache_2.root"};
+   for (const auto &filename : filenames) {
+      TFile f{filename.c_str(), "recreate"};
+      TObjString str{"content"};
+      f.WriteObject(&str, "str");
+      f.Close();
+   }
+
+   // The second file carries the same StreamerInfo record as the first one, so it is not read again.
+   // Updating it with a different class must still keep the StreamerInfo of TObjString in the file.
+   TFile first{filenames[0].c_str()};
+   ASSERT_FALSE(first.IsZombie());
+   {
+      TFile second{filenames[1].c_str(), "update"};
+      ASSERT_FALSE(second.IsZombie());
+      TNamed named{"named", "title"};
+      second.WriteObject(&named, "named");
+      second.Close();
+   }
+
+   TFile second{filenames[1].c_str()};
+   ASSERT_FALSE(second.IsZombie());
+   std::unique_ptr<TList> infos{second.GetStreamerInfoList()};
+   ASSERT_NE(infos, nullptr);
+   EXPECT_NE(infos->FindObject("TObjString"), nullptr);
+   EXPECT_NE(infos->FindObject("TNamed"), nullptr);
+   auto str = second.Get<TObjString>("str");
+   ASSERT_NE(str, nullptr);
+   EXPECT_EQ(str->GetString(), "content");
+
+   for (const auto &filename : filenames)
+      gSystem->Unlink(filename.c_str());
+}
+
+TEST(TFile, LazyKeys)
+{
+   auto filename{"tfile_lazykeys.root"};
+   const int nObjects = 300;
+
+   gEnv->SetValue("TFile.KeyIndexThreshold", 100);
+   {
+      TFile f{filename, "recreate"};
+      auto dir = f.mkdir("dir");
+      for (int i = 0; i < nObjects; ++i) {
+         TNamed named{TString::Format("named%d", i), TString::Format("title%d", i)};
+         dir->WriteObject(&named, named.GetName());
+      }
+      TNamed second{"named0", "second cycle"};
+      dir->WriteObject(&second, "named0");
+      f.Close();
+   }
+   gEnv->SetValue("TFile.KeyIndexThreshold", 10000);
+
+   gEnv->SetValue("TFile.LazyKeys", 1);
+   {
+      TFile f{filename};
+      ASSERT_FALSE(f.IsZombie());
+      auto dir = f.Get<TDirectoryFile>("dir");
+      ASSERT_NE(dir, nullptr);
+      EXPECT_EQ(dir->GetNkeys(), nObjects + 1);
+
+      auto named = dir->Get<TNamed>("named42");
+      ASSERT_NE(named, nullptr);
+      EXPECT_STREQ(named->GetTitle(), "title42");
+      EXPECT_EQ(dir->Get<TNamed>("missing"), nullptr);
+
+      EXPECT_STREQ(dir->Get<TNamed>("named0")->GetTitle(), "second cycle");
+      EXPECT_STREQ(dir->Get<TNamed>("named0;1")->GetTitle(), "title0");
+      auto key = dir->GetKey("named0");
+      ASSERT_NE(key, nullptr);
+      EXPECT_EQ(key->GetCycle(), 2);
+
+      // The complete list keeps the keys already looked up
+      auto keys = dir->GetListOfKeys();
+      EXPECT_EQ(keys->GetSize(), nObjects + 1);
+      EXPECT_EQ(dir->GetKey("named0"), key);
+      EXPECT_EQ(keys->First(), key);
+   }
+   gEnv->SetValue("TFile.LazyKeys", 0);
+
+   // Readers not using the index see the same keys
+   {
+      TFile f{filename};
+      auto dir = f.Get<TDirectoryFile>("dir");
+      ASSERT_NE(dir, nullptr);
+      EXPECT_EQ(dir->GetListOfKeys()->GetSize(), nObjects + 1);
+      EXPECT_STREQ(dir->Get<TNamed>("named299")->GetTitle(), "title299");
+   }
+   gSystem->Unlink(filename);
+}
+
+// Check that a TMemFile can adopt a buffer and be reused for new content
+TEST(TMemFile, AdoptBufferAndReuse)
+{
+   auto makeContent = [](const char *title) {
+      TMemFile writer("tmemfile_writer.root", "RECREATE");
+      TNamed named("named", title);
+      writer.WriteTObject(&named);
+      writer.Write();
+      std::vector<char> data(writer.GetEND());
+      writer.CopyTo(data.data(), data.size());
+      return data;
+   };
+
+   auto first = makeContent("first");
+   std::unique_ptr<char[]> buffer(new char[first.size()]);
+   memcpy(buffer.get(), first.data(), first.size());
+   TMemFile f("tmemfile_adopted.root", std::move(buffer), first.size(), "UPDATE");
+   ASSERT_FALSE(f.IsZombie());
+   EXPECT_EQ(f.GetSize(), (Long64_t)first.size());
+   EXPECT_STREQ(f.Get<TNamed>("named")->GetTitle(), "first");
+
+   // The adopted buffer is extended when writing past its end
+   TNamed extra("extra", "extra");
+   EXPECT_GT(f.WriteTObject(&extra), 0);
+   EXPECT_GT(f.GetSize(), (Long64_t)first.size());
+
+   auto second = makeContent("second");
+   f.ResetForReuse(second.data(), second.size());
+   ASSERT_FALSE(f.IsZombie());
+   EXPECT_STREQ(f.Get<TNamed>("named")->GetTitle(), "second");
+   EXPECT_EQ(f.Get<TNamed>("extra"), nullptr);
+
+   // Without content the file starts over empty
+   f.ResetForReuse();
+   EXPECT_TRUE(f.IsWritable());
+   EXPECT_EQ(f.GetNkeys(), 0);
+   TNamed third("named", "third");
+   f.WriteTObject(&third);
+   f.Write();
+   EXPECT_STREQ(f.Get<TNamed>("named")->GetTitle(), "third");
+}
@@ -0,0 +1,36 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RDFMPI
+#define ROOT_RDF_RDFMPI
+
+#include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RInterface.hxx"
+#include "ROOT/RDF/RMergeableValue.hxx"
+#include "ROOT/RResultHandle.hxx"
+
+#include <mpi.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+using MPIMergeables_t = std::vector<std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase>>;
+
+MPIMergeables_t RunGraphsMPI(RDatasetSpec spec, const std::function<std::vector<RResultHandle>(RNode)> &bookActions,
+                             MPI_Comm comm = MPI_COMM_WORLD);
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RDFMPI
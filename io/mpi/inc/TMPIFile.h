@@ -35,6 +35,7 @@
 
 #include <mpi.h>
 
+#include <deque>
 #include <vector>
 
 class TMPIFile : public TMemFile {
@@ -50,11 +51,17 @@ private:
    Int_t fMPILocalSize;  // number of ranks in sub communicator
 
    MPI_Comm fSubComm;       // sub communicator handle
-   MPI_Request fMPIRequest; // request place holder
 
    TString fMPIFilename; // output filename, only used by collector
 
-   char *fSendBuf = 0; // message buffer, only used by worker
+   /// A buffer sent to the collector, kept alive until the send completes
+   struct PendingSend {
+      MPI_Request fRequest = MPI_REQUEST_NULL;
+      std::vector<char> fBuffer;
+   };
+   std::deque<PendingSend> fPendingSends; //! sends in flight, only used by worker
+   Int_t fMaxPendingSends = 1;            // number of sends a worker keeps in flight before Sync() blocks
+   Long64_t fCollectorBatchSize = 256 * 1024 * 1024; // bytes a collector receives before it merges
 
    struct ParallelFileMerger : public TObject {
    private:
@@ -91,6 +98,7 @@ private:
    void UpdateEndProcess();
 
    Bool_t IsReceived();
+   void WaitForPendingSends(std::size_t maxPending);
 
 public:
    TMPIFile(const char *name, char *buffer, Long64_t size = 0, Option_t *option = "", Int_t split = 1,
@@ -109,6 +117,13 @@ public:
 
    TString GetMPIFilename() const { return fMPIFilename; };
 
+   // The number of Sync() buffers a worker may have in flight (default 1)
+   void SetMaxPendingSends(Int_t n) { fMaxPendingSends = n < 1 ? 1 : n; }
+   Int_t GetMaxPendingSends() const { return fMaxPendingSends; }
+   // The number of bytes a collector receives from already waiting workers before merging them at once
+   void SetCollectorBatchSize(Long64_t bytes) { fCollectorBatchSize = bytes; }
+   Long64_t GetCollectorBatchSize() const { return fCollectorBatchSize; }
+
    // Collector Functions
    void RunCollector(Bool_t cache = kFALSE);
    Bool_t IsCollector();
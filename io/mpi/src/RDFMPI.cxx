@@ -0,0 +1,168 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDFMPI.hxx"
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx" // RunGraphs
+#include "TBufferFile.h"
+#include "TChain.h"
+#include "TClass.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+using ROOT::Detail::RDF::RMergeableValueBase;
+using ROOT::RDF::Experimental::MPIMergeables_t;
+
+namespace {
+
+/// Largest message sent in a single MPI call, whose count is an int
+const Long64_t kMaxMessageSize = 1 << 30;
+
+/// Number of entries of the main chain of the dataset, friends do not matter
+Long64_t CountEntries(const ROOT::RDF::Experimental::RDatasetSpec &spec)
+{
+   const auto &treeNames = spec.GetTreeNames();
+   const auto &fileNameGlobs = spec.GetFileNameGlobs();
+   TChain chain(treeNames.size() == 1 ? treeNames[0].c_str() : "", "", TChain::kWithoutGlobalRegistration);
+   for (std::size_t i = 0; i < fileNameGlobs.size(); ++i) {
+      if (treeNames.size() == 1)
+         chain.Add(fileNameGlobs[i].c_str());
+      else
+         chain.Add((fileNameGlobs[i] + "?#" + treeNames[i]).c_str());
+   }
+   return chain.GetEntries();
+}
+
+void SendMergeables(const MPIMergeables_t &values, int dest, MPI_Comm comm)
+{
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteInt(values.size());
+   for (const auto &value : values)
+      buf.WriteObjectAny(value.get(), TClass::GetClass(typeid(*value)));
+
+   const Long64_t size = buf.Length();
+   MPI_Send(&size, 1, MPI_LONG_LONG, dest, 0, comm);
+   for (Long64_t pos = 0; pos < size; pos += kMaxMessageSize)
+      MPI_Send(buf.Buffer() + pos, std::min(size - pos, kMaxMessageSize), MPI_CHAR, dest, 0, comm);
+}
+
+MPIMergeables_t ReceiveMergeables(int source, MPI_Comm comm)
+{
+   Long64_t size = 0;
+   MPI_Recv(&size, 1, MPI_LONG_LONG, source, 0, comm, MPI_STATUS_IGNORE);
+   std::vector<char> data(size);
+   for (Long64_t pos = 0; pos < size; pos += kMaxMessageSize)
+      MPI_Recv(data.data() + pos, std::min(size - pos, kMaxMessageSize), MPI_CHAR, source, 0, comm,
+               MPI_STATUS_IGNORE);
+
+   TBufferFile buf(TBuffer::kRead, size, data.data(), kFALSE);
+   Int_t n = 0;
+   buf.ReadInt(n);
+   MPIMergeables_t values;
+   for (Int_t i = 0; i < n; ++i)
+      values.emplace_back(
+         static_cast<RMergeableValueBase *>(buf.ReadObjectAny(TClass::GetClass<RMergeableValueBase>())));
+   return values;
+}
+
+/// Merge `in` into `out`. An empty list means that the rank(s) had nothing to process.
+void MergeInto(MPIMergeables_t &out, MPIMergeables_t &&in)
+{
+   if (in.empty())
+      return;
+   if (out.empty()) {
+      out = std::move(in);
+      return;
+   }
+   if (out.size() != in.size())
+      throw std::runtime_error("RunGraphsMPI: ranks booked a different number of actions.");
+   std::vector<RMergeableValueBase *> outPtrs;
+   std::vector<const RMergeableValueBase *> inPtrs;
+   for (std::size_t i = 0; i < out.size(); ++i) {
+      outPtrs.emplace_back(out[i].get());
+      inPtrs.emplace_back(in[i].get());
+   }
+   ROOT::Detail::RDF::MergeValueLists(outPtrs, inPtrs);
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Process a dataset with RDataFrame over the ranks of an MPI communicator.
+/// \param[in] spec The dataset. If it has a global entry range, only that range is processed.
+/// \param[in] bookActions Function booking the computation graph on the RDataFrame of a rank and
+///            returning the results to be merged. It must book the same actions, in the same order,
+///            on every rank.
+/// \param[in] comm The communicator, all its ranks must call this function.
+/// \return On rank 0, the merged results in the same order as returned by bookActions. An empty
+///         vector on the other ranks.
+///
+/// The entries of the dataset are split in one contiguous range per rank, each rank runs its own
+/// event loop (multi-threaded if implicit multi-threading is enabled) and the partial results are
+/// merged with a binomial tree reduction: at every step half of the remaining ranks send their
+/// results, streamed with TBufferFile, to a partner which merges them. The number of steps grows
+/// with the logarithm of the number of ranks, and the number of entries is computed by rank 0 only.
+///
+/// ### Example usage:
+/// ~~~{.cpp}
+/// MPI_Init(&argc, &argv);
+/// ROOT::RDF::Experimental::RDatasetSpec spec("events", "data_*.root");
+/// auto merged = ROOT::RDF::Experimental::RunGraphsMPI(spec, [](ROOT::RDF::RNode df) {
+///    return std::vector<ROOT::RDF::RResultHandle>{df.Histo1D<double>({"h", "h", 100, 0, 10}, "x")};
+/// });
+/// if (!merged.empty()) {
+///    using ROOT::Detail::RDF::RMergeableValue;
+///    const auto &h = static_cast<RMergeableValue<TH1D> &>(*merged[0]).GetValue();
+/// }
+/// MPI_Finalize();
+/// ~~~
+MPIMergeables_t ROOT::RDF::Experimental::RunGraphsMPI(RDatasetSpec spec,
+                                                      const std::function<std::vector<RResultHandle>(RNode)> &bookActions,
+                                                      MPI_Comm comm)
+{
+   int rank = 0, size = 1;
+   MPI_Comm_rank(comm, &rank);
+   MPI_Comm_size(comm, &size);
+
+   Long64_t nEntries = 0;
+   if (rank == 0)
+      nEntries = CountEntries(spec);
+   MPI_Bcast(&nEntries, 1, MPI_LONG_LONG, 0, comm);
+
+   const Long64_t begin = std::min(spec.GetEntryRangeBegin(), nEntries);
+   const Long64_t end = std::min(spec.GetEntryRangeEnd(), nEntries);
+   const Long64_t nToProcess = std::max(end - begin, 0LL);
+   const Long64_t rankBegin = begin + nToProcess * rank / size;
+   const Long64_t rankEnd = begin + nToProcess * (rank + 1) / size;
+
+   // Ranks without entries, possible with more ranks than entries, do not run any event loop
+   MPIMergeables_t values;
+   if (rankEnd > rankBegin) {
+      spec.WithGlobalRange({rankBegin, rankEnd});
+      ROOT::RDataFrame df(spec);
+      auto handles = bookActions(df);
+      ROOT::RDF::RunGraphs(handles);
+      for (auto &handle : handles)
+         values.emplace_back(ROOT::Detail::RDF::GetMergeableValue(handle));
+   }
+
+   for (int step = 1; step < size; step *= 2) {
+      if (rank % (2 * step) == step) {
+         SendMergeables(values, rank - step, comm);
+         return {};
+      }
+      if (rank + step < size)
+         MergeInto(values, ReceiveMergeables(rank + step, comm));
+   }
+
+   return values;
+}
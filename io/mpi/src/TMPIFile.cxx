@@ -44,6 +44,18 @@ Begin_Macro (source)
 }
 End_Macro
 
+### Scaling to many ranks
+
+The `split` argument sets the number of collectors: the ranks are divided
+into that many sub-communicators, each with its own collector writing its
+own output file (`<name>_<index>.root`), so that no single rank receives
+the data of all workers.
+
+Communication overlaps with both the work of the workers and the merging
+of the collectors: a worker can keep up to SetMaxPendingSends() buffers in
+flight, and a collector receives every message that has already arrived,
+up to SetCollectorBatchSize() bytes, before merging them together.
+
 See TMPIFile class for the list of functions
 */
 
@@ -58,8 +70,7 @@ const Int_t MIN_FILE_NUM = 2;
 
 TMPIFile::TMPIFile(const char *name, char *buffer, Long64_t size, Option_t *option, Int_t split, const char *ftitle,
                    Int_t compress)
-   : TMemFile(name, buffer, size, option, ftitle, compress), fSplitLevel(split), fMPIColor(0), fMPIRequest(0),
-     fSendBuf(0)
+   : TMemFile(name, buffer, size, option, ftitle, compress), fSplitLevel(split), fMPIColor(0)
 {
    // check that split is set to reasonable value
    CheckSplitLevel();
@@ -76,7 +87,7 @@ TMPIFile::TMPIFile(const char *name, char *buffer, Long64_t size, Option_t *opti
 /// \param[split] is the number of collectors to use
 
 TMPIFile::TMPIFile(const char *name, Option_t *option, Int_t split, const char *ftitle, Int_t compress)
-   : TMemFile(name, option, ftitle, compress), fSplitLevel(split), fMPIColor(0), fMPIRequest(0), fSendBuf(0)
+   : TMemFile(name, option, ftitle, compress), fSplitLevel(split), fMPIColor(0)
 {
    // check that split is set to reasonable value
    CheckSplitLevel();
@@ -116,6 +127,11 @@ void TMPIFile::UpdateEndProcess()
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the core of the Collector rank which listens for incoming
 /// messages from Worker ranks. The Collector
+///
+/// After each blocking receive, the collector also receives the messages
+/// that have already arrived, up to GetCollectorBatchSize() bytes, and
+/// merges them at once. This releases the Workers waiting for their sends
+/// to complete before the merge rather than after it, and saves merges.
 
 void TMPIFile::RunCollector(Bool_t cache)
 {
@@ -136,52 +152,66 @@ void TMPIFile::RunCollector(Bool_t cache)
       // this call blocks until a message is received
       MPI_Probe(MPI_ANY_SOURCE, MPI_ANY_TAG, fSubComm, &status);
 
-      // get bytes received
-      Int_t number_bytes;
-      MPI_Get_count(&status, MPI_CHAR, &number_bytes);
-      buffer.resize(number_bytes);
-      char *buf = buffer.data();
-
-      Int_t source = status.MPI_SOURCE;
-      Int_t tag = status.MPI_TAG;
-
-      // retrieve the message
-      MPI_Recv(buf, number_bytes, MPI_CHAR, source, tag, fSubComm, MPI_STATUS_IGNORE);
-
-      // empty message signifies a Worker exited
-      if (number_bytes == 0) {
-         this->UpdateEndProcess();
-      } else {
-         // create a TMemFile from the buffer
-         TMemFile *transient = new TMemFile(fMPIFilename, buf, number_bytes, "UPDATE");
-         if (transient->IsZombie()) {
-            Error("RunCollector", "Failed to create TMemFile from buffer");
-         }
-         // match compression settings of this TMPIFile object
-         transient->SetCompressionSettings(this->GetCompressionSettings());
-
-         // retrieve existing output file object
-         ParallelFileMerger *info = (ParallelFileMerger *)mergers.FindObject(fMPIFilename);
-         // if exiting file does not exist, create a new one
-         if (!info) {
-            info = new ParallelFileMerger(fMPIFilename, this->GetCompressionSettings(), cache);
-            // add file to hash table
-            mergers.Add(info);
+      ParallelFileMerger *info = nullptr;
+      Long64_t batchBytes = 0;
+      Int_t pending = 1;
+      while (pending) {
+         // get bytes received
+         Int_t number_bytes;
+         MPI_Get_count(&status, MPI_CHAR, &number_bytes);
+         buffer.resize(number_bytes);
+         char *buf = buffer.data();
+
+         Int_t source = status.MPI_SOURCE;
+         Int_t tag = status.MPI_TAG;
+
+         // retrieve the message
+         MPI_Recv(buf, number_bytes, MPI_CHAR, source, tag, fSubComm, MPI_STATUS_IGNORE);
+
+         // empty message signifies a Worker exited
+         if (number_bytes == 0) {
+            this->UpdateEndProcess();
+         } else {
+            // create a TMemFile from the buffer
+            TMemFile *transient = new TMemFile(fMPIFilename, buf, number_bytes, "UPDATE");
+            if (transient->IsZombie()) {
+               Error("RunCollector", "Failed to create TMemFile from buffer");
+            }
+            // match compression settings of this TMPIFile object
+            transient->SetCompressionSettings(this->GetCompressionSettings());
+
+            // retrieve existing output file object
+            info = (ParallelFileMerger *)mergers.FindObject(fMPIFilename);
+            // if exiting file does not exist, create a new one
+            if (!info) {
+               info = new ParallelFileMerger(fMPIFilename, this->GetCompressionSettings(), cache);
+               // add file to hash table
+               mergers.Add(info);
+            }
+
+            // first merge needs extra care
+            if (info->NeedInitialMerge(transient)) {
+               info->InitialMerge(transient);
+            }
+
+            // register the data, it is merged with the rest of the batch
+            info->RegisterClient(client_Id, transient);
+            transient = 0;
+
+            client_Id++;
+            batchBytes += number_bytes;
          }
+         buffer.resize(0);
 
-         // first merge needs extra care
-         if (info->NeedInitialMerge(transient)) {
-            info->InitialMerge(transient);
-         }
+         // keep receiving what has already arrived, without blocking
+         pending = 0;
+         if (batchBytes < fCollectorBatchSize && fEndProcess != fMPILocalSize - 1)
+            MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, fSubComm, &pending, &status);
+      }
 
-         // merge the data
-         info->RegisterClient(client_Id, transient);
+      // merge the data
+      if (info)
          info->Merge();
-         transient = 0;
-
-         client_Id++;
-      }
-      buffer.resize(0);
    }
 
    if (fEndProcess == fMPILocalSize - 1) {
@@ -392,6 +422,8 @@ Bool_t TMPIFile::IsCollector()
 /// Called by the Workers only: Copies the current content in memory and
 /// sends it asynchronously to the Collector for merging and writing to disk.
 ///
+/// If GetMaxPendingSends() sends are already in flight, this waits for the
+/// oldest one to be received first.
 
 void TMPIFile::CreateBufferAndSend()
 {
@@ -399,11 +431,14 @@ void TMPIFile::CreateBufferAndSend()
       Error("CreateBufferAndSend", " should not be called by a collector");
       return;
    }
+   WaitForPendingSends(fMaxPendingSends - 1);
    this->Write();
    Int_t count = this->GetEND();
-   fSendBuf = new char[count];
-   this->CopyTo(fSendBuf, count);
-   MPI_Isend(fSendBuf, count, MPI_CHAR, 0, fMPIColor, fSubComm, &fMPIRequest);
+   fPendingSends.emplace_back();
+   auto &send = fPendingSends.back();
+   send.fBuffer.resize(count);
+   this->CopyTo(send.fBuffer.data(), count);
+   MPI_Isend(send.fBuffer.data(), count, MPI_CHAR, 0, fMPIColor, fSubComm, &send.fRequest);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -416,26 +451,20 @@ void TMPIFile::CreateEmptyBufferAndSend()
       return;
    }
 
-   if (!IsReceived()) {
-      MPI_Wait(&fMPIRequest, MPI_STATUS_IGNORE);
-   }
-   delete[] fSendBuf; // empty the buffer once received by master
-   fSendBuf = nullptr;
-   MPI_Send(fSendBuf, 0, MPI_CHAR, 0, fMPIColor, fSubComm);
+   // empty the buffers once received by master
+   WaitForPendingSends(0);
+   MPI_Send(nullptr, 0, MPI_CHAR, 0, fMPIColor, fSubComm);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by the Workers only: Called periodically by workers and triggers
 /// the sending of data to the Collector for writing.
+///
+/// With SetMaxPendingSends() larger than one, a worker can keep producing
+/// while several of its buffers are still being transferred.
 
 void TMPIFile::Sync()
 {
-   // check if the previous send request is accepted by master.
-   if (!IsReceived()) {
-      MPI_Wait(&fMPIRequest, MPI_STATUS_IGNORE);
-   }
-   delete[] fSendBuf; // empty the buffer once received by master
-   fSendBuf = nullptr;
    CreateBufferAndSend();
    this->ResetAfterMerge((TFileMergeInfo *)0);
 }
@@ -537,14 +566,29 @@ void TMPIFile::SplitMPIComm()
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Checks the member MPI_REQEUST object to see if a message has been received.
+/// Checks whether all the buffers sent to the Collector have been received.
 
 Bool_t TMPIFile::IsReceived()
 {
-   if (!fMPIRequest) {
-      return kTRUE;
+   WaitForPendingSends(fPendingSends.size());
+   return fPendingSends.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Releases the buffers whose send completed and waits until at most
+/// maxPending sends are still in flight. Sends complete in order.
+
+void TMPIFile::WaitForPendingSends(std::size_t maxPending)
+{
+   while (!fPendingSends.empty()) {
+      Int_t flag = 0;
+      MPI_Test(&fPendingSends.front().fRequest, &flag, MPI_STATUS_IGNORE);
+      if (!flag)
+         break;
+      fPendingSends.pop_front();
+   }
+   while (fPendingSends.size() > maxPending) {
+      MPI_Wait(&fPendingSends.front().fRequest, MPI_STATUS_IGNORE);
+      fPendingSends.pop_front();
    }
-   Int_t flag = 0;
-   MPI_Test(&fMPIRequest, &flag, MPI_STATUS_IGNORE);
-   return flag;
 }
@@ -104,6 +104,8 @@ public:
    Bool_t ValidateDocument(XMLDocPointer_t, Bool_t = kFALSE) { return kFALSE; } // obsolete
    void SaveSingleNode(XMLNodePointer_t xmlnode, TString *res, Int_t layout = 1);
    XMLNodePointer_t ReadSingleNode(const char *src);
+   Bool_t CompactChilds(XMLNodePointer_t xmlnode, Int_t layout, Int_t level);
+   Bool_t ExpandChilds(XMLNodePointer_t xmlnode);
 
    ClassDefOverride(TXMLEngine, 1); // ROOT XML I/O parser, user by TXMLFile to read/write xml files
 };
@@ -162,6 +162,11 @@ void TKeyXML::StoreKeyAttributes()
 
 ////////////////////////////////////////////////////////////////////////////////
 ///  convert object to xml structure and keep this structure in key
+///  Apart from directories, which are updated all the time, the xml structure
+///  is immediately converted into the xml code which will be written to the
+///  file, so that the nodes of big objects do not stay in memory until the
+///  file is saved. The nodes are parsed again only if the object is read
+///  back from the same file.
 
 void TKeyXML::StoreObject(const void *obj, const TClass *cl, Bool_t check_tobj)
 {
@@ -193,6 +198,14 @@ void TKeyXML::StoreObject(const void *obj, const TClass *cl, Bool_t check_tobj)
 
    buffer.XmlWriteBlock(fKeyNode);
 
+   if (cl && !cl->InheritsFrom(TDirectory::Class())) {
+      // same layout as used by TXMLFile::SaveToFile(), key nodes are at depth 2 in the file
+      Int_t level = 2;
+      for (TDirectory *dir = GetMotherDir(); dir && (dir != f); dir = dir->GetMotherDir())
+         level += 2;
+      xml->CompactChilds(fKeyNode, f->GetCompressionLevel() > 5 ? 0 : 1, level);
+   }
+
    if (cl)
       fClassName = cl->GetName();
 }
@@ -222,6 +235,8 @@ void TKeyXML::UpdateObject(TObject *obj)
    if (!f || !xml || !obj || !fKeyNode)
       return;
 
+   xml->ExpandChilds(fKeyNode);
+
    XMLNodePointer_t objnode = xml->GetChild(fKeyNode);
    xml->SkipEmpty(objnode);
 
@@ -341,6 +356,9 @@ void *TKeyXML::XmlReadAny(void *obj, const TClass *expectedClass)
    if (!f || !xml)
       return obj;
 
+   if (!xml->ExpandChilds(fKeyNode))
+      return obj;
+
    TBufferXML buffer(TBuffer::kRead, f);
    buffer.InitMap();
    if (f->GetIOVersion() == 1)
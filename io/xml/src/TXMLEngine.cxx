@@ -118,17 +118,10 @@ public:
       fCurrent = fBuf;
    }
 
-   void OutputChar(char symb)
-   {
-      if (fOut)
-         fOut->put(symb);
-      else if (fOutStr)
-         fOutStr->Append(symb);
-   }
+   void Write(const char *str) { Write(str, strlen(str)); }
 
-   void Write(const char *str)
+   void Write(const char *str, Int_t len)
    {
-      int len = strlen(str);
       if (fCurrent + len >= fMaxAddr) {
          OutputCurrent();
          if (fOut)
@@ -136,8 +129,8 @@ public:
          else if (fOutStr)
             fOutStr->Append(str, len);
       } else {
-         while (*str)
-            *fCurrent++ = *str++;
+         memcpy(fCurrent, str, len);
+         fCurrent += len;
          if (fCurrent > fLimitAddr)
             OutputCurrent();
       }
@@ -145,17 +138,16 @@ public:
 
    void Put(char symb, Int_t cnt = 1)
    {
-      if (fCurrent + cnt >= fMaxAddr)
-         OutputCurrent();
-      if (fCurrent + cnt >= fMaxAddr) {
-         for (int n = 0; n < cnt; n++)
-            OutputChar(symb);
-      } else {
-         for (int n = 0; n < cnt; n++)
-            *fCurrent++ = symb;
-         if (fCurrent > fLimitAddr)
+      while (cnt > 0) {
+         if (fCurrent >= fLimitAddr)
             OutputCurrent();
+         Int_t portion = cnt < fMaxAddr - fCurrent ? cnt : Int_t(fMaxAddr - fCurrent);
+         memset(fCurrent, symb, portion);
+         fCurrent += portion;
+         cnt -= portion;
       }
+      if (fCurrent > fLimitAddr)
+         OutputCurrent();
    }
 };
 
@@ -1457,6 +1449,84 @@ void TXMLEngine::SaveSingleNode(XMLNodePointer_t xmlnode, TString *res, Int_t la
    SaveNode(xmlnode, &out, layout, 0);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Replace all child nodes of xmlnode by a single raw line with their xml code.
+/// The code is the same as the one SaveDoc() would produce for these nodes when
+/// xmlnode is placed at depth level (number of spaces) with the given layout.
+/// Once converted, the childs are not anymore accessible as xml nodes, but the
+/// memory needed to keep them is usually much smaller. Use ExpandChilds() to
+/// get the nodes back. Returns kFALSE if there are no childs to convert.
+
+Bool_t TXMLEngine::CompactChilds(XMLNodePointer_t xmlnode, Int_t layout, Int_t level)
+{
+   SXmlNode_t *node = (SXmlNode_t *)xmlnode;
+   if (!node || !node->fChild)
+      return kFALSE;
+
+   TString res;
+   {
+      TXMLOutputStream out(&res, 100000);
+      for (SXmlNode_t *child = node->fChild; child; child = child->fNext)
+         SaveNode((XMLNodePointer_t)child, &out, layout, level + 2);
+   }
+
+   // the raw line is itself indented and terminated by SaveNode
+   Ssiz_t beg = 0, len = res.Length();
+   if (layout > 0) {
+      beg = level + 2 < len ? level + 2 : len;
+      if (len > beg && res[len - 1] == '\n')
+         len--;
+   }
+
+   while (node->fChild)
+      UnlinkFreeNode((XMLNodePointer_t)node->fChild);
+
+   SXmlNode_t *line = (SXmlNode_t *)AllocateNode(len - beg, xmlnode);
+   line->fType = kXML_RAWLINE;
+   memcpy(SXmlNode_t::Name(line), res.Data() + beg, len - beg);
+   SXmlNode_t::Name(line)[len - beg] = 0;
+
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Parse again the xml code of child nodes converted by CompactChilds().
+/// Returns kFALSE if the code cannot be parsed, the raw line is kept then.
+
+Bool_t TXMLEngine::ExpandChilds(XMLNodePointer_t xmlnode)
+{
+   SXmlNode_t *node = (SXmlNode_t *)xmlnode;
+   if (!node || !node->fChild || (node->fChild->fType != kXML_RAWLINE))
+      return kTRUE;
+
+   SXmlNode_t *line = node->fChild;
+
+   TString src = "<xmlnode>";
+   src.Append(SXmlNode_t::Name(line));
+   src.Append("</xmlnode>");
+
+   XMLNodePointer_t tmpnode = ReadSingleNode(src.Data());
+   if (!tmpnode)
+      return kFALSE;
+
+   UnlinkFreeNode((XMLNodePointer_t)line);
+
+   // put parsed nodes in front of already existing childs
+   XMLNodePointer_t after = nullptr;
+   while (XMLNodePointer_t child = GetChild(tmpnode, kFALSE)) {
+      UnlinkNode(child);
+      if (after)
+         AddChildAfter(xmlnode, child, after);
+      else
+         AddChildFirst(xmlnode, child);
+      after = child;
+   }
+
+   FreeNode(tmpnode);
+
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// read single xmlnode from provided string
 
@@ -1648,9 +1718,7 @@ void TXMLEngine::OutputValue(char *value, TXMLOutputStream *out)
    char *find = nullptr;
    while ((find = strpbrk(last, "<&>\"")) != nullptr) {
       char symb = *find;
-      *find = 0;
-      out->Write(last);
-      *find = symb;
+      out->Write(last, find - last);
       last = find + 1;
       if (symb == '<')
          out->Write("&lt;");
@@ -448,7 +448,8 @@ void TXMLFile::ProduceFileNames(const char *filename, TString &fname, TString &d
 /// When saving, all this elements are linked to root xml node
 /// At the end StreamerInfo structures are added
 /// After xml document is saved, all nodes will be unlinked from root node
-/// and kept in memory.
+/// and kept in memory. The content of keys is kept as already formatted xml
+/// code (see TKeyXML::StoreObject()), which is just copied to the file.
 /// Only Close() or destructor release memory, used by xml structures
 
 void TXMLFile::SaveToFile()
@@ -298,7 +298,10 @@ class TCanvasPainter extends TPadPainter {
 
    /** @summary Handle websocket messages
      * @private */
-   onWebsocketMsg(handle, msg) {
+   onWebsocketMsg(handle, msg, offset) {
+      if (msg instanceof ArrayBuffer)
+         return this.onWebsocketBinarySnap(handle, offset ? msg.slice(offset) : msg);
+
       console.log(`GET MSG len:${msg.length} ${msg.slice(0,60)}`);
 
       if (msg == 'CLOSE') {
@@ -306,16 +309,7 @@ class TCanvasPainter extends TPadPainter {
          this.closeWebsocket(true);
       } else if (msg.slice(0,6) == 'SNAP6:') {
          // This is snapshot, produced with ROOT6
-
-         let snap = parse(msg.slice(6));
-
-         this.syncDraw(true).then(() => this.redrawPadSnap(snap)).then(() => {
-            this.completeCanvasSnapDrawing();
-            let ranges = this.getWebPadOptions(); // all data, including subpads
-            if (ranges) ranges = ':' + ranges;
-            handle.send('READY6:' + snap.fVersion + ranges); // send ready message back when drawing completed
-            this.confirmDraw();
-         });
+         this.drawWebsocketSnap(handle, parse(msg.slice(6)));
       } else if (msg.slice(0,5) == 'MENU:') {
          // this is menu with exact identifier for object
          let lst = parse(msg.slice(5));
@@ -356,6 +350,65 @@ class TCanvasPainter extends TPadPainter {
       }
    }
 
+   /** @summary Draw canvas snapshot and confirm drawing to the server
+     * @private */
+   drawWebsocketSnap(handle, snap) {
+      this.syncDraw(true).then(() => this.redrawPadSnap(snap)).then(() => {
+         this.completeCanvasSnapDrawing();
+         let ranges = this.getWebPadOptions(); // all data, including subpads
+         if (ranges) ranges = ':' + ranges;
+         handle.send('READY6:' + snap.fVersion + ranges); // send ready message back when drawing completed
+         this.confirmDraw();
+      });
+   }
+
+   /** @summary Handle binary snapshot, where bins content of large histograms provided as raw arrays
+     * @desc Arrays not changed since previous snapshot are not send again, values kept in the cache are used
+     * @private */
+   onWebsocketBinarySnap(handle, buf) {
+      const view = new DataView(buf),
+            decoder = new TextDecoder(),
+            align8 = len => Math.ceil(len / 8) * 8,
+            arrays = {}, cache = {};
+
+      if (decoder.decode(new Uint8Array(buf, 0, 4)) != 'SNB6')
+         return console.log(`unrecognized binary msg len:${buf.byteLength}`);
+
+      const jsonlen = view.getUint32(4, true), narrays = view.getUint32(8, true),
+            snap = parse(decoder.decode(new Uint8Array(buf, 16, jsonlen)));
+
+      for (let n = 0, pos = 16 + align8(jsonlen); n < narrays; ++n) {
+         const idlen = view.getUint32(pos, true), kind = view.getUint32(pos + 4, true), len = view.getUint32(pos + 8, true),
+               id = decoder.decode(new Uint8Array(buf, pos + 16, idlen));
+         pos += 16 + align8(idlen);
+         arrays[kind ? id + ':sumw2' : id] = new Float64Array(buf, pos, len);
+         pos += len * 8;
+      }
+
+      const assign = lst => lst?.forEach(prim => {
+         if (prim.fKind === 3) // kSubPad
+            return assign(prim.fPrimitives);
+         const obj = prim.fSnapshot, id = prim.fObjectID, id2 = id + ':sumw2';
+         if ((prim.fKind !== 1) || !obj) // kObject
+            return;
+         const content = arrays[id] ?? this._binary_cache?.[id],
+               sumw2 = arrays[id2] ?? this._binary_cache?.[id2];
+         if (content) {
+            cache[id] = obj.fArray = content;
+            if (sumw2?.length)
+               obj.fSumw2 = sumw2;
+            if (sumw2)
+               cache[id2] = sumw2;
+         }
+      });
+
+      assign(snap.fPrimitives);
+
+      this._binary_cache = cache; // only arrays of displayed histograms are kept
+
+      this.drawWebsocketSnap(handle, snap);
+   }
+
    /** @summary Handle pad button click event */
    clickPadButton(funcname, evnt) {
       if (funcname == 'ToggleGed') return this.activateGed(this, null, 'toggle');
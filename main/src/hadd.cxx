@@ -31,6 +31,8 @@
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
   \param -n   Open at most `n` at once (use 0 to request to use the system maximum)
+  \param -memlimit `<size>` With -j, maximum size of a partial result kept in memory rather than written
+              to the working directory (by default half of the RAM divided by the number of processes)
   \param -experimental-io-features `<feature>` Enables the corresponding experimental feature for output trees
   \return hadd returns a status code: 0 if OK, -1 otherwise
 
@@ -79,6 +81,16 @@
   the merge will be done without  unzipping or unstreaming the baskets
   (i.e. direct copy of the raw byte on disk). The "fast" mode is typically
   5 times faster than the mode unzipping and unstreaming the baskets.
+  If the compression levels differ, the baskets are still not unstreamed: they are
+  unzipped and zipped again with the target compression (option "fast recompress").
+  Use -O to rebuild the baskets.
+
+  With -j the input files are split in groups merged by separate processes. A partial result
+  whose inputs fit in the memory limit (see -memlimit) is built in a TMemFile and streamed back
+  to the parent, larger ones are written to the working directory. When there are many partial
+  results they are merged as a tree, at most 8 at a time and in parallel, before the final merge
+  into the target. The partial results use the target compression, so that every level of the
+  reduction can use the "fast" mode.
 
   If the option -cachesize is used, hadd will resize (or disable if 0) the
   prefetching cache use to speed up I/O operations.
@@ -103,17 +115,23 @@
 #include "THashList.h"
 #include "TKey.h"
 #include "TClass.h"
+#include "TMemFile.h"
+#include "TObjString.h"
 #include "TSystem.h"
 #include "TUUID.h"
 #include "ROOT/StringConv.hxx"
 #include "snprintf.h"
 
+#include <algorithm>
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <functional>
 #include <cstdlib>
 #include <climits>
+#include <memory>
 #include <sstream>
+#include <vector>
 #include "haddCommandLineOptionsHelp.h"
 
 #include "TFileMerger.h"
@@ -121,6 +139,15 @@
 #include "ROOT/TProcessExecutor.hxx"
 #endif
 
+namespace {
+
+/// Maximum number of partial results merged together by one process of the parallel reduction.
+constexpr int kReductionFanIn = 8;
+/// Upper bound for a partial result kept in memory; it travels back to the parent in a TBufferFile.
+constexpr Long64_t kMaxPartialInMemory = 1000000000;
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 
 int main( int argc, char **argv )
@@ -142,6 +169,7 @@ int main( int argc, char **argv )
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
    Int_t verbosity = 99;
+   Long64_t memLimit = -1;
    TString cacheSize;
    SysInfo_t s;
    gSystem->GetSysInfo(&s);
@@ -287,6 +315,22 @@ int main( int argc, char **argv )
             }
          }
          ++ffirst;
+      } else if (strcmp(argv[a], "-memlimit") == 0) {
+         if (a + 1 >= argc) {
+            std::cerr << "Error: no memory limit was provided after -memlimit.\n";
+         } else {
+            Long64_t limit;
+            auto parseResult = ROOT::FromHumanReadableSize(argv[a + 1], limit);
+            if (parseResult != ROOT::EFromHumanReadableSize::kSuccess || limit < 0) {
+               std::cerr << "Error: could not parse the memory limit passed after -memlimit: " << argv[a + 1]
+                         << ". We will use the default value.\n";
+            } else {
+               memLimit = limit;
+               ++a;
+               ++ffirst;
+            }
+         }
+         ++ffirst;
       } else if ( strcmp(argv[a],"-v") == 0 ) {
          if (a+1 == argc || argv[a+1][0] == '-') {
             // Verbosity level was not specified use the default:
@@ -339,7 +383,7 @@ int main( int argc, char **argv )
             }
          }
          char ft[7];
-         for (int alg = 0; !useFirstInputCompression && alg <= 5; ++alg) {
+         for (int alg = 0; !useFirstInputCompression && alg < ROOT::RCompressionSetting::EAlgorithm::kUndefined; ++alg) {
             for( int j=0; j<=9; ++j ) {
                const int comp = (alg*100)+j;
                snprintf(ft,7,"-f%s%d",prefix,comp);
@@ -380,26 +424,34 @@ int main( int argc, char **argv )
    if (maxopenedfiles > 0) {
       fileMerger.SetMaxOpenedFiles(maxopenedfiles);
    }
+   // Expand the indirect files (which may themselves list indirect files).
+   std::vector<std::string> inputFiles;
+   std::function<Bool_t(const char *)> addInput = [&](const char *name) {
+      if (name[0] != '@') {
+         inputFiles.emplace_back(name);
+         return kTRUE;
+      }
+      std::ifstream indirect_file(name + 1);
+      if (!indirect_file.is_open()) {
+         std::cerr << "hadd could not open indirect file " << (name + 1) << std::endl;
+         return kFALSE;
+      }
+      std::string line;
+      while (std::getline(indirect_file, line)) {
+         if (line.length() && !addInput(line.c_str()))
+            return kFALSE;
+      }
+      return kTRUE;
+   };
+   for (int i = ffirst; i < argc; ++i) {
+      if (!addInput(argv[i]))
+         return 1;
+   }
+
    if (newcomp == -1) {
       if (useFirstInputCompression || keepCompressionAsIs) {
          // grab from the first file.
-         TFile *firstInput = nullptr;
-         if (argv[ffirst] && argv[ffirst][0]=='@') {
-            std::ifstream indirect_file(argv[ffirst]+1);
-            if( ! indirect_file.is_open() ) {
-               std::cerr<< "hadd could not open indirect file " << (argv[ffirst]+1) << std::endl;
-               return 1;
-            }
-            std::string line;
-            while( indirect_file ){
-               if( std::getline(indirect_file, line) && line.length() ) {
-                  firstInput = TFile::Open(line.c_str());
-                  break;
-               }
-            }
-         } else {
-            firstInput = TFile::Open(argv[ffirst]);
-         }
+         TFile *firstInput = inputFiles.empty() ? nullptr : TFile::Open(inputFiles.front().c_str());
          if (firstInput && !firstInput->IsZombie())
             newcomp = firstInput->GetCompressionSettings();
          else
@@ -424,7 +476,9 @@ int main( int argc, char **argv )
       exit(1);
    }
 
-   auto filesToProcess = argc - ffirst;
+   // Partition the inputs by file rather than by command line argument, so that a single indirect
+   // file listing thousands of inputs is spread over all the processes as well.
+   auto filesToProcess = static_cast<int>(inputFiles.size());
    auto step = (filesToProcess + nProcesses - 1) / nProcesses;
    if (multiproc && step < 3) {
       // At least 3 files per process
@@ -433,117 +487,212 @@ int main( int argc, char **argv )
       std::cout << "Each process should handle at least 3 files for efficiency.";
       std::cout << " Setting the number of processes to: " << nProcesses << std::endl;
    }
-   if (nProcesses == 1)
+   if (nProcesses <= 1)
       multiproc = kFALSE;
 
-   std::vector<std::string> partialFiles;
-
-#ifndef R__WIN32
-   // this is commented out only to try to prevent false positive detection
-   // from several anti-virus engines on Windows, and multiproc is not
-   // supported on Windows anyway
-   if (multiproc) {
-      auto uuid = TUUID();
-      auto partialTail = uuid.AsString();
-      for (auto i = 0; (i * step) < filesToProcess; i++) {
-         std::stringstream buffer;
-         buffer << workingDir << "/partial" << i << "_" << partialTail << ".root";
-         partialFiles.emplace_back(buffer.str());
-      }
+   if (multiproc && memLimit < 0) {
+      // Leave half of the RAM to the page cache and the input files.
+      memLimit = s.fPhysRam > 0 ? (Long64_t(s.fPhysRam) << 20) / (2 * nProcesses) : 0;
    }
-#endif
+   // The partial results are sent back through a TBufferFile, which cannot grow beyond 1GB.
+   memLimit = std::min<Long64_t>(memLimit, kMaxPartialInMemory);
 
-   auto mergeFiles = [&](TFileMerger &merger) {
+   auto mergeFiles = [&](TFileMerger &merger, Int_t extraType) {
       if (reoptimize) {
          merger.SetFastMethod(kFALSE);
       } else {
          if (!keepCompressionAsIs && merger.HasCompressionChange()) {
             // Don't warn if the user any request re-optimization.
             std::cout << "hadd Sources and Target have different compression levels" << std::endl;
-            std::cout << "hadd merging will be slower" << std::endl;
+            std::cout << "hadd baskets will be recompressed" << std::endl;
          }
       }
       merger.SetNotrees(noTrees);
       merger.SetMergeOptions(cacheSize);
       merger.SetIOFeatures(features);
-      Bool_t status;
-      if (append)
-         status = merger.PartialMerge(TFileMerger::kIncremental | TFileMerger::kAll);
-      else
-         status = merger.Merge();
-      return status;
+      Int_t type = TFileMerger::kAll | extraType;
+      if (keepCompressionAsIs && !reoptimize)
+         type |= TFileMerger::kKeepCompression;
+      return merger.PartialMerge(type);
    };
 
-   auto sequentialMerge = [&](TFileMerger &merger, int start, int nFiles) {
-
-      for (auto i = start; i < (start + nFiles) && i < argc; i++) {
-         if (argv[i] && argv[i][0] == '@') {
-            std::ifstream indirect_file(argv[i] + 1);
-            if (!indirect_file.is_open()) {
-               std::cerr << "hadd could not open indirect file " << (argv[i] + 1) << std::endl;
-               return kFALSE;
-            }
-            while (indirect_file) {
-               std::string line;
-               if (std::getline(indirect_file, line) && line.length() && !merger.AddFile(line.c_str())) {
-                  return kFALSE;
-               }
-            }
-         } else if (!merger.AddFile(argv[i])) {
+   auto sequentialMerge = [&](TFileMerger &merger, int start, int nFiles, Int_t extraType) {
+      for (auto i = start; i < (start + nFiles) && i < filesToProcess; i++) {
+         if (!merger.AddFile(inputFiles[i].c_str())) {
             if (skip_errors) {
-               std::cerr << "hadd skipping file with error: " << argv[i] << std::endl;
+               std::cerr << "hadd skipping file with error: " << inputFiles[i] << std::endl;
             } else {
-               std::cerr << "hadd exiting due to error in " << argv[i] << std::endl;
+               std::cerr << "hadd exiting due to error in " << inputFiles[i] << std::endl;
                return kFALSE;
             }
          }
       }
-      return mergeFiles(merger);
-   };
-
-   auto parallelMerge = [&](int start) {
-      TFileMerger mergerP(kFALSE, kFALSE);
-      mergerP.SetMsgPrefix("hadd");
-      mergerP.SetPrintLevel(verbosity - 1);
-      if (maxopenedfiles > 0) {
-         mergerP.SetMaxOpenedFiles(maxopenedfiles / nProcesses);
-      }
-      if (!mergerP.OutputFile(partialFiles[(start - ffirst) / step].c_str(), newcomp)) {
-         std::cerr << "hadd error opening target partial file" << std::endl;
-         exit(1);
-      }
-      return sequentialMerge(mergerP, start, step);
-   };
-
-   auto reductionFunc = [&]() {
-      for (const auto &pf : partialFiles) {
-         fileMerger.AddFile(pf.c_str());
-      }
-      return mergeFiles(fileMerger);
+      return mergeFiles(merger, extraType);
    };
 
+   // Only the merge into the target honours -a, partial results are always new files.
+   const Int_t finalType = append ? TFileMerger::kIncremental : TFileMerger::kRegular;
    Bool_t status;
 
 #ifndef R__WIN32
+   // this is commented out only to try to prevent false positive detection
+   // from several anti-virus engines on Windows, and multiproc is not
+   // supported on Windows anyway
    if (multiproc) {
+      const std::string partialTail = TUUID().AsString();
+      std::vector<std::string> partialFiles; // on disk partial results, to be removed at the end
+
+      // Each partial result is returned as a TObjString tagged by its first character: the content of
+      // an in-memory file ('M'), the name of a file in the working directory ('D') or a failure ('F').
+      auto makePartialMerger = [&](TFileMerger &merger, int id, Long64_t expectedSize) -> TObjString * {
+         merger.SetMsgPrefix("hadd");
+         merger.SetPrintLevel(verbosity - 1);
+         if (maxopenedfiles > 0) {
+            merger.SetMaxOpenedFiles(maxopenedfiles / nProcesses);
+         }
+         if (expectedSize >= 0 && expectedSize <= memLimit) {
+            std::unique_ptr<TFile> memFile(new TMemFile(TString::Format("partial%d.root", id), "RECREATE", "", newcomp));
+            merger.OutputFile(std::move(memFile));
+            return new TObjString("M");
+         }
+         std::stringstream buffer;
+         buffer << workingDir << "/partial" << id << "_" << partialTail << ".root";
+         if (!merger.OutputFile(buffer.str().c_str(), kTRUE, newcomp)) {
+            std::cerr << "hadd error opening target partial file " << buffer.str() << std::endl;
+            return new TObjString("F");
+         }
+         return new TObjString(("D" + buffer.str()).c_str());
+      };
+
+      // Run the merge prepared by makePartialMerger and, for an in-memory output, append the file content
+      // to the tag. The incremental merge leaves the output open (with its keys and header written) so
+      // that it can be copied out.
+      auto finishPartialMerge = [&](TFileMerger &merger, TObjString *result, const std::function<Bool_t(Int_t)> &merge) {
+         TString &str = result->String();
+         if (str[0] == 'F')
+            return result;
+         if (str[0] == 'D') {
+            if (!merge(TFileMerger::kRegular))
+               str = "F";
+            return result;
+         }
+         if (!merge(TFileMerger::kIncremental)) {
+            str = "F";
+            return result;
+         }
+         auto out = static_cast<TMemFile *>(merger.GetOutputFile());
+         const Long64_t size = out->GetSize();
+         str.Append(' ', size);
+         out->CopyTo(&str[1], size);
+         return result;
+      };
+
+      // Sum of the sizes of the inputs, or -1 if one of them is not a local file.
+      auto estimateSize = [](const std::vector<std::string> &names, int start, int n) {
+         Long64_t total = 0;
+         for (auto i = start; i < start + n && i < (int)names.size(); ++i) {
+            FileStat_t st;
+            if (gSystem->GetPathInfo(names[i].c_str(), st) != 0)
+               return Long64_t(-1);
+            total += st.fSize;
+         }
+         return total;
+      };
+
+      // Leaf level: every process merges its group of input files.
+      auto parallelMerge = [&](int group) {
+         TFileMerger mergerP(kFALSE, kFALSE);
+         const int start = group * step;
+         auto result = makePartialMerger(mergerP, group, estimateSize(inputFiles, start, step));
+         return finishPartialMerge(mergerP, result, [&](Int_t extraType) {
+            return sequentialMerge(mergerP, start, step, extraType);
+         });
+      };
+
+      // Open a partial result in the process merging it; in-memory results are inherited through fork.
+      auto addPartial = [&](TFileMerger &merger, TObjString *partial, int id) {
+         const TString &str = partial->String();
+         if (str[0] == 'D')
+            return merger.AddFile(str.Data() + 1);
+         auto file = new TMemFile(TString::Format("partial%d.root", id),
+                                  TMemFile::ZeroCopyView_t(str.Data() + 1, str.Length() - 1));
+         return merger.AddAdoptFile(file);
+      };
+
+      auto collect = [&](std::vector<TObjString *> &results) {
+         Bool_t ok = kTRUE;
+         for (auto r : results) {
+            if (!r || r->String()[0] == 'F')
+               ok = kFALSE;
+            else if (r->String()[0] == 'D')
+               partialFiles.emplace_back(r->String().Data() + 1);
+         }
+         return ok;
+      };
+
       ROOT::TProcessExecutor p(nProcesses);
-      auto res = p.Map(parallelMerge, ROOT::TSeqI(ffirst, argc, step));
-      status = std::accumulate(res.begin(), res.end(), 0U) == partialFiles.size();
+      auto partials = p.Map(parallelMerge, ROOT::TSeqI(0, (filesToProcess + step - 1) / step));
+      status = collect(partials);
+
+      // Reduce the partial results as a tree, so that the final serial merge only has a small number of
+      // inputs; each level runs in parallel in freshly forked processes.
+      int level = 0;
+      while (status && (int)partials.size() > kReductionFanIn) {
+         ++level;
+         const int nGroups = (partials.size() + kReductionFanIn - 1) / kReductionFanIn;
+         auto reduce = [&](int group) {
+            TFileMerger mergerP(kFALSE, kFALSE);
+            const int start = group * kReductionFanIn;
+            const int end = std::min<int>(start + kReductionFanIn, partials.size());
+            Long64_t expectedSize = 0;
+            for (int i = start; i < end && expectedSize >= 0; ++i) {
+               const TString &str = partials[i]->String();
+               if (str[0] == 'M') {
+                  expectedSize += str.Length() - 1;
+               } else {
+                  FileStat_t st;
+                  expectedSize = gSystem->GetPathInfo(str.Data() + 1, st) == 0 ? expectedSize + st.fSize : -1;
+               }
+            }
+            auto result = makePartialMerger(mergerP, level * filesToProcess + group, expectedSize);
+            return finishPartialMerge(mergerP, result, [&](Int_t extraType) {
+               for (int i = start; i < end; ++i) {
+                  if (!addPartial(mergerP, partials[i], i))
+                     return kFALSE;
+               }
+               return mergeFiles(mergerP, extraType);
+            });
+         };
+         auto reduced = p.Map(reduce, ROOT::TSeqI(nGroups));
+         for (auto r : partials)
+            delete r;
+         partials = std::move(reduced);
+         status = collect(partials);
+      }
+
       if (status) {
-         status = reductionFunc();
+         for (std::size_t i = 0; status && i < partials.size(); ++i)
+            status = addPartial(fileMerger, partials[i], i);
+         if (status)
+            status = mergeFiles(fileMerger, finalType);
       } else {
          std::cout << "hadd failed at the parallel stage" << std::endl;
       }
+      // A successful merge closes its inputs; otherwise drop the in-memory ones before freeing their content.
+      if (!status)
+         fileMerger.Reset();
+      for (auto r : partials)
+         delete r;
       if (!debug) {
          for (const auto &pf : partialFiles) {
             gSystem->Unlink(pf.c_str());
          }
       }
    } else {
-      status = sequentialMerge(fileMerger, ffirst, filesToProcess);
+      status = sequentialMerge(fileMerger, 0, filesToProcess, finalType);
    }
 #else
-   status = sequentialMerge(fileMerger, ffirst, filesToProcess);
+   status = sequentialMerge(fileMerger, 0, filesToProcess, finalType);
 #endif
 
    if (status) {
@@ -10,6 +10,7 @@
 #pragma link C++ class TFoamCell+;
 #pragma link C++ class TFoam+;
 #pragma link C++ class TFoamSampler+;
+#pragma link C++ class TFoamGenerator-;
 #pragma read sourceClass="TFoam" targetClass="TFoam" version="[1]" \
   source="Int_t fNCells; TFoamCell **fCells; TRefArray *fCellsAct" target="fNCells,fCells,fCellsAct"\
   include="TRefArray.h" \
@@ -139,6 +139,8 @@ public:
 private:
    Double_t Sqr(Double_t x) const { return x*x;}      // Square function
 
+   friend class TFoamGenerator;
+
    ClassDefOverride(TFoam,2);   // General purpose self-adapting Monte Carlo event generator
 };
 
@@ -0,0 +1,74 @@
+// @(#)root/foam:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TFoamGenerator
+#define ROOT_TFoamGenerator
+
+#include "Rtypes.h"
+
+#include <memory>
+#include <vector>
+
+class TRandom;
+class TFoam;
+class TFoamIntegrand;
+
+class TFoamGenerator {
+private:
+   /// Read-only copy of the active cells of an explored TFoam, shared between generators
+   struct Grid {
+      Int_t fDim = 0;                  ///< Dimension of the simulation space
+      Int_t fOptRej = 1;               ///< =0 for weighted events; =1 for unweighted events
+      Double_t fMaxWtRej = 1.1;        ///< Maximum weight in rejection for getting wt=1 events
+      Double_t fPrime = 0;             ///< Primary integral R'
+      TFoamIntegrand *fRho = nullptr;  ///< Distribution, not owned
+      std::vector<Double_t> fPrimAcu;  ///< Cumulative probability of the active cells
+      std::vector<Double_t> fPrimary;  ///< Primary integral of the active cells
+      std::vector<Double_t> fVolume;   ///< Cartesian volume of the active cells
+      std::vector<Double_t> fCellPosi; ///< [nActive*fDim] Position of the active cells
+      std::vector<Double_t> fCellSize; ///< [nActive*fDim] Size of the active cells
+   };
+
+   std::shared_ptr<const Grid> fGrid; ///<! Cells of the foam
+   TRandom *fPseRan = nullptr;        ///<! Generator of pseudorandom numbers, not owned
+   std::vector<Double_t> fMCvect;     ///<! Generated MC vector
+   std::vector<Double_t> fRvec;       ///<! Random numbers of one event
+   Double_t fMCwt = 0;                ///<! MC weight
+   Long_t fNCalls = 0;                ///<! Number of the function calls
+   Double_t fNevGen = 0;              ///<! Number of the generated MC events
+   Double_t fSumWt = 0, fSumWt2 = 0;  ///<! Sum of wt and wt^2
+   Double_t fSumOve = 0;              ///<! Sum of overweighted events
+   Double_t fWtMax, fWtMin;           ///<! Maximum/Minimum MC weight
+
+   Long_t GenerCel() const;
+
+public:
+   TFoamGenerator(const TFoam &foam, TRandom *pseRan);
+   TFoamGenerator(const TFoamGenerator &other, TRandom *pseRan);
+
+   void MakeEvent();                    // Makes (generates) single MC event
+   void GetMCvect(Double_t *) const;    // Provides generated randomly MC vector
+   Double_t GetMCwt() const { return fMCwt; }    // Provides generated MC weight
+   Double_t MCgenerate(Double_t *MCvect);       // All three above function in one
+   void GetIntegMC(Double_t &, Double_t &) const; // Provides integral and abs. error from this generator
+
+   Int_t GetTotDim() const { return fGrid->fDim; }  // Get total dimension
+   Double_t GetPrimary() const { return fGrid->fPrime; } // Get value of primary integral R'
+   Long_t GetnCalls() const { return fNCalls; }     // Get no. of the function calls of this generator
+   Double_t GetNevGen() const { return fNevGen; }   // Get no. of MC events generated by this generator
+   Double_t GetWtMax() const { return fWtMax; }     // Get maximum MC weight of this generator
+   Double_t GetWtMin() const { return fWtMin; }     // Get minimum MC weight of this generator
+   Double_t GetSumWt() const { return fSumWt; }     // Get sum of MC weights of this generator
+   Double_t GetSumWt2() const { return fSumWt2; }   // Get sum of squared MC weights of this generator
+   TRandom *GetPseRan() const { return fPseRan; }   // Gets pointer of r.n. generator
+   void SetPseRan(TRandom *pseRan) { fPseRan = pseRan; } // Set new r.n. generator
+};
+
+#endif
@@ -0,0 +1,221 @@
+// @(#)root/foam:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TFoamGenerator
+
+Generates MC events from a TFoam which has been initialized (explored) before,
+so that events can be generated in several threads at the same time.
+
+The constructor taking a TFoam copies the active cells of the foam, with their
+position and size precomputed, into a read-only grid. Further generators made
+from an existing generator share this grid, hence a generator per thread is
+cheap. Each generator has its own generator of pseudorandom numbers, which must
+give independent streams, e.g. TRandom3 or TRandomMixMax with different seeds,
+and its own statistics of the MC weights. The distribution (TFoamIntegrand) is
+the one of the foam and is shared by all generators: its Density() method must
+be thread-safe. Interpreted distributions set with TMethodCall are not supported.
+
+For the same sequence of pseudorandom numbers, the events are the same as the
+ones of TFoam::MakeEvent().
+
+~~~{.cpp}
+TFoam foam("foam");
+foam.SetkDim(2);
+foam.SetRho(&rho);
+foam.SetPseRan(&rand);
+foam.Initialize();
+
+TFoamGenerator master(foam, nullptr);
+auto work = [&](UInt_t seed) {
+   TRandom3 rand(seed);
+   TFoamGenerator gen(master, &rand);
+   Double_t x[2];
+   for (int i = 0; i < 1000000; ++i) {
+      gen.MakeEvent();
+      gen.GetMCvect(x);
+      ...
+   }
+};
+ROOT::TThreadExecutor(4).Foreach(work, std::vector<UInt_t>{1, 2, 3, 4});
+~~~
+*/
+
+#include "TFoamGenerator.h"
+
+#include "TError.h"
+#include "TFoam.h"
+#include "TFoamCell.h"
+#include "TFoamIntegrand.h"
+#include "TFoamVect.h"
+#include "TMath.h"
+#include "TRandom.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the active cells of foam, which must be initialized, and use pseRan
+/// (not owned) to generate events.
+
+TFoamGenerator::TFoamGenerator(const TFoam &foam, TRandom *pseRan)
+   : fPseRan(pseRan), fWtMax(-1.0e150), fWtMin(1.0e150)
+{
+   auto grid = std::make_shared<Grid>();
+   grid->fDim = foam.fDim;
+   grid->fOptRej = foam.fOptRej;
+   grid->fMaxWtRej = foam.fMaxWtRej;
+   grid->fPrime = foam.fPrime;
+   grid->fRho = foam.fRho;
+
+   if (!foam.fPrimAcu || foam.fNoAct <= 0)
+      ::Error("TFoamGenerator", "TFoam %s is not initialized", foam.fName.Data());
+   else if (!foam.fRho)
+      ::Error("TFoamGenerator", "TFoam %s has no compiled distribution", foam.fName.Data());
+   else {
+      const Int_t nAct = foam.fNoAct;
+      const Int_t dim = foam.fDim;
+      grid->fPrimAcu.assign(foam.fPrimAcu, foam.fPrimAcu + nAct);
+      grid->fPrimary.resize(nAct);
+      grid->fVolume.resize(nAct);
+      grid->fCellPosi.resize(nAct * dim);
+      grid->fCellSize.resize(nAct * dim);
+      TFoamVect cellPosi(dim), cellSize(dim);
+      for (Int_t i = 0; i < nAct; i++) {
+         const TFoamCell *cell = foam.fCells[foam.fCellsAct[i]];
+         cell->GetHcub(cellPosi, cellSize);
+         for (Int_t j = 0; j < dim; j++) {
+            grid->fCellPosi[i * dim + j] = cellPosi[j];
+            grid->fCellSize[i * dim + j] = cellSize[j];
+         }
+         grid->fVolume[i] = cell->GetVolume();
+         grid->fPrimary[i] = cell->GetPrim();
+      }
+   }
+
+   fGrid = grid;
+   fMCvect.resize(fGrid->fDim);
+   fRvec.resize(fGrid->fDim);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Share the cells of other and use pseRan (not owned) to generate events.
+/// The statistics of the MC weights start from zero.
+
+TFoamGenerator::TFoamGenerator(const TFoamGenerator &other, TRandom *pseRan)
+   : fGrid(other.fGrid), fPseRan(pseRan), fMCvect(other.fMCvect.size()), fRvec(other.fRvec.size()),
+     fWtMax(-1.0e150), fWtMin(1.0e150)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return index of randomly chosen active cell with probability equal to its
+/// contribution into total driver integral, same as TFoam::GenerCel2().
+
+Long_t TFoamGenerator::GenerCel() const
+{
+   const Double_t *primAcu = fGrid->fPrimAcu.data();
+   const Double_t random = fPseRan->Rndm();
+   Long_t lo = 0, hi = fGrid->fPrimAcu.size() - 1;
+   Double_t flo = primAcu[lo], fhi = primAcu[hi];
+   while (lo + 1 < hi) {
+      Long_t hit = lo + (Int_t)((hi - lo) * (random - flo) / (fhi - flo) + 0.5);
+      if (hit <= lo)
+         hit = lo + 1;
+      else if (hit >= hi)
+         hit = hi - 1;
+      const Double_t fhit = primAcu[hit];
+      if (fhit > random) {
+         hi = hit;
+         fhi = fhit;
+      } else {
+         lo = hit;
+         flo = fhit;
+      }
+   }
+   return (primAcu[lo] > random) ? lo : hi;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate one MC event, like TFoam::MakeEvent().
+/// Generated MC point/vector is available using GetMCvect and the MC weight with GetMCwt.
+
+void TFoamGenerator::MakeEvent()
+{
+   const Grid &grid = *fGrid;
+   if (grid.fPrimAcu.empty())
+      return;
+
+   const Int_t dim = grid.fDim;
+   while (true) {
+      const Long_t iCell = GenerCel();
+
+      if (dim > 0)
+         fPseRan->RndmArray(dim, fRvec.data());
+      const Double_t *cellPosi = &grid.fCellPosi[iCell * dim];
+      const Double_t *cellSize = &grid.fCellSize[iCell * dim];
+      for (Int_t j = 0; j < dim; j++)
+         fMCvect[j] = cellPosi[j] + fRvec[j] * cellSize[j];
+
+      const Double_t wt = grid.fVolume[iCell] * grid.fRho->Density(dim, fMCvect.data());
+      const Double_t mcwt = wt / grid.fPrimary[iCell];
+      fNCalls++;
+      fMCwt = mcwt;
+      fSumWt += mcwt;
+      fSumWt2 += mcwt * mcwt;
+      fNevGen++;
+      fWtMax = TMath::Max(fWtMax, mcwt);
+      fWtMin = TMath::Min(fWtMin, mcwt);
+
+      if (grid.fOptRej != 1)
+         return;
+      // Wt=1 events, internal rejection
+      if (grid.fMaxWtRej * fPseRan->Rndm() > fMCwt)
+         continue;
+      if (fMCwt < grid.fMaxWtRej) {
+         fMCwt = 1.0;
+      } else {
+         fMCwt = fMCwt / grid.fMaxWtRej;
+         fSumOve += fMCwt - grid.fMaxWtRej;
+      }
+      return;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the last generated MC point/vector into MCvect
+
+void TFoamGenerator::GetMCvect(Double_t *MCvect) const
+{
+   for (std::size_t k = 0; k < fMCvect.size(); k++)
+      MCvect[k] = fMCvect[k];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate MC event, copy it into MCvect and return its MC weight
+
+Double_t TFoamGenerator::MCgenerate(Double_t *MCvect)
+{
+   MakeEvent();
+   GetMCvect(MCvect);
+   return fMCwt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Integral and its absolute error computed from the events of this generator,
+/// like TFoam::GetIntegMC(). The sums of the generators can be combined
+/// with GetSumWt(), GetSumWt2() and GetNevGen().
+
+void TFoamGenerator::GetIntegMC(Double_t &mcResult, Double_t &mcError) const
+{
+   mcResult = 0.0;
+   Double_t mcErelat = 1.0;
+   if (fNevGen > 0) {
+      mcResult = fGrid->fPrime * fSumWt / fNevGen;
+      mcErelat = TMath::Sqrt(fSumWt2 / (fSumWt * fSumWt) - 1 / fNevGen);
+   }
+   mcError = mcResult * mcErelat;
+}
@@ -2,11 +2,16 @@
 // Author: Stephan Hageboeck, CERN  04/2020
 
 #include "TFoam.h"
+#include "TFoamGenerator.h"
 #include "TFile.h"
 #include "TMath.h"
+#include "TRandom3.h"
 
 #include "gtest/gtest.h"
 
+#include <thread>
+#include <vector>
+
 Double_t sqr(Double_t x){
    return x*x;
 }
@@ -50,3 +55,67 @@ TEST(TFoam, Readv1) {
     EXPECT_NEAR(x[1], results[i][1], 1.E-9);
   }
 }
+
+// Events of a TFoamGenerator are the ones of the TFoam for the same random numbers,
+// and generators sharing the cells can run in parallel threads.
+TEST(TFoam, Generator) {
+  TFile file("testTFoam_1.root", "READ");
+  ASSERT_TRUE(file.IsOpen());
+
+  TFoam* foam = nullptr;
+  file.GetObject("foam", foam);
+  ASSERT_NE(foam, nullptr);
+  foam->SetRhoInt(Camel2);
+
+  TRandom3 foamRandom(4357);
+  TRandom3 genRandom(4357);
+  foam->SetPseRan(&foamRandom);
+  TFoamGenerator gen(*foam, &genRandom);
+  EXPECT_EQ(gen.GetTotDim(), 2);
+  EXPECT_EQ(gen.GetPrimary(), foam->GetPrimary());
+
+  for (int i=0; i<100; ++i) {
+    double x[2], y[2];
+    const double wtFoam = foam->MCgenerate(x);
+    const double wtGen = gen.MCgenerate(y);
+    EXPECT_EQ(wtGen, wtFoam);
+    EXPECT_EQ(y[0], x[0]);
+    EXPECT_EQ(y[1], x[1]);
+  }
+
+  const int nThreads = 4;
+  const int nEvents = 1000;
+  auto generate = [&](TFoamGenerator &g, std::vector<double> &out) {
+    double x[2];
+    for (int i=0; i<nEvents; ++i) {
+      g.MCgenerate(x);
+      out.push_back(x[0]);
+      out.push_back(x[1]);
+    }
+  };
+
+  std::vector<std::vector<double>> sequential(nThreads), parallel(nThreads);
+  for (int t=0; t<nThreads; ++t) {
+    TRandom3 random(t + 1);
+    TFoamGenerator g(gen, &random);
+    generate(g, sequential[t]);
+  }
+
+  std::vector<TRandom3> randoms;
+  std::vector<TFoamGenerator> generators;
+  for (int t=0; t<nThreads; ++t)
+    randoms.emplace_back(t + 1);
+  for (int t=0; t<nThreads; ++t)
+    generators.emplace_back(gen, &randoms[t]);
+  std::vector<std::thread> threads;
+  for (int t=0; t<nThreads; ++t)
+    threads.emplace_back(generate, std::ref(generators[t]), std::ref(parallel[t]));
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int t=0; t<nThreads; ++t) {
+    EXPECT_EQ(parallel[t], sequential[t]);
+    EXPECT_GE(generators[t].GetNevGen(), nEvents);
+  }
+  EXPECT_NE(parallel[0], parallel[1]);
+}
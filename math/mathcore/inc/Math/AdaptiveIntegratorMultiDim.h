@@ -18,6 +18,8 @@
 
 #include "Math/VirtualIntegrator.h"
 
+#include "ROOT/EExecutionPolicy.hxx"
+
 namespace ROOT {
 namespace Math {
 
@@ -61,6 +63,15 @@ An integration rule of degree seven is used together with a certain
 strategy of subdivision.
 For a more detailed description of the method see References.
 
+### Parallel evaluation:
+
+With SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread, nregions), the nregions
+regions with the largest errors are divided at each step instead of only one, and the
+rule is evaluated on the 2 nregions new regions in parallel with ROOT::TThreadExecutor,
+using the thread pool of ROOT::EnableImplicitMT() if it is enabled. The evaluation of the
+integrand must then be thread-safe. The subdivision differs from the sequential one, so
+do the results within the errors, but they don't depend on the number of threads.
+
 ### Notes:
 
   1..Multi-dimensional integration is time-consuming. For each rectangular
@@ -157,6 +168,13 @@ public:
    /// set absolute tolerance
    void SetAbsTolerance(double absTol) override;
 
+   /// Set the execution policy: ROOT::EExecutionPolicy::kSequential (default) or kMultiThread, dividing
+   /// nregions regions at each step and evaluating them in parallel (see the class documentation)
+   void SetExecutionPolicy(ROOT::EExecutionPolicy policy, unsigned int nregions = 16);
+
+   /// return the execution policy
+   ROOT::EExecutionPolicy ExecutionPolicy() const { return fExecutionPolicy; }
+
    ///set workspace size
    void SetSize(unsigned int size) { fSize = size; }
 
@@ -177,6 +195,10 @@ protected:
    // internal function to compute the integral (if absVal is true compute abs value of function integral
    double DoIntegral(const double* xmin, const double * xmax, bool absVal = false);
 
+   // internal function to compute the integral dividing several regions at each step, for the multi-thread mode
+   double DoIntegralBatch(const double *xmin, const double *xmax, bool absVal, unsigned int minpts,
+                          unsigned int maxpts, unsigned int maxrgn);
+
  private:
 
    unsigned int fDim;     ///< dimensionality of integrand
@@ -192,6 +214,9 @@ protected:
    int    fNEval;         ///< number of function evaluation
    int fStatus;           ///< status of algorithm (error if not zero)
 
+   ROOT::EExecutionPolicy fExecutionPolicy; ///< sequential or multi-thread evaluation of the regions
+   unsigned int fNRegionsPerStep;           ///< number of regions divided at each step in multi-thread mode
+
    const IMultiGenFunction* fFun;   // pointer to integrand function
 
 };
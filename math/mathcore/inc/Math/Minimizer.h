@@ -25,6 +25,7 @@
 #include <string>
 #include <limits>
 #include <cmath>
+#include <vector>
 
 
 namespace ROOT {
@@ -348,6 +349,18 @@ public:
       return false;
    }
 
+   /**
+      minos errors of all the variables ivars computed at the same time, for the minimizers which can do it
+      (e.g. in parallel). valid tells for each variable if its errors could be computed.
+      Return false if it is not supported in the current configuration: the errors must then be computed
+      one variable at a time with GetMinosError
+   */
+   virtual bool GetMinosErrors(const std::vector<unsigned int> & ivars, std::vector<double> & errLow,
+                               std::vector<double> & errUp, std::vector<bool> & valid) {
+      MATH_UNUSED(ivars); MATH_UNUSED(errLow); MATH_UNUSED(errUp); MATH_UNUSED(valid);
+      return false;
+   }
+
    /**
       perform a full calculation of the Hessian matrix for error calculation
     */
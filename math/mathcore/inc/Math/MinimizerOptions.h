@@ -60,6 +60,7 @@ public:
    ///     - Minimize
    ///     - Simplex
    ///     - Fumili2    new implementation of Fumili integrated in Minuit2
+   ///     - LBFGS      limited-memory BFGS, for problems with thousands of parameters
    /// - Fumili  Minimizer using an approximation for the Hessian based on first derivatives of the model function (see TFumili). Works only for chi-squared and likelihood functions.
    /// - Linear  Linear minimizer (fitter) working only for linear functions (see TLinearFitter and TLinearMinimizer)
    /// - GSLMultiMin  Minimizer from GSL based on the ROOT::Math::GSLMinimizer. Available algorithms are:
@@ -29,6 +29,7 @@ class RanluxppEngine final : public TRandomEngine {
 private:
    using ImplType = RanluxppEngineImpl<48, p>;
    std::unique_ptr<ImplType> fImpl;
+   uint64_t fSeed = 0; ///< Seed of the current stream
 
 public:
    RanluxppEngine(uint64_t seed = 314159265);
@@ -38,11 +39,22 @@ public:
    double Rndm() override;
    /// Generate a double-precision random number (non-virtual method)
    double operator()();
+   /// Generate an array of double-precision random numbers
+   void RndmArray(int n, double *array);
    /// Generate a random integer value with 48 bits
    uint64_t IntRndm();
 
    /// Initialize and seed the state of the generator
    void SetSeed(uint64_t seed);
+   /// Initialize the state of the generator at the start of the independent stream `stream` of `seed`.
+   /// The state only depends on the two numbers and the stream 0 is the same as SetSeed(seed): in parallel
+   /// code, seeding with the number of the task, processing slot or entry as stream gives reproducible results
+   /// independently of the scheduling. Each stream has 2^160 states of 12 numbers, without overlap for all
+   /// seeds and streams.
+   void SetSeed(uint64_t seed, uint64_t stream);
+   /// Return a new engine at the start of the independent stream `stream` of the seed of this engine,
+   /// independently of the numbers generated so far
+   std::unique_ptr<RanluxppEngine> Split(uint64_t stream) const;
    /// Skip `n` random numbers without generating them
    void Skip(uint64_t n);
 
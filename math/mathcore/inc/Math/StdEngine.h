@@ -99,6 +99,11 @@ namespace ROOT {
             return Rndm();
          }
 
+         /// generate an array of random numbers
+         void RndmArray(int n, double * array) {
+            for (int i = 0; i < n; ++i) array[i] = Rndm();
+         }
+
          static const char * Name()  {
             return StdEngineType<Generator>::Name();
          }
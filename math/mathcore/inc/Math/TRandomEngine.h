@@ -20,6 +20,11 @@ namespace ROOT {
       public:
          virtual double Rndm() = 0;
          virtual ~TRandomEngine() {}
+
+         /// generate an array of random numbers, engines can provide a faster implementation
+         void RndmArray(int n, double * array) {
+            for (int i = 0; i < n; ++i) array[i] = Rndm();
+         }
       };
       
    } // end namespace Math
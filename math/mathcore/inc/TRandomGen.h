@@ -42,6 +42,7 @@
 
 #include "TRandom.h"
 
+#include <algorithm>
 #include <string>
 
 template<class Engine>
@@ -61,14 +62,24 @@ public:
    using TRandom::Rndm;
     Double_t Rndm( ) override { return fEngine(); }
     void     RndmArray(Int_t n, Float_t *array) override {
-      for (int i = 0; i < n; ++i) array[i] = fEngine();
+      // generate in chunks with the bulk method of the engine
+      Double_t buffer[256];
+      for (int i = 0; i < n; i += 256) {
+         const int m = std::min(n - i, 256);
+         fEngine.RndmArray(m, buffer);
+         for (int j = 0; j < m; ++j) array[i + j] = buffer[j];
+      }
    }
     void     RndmArray(Int_t n, Double_t *array) override {
-            for (int i = 0; i < n; ++i) array[i] = fEngine();
+      fEngine.RndmArray(n, array);
    }
     void     SetSeed(ULong_t seed=0) override {
       fEngine.SetSeed(seed);
    }
+   /// Seed the independent stream `stream` of `seed`, only for engines providing streams (see TRandomRanluxpp)
+   void SetSeed(ULong64_t seed, ULong64_t stream) {
+      fEngine.SetSeed(seed, stream);
+   }
 
    ClassDefOverride(TRandomGen,1)  //Generic Random number generator template on the Engine type
 };
@@ -129,6 +140,26 @@ typedef TRandomGen<ROOT::Math::MixMaxEngine<17,0>> TRandomMixMax17;
  */
 typedef TRandomGen<ROOT::Math::MixMaxEngine<256,2>> TRandomMixMax256;
 
+/**
+  @ingroup Random
+  RANLUX++ generator, see ROOT::Math::RanluxppEngine.
+
+  Its state can be advanced by any number of steps in a time logarithmic in
+  the number of steps, which gives independent streams for parallel code: after
+  `SetSeed(seed, stream)` the sequence only depends on the two numbers, so a
+  generator seeded with the task number, or with the entry number in an
+  RDataFrame, gives the same results for any number of threads, without sharing
+  a generator between them:
+
+~~~ {.cpp}
+ROOT::RDataFrame df(n);
+std::vector<TRandomRanluxpp> rngs(std::max(1u, ROOT::GetThreadPoolSize()));
+auto withX = df.DefineSlotEntry("x", [&](unsigned int slot, ULong64_t entry) {
+   rngs[slot].SetSeed(seed, entry);
+   return rngs[slot].Gaus();
+});
+~~~
+ */
 typedef TRandomGen<ROOT::Math::RanluxppEngine2048> TRandomRanluxpp;
 
 /**
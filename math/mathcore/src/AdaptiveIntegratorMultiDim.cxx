@@ -8,10 +8,150 @@
 
 #include <cmath>
 #include <algorithm>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 namespace ROOT {
 namespace Math {
 
+namespace {
+
+// nodes and weights of the degree seven integration rule
+const double xl2 = 0.358568582800318073;//lambda_2
+const double xl4 = 0.948683298050513796;//lambda_4
+const double xl5 = 0.688247201611685289;//lambda_5
+const double w2  = 980./6561; //weights/2^n
+const double w4  = 200./19683;
+const double wp2 = 245./486;//error weights/2^n
+const double wp4 = 25./729;
+
+const double wn1[14] = {-0.193872885230909911, -0.555606360818980835,
+                        -0.876695625666819078, -1.15714067977442459,  -1.39694152314179743,
+                        -1.59609815576893754,  -1.75461057765584494,  -1.87247878880251983,
+                        -1.94970278920896201,  -1.98628257887517146,  -1.98221815780114818,
+                        -1.93750952598689219,  -1.85215668343240347,  -1.72615963013768225};
+
+const double wn3[14] = {0.0518213686937966768,  0.0314992633236803330,
+                        0.0111771579535639891,-0.00914494741655235473,-0.0294670527866686986,
+                        -0.0497891581567850424,-0.0701112635269013768, -0.0904333688970177241,
+                        -0.110755474267134071, -0.131077579637250419,  -0.151399685007366752,
+                        -0.171721790377483099, -0.192043895747599447,  -0.212366001117715794};
+
+const double wn5[14] = {0.871183254585174982e-01,  0.435591627292587508e-01,
+                        0.217795813646293754e-01,  0.108897906823146873e-01,  0.544489534115734364e-02,
+                        0.272244767057867193e-02,  0.136122383528933596e-02,  0.680611917644667955e-03,
+                        0.340305958822333977e-03,  0.170152979411166995e-03,  0.850764897055834977e-04,
+                        0.425382448527917472e-04,  0.212691224263958736e-04,  0.106345612131979372e-04};
+
+const double wpn1[14] = {-1.33196159122085045, -2.29218106995884763,
+                        -3.11522633744855959, -3.80109739368998611, -4.34979423868312742,
+                        -4.76131687242798352, -5.03566529492455417, -5.17283950617283939,
+                        -5.17283950617283939, -5.03566529492455417, -4.76131687242798352,
+                        -4.34979423868312742, -3.80109739368998611, -3.11522633744855959};
+
+const double wpn3[14] = {0.0445816186556927292, -0.0240054869684499309,
+                        -0.0925925925925925875, -0.161179698216735251,  -0.229766803840877915,
+                        -0.298353909465020564,  -0.366941015089163228,  -0.435528120713305891,
+                        -0.504115226337448555,  -0.572702331961591218,  -0.641289437585733882,
+                        -0.709876543209876532,  -0.778463648834019195,  -0.847050754458161859};
+
+/// Evaluate the integration rule on the region of center ctr and half widths wth. Return the estimate of the
+/// integral and set rgnerr to its error, idvaxn (from 1) to the coordinate along which the region should be
+/// divided, unchanged if it can't be determined, and zero to whether all the function values are zero.
+double GenzMalikRule(const IMultiGenFunction &f, unsigned int n, const double *ctr, const double *wth, bool absValue,
+                     double &rgnerr, unsigned int &idvaxn, bool &zero)
+{
+   double z[15], wthl[15];
+
+   double rgnvol = std::pow(2.0, static_cast<int>(n)); //=2^n
+   for (unsigned int j=0; j<n; j++) {
+      rgnvol *= wth[j]; //region volume
+      z[j]    = ctr[j]; //temporary node
+   }
+   const double sum1 = f(z); //evaluate function
+
+   double difmax = 0;
+   double sum2   = 0;
+   double sum3   = 0;
+
+   //loop over coordinates
+   for (unsigned int j=0; j<n; j++) {
+      double f2, f3;
+      z[j]    = ctr[j] - xl2*wth[j];
+      if (absValue) f2 = std::abs(f(z));
+      else          f2 = f(z);
+      z[j]    = ctr[j] + xl2*wth[j];
+      if (absValue) f2 += std::abs(f(z));
+      else          f2 += f(z);
+      wthl[j] = xl4*wth[j];
+      z[j]    = ctr[j] - wthl[j];
+      if (absValue) f3 = std::abs(f(z));
+      else          f3 = f(z);
+      z[j]    = ctr[j] + wthl[j];
+      if (absValue) f3 += std::abs(f(z));
+      else          f3 += f(z);
+      sum2   += f2;//sum func eval with different weights separately
+      sum3   += f3;//for a given region
+      const double dif = std::abs(7*f2-f3-12*sum1);
+      //storing dimension with biggest error/difference (?)
+      if (dif >= difmax) {
+         difmax=dif;
+         idvaxn=j+1;
+      }
+      z[j]    = ctr[j];
+   }
+
+   double sum4 = 0;
+   for (unsigned int j=1;j<n;j++) {
+      const unsigned int j1 = j-1;
+      for (unsigned int k=j;k<n;k++) {
+         for (unsigned int l=0;l<2;l++) {
+            wthl[j1] = -wthl[j1];
+            z[j1]    = ctr[j1] + wthl[j1];
+            for (unsigned int m=0;m<2;m++) {
+               wthl[k] = -wthl[k];
+               z[k]    = ctr[k] + wthl[k];
+               if (absValue) sum4 += std::abs(f(z));
+               else            sum4 += f(z);
+            }
+         }
+         z[k] = ctr[k];
+      }
+      z[j1] = ctr[j1];
+   }
+
+   double sum5 = 0;
+
+   for (unsigned int j=0;j<n;j++) {
+      wthl[j] = -xl5*wth[j];
+      z[j] = ctr[j] + wthl[j];
+   }
+   unsigned int j;
+L90: //sum over end nodes ~gray codes
+   if (absValue) sum5 += std::abs(f(z));
+   else          sum5 += f(z);
+   for (j=0;j<n;j++) {
+      wthl[j] = -wthl[j];
+      z[j] = ctr[j] + wthl[j];
+      if (wthl[j] > 0) goto L90;
+   }
+
+   const double rgncmp = rgnvol*(wpn1[n-2]*sum1+wp2*sum2+wpn3[n-2]*sum3+wp4*sum4);
+   double rgnval = wn1[n-2]*sum1+w2*sum2+wn3[n-2]*sum3+w4*sum4+wn5[n-2]*sum5;
+   rgnval *= rgnvol;
+   // avoid difference of too small numbers
+   //rgnval = 1.0E-30;
+   //rgnerr  = TMath::Max( std::abs(rgnval-rgncmp), TMath::Max(std::abs(rgncmp), std::abs(rgnval) )*4.0E-16 );
+   rgnerr  = std::abs(rgnval-rgncmp);//compares estim error with expected error
+   zero = (sum1==0 && sum2==0 && sum3==0 && sum4==0 && sum5==0);
+   return rgnval;
+}
+
+} // namespace
+
 
 
 AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim(double absTol, double relTol, unsigned int maxpts, unsigned int size):
@@ -25,6 +165,8 @@ AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim(double absTol, double rel
    fError(0), fRelError(0),
    fNEval(0),
    fStatus(-1),
+   fExecutionPolicy(ROOT::EExecutionPolicy::kSequential),
+   fNRegionsPerStep(1),
    fFun(0)
 {
    // constructor - without passing a function
@@ -45,6 +187,8 @@ AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim( const IMultiGenFunction
    fError(0), fRelError(0),
    fNEval(0),
    fStatus(-1),
+   fExecutionPolicy(ROOT::EExecutionPolicy::kSequential),
+   fNRegionsPerStep(1),
    fFun(&f)
 {
    // constructur passing a multi-dimensional function interface
@@ -72,6 +216,23 @@ void AdaptiveIntegratorMultiDim::SetRelTolerance(double relTol){ this->fRelTol =
 
 void AdaptiveIntegratorMultiDim::SetAbsTolerance(double absTol){ this->fAbsTol = absTol; }
 
+void AdaptiveIntegratorMultiDim::SetExecutionPolicy(ROOT::EExecutionPolicy policy, unsigned int nregions)
+{
+   // set the execution policy and the number of regions divided at each step in the multi-thread mode
+   if (policy == ROOT::EExecutionPolicy::kMultiProcess) {
+      MATH_ERROR_MSG("AdaptiveIntegratorMultiDim::SetExecutionPolicy",
+                     "Multi-process execution is not supported, use the sequential one");
+      policy = ROOT::EExecutionPolicy::kSequential;
+   }
+#ifndef R__USE_IMT
+   if (policy == ROOT::EExecutionPolicy::kMultiThread)
+      MATH_WARN_MSG("AdaptiveIntegratorMultiDim::SetExecutionPolicy",
+                    "Multi-thread execution requires IMT, which is disabled: the regions are evaluated sequentially");
+#endif
+   fExecutionPolicy = policy;
+   fNRegionsPerStep = std::max(nregions, 1u);
+}
+
 
 double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double * xmax, bool absValue)
 {
@@ -96,45 +257,7 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
    double relerr; //an estimation of the relative accuracy of the result
 
 
-   double ctr[15], wth[15], wthl[15], z[15];
-
-   static const double xl2 = 0.358568582800318073;//lambda_2
-   static const double xl4 = 0.948683298050513796;//lambda_4
-   static const double xl5 = 0.688247201611685289;//lambda_5
-   static const double w2  = 980./6561; //weights/2^n
-   static const double w4  = 200./19683;
-   static const double wp2 = 245./486;//error weights/2^n
-   static const double wp4 = 25./729;
-
-   static const double wn1[14] = {     -0.193872885230909911, -0.555606360818980835,
-                                       -0.876695625666819078, -1.15714067977442459,  -1.39694152314179743,
-                                       -1.59609815576893754,  -1.75461057765584494,  -1.87247878880251983,
-                                       -1.94970278920896201,  -1.98628257887517146,  -1.98221815780114818,
-                                       -1.93750952598689219,  -1.85215668343240347,  -1.72615963013768225};
-
-   static const double wn3[14] = {     0.0518213686937966768,  0.0314992633236803330,
-                                       0.0111771579535639891,-0.00914494741655235473,-0.0294670527866686986,
-                                       -0.0497891581567850424,-0.0701112635269013768, -0.0904333688970177241,
-                                       -0.110755474267134071, -0.131077579637250419,  -0.151399685007366752,
-                                       -0.171721790377483099, -0.192043895747599447,  -0.212366001117715794};
-
-   static const double wn5[14] = {         0.871183254585174982e-01,  0.435591627292587508e-01,
-                                           0.217795813646293754e-01,  0.108897906823146873e-01,  0.544489534115734364e-02,
-                                           0.272244767057867193e-02,  0.136122383528933596e-02,  0.680611917644667955e-03,
-                                           0.340305958822333977e-03,  0.170152979411166995e-03,  0.850764897055834977e-04,
-                                           0.425382448527917472e-04,  0.212691224263958736e-04,  0.106345612131979372e-04};
-
-   static const double wpn1[14] = {   -1.33196159122085045, -2.29218106995884763,
-                                      -3.11522633744855959, -3.80109739368998611, -4.34979423868312742,
-                                      -4.76131687242798352, -5.03566529492455417, -5.17283950617283939,
-                                      -5.17283950617283939, -5.03566529492455417, -4.76131687242798352,
-                                      -4.34979423868312742, -3.80109739368998611, -3.11522633744855959};
-
-   static const double wpn3[14] = {     0.0445816186556927292, -0.0240054869684499309,
-                                        -0.0925925925925925875, -0.161179698216735251,  -0.229766803840877915,
-                                        -0.298353909465020564,  -0.366941015089163228,  -0.435528120713305891,
-                                        -0.504115226337448555,  -0.572702331961591218,  -0.641289437585733882,
-                                        -0.709876543209876532,  -0.778463648834019195,  -0.847050754458161859};
+   double ctr[15], wth[15];
 
    double result = 0;
    double abserr = 0;
@@ -169,6 +292,10 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
    // Here, this array is allocated dynamically
 
    unsigned int iwk = std::max( fSize, irgnst*(1 +maxpts/irlcls)/2 );
+
+   if (fExecutionPolicy == ROOT::EExecutionPolicy::kMultiThread)
+      return DoIntegralBatch(xmin, xmax, absValue, minpts, maxpts, iwk / irgnst);
+
    double *wk = new double[iwk+10];
 
    unsigned int j;
@@ -177,92 +304,13 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
       wth[j] = (xmax[j] - xmin[j])*0.5;//its width
    }
 
-   double rgnvol, sum1, sum2, sum3, sum4, sum5, difmax, f2, f3, dif, aresult;
-   double rgncmp=0, rgnval, rgnerr;
+   double aresult, rgnval, rgnerr;
+   bool zeroSums = false;
 
-   unsigned int j1, k, l, m, idvaxn=0, idvax0=0, isbtmp, isbtpp;
-
-   //InitArgs(z,fParams);
+   unsigned int k, idvaxn=0, idvax0=0, isbtmp, isbtpp;
 
 L20:
-   rgnvol = twondm;//=2^n
-   for (j=0; j<n; j++) {
-      rgnvol *= wth[j]; //region volume
-      z[j]    = ctr[j]; //temporary node
-   }
-   sum1 = (*fFun)((const double*)z);//EvalPar(z,fParams); //evaluate function
-
-   difmax = 0;
-   sum2   = 0;
-   sum3   = 0;
-
-   //loop over coordinates
-   for (j=0; j<n; j++) {
-      z[j]    = ctr[j] - xl2*wth[j];
-      if (absValue) f2 = std::abs((*fFun)(z));
-      else          f2 = (*fFun)(z);
-      z[j]    = ctr[j] + xl2*wth[j];
-      if (absValue) f2 += std::abs((*fFun)(z));
-      else          f2 += (*fFun)(z);
-      wthl[j] = xl4*wth[j];
-      z[j]    = ctr[j] - wthl[j];
-      if (absValue) f3 = std::abs((*fFun)(z));
-      else          f3 = (*fFun)(z);
-      z[j]    = ctr[j] + wthl[j];
-      if (absValue) f3 += std::abs((*fFun)(z));
-      else          f3 += (*fFun)(z);
-      sum2   += f2;//sum func eval with different weights separately
-      sum3   += f3;//for a given region
-      dif     = std::abs(7*f2-f3-12*sum1);
-      //storing dimension with biggest error/difference (?)
-      if (dif >= difmax) {
-         difmax=dif;
-         idvaxn=j+1;
-      }
-      z[j]    = ctr[j];
-   }
-
-   sum4 = 0;
-   for (j=1;j<n;j++) {
-      j1 = j-1;
-      for (k=j;k<n;k++) {
-         for (l=0;l<2;l++) {
-            wthl[j1] = -wthl[j1];
-            z[j1]    = ctr[j1] + wthl[j1];
-            for (m=0;m<2;m++) {
-               wthl[k] = -wthl[k];
-               z[k]    = ctr[k] + wthl[k];
-               if (absValue) sum4 += std::abs((*fFun)(z));
-               else            sum4 += (*fFun)(z);
-            }
-         }
-         z[k] = ctr[k];
-      }
-      z[j1] = ctr[j1];
-   }
-
-   sum5 = 0;
-
-   for (j=0;j<n;j++) {
-      wthl[j] = -xl5*wth[j];
-      z[j] = ctr[j] + wthl[j];
-   }
-L90: //sum over end nodes ~gray codes
-   if (absValue) sum5 += std::abs((*fFun)(z));
-   else          sum5 += (*fFun)(z);
-   for (j=0;j<n;j++) {
-      wthl[j] = -wthl[j];
-      z[j] = ctr[j] + wthl[j];
-      if (wthl[j] > 0) goto L90;
-   }
-
-   rgncmp  = rgnvol*(wpn1[n-2]*sum1+wp2*sum2+wpn3[n-2]*sum3+wp4*sum4);
-   rgnval  = wn1[n-2]*sum1+w2*sum2+wn3[n-2]*sum3+w4*sum4+wn5[n-2]*sum5;
-   rgnval *= rgnvol;
-   // avoid difference of too small numbers
-   //rgnval = 1.0E-30;
-   //rgnerr  = TMath::Max( std::abs(rgnval-rgncmp), TMath::Max(std::abs(rgncmp), std::abs(rgnval) )*4.0E-16 );
-   rgnerr  = std::abs(rgnval-rgncmp);//compares estim error with expected error
+   rgnval = GenzMalikRule(*fFun, n, ctr, wth, absValue, rgnerr, idvaxn, zeroSums);
 
    result += rgnval;
    abserr += rgnerr;
@@ -326,7 +374,7 @@ L160: //to divide or not
    if (relerr < 1e-5 && aresult < 1e-5)  fStatus = 0;
    if (isbrgs+irgnst > iwk) fStatus = 2;
    if (ifncls+2*irlcls > maxpts) {
-      if (sum1==0 && sum2==0 && sum3==0 && sum4==0 && sum5==0){
+      if (zeroSums){
          fStatus = 0;
          result = 0;
       }
@@ -382,6 +430,126 @@ L160: //to divide or not
 }
 
 
+double AdaptiveIntegratorMultiDim::DoIntegralBatch(const double *xmin, const double *xmax, bool absValue,
+                                                   unsigned int minpts, unsigned int maxpts, unsigned int maxrgn)
+{
+   // Same algorithm as DoIntegral, but dividing at each step the fNRegionsPerStep regions with the largest errors,
+   // whose halves are then independent and evaluated in parallel. The regions are kept in a heap ordered by error,
+   // and are processed in a fixed order: the results don't depend on the number of threads.
+
+   struct Region {
+      double fCtr[15];
+      double fWth[15];
+      double fValue;
+      double fError;
+      unsigned int fIdvax; // coordinate (from 1) along which the region is divided
+      bool fZero;          // all function values are zero
+   };
+   auto lessError = [](const Region &r1, const Region &r2) { return r1.fError < r2.fError; };
+
+   const unsigned int n = fDim;
+   const unsigned int irlcls = (1u << n) + 2 * n * (n + 1) + 1;
+
+   std::vector<Region> regions(1);
+   for (unsigned int j = 0; j < n; j++) {
+      regions[0].fCtr[j] = (xmax[j] + xmin[j]) * 0.5;
+      regions[0].fWth[j] = (xmax[j] - xmin[j]) * 0.5;
+   }
+   regions[0].fIdvax = 0;
+   regions[0].fValue =
+      GenzMalikRule(*fFun, n, regions[0].fCtr, regions[0].fWth, absValue, regions[0].fError, regions[0].fIdvax,
+                    regions[0].fZero);
+
+   double result = regions[0].fValue;
+   double abserr = regions[0].fError;
+   bool zeroSums = regions[0].fZero;
+   unsigned int ifncls = irlcls;
+   double relerr = 0;
+
+#ifdef R__USE_IMT
+   ROOT::TThreadExecutor pool;
+#endif
+   std::vector<Region> halves;
+
+   // the stopping conditions are those of DoIntegral
+   fStatus = 3;
+   while (fStatus == 3) {
+      const double aresult = std::abs(result);
+      relerr = abserr;
+      if (aresult != 0)  relerr = abserr/aresult;
+
+      if (relerr < 1e-1 && aresult < 1e-20) fStatus = 0;
+      if (relerr < 1e-3 && aresult < 1e-10) fStatus = 0;
+      if (relerr < 1e-5 && aresult < 1e-5)  fStatus = 0;
+      if (regions.size() + 1 > maxrgn) fStatus = 2;
+      if (ifncls+2*irlcls > maxpts) {
+         if (zeroSums) {
+            fStatus = 0;
+            result = 0;
+         }
+         else
+            fStatus = 1;
+      }
+      if ( ( relerr < fRelTol || abserr < fAbsTol ) && ifncls >= minpts) fStatus = 0;
+      if (fStatus != 3)
+         break;
+
+      // number of regions to divide, within the limits on the function calls and on the number of regions
+      const unsigned int ndiv = std::min({fNRegionsPerStep, static_cast<unsigned int>(regions.size()),
+                                          (maxpts - ifncls) / (2 * irlcls),
+                                          maxrgn - static_cast<unsigned int>(regions.size())});
+      halves.resize(2 * ndiv);
+      for (unsigned int i = 0; i < ndiv; i++) {
+         std::pop_heap(regions.begin(), regions.end(), lessError);
+         const Region &parent = regions.back();
+         result -= parent.fValue;
+         abserr -= parent.fError;
+         unsigned int idvax0 = parent.fIdvax;
+         if (idvax0 < 1) {
+            idvax0 = 1;
+            MATH_ERROR_MSG("AdaptiveIntegratorMultiDim::DoIntegral()", "Logic error: idvax0 < 1!");
+         }
+         Region &lower = halves[2 * i];
+         Region &upper = halves[2 * i + 1];
+         lower = parent;
+         lower.fWth[idvax0 - 1] = 0.5 * parent.fWth[idvax0 - 1];
+         lower.fCtr[idvax0 - 1] -= lower.fWth[idvax0 - 1];
+         upper = lower;
+         upper.fCtr[idvax0 - 1] += 2 * lower.fWth[idvax0 - 1];
+         regions.pop_back();
+      }
+
+      auto evalRegion = [&](unsigned int i) {
+         Region &r = halves[i];
+         r.fValue = GenzMalikRule(*fFun, n, r.fCtr, r.fWth, absValue, r.fError, r.fIdvax, r.fZero);
+      };
+#ifdef R__USE_IMT
+      if (halves.size() > 1)
+         pool.Foreach(evalRegion, ROOT::TSeqI(halves.size()));
+      else
+#endif
+      for (unsigned int i = 0; i < halves.size(); i++)
+         evalRegion(i);
+
+      zeroSums = true;
+      for (const Region &r : halves) {
+         result += r.fValue;
+         abserr += r.fError;
+         zeroSums = zeroSums && r.fZero;
+         regions.push_back(r);
+         std::push_heap(regions.begin(), regions.end(), lessError);
+      }
+      ifncls += halves.size() * irlcls;
+   }
+
+   fResult = result;
+   fError = abserr;
+   fRelError = relerr;
+   fNEval = ifncls;
+
+   return result;
+}
+
 
 double AdaptiveIntegratorMultiDim::Integral(const IMultiGenFunction &f, const double* xmin, const double * xmax)
 {
@@ -653,6 +653,23 @@ bool Fitter::CalculateMinosErrors() {
    unsigned int n = (ipars.size() > 0) ? ipars.size() : fResult->Parameters().size();
    bool ok = false;
 
+   // first try the minimizers computing all the errors together (e.g. Minuit2 with several threads)
+   std::vector<unsigned int> indices(ipars);
+   if (indices.empty()) {
+      for (unsigned int i = 0; i < n; ++i)
+         indices.push_back(i);
+   }
+   std::vector<double> elows, eups;
+   std::vector<bool> valid;
+   if (fMinimizer->GetMinosErrors(indices, elows, eups, valid)) {
+      for (unsigned int i = 0; i < n; ++i) {
+         if (valid[i])
+            fResult->SetMinosError(indices[i], elows[i], eups[i]);
+         ok |= valid[i];
+      }
+      n = 0; // nothing left to compute
+   }
+
    int iparNewMin = 0;
    int iparMax = n;
    int iter = 0;
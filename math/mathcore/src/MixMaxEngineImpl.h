@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <vector>
+#include <algorithm>
 
 #ifndef ROOT_Math_MixMaxEngineImpl
 #define ROOT_Math_MixMaxEngineImpl
@@ -63,6 +64,7 @@ namespace ROOT {
       int Counter() { return -1; }
       void SetCounter(int) {}
       void Iterate() {} 
+      int FillArray(int n, double *) { return n; }
    };
 
 
@@ -122,6 +124,20 @@ public:
    void RndmArray(int n, double * array) {
       fill_array(fRngState, n, array); 
    }
+   // fill at most n numbers with the rest of the state vector, iterating first if it is used up,
+   // giving the same numbers as Rndm(). Return the number of values filled
+   int FillArray(int n, double * array) {
+      if (fRngState->counter > ROOT_MM_N - 1) {
+         iterate(fRngState);
+         fRngState->counter = 1;
+      }
+      const int m = std::min(n, ROOT_MM_N - fRngState->counter);
+      const myuint * v = fRngState->V + fRngState->counter;
+      for (int j = 0; j < m; ++j)
+         array[j] = (int64_t)v[j] * (double)(INV_MERSBASE);
+      fRngState->counter += m;
+      return m;
+   }
    void ReadState(const char filename[] ) {
       read_state(fRngState, filename);
    }
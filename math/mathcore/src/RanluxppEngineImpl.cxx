@@ -290,8 +290,27 @@ public:
    }
 
    /// Initialize and seed the state of the generator as proposed by Sibidanov
-   void SetSeedSibidanov(uint64_t s)
+   ///
+   /// The streams of a seed are spaced by 2 ** 160 states, so that the states
+   /// of all seeds (which are spaced by 2 ** 96 states) fit in between.
+   void SetSeedSibidanov(uint64_t s, uint64_t stream = 0)
    {
+      // The spacings only depend on p, compute them once.
+      struct Multipliers {
+         uint64_t fSeed[9];
+         uint64_t fStream[9];
+         Multipliers()
+         {
+            // Skip 2 ** 96 states.
+            powermod(kA, fSeed, uint64_t(1) << 48);
+            powermod(fSeed, fSeed, uint64_t(1) << 48);
+            // Skip another 2 ** 64 times as many.
+            powermod(fSeed, fStream, uint64_t(1) << 32);
+            powermod(fStream, fStream, uint64_t(1) << 32);
+         }
+      };
+      static const Multipliers kMultipliers;
+
       uint64_t lcg[9];
       lcg[0] = 1;
       for (int i = 1; i < 9; i++) {
@@ -299,12 +318,14 @@ public:
       }
 
       uint64_t a_seed[9];
-      // Skip 2 ** 96 states.
-      powermod(kA, a_seed, uint64_t(1) << 48);
-      powermod(a_seed, a_seed, uint64_t(1) << 48);
-      // Skip another s states.
-      powermod(a_seed, a_seed, s);
+      // Skip s times 2 ** 96 states.
+      powermod(kMultipliers.fSeed, a_seed, s);
       mulmod(a_seed, lcg);
+      if (stream != 0) {
+         // Skip stream times 2 ** 160 states.
+         powermod(kMultipliers.fStream, a_seed, stream);
+         mulmod(a_seed, lcg);
+      }
 
       to_ranlux(lcg, fState, fCarry);
       fPosition = 0;
@@ -419,6 +440,14 @@ double RanluxppEngine<p>::operator()()
    return fImpl->NextRandomFloat();
 }
 
+template <int p>
+void RanluxppEngine<p>::RndmArray(int n, double *array)
+{
+   for (int i = 0; i < n; i++) {
+      array[i] = fImpl->NextRandomFloat();
+   }
+}
+
 template <int p>
 uint64_t RanluxppEngine<p>::IntRndm()
 {
@@ -428,7 +457,23 @@ uint64_t RanluxppEngine<p>::IntRndm()
 template <int p>
 void RanluxppEngine<p>::SetSeed(uint64_t seed)
 {
-   fImpl->SetSeedSibidanov(seed);
+   this->SetSeed(seed, 0);
+}
+
+template <int p>
+void RanluxppEngine<p>::SetSeed(uint64_t seed, uint64_t stream)
+{
+   fSeed = seed;
+   fImpl->SetSeedSibidanov(seed, stream);
+}
+
+template <int p>
+std::unique_ptr<RanluxppEngine<p>> RanluxppEngine<p>::Split(uint64_t stream) const
+{
+   auto engine = std::make_unique<RanluxppEngine>(fSeed);
+   if (stream != 0)
+      engine->SetSeed(fSeed, stream);
+   return engine;
 }
 
 template <int p>
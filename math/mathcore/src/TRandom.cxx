@@ -96,6 +96,10 @@ The following methods are provided to generate random numbers disctributed accor
 - Poisson(Double_t mean)
 - Binomial(Int_t ntot, Double_t prob)
 
+Arrays of numbers can be generated at once with RndmArray(Int_t n, Double_t *array), ExpArray,
+GausArray and PoissonArray. This avoids the cost of one virtual call per number, and the generators
+based on TRandomGen (e.g. ::TRandomMixMax, ::TRandomRanluxpp) use the bulk generation of their engine.
+
 Random numbers distributed according to 1-d, 2-d or 3-d distributions contained in TF1, TF2 or TF3 objects can also be
 generated. For example, to get a random number distributed following abs(sin(x)/x)*sqrt(x) you can do : \code{.cpp} TF1
 *f1 = new TF1("f1","abs(sin(x)/x)*sqrt(x)",0,10); double r = f1->GetRandom(); \endcode or you can use the UNURAN
@@ -255,6 +259,17 @@ Double_t TRandom::Exp(Double_t tau)
    return t;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill an array with n exponential deviates, the same numbers as n calls of Exp.
+/// The uniform numbers are generated at once with RndmArray.
+
+void TRandom::ExpArray(Int_t n, Double_t *array, Double_t tau)
+{
+   RndmArray(n, array);
+   for (Int_t i = 0; i < n; i++)
+      array[i] = -tau * TMath::Log(array[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Samples a random number from the standard Normal (Gaussian) Distribution
 /// with the given mean and sigma.
@@ -353,6 +368,30 @@ Double_t TRandom::Gaus(Double_t mean, Double_t sigma)
    return mean + sigma * result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill an array with n numbers distributed following a gaussian with the given
+/// mean and sigma, using the Box-Muller method as Rannor: the numbers are the
+/// same as Rannor would return (scaled and shifted), not as Gaus.
+/// The uniform numbers are generated at once with RndmArray, which is faster than
+/// n calls of Gaus for the generators with a bulk implementation.
+
+void TRandom::GausArray(Int_t n, Double_t *array, Double_t mean, Double_t sigma)
+{
+   if (n <= 0) return;
+   RndmArray(n, array);
+   for (Int_t i = 0; i + 1 < n; i += 2) {
+      const Double_t r = sigma * TMath::Sqrt(-2*TMath::Log(array[i]));
+      const Double_t x = array[i+1] * 6.28318530717958623;
+      array[i]   = mean + r * TMath::Sin(x);
+      array[i+1] = mean + r * TMath::Cos(x);
+   }
+   if (n % 2) {
+      const Double_t r = sigma * TMath::Sqrt(-2*TMath::Log(array[n-1]));
+      const Double_t x = Rndm() * 6.28318530717958623;
+      array[n-1] = mean + r * TMath::Sin(x);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns a random integer uniformly distributed on the interval [ 0, imax-1 ].
 /// Note that the interval contains the values of 0 and imax-1 but not imax.
@@ -444,6 +483,39 @@ Int_t TRandom::Poisson(Double_t mean)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill an array with n random integers according to a Poisson law, the same numbers
+/// as n calls of Poisson. For mean < 25 the uniform numbers are generated in chunks
+/// with RndmArray: the generator is then left after the last number of the chunk,
+/// which might not have been used.
+
+void TRandom::PoissonArray(Int_t n, Int_t *array, Double_t mean)
+{
+   if (mean <= 0 || mean >= 25) {
+      for (Int_t i = 0; i < n; i++) array[i] = Poisson(mean);
+      return;
+   }
+   const Int_t kBufferSize = 256;
+   const Double_t expmean = TMath::Exp(-mean);
+   Double_t buffer[kBufferSize];
+   Int_t nbuf = 0, ibuf = 0;
+   for (Int_t i = 0; i < n; i++) {
+      Int_t k = -1;
+      Double_t pir = 1;
+      do {
+         if (ibuf == nbuf) {
+            // on average mean + 1 numbers are needed for each Poisson number
+            nbuf = (Int_t)TMath::Min((n - i) * (mean + 1) + 1, (Double_t)kBufferSize);
+            RndmArray(nbuf, buffer);
+            ibuf = 0;
+         }
+         k++;
+         pir *= buffer[ibuf++];
+      } while (pir > expmean);
+      array[i] = k;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Generates a random number according to a Poisson law.
 /// Prob(N) = exp(-mean)*mean^N/Factorial(N)
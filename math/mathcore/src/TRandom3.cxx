@@ -56,6 +56,7 @@ fast as Mersenne and Twister is MIXMAX (TRandomMixMax).
 /////////////////////////////////////////////////////////////////////
 
 #include "TRandom3.h"
+#include "TMath.h"
 #include "TBuffer.h"
 #include "TRandom2.h"
 #include "TUUID.h"
@@ -142,7 +143,13 @@ Double_t TRandom3::Rndm()
 
 void TRandom3::RndmArray(Int_t n, Float_t *array)
 {
-  for(Int_t i=0; i<n; i++) array[i]=(Float_t)Rndm();
+   // generate in chunks with the double precision version
+   Double_t buffer[256];
+   for (Int_t i = 0; i < n; i += 256) {
+      const Int_t m = TMath::Min(n - i, 256);
+      RndmArray(m, buffer);
+      for (Int_t j = 0; j < m; j++) array[i+j] = (Float_t)buffer[j];
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -47,6 +47,32 @@ TEST(RanluxppEngine, random2048)
    EXPECT_EQ(rng.Rndm(), 0.74670661284082484599);
 }
 
+TEST(RanluxppEngine, streams2048)
+{
+   // The stream 0 is the same as seeding without stream.
+   RanluxppEngine2048 rng;
+   rng.SetSeed(314159265, 0);
+   EXPECT_EQ(rng.IntRndm(), 39378223178113);
+   EXPECT_EQ(rng.Rndm(), 0.57072241146576274673);
+
+   rng.SetSeed(314159265, 1);
+   EXPECT_EQ(rng.IntRndm(), 150481958067667);
+   EXPECT_EQ(rng.Rndm(), 0.72624191984431973879);
+
+   rng.SetSeed(314159265, 2);
+   EXPECT_EQ(rng.IntRndm(), 206525151607305);
+   EXPECT_EQ(rng.Rndm(), 0.59498887014734336276);
+
+   // Split doesn't depend on the numbers generated so far.
+   RanluxppEngine2048 parent(314159265);
+   for (int i = 0; i < 100; i++) {
+      parent.Rndm();
+   }
+   auto stream = parent.Split(1);
+   EXPECT_EQ(stream->IntRndm(), 150481958067667);
+   EXPECT_EQ(stream->Rndm(), 0.72624191984431973879);
+}
+
 TEST(RanluxppCompatEngineJames, P3)
 {
    RanluxppCompatEngineJamesP3 rng(314159265);
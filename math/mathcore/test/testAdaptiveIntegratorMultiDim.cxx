@@ -0,0 +1,70 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "Math/AdaptiveIntegratorMultiDim.h"
+#include "Math/Functor.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+using namespace ROOT::Math;
+
+namespace {
+
+// Gaussian of width sigma centred at 0.3 in each coordinate, integrated over [-1, 1]^n
+double Gaus(const double *x, unsigned int n, double sigma)
+{
+   double r2 = 0;
+   for (unsigned int i = 0; i < n; i++)
+      r2 += (x[i] - 0.3) * (x[i] - 0.3);
+   return std::exp(-r2 / (2 * sigma * sigma));
+}
+
+double GausIntegral(unsigned int n, double sigma)
+{
+   const double s2 = sigma * std::sqrt(2.);
+   return std::pow(sigma * std::sqrt(M_PI / 2) * (std::erf(0.7 / s2) + std::erf(1.3 / s2)), n);
+}
+
+} // namespace
+
+TEST(AdaptiveIntegratorMultiDim, MultiThread)
+{
+   const double xmin[3] = {-1, -1, -1};
+   const double xmax[3] = {1, 1, 1};
+   for (double sigma : {0.5, 0.05}) {
+      Functor f([&](const double *x) { return Gaus(x, 3, sigma); }, 3);
+      AdaptiveIntegratorMultiDim ig(f, 0., 1e-7, 1000000);
+      const double seq = ig.Integral(xmin, xmax);
+      EXPECT_EQ(ig.Status(), 0);
+
+      ig.SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread, 16);
+      EXPECT_EQ(ig.ExecutionPolicy(), ROOT::EExecutionPolicy::kMultiThread);
+      const double mt = ig.Integral(xmin, xmax);
+      EXPECT_EQ(ig.Status(), 0);
+      EXPECT_NEAR(mt, seq, 1e-6 * seq);
+      EXPECT_NEAR(mt, GausIntegral(3, sigma), 1e-6 * mt);
+      EXPECT_LT(ig.RelError(), 1e-7);
+
+      // the same regions are divided whatever the number of threads: same result
+      EXPECT_EQ(ig.Integral(xmin, xmax), mt);
+   }
+}
+
+TEST(AdaptiveIntegratorMultiDim, MultiThreadCallLimit)
+{
+   const double xmin[5] = {-1, -1, -1, -1, -1};
+   const double xmax[5] = {1, 1, 1, 1, 1};
+   Functor f([](const double *x) { return Gaus(x, 5, 0.05); }, 5);
+   AdaptiveIntegratorMultiDim ig(f, 0., 1e-10, 20000);
+   ig.SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread, 8);
+   ig.Integral(xmin, xmax);
+   EXPECT_EQ(ig.Status(), 1);
+   EXPECT_LE(ig.NEval(), 20000);
+}
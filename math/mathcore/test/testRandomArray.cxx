@@ -0,0 +1,93 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// The array methods of the generators must return the same numbers as the
+// single calls, also across the blocks of the engines.
+
+#include "TRandom3.h"
+#include "TRandomGen.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+template <class Generator>
+void CheckRndmArray()
+{
+   Generator r1(4357);
+   Generator r2(4357);
+   for (int offset : {0, 5, 238, 239, 240, 623}) {
+      for (int i = 0; i < offset; ++i) {
+         r1.Rndm();
+         r2.Rndm();
+      }
+      std::vector<double> v(1000 + offset);
+      r1.RndmArray(v.size(), v.data());
+      for (double x : v)
+         EXPECT_EQ(x, r2.Rndm());
+      std::vector<float> vf(300);
+      r1.RndmArray(vf.size(), vf.data());
+      for (float x : vf)
+         EXPECT_EQ(x, (float)r2.Rndm());
+      EXPECT_EQ(r1.Rndm(), r2.Rndm());
+   }
+}
+
+TEST(RandomArray, TRandom3)
+{
+   CheckRndmArray<TRandom3>();
+}
+
+TEST(RandomArray, TRandomMixMax)
+{
+   CheckRndmArray<TRandomMixMax>();
+   CheckRndmArray<TRandomMixMax17>();
+   CheckRndmArray<TRandomMixMax256>();
+}
+
+TEST(RandomArray, TRandomRanluxpp)
+{
+   CheckRndmArray<TRandomRanluxpp>();
+}
+
+TEST(RandomArray, TRandomMT64)
+{
+   CheckRndmArray<TRandomMT64>();
+}
+
+TEST(RandomArray, Transforms)
+{
+   TRandomMixMax r1(111);
+   TRandomMixMax r2(111);
+
+   std::vector<double> v(101);
+   r1.ExpArray(v.size(), v.data(), 2.);
+   for (double x : v)
+      EXPECT_EQ(x, r2.Exp(2.));
+
+   r1.GausArray(v.size(), v.data(), 1., 3.);
+   for (std::size_t i = 0; i + 1 < v.size(); i += 2) {
+      double a, b;
+      r2.Rannor(a, b);
+      EXPECT_DOUBLE_EQ(v[i], 1. + 3. * a);
+      EXPECT_DOUBLE_EQ(v[i + 1], 1. + 3. * b);
+   }
+   r2.Rndm(); // the last one
+   EXPECT_EQ(r1.Rndm(), r2.Rndm());
+
+   for (double mean : {0.5, 3., 20., 100.}) {
+      TRandomMixMax p1(222);
+      TRandomMixMax p2(222);
+      std::vector<int> n(1000);
+      p1.PoissonArray(n.size(), n.data(), mean);
+      for (int k : n)
+         EXPECT_EQ(k, p2.Poisson(mean));
+   }
+}
@@ -0,0 +1,122 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "Math/SMatrixBatch.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace ROOT::Math;
+
+namespace {
+
+constexpr unsigned int kLanes = ROOT::Math::Internal::BatchSize<ROOT::Double_v>();
+
+using SMatrixSym5 = SMatrix<double, 5, 5, MatRepSym<double, 5>>;
+
+// positive definite matrices A A^T + 1
+std::vector<SMatrixSym5> MakeCovariances(unsigned int n, std::mt19937 &gen)
+{
+   std::uniform_real_distribution<double> uniform(-1., 1.);
+   std::vector<SMatrixSym5> covs(n);
+   for (auto &cov : covs) {
+      SMatrix<double, 5, 5> a;
+      for (unsigned int i = 0; i < 25; ++i)
+         a.Array()[i] = uniform(gen);
+      for (unsigned int i = 0; i < 5; ++i)
+         for (unsigned int j = 0; j <= i; ++j)
+            cov(i, j) = Dot(a.Row(i), a.Row(j)) + (i == j ? 1. : 0.);
+   }
+   return covs;
+}
+
+} // namespace
+
+TEST(SMatrixBatch, GatherScatter)
+{
+   std::mt19937 gen(1);
+   const unsigned int n = kLanes > 1 ? kLanes - 1 : 1;
+   auto covs = MakeCovariances(n, gen);
+
+   SMatrixSym_v<5> batch;
+   Gather(batch, covs.data(), n);
+   std::vector<SMatrixSym5> out(n);
+   Scatter(batch, out.data(), n);
+   for (unsigned int i = 0; i < n; ++i)
+      EXPECT_EQ(out[i], covs[i]);
+   // the unused lanes hold the first matrix
+   for (unsigned int lane = n; lane < kLanes; ++lane)
+      EXPECT_EQ(ROOT::Math::Internal::GetLane(batch(1, 2), lane), covs[0](1, 2));
+
+   std::vector<SVector<double, 5>> vecs(n);
+   for (unsigned int i = 0; i < n; ++i)
+      vecs[i] = covs[i].Row(0);
+   SVector_v<5> vecBatch;
+   Gather(vecBatch, vecs.data(), n);
+   std::vector<SVector<double, 5>> vecsOut(n);
+   Scatter(vecBatch, vecsOut.data(), n);
+   for (unsigned int i = 0; i < n; ++i)
+      EXPECT_EQ(vecsOut[i], vecs[i]);
+}
+
+TEST(SMatrixBatch, PropagateAndInvert)
+{
+   std::mt19937 gen(2);
+   std::uniform_real_distribution<double> uniform(-1., 1.);
+   auto covs = MakeCovariances(kLanes, gen);
+   std::vector<SMatrix<double, 5, 5>> jacs(kLanes);
+   std::vector<SVector<double, 5>> vecs(kLanes);
+   for (unsigned int l = 0; l < kLanes; ++l) {
+      for (unsigned int i = 0; i < 25; ++i)
+         jacs[l].Array()[i] = uniform(gen);
+      for (unsigned int i = 0; i < 5; ++i)
+         vecs[l][i] = uniform(gen);
+   }
+
+   SMatrixSym_v<5> cov;
+   SMatrix_v<5, 5> jac;
+   SVector_v<5> vec;
+   Gather(cov, covs.data(), kLanes);
+   Gather(jac, jacs.data(), kLanes);
+   Gather(vec, vecs.data(), kLanes);
+
+   SMatrixSym_v<5> propagated = Similarity(jac, cov);
+   SVector_v<5> product = propagated * vec;
+   ROOT::Double_v chi2 = Similarity(vec, cov);
+   ASSERT_TRUE(propagated.InvertChol());
+
+   std::vector<SMatrixSym5> inverses(kLanes);
+   std::vector<SVector<double, 5>> products(kLanes);
+   Scatter(propagated, inverses.data(), kLanes);
+   Scatter(product, products.data(), kLanes);
+   for (unsigned int l = 0; l < kLanes; ++l) {
+      SMatrixSym5 expected = Similarity(jacs[l], covs[l]);
+      SVector<double, 5> expectedProduct = expected * vecs[l];
+      EXPECT_TRUE(expected.InvertChol());
+      for (unsigned int i = 0; i < SMatrixSym5::rep_type::kSize; ++i)
+         EXPECT_NEAR(inverses[l].Array()[i], expected.Array()[i], 1e-9 * std::abs(expected.Array()[i]) + 1e-12);
+      for (unsigned int i = 0; i < 5; ++i)
+         EXPECT_NEAR(products[l][i], expectedProduct[i], 1e-12 * std::abs(expectedProduct[i]) + 1e-12);
+      EXPECT_NEAR(ROOT::Math::Internal::GetLane(chi2, l), Similarity(vecs[l], covs[l]), 1e-12);
+   }
+}
+
+TEST(SMatrixBatch, InvertCholFailsForAnyLane)
+{
+   std::mt19937 gen(3);
+   auto covs = MakeCovariances(kLanes, gen);
+   // not positive definite
+   covs[kLanes - 1](2, 2) = -1.;
+
+   SMatrixSym_v<5> batch;
+   Gather(batch, covs.data(), kLanes);
+   EXPECT_FALSE(batch.InvertChol());
+}
@@ -26,6 +26,12 @@
 
 #include "TDecompChol.h"
 #include "TMath.h"
+#include "TMatrixTParallel.h"
+
+#ifdef MATRIX_USE_BLAS
+// from the LAPACK library, with matrix_blas=ON
+extern "C" void dpotrf_(const char *uplo, const int *n, double *a, const int *lda, int *info);
+#endif
 
 ClassImp(TDecompChol);
 
@@ -112,9 +118,20 @@ Bool_t TDecompChol::Decompose()
       return kFALSE;
    }
 
-   Int_t i,j,icol,irow;
+   Int_t icol,irow;
    const Int_t     n  = fU.GetNrows();
          Double_t *pU = fU.GetMatrixArray();
+#ifdef MATRIX_USE_BLAS
+   // The upper triangle U of the row-major matrix, with A = U^T U, is the lower triangle L = U^T
+   // of the column-major matrix of LAPACK, with A = L L^T
+   Int_t info = 0;
+   if (n > 0)
+      dpotrf_("L",&n,pU,&n,&info);
+   if (info != 0) {
+      Error("Decompose()","matrix not positive definite");
+      return kFALSE;
+   }
+#else
    for (icol = 0; icol < n; icol++) {
       const Int_t rowOff = icol*n;
 
@@ -132,16 +149,21 @@ Bool_t TDecompChol::Decompose()
       pU[rowOff+icol] = ujj;
 
       if (icol < n-1) {
-         for (j = icol+1; j < n; j++) {
-            for (i = 0; i < icol; i++) {
+         // Subtract the contributions of the rows above row by row, to run over contiguous elements,
+         // and on the IMT thread pool for large matrices
+         TMatrixTParallel::ForBlocks(icol+1,n,512,Double_t(icol)*(n-icol-1),[&](Int_t jBegin,Int_t jEnd) {
+            for (Int_t i = 0; i < icol; i++) {
                const Int_t rowOff2 = i*n;
-               pU[rowOff+j] -= pU[rowOff2+j]*pU[rowOff2+icol];
+               const Double_t uic = pU[rowOff2+icol];
+               for (Int_t j = jBegin; j < jEnd; j++)
+                  pU[rowOff+j] -= pU[rowOff2+j]*uic;
             }
-         }
-         for (j = icol+1; j < n; j++)
-            pU[rowOff+j] /= ujj;
+            for (Int_t j = jBegin; j < jEnd; j++)
+               pU[rowOff+j] /= ujj;
+         });
       }
    }
+#endif
 
    for (irow = 0; irow < n; irow++) {
       const Int_t rowOff = irow*n;
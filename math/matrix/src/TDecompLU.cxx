@@ -11,6 +11,11 @@
 
 #include "TDecompLU.h"
 #include "TMath.h"
+#include "TMatrixTParallel.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 ClassImp(TDecompLU);
 
@@ -624,17 +629,24 @@ Bool_t TDecompLU::DecomposeLUCrout(TMatrixD &lu,Int_t *index,Double_t &sign,
       scale[i] = (max == 0.0 ? 0.0 : 1.0/max);
    }
 
+   // The jth column is copied to a contiguous buffer while it is computed, and the rows below the
+   // diagonal are computed on the IMT thread pool for large matrices
+   const Int_t kRowBlock = 64;
+   std::vector<Double_t> col(n);
+   std::vector<std::pair<Double_t,Int_t>> blockMax((n+kRowBlock-1)/kRowBlock);
+
    for (Int_t j = 0; j < n; j++) {
       const Int_t off_j = j*n;
+      for (Int_t i = 0; i < n; i++)
+         col[i] = pLU[i*n+j];
+
       // Run down jth column from top to diag, to form the elements of U.
       for (Int_t i = 0; i < j; i++) {
          const Int_t off_i = i*n;
-         Double_t r = pLU[off_i+j];
-         for (Int_t k = 0; k < i; k++) {
-            const Int_t off_k = k*n;
-            r -= pLU[off_i+k]*pLU[off_k+j];
-         }
-         pLU[off_i+j] = r;
+         Double_t r = col[i];
+         for (Int_t k = 0; k < i; k++)
+            r -= pLU[off_i+k]*col[k];
+         col[i] = r;
       }
 
       // Run down jth subdiag to form the residuals after the elimination of
@@ -642,22 +654,37 @@ Bool_t TDecompLU::DecomposeLUCrout(TMatrixD &lu,Int_t *index,Double_t &sign,
       // diagonal term will become the multipliers in the elimination of the jth.
       // subdiag. Find fIndex of largest scaled term in imax.
 
+      TMatrixTParallel::ForBlocks(j,n,kRowBlock,Double_t(j)*(n-j),[&](Int_t iBegin,Int_t iEnd) {
+         for (Int_t iBlock = iBegin; iBlock < iEnd; iBlock += kRowBlock) {
+            Double_t max = 0.0;
+            Int_t imax = -1;
+            for (Int_t i = iBlock; i < std::min(iEnd,iBlock+kRowBlock); i++) {
+               const Int_t off_i = i*n;
+               Double_t r = col[i];
+               for (Int_t k = 0; k < j; k++)
+                  r -= pLU[off_i+k]*col[k];
+               col[i] = r;
+               const Double_t tmp = scale[i]*TMath::Abs(r);
+               if (tmp >= max) {
+                  max = tmp;
+                  imax = i;
+               }
+            }
+            blockMax[(iBlock-j)/kRowBlock] = std::make_pair(max,imax);
+         }
+      });
+
+      // the last of the largest terms, as without blocks
       Double_t max = 0.0;
       Int_t imax = 0;
-      for (Int_t i = j; i < n; i++) {
-         const Int_t off_i = i*n;
-         Double_t r = pLU[off_i+j];
-         for (Int_t k = 0; k < j; k++) {
-            const Int_t off_k = k*n;
-            r -= pLU[off_i+k]*pLU[off_k+j];
-         }
-         pLU[off_i+j] = r;
-         const Double_t tmp = scale[i]*TMath::Abs(r);
-         if (tmp >= max) {
-            max = tmp;
-            imax = i;
+      for (Int_t b = 0; b*kRowBlock < n-j; b++) {
+         if (blockMax[b].second >= 0 && blockMax[b].first >= max) {
+            max = blockMax[b].first;
+            imax = blockMax[b].second;
          }
       }
+      for (Int_t i = 0; i < n; i++)
+         pLU[i*n+j] = col[i];
 
       // Permute current row with imax
       if (j != imax) {
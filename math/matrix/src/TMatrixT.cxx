@@ -20,6 +20,7 @@ See the \ref Matrix page for the documentation of the linear algebra package
 
 */
 
+#include <algorithm>
 #include <typeinfo>
 
 #include "TMatrixT.h"
@@ -30,6 +31,17 @@ See the \ref Matrix page for the documentation of the linear algebra package
 #include "TDecompLU.h"
 #include "TMatrixDEigen.h"
 #include "TMath.h"
+#include "TMatrixTParallel.h"
+
+#ifdef MATRIX_USE_BLAS
+// from the BLAS library, with matrix_blas=ON
+extern "C" void dgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k,
+                       const double *alpha, const double *a, const int *lda, const double *b, const int *ldb,
+                       const double *beta, double *c, const int *ldc);
+extern "C" void sgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k,
+                       const float *alpha, const float *a, const int *lda, const float *b, const int *ldb,
+                       const float *beta, float *c, const int *ldc);
+#endif
 
 templateClassImp(TMatrixT);
 
@@ -3071,74 +3083,152 @@ TMatrixT<Element> &TMatrixTAutoloadOps::ElementDiv(TMatrixT<Element> &target,con
    return target;
 }
 
+namespace {
+
+// Blocks of the elementary multiplication routines: rows of C per task, and columns of C and terms of the sums
+// processed together, so that the blocks of A, B and C fit in the L2 cache.
+constexpr Int_t kRowBlock = 32;
+constexpr Int_t kColBlock = 256;
+constexpr Int_t kSumBlock = 128;
+
+#ifdef MATRIX_USE_BLAS
+////////////////////////////////////////////////////////////////////////////////
+/// C (m x n) = op(A) * op(B) with BLAS. The row-major matrices are the transposed of the column-major ones of BLAS,
+/// so that it computes C^T = op(B)^T * op(A)^T. The leading dimensions are the row lengths of A and B.
+
+void Gemm(char transa, char transb, Int_t m, Int_t n, Int_t k, const Double_t *ap, Int_t lda, const Double_t *bp,
+          Int_t ldb, Double_t *cp)
+{
+   const Double_t one = 1.0, zero = 0.0;
+   dgemm_(&transb, &transa, &n, &m, &k, &one, bp, &ldb, ap, &lda, &zero, cp, &n);
+}
+
+void Gemm(char transa, char transb, Int_t m, Int_t n, Int_t k, const Float_t *ap, Int_t lda, const Float_t *bp,
+          Int_t ldb, Float_t *cp)
+{
+   const Float_t one = 1.0, zero = 0.0;
+   sgemm_(&transb, &transa, &n, &m, &k, &one, bp, &ldb, ap, &lda, &zero, cp, &n);
+}
+#endif
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A*B
+///
+/// Without BLAS (build option matrix_blas), the sums are blocked to stay in the cache and the rows of C are
+/// computed on the IMT thread pool for large matrices; every element is summed in the same order as the
+/// straightforward loop.
 
 template<class Element>
 void TMatrixTAutoloadOps::AMultB(const Element * const ap,Int_t na,Int_t ncolsa,
             const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *arp0 = ap;                     // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *arp = arp0;                       // Pointer to the i-th row of A, reset to A[i,0]
-         Element cij = 0;
-         while (bcp < bp+nb) {                     // Scan the i-th row of A and
-            cij += *arp++ * *bcp;                   // the j-th col of B
-            bcp += ncolsb;
+   (void)nb;
+   if (ncolsa == 0 || ncolsb == 0)
+      return;
+   const Int_t nrowsa = na/ncolsa;
+#ifdef MATRIX_USE_BLAS
+   Gemm('N', 'N', nrowsa, ncolsb, ncolsa, ap, ncolsa, bp, ncolsb, cp);
+#else
+   const Double_t nops = Double_t(nrowsa) * ncolsa * ncolsb;
+   TMatrixTParallel::ForBlocks(0, nrowsa, kRowBlock, nops, [&](Int_t rowBegin, Int_t rowEnd) {
+      std::fill(cp + rowBegin * ncolsb, cp + rowEnd * ncolsb, Element(0));
+      for (Int_t jb = 0; jb < ncolsb; jb += kColBlock) {
+         const Int_t je = std::min(ncolsb, jb + kColBlock);
+         for (Int_t lb = 0; lb < ncolsa; lb += kSumBlock) {
+            const Int_t le = std::min(ncolsa, lb + kSumBlock);
+            for (Int_t i = rowBegin; i < rowEnd; i++) {
+               const Element *arp = ap + i * ncolsa;       // Pointer to the i-th row of A
+                     Element *crp = cp + i * ncolsb;       // Pointer to the i-th row of C
+               for (Int_t l = lb; l < le; l++) {
+                  const Element  ail = arp[l];
+                  const Element *brp = bp + l * ncolsb;    // Pointer to the l-th row of B
+                  for (Int_t j = jb; j < je; j++)
+                     crp[j] += ail * brp[j];
+               }
+            }
          }
-         *cp++ = cij;
-         bcp -= nb-1;                              // Set bcp to the (j+1)-th col
       }
-      arp0 += ncolsa;                             // Set ap to the (i+1)-th row
-   }
+   });
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Elementary routine to calculate matrix multiplication A^T*B
+/// Elementary routine to calculate matrix multiplication A^T*B, see AMultB
 
 template<class Element>
 void TMatrixTAutoloadOps::AtMultB(const Element * const ap,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *acp0 = ap;           // Pointer to  A[i,0];
-   while (acp0 < ap+ncolsa) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
-         Element cij = 0;
-         while (bcp < bp+nb) {           // Scan the i-th column of A and
-            cij += *acp * *bcp;           // the j-th col of B
-            acp += ncolsa;
-            bcp += ncolsb;
+   if (ncolsa == 0 || ncolsb == 0)
+      return;
+   const Int_t nrowsb = nb/ncolsb;
+   if (nrowsb == 0) {
+      std::fill(cp, cp + ncolsa * ncolsb, Element(0));
+      return;
+   }
+#ifdef MATRIX_USE_BLAS
+   Gemm('T', 'N', ncolsa, ncolsb, nrowsb, ap, ncolsa, bp, ncolsb, cp);
+#else
+   const Double_t nops = Double_t(ncolsa) * nrowsb * ncolsb;
+   TMatrixTParallel::ForBlocks(0, ncolsa, kRowBlock, nops, [&](Int_t rowBegin, Int_t rowEnd) {
+      std::fill(cp + rowBegin * ncolsb, cp + rowEnd * ncolsb, Element(0));
+      for (Int_t jb = 0; jb < ncolsb; jb += kColBlock) {
+         const Int_t je = std::min(ncolsb, jb + kColBlock);
+         for (Int_t lb = 0; lb < nrowsb; lb += kSumBlock) {
+            const Int_t le = std::min(nrowsb, lb + kSumBlock);
+            for (Int_t i = rowBegin; i < rowEnd; i++) {
+               Element *crp = cp + i * ncolsb;             // Pointer to the i-th row of C
+               for (Int_t l = lb; l < le; l++) {
+                  const Element  ali = ap[l * ncolsa + i];
+                  const Element *brp = bp + l * ncolsb;    // Pointer to the l-th row of B
+                  for (Int_t j = jb; j < je; j++)
+                     crp[j] += ali * brp[j];
+               }
+            }
          }
-         *cp++ = cij;
-         bcp -= nb-1;                    // Set bcp to the (j+1)-th col
       }
-      acp0++;                           // Set acp0 to the (i+1)-th col
-   }
+   });
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Elementary routine to calculate matrix multiplication A*B^T
+/// Elementary routine to calculate matrix multiplication A*B^T, see AMultB
 
 template<class Element>
 void TMatrixTAutoloadOps::AMultBt(const Element * const ap,Int_t na,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *arp0 = ap;                    // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      const Element *brp0 = bp;                  // Pointer to  B[j,0];
-      while (brp0 < bp+nb) {
-         const Element *arp = arp0;               // Pointer to the i-th row of A, reset to A[i,0]
-         const Element *brp = brp0;               // Pointer to the j-th row of B, reset to B[j,0]
-         Element cij = 0;
-         while (brp < brp0+ncolsb)                 // Scan the i-th row of A and
-            cij += *arp++ * *brp++;                 // the j-th row of B
-         *cp++ = cij;
-         brp0 += ncolsb;                           // Set brp0 to the (j+1)-th row
+   if (ncolsa == 0 || ncolsb == 0)
+      return;
+   const Int_t nrowsa = na/ncolsa;
+   const Int_t nrowsb = nb/ncolsb;
+#ifdef MATRIX_USE_BLAS
+   Gemm('N', 'T', nrowsa, nrowsb, ncolsa, ap, ncolsa, bp, ncolsb, cp);
+#else
+   const Double_t nops = Double_t(nrowsa) * nrowsb * ncolsa;
+   TMatrixTParallel::ForBlocks(0, nrowsa, kRowBlock, nops, [&](Int_t rowBegin, Int_t rowEnd) {
+      std::fill(cp + rowBegin * nrowsb, cp + rowEnd * nrowsb, Element(0));
+      // the rows of B are the columns of C
+      for (Int_t lb = 0; lb < ncolsa; lb += kSumBlock) {
+         const Int_t le = std::min(ncolsa, lb + kSumBlock);
+         for (Int_t jb = 0; jb < nrowsb; jb += kRowBlock) {
+            const Int_t je = std::min(nrowsb, jb + kRowBlock);
+            for (Int_t i = rowBegin; i < rowEnd; i++) {
+               const Element *arp = ap + i * ncolsa;       // Pointer to the i-th row of A
+               for (Int_t j = jb; j < je; j++) {
+                  const Element *brp = bp + j * ncolsb;    // Pointer to the j-th row of B
+                  Element cij = cp[i * nrowsb + j];
+                  for (Int_t l = lb; l < le; l++)
+                     cij += arp[l] * brp[l];
+                  cp[i * nrowsb + j] = cij;
+               }
+            }
+         }
       }
-      arp0 += ncolsa;                             // Set arp0 to the (i+1)-th row
-   }
+   });
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
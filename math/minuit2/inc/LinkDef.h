@@ -41,6 +41,7 @@
 #pragma link C++ class ROOT::Minuit2::FunctionMinimizer;
 #pragma link C++ class ROOT::Minuit2::ModularFunctionMinimizer;
 #pragma link C++ class ROOT::Minuit2::VariableMetricMinimizer;
+#pragma link C++ class ROOT::Minuit2::LBFGSMinimizer;
 #pragma link C++ class ROOT::Minuit2::SimplexMinimizer;
 #pragma link C++ class ROOT::Minuit2::CombinedMinimizer;
 #pragma link C++ class ROOT::Minuit2::ScanMinimizer;
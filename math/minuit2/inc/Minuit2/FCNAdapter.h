@@ -43,6 +43,9 @@ public:
 
    void SetErrorDef(double up) override { fUp = up; }
 
+   /// the adapted function
+   const Function &GetFunction() const { return fFunc; }
+
    // virtual std::vector<double> Gradient(const std::vector<double>&) const;
 
    // forward interface
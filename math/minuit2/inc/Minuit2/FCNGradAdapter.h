@@ -43,6 +43,9 @@ public:
 
    double Up() const override { return fUp; }
 
+   /// the adapted function
+   const Function &GetFunction() const { return fFunc; }
+
    std::vector<double> Gradient(const std::vector<double> &v) const override
    {
       fFunc.Gradient(&v[0], &fGrad[0]);
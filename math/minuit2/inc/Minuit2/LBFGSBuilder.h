@@ -0,0 +1,66 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2022 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#ifndef ROOT_Minuit2_LBFGSBuilder
+#define ROOT_Minuit2_LBFGSBuilder
+
+#include "Minuit2/MnConfig.h"
+#include "Minuit2/MinimumBuilder.h"
+#include "Minuit2/MnMatrix.h"
+
+#include <deque>
+#include <vector>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+/**
+   Build (find) function minimum using the limited-memory BFGS method (L-BFGS, see
+   J. Nocedal, Updating quasi-Newton matrices with limited storage, Math. Comp. 35 (1980) 773).
+
+   Instead of the dense inverse Hessian of the VariableMetricBuilder, only the last
+   Memory() pairs of parameter and gradient differences are kept, and the Newton step
+   is computed from them with the two-loop recursion: memory and time per iteration
+   are O(Memory() * N) instead of O(N^2), which matters for thousands of parameters.
+   The diagonal of the seed error matrix is used as initial inverse Hessian.
+
+   The error matrix of the resulting minimum is only a diagonal approximation, flagged
+   with Dcovar = 1, so that the Minuit2Minimizer runs MnHesse at the end when errors
+   are requested.
+ */
+class LBFGSBuilder : public MinimumBuilder {
+
+public:
+   LBFGSBuilder(unsigned int memory = 10) : fMemory(memory) {}
+
+   ~LBFGSBuilder() override {}
+
+   FunctionMinimum Minimum(const MnFcn &, const GradientCalculator &, const MinimumSeed &, const MnStrategy &,
+                           unsigned int, double) const override;
+
+   /// number of correction pairs used to approximate the inverse Hessian
+   unsigned int Memory() const { return fMemory; }
+   void SetMemory(unsigned int memory) { fMemory = memory > 0 ? memory : 1; }
+
+   void AddResult(std::vector<MinimumState> &result, const MinimumState &state) const;
+
+private:
+   /// apply the inverse Hessian approximation H0 * scale, corrected by the stored pairs, to the vector v
+   MnAlgebraicVector InvHessianTimes(const MnAlgebraicVector &v, const MnAlgebraicVector &h0, double scale,
+                                     const std::deque<MnAlgebraicVector> &s, const std::deque<MnAlgebraicVector> &y,
+                                     const std::deque<double> &rho) const;
+
+   unsigned int fMemory;
+};
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // ROOT_Minuit2_LBFGSBuilder
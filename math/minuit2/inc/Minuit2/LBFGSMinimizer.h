@@ -0,0 +1,49 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2022 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#ifndef ROOT_Minuit2_LBFGSMinimizer
+#define ROOT_Minuit2_LBFGSMinimizer
+
+#include "Minuit2/MnConfig.h"
+#include "Minuit2/ModularFunctionMinimizer.h"
+#include "Minuit2/MnSeedGenerator.h"
+#include "Minuit2/LBFGSBuilder.h"
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+//______________________________________________________________________________
+/**
+    Instantiates the SeedGenerator and MinimumBuilder for the
+    limited-memory BFGS minimization method, for problems with many parameters.
+    API is provided in the upper ROOT::Minuit2::ModularFunctionMinimizer class
+
+ */
+
+class LBFGSMinimizer : public ModularFunctionMinimizer {
+
+public:
+   LBFGSMinimizer(unsigned int memory = 10) : fMinSeedGen(MnSeedGenerator()), fMinBuilder(LBFGSBuilder(memory)) {}
+
+   ~LBFGSMinimizer() override {}
+
+   const MinimumSeedGenerator &SeedGenerator() const override { return fMinSeedGen; }
+   const MinimumBuilder &Builder() const override { return fMinBuilder; }
+   MinimumBuilder &Builder() override { return fMinBuilder; }
+
+private:
+   MnSeedGenerator fMinSeedGen;
+   LBFGSBuilder fMinBuilder;
+};
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // ROOT_Minuit2_LBFGSMinimizer
@@ -30,9 +30,10 @@ class ModularFunctionMinimizer;
 class FCNBase;
 class FunctionMinimum;
 class MnTraceObject;
+class MnCross;
 
 // enumeration specifying the type of Minuit2 minimizers
-enum EMinimizerType { kMigrad, kSimplex, kCombined, kScan, kFumili, kMigradBFGS };
+enum EMinimizerType { kMigrad, kSimplex, kCombined, kScan, kFumili, kMigradBFGS, kLBFGS };
 
 } // namespace Minuit2
 
@@ -43,7 +44,8 @@ namespace Minuit2 {
    Minuit2 minimization algorithm.
    In ROOT it can be instantiated using the plug-in manager (plug-in "Minuit2")
    Using a string  (used by the plugin manager) or via an enumeration
-   an one can set all the possible minimization algorithms (Migrad, Simplex, Combined, Scan and Fumili).
+   an one can set all the possible minimization algorithms (Migrad, Simplex, Combined, Scan, Fumili
+   and LBFGS, a limited-memory variant of Migrad for thousands of parameters).
 
    Refer to the [guide](https://root.cern.ch/root/htmldoc/guides/minuit2/Minuit2.html) for an introduction how Minuit
    works.
@@ -236,6 +238,16 @@ public:
    */
    bool GetMinosError(unsigned int i, double &errLow, double &errUp, int = 0) override;
 
+   /**
+      get the Minos errors of several parameters. With the extra option "NThreads" > 1 and ROOT built
+      with IMT, the lower and upper errors of all the parameters are computed at the same time on
+      several threads, each with a copy (Clone) of the objective function, whose evaluation must then
+      be thread-safe. Return false if this is not used or if a new minimum is found, in which case
+      the errors must be computed with GetMinosError.
+   */
+   bool GetMinosErrors(const std::vector<unsigned int> &ivars, std::vector<double> &errLow,
+                       std::vector<double> &errUp, std::vector<bool> &valid) override;
+
    /**
       MINOS status code of last Minos run
        `status & 1 > 0`  : invalid lower error
@@ -305,6 +317,9 @@ protected:
    // internal function to compute Minos errors
    int RunMinosError(unsigned int i, double &errLow, double &errUp, int runopt);
 
+   // internal function to process the result of the Minos crossings
+   int MinosResult(unsigned int i, const MnCross &low, const MnCross &up, int runopt, double &errLow, double &errUp);
+
 private:
    unsigned int fDim; // dimension of the function to be minimized
    bool fUseFumili;
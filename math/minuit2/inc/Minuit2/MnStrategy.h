@@ -48,6 +48,11 @@ public:
 
    int StorageLevel() const { return fStoreLevel; }
 
+   /// Number of threads used to evaluate the components of the numerical gradient and the off-diagonal elements of
+   /// the Hessian concurrently (1 = sequential evaluation, the default). Only for thread-safe FCNs and if
+   /// ROOT is built with implicit multi-threading support.
+   unsigned int NThreads() const { return fNThreads; }
+
    bool IsLow() const { return fStrategy == 0; }
    bool IsMedium() const { return fStrategy == 1; }
    bool IsHigh() const { return fStrategy >= 2; }
@@ -69,6 +74,8 @@ public:
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
 
+   void SetNThreads(unsigned int n) { fNThreads = n; }
+
 private:
    unsigned int fStrategy;
 
@@ -80,6 +87,7 @@ private:
    double fHessTlrG2;
    unsigned int fHessGradNCyc;
    int fStoreLevel;
+   unsigned int fNThreads;
 };
 
 } // namespace Minuit2
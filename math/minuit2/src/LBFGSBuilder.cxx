@@ -0,0 +1,225 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2022 LCG ROOT Math team,  CERN/EP-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#include "Minuit2/LBFGSBuilder.h"
+#include "Minuit2/GradientCalculator.h"
+#include "Minuit2/MinimumState.h"
+#include "Minuit2/MinimumError.h"
+#include "Minuit2/FunctionGradient.h"
+#include "Minuit2/FunctionMinimum.h"
+#include "Minuit2/MnLineSearch.h"
+#include "Minuit2/MinimumSeed.h"
+#include "Minuit2/MnFcn.h"
+#include "Minuit2/MnMachinePrecision.h"
+#include "Minuit2/MnParabolaPoint.h"
+#include "Minuit2/LaSum.h"
+#include "Minuit2/LaProd.h"
+#include "Minuit2/MnStrategy.h"
+#include "Minuit2/MnPrint.h"
+
+#include <cmath>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+double inner_product(const LAVector &, const LAVector &);
+
+void LBFGSBuilder::AddResult(std::vector<MinimumState> &result, const MinimumState &state) const
+{
+   result.push_back(state);
+   if (TraceIter())
+      TraceIteration(result.size() - 1, result.back());
+   else {
+      MnPrint print("LBFGSBuilder", PrintLevel());
+      print.Info(MnPrint::Oneline(result.back(), result.size() - 1));
+   }
+}
+
+MnAlgebraicVector LBFGSBuilder::InvHessianTimes(const MnAlgebraicVector &v, const MnAlgebraicVector &h0, double scale,
+                                                const std::deque<MnAlgebraicVector> &s,
+                                                const std::deque<MnAlgebraicVector> &y,
+                                                const std::deque<double> &rho) const
+{
+   // two-loop recursion, the pairs are stored from the oldest to the newest
+   const unsigned int m = s.size();
+   std::vector<double> alpha(m);
+   MnAlgebraicVector q = v;
+   for (unsigned int k = m; k-- > 0;) {
+      alpha[k] = rho[k] * inner_product(s[k], q);
+      q -= alpha[k] * y[k];
+   }
+   for (unsigned int i = 0; i < q.size(); i++)
+      q(i) *= scale * h0(i);
+   for (unsigned int k = 0; k < m; k++) {
+      const double beta = rho[k] * inner_product(y[k], q);
+      q += (alpha[k] - beta) * s[k];
+   }
+   return q;
+}
+
+FunctionMinimum LBFGSBuilder::Minimum(const MnFcn &fcn, const GradientCalculator &gc, const MinimumSeed &seed,
+                                      const MnStrategy &, unsigned int maxfcn, double edmval) const
+{
+   MnPrint print("LBFGSBuilder", PrintLevel());
+
+   // same convention for the tolerance as the VariableMetricBuilder
+   edmval *= 0.002;
+
+   FunctionMinimum min(seed, fcn.Up());
+
+   const unsigned int n = seed.Parameters().Vec().size();
+   if (n == 0) {
+      print.Warn("No free parameters.");
+      return min;
+   }
+
+   if (!seed.IsValid()) {
+      print.Error("Minimum seed invalid.");
+      return min;
+   }
+
+   const MnMachinePrecision &prec = seed.Precision();
+
+   // the diagonal of the seed error matrix is the initial inverse Hessian, scaled after each update
+   MnAlgebraicVector h0(n);
+   for (unsigned int i = 0; i < n; i++) {
+      const double v = seed.Error().InvHessian()(i, i);
+      h0(i) = v > 0. ? v : 1.;
+   }
+   double scale = 1.;
+   std::deque<MnAlgebraicVector> sHist;
+   std::deque<MnAlgebraicVector> yHist;
+   std::deque<double> rhoHist;
+
+   std::vector<MinimumState> result;
+   result.reserve(StorageLevel() > 0 ? 10 : 2);
+
+   print.Info("Start iterating until Edm is <", edmval, "with call limit =", maxfcn, "and memory", fMemory);
+
+   AddResult(result, seed.State());
+
+   MinimumParameters p = seed.Parameters();
+   FunctionGradient g = seed.Gradient();
+   MnLineSearch lsearch;
+
+   // H * g, the opposite of the step of the next iteration
+   MnAlgebraicVector hg = InvHessianTimes(g.Grad(), h0, scale, sHist, yHist, rhoHist);
+   double edm = 0.5 * inner_product(g.Grad(), hg);
+
+   while (edm > edmval && fcn.NumOfCalls() < maxfcn) {
+
+      // check if derivatives are not zero
+      if (inner_product(g.Grad(), g.Grad()) <= 0) {
+         print.Debug("all derivatives are zero - return current status");
+         break;
+      }
+
+      MnAlgebraicVector step = -1. * hg;
+      double gdel = inner_product(step, g.Grad());
+
+      if (gdel >= 0.) {
+         // the stored pairs are positive definite, this can only come from rounding: start over from H0
+         print.Warn("Step is not a descent direction, gdel =", gdel, "; dropping the stored corrections");
+         sHist.clear();
+         yHist.clear();
+         rhoHist.clear();
+         scale = 1.;
+         step = -1. * InvHessianTimes(g.Grad(), h0, scale, sHist, yHist, rhoHist);
+         gdel = inner_product(step, g.Grad());
+         if (gdel >= 0.)
+            break;
+      }
+
+      MnParabolaPoint pp = lsearch(fcn, p, step, gdel, prec);
+
+      // <= needed for case 0 <= 0
+      if (std::fabs(pp.Y() - p.Fval()) <= std::fabs(p.Fval()) * prec.Eps()) {
+         print.Warn("No improvement in line search");
+         break;
+      }
+
+      MinimumParameters pNew(p.Vec() + pp.X() * step, pp.Y());
+      FunctionGradient gNew = gc(pNew, g);
+
+      MnAlgebraicVector sk = pNew.Vec() - p.Vec();
+      MnAlgebraicVector yk = gNew.Grad() - g.Grad();
+      const double sy = inner_product(sk, yk);
+
+      // keep the approximation positive definite: skip the pair if the curvature condition does not hold
+      if (sy > prec.Eps() * std::sqrt(inner_product(sk, sk) * inner_product(yk, yk))) {
+         if (sHist.size() == fMemory) {
+            sHist.pop_front();
+            yHist.pop_front();
+            rhoHist.pop_front();
+         }
+         double yh0y = 0.;
+         for (unsigned int i = 0; i < n; i++)
+            yh0y += yk(i) * h0(i) * yk(i);
+         // scale H0 to the curvature along the last step (Nocedal & Wright, Numerical Optimization, eq. 7.20)
+         scale = sy / yh0y;
+         sHist.push_back(std::move(sk));
+         yHist.push_back(std::move(yk));
+         rhoHist.push_back(1. / sy);
+      } else {
+         print.Debug("Curvature condition not satisfied, s*y =", sy, "; correction skipped");
+      }
+
+      p = pNew;
+      g = gNew;
+      hg = InvHessianTimes(g.Grad(), h0, scale, sHist, yHist, rhoHist);
+      edm = 0.5 * inner_product(g.Grad(), hg);
+
+      if (std::isnan(edm)) {
+         print.Warn("Edm is NaN; stop iterations");
+         break;
+      }
+
+      // only the final state has an error matrix, to keep the memory linear in the number of parameters
+      AddResult(result, MinimumState(p.Fval(), edm, fcn.NumOfCalls()));
+   }
+
+   // approximate diagonal error matrix, flagged with Dcovar = 1 as not accurate
+   MnAlgebraicSymMatrix invHessian(n);
+   for (unsigned int i = 0; i < n; i++)
+      invHessian(i, i) = scale * h0(i);
+   MinimumState last(p, MinimumError(invHessian, 1.), g, edm, fcn.NumOfCalls());
+   if (result.size() > 1)
+      result.back() = last;
+   else
+      result.push_back(last);
+
+   if (fcn.NumOfCalls() >= maxfcn) {
+      print.Warn("Call limit exceeded");
+
+      return FunctionMinimum(seed, result, fcn.Up(), FunctionMinimum::MnReachedCallLimit);
+   }
+
+   if (edm > edmval) {
+      if (edm < std::fabs(prec.Eps2() * result.back().Fval())) {
+         print.Warn("Machine accuracy limits further improvement");
+
+         return FunctionMinimum(seed, result, fcn.Up());
+      } else if (edm < 10 * edmval) {
+         return FunctionMinimum(seed, result, fcn.Up());
+      } else {
+         print.Warn("Iterations finish without convergence; Edm", edm, "Requested", edmval);
+
+         return FunctionMinimum(seed, result, fcn.Up(), FunctionMinimum::MnAboveMaxEdm);
+      }
+   }
+
+   print.Debug("Exiting successfully;", "Ncalls", fcn.NumOfCalls(), "FCN", result.back().Fval(), "Edm", edm,
+               "Requested", edmval);
+
+   return FunctionMinimum(seed, result, fcn.Up());
+}
+
+} // namespace Minuit2
+
+} // namespace ROOT
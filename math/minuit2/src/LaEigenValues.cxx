@@ -10,6 +10,14 @@
 #include "Minuit2/LAVector.h"
 #include "Minuit2/LASymMatrix.h"
 
+#ifdef MINUIT2_USE_BLAS
+#include <vector>
+
+// from the LAPACK library, with minuit2_blas=ON
+extern "C" void dspev_(const char *jobz, const char *uplo, const int *n, double *ap, double *w, double *z,
+                       const int *ldz, double *work, int *info);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -21,6 +29,24 @@ LAVector eigenvalues(const LASymMatrix &mat)
    // calculate eigenvalues of symmetric matrices using mneigen function (transalte from fortran Minuit)
    unsigned int nrow = mat.Nrow();
 
+#ifdef MINUIT2_USE_BLAS
+   // eigenvalues only, in ascending order like mneigen; dspev overwrites the packed matrix, the copy and the work
+   // buffer are kept across calls
+   thread_local std::vector<double> packed;
+   thread_local std::vector<double> work;
+   packed.assign(mat.Data(), mat.Data() + mat.size());
+   work.resize(3 * nrow);
+
+   LAVector result(nrow);
+   const int n = nrow;
+   const int ldz = 1;
+   int info = 0;
+   dspev_("N", "U", &n, packed.data(), result.Data(), nullptr, &ldz, work.data(), &info);
+   (void)info;
+   assert(info == 0);
+
+   return result;
+#else
    LAVector tmp(nrow * nrow);
    LAVector work(2 * nrow);
 
@@ -39,6 +65,7 @@ LAVector eigenvalues(const LASymMatrix &mat)
       result(i) = work(i);
 
    return result;
+#endif
 }
 
 } // namespace Minuit2
@@ -10,12 +10,48 @@
 #include "Minuit2/LaInverse.h"
 #include "Minuit2/LASymMatrix.h"
 
+#ifdef MINUIT2_USE_BLAS
+#include <vector>
+
+// from the LAPACK library, with minuit2_blas=ON
+extern "C" void dsptrf_(const char *uplo, const int *n, double *ap, int *ipiv, int *info);
+extern "C" void dsptri_(const char *uplo, const int *n, double *ap, const int *ipiv, double *work, int *info);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
 
 int mnvert(LASymMatrix &t);
 
+#ifdef MINUIT2_USE_BLAS
+namespace {
+
+/// Inversion of the packed symmetric matrix with the Bunch-Kaufman factorization of LAPACK. The work buffers are kept
+/// across calls, as the matrices inverted during a minimization all have the same size.
+int InvertWithLapack(LASymMatrix &t)
+{
+   const int n = t.Nrow();
+   // fail where mnvert fails, which scales the matrix by the square root of its diagonal
+   for (int i = 0; i < n; i++)
+      if (t(i, i) < 0.)
+         return 1;
+
+   thread_local std::vector<int> ipiv;
+   thread_local std::vector<double> work;
+   ipiv.resize(n);
+   work.resize(n);
+
+   int info = 0;
+   dsptrf_("U", &n, t.Data(), ipiv.data(), &info);
+   if (info == 0)
+      dsptri_("U", &n, t.Data(), ipiv.data(), work.data(), &info);
+   return info == 0 ? 0 : 1;
+}
+
+} // namespace
+#endif
+
 // symmetric matrix (positive definite only)
 
 int Invert(LASymMatrix &t)
@@ -32,7 +68,11 @@ int Invert(LASymMatrix &t)
       else
          t.Data()[0] = 1. / tmp;
    } else {
+#ifdef MINUIT2_USE_BLAS
+      ifail = InvertWithLapack(t);
+#else
       ifail = mnvert(t);
+#endif
    }
 
    return ifail;
@@ -29,6 +29,7 @@
 #include "Minuit2/MnUserFcn.h"
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/VariableMetricMinimizer.h"
+#include "Minuit2/LBFGSMinimizer.h"
 #include "Minuit2/SimplexMinimizer.h"
 #include "Minuit2/CombinedMinimizer.h"
 #include "Minuit2/ScanMinimizer.h"
@@ -42,10 +43,16 @@
 #include <iostream>
 #include <algorithm>
 #include <functional>
+#include <memory>
 
 #ifdef USE_ROOT_ERROR
 #include "TROOT.h"
 #include "TMinuit2TraceObject.h"
+#include "RConfigure.h"
+#endif
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
 #endif
 
 namespace ROOT {
@@ -108,6 +115,8 @@ Minuit2Minimizer::Minuit2Minimizer(const char *type) : Minimizer(), fDim(0), fMi
       algoType = kFumili;
    if (algoname == "bfgs")
       algoType = kMigradBFGS;
+   if (algoname == "lbfgs")
+      algoType = kLBFGS;
 
    SetMinimizerType(algoType);
 }
@@ -125,6 +134,7 @@ void Minuit2Minimizer::SetMinimizerType(ROOT::Minuit2::EMinimizerType type)
       // std::cout << "Minuit2Minimizer: minimize using MIGRAD " << std::endl;
       SetMinimizer(new ROOT::Minuit2::VariableMetricMinimizer(VariableMetricMinimizer::BFGSType()));
       return;
+   case ROOT::Minuit2::kLBFGS: SetMinimizer(new ROOT::Minuit2::LBFGSMinimizer()); return;
    case ROOT::Minuit2::kSimplex:
       // std::cout << "Minuit2Minimizer: minimize using SIMPLEX " << std::endl;
       SetMinimizer(new ROOT::Minuit2::SimplexMinimizer());
@@ -485,6 +495,9 @@ bool Minuit2Minimizer::Minimize()
       minuit2Opt->GetValue("HessianStepTolerance", hessStepTol);
       minuit2Opt->GetValue("HessianG2Tolerance", hessG2Tol);
 
+      int nThreads = strategy.NThreads();
+      minuit2Opt->GetValue("NThreads", nThreads);
+
       strategy.SetGradientNCycles(nGradCycles);
       strategy.SetHessianNCycles(nHessCycles);
       strategy.SetHessianGradientNCycles(nHessGradCycles);
@@ -492,7 +505,8 @@ bool Minuit2Minimizer::Minimize()
       strategy.SetGradientTolerance(gradTol);
       strategy.SetGradientStepTolerance(gradStepTol);
       strategy.SetHessianStepTolerance(hessStepTol);
-      strategy.SetHessianG2Tolerance(hessStepTol);
+      strategy.SetHessianG2Tolerance(hessG2Tol);
+      strategy.SetNThreads(std::max(nThreads, 1));
 
       int storageLevel = 1;
       bool ret = minuit2Opt->GetValue("StorageLevel", storageLevel);
@@ -900,6 +914,106 @@ bool Minuit2Minimizer::GetMinosError(unsigned int i, double &errLow, double &err
    return isValid;
 }
 
+bool Minuit2Minimizer::GetMinosErrors(const std::vector<unsigned int> &ivars, std::vector<double> &errLow,
+                                      std::vector<double> &errUp, std::vector<bool> &valid)
+{
+   // compute the Minos errors of all the parameters ivars on several threads, if requested with the
+   // extra option NThreads. Each of the lower and upper crossings (a minimization each) is an independent
+   // task, evaluating its own copy (Clone) of the objective function.
+   // Return false, so that the errors are computed serially, in the other cases and if a new minimum
+   // is found (which requires to minimize again before computing the other errors).
+
+#ifdef R__USE_IMT
+   ROOT::Math::IOptions *minuit2Opt = ROOT::Math::MinimizerOptions::FindDefault("Minuit2");
+   int nThreads = 1;
+   if (minuit2Opt)
+      minuit2Opt->GetValue("NThreads", nThreads);
+   if (nThreads <= 1 || ivars.empty() || fUseFumili || !fMinimum || !fMinimum->IsValid())
+      return false;
+
+   using GenFCN = FCNAdapter<ROOT::Math::IMultiGenFunction>;
+   using GradFCN = FCNGradAdapter<ROOT::Math::IMultiGradFunction>;
+   const GenFCN *genFCN = dynamic_cast<const GenFCN *>(fMinuitFCN);
+   const GradFCN *gradFCN = dynamic_cast<const GradFCN *>(fMinuitFCN);
+   if (!genFCN && !gradFCN)
+      return false;
+
+   for (unsigned int ivar : ivars) {
+      if (ivar >= fState.MinuitParameters().size())
+         return false;
+   }
+
+   MnPrint print("Minuit2Minimizer::GetMinosErrors", PrintLevel());
+
+   fMinuitFCN->SetErrorDef(ErrorDef());
+   if (ErrorDef() != fMinimum->Up())
+      fMinimum->SetErrorDef(ErrorDef());
+   if (Precision() > 0)
+      fState.SetPrecision(Precision());
+
+   const int prev_level = (PrintLevel() <= 0) ? TurnOffPrintInfoLevel() : -2;
+   const int prevGlobalLevel = MnPrint::SetGlobalLevel(PrintLevel());
+
+   const unsigned int maxfcn = MaxFunctionCalls();
+   const double tol = std::max(Tolerance(), 0.01);
+
+   const unsigned int n = ivars.size();
+   std::vector<MnCross> crossings(2 * n);
+   auto runCrossing = [&](unsigned int k) {
+      const unsigned int ivar = ivars[k / 2];
+      if (fState.Parameter(ivar).IsConst() || fState.Parameter(ivar).IsFixed())
+         return;
+      std::unique_ptr<ROOT::Math::IMultiGenFunction> func;
+      std::unique_ptr<FCNBase> fcn;
+      if (gradFCN) {
+         func.reset(gradFCN->GetFunction().Clone());
+         fcn.reset(new GradFCN(dynamic_cast<const ROOT::Math::IMultiGradFunction &>(*func), ErrorDef()));
+      } else {
+         func.reset(genFCN->GetFunction().Clone());
+         fcn.reset(new GenFCN(*func, ErrorDef()));
+      }
+      MnMinos minos(*fcn, *fMinimum);
+      crossings[k] = (k % 2 == 0) ? minos.Loval(ivar, maxfcn, tol) : minos.Upval(ivar, maxfcn, tol);
+   };
+
+   print.Info("Run MINOS for", n, "parameters on", nThreads, "threads");
+   ROOT::TThreadExecutor pool(nThreads);
+   pool.Foreach(runCrossing, ROOT::TSeqU(2 * n));
+
+   if (prev_level > -2)
+      RestoreGlobalPrintLevel(prev_level);
+   MnPrint::SetGlobalLevel(prevGlobalLevel);
+
+   for (unsigned int i = 0; i < n; ++i) {
+      if (crossings[2 * i].NewMinimum() || crossings[2 * i + 1].NewMinimum()) {
+         print.Info("Found a new minimum: compute the Minos errors again serially");
+         return false;
+      }
+   }
+
+   errLow.assign(n, 0.);
+   errUp.assign(n, 0.);
+   valid.assign(n, false);
+   fMinosStatus = 0;
+   for (unsigned int i = 0; i < n; ++i) {
+      const unsigned int ivar = ivars[i];
+      if (fState.Parameter(ivar).IsConst() || fState.Parameter(ivar).IsFixed())
+         continue;
+      const int mstatus = MinosResult(ivar, crossings[2 * i], crossings[2 * i + 1], 0, errLow[i], errUp[i]);
+      fStatus += 10 * mstatus;
+      fMinosStatus |= mstatus;
+      valid[i] = ((mstatus & 1) == 0) && ((mstatus & 2) == 0);
+   }
+   return true;
+#else
+   (void)ivars;
+   (void)errLow;
+   (void)errUp;
+   (void)valid;
+   return false;
+#endif
+}
+
 int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errUp, int runopt)
 {
 
@@ -956,13 +1070,28 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       up = minos.Upval(i, maxfcn, tol);
    }
 
-   ROOT::Minuit2::MinosError me(i, fMinimum->UserState().Value(i), low, up);
-
    // restore global print level
    if (prev_level > -2)
       RestoreGlobalPrintLevel(prev_level);
    MnPrint::SetGlobalLevel(prevGlobalLevel);
 
+   return MinosResult(i, low, up, runopt, errLow, errUp);
+}
+
+int Minuit2Minimizer::MinosResult(unsigned int i, const MnCross &low, const MnCross &up, int runopt, double &errLow,
+                                  double &errUp)
+{
+   // print the result of the Minos crossings of parameter i, return the Minos status and
+   // update the state if a new minimum has been found
+
+   bool runLower = runopt != 2;
+   bool runUpper = runopt != 1;
+
+   const int debugLevel = PrintLevel();
+   const char *par_name = fState.Name(i);
+
+   ROOT::Minuit2::MinosError me(i, fMinimum->UserState().Value(i), low, up);
+
    // debug result of Minos
    // print error message in Minos
    // Note that the only invalid condition can happen when the (npar-1) minimization fails
@@ -1207,7 +1336,13 @@ bool Minuit2Minimizer::Hesse()
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnHesse hesse(strategy);
+   // the Hessian is computed on several threads if requested in the extra options
+   ROOT::Minuit2::MnStrategy mnStrategy(strategy);
+   ROOT::Math::IOptions *minuit2Opt = ROOT::Math::MinimizerOptions::FindDefault("Minuit2");
+   int nThreads = 1;
+   if (minuit2Opt && minuit2Opt->GetValue("NThreads", nThreads))
+      mnStrategy.SetNThreads(std::max(nThreads, 1));
+   ROOT::Minuit2::MnHesse hesse(mnStrategy);
 
    // case when function minimum exists
    if (fMinimum) {
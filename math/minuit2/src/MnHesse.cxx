@@ -21,6 +21,14 @@
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h"
+#endif
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -236,6 +244,24 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
 
    // off-diagonal Elements
    // initial starting values
+#ifdef R__USE_IMT
+   // one task per row, each with its own copy of the point (the FCN must be thread-safe, see MnStrategy::SetNThreads)
+   if (fStrategy.NThreads() > 1 && n > 1) {
+      ROOT::TThreadExecutor pool(fStrategy.NThreads());
+      pool.Foreach(
+         [&](unsigned int i) {
+            MnAlgebraicVector xi = x;
+            xi(i) += dirin(i);
+            for (unsigned int j = i + 1; j < n; j++) {
+               xi(j) += dirin(j);
+               double fs1 = mfcn(xi);
+               vhmat(i, j) = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+               xi(j) -= dirin(j);
+            }
+         },
+         ROOT::TSeqU(n - 1));
+   } else
+#endif
    if (n > 0) {
       MPIProcess mpiprocOffDiagonal(n * (n - 1) / 2, 0);
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
@@ -21,6 +21,14 @@
 #include <omp.h>
 #endif
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h"
+#endif
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
 #include <cmath>
 #include <cassert>
 #include <iomanip>
@@ -97,35 +105,9 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around value", fcnmin, "at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // compute the derivatives of parameter i, moving x(i) and restoring it afterwards; printing the cycles is not
+   // synchronized with the threads of the TThreadExecutor, hence optional
+   auto computeComponent = [&](unsigned int i, MnAlgebraicVector &x, bool printCycles) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
@@ -172,7 +154,7 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 #ifdef _OPENMP
 #pragma omp critical
 #endif
-         {
+         if (printCycles) {
 #ifdef _OPENMP
             // must create thread-local MnPrint instances when printing inside threads
             MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
@@ -209,17 +191,54 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
             break;
          }
       }
+   };
+
+#ifdef R__USE_IMT
+   // the components are independent, the FCN must be thread-safe (see MnStrategy::SetNThreads)
+   if (Strategy().NThreads() > 1 && n > 1) {
+      ROOT::TThreadExecutor pool(Strategy().NThreads());
+      pool.Foreach(
+         [&](unsigned int i) {
+            MnAlgebraicVector x = par.Vec();
+            computeComponent(i, x, false);
+         },
+         ROOT::TSeqU(n));
+   } else
+#endif
+   {
+#ifndef _OPENMP
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
-   }
+      MPIProcess mpiproc(n, 0);
+
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+
+      unsigned int startElementIndex = mpiproc.StartElementIndex();
+      unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++)
+         computeComponent(i, x, true);
+
+      mpiproc.SyncVector(grd);
+      mpiproc.SyncVector(g2);
+      mpiproc.SyncVector(gstep);
+
+#else
+
+      // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+      //#pragma omp for schedule (static, N_PARALLEL_PAR)
+
+      for (int i = 0; i < int(n); i++) {
+         // create in loop since each thread will use its own copy
+         MnAlgebraicVector x = par.Vec();
+         computeComponent(i, x, true);
+      }
 
-#ifndef _OPENMP
-   mpiproc.SyncVector(grd);
-   mpiproc.SyncVector(g2);
-   mpiproc.SyncVector(gstep);
 #endif
+   }
 
    // print after parallel processing to avoid synchronization issues
    print.Debug([&](std::ostream &os) {
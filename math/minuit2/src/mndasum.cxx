@@ -14,12 +14,21 @@
 
 #include <cmath>
 
+#ifdef MINUIT2_USE_BLAS
+// from the BLAS library, with minuit2_blas=ON
+extern "C" double dasum_(const int *n, const double *dx, const int *incx);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
 
 double mndasum(unsigned int n, const double *dx, int incx)
 {
+#ifdef MINUIT2_USE_BLAS
+   const int nn = n;
+   return dasum_(&nn, dx, &incx);
+#else
    /* System generated locals */
    int i__1, i__2;
    double ret_val, d__1, d__2, d__3, d__4, d__5, d__6;
@@ -88,6 +97,7 @@ L40:
 L60:
    ret_val = dtemp;
    return ret_val;
+#endif
 } /* dasum_ */
 
 } // namespace Minuit2
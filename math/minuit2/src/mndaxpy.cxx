@@ -12,12 +12,22 @@
       -lf2c -lm   (in that order)
 */
 
+#ifdef MINUIT2_USE_BLAS
+// from the BLAS library, with minuit2_blas=ON
+extern "C" void daxpy_(const int *n, const double *da, const double *dx, const int *incx, double *dy, const int *incy);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
 
 int Mndaxpy(unsigned int n, double da, const double *dx, int incx, double *dy, int incy)
 {
+#ifdef MINUIT2_USE_BLAS
+   const int nn = n;
+   daxpy_(&nn, &da, dx, &incx, dy, &incy);
+   return 0;
+#else
    /* System generated locals */
    int i__1;
 
@@ -92,6 +102,7 @@ L40:
       /* L50: */
    }
    return 0;
+#endif
 } /* daxpy_ */
 
 } // namespace Minuit2
@@ -12,12 +12,21 @@
    -lf2c -lm   (in that order)
 */
 
+#ifdef MINUIT2_USE_BLAS
+// from the BLAS library, with minuit2_blas=ON
+extern "C" double ddot_(const int *n, const double *dx, const int *incx, const double *dy, const int *incy);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
 
 double mnddot(unsigned int n, const double *dx, int incx, const double *dy, int incy)
 {
+#ifdef MINUIT2_USE_BLAS
+   const int nn = n;
+   return ddot_(&nn, dx, &incx, dy, &incy);
+#else
    /* System generated locals */
    int i__1;
    double ret_val;
@@ -95,6 +104,7 @@ L40:
 L60:
    ret_val = dtemp;
    return ret_val;
+#endif
 } /* ddot_ */
 
 } // namespace Minuit2
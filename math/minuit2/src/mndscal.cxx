@@ -12,12 +12,22 @@
    -lf2c -lm   (in that order)
 */
 
+#ifdef MINUIT2_USE_BLAS
+// from the BLAS library, with minuit2_blas=ON
+extern "C" void dscal_(const int *n, const double *da, double *dx, const int *incx);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
 
 int Mndscal(unsigned int n, double da, double *dx, int incx)
 {
+#ifdef MINUIT2_USE_BLAS
+   const int nn = n;
+   dscal_(&nn, &da, dx, &incx);
+   return 0;
+#else
    /* System generated locals */
    int i__1, i__2;
 
@@ -81,6 +91,7 @@ L40:
       /* L50: */
    }
    return 0;
+#endif
 } /* dscal_ */
 
 } // namespace Minuit2
@@ -12,6 +12,12 @@
    -lf2c -lm   (in that order)
 */
 
+#ifdef MINUIT2_USE_BLAS
+// from the BLAS library, with minuit2_blas=ON
+extern "C" void dspmv_(const char *uplo, const int *n, const double *alpha, const double *ap, const double *x,
+                       const int *incx, const double *beta, double *y, const int *incy);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -22,6 +28,11 @@ int mnxerbla(const char *, int);
 int Mndspmv(const char *uplo, unsigned int n, double alpha, const double *ap, const double *x, int incx, double beta,
             double *y, int incy)
 {
+#ifdef MINUIT2_USE_BLAS
+   const int nn = n;
+   dspmv_(uplo, &nn, &alpha, ap, x, &incx, &beta, y, &incy);
+   return 0;
+#else
    /* System generated locals */
    int i__1, i__2;
 
@@ -311,6 +322,7 @@ int Mndspmv(const char *uplo, unsigned int n, double alpha, const double *ap, co
 
    /*     End of DSPMV . */
 
+#endif
 } /* dspmv_ */
 
 } // namespace Minuit2
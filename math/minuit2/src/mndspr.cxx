@@ -12,6 +12,12 @@
    -lf2c -lm   (in that order)
 */
 
+#ifdef MINUIT2_USE_BLAS
+// from the BLAS library, with minuit2_blas=ON
+extern "C" void dspr_(const char *uplo, const int *n, const double *alpha, const double *x, const int *incx,
+                      double *ap);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -21,6 +27,11 @@ int mnxerbla(const char *, int);
 
 int mndspr(const char *uplo, unsigned int n, double alpha, const double *x, int incx, double *ap)
 {
+#ifdef MINUIT2_USE_BLAS
+   const int nn = n;
+   dspr_(uplo, &nn, &alpha, x, &incx, ap);
+   return 0;
+#else
    /* System generated locals */
    int i__1, i__2;
 
@@ -236,6 +247,7 @@ int mndspr(const char *uplo, unsigned int n, double alpha, const double *x, int
 
    /*     End of DSPR  . */
 
+#endif
 } /* dspr_ */
 
 } // namespace Minuit2
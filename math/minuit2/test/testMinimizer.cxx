@@ -649,6 +649,7 @@ int testRosenBrock()
 
    iret |= testNewMinimizer(fRB, xRB, s0, "Minuit", "");
    iret |= testNewMinimizer(fRB, xRB, s0, "Minuit2", "");
+   iret |= testNewMinimizer(fRB, xRB, s0, "Minuit2", "LBFGS");
 
    //    iret |= testNewMinimizer(fRB,xRB,s0,"GSLMultiMin","ConjugateFR");
    //    iret |= testNewMinimizer(fRB,xRB,s0,"GSLMultiMin","ConjugatePR");
@@ -734,6 +735,7 @@ int testTrigoFletcher()
    std::cout << "\tTRIGONOMETRIC Fletcher function test , n = " << nT << "\n\n";
 
    iret |= testNewMinimizer(fTrigo, xTrigo, sTrigo, "Minuit2", "");
+   iret |= testNewMinimizer(fTrigo, xTrigo, sTrigo, "Minuit2", "LBFGS");
    iret |= testNewMinimizer(fTrigo, xTrigo, sTrigo, "Minuit", "");
 
    //    iret |= testNewMinimizer(fTrigo,xTrigo,sTrigo,"GSLMultiMin","ConjugateFR");
@@ -41,6 +41,20 @@ namespace CholeskyDecompHelpers {
    template<class F, class V> struct _solverGenDim;
    template<class F, unsigned N, class V> struct _solver;
    template<typename G> class PackedArrayAdapter;
+
+   /// replace an element on the diagonale of the decomposition by the
+   /// reciprocal of its square root
+   /** @returns false if the element is not positive, i.e. the matrix is not
+    * positive definite; specialized for SIMD types in Math/SMatrixBatch.h */
+   template<class F> struct _invSqrt
+   {
+      static bool Apply(F& d)
+      {
+         if (d <= F(0.0)) return false;
+         d = std::sqrt(F(1.0) / d);
+         return true;
+      }
+   };
 }
 
 /// class to compute the Cholesky decomposition of a matrix
@@ -567,8 +581,8 @@ namespace CholeskyDecompHelpers {
             // keep truncation error small
             tmpdiag = src(i, i) - tmpdiag;
             // check if positive definite
-            if (tmpdiag <= F(0.0)) return false;
-            else base1[i] = std::sqrt(F(1.0) / tmpdiag);
+            if (!_invSqrt<F>::Apply(tmpdiag)) return false;
+            base1[i] = tmpdiag;
          }
          return true;
       }
@@ -666,38 +680,33 @@ namespace CholeskyDecompHelpers {
       /// method to do the decomposition
       bool operator()(F* dst, const M& src) const
       {
-         if (src(0,0) <= F(0.0)) return false;
-         dst[0] = std::sqrt(F(1.0) / src(0,0));
+         dst[0] = src(0,0);
+         if (!_invSqrt<F>::Apply(dst[0])) return false;
          dst[1] = src(1,0) * dst[0];
          dst[2] = src(1,1) - dst[1] * dst[1];
-         if (dst[2] <= F(0.0)) return false;
-         else dst[2] = std::sqrt(F(1.0) / dst[2]);
+         if (!_invSqrt<F>::Apply(dst[2])) return false;
          dst[3] = src(2,0) * dst[0];
          dst[4] = (src(2,1) - dst[1] * dst[3]) * dst[2];
          dst[5] = src(2,2) - (dst[3] * dst[3] + dst[4] * dst[4]);
-         if (dst[5] <= F(0.0)) return false;
-         else dst[5] = std::sqrt(F(1.0) / dst[5]);
+         if (!_invSqrt<F>::Apply(dst[5])) return false;
          dst[6] = src(3,0) * dst[0];
          dst[7] = (src(3,1) - dst[1] * dst[6]) * dst[2];
          dst[8] = (src(3,2) - dst[3] * dst[6] - dst[4] * dst[7]) * dst[5];
          dst[9] = src(3,3) - (dst[6] * dst[6] + dst[7] * dst[7] + dst[8] * dst[8]);
-         if (dst[9] <= F(0.0)) return false;
-         else dst[9] = std::sqrt(F(1.0) / dst[9]);
+         if (!_invSqrt<F>::Apply(dst[9])) return false;
          dst[10] = src(4,0) * dst[0];
          dst[11] = (src(4,1) - dst[1] * dst[10]) * dst[2];
          dst[12] = (src(4,2) - dst[3] * dst[10] - dst[4] * dst[11]) * dst[5];
          dst[13] = (src(4,3) - dst[6] * dst[10] - dst[7] * dst[11] - dst[8] * dst[12]) * dst[9];
          dst[14] = src(4,4) - (dst[10]*dst[10]+dst[11]*dst[11]+dst[12]*dst[12]+dst[13]*dst[13]);
-         if (dst[14] <= F(0.0)) return false;
-         else dst[14] = std::sqrt(F(1.0) / dst[14]);
+         if (!_invSqrt<F>::Apply(dst[14])) return false;
          dst[15] = src(5,0) * dst[0];
          dst[16] = (src(5,1) - dst[1] * dst[15]) * dst[2];
          dst[17] = (src(5,2) - dst[3] * dst[15] - dst[4] * dst[16]) * dst[5];
          dst[18] = (src(5,3) - dst[6] * dst[15] - dst[7] * dst[16] - dst[8] * dst[17]) * dst[9];
          dst[19] = (src(5,4) - dst[10] * dst[15] - dst[11] * dst[16] - dst[12] * dst[17] - dst[13] * dst[18]) * dst[14];
          dst[20] = src(5,5) - (dst[15]*dst[15]+dst[16]*dst[16]+dst[17]*dst[17]+dst[18]*dst[18]+dst[19]*dst[19]);
-         if (dst[20] <= F(0.0)) return false;
-         else dst[20] = std::sqrt(F(1.0) / dst[20]);
+         if (!_invSqrt<F>::Apply(dst[20])) return false;
          return true;
       }
    };
@@ -707,30 +716,26 @@ namespace CholeskyDecompHelpers {
       /// method to do the decomposition
       bool operator()(F* dst, const M& src) const
       {
-         if (src(0,0) <= F(0.0)) return false;
-         dst[0] = std::sqrt(F(1.0) / src(0,0));
+         dst[0] = src(0,0);
+         if (!_invSqrt<F>::Apply(dst[0])) return false;
          dst[1] = src(1,0) * dst[0];
          dst[2] = src(1,1) - dst[1] * dst[1];
-         if (dst[2] <= F(0.0)) return false;
-         else dst[2] = std::sqrt(F(1.0) / dst[2]);
+         if (!_invSqrt<F>::Apply(dst[2])) return false;
          dst[3] = src(2,0) * dst[0];
          dst[4] = (src(2,1) - dst[1] * dst[3]) * dst[2];
          dst[5] = src(2,2) - (dst[3] * dst[3] + dst[4] * dst[4]);
-         if (dst[5] <= F(0.0)) return false;
-         else dst[5] = std::sqrt(F(1.0) / dst[5]);
+         if (!_invSqrt<F>::Apply(dst[5])) return false;
          dst[6] = src(3,0) * dst[0];
          dst[7] = (src(3,1) - dst[1] * dst[6]) * dst[2];
          dst[8] = (src(3,2) - dst[3] * dst[6] - dst[4] * dst[7]) * dst[5];
          dst[9] = src(3,3) - (dst[6] * dst[6] + dst[7] * dst[7] + dst[8] * dst[8]);
-         if (dst[9] <= F(0.0)) return false;
-         else dst[9] = std::sqrt(F(1.0) / dst[9]);
+         if (!_invSqrt<F>::Apply(dst[9])) return false;
          dst[10] = src(4,0) * dst[0];
          dst[11] = (src(4,1) - dst[1] * dst[10]) * dst[2];
          dst[12] = (src(4,2) - dst[3] * dst[10] - dst[4] * dst[11]) * dst[5];
          dst[13] = (src(4,3) - dst[6] * dst[10] - dst[7] * dst[11] - dst[8] * dst[12]) * dst[9];
          dst[14] = src(4,4) - (dst[10]*dst[10]+dst[11]*dst[11]+dst[12]*dst[12]+dst[13]*dst[13]);
-         if (dst[14] <= F(0.0)) return false;
-         else dst[14] = std::sqrt(F(1.0) / dst[14]);
+         if (!_invSqrt<F>::Apply(dst[14])) return false;
          return true;
       }
    };
@@ -740,23 +745,20 @@ namespace CholeskyDecompHelpers {
       /// method to do the decomposition
       bool operator()(F* dst, const M& src) const
       {
-         if (src(0,0) <= F(0.0)) return false;
-         dst[0] = std::sqrt(F(1.0) / src(0,0));
+         dst[0] = src(0,0);
+         if (!_invSqrt<F>::Apply(dst[0])) return false;
          dst[1] = src(1,0) * dst[0];
          dst[2] = src(1,1) - dst[1] * dst[1];
-         if (dst[2] <= F(0.0)) return false;
-         else dst[2] = std::sqrt(F(1.0) / dst[2]);
+         if (!_invSqrt<F>::Apply(dst[2])) return false;
          dst[3] = src(2,0) * dst[0];
          dst[4] = (src(2,1) - dst[1] * dst[3]) * dst[2];
          dst[5] = src(2,2) - (dst[3] * dst[3] + dst[4] * dst[4]);
-         if (dst[5] <= F(0.0)) return false;
-         else dst[5] = std::sqrt(F(1.0) / dst[5]);
+         if (!_invSqrt<F>::Apply(dst[5])) return false;
          dst[6] = src(3,0) * dst[0];
          dst[7] = (src(3,1) - dst[1] * dst[6]) * dst[2];
          dst[8] = (src(3,2) - dst[3] * dst[6] - dst[4] * dst[7]) * dst[5];
          dst[9] = src(3,3) - (dst[6] * dst[6] + dst[7] * dst[7] + dst[8] * dst[8]);
-         if (dst[9] <= F(0.0)) return false;
-         else dst[9] = std::sqrt(F(1.0) / dst[9]);
+         if (!_invSqrt<F>::Apply(dst[9])) return false;
          return true;
       }
    };
@@ -766,17 +768,15 @@ namespace CholeskyDecompHelpers {
       /// method to do the decomposition
       bool operator()(F* dst, const M& src) const
       {
-         if (src(0,0) <= F(0.0)) return false;
-         dst[0] = std::sqrt(F(1.0) / src(0,0));
+         dst[0] = src(0,0);
+         if (!_invSqrt<F>::Apply(dst[0])) return false;
          dst[1] = src(1,0) * dst[0];
          dst[2] = src(1,1) - dst[1] * dst[1];
-         if (dst[2] <= F(0.0)) return false;
-         else dst[2] = std::sqrt(F(1.0) / dst[2]);
+         if (!_invSqrt<F>::Apply(dst[2])) return false;
          dst[3] = src(2,0) * dst[0];
          dst[4] = (src(2,1) - dst[1] * dst[3]) * dst[2];
          dst[5] = src(2,2) - (dst[3] * dst[3] + dst[4] * dst[4]);
-         if (dst[5] <= F(0.0)) return false;
-         else dst[5] = std::sqrt(F(1.0) / dst[5]);
+         if (!_invSqrt<F>::Apply(dst[5])) return false;
          return true;
       }
    };
@@ -786,12 +786,11 @@ namespace CholeskyDecompHelpers {
       /// method to do the decomposition
       bool operator()(F* dst, const M& src) const
       {
-         if (src(0,0) <= F(0.0)) return false;
-         dst[0] = std::sqrt(F(1.0) / src(0,0));
+         dst[0] = src(0,0);
+         if (!_invSqrt<F>::Apply(dst[0])) return false;
          dst[1] = src(1,0) * dst[0];
          dst[2] = src(1,1) - dst[1] * dst[1];
-         if (dst[2] <= F(0.0)) return false;
-         else dst[2] = std::sqrt(F(1.0) / dst[2]);
+         if (!_invSqrt<F>::Apply(dst[2])) return false;
          return true;
       }
    };
@@ -801,8 +800,8 @@ namespace CholeskyDecompHelpers {
       /// method to do the decomposition
       bool operator()(F* dst, const M& src) const
       {
-         if (src(0,0) <= F(0.0)) return false;
-         dst[0] = std::sqrt(F(1.0) / src(0,0));
+         dst[0] = src(0,0);
+         if (!_invSqrt<F>::Apply(dst[0])) return false;
          return true;
       }
    };
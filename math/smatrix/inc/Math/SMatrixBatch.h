@@ -0,0 +1,166 @@
+// @(#)root/smatrix:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_Math_SMatrixBatch
+#define ROOT_Math_SMatrixBatch
+
+/** @file
+ * Batches of SMatrix and SVector for SIMD processing.
+ *
+ * A batch of matrices of the same dimensions is a SMatrix of the SIMD type
+ * ROOT::Double_v, whose lane i holds the elements of the i-th matrix: the
+ * matrices are stored element by element, with the same element of all of
+ * them in one SIMD register (an array of structures of arrays). All the
+ * SMatrix and SVector operations, including products, Similarity and
+ * InvertChol, then process a matrix per lane at the cost of one:
+ *
+ * ~~~ {.cpp}
+ * ROOT::Math::SMatrixSym_v<5> cov;
+ * ROOT::Math::SMatrix_v<5, 5> jac;
+ * ROOT::Math::Gather(cov, covariances, n);
+ * ROOT::Math::Gather(jac, jacobians, n);
+ * auto propagated = ROOT::Math::Similarity(jac, cov);
+ * bool ok = propagated.InvertChol();
+ * ROOT::Math::Scatter(propagated, covariances, n);
+ * ~~~
+ *
+ * Branching operations can't be done per lane: InvertChol fails if any of
+ * the matrices of the batch is not positive definite, and the other SMatrix
+ * inversion methods are not available. Without VecCore and Vc, ROOT::Double_v
+ * is double and a batch holds a single matrix.
+ */
+
+#include "Math/SMatrix.h"
+#include "Math/SVector.h"
+#include "Math/CholeskyDecomp.h"
+#include "Math/Types.h"
+
+namespace ROOT {
+
+namespace Math {
+
+/// batch of D1 x D2 matrices
+template <unsigned int D1, unsigned int D2 = D1>
+using SMatrix_v = SMatrix<ROOT::Double_v, D1, D2>;
+/// batch of symmetric D x D matrices
+template <unsigned int D>
+using SMatrixSym_v = SMatrix<ROOT::Double_v, D, D, MatRepSym<ROOT::Double_v, D>>;
+/// batch of vectors of size D
+template <unsigned int D>
+using SVector_v = SVector<ROOT::Double_v, D>;
+
+namespace Internal {
+
+/// number of lanes of the SIMD type V
+template <class V>
+constexpr unsigned int BatchSize()
+{
+#ifdef R__HAS_VECCORE
+   return vecCore::VectorSize<V>();
+#else
+   return 1;
+#endif
+}
+
+template <class V, class T>
+inline void SetLane(V &v, unsigned int lane, T x)
+{
+#ifdef R__HAS_VECCORE
+   vecCore::Set(v, lane, x);
+#else
+   (void)lane;
+   v = x;
+#endif
+}
+
+template <class V>
+inline auto GetLane(const V &v, unsigned int lane)
+{
+#ifdef R__HAS_VECCORE
+   return vecCore::Get(v, lane);
+#else
+   (void)lane;
+   return v;
+#endif
+}
+
+/// copy n arrays of size N to the lanes of an array of SIMD type; the unused lanes get a copy of the first array
+template <class V, class T, class GetArray>
+inline void GatherArrays(V *batch, unsigned int N, unsigned int n, GetArray getArray)
+{
+   for (unsigned int lane = 0; lane < BatchSize<V>(); ++lane) {
+      const T *src = getArray(lane < n ? lane : 0);
+      for (unsigned int i = 0; i < N; ++i)
+         SetLane(batch[i], lane, src[i]);
+   }
+}
+
+} // namespace Internal
+
+/**
+   Copy the n <= ROOT::Double_v::size() matrices to the lanes of a batch with
+   the same representation. The unused lanes get a copy of the first matrix,
+   so that they can't make the operations of the batch fail.
+ */
+template <class V, class T, unsigned int D1, unsigned int D2, class RV, class R>
+inline void Gather(SMatrix<V, D1, D2, RV> &batch, const SMatrix<T, D1, D2, R> *matrices, unsigned int n)
+{
+   static_assert(RV::kSize == R::kSize, "the batch and the matrices must have the same representation");
+   Internal::GatherArrays<V, T>(batch.Array(), R::kSize, n, [&](unsigned int i) { return matrices[i].Array(); });
+}
+
+/// Copy the first n lanes of a batch of matrices to n matrices with the same representation.
+template <class V, class T, unsigned int D1, unsigned int D2, class RV, class R>
+inline void Scatter(const SMatrix<V, D1, D2, RV> &batch, SMatrix<T, D1, D2, R> *matrices, unsigned int n)
+{
+   static_assert(RV::kSize == R::kSize, "the batch and the matrices must have the same representation");
+   for (unsigned int lane = 0; lane < n; ++lane)
+      for (unsigned int i = 0; i < R::kSize; ++i)
+         matrices[lane].Array()[i] = Internal::GetLane(batch.Array()[i], lane);
+}
+
+/// Copy the n <= ROOT::Double_v::size() vectors to the lanes of a batch, the unused lanes get a copy of the first one.
+template <class V, class T, unsigned int D>
+inline void Gather(SVector<V, D> &batch, const SVector<T, D> *vectors, unsigned int n)
+{
+   Internal::GatherArrays<V, T>(batch.Array(), D, n, [&](unsigned int i) { return vectors[i].Array(); });
+}
+
+/// Copy the first n lanes of a batch of vectors to n vectors.
+template <class V, class T, unsigned int D>
+inline void Scatter(const SVector<V, D> &batch, SVector<T, D> *vectors, unsigned int n)
+{
+   for (unsigned int lane = 0; lane < n; ++lane)
+      for (unsigned int i = 0; i < D; ++i)
+         vectors[lane].Array()[i] = Internal::GetLane(batch.Array()[i], lane);
+}
+
+#if defined(R__HAS_VECCORE) && defined(VECCORE_ENABLE_VC)
+namespace CholeskyDecompHelpers {
+/// Cholesky decomposition of a batch: fails if the matrix of any lane is not positive definite
+template <class T, class Abi>
+struct _invSqrt<Vc::Vector<T, Abi>> {
+   static bool Apply(Vc::Vector<T, Abi> &d)
+   {
+      using V = Vc::Vector<T, Abi>;
+      if (!vecCore::MaskEmpty(d <= V(0.0)))
+         return false;
+      d = vecCore::math::Sqrt(V(1.0) / d);
+      return true;
+   }
+};
+} // namespace CholeskyDecompHelpers
+#endif
+
+} // namespace Math
+
+} // namespace ROOT
+
+#endif // ROOT_Math_SMatrixBatch
@@ -55,6 +55,9 @@ class TUnuranEmpDist;
 
    In addition is possible to set the random number generator in the constructor of the class, its seed
    via the TUnuran::SetSeed() method.
+
+   To sample in several threads, each thread must use its own TUnuran object made with
+   TUnuran::Clone() from an initialized one, with its own random number generator.
 */
 
 
@@ -95,7 +98,8 @@ private:
    // usually copying is non trivial, so we make this unaccessible
 
    /**
-      Copy constructor
+      Copy constructor, used by Clone.
+      The distribution must have been shared before with ShareDistribution()
    */
    TUnuran(const TUnuran &);
 
@@ -211,6 +215,19 @@ public:
    */
    int SampleDiscr();
 
+   /**
+      Return a new TUnuran object, sampling the same distribution with the same method, which
+      uses the random engine r. The setup of the generator, often much more expensive than
+      the sampling, is copied instead of being computed again, and the distribution object
+      is shared: the clone can be used after this object is destroyed or initialized again.
+      Each clone can sample in a different thread, provided that the random engines give
+      independent streams (e.g. TRandom3 or TRandomMixMax with different seeds) and, for
+      the methods evaluating the pdf while sampling, that the distribution functions are
+      thread-safe. Returns nullptr if not initialized or if the method does not support
+      cloning.
+   */
+   std::unique_ptr<TUnuran> Clone(TRandom *r);
+
    /**
       Set the random engine.
       Must be called before init to have effect
@@ -287,6 +304,10 @@ protected:
 
    bool SetRandomGenerator();
 
+   void ShareDistribution();
+
+   void FreeDistribution();
+
    bool SetContDistribution(const TUnuranContDist & dist );
 
    bool SetMultiDistribution(const TUnuranMultiContDist & dist );
@@ -308,6 +329,8 @@ protected:
    UNUR_DISTR * fUdistr;                 //pointer to the UnuRan C distribution struct
    UNUR_URNG  * fUrng;                   // pointer to Unuran C random generator struct
    std::unique_ptr<TUnuranBaseDist> fDist; // pointer for distribution wrapper
+   struct SharedDistribution;
+   std::shared_ptr<SharedDistribution> fShared; // distribution used also by clones
    TRandom * fRng;                       //pointer to ROOT random number generator
    std::string fMethod;                  //string representing the method
 
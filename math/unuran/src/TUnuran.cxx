@@ -28,6 +28,16 @@
 
 #include "TError.h"
 
+/// Distribution objects referenced by the generators of a TUnuran and of its clones
+struct TUnuran::SharedDistribution {
+   UNUR_DISTR *fUdistr = nullptr;
+   std::unique_ptr<TUnuranBaseDist> fDist;
+   ~SharedDistribution()
+   {
+      if (fUdistr)
+         unur_distr_free(fUdistr);
+   }
+};
 
 TUnuran::TUnuran(TRandom * r, unsigned int debugLevel) :
    fGen(0),
@@ -56,13 +66,20 @@ TUnuran::~TUnuran()
    if (fGen != 0) unur_free(fGen);
    if (fUrng != 0) unur_urng_free(fUrng);
   // we can delete now the distribution object
-   if (fUdistr != 0) unur_distr_free(fUdistr);
+   FreeDistribution();
 }
 
-//private (no impl.)
-TUnuran::TUnuran(const TUnuran &)
+TUnuran::TUnuran(const TUnuran &rhs) :
+   fGen(0),
+   fUdistr(rhs.fUdistr),
+   fUrng(0),
+   fShared(rhs.fShared),
+   fRng(rhs.fRng),
+   fMethod(rhs.fMethod)
 {
-   // Implementation of copy constructor.
+   // copy constructor implementation: clone the generator of rhs, which refers to
+   // the same distribution (not copied), unless UNU.RAN has its private copy
+   if (rhs.fGen != 0) fGen = unur_gen_clone(rhs.fGen);
 }
 
 TUnuran & TUnuran::operator = (const TUnuran &rhs)
@@ -166,10 +183,52 @@ bool  TUnuran::SetRandomGenerator()
    return true;
 }
 
+void TUnuran::ShareDistribution()
+{
+   // give the ownership of the distribution objects to fShared, so that they are
+   // kept as long as this object or one of its clones uses them
+   if (fUdistr == 0 || (fShared && fShared->fUdistr == fUdistr)) return;
+   fShared = std::make_shared<SharedDistribution>();
+   fShared->fUdistr = fUdistr;
+   fShared->fDist = std::move(fDist);
+}
+
+void TUnuran::FreeDistribution()
+{
+   // release the distribution, which is deleted only if no clone uses it
+   if (fShared && fShared->fUdistr == fUdistr)
+      fShared.reset();
+   else if (fUdistr != 0)
+      unur_distr_free(fUdistr);
+   fUdistr = 0;
+}
+
+std::unique_ptr<TUnuran> TUnuran::Clone(TRandom * r)
+{
+   // clone the generator, sharing the distribution, and use the random engine r
+   if (fGen == 0) {
+      Error("Clone","TUnuran is not initialized");
+      return nullptr;
+   }
+   if (r == 0) {
+      Error("Clone","a random engine is required");
+      return nullptr;
+   }
+   ShareDistribution();
+   std::unique_ptr<TUnuran> clone(new TUnuran(*this));
+   if (clone->fGen == 0) {
+      Error("Clone","method %s does not support cloning",fMethod.c_str());
+      return nullptr;
+   }
+   clone->fRng = r;
+   if (! clone->SetRandomGenerator() ) return nullptr;
+   return clone;
+}
+
 bool  TUnuran::SetContDistribution(const TUnuranContDist & dist )
 {
    // internal method to set in unuran the function pointer for a continuous univariate distribution
-   if (fUdistr != 0)  unur_distr_free(fUdistr);
+   FreeDistribution();
    fUdistr = unur_distr_cont_new();
    if (fUdistr == 0) return false;
    unsigned int ret = 0;
@@ -215,7 +274,7 @@ bool  TUnuran::SetContDistribution(const TUnuranContDist & dist )
 bool  TUnuran::SetMultiDistribution(const TUnuranMultiContDist & dist )
 {
    // internal method to set in unuran the function pointer for a multivariate distribution
-   if (fUdistr != 0)  unur_distr_free(fUdistr);
+   FreeDistribution();
    fUdistr = unur_distr_cvec_new(dist.NDim() );
    if (fUdistr == 0) return false;
    unsigned int ret = 0;
@@ -259,7 +318,7 @@ bool  TUnuran::SetMultiDistribution(const TUnuranMultiContDist & dist )
 bool TUnuran::SetEmpiricalDistribution(const TUnuranEmpDist & dist) {
 
    // internal method to set in unuran the function pointer for am empiral distribution (from histogram)
-   if (fUdistr != 0)  unur_distr_free(fUdistr);
+   FreeDistribution();
    if (dist.NDim() == 1)
       fUdistr = unur_distr_cemp_new();
    else
@@ -300,7 +359,7 @@ bool TUnuran::SetEmpiricalDistribution(const TUnuranEmpDist & dist) {
 bool  TUnuran::SetDiscreteDistribution(const TUnuranDiscrDist & dist)
 {
    // internal method to set in unuran the function pointer for a discrete univariate distribution
-   if (fUdistr != 0)  unur_distr_free(fUdistr);
+   FreeDistribution();
    fUdistr = unur_distr_discr_new();
    if (fUdistr == 0) return false;
    unsigned int ret = 0;
@@ -465,6 +524,7 @@ bool TUnuran::InitPoisson(double mu, const std::string & method) {
    double p[1];
    p[0] = mu;
 
+   FreeDistribution();
    fUdistr = unur_distr_poisson(p,1);
 
    fMethod = method;
@@ -479,6 +539,7 @@ bool TUnuran::InitBinomial(unsigned int ntot, double prob, const std::string & m
    double par[2];
    par[0] = ntot;
    par[1] = prob;
+   FreeDistribution();
    fUdistr = unur_distr_binomial(par,2);
 
    fMethod = method;
@@ -494,6 +555,11 @@ bool TUnuran::ReInitDiscrDist(unsigned int npar, double * par) {
    // works only for pre-defined distribution by changing their parameters
    if (!fGen ) return false;
    if (!fUdistr) return false;
+   if (fShared && fShared->fUdistr == fUdistr) {
+      // the clones would sample the new distribution with their old setup
+      Warning("ReInitDiscrDist","distribution used by clones - a full initizialization must be performed");
+      return false;
+   }
    unur_distr_discr_set_pmfparams(fUdistr,par,npar);
    int iret = unur_reinit(fGen);
    if (iret) Warning("ReInitDiscrDist","re-init failed - a full initizialization must be performed");
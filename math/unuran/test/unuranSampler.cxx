@@ -8,6 +8,11 @@
 #include "Math/Functor.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TRandom3.h"
+#include "TUnuran.h"
+#include "TUnuranContDist.h"
+
+#include <thread>
 
 using namespace ROOT::Math; 
 
@@ -229,4 +234,59 @@ TEST(MultiDim, DistSamplerOptAPI){
     EXPECT_NEAR(h1->GetRMS(2), 2, 10*h1->GetRMSError(2));
     EXPECT_NEAR(h1->GetCorrelationFactor(1,2), 0.7, 0.1);
     
-}
\ No newline at end of file
+}
+
+// test cloning an initialized TUnuran and sampling the clones in parallel threads
+TEST(OneDim, CloneThreads)
+{
+    auto pdf = [](double x){ return ROOT::Math::normal_pdf(x,0.75,3);};
+    Functor1D pdfDist(pdf);
+
+    const int nThreads = 4;
+    const int nevt = 10000;
+    std::vector<TRandom3> randoms;
+    std::vector<std::unique_ptr<TUnuran>> clones;
+    std::vector<std::vector<double>> sequential(nThreads), parallel(nThreads);
+    {
+        TRandom3 random(1);
+        TUnuran unr(&random);
+        TUnuranContDist dist(pdfDist);
+        dist.SetDomain(0,6);
+        bool ret = unr.Init(dist, "pinv");
+        EXPECT_EQ(ret, true);
+        if (!ret) return;
+
+        for (int t = 0; t < nThreads; t++) {
+            TRandom3 rnd(t + 2);
+            auto clone = unr.Clone(&rnd);
+            ASSERT_NE(clone, nullptr);
+            for (int i = 0; i < nevt; i++)
+                sequential[t].push_back(clone->Sample());
+        }
+
+        for (int t = 0; t < nThreads; t++)
+            randoms.emplace_back(t + 2);
+        for (int t = 0; t < nThreads; t++)
+            clones.emplace_back(unr.Clone(&randoms[t]));
+        // the clones keep working after unr and dist are deleted
+    }
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nThreads; t++)
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < nevt; i++)
+                parallel[t].push_back(clones[t]->Sample());
+        });
+    for (auto &thread : threads)
+        thread.join();
+
+    for (int t = 0; t < nThreads; t++) {
+        EXPECT_EQ(parallel[t], sequential[t]);
+        TH1D h1("h1","h1",100, 0, 6);
+        for (double x : parallel[t])
+            h1.Fill(x);
+        EXPECT_NEAR(h1.GetMean(), 3., 5 * h1.GetMeanError());
+        EXPECT_NEAR(h1.GetRMS(), 0.75, 5*h1.GetRMSError());
+    }
+    EXPECT_NE(parallel[0], parallel[1]);
+}
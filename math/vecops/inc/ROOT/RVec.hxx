@@ -37,8 +37,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint> // std::int32_t
 #include <cstring>
 #include <limits> // for numeric_limits
+#include <memory>
 #include <new>
 #include <numeric> // for inner_product
 #include <sstream>
@@ -133,6 +135,46 @@ inline uint64_t NextPowerOf2(uint64_t A)
    return A + 1;
 }
 
+/// A bump allocator for the buffers of RVecs of trivially copyable elements.
+///
+/// While an RVecArenaScope is alive on a thread, the RVecs of trivially copyable elements which outgrow their inline
+/// storage on that thread allocate their buffers from the scope's arena. Such buffers are not freed by the RVecs but
+/// released all at once by Reset(), after which the RVecs that used them must not be accessed anymore (they can still
+/// be destroyed). RDataFrame uses one arena per processing slot for the results of the Define expressions, see
+/// ROOT::RDF::RInterfaceBase::EnableRVecArena(). An arena must not be used by several threads at the same time.
+class RVecArena {
+   struct RChunk {
+      std::unique_ptr<char[]> fData;
+      std::size_t fSize;
+   };
+   std::vector<RChunk> fChunks;
+   std::size_t fCurrent = 0; ///< Index of the chunk being filled
+   std::size_t fOffset = 0;  ///< Offset of the first free byte of the current chunk
+
+public:
+   /// Size of the first chunk of memory of an arena, in bytes
+   static constexpr std::size_t kChunkSize = 64 * 1024;
+
+   /// Return size bytes of memory, aligned as malloc's, valid until the next Reset()
+   void *Allocate(std::size_t size);
+   /// Make all the memory available again. If more than one chunk was used, they are merged into one.
+   void Reset();
+   /// The total size of the chunks of memory of the arena, in bytes
+   std::size_t GetCapacity() const;
+};
+
+/// Makes the RVecs created or grown on this thread allocate their buffers from an arena (if not null) for the
+/// lifetime of the scope, see RVecArena. Scopes can be nested: the previous arena is restored by the destructor.
+class RVecArenaScope {
+   RVecArena *fPrevious;
+
+public:
+   explicit RVecArenaScope(RVecArena *arena);
+   ~RVecArenaScope();
+   RVecArenaScope(const RVecArenaScope &) = delete;
+   RVecArenaScope &operator=(const RVecArenaScope &) = delete;
+};
+
 /// This is all the stuff common to all SmallVectors.
 class R__CLING_PTRCHECK(off) SmallVectorBase {
 public:
@@ -145,7 +187,8 @@ protected:
    /// Always >= 0.
    // Type is signed only for consistency with fCapacity.
    Size_T fSize = 0;
-   /// Always >= -1. fCapacity == -1 indicates the RVec is in "memory adoption" mode.
+   /// Always >= -1 for memory allocated with malloc. fCapacity == -1 indicates the RVec is in "memory adoption" mode.
+   /// A buffer allocated from an RVecArena (which the RVec must not free) of capacity C is indicated by -(C + 2).
    Size_T fCapacity;
 
    /// The maximum value of the Size_T used.
@@ -169,9 +212,12 @@ protected:
    /// If true, the RVec is in "memory adoption" mode, i.e. it is acting as a view on a memory buffer it does not own.
    bool Owns() const { return fCapacity != -1; }
 
+   /// If true, the buffer of the RVec was allocated from an RVecArena: it is released by the arena, not by the RVec.
+   bool IsArenaBacked() const { return fCapacity < -1; }
+
 public:
    size_t size() const { return fSize; }
-   size_t capacity() const noexcept { return Owns() ? fCapacity : fSize; }
+   size_t capacity() const noexcept { return Owns() ? (IsArenaBacked() ? -fCapacity - 2 : fCapacity) : fSize; }
 
    R__RVEC_NODISCARD bool empty() const { return !fSize; }
 
@@ -411,7 +457,7 @@ void R__CLING_PTRCHECK(off) SmallVectorTemplateBase<T, TriviallyCopyable>::grow(
       destroy_range(this->begin(), this->end());
 
       // If this wasn't grown from the inline copy, deallocate the old space.
-      if (!this->isSmall())
+      if (!this->isSmall() && !this->IsArenaBacked())
          free(this->begin());
    }
 
@@ -553,7 +599,7 @@ public:
    {
       // Subclass has already destructed this vector's elements.
       // If this wasn't grown from the inline copy, deallocate the old space.
-      if (!this->isSmall() && this->Owns())
+      if (!this->isSmall() && this->Owns() && !this->IsArenaBacked())
          free(this->begin());
    }
 
@@ -1030,7 +1076,7 @@ RVecImpl<T> &RVecImpl<T>::operator=(RVecImpl<T> &&RHS)
    if (!RHS.isSmall()) {
       if (this->Owns()) {
          this->destroy_range(this->begin(), this->end());
-         if (!this->isSmall())
+         if (!this->isSmall() && !this->IsArenaBacked())
             free(this->begin());
       }
       this->fBeginX = RHS.fBeginX;
@@ -1101,6 +1147,74 @@ bool IsAdopting(const ROOT::VecOps::RVec<T> &v)
    return !v.Owns();
 }
 
+/// Whether the result of an operation on an RVec<T> temporary, of element type R, can be stored in its own buffer instead
+/// of a new RVec. This is the case for arithmetic types when the result has the same type as the elements.
+template <typename T, typename R>
+using CanReuseBuffer = std::integral_constant<bool, std::is_same<T, R>::value && std::is_arithmetic<T>::value>;
+
+template <typename T, typename R>
+using EnableIfCanReuseBuffer_t = std::enable_if_t<CanReuseBuffer<T, R>::value, int>;
+
+/// Number of partial sums of SumImpl, enough to fill the vector registers of current CPUs with float or double.
+constexpr std::size_t kSumLanes = 8;
+
+/// Sum of the n elements at x. For floating point types, kSumLanes partial sums are accumulated in parallel (which
+/// compilers map to vector instructions, as they could not reorder the additions of a single sum) and then added up.
+template <typename T>
+T SumImpl(const T *x, std::size_t n, T zero, std::true_type /*isFloatingPoint*/)
+{
+   if (n < 2 * kSumLanes)
+      return std::accumulate(x, x + n, zero);
+   T partial[kSumLanes];
+   for (std::size_t k = 0; k < kSumLanes; ++k)
+      partial[k] = x[k];
+   std::size_t i = kSumLanes;
+   for (; i + kSumLanes <= n; i += kSumLanes)
+      for (std::size_t k = 0; k < kSumLanes; ++k)
+         partial[k] += x[i + k];
+   for (std::size_t width = kSumLanes / 2; width > 0; width /= 2)
+      for (std::size_t k = 0; k < width; ++k)
+         partial[k] += partial[k + width];
+   return std::accumulate(x + i, x + n, zero + partial[0]);
+}
+
+template <typename T>
+T SumImpl(const T *x, std::size_t n, T zero, std::false_type /*isFloatingPoint*/)
+{
+   return std::accumulate(x, x + n, zero);
+}
+
+/// Return an RVec of n elements, the i-th being f(i). For trivially copyable types the elements are written with a
+/// plain loop over the buffer, which compilers can vectorize (e.g. with blend instructions for the selections of
+/// Where()), instead of being appended one by one.
+template <typename T, typename F>
+ROOT::VecOps::RVec<T> MakeRVec(std::size_t n, F &&f, std::true_type /*isTriviallyCopyable*/)
+{
+   ROOT::VecOps::RVec<T> r;
+   r.reserve(n);
+   T *out = r.data();
+   for (std::size_t i = 0; i < n; ++i)
+      out[i] = f(i);
+   r.set_size(n);
+   return r;
+}
+
+template <typename T, typename F>
+ROOT::VecOps::RVec<T> MakeRVec(std::size_t n, F &&f, std::false_type /*isTriviallyCopyable*/)
+{
+   ROOT::VecOps::RVec<T> r;
+   r.reserve(n);
+   for (std::size_t i = 0; i < n; ++i)
+      r.emplace_back(f(i));
+   return r;
+}
+
+template <typename T, typename F>
+ROOT::VecOps::RVec<T> MakeRVec(std::size_t n, F &&f)
+{
+   return MakeRVec<T>(n, std::forward<F>(f), std::is_trivially_copyable<T>{});
+}
+
 } // namespace VecOps
 } // namespace Detail
 
@@ -1233,15 +1347,24 @@ public:
 
       RVecN ret;
       ret.reserve(n);
-      size_type j = 0u;
-      for (size_type i = 0u; i < n; ++i) {
-         if (conds[i]) {
-            // the begin() is to go around the R__ASSERT in operator[]
-            ret.begin()[j] = this->operator[](i);
-            ++j;
+      const T *in = this->begin();
+      const V *cond = conds.begin();
+      if (std::is_trivially_copyable<T>::value) {
+         // branchless compaction: every element is written after the selected ones, but only the selected ones are
+         // kept, so that the loop does not stall on mispredicted branches when the conditions are irregular
+         T *out = ret.begin();
+         size_type j = 0u;
+         for (size_type i = 0u; i < n; ++i) {
+            out[j] = in[i];
+            j += static_cast<bool>(cond[i]);
+         }
+         ret.set_size(j);
+      } else {
+         for (size_type i = 0u; i < n; ++i) {
+            if (cond[i])
+               ret.emplace_back(in[i]);
          }
       }
-      ret.set_size(j);
       return ret;
    }
 
@@ -1545,6 +1668,17 @@ RVec<T> operator OP(const RVec<T> &v)                                          \
    for (auto &x : ret)                                                         \
       x = OP x;                                                                \
 return ret;                                                                    \
+}                                                                              \
+                                                                               \
+/* the elements of temporaries are modified in place */                        \
+template <typename T, ROOT::Detail::VecOps::EnableIfCanReuseBuffer_t<T, T> = 0>\
+RVec<T> operator OP(RVec<T> &&v)                                               \
+{                                                                              \
+   if (ROOT::Detail::VecOps::IsAdopting(v))                                    \
+      return OP static_cast<const RVec<T> &>(v);                               \
+   for (auto &x : v)                                                           \
+      x = OP x;                                                                \
+   return std::move(v);                                                        \
 }                                                                              \
 
 RVEC_UNARY_OPERATOR(+)
@@ -1593,6 +1727,68 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
+                                                                               \
+/* the results of operations on temporaries are stored in their buffer */      \
+template <typename T0, typename T1,                                            \
+          ROOT::Detail::VecOps::EnableIfCanReuseBuffer_t<                      \
+             T0, decltype(std::declval<T0>() OP std::declval<T1>())> = 0>      \
+RVec<T0> operator OP(RVec<T0> &&v, const T1 &y)                                \
+{                                                                              \
+   if (ROOT::Detail::VecOps::IsAdopting(v))                                    \
+      return static_cast<const RVec<T0> &>(v) OP y;                            \
+   for (auto &x : v)                                                           \
+      x = x OP y;                                                              \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          ROOT::Detail::VecOps::EnableIfCanReuseBuffer_t<                      \
+             T1, decltype(std::declval<T0>() OP std::declval<T1>())> = 0>      \
+RVec<T1> operator OP(const T0 &x, RVec<T1> &&v)                                \
+{                                                                              \
+   if (ROOT::Detail::VecOps::IsAdopting(v))                                    \
+      return x OP static_cast<const RVec<T1> &>(v);                            \
+   for (auto &y : v)                                                           \
+      y = x OP y;                                                              \
+   return std::move(v);                                                        \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          ROOT::Detail::VecOps::EnableIfCanReuseBuffer_t<                      \
+             T0, decltype(std::declval<T0>() OP std::declval<T1>())> = 0>      \
+RVec<T0> operator OP(RVec<T0> &&v0, const RVec<T1> &v1)                        \
+{                                                                              \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+   if (ROOT::Detail::VecOps::IsAdopting(v0))                                   \
+      return static_cast<const RVec<T0> &>(v0) OP v1;                          \
+   auto op = [](const T0 &x, const T1 &y) { return x OP y; };                  \
+   std::transform(v0.begin(), v0.end(), v1.begin(), v0.begin(), op);           \
+   return std::move(v0);                                                       \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1,                                            \
+          ROOT::Detail::VecOps::EnableIfCanReuseBuffer_t<                      \
+             T1, decltype(std::declval<T0>() OP std::declval<T1>())> = 0>      \
+RVec<T1> operator OP(const RVec<T0> &v0, RVec<T1> &&v1)                        \
+{                                                                              \
+   if (v0.size() != v1.size())                                                 \
+      throw std::runtime_error(ERROR_MESSAGE(OP));                             \
+   if (ROOT::Detail::VecOps::IsAdopting(v1))                                   \
+      return v0 OP static_cast<const RVec<T1> &>(v1);                          \
+   auto op = [](const T0 &x, const T1 &y) { return x OP y; };                  \
+   std::transform(v0.begin(), v0.end(), v1.begin(), v1.begin(), op);           \
+   return std::move(v1);                                                       \
+}                                                                              \
+                                                                               \
+/* both operands are temporaries: the first one is reused */                   \
+template <typename T,                                                          \
+          ROOT::Detail::VecOps::EnableIfCanReuseBuffer_t<                      \
+             T, decltype(std::declval<T>() OP std::declval<T>())> = 0>         \
+RVec<T> operator OP(RVec<T> &&v0, RVec<T> &&v1)                                \
+{                                                                              \
+   return std::move(v0) OP static_cast<const RVec<T> &>(v1);                   \
+}                                                                              \
 
 RVEC_BINARY_OPERATOR(+)
 RVEC_BINARY_OPERATOR(-)
@@ -1649,20 +1845,18 @@ template <typename T0, typename T1>                                            \
 auto operator OP(const RVec<T0> &v, const T1 &y)                               \
   -> RVec<int> /* avoid std::vector<bool> */                                   \
 {                                                                              \
-   RVec<int> ret(v.size());                                                    \
-   auto op = [y](const T0 &x) -> int { return x OP y; };                       \
-   std::transform(v.begin(), v.end(), ret.begin(), op);                        \
-   return ret;                                                                 \
+   const T0 *x = v.data();                                                     \
+   auto op = [x, y](std::size_t i) -> int { return x[i] OP y; };               \
+   return ROOT::Detail::VecOps::MakeRVec<int>(v.size(), op);                   \
 }                                                                              \
                                                                                \
 template <typename T0, typename T1>                                            \
 auto operator OP(const T0 &x, const RVec<T1> &v)                               \
   -> RVec<int> /* avoid std::vector<bool> */                                   \
 {                                                                              \
-   RVec<int> ret(v.size());                                                    \
-   auto op = [x](const T1 &y) -> int { return x OP y; };                       \
-   std::transform(v.begin(), v.end(), ret.begin(), op);                        \
-   return ret;                                                                 \
+   const T1 *y = v.data();                                                     \
+   auto op = [x, y](std::size_t i) -> int { return x OP y[i]; };               \
+   return ROOT::Detail::VecOps::MakeRVec<int>(v.size(), op);                   \
 }                                                                              \
                                                                                \
 template <typename T0, typename T1>                                            \
@@ -1672,10 +1866,10 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
    if (v0.size() != v1.size())                                                 \
       throw std::runtime_error(ERROR_MESSAGE(OP));                             \
                                                                                \
-   RVec<int> ret(v0.size());                                                   \
-   auto op = [](const T0 &x, const T1 &y) -> int { return x OP y; };           \
-   std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
-   return ret;                                                                 \
+   const T0 *x = v0.data();                                                    \
+   const T1 *y = v1.data();                                                    \
+   auto op = [x, y](std::size_t i) -> int { return x[i] OP y[i]; };            \
+   return ROOT::Detail::VecOps::MakeRVec<int>(v0.size(), op);                  \
 }                                                                              \
 
 RVEC_LOGICAL_OPERATOR(<)
@@ -1717,6 +1911,21 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       auto f = [](const T &x) { return FUNC(x); };                             \
       std::transform(v.begin(), v.end(), ret.begin(), f);                      \
       return ret;                                                              \
+   }                                                                           \
+                                                                               \
+   /* the results on temporaries are stored in their buffer */                 \
+   template <typename T, ROOT::Detail::VecOps::EnableIfCanReuseBuffer_t<       \
+                            T, PromoteType<T>> = 0>                            \
+   RVec<T> NAME(RVec<T> &&v)                                                   \
+   {                                                                           \
+      auto f = [](const T &x) { return FUNC(x); };                             \
+      if (ROOT::Detail::VecOps::IsAdopting(v)) {                               \
+         RVec<T> ret(v.size());                                                \
+         std::transform(v.begin(), v.end(), ret.begin(), f);                   \
+         return ret;                                                           \
+      }                                                                        \
+      std::transform(v.begin(), v.end(), v.begin(), f);                        \
+      return std::move(v);                                                     \
    }
 
 #define RVEC_BINARY_FUNCTION(NAME, FUNC)                                       \
@@ -1824,8 +2033,132 @@ RVEC_VDT_UNARY_FUNCTION(fast_tan)
 RVEC_VDT_UNARY_FUNCTION(fast_asin)
 RVEC_VDT_UNARY_FUNCTION(fast_acos)
 RVEC_VDT_UNARY_FUNCTION(fast_atan)
+
+RVEC_VDT_UNARY_FUNCTION(fast_isqrtf)
+RVEC_VDT_UNARY_FUNCTION(fast_isqrt)
 #undef RVEC_VDT_UNARY_FUNCTION
 
+#define RVEC_VDT_BINARY_FUNCTION(F) RVEC_BINARY_FUNCTION(F, vdt::F)
+RVEC_VDT_BINARY_FUNCTION(fast_atan2f)
+RVEC_VDT_BINARY_FUNCTION(fast_atan2)
+#undef RVEC_VDT_BINARY_FUNCTION
+
+/**
+\brief Fast approximations of mathematical functions on RVecs, computed with vdt in the precision of the elements.
+
+The functions have the names of their std counterparts, and compute the vdt function in single precision for
+RVec<float>, in double precision otherwise (e.g. vdt::fast_expf and vdt::fast_exp for `Fast::exp`):
+~~~{.cpp}
+RVecF pt, eta, phi;
+auto px = pt * ROOT::VecOps::Fast::cos(phi);
+auto pz = pt * 0.5f * (ROOT::VecOps::Fast::exp(eta) - ROOT::VecOps::Fast::exp(-eta));
+auto dr = ROOT::VecOps::Fast::DeltaR(eta1, eta2, phi1, phi2);
+~~~
+The vdt functions are inlined in the loops over the elements, which the compiler can vectorize. The results differ
+from the std functions by a few ulps (see the vdt documentation for the accuracy of each function), and special
+values (infinities, NaNs, denormals) are not necessarily handled as by the std functions. These functions must be
+called with their namespace: a `using namespace` of both ROOT::VecOps and ROOT::VecOps::Fast makes the calls
+ambiguous.
+*/
+namespace Fast {
+
+/// \cond
+template <typename T>
+struct VdtFunctions {
+   static double exp(double x) { return vdt::fast_exp(x); }
+   static double log(double x) { return vdt::fast_log(x); }
+   static double sin(double x) { return vdt::fast_sin(x); }
+   static double cos(double x) { return vdt::fast_cos(x); }
+   static double tan(double x) { return vdt::fast_tan(x); }
+   static double asin(double x) { return vdt::fast_asin(x); }
+   static double acos(double x) { return vdt::fast_acos(x); }
+   static double atan(double x) { return vdt::fast_atan(x); }
+   static double atan2(double y, double x) { return vdt::fast_atan2(y, x); }
+   static double isqrt(double x) { return vdt::fast_isqrt(x); }
+};
+
+template <>
+struct VdtFunctions<float> {
+   static float exp(float x) { return vdt::fast_expf(x); }
+   static float log(float x) { return vdt::fast_logf(x); }
+   static float sin(float x) { return vdt::fast_sinf(x); }
+   static float cos(float x) { return vdt::fast_cosf(x); }
+   static float tan(float x) { return vdt::fast_tanf(x); }
+   static float asin(float x) { return vdt::fast_asinf(x); }
+   static float acos(float x) { return vdt::fast_acosf(x); }
+   static float atan(float x) { return vdt::fast_atanf(x); }
+   static float atan2(float y, float x) { return vdt::fast_atan2f(y, x); }
+   static float isqrt(float x) { return vdt::fast_isqrtf(x); }
+};
+/// \endcond
+
+#define RVEC_FAST_UNARY_FUNCTION(F) RVEC_UNARY_FUNCTION(F, VdtFunctions<PromoteType<T>>::F)
+RVEC_FAST_UNARY_FUNCTION(exp)
+RVEC_FAST_UNARY_FUNCTION(log)
+RVEC_FAST_UNARY_FUNCTION(sin)
+RVEC_FAST_UNARY_FUNCTION(cos)
+RVEC_FAST_UNARY_FUNCTION(tan)
+RVEC_FAST_UNARY_FUNCTION(asin)
+RVEC_FAST_UNARY_FUNCTION(acos)
+RVEC_FAST_UNARY_FUNCTION(atan)
+/// Inverse square root, \f$1/\sqrt{x}\f$
+RVEC_FAST_UNARY_FUNCTION(isqrt)
+#undef RVEC_FAST_UNARY_FUNCTION
+
+RVEC_BINARY_FUNCTION(atan2, (VdtFunctions<PromoteTypes<T0, T1>>::atan2))
+
+/// Same as ROOT::VecOps::DeltaPhi of two collections, computed without the branches and the fmod: the loop can be
+/// vectorized. The result is in \f$[-c, c[\f$, an angle difference of exactly c is returned as -c.
+template <typename T>
+RVec<T> DeltaPhi(const RVec<T> &v1, const RVec<T> &v2, const T c = M_PI)
+{
+   static_assert(std::is_floating_point<T>::value, "DeltaPhi must be called with floating point values.");
+   const std::size_t size = v1.size();
+   if (v2.size() != size)
+      throw std::runtime_error("Cannot compute DeltaPhi of vectors of different sizes");
+
+   const T twoC = 2 * c;
+   const T invTwoC = 1 / twoC;
+   RVec<T> r(size);
+   for (std::size_t i = 0u; i < size; ++i) {
+      const T d = v2[i] - v1[i];
+      // d - twoC * floor(d / twoC + 1/2), the floor through a conversion to an integer that the compiler vectorizes
+      const T k = d * invTwoC + T(0.5);
+      T n = static_cast<T>(static_cast<std::int32_t>(k));
+      n -= k < n ? T(1) : T(0);
+      r[i] = d - twoC * n;
+   }
+   return r;
+}
+
+/// Same as ROOT::VecOps::DeltaR2, with Fast::DeltaPhi
+template <typename T>
+RVec<T> DeltaR2(const RVec<T> &eta1, const RVec<T> &eta2, const RVec<T> &phi1, const RVec<T> &phi2, const T c = M_PI)
+{
+   const std::size_t size = eta1.size();
+   if (eta2.size() != size || phi1.size() != size || phi2.size() != size)
+      throw std::runtime_error("Cannot compute DeltaR2 of vectors of different sizes");
+
+   auto r = Fast::DeltaPhi(phi1, phi2, c);
+   for (std::size_t i = 0u; i < size; ++i) {
+      const T deta = eta1[i] - eta2[i];
+      r[i] = deta * deta + r[i] * r[i];
+   }
+   return r;
+}
+
+/// Same as ROOT::VecOps::DeltaR, with Fast::DeltaPhi
+template <typename T>
+RVec<T> DeltaR(const RVec<T> &eta1, const RVec<T> &eta2, const RVec<T> &phi1, const RVec<T> &phi2, const T c = M_PI)
+{
+   auto r = Fast::DeltaR2(eta1, eta2, phi1, phi2, c);
+   for (auto &x : r)
+      x = std::sqrt(x);
+   return r;
+}
+
+} // namespace Fast
+
 #endif // R__HAS_VDT
 
 #undef RVEC_UNARY_FUNCTION
@@ -1874,10 +2207,13 @@ auto Dot(const RVec<T> &v0, const RVec<V> &v1) -> decltype(v0[0] * v1[0])
 /// v_sum_lv
 /// // (ROOT::Math::LorentzVector<ROOT::Math::PtEtaPhiM4D<double> > &) (30.8489,2.46534,2.58947,361.084)
 /// ~~~
+///
+/// For floating point types, the elements of large RVecs are summed in several parallel partial sums to make use of
+/// vector instructions, so the result may differ in the last bits from a sequential sum of the elements.
 template <typename T>
 T Sum(const RVec<T> &v, const T zero = T(0))
 {
-   return std::accumulate(v.begin(), v.end(), zero);
+   return ROOT::Detail::VecOps::SumImpl(v.data(), v.size(), zero, std::is_floating_point<T>{});
 }
 
 inline std::size_t Sum(const RVec<bool> &v, std::size_t zero = 0ul)
@@ -2262,12 +2598,9 @@ RVec<typename RVec<T>::size_type> StableArgsort(const RVec<T> &v, Compare &&c)
 template <typename T>
 RVec<T> Take(const RVec<T> &v, const RVec<typename RVec<T>::size_type> &i)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type isize = i.size();
-   RVec<T> r(isize);
-   for (size_type k = 0; k < isize; k++)
-      r[k] = v[i[k]];
-   return r;
+   const T *values = v.data();
+   const auto *indices = i.data();
+   return ROOT::Detail::VecOps::MakeRVec<T>(i.size(), [=](std::size_t k) { return values[indices[k]]; });
 }
 
 /// Take version that defaults to (user-specified) output value if some index is out of range
@@ -2316,15 +2649,9 @@ RVec<T> Take(const RVec<T> &v, const int n)
       ss << "Try to take " << absn << " elements but vector has only size " << size << ".";
       throw std::runtime_error(ss.str());
    }
-   RVec<T> r(absn);
-   if (n < 0) {
-      for (size_type k = 0; k < absn; k++)
-         r[k] = v[size - absn + k];
-   } else {
-      for (size_type k = 0; k < absn; k++)
-         r[k] = v[k];
-   }
-   return r;
+   if (n < 0)
+      return RVec<T>(v.end() - absn, v.end());
+   return RVec<T>(v.begin(), v.begin() + absn);
 }
 
 /// Return a copy of the container without the elements at the specified indices.
@@ -2677,14 +3004,11 @@ RVec<T> Intersect(const RVec<T>& v1, const RVec<T>& v2, bool v2_is_sorted = fals
 template <typename T>
 RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2[i]);
-   }
-   return r;
+   const int *cond = c.data();
+   const T *values1 = v1.data();
+   const T *values2 = v2.data();
+   return ROOT::Detail::VecOps::MakeRVec<T>(
+      c.size(), [=](std::size_t i) { return cond[i] != 0 ? values1[i] : values2[i]; });
 }
 
 /// Return the elements of v1 if the condition c is true and sets the value v2
@@ -2705,14 +3029,9 @@ RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
 template <typename T>
 RVec<T> Where(const RVec<int> &c, const RVec<T> &v1, typename RVec<T>::value_type v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1[i] : v2);
-   }
-   return r;
+   const int *cond = c.data();
+   const T *values1 = v1.data();
+   return ROOT::Detail::VecOps::MakeRVec<T>(c.size(), [=](std::size_t i) { return cond[i] != 0 ? values1[i] : v2; });
 }
 
 /// Return the elements of v2 if the condition c is false and sets the value v1
@@ -2733,14 +3052,9 @@ RVec<T> Where(const RVec<int> &c, const RVec<T> &v1, typename RVec<T>::value_typ
 template <typename T>
 RVec<T> Where(const RVec<int>& c, typename RVec<T>::value_type v1, const RVec<T>& v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2[i]);
-   }
-   return r;
+   const int *cond = c.data();
+   const T *values2 = v2.data();
+   return ROOT::Detail::VecOps::MakeRVec<T>(c.size(), [=](std::size_t i) { return cond[i] != 0 ? v1 : values2[i]; });
 }
 
 /// Return a vector with the value v2 if the condition c is false and sets the
@@ -2759,14 +3073,8 @@ RVec<T> Where(const RVec<int>& c, typename RVec<T>::value_type v1, const RVec<T>
 template <typename T>
 RVec<T> Where(const RVec<int>& c, T v1, T v2)
 {
-   using size_type = typename RVec<T>::size_type;
-   const size_type size = c.size();
-   RVec<T> r;
-   r.reserve(size);
-   for (size_type i=0; i<size; i++) {
-      r.emplace_back(c[i] != 0 ? v1 : v2);
-   }
-   return r;
+   const int *cond = c.data();
+   return ROOT::Detail::VecOps::MakeRVec<T>(c.size(), [=](std::size_t i) { return cond[i] != 0 ? v1 : v2; });
 }
 
 /// Return the concatenation of two RVecs.
@@ -2874,8 +3182,20 @@ RVec<T> DeltaPhi(T v1, const RVec<T>& v2, const T c = M_PI)
 template <typename T>
 RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
-   const auto dphi = DeltaPhi(phi1, phi2, c);
-   return (eta1 - eta2) * (eta1 - eta2) + dphi * dphi;
+   const std::size_t size = eta1.size();
+   if (eta2.size() != size || phi1.size() != size || phi2.size() != size)
+      throw std::runtime_error("Cannot compute DeltaR2 of vectors of different sizes");
+
+   // no temporaries, and the loop without the branches of DeltaPhi can be vectorized; the operations are the same
+   // as in (eta1 - eta2) * (eta1 - eta2) + dphi * dphi, so are the results
+   RVec<T> r(size);
+   for (std::size_t i = 0u; i < size; ++i)
+      r[i] = DeltaPhi(phi1[i], phi2[i], c);
+   for (std::size_t i = 0u; i < size; ++i) {
+      const T deta = eta1[i] - eta2[i];
+      r[i] = deta * deta + r[i] * r[i];
+   }
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -2888,7 +3208,10 @@ RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, c
 template <typename T>
 RVec<T> DeltaR(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
-   return sqrt(DeltaR2(eta1, eta2, phi1, phi2, c));
+   auto r = DeltaR2(eta1, eta2, phi1, phi2, c);
+   for (auto &x : r)
+      x = std::sqrt(x);
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -2905,6 +3228,51 @@ T DeltaR(T eta1, T eta2, T phi1, T phi2, const T c = M_PI)
    return std::sqrt((eta1 - eta2) * (eta1 - eta2) + dphi * dphi);
 }
 
+/// Return the invariant mass of two particles given the collections of the quantities
+/// momentum along x (px), momentum along y (py), momentum along z (pz) and mass.
+///
+/// The function computes the invariant mass of two particles with the four-vectors
+/// (px1, py1, pz1, mass1) and (px2, py2, pz2, mass2). There are no transcendental
+/// functions in the loop, which the compiler can vectorize: for columns in the
+/// (pt, eta, phi, mass) coordinate system that are used several times, converting
+/// them once with e.g. `pt * cos(phi)`, or the ROOT::VecOps::fast_cosf and similar
+/// vdt functions in single precision, is faster than calling InvariantMasses.
+template <typename T>
+RVec<T> InvariantMasses_PxPyPzM(
+        const RVec<T>& px1, const RVec<T>& py1, const RVec<T>& pz1, const RVec<T>& mass1,
+        const RVec<T>& px2, const RVec<T>& py2, const RVec<T>& pz2, const RVec<T>& mass2)
+{
+   const std::size_t size = px1.size();
+
+   R__ASSERT(py1.size() == size && pz1.size() == size && mass1.size() == size);
+   R__ASSERT(px2.size() == size && py2.size() == size && pz2.size() == size && mass2.size() == size);
+
+   RVec<T> inv_masses(size);
+
+   for (std::size_t i = 0u; i < size; ++i) {
+      const auto x1 = px1[i];
+      const auto y1 = py1[i];
+      const auto z1 = pz1[i];
+      const auto e1 = std::sqrt(x1 * x1 + y1 * y1 + z1 * z1 + mass1[i] * mass1[i]);
+
+      const auto x2 = px2[i];
+      const auto y2 = py2[i];
+      const auto z2 = pz2[i];
+      const auto e2 = std::sqrt(x2 * x2 + y2 * y2 + z2 * z2 + mass2[i] * mass2[i]);
+
+      // Addition of particle four-vector elements
+      const auto e = e1 + e2;
+      const auto x = x1 + x2;
+      const auto y = y1 + y2;
+      const auto z = z1 + z2;
+
+      inv_masses[i] = std::sqrt(e * e - x * x - y * y - z * z);
+   }
+
+   // Return invariant mass with (+, -, -, -) metric
+   return inv_masses;
+}
+
 /// Return the invariant mass of two particles given the collections of the quantities
 /// transverse momentum (pt), rapidity (eta), azimuth (phi) and mass.
 ///
@@ -3245,6 +3613,7 @@ RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_tanf)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_asinf)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_acosf)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_atanf)
+RVEC_EXTERN_VDT_UNARY_FUNCTION(float, fast_isqrtf)
 
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_exp)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_log)
@@ -3254,6 +3623,7 @@ RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_tan)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_asin)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_acos)
 RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_atan)
+RVEC_EXTERN_VDT_UNARY_FUNCTION(double, fast_isqrt)
 
 #endif // R__HAS_VDT
 
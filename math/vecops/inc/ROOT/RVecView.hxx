@@ -0,0 +1,244 @@
+// @(#)root/vecops:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVECVIEW
+#define ROOT_RVECVIEW
+
+#include "ROOT/RVec.hxx"
+
+#include <algorithm>
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace ROOT {
+namespace VecOps {
+
+/**
+\class ROOT::VecOps::RVecView
+\ingroup vecops
+\brief A read-only view of elements of type T that lie at a constant distance (the stride) in memory.
+
+In contrast to an RVec, the elements need not be contiguous: an RVecView can look at a data member of the elements
+of an array of structs, or directly at the buffer of a non-split branch, without copying the values. It never owns
+memory and is only valid as long as the memory it looks at.
+
+An RVecView provides the read-only interface of a vector (size(), operator[], iteration) and the most common
+reductions and comparisons of VecOps. AsRVec() returns an RVec, which adopts the memory when it is contiguous, for
+the other VecOps functions:
+~~~{.cpp}
+struct Muon { float pt, eta; };
+std::vector<Muon> muons(10);
+ROOT::RVecView<float> pts(&muons[0].pt, muons.size(), sizeof(Muon));
+auto sumPt = Sum(pts);
+auto nPositive = Sum(pts > 0.f);
+auto sorted = ROOT::VecOps::Sort(pts.AsRVec()); // AsRVec() copies the values here, since they are not contiguous
+~~~
+
+RDataFrame reads TTree collection branches which are requested as `RVecView<T>` without the copy that an RVec<T>
+requires when the elements are not contiguous in the branch buffer, e.g. for a data member of the elements of a
+non-split collection. Such a column is only valid for the current entry.
+*/
+template <typename T>
+class RVecView {
+public:
+   using value_type = T;
+   using size_type = std::size_t;
+   using difference_type = std::ptrdiff_t;
+   using const_reference = const T &;
+   using reference = const T &;
+
+   /// A random access iterator over the elements of an RVecView
+   class const_iterator {
+   public:
+      using iterator_category = std::random_access_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const T *;
+      using reference = const T &;
+
+   private:
+      const char *fPtr = nullptr;
+      difference_type fStride = sizeof(T);
+
+   public:
+      const_iterator() = default;
+      const_iterator(const char *ptr, difference_type stride) : fPtr(ptr), fStride(stride) {}
+
+      reference operator*() const { return *reinterpret_cast<const T *>(fPtr); }
+      pointer operator->() const { return reinterpret_cast<const T *>(fPtr); }
+      reference operator[](difference_type n) const { return *reinterpret_cast<const T *>(fPtr + n * fStride); }
+
+      const_iterator &operator++()
+      {
+         fPtr += fStride;
+         return *this;
+      }
+      const_iterator operator++(int)
+      {
+         auto old = *this;
+         fPtr += fStride;
+         return old;
+      }
+      const_iterator &operator--()
+      {
+         fPtr -= fStride;
+         return *this;
+      }
+      const_iterator operator--(int)
+      {
+         auto old = *this;
+         fPtr -= fStride;
+         return old;
+      }
+      const_iterator &operator+=(difference_type n)
+      {
+         fPtr += n * fStride;
+         return *this;
+      }
+      const_iterator &operator-=(difference_type n)
+      {
+         fPtr -= n * fStride;
+         return *this;
+      }
+      friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+      friend const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+      friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+      friend difference_type operator-(const const_iterator &a, const const_iterator &b)
+      {
+         return (a.fPtr - b.fPtr) / a.fStride;
+      }
+
+      friend bool operator==(const const_iterator &a, const const_iterator &b) { return a.fPtr == b.fPtr; }
+      friend bool operator!=(const const_iterator &a, const const_iterator &b) { return a.fPtr != b.fPtr; }
+      friend bool operator<(const const_iterator &a, const const_iterator &b) { return a - b < 0; }
+      friend bool operator>(const const_iterator &a, const const_iterator &b) { return b < a; }
+      friend bool operator<=(const const_iterator &a, const const_iterator &b) { return !(b < a); }
+      friend bool operator>=(const const_iterator &a, const const_iterator &b) { return !(a < b); }
+   };
+   using iterator = const_iterator;
+
+private:
+   const char *fData = nullptr;
+   size_type fSize = 0;
+   difference_type fStride = sizeof(T); ///< Distance between two elements, in bytes
+
+public:
+   RVecView() = default;
+
+   /// View size elements, the first one at data and the following ones every stride bytes
+   RVecView(const T *data, size_type size, difference_type stride = sizeof(T))
+      : fData(reinterpret_cast<const char *>(data)), fSize(size), fStride(stride)
+   {
+   }
+
+   /// View the elements of an RVec, which must outlive the view
+   RVecView(const RVec<T> &v) : RVecView(v.data(), v.size()) {}
+
+   size_type size() const { return fSize; }
+   bool empty() const { return fSize == 0; }
+   difference_type stride() const { return fStride; }
+   /// Whether the elements are contiguous in memory, as in an array
+   bool IsContiguous() const { return fStride == static_cast<difference_type>(sizeof(T)) || fSize < 2; }
+
+   const_reference operator[](size_type i) const { return *reinterpret_cast<const T *>(fData + i * fStride); }
+   const_reference at(size_type i) const
+   {
+      if (i >= fSize)
+         throw std::out_of_range("RVecView: index " + std::to_string(i) + " out of range (size " +
+                                 std::to_string(fSize) + ")");
+      return (*this)[i];
+   }
+   const_reference front() const { return (*this)[0]; }
+   const_reference back() const { return (*this)[fSize - 1]; }
+
+   const_iterator begin() const { return const_iterator(fData, fStride); }
+   const_iterator end() const { return const_iterator(fData + fSize * fStride, fStride); }
+   const_iterator cbegin() const { return begin(); }
+   const_iterator cend() const { return end(); }
+
+   /// Return the elements as an RVec. If they are contiguous, the RVec adopts their memory (it must not be modified
+   /// then), otherwise it holds a copy.
+   RVec<T> AsRVec() const
+   {
+      if (fSize == 0)
+         return RVec<T>();
+      if (IsContiguous())
+         return RVec<T>(const_cast<T *>(&front()), fSize);
+      return RVec<T>(begin(), end());
+   }
+
+   /// Return a copy of the elements
+   explicit operator RVec<T>() const { return RVec<T>(begin(), end()); }
+};
+
+/// Sum of the elements of an RVecView
+template <typename T>
+T Sum(const RVecView<T> &v, const T zero = T(0))
+{
+   return v.IsContiguous() ? Sum(v.AsRVec(), zero) : std::accumulate(v.begin(), v.end(), zero);
+}
+
+/// Mean of the elements of an RVecView, 0 if it is empty
+template <typename T>
+double Mean(const RVecView<T> &v)
+{
+   return v.empty() ? 0. : double(Sum(v)) / v.size();
+}
+
+/// Largest element of an RVecView, which must not be empty
+template <typename T>
+T Max(const RVecView<T> &v)
+{
+   return *std::max_element(v.begin(), v.end());
+}
+
+/// Smallest element of an RVecView, which must not be empty
+template <typename T>
+T Min(const RVecView<T> &v)
+{
+   return *std::min_element(v.begin(), v.end());
+}
+
+/// \cond
+#define RVECVIEW_LOGICAL_OPERATOR(OP)                                          \
+template <typename T0, typename T1>                                            \
+RVec<int> operator OP(const RVecView<T0> &v, const T1 &y)                      \
+{                                                                              \
+   return ROOT::Detail::VecOps::MakeRVec<int>(                                 \
+      v.size(), [&](std::size_t i) -> int { return v[i] OP y; });              \
+}                                                                              \
+                                                                               \
+template <typename T0, typename T1>                                            \
+RVec<int> operator OP(const T0 &x, const RVecView<T1> &v)                      \
+{                                                                              \
+   return ROOT::Detail::VecOps::MakeRVec<int>(                                 \
+      v.size(), [&](std::size_t i) -> int { return x OP v[i]; });              \
+}
+
+RVECVIEW_LOGICAL_OPERATOR(<)
+RVECVIEW_LOGICAL_OPERATOR(>)
+RVECVIEW_LOGICAL_OPERATOR(==)
+RVECVIEW_LOGICAL_OPERATOR(!=)
+RVECVIEW_LOGICAL_OPERATOR(<=)
+RVECVIEW_LOGICAL_OPERATOR(>=)
+#undef RVECVIEW_LOGICAL_OPERATOR
+/// \endcond
+
+} // namespace VecOps
+
+template <typename T>
+using RVecView = ROOT::VecOps::RVecView<T>;
+
+} // namespace ROOT
+
+#endif
@@ -11,8 +11,16 @@
  *************************************************************************/
 
 #include "ROOT/RVec.hxx"
+
+#include <cstddef> // std::max_align_t
+
 using namespace ROOT::VecOps;
 
+namespace {
+/// The arena from which the RVecs grown on this thread allocate their buffers, see RVecArenaScope
+thread_local ROOT::Internal::VecOps::RVecArena *gActiveRVecArena = nullptr;
+} // namespace
+
 // Check that no bytes are wasted and everything is well-aligned.
 namespace {
 struct Struct16B {
@@ -68,8 +76,12 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    NewCapacity = std::min(std::max(NewCapacity, MinSize), SizeTypeMax());
 
    void *NewElts;
-   if (fBeginX == FirstEl || !this->Owns()) {
-      NewElts = malloc(NewCapacity * TSize);
+   // buffers allocated with malloc stay so, the others come from the active arena if any
+   const bool newBuffer = fBeginX == FirstEl || !this->Owns() || IsArenaBacked();
+   // (the capacity of an arena-backed buffer is stored as -(NewCapacity + 2), which must not overflow)
+   RVecArena *arena = newBuffer && NewCapacity < SizeTypeMax() - 2 ? gActiveRVecArena : nullptr;
+   if (newBuffer) {
+      NewElts = arena ? arena->Allocate(NewCapacity * TSize) : malloc(NewCapacity * TSize);
       R__ASSERT(NewElts != nullptr);
 
       // Copy the elements over.  No need to run dtors on PODs.
@@ -81,7 +93,55 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    }
 
    this->fBeginX = NewElts;
-   this->fCapacity = NewCapacity;
+   this->fCapacity = arena ? -static_cast<Size_T>(NewCapacity) - 2 : NewCapacity;
+}
+
+void *ROOT::Internal::VecOps::RVecArena::Allocate(std::size_t size)
+{
+   constexpr std::size_t kAlign = alignof(std::max_align_t);
+   size = (size + kAlign - 1) / kAlign * kAlign;
+   for (; fCurrent < fChunks.size(); ++fCurrent, fOffset = 0) {
+      if (fOffset + size <= fChunks[fCurrent].fSize) {
+         void *ptr = fChunks[fCurrent].fData.get() + fOffset;
+         fOffset += size;
+         return ptr;
+      }
+   }
+   const std::size_t chunkSize = std::max(kChunkSize, 2 * size);
+   fChunks.push_back({std::unique_ptr<char[]>(new char[chunkSize]), chunkSize});
+   fCurrent = fChunks.size() - 1;
+   fOffset = size;
+   return fChunks.back().fData.get();
+}
+
+void ROOT::Internal::VecOps::RVecArena::Reset()
+{
+   if (fCurrent > 0) {
+      // the allocations did not fit in one chunk: use a single one for all of them from now on
+      const std::size_t capacity = GetCapacity();
+      fChunks.clear();
+      fChunks.push_back({std::unique_ptr<char[]>(new char[capacity]), capacity});
+   }
+   fCurrent = 0;
+   fOffset = 0;
+}
+
+std::size_t ROOT::Internal::VecOps::RVecArena::GetCapacity() const
+{
+   std::size_t capacity = 0;
+   for (const auto &chunk : fChunks)
+      capacity += chunk.fSize;
+   return capacity;
+}
+
+ROOT::Internal::VecOps::RVecArenaScope::RVecArenaScope(RVecArena *arena) : fPrevious(gActiveRVecArena)
+{
+   gActiveRVecArena = arena;
+}
+
+ROOT::Internal::VecOps::RVecArenaScope::~RVecArenaScope()
+{
+   gActiveRVecArena = fPrevious;
 }
 
 #if (_VECOPS_USE_EXTERN_TEMPLATES)
@@ -247,6 +307,7 @@ RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_tanf)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_asinf)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_acosf)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_atanf)
+RVEC_DECLARE_VDT_UNARY_FUNCTION(float, fast_isqrtf)
 
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_exp)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_log)
@@ -256,6 +317,7 @@ RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_tan)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_asin)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_acos)
 RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_atan)
+RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_isqrt)
 
 #endif // R__HAS_VDT
 
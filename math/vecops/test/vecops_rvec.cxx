@@ -3,6 +3,7 @@
 #include <Math/PtEtaPhiM4D.h>
 #include <Math/Vector4Dfwd.h>
 #include <ROOT/RVec.hxx>
+#include <ROOT/RVecView.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TFile.h>
 #include <TInterpreter.h>
@@ -469,9 +470,56 @@ TEST(VecOps, MathFuncs)
    CHECK_VDT_FUNC(atan)
    CHECK_VDT_FUNC(acos)
    CHECK_VDT_FUNC(atan)
+   CHECK_VDT_FUNC(isqrt)
 #endif
 }
 
+#ifdef R__HAS_VDT
+TEST(VecOps, FastMathFuncs)
+{
+   RVecD v{0.1, 0.5, 0.9, -0.3};
+   RVecF vf{0.1f, 0.5f, 0.9f, -0.3f};
+
+   // the vdt function of the precision of the elements
+   CheckEqual(Fast::exp(v), fast_exp(v));
+   CheckEqual(Fast::log(v + 1.), fast_log(v + 1.));
+   CheckEqual(Fast::atan(v), fast_atan(v));
+   CheckEqual(Fast::exp(vf), fast_expf(vf));
+   CheckEqual(Fast::sin(vf), fast_sinf(vf));
+   CheckEqual(Fast::isqrt(vf + 1.f), fast_isqrtf(vf + 1.f));
+   static_assert(std::is_same<decltype(Fast::cos(vf)), RVecF>::value, "single precision for floats");
+   static_assert(std::is_same<decltype(Fast::cos(RVecI{1})), RVecD>::value, "double precision for integers");
+
+   CheckEqual(Fast::atan2(v, 0.5), Map(v, [](double y) { return vdt::fast_atan2(y, 0.5); }));
+   CheckEqual(Fast::atan2(vf, vf * 2.f), Map(vf, [](float y) { return vdt::fast_atan2f(y, y * 2.f); }));
+   EXPECT_THROW(Fast::atan2(v, RVecD(2)), std::runtime_error);
+}
+
+TEST(VecOps, FastDeltaR)
+{
+   RVecD phi1, phi2, eta1, eta2;
+   for (int i = 0; i < 100; ++i) {
+      phi1.push_back(-3.1 + 0.062 * i);
+      phi2.push_back(std::sin(i) * 3.1);
+      eta1.push_back(-2.5 + 0.05 * i);
+      eta2.push_back(std::cos(i) * 2.5);
+   }
+   const auto dphi = Fast::DeltaPhi(phi1, phi2);
+   const auto expected = DeltaPhi(phi1, phi2);
+   for (std::size_t i = 0; i < dphi.size(); ++i)
+      EXPECT_NEAR(dphi[i], expected[i], 1e-12);
+   const auto dr = Fast::DeltaR(eta1, eta2, phi1, phi2);
+   const auto expectedDr = DeltaR(eta1, eta2, phi1, phi2);
+   for (std::size_t i = 0; i < dr.size(); ++i)
+      EXPECT_NEAR(dr[i], expectedDr[i], 1e-12);
+
+   // degrees, and angles of several turns
+   CheckEqual(Fast::DeltaPhi(RVecF{10.f, 350.f, 0.f}, RVecF{350.f, 10.f, 720.f + 90.f}, 180.f),
+              RVecF{-20.f, 20.f, 90.f});
+   EXPECT_THROW(Fast::DeltaPhi(phi1, RVecD(3)), std::runtime_error);
+}
+#endif
+
 TEST(VecOps, PhysicsSelections)
 {
    // We emulate 8 muons
@@ -1090,6 +1138,132 @@ TEST(VecOps, Where)
    CheckEqual(v9, RVecF{1, -1, -1, -1});
 }
 
+// the selections on large RVecs, whose loops are written to be vectorized, against plain loops
+TEST(VecOps, LargeSelections)
+{
+   RVecD v(1000);
+   for (std::size_t i = 0; i < v.size(); ++i)
+      v[i] = (i * 7919) % 1000 / 10.; // values in [0, 100) in irregular order
+   const RVecD w = v - 50.;
+
+   const auto mask = v > 30. && w < 30.;
+   RVecD selected, where;
+   for (std::size_t i = 0; i < v.size(); ++i) {
+      EXPECT_EQ(mask[i], v[i] > 30. && w[i] < 30.);
+      if (mask[i])
+         selected.push_back(v[i]);
+      where.push_back(mask[i] ? v[i] : w[i]);
+   }
+   CheckEqual(v[mask], selected);
+   CheckEqual(Where(mask, v, w), where);
+   EXPECT_EQ(v[v < 0.].size(), 0u);
+   EXPECT_EQ(v[v >= 0.].size(), v.size());
+
+   RVec<std::size_t> indices(300);
+   for (std::size_t i = 0; i < indices.size(); ++i)
+      indices[i] = (i * 13) % v.size();
+   const auto taken = Take(v, indices);
+   ASSERT_EQ(taken.size(), indices.size());
+   for (std::size_t i = 0; i < indices.size(); ++i)
+      EXPECT_EQ(taken[i], v[indices[i]]);
+
+   // elements which are not trivially copyable
+   RVec<std::string> s{"a", "b", "c", "d"};
+   const RVec<std::string> sRef{"b", "d"};
+   EXPECT_TRUE(All(s[RVecI{0, 1, 0, 1}] == sRef));
+   EXPECT_TRUE(All(Where(RVecI{0, 1, 0, 1}, s, std::string("x")) == RVec<std::string>{"x", "b", "x", "d"}));
+}
+
+TEST(VecOps, LargeSum)
+{
+   for (std::size_t n : {0u, 1u, 15u, 16u, 17u, 1000u, 1001u}) {
+      RVecF f(n);
+      RVecI i(n);
+      long double ref = 0.;
+      for (std::size_t k = 0; k < n; ++k) {
+         f[k] = 1.f / (k + 1);
+         i[k] = k % 17 - 8;
+         ref += f[k];
+      }
+      EXPECT_NEAR(Sum(f), ref, 1e-5) << n;
+      EXPECT_FLOAT_EQ(Sum(f, 1.f), float(ref + 1.));
+      EXPECT_EQ(Sum(i), std::accumulate(i.begin(), i.end(), 0)) << n;
+   }
+}
+
+// operations on temporary RVecs store their results in the temporaries' buffers
+TEST(VecOps, OperationsOnTemporaries)
+{
+   RVecD px(100, 3.), py(100, 4.);
+   const auto pt = sqrt(px * px + py * py);
+   CheckEqual(pt, RVecD(100, 5.));
+
+   RVecD t = px + 1.;
+   const double *buffer = t.data();
+   const auto r = 2. * (std::move(t) - py);
+   EXPECT_EQ(r.data(), buffer);
+   CheckEqual(r, RVecD(100, 0.));
+
+   // no reuse if the type of the result is different
+   RVecI i(100, 3);
+   const auto d = (i + 1) * 0.5;
+   static_assert(std::is_same<decltype(d), const RVecD>::value, "the result must be promoted");
+   CheckEqual(d, RVecD(100, 2.));
+   EXPECT_TRUE(All((-(i + 1) % 3) == RVecI(100, -1)));
+
+   // temporaries adopting memory do not modify it
+   double values[3] = {1., 2., 3.};
+   CheckEqual(RVecD(values, 3) * 2. + RVecD(values, 3), RVecD{3., 6., 9.});
+   CheckEqual(-RVecD(values, 3), RVecD{-1., -2., -3.});
+   CheckEqual(sqrt(RVecD(values, 3)), RVecD{1., std::sqrt(2.), std::sqrt(3.)});
+   EXPECT_EQ(values[0], 1.);
+   EXPECT_EQ(values[1], 2.);
+   EXPECT_EQ(values[2], 3.);
+
+   EXPECT_THROW(px + 1. + RVecD(3), std::runtime_error);
+}
+
+TEST(VecOps, View)
+{
+   struct Muon {
+      float pt;
+      int charge;
+   };
+   std::vector<Muon> muons{{10.f, 1}, {25.f, -1}, {5.f, -1}, {40.f, 1}};
+   ROOT::RVecView<float> pts(&muons[0].pt, muons.size(), sizeof(Muon));
+   ROOT::RVecView<int> charges(&muons[0].charge, muons.size(), sizeof(Muon));
+   EXPECT_FALSE(pts.IsContiguous());
+   ASSERT_EQ(pts.size(), 4u);
+   EXPECT_EQ(pts[1], 25.f);
+   EXPECT_EQ(pts.back(), 40.f);
+   EXPECT_EQ(pts.end() - pts.begin(), 4);
+   EXPECT_THROW(pts.at(4), std::out_of_range);
+   EXPECT_FLOAT_EQ(Sum(pts), 80.f);
+   EXPECT_FLOAT_EQ(Mean(pts), 20.);
+   EXPECT_EQ(Max(pts), 40.f);
+   EXPECT_EQ(Min(pts), 5.f);
+   CheckEqual(pts > 20.f, RVecI{0, 1, 0, 1});
+   CheckEqual(charges == -1, RVecI{0, 1, 1, 0});
+   EXPECT_EQ(Sum(pts.AsRVec()[charges > 0]), 50.f);
+
+   // the copy of non-contiguous elements
+   const auto copy = pts.AsRVec();
+   CheckEqual(copy, RVecF{10.f, 25.f, 5.f, 40.f});
+   muons[0].pt = 1.f;
+   EXPECT_EQ(pts[0], 1.f);
+   EXPECT_EQ(copy[0], 10.f);
+
+   // the adoption of contiguous ones
+   RVecF v{1.f, 2.f, 3.f};
+   ROOT::RVecView<float> view(v);
+   EXPECT_TRUE(view.IsContiguous());
+   const auto adopting = view.AsRVec();
+   EXPECT_EQ(adopting.data(), v.data());
+   CheckEqual(Sort(view.AsRVec()), v);
+   EXPECT_TRUE(ROOT::RVecView<float>().empty());
+   EXPECT_TRUE(ROOT::RVecView<float>().AsRVec().empty());
+}
+
 TEST(VecOps, AtWithFallback)
 {
    RVec<float> v({1.f, 2.f, 3.f});
@@ -1208,6 +1382,24 @@ TEST(VecOps, InvariantMass)
    }
 
    EXPECT_NEAR(p5.M(), invMass3, 1e-4);
+
+   // Same with the collections in the (px, py, pz, mass) coordinate system
+   RVec<double> px1(mass1.size()), py1(mass1.size()), pz1(mass1.size());
+   RVec<double> px2(mass2.size()), py2(mass2.size()), pz2(mass2.size());
+   for (size_t i = 0; i < mass1.size(); i++) {
+      TLorentzVector p1, p2;
+      p1.SetPtEtaPhiM(pt1[i], eta1[i], phi1[i], mass1[i]);
+      p2.SetPtEtaPhiM(pt2[i], eta2[i], phi2[i], mass2[i]);
+      px1[i] = p1.Px();
+      py1[i] = p1.Py();
+      pz1[i] = p1.Pz();
+      px2[i] = p2.Px();
+      py2[i] = p2.Py();
+      pz2[i] = p2.Pz();
+   }
+   const auto invMass4 = InvariantMasses_PxPyPzM(px1, py1, pz1, mass1, px2, py2, pz2, mass2);
+   for (size_t i = 0; i < mass1.size(); i++)
+      EXPECT_NEAR(invMass4[i], invMass[i], 1e-4);
 }
 
 TEST(VecOps, DeltaR)
@@ -1233,6 +1425,14 @@ TEST(VecOps, DeltaR)
       auto dr4 = DeltaR(eta1[i], eta2[i], phi1[i], phi2[i]);
       EXPECT_NEAR(dr3, dr4, 1e-6);
    }
+
+   // the fused loop gives the same results as the composition of the vector operations
+   const auto dphi = DeltaPhi(phi1, phi2);
+   const auto deta = eta1 - eta2;
+   CheckEqual(DeltaR2(eta1, eta2, phi1, phi2), deta * deta + dphi * dphi);
+
+   RVec<double> shorter = {0.1, 0.2};
+   EXPECT_THROW(DeltaR2(eta1, eta2, shorter, phi2), std::runtime_error);
 }
 
 TEST(VecOps, Map)
@@ -1359,6 +1559,52 @@ struct ThrowingCopy {
    ThrowingCopy &operator=(ThrowingCopy &&) = default;
 };
 
+TEST(VecOps, ArenaAllocation)
+{
+   ROOT::Internal::VecOps::RVecArena arena;
+   ROOT::RVec<double> before(100, 1.);
+   {
+      ROOT::Internal::VecOps::RVecArenaScope scope(&arena);
+      ROOT::RVec<double> v(100, 2.);
+      ROOT::RVec<int> small{1, 2, 3};
+      EXPECT_TRUE(IsSmall(small));
+      EXPECT_FALSE(IsSmall(v));
+      EXPECT_GE(arena.GetCapacity(), 100 * sizeof(double));
+      // growing an arena-backed RVec takes new memory from the arena
+      for (int i = 0; i < 10000; ++i)
+         v.push_back(i);
+      EXPECT_EQ(v.size(), 10100u);
+      EXPECT_GE(v.capacity(), 10100u);
+      EXPECT_EQ(v[99], 2.);
+      EXPECT_EQ(v[10099], 9999.);
+      // RVecs that already own heap memory keep it
+      before.resize(1000, 3.);
+      EXPECT_EQ(before[999], 3.);
+      ROOT::RVec<double> moved(std::move(v));
+      EXPECT_EQ(moved.size(), 10100u);
+   }
+   const auto capacity = arena.GetCapacity();
+   EXPECT_GT(capacity, ROOT::Internal::VecOps::RVecArena::kChunkSize);
+   // several chunks were used: after the reset a single one holds the same amount of memory
+   arena.Reset();
+   EXPECT_EQ(arena.GetCapacity(), capacity);
+   {
+      ROOT::Internal::VecOps::RVecArenaScope scope(&arena);
+      ROOT::RVec<float> v(10000, 1.f);
+      EXPECT_EQ(Sum(v), 10000.f);
+      // no arena in nested scopes that disable it: the RVec is heap-allocated and can outlive the outer scope
+      {
+         ROOT::Internal::VecOps::RVecArenaScope noArena(nullptr);
+         before = ROOT::RVec<double>(2000, 4.);
+      }
+      v.push_back(2.f);
+      EXPECT_EQ(v.size(), 10001u);
+   }
+   arena.Reset();
+   EXPECT_EQ(before.size(), 2000u);
+   EXPECT_EQ(before[1999], 4.);
+}
+
 // RVec does not guarantee exception safety, but we still want to test
 // that we don't segfault or otherwise crash if element construction or move throws.
 TEST(VecOps, NoExceptionSafety)
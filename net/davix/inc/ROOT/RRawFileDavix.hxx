@@ -28,7 +28,8 @@ struct RDavixFileDes;
 
 The RRawFileDavix class provides read-only access to remote non-ROOT files.  It uses the Davix library for
 the transport layer.  It instructs the RRawFile base class to buffer in larger chunks than the default for
-local files, assuming that remote file access has high(er) latency.
+local files, assuming that remote file access has high(er) latency. Vector reads are sent as a single multi-range
+request or, if Davix.ParallelRanges is set in rootrc, as that many concurrent single-range requests.
 
 */
 
@@ -10,11 +10,15 @@
  *************************************************************************/
 
 #include "ROOT/RRawFileDavix.hxx"
+#include "ROOT/RBlockCache.hxx"
+#include "TDavixFileInternal.h"
 
+#include <TEnv.h>
 #include <TError.h>
 
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <davix.hpp>
@@ -36,11 +40,50 @@ struct RDavixFileDes {
    DAVIX_FD *fd;
    Davix::Context ctx;
    Davix::DavPosix pos;
+   int parallelRanges = 0; ///< Concurrent single-range requests for vector reads, 0 for one multi-range request
+   RBlockCache *blockCache = nullptr; ///< Set if the reads go through the local block cache
+   std::string blockCacheKey;
+   std::uint64_t fileSize = 0;
 };
 
 } // namespace Internal
 } // namespace ROOT
 
+namespace {
+
+void DavixReadV(ROOT::Internal::RDavixFileDes &fileDes, const std::string &url,
+                ROOT::Internal::RRawFile::RIOVec *ioVec, unsigned int nReq)
+{
+   if (fileDes.parallelRanges > 0) {
+      std::string error;
+      if (TDavixFileInternal::ParallelReadV(fileDes.ctx, nullptr, url, ioVec, nReq, fileDes.parallelRanges, error) < 0)
+         throw std::runtime_error("Cannot do vector read from '" + url + "', error: " + error);
+      return;
+   }
+
+   Davix::DavixError *davixErr = NULL;
+   std::vector<Davix::DavIOVecInput> in(nReq);
+   std::vector<Davix::DavIOVecOuput> out(nReq);
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      in[i].diov_buffer = ioVec[i].fBuffer;
+      in[i].diov_offset = ioVec[i].fOffset;
+      in[i].diov_size = ioVec[i].fSize;
+      R__ASSERT(ioVec[i].fSize > 0);
+   }
+
+   auto ret = fileDes.pos.preadVec(fileDes.fd, in.data(), out.data(), nReq, &davixErr);
+   if (ret < 0) {
+      throw std::runtime_error("Cannot do vector read from '" + url + "', error: " + davixErr->getErrMsg());
+   }
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      ioVec[i].fOutBytes = out[i].diov_size;
+   }
+}
+
+} // anonymous namespace
+
 
 ROOT::Internal::RRawFileDavix::RRawFileDavix(std::string_view url, ROptions options)
    : RRawFile(url, options), fFileDes(new RDavixFileDes())
@@ -77,10 +120,29 @@ void ROOT::Internal::RRawFileDavix::OpenImpl()
    }
    if (fOptions.fBlockSize < 0)
       fOptions.fBlockSize = kDefaultBlockSize;
+   fFileDes->parallelRanges = gEnv->GetValue("Davix.ParallelRanges", 0);
+
+   if (auto blockCache = RBlockCache::Get()) {
+      struct stat buf;
+      if (fFileDes->pos.stat(nullptr, fUrl, &buf, &err) == 0) {
+         fFileDes->blockCache = blockCache;
+         fFileDes->fileSize = buf.st_size;
+         fFileDes->blockCacheKey = RBlockCache::MakeFileKey(fUrl, buf.st_size, buf.st_mtime);
+      }
+   }
 }
 
 size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
+   if (fFileDes->blockCache) {
+      RIOVec ioVec;
+      ioVec.fBuffer = buffer;
+      ioVec.fOffset = offset;
+      ioVec.fSize = nbytes;
+      ReadVImpl(&ioVec, 1);
+      return ioVec.fOutBytes;
+   }
+
    Davix::DavixError *err = nullptr;
    auto retval = fFileDes->pos.pread(fFileDes->fd, buffer, nbytes, offset, &err);
    if (retval < 0) {
@@ -91,23 +153,12 @@ size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, st
 
 void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
-   Davix::DavixError *davixErr = NULL;
-   std::vector<Davix::DavIOVecInput> in(nReq);
-   std::vector<Davix::DavIOVecOuput> out(nReq);
-
-   for (unsigned int i = 0; i < nReq; ++i) {
-      in[i].diov_buffer = ioVec[i].fBuffer;
-      in[i].diov_offset = ioVec[i].fOffset;
-      in[i].diov_size = ioVec[i].fSize;
-      R__ASSERT(ioVec[i].fSize > 0);
-   }
-
-   auto ret = fFileDes->pos.preadVec(fFileDes->fd, in.data(), out.data(), nReq, &davixErr);
-   if (ret < 0) {
-      throw std::runtime_error("Cannot do vector read from '" + fUrl + "', error: " + davixErr->getErrMsg());
-   }
-
-   for (unsigned int i = 0; i < nReq; ++i) {
-      ioVec[i].fOutBytes = out[i].diov_size;
+   if (fFileDes->blockCache) {
+      fFileDes->blockCache->ReadV(fFileDes->blockCacheKey, fFileDes->fileSize, ioVec, nReq,
+                                  [this](RIOVec *missing, unsigned int nMissing) {
+                                     DavixReadV(*fFileDes, fUrl, missing, nMissing);
+                                  });
+      return;
    }
+   DavixReadV(*fFileDes, fUrl, ioVec, nReq);
 }
@@ -40,6 +40,7 @@
 #include "TBase64.h"
 #include "TVirtualPerfStats.h"
 #include "TDavixFileInternal.h"
+#include "ROOT/RBlockCache.hxx"
 #include "snprintf.h"
 
 #include <cerrno>
@@ -47,9 +48,14 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <davix.hpp>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <cstring>
+#include <thread>
 
 
 static const std::string VERSION = "0.2.0";
@@ -394,11 +400,140 @@ Davix_fd *TDavixFileInternal::Open()
    } else {
       // setup ROOT style read
       davixPosix->fadvise(fd, 0, 300, Davix::AdviseRandom);
+      initBlockCache();
    }
 
    return fd;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Use the local block cache (see ROOT::Internal::RBlockCache), if configured,
+/// for files opened read-only. The cached blocks belong to the current size and
+/// modification time of the file.
+
+void TDavixFileInternal::initBlockCache()
+{
+   if ((oflags & O_ACCMODE) != O_RDONLY || (oflags & (O_CREAT | O_TRUNC)))
+      return;
+   auto cache = ROOT::Internal::RBlockCache::Get();
+   if (!cache)
+      return;
+
+   struct stat st;
+   DavixError *davixErr = NULL;
+   if (davixPosix->stat(davixParam, fUrl.GetUrl(), &st, &davixErr) < 0) {
+      DavixError::clearError(&davixErr);
+      return;
+   }
+   blockCacheFileSize = st.st_size;
+   blockCacheKey = ROOT::Internal::RBlockCache::MakeFileKey(fUrl.GetUrl(), st.st_size, st.st_mtime);
+   blockCache = cache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the ranges with concurrent single-range requests, at most concurrency
+/// of them at a time, on connections from davix's session pool. This serves
+/// endpoints that do not support multi-range requests (many S3 and Ceph RGW
+/// gateways), which davix would otherwise read one range after the other.
+/// Returns the number of bytes read, or -1 and sets error.
+
+Long64_t TDavixFileInternal::ParallelReadV(Davix::Context &context, const Davix::RequestParams *params,
+                                           const std::string &url, ROOT::Internal::RRawFile::RIOVec *ioVec,
+                                           unsigned int nReq, int concurrency, std::string &error)
+{
+   std::atomic<unsigned int> next{0};
+   std::mutex errorLock;
+   Davix::Uri uri(url);
+
+   auto worker = [&]() {
+      DavFile file(context, uri);
+      for (unsigned int i = next++; i < nReq; i = next++) {
+         DavixError *davixErr = NULL;
+         dav_ssize_t ret = file.readPartial(params, ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset, &davixErr);
+         if (ret < 0) {
+            std::lock_guard<std::mutex> guard(errorLock);
+            if (error.empty())
+               error = davixErr ? davixErr->getErrMsg() : std::string("unknown error");
+            DavixError::clearError(&davixErr);
+            next = nReq; // do not issue further requests
+            return;
+         }
+         ioVec[i].fOutBytes = ret;
+      }
+   };
+
+   const unsigned int nThreads = std::min<unsigned int>(std::max(concurrency, 1), nReq);
+   std::vector<std::thread> threads;
+   for (unsigned int i = 1; i < nThreads; ++i)
+      threads.emplace_back(worker);
+   worker();
+   for (auto &t : threads)
+      t.join();
+
+   if (!error.empty())
+      return -1;
+   Long64_t nbytes = 0;
+   for (unsigned int i = 0; i < nReq; ++i)
+      nbytes += ioVec[i].fOutBytes;
+   return nbytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Vector read, either as a single multi-range request or, if parallelRanges
+/// is set, as concurrent single-range requests. Returns the number of bytes
+/// read, or -1 and sets error.
+
+Long64_t TDavixFileInternal::readVec(Davix_fd *fd, ROOT::Internal::RRawFile::RIOVec *ioVec, unsigned int nReq,
+                                     std::string &error)
+{
+   if (parallelRanges > 0)
+      return ParallelReadV(*davixContext, davixParam, fUrl.GetUrl(), ioVec, nReq, parallelRanges, error);
+
+   std::vector<DavIOVecInput> in(nReq);
+   std::vector<DavIOVecOuput> out(nReq);
+   for (unsigned int i = 0; i < nReq; ++i) {
+      in[i].diov_buffer = ioVec[i].fBuffer;
+      in[i].diov_offset = ioVec[i].fOffset;
+      in[i].diov_size = ioVec[i].fSize;
+   }
+   DavixError *davixErr = NULL;
+   Long64_t ret = davixPosix->preadVec(fd, in.data(), out.data(), nReq, &davixErr);
+   if (ret < 0) {
+      error = davixErr->getErrMsg();
+      DavixError::clearError(&davixErr);
+      return -1;
+   }
+   for (unsigned int i = 0; i < nReq; ++i)
+      ioVec[i].fOutBytes = out[i].diov_size;
+   return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Serve reads from the local block cache, fetching the missing blocks with a
+/// vector read. Returns the number of bytes read, or -1 in case of error.
+
+Long64_t TDavixFileInternal::readViaBlockCache(Davix_fd *fd, ROOT::Internal::RRawFile::RIOVec *ioVec,
+                                               unsigned int nReq)
+{
+   using RIOVec = ROOT::Internal::RRawFile::RIOVec;
+   try {
+      blockCache->ReadV(blockCacheKey, blockCacheFileSize, ioVec, nReq,
+                        [this, fd](RIOVec *missing, unsigned int nMissing) {
+                           std::string error;
+                           if (readVec(fd, missing, nMissing, error) < 0)
+                              throw std::runtime_error(error);
+                        });
+   } catch (const std::runtime_error &e) {
+      Error("DavixReadBlocks", "can not read data with davix: %s", e.what());
+      return -1;
+   }
+
+   Long64_t nbytes = 0;
+   for (unsigned int i = 0; i < nReq; ++i)
+      nbytes += ioVec[i].fOutBytes;
+   return nbytes;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 void TDavixFileInternal::Close()
@@ -564,6 +699,8 @@ void TDavixFileInternal::parseConfig()
    env_var = gEnv->GetValue("Davix.GSI.GridMode", (const char *)"y");
    if (!isno(env_var))
       enableGridMode();
+
+   parallelRanges = gEnv->GetValue("Davix.ParallelRanges", 0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -913,11 +1050,22 @@ Long64_t TDavixFile::DavixReadBuffer(Davix_fd *fd, char *buf, Int_t len)
    DavixError *davixErr = NULL;
    Double_t start_time = eventStart();
 
-   Long64_t ret = d_ptr->davixPosix->pread(fd, buf, len, fOffset, &davixErr);
+   Long64_t ret;
+   if (d_ptr->blockCache) {
+      ROOT::Internal::RRawFile::RIOVec ioVec;
+      ioVec.fBuffer = buf;
+      ioVec.fOffset = fOffset;
+      ioVec.fSize = len;
+      ret = d_ptr->readViaBlockCache(fd, &ioVec, 1);
+   } else {
+      ret = d_ptr->davixPosix->pread(fd, buf, len, fOffset, &davixErr);
+   }
    if (ret < 0) {
-      Error("DavixReadBuffer", "can not read data with davix: %s (%d)",
-            davixErr->getErrMsg().c_str(), davixErr->getStatus());
-      DavixError::clearError(&davixErr);
+      if (davixErr) {
+         Error("DavixReadBuffer", "can not read data with davix: %s (%d)",
+               davixErr->getErrMsg().c_str(), davixErr->getStatus());
+         DavixError::clearError(&davixErr);
+      }
    } else {
       fOffset += ret;
       eventStop(start_time, ret);
@@ -953,11 +1101,22 @@ Long64_t TDavixFile::DavixPReadBuffer(Davix_fd *fd, char *buf, Long64_t pos, Int
    DavixError *davixErr = NULL;
    Double_t start_time = eventStart();
 
-   Long64_t ret = d_ptr->davixPosix->pread(fd, buf, len, pos, &davixErr);
+   Long64_t ret;
+   if (d_ptr->blockCache) {
+      ROOT::Internal::RRawFile::RIOVec ioVec;
+      ioVec.fBuffer = buf;
+      ioVec.fOffset = pos;
+      ioVec.fSize = len;
+      ret = d_ptr->readViaBlockCache(fd, &ioVec, 1);
+   } else {
+      ret = d_ptr->davixPosix->pread(fd, buf, len, pos, &davixErr);
+   }
    if (ret < 0) {
-      Error("DavixPReadBuffer", "can not read data with davix: %s (%d)",
-            davixErr->getErrMsg().c_str(), davixErr->getStatus());
-      DavixError::clearError(&davixErr);
+      if (davixErr) {
+         Error("DavixPReadBuffer", "can not read data with davix: %s (%d)",
+               davixErr->getErrMsg().c_str(), davixErr->getStatus());
+         DavixError::clearError(&davixErr);
+      }
    } else {
       eventStop(start_time, ret);
    }
@@ -983,11 +1142,31 @@ Long64_t TDavixFile::DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, In
       lastPos += len[i];
    }
 
-   Long64_t ret = d_ptr->davixPosix->preadVec(fd, in, out, nbuf, &davixErr);
+   Long64_t ret;
+   if (d_ptr->blockCache || d_ptr->parallelRanges > 0) {
+      std::vector<ROOT::Internal::RRawFile::RIOVec> ioVec(nbuf);
+      for (Int_t i = 0; i < nbuf; ++i) {
+         ioVec[i].fBuffer = in[i].diov_buffer;
+         ioVec[i].fOffset = in[i].diov_offset;
+         ioVec[i].fSize = in[i].diov_size;
+      }
+      if (d_ptr->blockCache) {
+         ret = d_ptr->readViaBlockCache(fd, ioVec.data(), nbuf);
+      } else {
+         std::string error;
+         ret = d_ptr->readVec(fd, ioVec.data(), nbuf, error);
+         if (ret < 0)
+            Error("DavixReadBuffers", "can not read data with davix: %s", error.c_str());
+      }
+   } else {
+      ret = d_ptr->davixPosix->preadVec(fd, in, out, nbuf, &davixErr);
+   }
    if (ret < 0) {
-      Error("DavixReadBuffers", "can not read data with davix: %s (%d)",
-            davixErr->getErrMsg().c_str(), davixErr->getStatus());
-      DavixError::clearError(&davixErr);
+      if (davixErr) {
+         Error("DavixReadBuffers", "can not read data with davix: %s (%d)",
+               davixErr->getErrMsg().c_str(), davixErr->getStatus());
+         DavixError::clearError(&davixErr);
+      }
    } else {
       eventStop(start_time, ret);
    }
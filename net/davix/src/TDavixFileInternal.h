@@ -15,6 +15,8 @@
 #include "TUrl.h"
 #include "TMutex.h"
 
+#include <ROOT/RRawFile.hxx>
+
 #include <vector>
 #include <iterator>
 #include <algorithm>
@@ -49,6 +51,12 @@ namespace Davix {
 }
 struct Davix_fd;
 
+namespace ROOT {
+namespace Internal {
+class RBlockCache;
+}
+}
+
 
 class TDavixFileInternal {
    friend class TDavixFile;
@@ -118,6 +126,12 @@ private:
 
    void removeDird(void* fd);
 
+   void initBlockCache();
+
+   Long64_t readViaBlockCache(Davix_fd *fd, ROOT::Internal::RRawFile::RIOVec *ioVec, unsigned int nReq);
+
+   Long64_t readVec(Davix_fd *fd, ROOT::Internal::RRawFile::RIOVec *ioVec, unsigned int nReq, std::string &error);
+
    std::vector<std::string> getReplicas()
    {
      return replicas;
@@ -138,9 +152,22 @@ private:
    int oflags;
    std::vector<void*> dirdVec;
 
+   // Number of concurrent single-range requests issued by vector reads, 0 for
+   // a single multi-range request (see Davix.ParallelRanges)
+   int parallelRanges = 0;
+
+   // Local block cache, if used for this file
+   ROOT::Internal::RBlockCache *blockCache = nullptr;
+   std::string blockCacheKey;
+   Long64_t blockCacheFileSize = 0;
+
 public:
    Int_t DavixStat(const char *url, struct stat *st);
 
+   static Long64_t ParallelReadV(Davix::Context &context, const Davix::RequestParams *params, const std::string &url,
+                                 ROOT::Internal::RRawFile::RIOVec *ioVec, unsigned int nReq, int concurrency,
+                                 std::string &error);
+
    static Davix::Context* getDavixInstance();
 };
 
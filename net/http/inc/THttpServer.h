@@ -51,6 +51,7 @@ protected:
    std::string fDrawPage;        ///<! file name for drawing of single element
    std::string fDrawPageCont;    ///<! content of draw html page
    std::string fCors;            ///<! CORS: sets Access-Control-Allow-Origin header for ProcessRequest responses
+   Long_t fCacheAge{0};          ///<! time in ms during which cached root.json data served directly in engine threads
 
    std::mutex fMutex;                                        ///<! mutex to protect list with arguments
    std::queue<std::shared_ptr<THttpCallArg>> fArgs;          ///<! submitted arguments
@@ -64,6 +65,8 @@ protected:
 
    virtual void ProcessBatchHolder(std::shared_ptr<THttpCallArg> &arg);
 
+   Bool_t ProcessCachedRequest(std::shared_ptr<THttpCallArg> &arg);
+
    void StopServerThread();
 
    std::string BuildWSEntryPage();
@@ -112,6 +115,11 @@ public:
    /** Returns specified CORS domain */
    const char *GetCors() const { return fCors.c_str(); }
 
+   void SetProduceCache(Bool_t on = kTRUE, Long_t maxage = 0);
+
+   /** Returns time in ms during which cached data can be served without involving main thread */
+   Long_t GetProduceCacheAge() const { return fCacheAge; }
+
    /** set name of top item in objects hierarchy */
    void SetTopName(const char *top) { fTopName = top; }
 
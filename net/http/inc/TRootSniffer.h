@@ -14,7 +14,10 @@
 
 #include "TNamed.h"
 #include "TList.h"
+#include <chrono>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 class TFolder;
@@ -128,6 +131,18 @@ protected:
    TList fRestrictions;                ///<! list of restrictions for different locations
    TString fAutoLoad;                  ///<! scripts names, which are add as _autoload parameter to h.json request
 
+   /** Serialized object, reused as long as the object version does not change */
+   struct ProduceCacheEntry {
+      void *fObj{nullptr};                              ///<! object which was serialized
+      ULong_t fVersion{0};                              ///<! version of the object when it was serialized
+      std::string fContent;                             ///<! produced data
+      std::chrono::steady_clock::time_point fValidated; ///<! last time the version was checked in the main thread
+   };
+
+   Bool_t fProduceCache{kFALSE};                                  ///<! reuse produced root.json and root.bin data
+   std::mutex fProduceCacheMutex;                                 ///<! protects fProduceCacheEntries
+   std::map<std::string, ProduceCacheEntry> fProduceCacheEntries; ///<! cached data, see MakeProduceCacheKey()
+
    void ScanObjectMembers(TRootSnifferScanRec &rec, TClass *cl, char *ptr);
 
    virtual void ScanObjectProperties(TRootSnifferScanRec &rec, TObject *obj);
@@ -157,6 +172,13 @@ protected:
 
    virtual Bool_t CanDrawClass(TClass *) { return kFALSE; }
 
+   virtual ULong_t GetObjectVersion(void *obj, TClass *cl);
+
+   static std::string MakeProduceCacheKey(const std::string &path, const std::string &file,
+                                          const std::string &options, const char *username);
+
+   Bool_t ProduceCached(const std::string &path, const std::string &file, const std::string &options, std::string &res);
+
    virtual Bool_t HasStreamerInfo() const { return kFALSE; }
 
    virtual Bool_t ProduceJson(const std::string &path, const std::string &options, std::string &res);
@@ -222,6 +244,16 @@ public:
 
    void SetCurrentCallArg(THttpCallArg *arg);
 
+   void SetProduceCache(Bool_t on = kTRUE);
+
+   /** Returns kTRUE when produced root.json and root.bin data are reused until the object changes */
+   Bool_t IsProduceCache() const { return fProduceCache; }
+
+   void ClearProduceCache();
+
+   Bool_t GetCachedProduce(const std::string &path, const std::string &file, const std::string &options,
+                           const char *username, Long_t maxage, std::string &res);
+
    /** Method scans normal objects, registered in ROOT */
    void ScanHierarchy(const char *topname, const char *path, TRootSnifferStore *store, Bool_t only_fields = kFALSE);
 
@@ -114,6 +114,8 @@ ClassImp(THttpServer);
 ///     noglobal       - disable scan of global lists
 ///     cors           - enable CORS header with origin="*"
 ///     cors=domain    - enable CORS header with origin="domain"
+///     cache          - reuse produced root.json/root.bin data until object changes, see SetProduceCache()
+///     cache=maxage   - same, and serve cached root.json directly in engine threads during maxage ms
 ///     basic_sniffer  - use basic sniffer without support of hist, gpad, graph classes
 ///
 /// For example, create http server, which allows cors headers and disable scan of global lists,
@@ -165,6 +167,9 @@ THttpServer::THttpServer(const char *engine) : TNamed("http", "ROOT http server"
 
    SetSniffer(sniff);
 
+   if (gEnv->GetValue("HttpServ.ProduceCache", 0))
+      SetProduceCache(kTRUE, gEnv->GetValue("HttpServ.ProduceCacheAge", 0));
+
    // start timer
    SetTimer(20, kTRUE);
 
@@ -187,6 +192,10 @@ THttpServer::THttpServer(const char *engine) : TNamed("http", "ROOT http server"
             SetCors(opt + 5);
          } else if (strcmp(opt, "cors") == 0) {
             SetCors("*");
+         } else if (strncmp(opt, "cache=", 6) == 0) {
+            SetProduceCache(kTRUE, atol(opt + 6));
+         } else if (strcmp(opt, "cache") == 0) {
+            SetProduceCache(kTRUE);
          } else
             CreateEngine(opt);
       }
@@ -227,6 +236,23 @@ void THttpServer::SetSniffer(TRootSniffer *sniff)
    fSniffer.reset(sniff);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable caching of produced root.json and root.bin data
+///
+/// Produced data is reused until the object is modified, see TRootSniffer::SetProduceCache().
+/// With maxage > 0, root.json requests for cached objects are answered directly in the
+/// engine threads (like civetweb worker threads), without waiting for the main thread,
+/// as long as the object version was verified in main thread not longer than maxage ms ago.
+/// Therefore clients may get data which is up to maxage ms older than the object itself.
+/// Can also be configured with rootrc HttpServ.ProduceCache and HttpServ.ProduceCacheAge.
+
+void THttpServer::SetProduceCache(Bool_t on, Long_t maxage)
+{
+   if (fSniffer)
+      fSniffer->SetProduceCache(on);
+   fCacheAge = on ? maxage : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set termination flag,
 ///
@@ -594,6 +620,9 @@ Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
    if (fTerminated)
       return kFALSE;
 
+   if (ProcessCachedRequest(arg))
+      return kTRUE;
+
    if ((fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
       // should not happen, but one could process requests directly without any signaling
 
@@ -636,6 +665,11 @@ Bool_t THttpServer::SubmitHttp(std::shared_ptr<THttpCallArg> arg, Bool_t can_run
       return kTRUE;
    }
 
+   if (ProcessCachedRequest(arg)) {
+      arg->NotifyCondition();
+      return kTRUE;
+   }
+
    // add call arg to the list
    std::unique_lock<std::mutex> lk(fMutex);
    fArgs.push(arg);
@@ -807,6 +841,42 @@ void THttpServer::ReplaceJSROOTLinks(std::shared_ptr<THttpCallArg> &arg)
       arg->ReplaceAllinContent("=\"jsrootsys/", repl);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Try to reply on root.json request with data cached by the sniffer
+///
+/// Method is thread safe, objects itself are not accessed.
+/// Used to process requests in the engine threads, see SetProduceCache()
+
+Bool_t THttpServer::ProcessCachedRequest(std::shared_ptr<THttpCallArg> &arg)
+{
+   if ((fCacheAge <= 0) || IsWSOnly() || arg->fPathName.IsNull())
+      return kFALSE;
+
+   Bool_t iszip = kFALSE;
+   if (arg->fFileName == "root.json.gz")
+      iszip = kTRUE;
+   else if (arg->fFileName != "root.json")
+      return kFALSE;
+
+   std::string content;
+   if (!fSniffer->GetCachedProduce(arg->fPathName.Data(), "root.json", arg->fQuery.Data(), arg->GetUserName(),
+                                   fCacheAge, content))
+      return kFALSE;
+
+   arg->SetContent(std::move(content));
+   arg->SetJson();
+
+   if (iszip)
+      arg->SetZipping(THttpCallArg::kZipAlways);
+
+   arg->AddNoCacheHeader();
+
+   if (IsCors())
+      arg->AddHeader("Access-Control-Allow-Origin", GetCors());
+
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Process single http request
 ///
@@ -30,6 +30,7 @@
 #include "THttpCallArg.h"
 
 #include <cstdlib>
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <cstring>
@@ -470,6 +471,9 @@ void TRootSniffer::Restrict(const char *path, const char *options)
       rslash = path;
 
    fRestrictions.Add(new TNamed(rslash, TString::Format("%s%s%s", path, "%%%", options).Data()));
+
+   // cached data were produced with the previous restrictions
+   ClearProduceCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1104,6 +1108,135 @@ ULong_t TRootSniffer::GetItemHash(const char *itemname)
    return !obj ? 0 : TString::Hash(obj, obj->IsA()->Size());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns version of the object, used to decide if previously produced data can be reused
+///
+/// Value must change whenever the object is modified, 0 means that the object should not be cached.
+/// Generic objects do not provide modification counters, therefore basic sniffer never caches them.
+/// TRootSnifferFull recognizes histograms, for other classes one could reimplement this method.
+
+ULong_t TRootSniffer::GetObjectVersion(void * /* obj */, TClass * /* cl */)
+{
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable caching of produced root.json and root.bin data
+///
+/// When enabled, data produced for an object is reused as long as its version,
+/// returned by GetObjectVersion(), does not change. Many clients polling the same
+/// unchanged histogram then cost a single serialization.
+
+void TRootSniffer::SetProduceCache(Bool_t on)
+{
+   fProduceCache = on;
+   if (!on)
+      ClearProduceCache();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all cached data, thread safe
+
+void TRootSniffer::ClearProduceCache()
+{
+   std::lock_guard<std::mutex> grd(fProduceCacheMutex);
+   fProduceCacheEntries.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build key for the cached data
+///
+/// User name is part of the key while restrictions may hide objects from some users
+
+std::string TRootSniffer::MakeProduceCacheKey(const std::string &path, const std::string &file,
+                                              const std::string &options, const char *username)
+{
+   std::string key = username ? username : "";
+   key.append("\n");
+   key.append(path, (!path.empty() && (path[0] == '/')) ? 1 : 0, std::string::npos);
+   key.append("\n");
+   key.append(file);
+   key.append("\n");
+   key.append(options);
+   return key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return cached data for the item, if it was validated in the main thread not longer than maxage milliseconds ago
+///
+/// Method is thread safe, it does not access the object itself and therefore can be used from the engine threads.
+/// Within maxage, the client may get data which does not reflect the latest object modifications.
+
+Bool_t TRootSniffer::GetCachedProduce(const std::string &path, const std::string &file, const std::string &options,
+                                      const char *username, Long_t maxage, std::string &res)
+{
+   if (!fProduceCache || (maxage <= 0))
+      return kFALSE;
+
+   auto key = MakeProduceCacheKey(path, file, options, username);
+
+   std::lock_guard<std::mutex> grd(fProduceCacheMutex);
+   auto iter = fProduceCacheEntries.find(key);
+   if (iter == fProduceCacheEntries.end())
+      return kFALSE;
+
+   if (std::chrono::steady_clock::now() - iter->second.fValidated > std::chrono::milliseconds(maxage))
+      return kFALSE;
+
+   res = iter->second.fContent;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Produce root.json or root.bin data, reusing cached data when object version did not change
+
+Bool_t TRootSniffer::ProduceCached(const std::string &path, const std::string &file, const std::string &options,
+                                   std::string &res)
+{
+   const char *path_ = path.c_str();
+   if (*path_ == '/')
+      path_++;
+
+   TClass *obj_cl = nullptr;
+   TDataMember *member = nullptr;
+   void *obj_ptr = FindInHierarchy(path_, &obj_cl, &member);
+   ULong_t version = (obj_ptr && obj_cl && !member) ? GetObjectVersion(obj_ptr, obj_cl) : 0;
+
+   if (version == 0)
+      return (file == "root.bin") ? ProduceBinary(path, options, res) : ProduceJson(path, options, res);
+
+   auto key = MakeProduceCacheKey(path, file, options, fCurrentArg ? fCurrentArg->GetUserName() : nullptr);
+
+   {
+      std::lock_guard<std::mutex> grd(fProduceCacheMutex);
+      auto iter = fProduceCacheEntries.find(key);
+      if ((iter != fProduceCacheEntries.end()) && (iter->second.fObj == obj_ptr) &&
+          (iter->second.fVersion == version)) {
+         iter->second.fValidated = std::chrono::steady_clock::now();
+         res = iter->second.fContent;
+         return kTRUE;
+      }
+   }
+
+   Bool_t ok = (file == "root.bin") ? ProduceBinary(path, options, res) : ProduceJson(path, options, res);
+
+   std::lock_guard<std::mutex> grd(fProduceCacheMutex);
+   if (ok) {
+      // options are part of the key, protect against clients producing unbounded number of variants
+      if (fProduceCacheEntries.size() >= 10000)
+         fProduceCacheEntries.clear();
+      auto &entry = fProduceCacheEntries[key];
+      entry.fObj = obj_ptr;
+      entry.fVersion = version;
+      entry.fContent = res;
+      entry.fValidated = std::chrono::steady_clock::now();
+   } else {
+      fProduceCacheEntries.erase(key);
+   }
+
+   return ok;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Method verifies if object can be drawn
 
@@ -1499,6 +1632,9 @@ Bool_t TRootSniffer::Produce(const std::string &path, const std::string &file, c
    if (file.empty())
       return kFALSE;
 
+   if (fProduceCache && !path.empty() && ((file == "root.bin") || (file == "root.json")))
+      return ProduceCached(path, file, options, res);
+
    if (file == "root.bin")
       return ProduceBinary(path, options, res);
 
@@ -1662,6 +1798,9 @@ Bool_t TRootSniffer::UnregisterObject(TObject *obj)
    // TODO - probably we should remove all set properties as well
    topf->RecursiveRemove(obj);
 
+   // new object may be allocated at the same address
+   ClearProduceCache();
+
    return kTRUE;
 }
 
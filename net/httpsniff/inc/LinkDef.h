@@ -5,5 +5,6 @@
 #pragma link off all functions;
 
 #pragma link C++ class TRootSnifferFull;
+#pragma link C++ class THistDeltaHandler;
 
 #endif
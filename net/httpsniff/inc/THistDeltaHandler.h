@@ -0,0 +1,57 @@
+// $Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_THistDeltaHandler
+#define ROOT_THistDeltaHandler
+
+#include "THttpWSHandler.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class TH1;
+class THttpServer;
+
+class THistDeltaHandler : public THttpWSHandler {
+protected:
+   /** Server-side state of one histogram, shared by all clients */
+   struct HistState {
+      TH1 *fHist{nullptr};              ///<! histogram seen during last update, only compared
+      ULong_t fObjHash{0};              ///<! hash of histogram object, changes with any filling
+      ULong_t fLayout{0};               ///<! hash of class and binning, change requires full update
+      UInt_t fVersion{0};               ///<! current version
+      UInt_t fFullVersion{0};           ///<! version of last layout change
+      Double_t fEntries{0};             ///<! number of entries at fVersion
+      std::vector<Double_t> fStats;     ///<! statistics at fVersion
+      std::vector<Double_t> fContent;   ///<! bins content at fVersion
+      std::vector<Double_t> fSumw2;     ///<! bins sum of weights squared at fVersion, empty if not stored
+      std::vector<UInt_t> fBinVersion;  ///<! version when bin was last changed
+   };
+
+   THttpServer *fServer{nullptr};              ///<! server, used to locate histograms with its sniffer
+   std::map<std::string, HistState> fStates;   ///<! state for every requested item
+
+   void UpdateState(HistState &state, TH1 *hist);
+
+   void SendFull(UInt_t wsid, const std::string &item, HistState &state);
+
+   void SendDelta(UInt_t wsid, const std::string &item, HistState &state, UInt_t since);
+
+public:
+   THistDeltaHandler(THttpServer *serv, const char *name = "hdelta", const char *title = "histogram updates");
+   virtual ~THistDeltaHandler() = default;
+
+   Bool_t ProcessWS(THttpCallArg *arg) override;
+
+   ClassDefOverride(THistDeltaHandler, 0) // incremental binary histogram updates over websocket
+};
+
+#endif
@@ -34,6 +34,8 @@ protected:
 
    Bool_t HasStreamerInfo() const override { return kTRUE; }
 
+   ULong_t GetObjectVersion(void *obj, TClass *cl) override;
+
    Bool_t ProduceBinary(const std::string &path, const std::string &options, std::string &res) override;
 
    Bool_t ProduceImage(Int_t kind, const std::string &path, const std::string &options, std::string &res) override;
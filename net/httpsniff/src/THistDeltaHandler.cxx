@@ -0,0 +1,281 @@
+// $Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "THistDeltaHandler.h"
+
+#include "TH1.h"
+#include "TAxis.h"
+#include "TClass.h"
+#include "TBufferJSON.h"
+#include "THttpServer.h"
+#include "THttpCallArg.h"
+#include "TRootSniffer.h"
+
+#include <cstdlib>
+#include <cstring>
+
+/** \class THistDeltaHandler
+\ingroup http
+
+Websocket handler, which delivers incremental updates of histograms
+
+Instead of fetching complete JSON representation of histogram on every refresh,
+client requests changes since the version it already has. Server keeps for every
+requested histogram one copy of the bins content and the version where each bin
+was changed last time, therefore only bins modified since client version are sent.
+Server does not keep any per-client state.
+
+Usage:
+
+    auto serv = new THttpServer("http:8080");
+    serv->Register("/", new THistDeltaHandler(serv));
+
+Client connects to `ws://host:8080/hdelta/root.websocket` (or uses long polling
+emulation `root.longpoll`) and sends text requests:
+
+    GET:<version>:<item>
+
+where `<item>` is path of histogram in the server hierarchy, like "Files/job1.root/hpx",
+and `<version>` is the last version received by the client, 0 for the first request.
+Server replies with one message:
+
+* `FULL:<version>:<item>:<json>` - text message with complete JSON representation of histogram,
+  produced by TBufferJSON with compact=23 and therefore readable with JSROOT's `parse()` function.
+  Sent on the first request, when histogram binning was changed or for profiles,
+* binary message with changed bins since client version, when histogram was not changed,
+  number of changed bins is 0,
+* `ERR:<item>` when histogram not found.
+
+Binary message layout (native byte order, little endian on all supported platforms;
+all double fields are 8 bytes aligned and can be accessed via Float64Array):
+
+| offset   | type              | content                                     |
+|----------|-------------------|---------------------------------------------|
+| 0        | char[4]           | "HDLT"                                      |
+| 4        | uint32            | version                                     |
+| 8        | uint32            | number of changed bins N                    |
+| 12       | uint32            | flags, bit 0 - sumw2 values are present     |
+| 16       | uint32            | number of statistics values S (TH1::kNstat) |
+| 20       | uint32            | length of item name L                       |
+| 24       | char[L]           | item name, zero padded to multiple of 8     |
+|          | double            | number of entries (fEntries)                |
+|          | double[S]         | statistics, as provided by TH1::GetStats()  |
+|          | double[N]         | new content of changed bins (fArray)        |
+|          | double[N]         | new sumw2 of changed bins (fSumw2), if flag |
+|          | uint32[N]         | global bin numbers of changed bins          |
+
+Handler works in synchronous mode, histograms are accessed only in the main thread.
+See tutorials/http/histdelta.C for example of JSROOT-based client.
+*/
+
+ClassImp(THistDeltaHandler);
+
+namespace {
+
+const char kDeltaMagic[4] = {'H', 'D', 'L', 'T'};
+
+/// Append raw value to the buffer
+template <typename T>
+void AppendValue(std::string &buf, const T &value)
+{
+   buf.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/// Hash of class and binning of histogram
+ULong_t GetLayoutHash(TH1 *hist)
+{
+   std::vector<Double_t> layout;
+   layout.emplace_back(hist->GetNcells());
+   layout.emplace_back(hist->GetSumw2N());
+   for (auto axis : {hist->GetXaxis(), hist->GetYaxis(), hist->GetZaxis()}) {
+      layout.emplace_back(axis->GetNbins());
+      layout.emplace_back(axis->GetXmin());
+      layout.emplace_back(axis->GetXmax());
+      auto bins = axis->GetXbins();
+      for (Int_t n = 0; n < bins->GetSize(); ++n)
+         layout.emplace_back(bins->GetAt(n));
+   }
+   return TString::Hash(layout.data(), layout.size() * sizeof(Double_t)) ^ (ULong_t)hist->IsA();
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor
+///
+/// Histograms are located in the hierarchy of server sniffer, access restrictions of the sniffer apply
+
+THistDeltaHandler::THistDeltaHandler(THttpServer *serv, const char *name, const char *title)
+   : THttpWSHandler(name, title, kTRUE), fServer(serv)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compare histogram with the stored state and increment version if anything changed
+///
+/// When histogram object or its binning changed, fFullVersion is set to the new version
+
+void THistDeltaHandler::UpdateState(HistState &state, TH1 *hist)
+{
+   // any filling changes entries and statistics kept in the histogram object itself
+   ULong_t objhash = TString::Hash(hist, hist->IsA()->Size()) * 31 + hist->GetBufferLength();
+   if ((state.fHist == hist) && (state.fObjHash == objhash) && (state.fVersion > 0))
+      return;
+
+   ULong_t layout = GetLayoutHash(hist);
+   Int_t ncells = hist->GetNcells();
+   Bool_t full = (state.fHist != hist) || (state.fLayout != layout) || (state.fVersion == 0);
+
+   state.fHist = hist;
+   state.fObjHash = objhash;
+   state.fLayout = layout;
+
+   UInt_t version = state.fVersion + 1;
+
+   std::vector<Double_t> stats(TH1::kNstat, 0.);
+   hist->GetStats(stats.data());
+   Double_t entries = hist->GetEntries();
+
+   const TArrayD *sumw2 = hist->GetSumw2N() == ncells ? hist->GetSumw2() : nullptr;
+
+   if (full) {
+      state.fContent.resize(ncells);
+      state.fSumw2.resize(sumw2 ? ncells : 0);
+      for (Int_t bin = 0; bin < ncells; ++bin) {
+         state.fContent[bin] = hist->GetBinContent(bin);
+         if (sumw2)
+            state.fSumw2[bin] = sumw2->fArray[bin];
+      }
+      state.fBinVersion.assign(ncells, version);
+      state.fFullVersion = version;
+   } else {
+      Bool_t changed = (entries != state.fEntries) || (stats != state.fStats);
+      for (Int_t bin = 0; bin < ncells; ++bin) {
+         Double_t content = hist->GetBinContent(bin);
+         Double_t w2 = sumw2 ? sumw2->fArray[bin] : 0.;
+         if ((content != state.fContent[bin]) || (sumw2 && (w2 != state.fSumw2[bin]))) {
+            state.fContent[bin] = content;
+            if (sumw2)
+               state.fSumw2[bin] = w2;
+            state.fBinVersion[bin] = version;
+            changed = kTRUE;
+         }
+      }
+      if (!changed)
+         return;
+   }
+
+   state.fVersion = version;
+   state.fEntries = entries;
+   std::swap(state.fStats, stats);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Send complete JSON representation of histogram
+
+void THistDeltaHandler::SendFull(UInt_t wsid, const std::string &item, HistState &state)
+{
+   TString json = TBufferJSON::ConvertToJSON(state.fHist, TBufferJSON::kNoSpaces + TBufferJSON::kSameSuppression);
+   std::string msg = "FULL:" + std::to_string(state.fVersion) + ":" + item + ":";
+   msg.append(json.Data(), json.Length());
+   SendCharStarWS(wsid, msg.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Send binary message with bins changed after version since
+
+void THistDeltaHandler::SendDelta(UInt_t wsid, const std::string &item, HistState &state, UInt_t since)
+{
+   std::vector<UInt_t> bins;
+   for (UInt_t bin = 0; bin < state.fBinVersion.size(); ++bin)
+      if (state.fBinVersion[bin] > since)
+         bins.emplace_back(bin);
+
+   Bool_t with_sumw2 = !state.fSumw2.empty();
+   UInt_t len = item.length();
+
+   std::string buf;
+   buf.reserve(32 + len + (state.fStats.size() + 1) * 8 + bins.size() * (with_sumw2 ? 20 : 12));
+   buf.append(kDeltaMagic, 4);
+   AppendValue<UInt_t>(buf, state.fVersion);
+   AppendValue<UInt_t>(buf, bins.size());
+   AppendValue<UInt_t>(buf, with_sumw2 ? 1 : 0);
+   AppendValue<UInt_t>(buf, state.fStats.size());
+   AppendValue<UInt_t>(buf, len);
+   buf.append(item);
+   buf.append((8 - buf.length() % 8) % 8, '\0');
+   AppendValue<Double_t>(buf, state.fEntries);
+   for (auto value : state.fStats)
+      AppendValue<Double_t>(buf, value);
+   for (auto bin : bins)
+      AppendValue<Double_t>(buf, state.fContent[bin]);
+   if (with_sumw2)
+      for (auto bin : bins)
+         AppendValue<Double_t>(buf, state.fSumw2[bin]);
+   for (auto bin : bins)
+      AppendValue<UInt_t>(buf, bin);
+
+   SendWS(wsid, buf.data(), buf.length());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Process websocket requests, see class description for the protocol
+
+Bool_t THistDeltaHandler::ProcessWS(THttpCallArg *arg)
+{
+   if (!arg || (arg->GetWSId() == 0))
+      return kTRUE;
+
+   if (arg->IsMethod("WS_CONNECT") || arg->IsMethod("WS_READY"))
+      return kTRUE;
+
+   if (arg->IsMethod("WS_CLOSE"))
+      return kTRUE;
+
+   if (!arg->IsMethod("WS_DATA"))
+      return kFALSE;
+
+   std::string msg((const char *)arg->GetPostData(), arg->GetPostDataLength());
+   if (msg.compare(0, 4, "GET:") != 0)
+      return kFALSE;
+
+   auto separ = msg.find(':', 4);
+   if (separ == std::string::npos)
+      return kFALSE;
+
+   UInt_t since = std::strtoul(msg.c_str() + 4, nullptr, 10);
+   std::string item = msg.substr(separ + 1);
+
+   // sniffer uses credentials of current request, set by the server
+   TH1 *hist = nullptr;
+   if (fServer && fServer->GetSniffer() && !item.empty())
+      hist = dynamic_cast<TH1 *>(fServer->GetSniffer()->FindTObjectInHierarchy(item.c_str()));
+
+   if (!hist) {
+      fStates.erase(item);
+      SendCharStarWS(arg->GetWSId(), ("ERR:" + item).c_str());
+      return kTRUE;
+   }
+
+   auto &state = fStates[item];
+
+   UpdateState(state, hist);
+
+   // profiles store sums, not bin content, in the arrays; JSROOT client has to get full object
+   Bool_t is_profile = hist->InheritsFrom("TProfile") || hist->InheritsFrom("TProfile2D") ||
+                       hist->InheritsFrom("TProfile3D");
+
+   if (is_profile || (since < state.fFullVersion) || (since > state.fVersion))
+      SendFull(arg->GetWSId(), item, state);
+   else
+      SendDelta(arg->GetWSId(), item, state, since);
+
+   return kTRUE;
+}
@@ -194,6 +194,25 @@ ULong_t TRootSnifferFull::GetItemHash(const char *itemname)
    return TRootSniffer::GetItemHash(itemname);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns version of the object, used to reuse produced data
+///
+/// Histograms do not have a modification counter, but any filling changes the
+/// number of entries and the statistics sums kept in the histogram object itself.
+/// Therefore hash of the histogram object (without bins content) is used.
+
+ULong_t TRootSnifferFull::GetObjectVersion(void *obj, TClass *cl)
+{
+   if (obj == fSinfo)
+      return GetStreamerInfoHash();
+
+   if (!cl->InheritsFrom(TH1::Class()) || (cl->GetBaseClassOffset(TH1::Class()) != 0))
+      return TRootSniffer::GetObjectVersion(obj, cl);
+
+   // in buffer mode, filling only changes the number of buffered entries
+   return TString::Hash(obj, cl->Size()) * 31 + static_cast<TH1 *>(obj)->GetBufferLength();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Creates TMemFile instance, which used for objects streaming
 ///
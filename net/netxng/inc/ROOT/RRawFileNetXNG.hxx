@@ -25,6 +25,10 @@ struct RRawFileNetXNGImpl;
 The RRawFileNetXNG class provides read-only access to remote files using root/roots protocol. It uses the
 XrdCl (XRootD client) library for the transport layer.  It instructs the RRawFile base class to buffer in
 larger chunks than the default for local files, assuming that remote file access has high(er) latency.
+Vector reads are split in XRootD requests within the server limits (1024 chunks of at most 2 MB), which are
+issued concurrently, at most NetXNG.ReadvParallel of them (8 by default, 0 for no limit) in flight at any time.
+ReadVAsync() returns a future fulfilled by the response handler of the last request. If the local block cache is
+configured (see RBlockCache), reads go through it and ReadVAsync() reads when the future is waited for.
 
 */
 
@@ -37,6 +41,7 @@ protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) final;
    std::uint64_t GetSizeImpl() final;
 
 public:
@@ -23,6 +23,7 @@
 
 #include "TFile.h"
 #include "TSemaphore.h"
+#include <ROOT/RRawFile.hxx>
 #ifndef __CLING__
 #include <XrdCl/XrdClFileSystem.hh>
 #endif
@@ -33,6 +34,12 @@ namespace XrdCl {
 }
 class XrdSysCondVar;
 
+namespace ROOT {
+namespace Internal {
+class RBlockCache;
+}
+}
+
 #ifdef __CLING__
 namespace XrdCl {
    struct OpenFlags {
@@ -50,13 +57,18 @@ private:
    // if requested
    Int_t                   fReadvIorMax; // Max size of a single readv chunk
    Int_t                   fReadvIovMax; // Max number of readv chunks
+   Int_t                   fReadvParallel; // Max number of readv requests in flight (0: no limit)
    Int_t                   fQueryReadVParams;
    TString                 fNewUrl;
+   ROOT::Internal::RBlockCache *fBlockCache; //! Local block cache, if used for this file
+   std::string             fBlockCacheKey;   //! Key of this file in fBlockCache
+   Long64_t                fBlockCacheFileSize; //! Size of this file when it was opened
 
 public:
    TNetXNGFile() : TFile(),
       fFile(nullptr), fUrl(nullptr), fMode(XrdCl::OpenFlags::None), fInitCondVar(nullptr),
-      fReadvIorMax(0), fReadvIovMax(0) {}
+      fReadvIorMax(0), fReadvIovMax(0), fReadvParallel(0),
+      fBlockCache(nullptr), fBlockCacheFileSize(0) {}
    TNetXNGFile(const char *url, const char *lurl, Option_t *mode, const char *title,
                Int_t compress, Int_t netopt, Bool_t parallelopen);
    TNetXNGFile(const char *url, Option_t *mode = "", const char *title = "",
@@ -82,6 +94,8 @@ public:
 private:
    virtual Bool_t IsUseable() const;
    virtual Bool_t GetVectorReadLimits();
+   void           InitBlockCache();
+   Bool_t         ReadViaBlockCache(ROOT::Internal::RRawFile::RIOVec *ioVec, Int_t nReq);
    virtual void   SetEnv();
    Int_t ParseOpenMode(Option_t *in, TString &modestr,
                        XrdCl::OpenFlags::Flags &mode, Bool_t assumeRead);
@@ -10,11 +10,17 @@
  *************************************************************************/
 
 #include "ROOT/RRawFileNetXNG.hxx"
+#include "ROOT/RBlockCache.hxx"
 
+#include <TEnv.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include <XrdCl/XrdClFile.hh>
 #include <XrdCl/XrdClFileSystem.hh>
@@ -22,6 +28,9 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k blocks for better network utilization
+// Vector read limits of the XRootD server, see also TNetXNGFile::GetVectorReadLimits()
+constexpr std::size_t kReadvIorMax = 2097136; // Max size of a single chunk
+constexpr std::size_t kReadvIovMax = 1024;    // Max number of chunks in a single request
 } // anonymous namespace
 
 namespace ROOT {
@@ -34,8 +43,146 @@ struct RRawFileNetXNGImpl {
    ~RRawFileNetXNGImpl() = default;
 
    XrdCl::File file;
+   int readvParallel = 8; ///< Max number of vector read requests in flight (0: no limit)
+   RBlockCache *blockCache = nullptr; ///< Set if the reads go through the local block cache
+   std::string blockCacheKey;
+   std::uint64_t fileSize = 0;
 };
 
+/// A vector read split in XRootD requests within the server limits, at most fMaxInFlight of them in flight at any
+/// time. Each response issues the next request; the last one fulfills the promise. Kept alive by the handlers.
+class RVectorReadBatch : public std::enable_shared_from_this<RVectorReadBatch> {
+   XrdCl::File &fFile;
+   std::string fUrl;
+   RRawFile::RIOVec *fIoVec;
+   std::vector<XrdCl::ChunkList> fChunkLists;
+   std::vector<std::vector<unsigned int>> fReqIndexes; ///< For every chunk of fChunkLists, its index in fIoVec
+   std::size_t fMaxInFlight;
+
+   std::mutex fLock; ///< Protects the members below and the output sizes of fIoVec
+   std::size_t fNextList = 0;
+   std::size_t fNInFlight = 0;
+   std::string fError;
+   bool fDone = false;
+   std::promise<void> fPromise;
+
+   /// Fulfill the promise once everything is done; must be called with fLock locked.
+   void CheckDone()
+   {
+      if (fDone || fNInFlight > 0 || (fError.empty() && fNextList < fChunkLists.size()))
+         return;
+      fDone = true;
+      if (fError.empty())
+         fPromise.set_value();
+      else
+         fPromise.set_exception(std::make_exception_ptr(std::runtime_error(fError)));
+   }
+
+   void Fail(const XrdCl::XRootDStatus &status)
+   {
+      if (fError.empty())
+         fError = "Cannot do vector read from '" + fUrl + "', " + status.ToString() + "; " + status.GetErrorMessage();
+   }
+
+   void Submit();
+
+public:
+   RVectorReadBatch(XrdCl::File &file, const std::string &url, RRawFile::RIOVec *ioVec, unsigned int nReq,
+                    std::size_t maxInFlight)
+      : fFile(file), fUrl(url), fIoVec(ioVec), fMaxInFlight(maxInFlight > 0 ? maxInFlight : std::size_t(-1))
+   {
+      for (unsigned int i = 0; i < nReq; ++i) {
+         ioVec[i].fOutBytes = 0;
+         std::size_t pos = 0;
+         // Requests larger than the maximum chunk size are read in several chunks
+         do {
+            if (fChunkLists.empty() || fChunkLists.back().size() == kReadvIovMax) {
+               fChunkLists.emplace_back();
+               fReqIndexes.emplace_back();
+            }
+            const std::size_t size = std::min(ioVec[i].fSize - pos, kReadvIorMax);
+            fChunkLists.back().emplace_back(ioVec[i].fOffset + pos, size, static_cast<char *>(ioVec[i].fBuffer) + pos);
+            fReqIndexes.back().emplace_back(i);
+            pos += size;
+         } while (pos < ioVec[i].fSize);
+      }
+   }
+
+   std::future<void> Start()
+   {
+      auto result = fPromise.get_future();
+      Submit();
+      std::lock_guard<std::mutex> guard(fLock);
+      CheckDone();
+      return result;
+   }
+
+   void HandleResponse(std::size_t idxList, XrdCl::XRootDStatus *status, XrdCl::AnyObject *response)
+   {
+      XrdCl::VectorReadInfo *info = nullptr;
+      if (status->IsOK() && response)
+         response->Get(info);
+      {
+         std::lock_guard<std::mutex> guard(fLock);
+         --fNInFlight;
+         if (!info) {
+            Fail(*status);
+         } else {
+            XrdCl::ChunkList &rsp = info->GetChunks();
+            for (std::size_t i = 0; i < rsp.size(); ++i)
+               fIoVec[fReqIndexes[idxList][i]].fOutBytes += rsp[i].length;
+         }
+      }
+      Submit();
+      std::lock_guard<std::mutex> guard(fLock);
+      CheckDone();
+   }
+};
+
+/// Forwards the response of one XRootD vector read to its batch; deletes itself once called by XrdCl.
+class RVectorReadHandler : public XrdCl::ResponseHandler {
+   std::shared_ptr<RVectorReadBatch> fBatch;
+   std::size_t fIdxList;
+
+public:
+   RVectorReadHandler(std::shared_ptr<RVectorReadBatch> batch, std::size_t idxList)
+      : fBatch(std::move(batch)), fIdxList(idxList)
+   {
+   }
+
+   void HandleResponse(XrdCl::XRootDStatus *status, XrdCl::AnyObject *response) override
+   {
+      std::unique_ptr<XrdCl::XRootDStatus> statusGuard(status);
+      std::unique_ptr<XrdCl::AnyObject> responseGuard(response);
+      fBatch->HandleResponse(fIdxList, status, response);
+      delete this;
+   }
+};
+
+/// Issue requests until fMaxInFlight are in flight. XrdCl is not called with fLock locked because the response
+/// handler may run before VectorRead() returns.
+void RVectorReadBatch::Submit()
+{
+   while (true) {
+      std::size_t idxList;
+      {
+         std::lock_guard<std::mutex> guard(fLock);
+         if (!fError.empty() || fNextList == fChunkLists.size() || fNInFlight >= fMaxInFlight)
+            return;
+         idxList = fNextList++;
+         ++fNInFlight;
+      }
+      auto handler = new RVectorReadHandler(shared_from_this(), idxList);
+      auto st = fFile.VectorRead(fChunkLists[idxList], nullptr, handler);
+      if (!st.IsOK()) {
+         delete handler; // not called by XrdCl if the request could not be issued
+         std::lock_guard<std::mutex> guard(fLock);
+         --fNInFlight;
+         Fail(st);
+      }
+   }
+}
+
 } // namespace Internal
 } // namespace ROOT
 
@@ -74,10 +221,30 @@ void ROOT::Internal::RRawFileNetXNG::OpenImpl()
      throw std::runtime_error( "Cannot open '" + fUrl + "', " +
                                st.ToString() + "; " + st.GetErrorMessage() );
    if( fOptions.fBlockSize < 0 ) fOptions.fBlockSize = kDefaultBlockSize;
+   pImpl->readvParallel = gEnv->GetValue( "NetXNG.ReadvParallel", pImpl->readvParallel );
+
+   if( auto blockCache = RBlockCache::Get() ) {
+     XrdCl::StatInfo *info = nullptr;
+     if( pImpl->file.Stat( false, info ).IsOK() ) {
+       pImpl->blockCache = blockCache;
+       pImpl->fileSize = info->GetSize();
+       pImpl->blockCacheKey = RBlockCache::MakeFileKey( fUrl, info->GetSize(), info->GetModTime() );
+       delete info;
+     }
+   }
 }
 
 size_t ROOT::Internal::RRawFileNetXNG::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
+   if( pImpl->blockCache ) {
+     RIOVec ioVec;
+     ioVec.fBuffer = buffer;
+     ioVec.fOffset = offset;
+     ioVec.fSize = nbytes;
+     ReadVImpl( &ioVec, 1 );
+     return ioVec.fOutBytes;
+   }
+
    std::uint32_t btsread = 0;
    auto st = pImpl->file.Read( offset, nbytes, buffer, btsread );
    if( !st.IsOK() )
@@ -88,20 +255,23 @@ size_t ROOT::Internal::RRawFileNetXNG::ReadAtImpl(void *buffer, size_t nbytes, s
 
 void ROOT::Internal::RRawFileNetXNG::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
-   XrdCl::ChunkList chunks;
-   chunks.reserve( nReq );
-   for( std::size_t i = 0; i < nReq; ++i )
-     chunks.emplace_back( ioVec[i].fOffset, ioVec[i].fSize, ioVec[i].fBuffer );
+   if( pImpl->blockCache ) {
+     pImpl->blockCache->ReadV( pImpl->blockCacheKey, pImpl->fileSize, ioVec, nReq,
+                               [this]( RIOVec *missing, unsigned int nMissing ) {
+                                 std::make_shared<RVectorReadBatch>( pImpl->file, fUrl, missing, nMissing,
+                                                                     pImpl->readvParallel )->Start().get();
+                               } );
+     return;
+   }
+   ReadVAsyncImpl(ioVec, nReq).get();
+}
 
-   XrdCl::VectorReadInfo *info = nullptr;
-   auto st = pImpl->file.VectorRead( chunks, nullptr, info );
-   if( !st.IsOK() )
-     throw std::runtime_error( "Cannot do vector read from '" + fUrl + "', " +
-                               st.ToString() + "; " + st.GetErrorMessage() );
+std::future<void> ROOT::Internal::RRawFileNetXNG::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   // Cache lookups and stores are synchronous: the read happens when the future is waited for
+   if( pImpl->blockCache )
+     return std::async( std::launch::deferred, [this, ioVec, nReq] { ReadVImpl( ioVec, nReq ); } );
 
-   XrdCl::ChunkList &rsp = info->GetChunks();
-   for( std::size_t i = 0; i < nReq; ++i )
-     ioVec[i].fOutBytes = rsp[i].length;
-   delete info;
+   auto batch = std::make_shared<RVectorReadBatch>(pImpl->file, fUrl, ioVec, nReq, pImpl->readvParallel);
+   return batch->Start();
 }
-
@@ -20,6 +20,7 @@
 
 #include "TArchiveFile.h"
 #include "TNetXNGFile.h"
+#include "ROOT/RBlockCache.hxx"
 #include "TEnv.h"
 #include "TSystem.h"
 #include "TTimeStamp.h"
@@ -30,7 +31,9 @@
 #include <XrdCl/XrdClXRootDResponses.hh>
 #include <XrdCl/XrdClDefaultEnv.hh>
 #include <XrdVersion.hh>
+#include <algorithm>
 #include <iostream>
+#include <stdexcept>
 
 //------------------------------------------------------------------------------
 // Open handler for async open requests
@@ -111,6 +114,76 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
 };
 
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append the read of a buffer to the chunk lists of vector reads, splitting it
+/// according to the server limits
+
+void AddChunk(std::vector<XrdCl::ChunkList> &chunkLists, Long64_t offset, Int_t length,
+              char *buffer, Int_t readvIorMax, Int_t readvIovMax)
+{
+   do {
+      if (chunkLists.empty() || (Int_t) chunkLists.back().size() >= readvIovMax)
+         chunkLists.emplace_back();
+      Int_t size = std::min(length, readvIorMax);
+      chunkLists.back().push_back(XrdCl::ChunkInfo(offset, size, buffer));
+      offset += size;
+      buffer += size;
+      length -= size;
+   } while (length > 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Issue the vector reads, with at most readvParallel of them in flight (all
+/// of them if not positive), and wait for all responses
+///
+/// returns: kTRUE in case of failure
+
+Bool_t ReadChunkLists(XrdCl::File *file, std::vector<XrdCl::ChunkList> &chunkLists,
+                      Int_t readvParallel)
+{
+   using namespace XrdCl;
+
+   const Int_t nLists      = chunkLists.size();
+   const Int_t maxInFlight = (readvParallel > 0) ? readvParallel : nLists;
+   std::vector<XRootDStatus*> statuses(nLists, nullptr);
+   TSemaphore semaphore(0);
+   Int_t  nSubmitted = 0;
+   Int_t  nDone      = 0;
+   Bool_t failed     = kFALSE;
+   while (nDone < nSubmitted || (nSubmitted < nLists && !failed)) {
+      if (!failed && nSubmitted < nLists && nSubmitted - nDone < maxInFlight) {
+         auto handler = new TAsyncReadvHandler(&statuses, nSubmitted, &semaphore);
+         XRootDStatus status = file->VectorRead(chunkLists[nSubmitted], 0, handler);
+         if (!status.IsOK()) {
+            // The handler is not called if the request could not be issued;
+            // still wait for the requests in flight, which use the semaphore
+            delete handler;
+            ::Error("TNetXNGFile::ReadBuffers", "%s", status.ToStr().c_str());
+            failed = kTRUE;
+         } else {
+            ++nSubmitted;
+         }
+         continue;
+      }
+      semaphore.Wait();
+      ++nDone;
+   }
+
+   // Check for errors
+   for (Int_t i = 0; i < nSubmitted; ++i) {
+      if (!failed && !statuses[i]->IsOK()) {
+         ::Error("TNetXNGFile::ReadBuffers", "%s", statuses[i]->ToStr().c_str());
+         failed = kTRUE;
+      }
+      delete statuses[i];
+   }
+   return failed;
+}
+
+} // anonymous namespace
+
 ClassImp(TNetXNGFile);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -159,6 +232,9 @@ TNetXNGFile::TNetXNGFile(const char *url, const char *lurl, Option_t *mode, cons
    fQueryReadVParams = 1;
    fReadvIorMax = 2097136;
    fReadvIovMax = 1024;
+   fReadvParallel = 8;
+   fBlockCache = nullptr;
+   fBlockCacheFileSize = 0;
 
    if (ParseOpenMode(mode, fOption, fMode, kTRUE)<0) {
       Error("Open", "could not parse open mode %s", mode);
@@ -214,6 +290,7 @@ TNetXNGFile::TNetXNGFile(const char *url, const char *lurl, Option_t *mode, cons
    bool create = false;
    if( (fMode & OpenFlags::New) || (fMode & OpenFlags::Delete) )
       create = true;
+   InitBlockCache();
    TFile::Init(create);
 
    // Get the vector read limits
@@ -255,6 +332,8 @@ void TNetXNGFile::Init(Bool_t create)
                                               kFALSE);
 
    // Initialize the file
+   if (IsOpen())
+      InitBlockCache();
    TFile::Init(create);
 
    // Notify the monitoring system
@@ -421,13 +500,23 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
 
    // Read the data
    uint32_t bytesRead = 0;
-   XRootDStatus st = fFile->Read(fOffset, length, buffer, bytesRead);
-   if (gDebug > 0)
-      Info("ReadBuffer", "%s bytes read: %u", st.ToStr().c_str(), bytesRead);
-
-   if (!st.IsOK()) {
-      Error("ReadBuffer", "%s", st.ToStr().c_str());
-      return kTRUE;
+   if (fBlockCache) {
+      ROOT::Internal::RRawFile::RIOVec ioVec;
+      ioVec.fBuffer = buffer;
+      ioVec.fOffset = fOffset;
+      ioVec.fSize   = length;
+      if (ReadViaBlockCache(&ioVec, 1))
+         return kTRUE;
+      bytesRead = ioVec.fOutBytes;
+   } else {
+      XRootDStatus st = fFile->Read(fOffset, length, buffer, bytesRead);
+      if (gDebug > 0)
+         Info("ReadBuffer", "%s bytes read: %u", st.ToStr().c_str(), bytesRead);
+
+      if (!st.IsOK()) {
+         Error("ReadBuffer", "%s", st.ToStr().c_str());
+         return kTRUE;
+      }
    }
 
    if ((Int_t)bytesRead != length) {
@@ -473,103 +562,44 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    if (!IsUseable())
       return kTRUE;
 
-   std::vector<ChunkList>      chunkLists;
-   ChunkList                   chunks;
-   std::vector<XRootDStatus*> *statuses;
-   TSemaphore                 *semaphore;
-   Int_t                       totalBytes = 0;
-   Long64_t                    offset     = 0;
-   char                       *cursor     = buffer;
-
-   Double_t start = 0;
+   Int_t    totalBytes = 0;
+   Double_t start      = 0;
    if (gPerfStats) start = TTimeStamp();
 
    if (fArchiveOffset)
       for (Int_t i = 0; i < nbuffs; i++)
          position[i] += fArchiveOffset;
 
-   // Build a list of chunks. Put the buffers in the ChunkInfo's
-   for (Int_t i = 0; i < nbuffs; ++i) {
-      totalBytes += length[i];
-
-      // If the length is bigger than max readv size, split into smaller chunks
-      if (length[i] > fReadvIorMax) {
-         Int_t nsplit = length[i] / fReadvIorMax;
-         Int_t rem    = length[i] % fReadvIorMax;
-         Int_t j;
-
-         // Add as many max-size chunks as are divisible
-         for (j = 0; j < nsplit; ++j) {
-            offset = position[i] + (j * fReadvIorMax);
-            chunks.push_back(ChunkInfo(offset, fReadvIorMax, cursor));
-            cursor += fReadvIorMax;
-         }
-
-         // Add the remainder
-         offset = position[i] + (j * fReadvIorMax);
-         chunks.push_back(ChunkInfo(offset, rem, cursor));
-         cursor += rem;
-      } else {
-         chunks.push_back(ChunkInfo(position[i], length[i], cursor));
-         cursor += length[i];
+   if (fBlockCache) {
+      std::vector<ROOT::Internal::RRawFile::RIOVec> ioVec(nbuffs);
+      char *cursor = buffer;
+      for (Int_t i = 0; i < nbuffs; ++i) {
+         ioVec[i].fBuffer = cursor;
+         ioVec[i].fOffset = position[i];
+         ioVec[i].fSize   = length[i];
+         cursor     += length[i];
+         totalBytes += length[i];
       }
-
-      // If there are more than or equal to max chunks, make another chunk list
-      if ((Int_t) chunks.size() == fReadvIovMax) {
-         chunkLists.push_back(chunks);
-         chunks = ChunkList();
-      } else if ((Int_t) chunks.size() > fReadvIovMax) {
-         chunkLists.push_back(ChunkList(chunks.begin(),
-                                        chunks.begin() + fReadvIovMax));
-         chunks = ChunkList(chunks.begin() + fReadvIovMax, chunks.end());
-      }
-   }
-
-   // Push back the last chunk list
-   if( !chunks.empty() )
-      chunkLists.push_back(chunks);
-
-   TAsyncReadvHandler *handler;
-   XRootDStatus        status;
-   semaphore = new TSemaphore(0);
-   statuses  = new std::vector<XRootDStatus*>(chunkLists.size());
-
-   // Read asynchronously but wait for all responses
-   std::vector<ChunkList>::iterator it;
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it)
-   {
-      handler = new TAsyncReadvHandler(statuses, it - chunkLists.begin(),
-                                       semaphore);
-      status = fFile->VectorRead(*it, 0, handler);
-
-      if (!status.IsOK()) {
-         Error("ReadBuffers", "%s", status.ToStr().c_str());
+      if (ReadViaBlockCache(ioVec.data(), nbuffs))
          return kTRUE;
-      }
-   }
-
-   // Wait for all responses
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      semaphore->Wait();
-   }
-
-   // Check for errors
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      XRootDStatus *st = statuses->at(it - chunkLists.begin());
-
-      if (!st->IsOK()) {
-         Error("ReadBuffers", "%s", st->ToStr().c_str());
-         for( ; it != chunkLists.end(); ++it )
-         {
-            st = statuses->at( it - chunkLists.begin() );
-            delete st;
+      for (Int_t i = 0; i < nbuffs; ++i) {
+         if ((Int_t)ioVec[i].fOutBytes != length[i]) {
+            Error("ReadBuffers", "error reading all requested bytes, got %zu of %d",
+                  ioVec[i].fOutBytes, length[i]);
+            return kTRUE;
          }
-         delete statuses;
-         delete semaphore;
-
-         return kTRUE;
       }
-      delete st;
+   } else {
+      // Build a list of chunks. Put the buffers in the ChunkInfo's
+      std::vector<ChunkList> chunkLists;
+      char *cursor = buffer;
+      for (Int_t i = 0; i < nbuffs; ++i) {
+         AddChunk(chunkLists, position[i], length[i], cursor, fReadvIorMax, fReadvIovMax);
+         cursor     += length[i];
+         totalBytes += length[i];
+      }
+      if (ReadChunkLists(fFile, chunkLists, fReadvParallel))
+         return kTRUE;
    }
 
    // Bump the globals
@@ -586,11 +616,63 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    if (gMonitoringWriter)
       gMonitoringWriter->SendFileReadProgress(this);
 
-   delete statuses;
-   delete semaphore;
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Serve reads from the local block cache, fetching the missing blocks with
+/// vector reads; the output sizes of the reads are set
+///
+/// returns: kTRUE in case of failure
+
+Bool_t TNetXNGFile::ReadViaBlockCache(ROOT::Internal::RRawFile::RIOVec *ioVec, Int_t nReq)
+{
+   using RIOVec = ROOT::Internal::RRawFile::RIOVec;
+   try {
+      fBlockCache->ReadV(fBlockCacheKey, fBlockCacheFileSize, ioVec, nReq,
+                         [this](RIOVec *missing, unsigned int nMissing) {
+                            std::vector<XrdCl::ChunkList> chunkLists;
+                            for (unsigned int i = 0; i < nMissing; ++i)
+                               AddChunk(chunkLists, missing[i].fOffset, missing[i].fSize,
+                                        static_cast<char *>(missing[i].fBuffer),
+                                        fReadvIorMax, fReadvIovMax);
+                            if (ReadChunkLists(fFile, chunkLists, fReadvParallel))
+                               throw std::runtime_error("vector read failed");
+                            for (unsigned int i = 0; i < nMissing; ++i)
+                               missing[i].fOutBytes = missing[i].fSize;
+                         });
+   } catch (const std::runtime_error &) {
+      // The error was reported by ReadChunkLists()
+      return kTRUE;
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Use the local block cache (see ROOT::Internal::RBlockCache), if configured,
+/// for files opened read-only. The cached blocks belong to the current size and
+/// modification time of the file.
+
+void TNetXNGFile::InitBlockCache()
+{
+   using namespace XrdCl;
+
+   if (fBlockCache || (fMode & (OpenFlags::New | OpenFlags::Delete | OpenFlags::Update)))
+      return;
+   auto blockCache = ROOT::Internal::RBlockCache::Get();
+   if (!blockCache)
+      return;
+
+   StatInfo *info = nullptr;
+   if (!fFile->Stat(false, info).IsOK())
+      return;
+   fBlockCacheFileSize = info->GetSize();
+   fBlockCacheKey = ROOT::Internal::RBlockCache::MakeFileKey(fUrl->GetLocation(), info->GetSize(),
+                                                             info->GetModTime());
+   delete info;
+   fBlockCache = blockCache;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write a data chunk
 ///
@@ -875,6 +957,7 @@ void TNetXNGFile::SetEnv()
       env->PutString("ClientMonitorParam", val.Data());
 
    fQueryReadVParams = gEnv->GetValue("NetXNG.QueryReadVParams", 1);
+   fReadvParallel = gEnv->GetValue("NetXNG.ReadvParallel", fReadvParallel);
    env->PutInt( "MultiProtocol", gEnv->GetValue("TFile.CrossProtocolRedirects", 1));
 
    // Old style netrc file
@@ -34,12 +34,17 @@
  */
 namespace RooBatchCompute {
 
-enum class Architecture { AVX512, AVX2, AVX, SSE4, GENERIC, CUDA };
+enum class Architecture { AVX512, AVX2, AVX, SSE4, SVE, NEON, GENERIC, CUDA };
 
 enum Computer{AddPdf, ArgusBG, Bernstein, BifurGauss, BreitWigner, Bukin, CBShape, Chebychev,
               ChiSquare, DstD0BG, Exponential, Gamma, Gaussian, Johnson, Landau, Lognormal,
               NegativeLogarithms, Novosibirsk, Poisson, Polynomial, ProdPdf, Ratio, Voigtian};
 
+/// The CPU backends only split a computation over the tasks of the implicit multithreading pool if every task gets at
+/// least this many events. It is also the size of the chunks in which the RooFitDriver evaluates the computation graph
+/// and the RooNLLVarNew sums the log-likelihood in parallel, so that a chunk is processed by a single task.
+constexpr std::size_t minEventsPerTask = 8192;
+
 /**
  * \class RooBatchComputeInterface
  * \ingroup Roobatchcompute
@@ -13,9 +13,13 @@
 #ifndef ROOFIT_BATCHCOMPUTE_INITIALIZATION_H
 #define ROOFIT_BATCHCOMPUTE_INITIALIZATION_H
 
+#include <string>
+#include <vector>
+
 namespace RooBatchCompute {
 
 void init();
+std::vector<std::string> cpuLibraries();
 
 } // End namespace RooBatchCompute
 
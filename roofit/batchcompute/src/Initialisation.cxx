@@ -11,6 +11,7 @@
  */
 
 #include "RooBatchCompute.h"
+#include "RooBatchCompute/Initialisation.h"
 
 #include "TEnv.h"
 #include "TSystem.h"
@@ -19,6 +20,10 @@
 #include <string>
 #include <exception>
 
+#if defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#endif
+
 // First initialisation of the pointers. When implementations of the batch compute library
 // are loaded, they will overwrite the pointers.
 RooBatchCompute::RooBatchComputeInterface *RooBatchCompute::dispatchCPU = nullptr;
@@ -41,7 +46,40 @@ void loadWithErrorChecking(const std::string &libName)
 
 namespace RooBatchCompute {
 
+/// Names of the architecture-specific CPU computation libraries that can run on this processor, from the fastest to
+/// the slowest. The last entry is always the generic library, which runs on every processor.
+std::vector<std::string> cpuLibraries()
+{
+   std::vector<std::string> out;
+#ifdef R__RF_ARCHITECTURE_SPECIFIC_LIBS
+#if defined(__x86_64__)
+   __builtin_cpu_init();
+#if __GNUC__ > 5 || defined(__clang__)
+   if (__builtin_cpu_supports("avx512cd") && __builtin_cpu_supports("avx512vl") &&
+       __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq"))
+      out.emplace_back("libRooBatchCompute_AVX512");
+#endif
+   if (__builtin_cpu_supports("avx2"))
+      out.emplace_back("libRooBatchCompute_AVX2");
+   if (__builtin_cpu_supports("avx"))
+      out.emplace_back("libRooBatchCompute_AVX");
+   if (__builtin_cpu_supports("sse4.1"))
+      out.emplace_back("libRooBatchCompute_SSE4.1");
+#elif defined(__aarch64__)
+#if defined(R__RF_HAS_SVE_LIB) && defined(HWCAP_SVE)
+   if (getauxval(AT_HWCAP) & HWCAP_SVE)
+      out.emplace_back("libRooBatchCompute_SVE");
+#endif
+   // The Advanced SIMD (NEON) instructions are mandatory in ARMv8-A, so every 64 bit ARM processor supports them.
+   out.emplace_back("libRooBatchCompute_NEON");
+#endif
+#endif // R__RF_ARCHITECTURE_SPECIFIC_LIBS
+   out.emplace_back("libRooBatchCompute_GENERIC");
+   return out;
+}
+
 /// Inspect hardware capabilities, and load the optimal library for RooFit computations.
+/// The choice can be overridden with the `RooFit.BatchCompute` key in the `.rootrc`.
 void init()
 {
    // Check if the library was not initialised already
@@ -58,24 +96,10 @@ void init()
    }
 #endif // R__HAS_CUDA
 
-   __builtin_cpu_init();
-#if __GNUC__ > 5 || defined(__clang__)
-   bool supported_avx512 = __builtin_cpu_supports("avx512cd") && __builtin_cpu_supports("avx512vl") &&
-                           __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq");
-#else
-   bool supported_avx512 = false;
-#endif
-
-   if (userChoice == "auto") {
-      if (supported_avx512)
-         loadWithErrorChecking("libRooBatchCompute_AVX512");
-      else if (__builtin_cpu_supports("avx2"))
-         loadWithErrorChecking("libRooBatchCompute_AVX2");
-      else if (__builtin_cpu_supports("avx"))
-         loadWithErrorChecking("libRooBatchCompute_AVX");
-      else if (__builtin_cpu_supports("sse4.1"))
-         loadWithErrorChecking("libRooBatchCompute_SSE4.1");
-   } else if (userChoice == "avx512")
+#if defined(__x86_64__)
+   if (userChoice == "auto")
+      loadWithErrorChecking(cpuLibraries().front());
+   else if (userChoice == "avx512")
       loadWithErrorChecking("libRooBatchCompute_AVX512");
    else if (userChoice == "avx2")
       loadWithErrorChecking("libRooBatchCompute_AVX2");
@@ -86,6 +110,23 @@ void init()
    else if (userChoice != "generic")
       throw std::invalid_argument(
          "Supported options for `RooFit.BatchCompute` are `auto`, `avx512`, `avx2`, `avx`, `sse`, `generic`.");
+#elif defined(__aarch64__)
+   if (userChoice == "auto")
+      loadWithErrorChecking(cpuLibraries().front());
+#ifdef R__RF_HAS_SVE_LIB
+   else if (userChoice == "sve")
+      loadWithErrorChecking("libRooBatchCompute_SVE");
+#endif
+   else if (userChoice == "neon")
+      loadWithErrorChecking("libRooBatchCompute_NEON");
+   else if (userChoice != "generic")
+      throw std::invalid_argument(
+#ifdef R__RF_HAS_SVE_LIB
+         "Supported options for `RooFit.BatchCompute` are `auto`, `sve`, `neon`, `generic`.");
+#else
+         "Supported options for `RooFit.BatchCompute` are `auto`, `neon`, `generic`.");
+#endif
+#endif
 #endif // R__RF_ARCHITECTURE_SPECIFIC_LIBS
 
    if (RooBatchCompute::dispatchCPU == nullptr)
@@ -69,7 +69,9 @@ public:
    /** Compute multiple values using optimized functions.
    This method creates a Batches object and passes it to the correct compute function.
    In case Implicit Multithreading is enabled, the events to be processed are equally
-   divided among the tasks to be generated and computed in parallel.
+   divided among the tasks to be generated and computed in parallel, as long as every
+   task gets at least RooBatchCompute::minEventsPerTask events. This method can be
+   called concurrently from different threads.
    \param computer An enum specifying the compute function to be used.
    \param output The array where the computation results are stored.
    \param nEvents The number of events to be processed.
@@ -78,19 +80,19 @@ public:
    void compute(cudaStream_t *, Computer computer, RestrictArr output, size_t nEvents, const VarVector &vars,
                 const ArgVector &extraArgs) override
    {
-      static std::vector<double> buffer;
-      buffer.resize(vars.size() * bufferSize);
-
-      if (ROOT::IsImplicitMTEnabled()) {
+      if (ROOT::IsImplicitMTEnabled() && nEvents > minEventsPerTask) {
          ROOT::Internal::TExecutor ex;
          std::size_t nThreads = ex.GetPoolSize();
 
          std::size_t nEventsPerThread = nEvents / nThreads + (nEvents % nThreads > 0);
+         nEventsPerThread = std::max(nEventsPerThread, minEventsPerTask);
 
          // Reset the number of threads to the number we actually need given nEventsPerThread
          nThreads = nEvents / nEventsPerThread + (nEvents % nEventsPerThread > 0);
 
          auto task = [&](std::size_t idx) -> int {
+            // Every task fills its own copies of the scalar variables
+            std::vector<double> buffer(vars.size() * bufferSize);
 
             // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
             // Then advance every object but the first to split the work between threads
@@ -120,6 +122,8 @@ public:
          }
          ex.Map(task, indices);
       } else {
+         std::vector<double> buffer(vars.size() * bufferSize);
+
          // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
          // Then advance every object but the first to split the work between threads
          Batches batches(output, nEvents, vars, extraArgs, buffer.data());
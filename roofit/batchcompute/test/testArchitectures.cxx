@@ -0,0 +1,168 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2022, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooBatchCompute.h>
+#include <RooBatchCompute/Initialisation.h>
+
+#include <TRandom3.h>
+#include <TSystem.h>
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// A call of a compute function: the first variable is an array of observables, the others are scalar parameters.
+struct ComputeCase {
+   std::string name;
+   RooBatchCompute::Computer computer;
+   std::vector<std::pair<double, double>> ranges; ///< Ranges from which the values of the variables are drawn
+   RooBatchCompute::ArgVector extraArgs;
+};
+
+std::vector<ComputeCase> const &computeCases()
+{
+   using namespace RooBatchCompute;
+   static const std::vector<ComputeCase> cases{
+      {"BifurGauss", BifurGauss, {{-5., 5.}, {-1., 1.}, {0.5, 2.}, {0.5, 2.}}, {}},
+      {"BreitWigner", BreitWigner, {{-5., 5.}, {-1., 1.}, {0.5, 2.}}, {}},
+      {"Bukin", Bukin, {{-5., 5.}, {-1., 1.}, {0.5, 2.}, {-0.5, 0.5}, {-0.5, 0.}, {-0.5, 0.}}, {}},
+      {"CBShape", CBShape, {{-5., 5.}, {-1., 1.}, {0.5, 2.}, {0.5, 2.}, {1., 5.}}, {}},
+      {"ChiSquare", ChiSquare, {{0.1, 20.}}, {5.}},
+      {"Exponential", Exponential, {{0., 10.}, {-2., -0.1}}, {}},
+      {"Gaussian", Gaussian, {{-5., 5.}, {-1., 1.}, {0.5, 2.}}, {}},
+      {"Landau", Landau, {{-5., 20.}, {-1., 1.}, {0.5, 2.}}, {}},
+      {"Lognormal", Lognormal, {{0.1, 10.}, {1., 3.}, {1.5, 3.}}, {}},
+      {"Novosibirsk", Novosibirsk, {{-5., 5.}, {-1., 1.}, {0.5, 2.}, {-0.5, 0.5}}, {}},
+      {"Poisson", Poisson, {{0., 20.}, {1., 10.}}, {0., 1.}},
+      {"Polynomial", Polynomial, {{-5., 5.}}, {0.5, 0.3, 0.1, 0.}},
+      {"Voigtian", Voigtian, {{-5., 5.}, {-1., 1.}, {0.5, 2.}, {0.5, 2.}}, {}}};
+   return cases;
+}
+
+/// Load every CPU computation library that this processor supports, the generic one last. Every library sets the
+/// RooBatchCompute::dispatchCPU pointer to its implementation when it is loaded.
+std::vector<RooBatchCompute::RooBatchComputeInterface *> const &libraries()
+{
+   static const std::vector<RooBatchCompute::RooBatchComputeInterface *> libs = []() {
+      std::vector<RooBatchCompute::RooBatchComputeInterface *> out;
+      for (std::string const &libName : RooBatchCompute::cpuLibraries()) {
+         if (gSystem->Load(libName.c_str()) == 0)
+            out.push_back(RooBatchCompute::dispatchCPU);
+      }
+      return out;
+   }();
+   return libs;
+}
+
+/// The values of the variables of a compute case, filled with random numbers from their ranges.
+class ComputeInputs {
+public:
+   ComputeInputs(ComputeCase const &computeCase, std::size_t nEvents)
+   {
+      TRandom3 rng(1337);
+      for (std::size_t iVar = 0; iVar < computeCase.ranges.size(); ++iVar) {
+         auto const &range = computeCase.ranges[iVar];
+         _values.emplace_back(iVar == 0 ? nEvents : 1);
+         for (double &val : _values.back())
+            val = rng.Uniform(range.first, range.second);
+      }
+      for (auto const &val : _values)
+         _vars.emplace_back(val);
+   }
+
+   RooBatchCompute::VarVector const &vars() const { return _vars; }
+
+private:
+   std::vector<std::vector<double>> _values;
+   RooBatchCompute::VarVector _vars;
+};
+
+} // namespace
+
+/// All CPU computation libraries give the results of the generic one, up to the rounding differences of vectorized
+/// and fused floating point operations.
+TEST(RooBatchCompute, ArchitecturesAgree)
+{
+   auto const &libs = libraries();
+   ASSERT_FALSE(libs.empty());
+   ASSERT_EQ(libs.back()->architecture(), RooBatchCompute::Architecture::GENERIC);
+
+   constexpr std::size_t nEvents = 10000;
+   for (ComputeCase const &computeCase : computeCases()) {
+      ComputeInputs inputs{computeCase, nEvents};
+      std::vector<double> reference(nEvents);
+      libs.back()->compute(nullptr, computeCase.computer, reference.data(), nEvents, inputs.vars(),
+                           computeCase.extraArgs);
+
+      for (std::size_t iLib = 0; iLib + 1 < libs.size(); ++iLib) {
+         std::vector<double> output(nEvents);
+         libs[iLib]->compute(nullptr, computeCase.computer, output.data(), nEvents, inputs.vars(),
+                             computeCase.extraArgs);
+         for (std::size_t i = 0; i < nEvents; ++i) {
+            EXPECT_NEAR(output[i], reference[i], 1e-9 * std::max(1., std::abs(reference[i])))
+               << computeCase.name << " in event " << i << " with the " << libs[iLib]->architectureName()
+               << " library";
+         }
+      }
+   }
+}
+
+/// Print the time per event of every compute function in every CPU computation library that this processor supports,
+/// and the speedup with respect to the generic library.
+TEST(RooBatchCompute, BenchmarkArchitectures)
+{
+   using Clock = std::chrono::steady_clock;
+
+   auto const &libs = libraries();
+   ASSERT_FALSE(libs.empty());
+
+   constexpr std::size_t nEvents = 100000;
+   constexpr int nRepetitions = 10;
+
+   std::cout << std::left << std::setw(14) << "Function";
+   for (auto *lib : libs)
+      std::cout << std::right << std::setw(20) << lib->architectureName() + " [ns/event]";
+   std::cout << std::endl;
+
+   std::vector<double> output(nEvents);
+   for (ComputeCase const &computeCase : computeCases()) {
+      ComputeInputs inputs{computeCase, nEvents};
+      std::vector<double> times;
+      for (auto *lib : libs) {
+         // The fastest repetition is least affected by other processes
+         double best = std::numeric_limits<double>::infinity();
+         for (int iRep = 0; iRep < nRepetitions; ++iRep) {
+            auto start = Clock::now();
+            lib->compute(nullptr, computeCase.computer, output.data(), nEvents, inputs.vars(), computeCase.extraArgs);
+            best = std::min(best, std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+         }
+         times.push_back(best / nEvents);
+      }
+
+      std::cout << std::left << std::setw(14) << computeCase.name << std::right << std::fixed;
+      for (double time : times) {
+         std::stringstream ss;
+         ss << std::fixed << std::setprecision(2) << time << " (x" << std::setprecision(1) << times.back() / time
+            << ")";
+         std::cout << std::setw(20) << ss.str();
+      }
+      std::cout << std::endl;
+   }
+}
@@ -17,6 +17,8 @@
 #include "RooObjCacheManager.h"
 #include "RooDataHist.h"
 
+#include <vector>
+
 // Forward Declarations
 class RooRealVar;
 class RooWorkspace;
@@ -96,6 +98,8 @@ protected:
   };
   mutable NumBins _numBinsPerDim; //!
   mutable RooDataHist _dataSet;
+  mutable std::vector<int> _binIndices;       ///<! Bin indices of the observable values last passed to computeBatch()
+  mutable std::vector<double> _binIndicesObs; ///<! These observable values, one variable after the other
 
   Int_t getCurrentBin() const;
   Int_t addVarSet( const RooArgList& vars );
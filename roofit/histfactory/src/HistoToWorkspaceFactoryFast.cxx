@@ -1346,6 +1346,8 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
     cxcoutP(HistFactory) << "\n-----------------------------------------\n"
         << "\timport model into workspace"
         << "\n-----------------------------------------\n" << endl;
+    const double timeTerms = t.RealTime();
+    t.Start();
 
     auto model = make_unique<RooProdPdf>(
         ("model_"+channel_name).c_str(),    // MB : have changed this into conditional pdf. Much faster for toys!
@@ -1361,6 +1363,8 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
     //    proto_config->GuessObsAndNuisance(*proto->data("asimovData"));
     proto->import(*proto_config,proto_config->GetName());
     proto->importClassCode();
+    const double timeImport = t.RealTime();
+    t.Start();
 
     ///////////////////////////
     // make data sets
@@ -1413,6 +1417,10 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
     if (RooMsgService::instance().isActive(static_cast<TObject*>(nullptr), RooFit::HistFactory, RooFit::INFO))
       proto->Print();
 
+    cxcoutP(HistFactory) << "Channel " << channel_name << " built in " << timeTerms + timeImport + t.RealTime()
+        << " s: " << timeTerms << " s for the likelihood terms, " << timeImport << " s to import the model, "
+        << t.RealTime() << " s for the datasets" << endl;
+
     return proto;
   }
 
@@ -1503,6 +1511,9 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
     /// These things were used for debugging. Maybe useful in the future
     //
 
+    TStopwatch t;
+    t.Start();
+
     map<string, RooAbsPdf*> pdfMap;
     vector<RooAbsPdf*> models;
 
@@ -1581,6 +1592,8 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
     cxcoutP(HistFactory) << "\n-----------------------------------------\n"
             << "\tImporting combined model"
             << "\n-----------------------------------------\n" << endl;
+    const double timeData = t.RealTime();
+    t.Start();
     combined->import(*simPdf,RecycleConflictNodes());
 
     std::map< std::string, double>::iterator param_itr = fParamValues.begin();
@@ -1617,6 +1630,8 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
     combined->import(*combined_config,combined_config->GetName());
     combined->importClassCode();
     //    combined->writeToFile("results/model_combined.root");
+    const double timeImport = t.RealTime();
+    t.Start();
 
 
     ////////////////////////////////////////////
@@ -1641,6 +1656,10 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
       throw hf_exc();
     }
 
+    cxcoutP(HistFactory) << "Combined model of " << ch_names.size() << " channels built in "
+        << timeData + timeImport + t.RealTime() << " s: " << timeData << " s to merge the datasets, " << timeImport
+        << " s to import the model, " << t.RealTime() << " s for the Asimov dataset" << endl;
+
     return combined;
   }
 
@@ -50,6 +50,7 @@
 
 #include "TH1.h"
 
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
 #include <iostream>
@@ -600,27 +601,37 @@ void ParamHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, Roo
     _numBinsPerDim = getNumBinsPerDim(_dataVars);
   }
 
-  // Different from the evaluate() funnction that first retrieves the indices
-  // corresponding to the RooDataHist and then transforms them, we can use the
-  // right bin multiplicators to begin with.
-  std::array<int, 3> idxMult{{1, n.x, n.xy}};
-
-  // As a working buffer for the bin indices, we use the tail of the output
-  // buffer. We can't use the same starting pointer, otherwise we would
-  // overwrite the later bin indices as we fill the output.
-  auto indexBuffer = reinterpret_cast<int*>(output + size) - size;
-  std::fill(indexBuffer, indexBuffer + size, 0); // output buffer for bin indices needs to be zero-initialized
-
-  // Use the vectorized RooAbsBinning::binNumbers() to update the total bin
-  // index for each dimension, using the `coef` parameter to multiply with the
-  // right index multiplication factor for each dimension.
-  for (std::size_t iVar = 0; iVar < _dataVars.size(); ++iVar) {
-    _dataSet.getBinnings()[iVar]->binNumbers(dataMap.at(&_dataVars[iVar]).data(), indexBuffer, size, idxMult[iVar]);
+  // In binned fits, the observable values don't change from one evaluation to
+  // the next. The bin indices are therefore only recomputed if they do.
+  const std::size_t nVars = _dataVars.size();
+  bool sameObs = _binIndices.size() == size && _binIndicesObs.size() == size * nVars;
+  for (std::size_t iVar = 0; iVar < nVars && sameObs; ++iVar) {
+    const double* obs = dataMap.at(&_dataVars[iVar]).data();
+    sameObs = std::equal(obs, obs + size, _binIndicesObs.begin() + iVar * size);
+  }
+
+  if (!sameObs) {
+    // Different from the evaluate() funnction that first retrieves the indices
+    // corresponding to the RooDataHist and then transforms them, we can use the
+    // right bin multiplicators to begin with.
+    std::array<int, 3> idxMult{{1, n.x, n.xy}};
+
+    _binIndices.assign(size, 0); // output buffer for bin indices needs to be zero-initialized
+    _binIndicesObs.resize(size * nVars);
+
+    // Use the vectorized RooAbsBinning::binNumbers() to update the total bin
+    // index for each dimension, using the `coef` parameter to multiply with the
+    // right index multiplication factor for each dimension.
+    for (std::size_t iVar = 0; iVar < nVars; ++iVar) {
+      const double* obs = dataMap.at(&_dataVars[iVar]).data();
+      _dataSet.getBinnings()[iVar]->binNumbers(obs, _binIndices.data(), size, idxMult[iVar]);
+      std::copy(obs, obs + size, _binIndicesObs.begin() + iVar * size);
+    }
   }
 
   // Finally, look up the parameters and get their values to fill the output buffer
   for (std::size_t i = 0; i < size; ++i) {
-    output[i] = static_cast<RooAbsReal const&>(_paramSet[indexBuffer[i]]).getVal();
+    output[i] = static_cast<RooAbsReal const&>(_paramSet[_binIndices[i]]).getVal();
   }
 }
 
@@ -30,6 +30,12 @@ public:
 
       static std::size_t defaultNEventTasks;
       static std::size_t defaultNComponentTasks;
+      static bool cacheTaskResults;
+   };
+
+   struct Queue {
+      static bool orderTasksByCost;
+      static bool printTaskTimings;
    };
 private:
    static unsigned int defaultNWorkers_;
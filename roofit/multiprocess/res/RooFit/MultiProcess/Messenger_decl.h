@@ -153,7 +153,7 @@ enum class M2Q : int {
 };
 
 // Messages from worker to queue
-enum class W2Q : int { dequeue = 30 };
+enum class W2Q : int { dequeue = 30, task_time = 31 };
 
 // Messages from queue to worker
 enum class Q2W : int {
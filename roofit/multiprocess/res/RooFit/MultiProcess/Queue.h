@@ -16,7 +16,10 @@
 #include "RooFit/MultiProcess/types.h"
 #include "RooFit/MultiProcess/Messenger.h"
 
+#include <map>
 #include <queue>
+#include <utility> // pair
+#include <vector>
 
 namespace RooFit {
 namespace MultiProcess {
@@ -31,8 +34,29 @@ public:
    void process_master_message(M2Q message);
    void process_worker_message(std::size_t this_worker_id, W2Q message);
 
+   void print_timing_report() const;
+
 private:
-   std::queue<JobTask> queue_;
+   struct QueuedTask {
+      JobTask job_task;
+      double cost;          // last measured time of the task, infinite if it was not measured yet
+      std::size_t sequence; // order of arrival, to hand out tasks of equal cost first in first out
+   };
+   struct LowerPriority {
+      bool operator()(QueuedTask const &a, QueuedTask const &b) const
+      {
+         return a.cost < b.cost || (a.cost == b.cost && a.sequence > b.sequence);
+      }
+   };
+   struct TaskTiming {
+      std::size_t N_evaluations = 0;
+      double total_time = 0;
+      double last_time = 0;
+   };
+
+   std::priority_queue<QueuedTask, std::vector<QueuedTask>, LowerPriority> queue_;
+   std::map<std::pair<std::size_t, Task>, TaskTiming> task_timings_; // per job ID and task index
+   std::vector<double> worker_busy_times_;
    std::size_t N_tasks_ = 0; // total number of received tasks
    std::size_t N_tasks_at_workers_ = 0;
 };
@@ -0,0 +1,43 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2022, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef ROOT_ROOFIT_MultiProcess_SharedMemory
+#define ROOT_ROOFIT_MultiProcess_SharedMemory
+
+#include <cstddef> // std::size_t
+
+namespace RooFit {
+namespace MultiProcess {
+
+class SharedMemory {
+public:
+   explicit SharedMemory(std::size_t size);
+   SharedMemory(const SharedMemory &other);
+   SharedMemory(SharedMemory &&other) noexcept;
+   SharedMemory &operator=(const SharedMemory &other) = delete;
+   SharedMemory &operator=(SharedMemory &&other) noexcept;
+   ~SharedMemory();
+
+   template <typename T>
+   T *data() const
+   {
+      return static_cast<T *>(data_);
+   }
+   std::size_t size() const { return size_; }
+
+private:
+   void *data_ = nullptr;
+   std::size_t size_ = 0;
+};
+
+} // namespace MultiProcess
+} // namespace RooFit
+
+#endif // ROOT_ROOFIT_MultiProcess_SharedMemory
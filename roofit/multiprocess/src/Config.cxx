@@ -29,7 +29,9 @@ namespace MultiProcess {
  * are:
  * 1. the number of workers to be deployed,
  * 2. the number of event-tasks in LikelihoodJobs,
- * 3. and the number of component-tasks in LikelihoodJobs.
+ * 3. the number of component-tasks in LikelihoodJobs,
+ * 4. whether LikelihoodJob workers reuse the results of tasks whose parameters didn't change,
+ * 5. and the order in which the queue hands out tasks, plus a report of the task timings.
  *
  * The default number of workers is set using 'std::thread::hardware_concurrency()'.
  * To change it, use 'Config::setDefaultNWorkers()' to set it to a different value
@@ -52,6 +54,21 @@ namespace MultiProcess {
  * number of workers in the JobManager, with events divided equally over workers. For
  * components, the automatic mode uses just 1 task for all components. These automatic
  * modes may change in the future (for instance, we may switch them around).
+ *
+ * With Config::LikelihoodJob::cacheTaskResults (on by default), each worker keeps the
+ * result of every task it computed. A task is only recomputed when one of the parameters
+ * of its components changed since, so in simultaneous fits split over components, the
+ * channels that don't depend on the varied parameters are not recomputed.
+ *
+ * The workers measure the time they spend on each task. With
+ * Config::Queue::orderTasksByCost (on by default), the queue hands out the tasks of a
+ * job in order of their last measured time, most expensive first, so that the cheap tasks
+ * fill the gaps at the end instead of one worker finishing an expensive task while the
+ * others wait. Tasks that were not measured yet are handed out first, in the order they
+ * were added. With Config::Queue::printTaskTimings (off by default), the queue prints
+ * the busy time of each worker and the timings of each task when it terminates, i.e.
+ * when the JobManager is destroyed. Like the number of workers, the Queue settings have
+ * to be set before the JobManager is instantiated.
  */
 
 void Config::setDefaultNWorkers(unsigned int N_workers)
@@ -74,6 +91,9 @@ unsigned int Config::getDefaultNWorkers()
 unsigned int Config::defaultNWorkers_ = std::thread::hardware_concurrency();
 std::size_t Config::LikelihoodJob::defaultNEventTasks = Config::LikelihoodJob::automaticNEventTasks;
 std::size_t Config::LikelihoodJob::defaultNComponentTasks = Config::LikelihoodJob::automaticNComponentTasks;
+bool Config::LikelihoodJob::cacheTaskResults = true;
+bool Config::Queue::orderTasksByCost = true;
+bool Config::Queue::printTaskTimings = false;
 
 } // namespace MultiProcess
 } // namespace RooFit
@@ -486,6 +486,7 @@ std::ostream &operator<<(std::ostream &out, const W2Q value)
    std::string s;
    switch (value) {
       PROCESS_VAL(W2Q::dequeue);
+      PROCESS_VAL(W2Q::task_time);
    default: s = std::to_string(static_cast<int>(value));
    }
    return out << s;
@@ -16,6 +16,10 @@
 #include "RooFit/MultiProcess/ProcessManager.h"
 #include "RooFit/MultiProcess/Job.h" // complete Job object for JobManager::get_job_object()
 #include "RooFit/MultiProcess/util.h"
+#include "RooFit/MultiProcess/Config.h"
+
+#include <cstdio>
+#include <limits>
 
 namespace RooFit {
 namespace MultiProcess {
@@ -38,6 +42,11 @@ namespace MultiProcess {
  * runtimes (this simple strategy could be implemented with a PUSH-PULL
  * ZeroMQ socket from master to workers, which would distribute tasks in a
  * round-robin fashion, which, indeed, does not do load balancing).
+ *
+ * Pulling tasks alone still leaves workers idle at the end of an evaluation
+ * when an expensive task is handed out last. Therefore, the workers report
+ * the time each task took, and the queue hands out the tasks in order of
+ * their last measured time, most expensive first (see Config::Queue).
  */
 
 /// Have a worker ask for a task-message from the queue
@@ -49,7 +58,7 @@ bool Queue::pop(JobTask &job_task)
    if (queue_.empty()) {
       return false;
    } else {
-      job_task = queue_.front();
+      job_task = queue_.top().job_task;
       queue_.pop();
       return true;
    }
@@ -64,7 +73,12 @@ void Queue::add(JobTask job_task)
       JobManager::instance()->messenger().send_from_master_to_queue(M2Q::enqueue, job_task.job_id, job_task.state_id,
                                                                     job_task.task_id);
    } else if (JobManager::instance()->process_manager().is_queue()) {
-      queue_.push(job_task);
+      double cost = 0;
+      if (Config::Queue::orderTasksByCost) {
+         auto timing = task_timings_.find({job_task.job_id, job_task.task_id});
+         cost = timing != task_timings_.end() ? timing->second.last_time : std::numeric_limits<double>::infinity();
+      }
+      queue_.push({job_task, cost, N_tasks_});
    } else {
       throw std::logic_error("calling Communicator::to_master_queue from slave process");
    }
@@ -105,6 +119,34 @@ void Queue::process_worker_message(std::size_t this_worker_id, W2Q message)
       }
       break;
    }
+   case W2Q::task_time: {
+      auto job_id = JobManager::instance()->messenger().receive_from_worker_on_queue<std::size_t>(this_worker_id);
+      auto task_id = JobManager::instance()->messenger().receive_from_worker_on_queue<Task>(this_worker_id);
+      auto time = JobManager::instance()->messenger().receive_from_worker_on_queue<double>(this_worker_id);
+      TaskTiming &timing = task_timings_[{job_id, task_id}];
+      ++timing.N_evaluations;
+      timing.total_time += time;
+      timing.last_time = time;
+      if (worker_busy_times_.size() <= this_worker_id) {
+         worker_busy_times_.resize(this_worker_id + 1, 0.);
+      }
+      worker_busy_times_[this_worker_id] += time;
+      break;
+   }
+   }
+}
+
+/// Print the time that each worker spent on tasks and the timings of each task, as reported by the workers
+void Queue::print_timing_report() const
+{
+   printf("MultiProcess queue timing report (times in seconds):\n");
+   for (std::size_t worker_id = 0; worker_id < worker_busy_times_.size(); ++worker_id) {
+      printf("  worker %zu: busy for %g\n", worker_id, worker_busy_times_[worker_id]);
+   }
+   for (auto const &item : task_timings_) {
+      TaskTiming const &timing = item.second;
+      printf("  job %zu task %zu: %zu evaluations, total %g, mean %g, last %g\n", item.first.first, item.first.second,
+             timing.N_evaluations, timing.total_time, timing.total_time / timing.N_evaluations, timing.last_time);
    }
 }
 
@@ -167,6 +209,10 @@ void Queue::loop()
       }
    }
 
+   if (Config::Queue::printTaskTimings) {
+      print_timing_report();
+   }
+
    // clean up signal management modifications
    sigprocmask(SIG_SETMASK, &JobManager::instance()->messenger().ppoll_sigmask, nullptr);
 }
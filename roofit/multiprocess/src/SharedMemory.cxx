@@ -0,0 +1,89 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2022, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "RooFit/MultiProcess/SharedMemory.h"
+#include "RooFit/MultiProcess/JobManager.h"
+#include "RooFit/MultiProcess/ProcessManager.h"
+
+#include <sys/mman.h> // mmap, munmap
+
+#include <cerrno>
+#include <cstring>   // memcpy, strerror
+#include <stdexcept> // logic_error, runtime_error
+#include <string>
+#include <utility> // swap
+
+namespace RooFit {
+namespace MultiProcess {
+
+/** \class SharedMemory
+ *
+ * \brief Memory that the master process shares with the queue and worker processes
+ *
+ * The memory is an anonymous shared mapping, which the forked processes
+ * inherit. It must therefore be allocated before the JobManager forks, e.g.
+ * in the constructor of a Job, like the Jobs themselves.
+ *
+ * Jobs can use it to pass large state, like the values of all parameters, to
+ * the workers: the master writes the state to shared memory and only
+ * publishes the new state ID over ZeroMQ, after which the workers read the
+ * state directly instead of receiving a copy each. The master must not write
+ * to the memory while tasks of the current state are still being evaluated.
+ * Workers may read a state that is newer than the state ID they received,
+ * but they will receive the newer state ID before any task that needs it.
+ *
+ * Copies allocate their own shared memory with the same contents.
+ */
+
+SharedMemory::SharedMemory(std::size_t size) : size_(size)
+{
+   if (JobManager::is_instantiated() && JobManager::instance()->process_manager().is_initialized()) {
+      throw std::logic_error("Cannot allocate SharedMemory after the JobManager forked the worker processes!");
+   }
+   if (size_ == 0) {
+      return;
+   }
+   data_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+   if (data_ == MAP_FAILED) {
+      data_ = nullptr;
+      throw std::runtime_error("SharedMemory: mmap of " + std::to_string(size_) +
+                               " bytes failed: " + std::strerror(errno));
+   }
+}
+
+SharedMemory::SharedMemory(const SharedMemory &other) : SharedMemory(other.size_)
+{
+   if (size_ > 0) {
+      std::memcpy(data_, other.data_, size_);
+   }
+}
+
+SharedMemory::SharedMemory(SharedMemory &&other) noexcept : data_(other.data_), size_(other.size_)
+{
+   other.data_ = nullptr;
+   other.size_ = 0;
+}
+
+SharedMemory &SharedMemory::operator=(SharedMemory &&other) noexcept
+{
+   std::swap(data_, other.data_);
+   std::swap(size_, other.size_);
+   return *this;
+}
+
+SharedMemory::~SharedMemory()
+{
+   if (data_) {
+      munmap(data_, size_);
+   }
+}
+
+} // namespace MultiProcess
+} // namespace RooFit
@@ -14,6 +14,7 @@
 #include "RooFit/MultiProcess/worker.h"
 
 #include "RooFit/MultiProcess/JobManager.h"
+#include "RooFit/MultiProcess/Config.h"
 #include "RooFit/MultiProcess/types.h"
 #include "RooFit/MultiProcess/Messenger.h"
 #include "RooFit/MultiProcess/Job.h"
@@ -22,6 +23,7 @@
 #include <unistd.h> // getpid, pid_t
 #include <cerrno>   // EINTR
 #include <csignal>  // sigprocmask etc
+#include <chrono>
 
 namespace RooFit {
 namespace MultiProcess {
@@ -108,7 +110,15 @@ void worker_loop()
                      JobManager::get_job_object(job_id_for_state)->update_state();
                   }
 
+                  auto start = std::chrono::steady_clock::now();
                   JobManager::get_job_object(job_id)->evaluate_task(task_id);
+                  std::chrono::duration<double> task_time = std::chrono::steady_clock::now() - start;
+
+                  // the queue uses the measured time to order the tasks of the next evaluations of the job
+                  if (Config::Queue::orderTasksByCost || Config::Queue::printTaskTimings) {
+                     JobManager::instance()->messenger().send_from_worker_to_queue(W2Q::task_time, job_id, task_id,
+                                                                                   task_time.count());
+                  }
                   JobManager::get_job_object(job_id)->send_back_task_result_from_worker(task_id);
 
                   break;
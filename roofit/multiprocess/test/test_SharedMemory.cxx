@@ -0,0 +1,47 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2022, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "RooFit/MultiProcess/SharedMemory.h"
+
+#include <sys/wait.h> // waitpid
+#include <unistd.h>   // fork, _exit
+
+#include "gtest/gtest.h"
+
+TEST(TestMPSharedMemory, writeInForkedProcess)
+{
+   RooFit::MultiProcess::SharedMemory memory(4 * sizeof(double));
+   double *data = memory.data<double>();
+   data[0] = 1.;
+
+   pid_t child_pid = fork();
+   ASSERT_NE(child_pid, -1);
+   if (child_pid == 0) {
+      // the child sees what the parent wrote before forking and the parent sees what the child writes
+      data[1] = data[0] + 1.;
+      _exit(0);
+   }
+   int status = 0;
+   waitpid(child_pid, &status, 0);
+   EXPECT_EQ(data[1], 2.);
+}
+
+TEST(TestMPSharedMemory, copy)
+{
+   RooFit::MultiProcess::SharedMemory memory(sizeof(double));
+   memory.data<double>()[0] = 1.;
+
+   RooFit::MultiProcess::SharedMemory copy(memory);
+   EXPECT_EQ(copy.size(), memory.size());
+   EXPECT_EQ(copy.data<double>()[0], 1.);
+
+   copy.data<double>()[0] = 2.;
+   EXPECT_EQ(memory.data<double>()[0], 1.);
+}
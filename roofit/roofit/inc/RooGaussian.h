@@ -56,6 +56,10 @@ protected:
   double evaluate() const override;
   void computeBatch(cudaStream_t*, double* output, size_t size, RooFit::Detail::DataMap const&) const override;
   inline bool canComputeBatchWithCuda() const override { return true; }
+  BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Analytic; }
+  void computeBatchDerivative(double* output, size_t nEvents, RooAbsArg const& server,
+                              RooFit::Detail::DataMap const&) const override;
+  bool translate(RooFit::Detail::CodegenContext& ctx) const override;
 
 private:
 
@@ -50,6 +50,8 @@ protected:
 
   /// Evaluation
   double evaluate() const override;
+  // The default computeBatch() side-loads the values of the servers from the data map
+  BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Numeric; }
   //void computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::DataMap&) const;
   //inline bool canComputeBatchWithCuda() const { return true; }
 
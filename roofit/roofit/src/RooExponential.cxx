@@ -29,6 +29,7 @@ range and values of the arguments.
 
 #include "RooRealVar.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodegenContext.h"
 
 
 #include <cmath>
@@ -68,6 +69,30 @@ void RooExponential::computeBatch(cudaStream_t* stream, double* output, size_t n
   dispatch->compute(stream, RooBatchCompute::Exponential, output, nEvents, {dataMap.at(x),dataMap.at(c)});
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the derivatives of the exponential with respect to x or c.
+void RooExponential::computeBatchDerivative(double* output, size_t nEvents, RooAbsArg const& server,
+                                            RooFit::Detail::DataMap const& dataMap) const
+{
+  auto xVals = dataMap.at(x);
+  auto cVals = dataMap.at(c);
+  // the server can be both arguments
+  const double wrtX = &server == &x.arg() ? 1. : 0.;
+  const double wrtC = &server == &c.arg() ? 1. : 0.;
+
+  for (std::size_t i = 0; i < nEvents; ++i) {
+    const double xVal = xVals[xVals.size() > 1 ? i : 0];
+    const double cVal = cVals[cVals.size() > 1 ? i : 0];
+    output[i] = std::exp(cVal*xVal) * (wrtX * cVal + wrtC * xVal);
+  }
+}
+
+bool RooExponential::translate(RooFit::Detail::CodegenContext& ctx) const
+{
+  ctx.addResult(*this, "std::exp(" + ctx.getResult(c.arg()) + " * " + ctx.getResult(x.arg()) + ")");
+  return true;
+}
+
 
 Int_t RooExponential::getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* /*rangeName*/) const
 {
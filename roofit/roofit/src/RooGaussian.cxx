@@ -25,6 +25,7 @@ Plain Gaussian p.d.f
 #include "RooHelpers.h"
 #include "RooMath.h"
 #include "RooRandom.h"
+#include "RooFit/Detail/CodegenContext.h"
 
 #include <vector>
 
@@ -70,6 +71,35 @@ void RooGaussian::computeBatch(cudaStream_t* stream, double* output, size_t nEve
           {dataMap.at(x), dataMap.at(mean), dataMap.at(sigma)});
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the derivatives of the Gaussian with respect to x, mean or sigma.
+void RooGaussian::computeBatchDerivative(double* output, size_t nEvents, RooAbsArg const& server,
+                                         RooFit::Detail::DataMap const& dataMap) const
+{
+  auto xVals = dataMap.at(x);
+  auto meanVals = dataMap.at(mean);
+  auto sigmaVals = dataMap.at(sigma);
+  // the server can be more than one of the arguments
+  const double wrtX = &server == &x.arg() ? 1. : 0.;
+  const double wrtMean = &server == &mean.arg() ? 1. : 0.;
+  const double wrtSigma = &server == &sigma.arg() ? 1. : 0.;
+
+  for (std::size_t i = 0; i < nEvents; ++i) {
+    const double arg = xVals[xVals.size() > 1 ? i : 0] - meanVals[meanVals.size() > 1 ? i : 0];
+    const double sig = sigmaVals[sigmaVals.size() > 1 ? i : 0];
+    const double gauss = std::exp(-0.5*arg*arg/(sig*sig));
+    output[i] = gauss * arg/(sig*sig) * ((wrtMean - wrtX) + wrtSigma * arg/sig);
+  }
+}
+
+bool RooGaussian::translate(RooFit::Detail::CodegenContext& ctx) const
+{
+  const std::string arg = "(" + ctx.getResult(x.arg()) + " - " + ctx.getResult(mean.arg()) + ")";
+  const std::string sig = ctx.getResult(sigma.arg());
+  ctx.addResult(*this, "std::exp(-0.5 * " + arg + " * " + arg + " / (" + sig + " * " + sig + "))");
+  return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Int_t RooGaussian::getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* /*rangeName*/) const
@@ -573,6 +573,9 @@ public:
   };
 
   virtual bool canComputeBatchWithCuda() const { return false; }
+  /// Whether computeBatch() computes every output element from the same element of the inputs only and can be called
+  /// concurrently on disjoint ranges of the events. The RooFitDriver then evaluates it in parallel, chunk by chunk.
+  virtual bool canComputeBatchInChunks() const { return canComputeBatchWithCuda(); }
   virtual bool isReducerNode() const { return false; }
 
   virtual void applyWeightSquared(bool flag);
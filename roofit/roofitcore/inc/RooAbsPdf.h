@@ -188,6 +188,7 @@ public:
       int nWorkers = 1;
       bool parallelGradient = false;
       bool parallelLikelihood = false;
+      bool useGradient = false;
       const RooArgSet* minosSet = nullptr;
       std::string minType;
       std::string minAlg = "minuit";
@@ -47,6 +47,11 @@ namespace Experimental {
 class RooFitDriver ;
 }
 }
+namespace RooFit {
+namespace Detail {
+class CodegenContext;
+}
+}
 
 class TH1;
 class TH1F;
@@ -372,6 +377,10 @@ public:
   static void setHideOffset(bool flag);
   static bool hideOffset() ;
 
+  /// Whether gradient() can compute the derivatives of this function with respect to its parameters.
+  virtual bool hasGradient() const { return false; }
+  virtual void gradient(RooArgList const& params, double* out) const;
+
 protected:
   // Hook for objects with normalization-dependent parameters interpretation
   virtual void selectNormalization(const RooArgSet* depSet=nullptr, bool force=false) ;
@@ -394,6 +403,21 @@ protected:
                      RooArgSet *&cloneSet, const char* rangeName=nullptr, const RooArgSet* condObs=nullptr) const;
   virtual void computeBatch(cudaStream_t*, double* output, size_t size, RooFit::Detail::DataMap const&) const;
 
+  /// How the RooFitDriver obtains the derivatives of computeBatch() with respect to the value servers, to compute
+  /// the gradient of a likelihood by propagating the derivatives through the computation graph.
+  enum class BatchDerivatives {
+    None,     ///< Not supported: the gradient of a likelihood that depends on parameters through this node is numerical
+    Analytic, ///< computeBatchDerivative() is overridden with the analytical derivatives
+    Numeric   ///< computeBatch() reads all its value servers from the data map, and each output value depends on the
+              ///< same events of the inputs only, so that the default computeBatchDerivative() can vary them there
+  };
+  virtual BatchDerivatives batchDerivatives() const { return BatchDerivatives::None; }
+  virtual void computeBatchDerivative(double* output, size_t size, RooAbsArg const& server,
+                                      RooFit::Detail::DataMap const&) const;
+  /// Add the computation of this node in one event to a kernel of the code generation backend of the RooFitDriver,
+  /// see RooFit::Detail::CodegenContext. Returns `false` if the node doesn't support code generation.
+  virtual bool translate(RooFit::Detail::CodegenContext&) const { return false; }
+
  protected:
 
   RooFitResult* chi2FitDriver(RooAbsReal& fcn, RooLinkedList& cmdList) ;
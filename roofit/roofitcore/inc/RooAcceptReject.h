@@ -32,6 +32,7 @@ public:
     // coverity[UNINIT_CTOR]
   } ;
   RooAcceptReject(const RooAbsReal &func, const RooArgSet &genVars, const RooNumGenConfig& config, bool verbose=false, const RooAbsReal* maxFuncVal=nullptr);
+  ~RooAcceptReject() override;
   RooAbsNumGenerator* clone(const RooAbsReal& func, const RooArgSet& genVars, const RooArgSet& /*condVars*/,
              const RooNumGenConfig& config, bool verbose=false, const RooAbsReal* maxFuncVal=nullptr) const override {
     return new RooAcceptReject(func,genVars,config,verbose,maxFuncVal) ;
@@ -52,6 +53,8 @@ protected:
   static void registerSampler(RooNumGenFactory& fact) ;
 
   void addEventToCache();
+  void addEventsToCache(Long64_t nEvents);
+  void addEventBlockToCache(std::size_t nEvents);
   const RooArgSet *nextAcceptedEvent();
 
   double _maxFuncVal, _funcSum;       ///< Maximum function value found, and sum of all samples made
@@ -62,6 +65,10 @@ protected:
 
   UInt_t _minTrialsArray[4];            ///< Minimum number of trials samples for 1,2,3 dimensional problems
 
+  UInt_t _batchSize = 0;                ///< Trial samples evaluated together in BatchMode, 0 for one by one
+  bool _batchValidated = false;         ///< Whether the BatchMode values were checked against the scalar evaluation
+  RooDataSet *_proposals = nullptr;     ///< Block of trial samples that are evaluated together
+
   ClassDefOverride(RooAcceptReject,0) // Context for generating a dataset from a PDF
 };
 
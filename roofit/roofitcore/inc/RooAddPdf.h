@@ -120,6 +120,10 @@ protected:
   double getValV(const RooArgSet* set=nullptr) const override ;
   void computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const&) const override;
   inline bool canComputeBatchWithCuda() const override { return true; }
+  // The coefficients are updated in mutable caches
+  inline bool canComputeBatchInChunks() const override { return false; }
+  bool translate(RooFit::Detail::CodegenContext& ctx) const override;
+  BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Numeric; }
 
 
   mutable RooAICRegistry _codeReg; ///<! Registry of component analytical integration codes
@@ -138,6 +142,7 @@ protected:
 
 private:
   std::pair<const RooArgSet*, AddCacheElem*> getNormAndCache(const RooArgSet* nset) const;
+  AddCacheElem* updateBatchCoefficients(RooFit::Detail::DataMap const& dataMap) const;
   mutable RooFit::UniqueId<RooArgSet>::Value_t _idOfLastUsedNormSet = RooFit::UniqueId<RooArgSet>::nullval; ///<!
   mutable std::unique_ptr<const RooArgSet> _copyOfLastNormSet = nullptr; ///<!
 
@@ -57,6 +57,10 @@ public:
   void enableOffsetting(bool) override ;
 
   void computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const&) const override;
+  BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Analytic; }
+  void computeBatchDerivative(double* output, size_t nEvents, RooAbsArg const& server,
+                              RooFit::Detail::DataMap const&) const override;
+  bool translate(RooFit::Detail::CodegenContext& ctx) const override;
 
 protected:
 
@@ -42,6 +42,9 @@ public:
   }
 
   void computeBatch(cudaStream_t*, double* output, size_t size, RooFit::Detail::DataMap const&) const override;
+  BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Analytic; }
+  void computeBatchDerivative(double* output, size_t nEvents, RooAbsArg const& server,
+                              RooFit::Detail::DataMap const&) const override;
 
   std::unique_ptr<RooArgSet> fillNormSetForServer(RooArgSet const& normSet, RooAbsArg const& server) const override;
 
@@ -100,6 +100,8 @@ public:
                std::function<double(int)> getBinScale = [](int){ return 1.0; } );
 
   void weights(double* output, RooSpan<double const> xVals, int intOrder, bool correctForBinSize, bool cdfBoundaries);
+  void weights(double* output, std::size_t nEvents, std::vector<RooSpan<double const>> const& coords,
+               bool correctForBinSize);
   /// Return weight of i-th bin. \see getIndex()
   double weight(std::size_t i) const { return _wgt[i]; }
   double weightFast(const RooArgSet& bin, int intOrder, bool correctForBinSize, bool cdfBoundaries);
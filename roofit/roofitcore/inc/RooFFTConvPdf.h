@@ -19,6 +19,9 @@
 #include "RooHistPdf.h"
 #include "TVirtualFFT.h"
 
+#include <complex>
+#include <vector>
+
 class RooRealVar;
 
 ///PDF for the numerical (FFT) convolution of two PDFs.
@@ -89,6 +92,18 @@ protected:
 
     std::unique_ptr<RooAbsBinning> histBinning;
     std::unique_ptr<RooAbsBinning> scanBinning;
+
+    // Transforms of the inputs of every slice, reused while the parameters of the input don't change
+    std::vector<std::vector<std::complex<double>>> spectrum1;
+    std::vector<std::vector<std::complex<double>>> spectrum2;
+    std::vector<double> paramValues1; ///< Parameter values of pdf1 at the last fill
+    std::vector<double> paramValues2; ///< Parameter values of pdf2 at the last fill
+    bool pdf1Changed = true;
+    bool pdf2Changed = true;
+    std::size_t currentSlice = 0;
+    Int_t scanN = 0;
+    Int_t scanN2 = 0;
+    Int_t binShift1 = 0;
   };
 
   friend class FFTCacheElem ;
@@ -0,0 +1,79 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2022, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef RooFit_Detail_CodegenContext_h
+#define RooFit_Detail_CodegenContext_h
+
+#include <RooFit/Detail/DataMap.h>
+
+#include <Math/Util.h>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+class RooFitDriver;
+}
+} // namespace ROOT
+
+namespace RooFit {
+namespace Detail {
+
+/// \class RooFit::Detail::CodegenContext
+/// Collects the C++ code of a kernel that computes a reducer node of the computation graph (e.g. a likelihood) with
+/// the code generation backend of the RooFitDriver, see RooFit::BatchMode(). The kernel computes all nodes that
+/// depend on the events in a single loop over the events, so the intermediate results stay in registers instead of
+/// being written to arrays of the size of the dataset.
+///
+/// Inside the loop, each node adds the expression for its result in the current event with addResult(), using the
+/// results of its servers which it gets with getResult(). The reducer node sums the terms that it adds with
+/// addToReduction() and converts the sum of all events to its final result with a finalizer. Inputs that don't depend
+/// on the events are passed to the kernel as scalars, either the results of the nodes computed by the driver or values
+/// computed by the node itself before each call of the kernel with addScalars().
+class CodegenContext {
+public:
+   /// Computes scalar inputs of the kernel before each call, given the results of the nodes computed by the driver.
+   using ScalarFunc = std::function<void(DataMap const &dataMap, double *out)>;
+   /// Computes the result of the reducer node from the sum of its terms over the events.
+   using Finalizer =
+      std::function<double(ROOT::Math::KahanSum<double> const &sum, std::size_t nEvents, DataMap const &dataMap)>;
+
+   std::string const &getResult(RooAbsArg const &arg) const;
+   bool isScalar(RooAbsArg const &arg) const;
+   void addResult(RooAbsArg const &arg, std::string const &expression);
+   std::vector<std::string> addScalars(std::size_t n, ScalarFunc func);
+   void addToReduction(std::string const &term);
+   void addValidityCheck(std::string const &condition);
+   void setFinalizer(Finalizer finalizer) { _finalizer = std::move(finalizer); }
+
+private:
+   friend class ROOT::Experimental::RooFitDriver;
+
+   void addColumn(RooAbsArg const &arg);
+   void addScalar(RooAbsArg const &arg);
+   std::string buildCode(std::string const &functionName) const;
+
+   std::map<DataKey, std::string> _results;
+   std::vector<RooAbsArg const *> _columns;
+   std::vector<std::pair<std::size_t, RooAbsArg const *>> _scalars; ///< Offsets in the scalars and the nodes
+   std::vector<std::pair<std::size_t, ScalarFunc>> _scalarFuncs; ///< Offsets in the scalars and functions filling them
+   std::size_t _nScalars = 0;
+   std::string _body;
+   std::vector<std::string> _terms;
+   Finalizer _finalizer;
+};
+
+} // namespace Detail
+} // namespace RooFit
+
+#endif
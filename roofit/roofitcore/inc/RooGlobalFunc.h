@@ -65,7 +65,7 @@ enum MPSplit { BulkPartition=0, Interleave=1, SimComponents=2, Hybrid=3 } ;
 
 /// For setting the batch mode flag with the BatchMode() command argument to
 /// RooAbsPdf::fitTo();
-enum class BatchModeOption { Off, Cpu, Cuda, Old };
+enum class BatchModeOption { Off, Cpu, Cuda, Old, CodeGen };
 
 /**
  * \defgroup CmdArgs RooFit command arguments
@@ -259,6 +259,7 @@ RooCmdArg GlobalObservablesTag(const char* tagName) ;
 RooCmdArg ExternalConstraints(const RooArgSet& constraintPdfs) ;
 RooCmdArg PrintEvalErrors(Int_t numErrors) ;
 RooCmdArg EvalErrorWall(bool flag) ;
+RooCmdArg AnalyticGradient(bool flag=true) ;
 RooCmdArg SumW2Error(bool flag) ;
 RooCmdArg AsymptoticError(bool flag) ;
 RooCmdArg CloneData(bool flag) ;
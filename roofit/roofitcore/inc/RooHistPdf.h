@@ -72,6 +72,10 @@ public:
                                      RooDataHist& dataHist,
                                      bool histFuncMode) ;
 
+  static bool computeBatchBinned(double* output, std::size_t nEvents, RooFit::Detail::DataMap const& dataMap,
+                                 RooArgSet const& histObsList, RooAbsCollection const& obsList,
+                                 RooDataHist& dataHist, bool correctForBinSize) ;
+
   Int_t getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* rangeName=nullptr) const override ;
   double analyticalIntegral(Int_t code, const char* rangeName=nullptr) const override ;
 
@@ -53,6 +53,7 @@ public:
       int nWorkers = getDefaultWorkers(); // RooAbsMinimizerFcn config that can only be set in ctor
       bool parallelGradient = false;      // RooAbsMinimizerFcn config that can only be set in ctor
       bool parallelLikelihood = false;    // RooAbsMinimizerFcn config that can only be set in ctor
+      bool useGradient = false;           // RooAbsMinimizerFcn config that can only be set in ctor
       int verbose = 0;                    // local config
       bool profile = false;               // local config
       std::string minimizerType = "";     // local config
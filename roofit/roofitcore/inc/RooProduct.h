@@ -81,6 +81,8 @@ protected:
   double calculate(const RooArgList& partIntList) const;
   double evaluate() const override;
   void computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const&) const override;
+  BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Numeric; }
+  bool translate(RooFit::Detail::CodegenContext& ctx) const override;
 
   const char* makeFPName(const char *pfx,const RooArgSet& terms) const ;
   ProdMap* groupProductTerms(const RooArgSet&) const;
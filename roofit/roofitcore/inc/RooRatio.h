@@ -51,6 +51,7 @@ protected:
   double evaluate() const override;
   void computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const&) const override;
   inline bool canComputeBatchWithCuda() const override { return true; }
+  BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Numeric; }
 
   RooRealProxy _numerator;
   RooRealProxy _denominator;
@@ -23,6 +23,8 @@
 #include "RooSetProxy.h"
 #include "RooListProxy.h"
 #include <list>
+#include <utility>
+#include <vector>
 
 class RooArgSet ;
 class TH1F ;
@@ -71,6 +73,11 @@ public:
 
   static Int_t getCacheAllNumeric() ;
 
+  static void setNumericMemoization(Int_t nEntries, double relTolerance=0.0) ;
+
+  static Int_t getNumericMemoizationSize() ;
+  static double getNumericMemoizationTolerance() ;
+
   std::list<double>* plotSamplingHint(RooAbsRealLValue& obs, double xlo, double xhi) const override {
     // Forward plot sampling hint of integrand
     return _function->plotSamplingHint(obs,xlo,xhi) ;
@@ -94,6 +101,9 @@ protected:
   //friend class RooAbsPdf ;
 
   bool initNumIntegrator() const;
+  void fillMemoKey(std::vector<double>& key) const;
+  const double* findMemoEntry(const std::vector<double>& key) const;
+  void addMemoEntry(std::vector<double>&& key, double value) const;
   void autoSelectDirtyMode() ;
 
   virtual double sum() const ;
@@ -102,6 +112,8 @@ protected:
 
   // Evaluation and validation implementation
   double evaluate() const override ;
+  // The default computeBatch() side-loads the values of the servers from the data map
+  BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Numeric; }
   bool isValidReal(double value, bool printError=false) const override ;
   bool servesExclusively(const RooAbsArg* server,const RooArgSet& exclLVBranches, const RooArgSet& allBranches) const ;
 
@@ -141,6 +153,11 @@ protected:
   bool _cacheNum = false;           ///< Cache integral if numeric
   static Int_t _cacheAllNDim ; ///<! Cache all integrals with given numeric dimension
 
+  mutable std::vector<std::pair<std::vector<double>,double>> _numMemo; ///<! Recent numeric results keyed by parameter values and ranges
+  mutable std::size_t _numMemoNext = 0; ///<! Next memo entry to be overwritten
+  static Int_t _numMemoSize ; ///<! Number of numeric results memoized per integral, 0 disables the memo
+  static double _numMemoTolerance ; ///<! Relative tolerance on the parameter values to reuse a memoized result
+
   ClassDefOverride(RooRealIntegral,3) // Real-valued function representing an integral over a RooAbsReal object
 };
 
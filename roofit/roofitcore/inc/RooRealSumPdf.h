@@ -37,6 +37,7 @@ public:
   bool checkObservables(const RooArgSet* nset) const override ;
 
   void computeBatch(cudaStream_t*, double* output, size_t size, RooFit::Detail::DataMap const&) const override;
+  BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Numeric; }
 
   bool forceAnalyticalInt(const RooAbsArg& arg) const override { return arg.isFundamental() ; }
   Int_t getAnalyticalIntegralWN(RooArgSet& allVars, RooArgSet& numVars, const RooArgSet* normSet, const char* rangeName=nullptr) const override ;
@@ -41,6 +41,9 @@ public:
   // Interactive running
   void run(Int_t nExperiments) ;
 
+  // Parallel running in forked processes
+  void runParallel(Int_t nExperiments, unsigned int nWorkers=0) ;
+
   // PROOF-based parallel running
   void runProof(Int_t nExperiments, const char* proofHost="", bool showGui=true) ;
   static void closeProof(Option_t *option = "s") ;
@@ -91,6 +91,11 @@ public:
   void recomputeSumWeight();
   /// @}
 
+  void setFloatPrecision(bool flag = true);
+  bool hasFloatPrecision() const;
+  static void setDefaultFloatPrecision(bool flag);
+  static bool defaultFloatPrecision();
+
 private:
   RooArgSet varsNoWeight(const RooArgSet& allVars, const char* wgtName);
   RooRealVar* weightVar(const RooArgSet& allVars, const char* wgtName);
@@ -210,7 +215,8 @@ public:
     }
 
     RealVector(const RealVector& other, RooAbsReal* real=nullptr) :
-      _vec(other._vec), _nativeReal(real?real:other._nativeReal), _real(real?real:other._real), _buf(other._buf), _nativeBuf(other._nativeBuf), _nset(nullptr) {
+      _vec(other._vec), _vecF(other._vecF), _float(other._float),
+      _nativeReal(real?real:other._nativeReal), _real(real?real:other._real), _buf(other._buf), _nativeBuf(other._nativeBuf), _nset(nullptr) {
       if (other._tracker) {
         _tracker = new RooChangeTracker(Form("track_%s",_nativeReal->GetName()),"tracker",other._tracker->parameters()) ;
       } else {
@@ -235,6 +241,9 @@ public:
       } else {
         _vec = other._vec;
       }
+      _vecF = other._vecF;
+      _float = other._float;
+      clearBatchBuffer();
 
       return *this;
     }
@@ -270,36 +279,71 @@ public:
       return _tracker->hasChanged(true) ;
     }
 
+    /// Store the values in single precision, which halves the memory of the column. The values are rounded to
+    /// float when they are filled, and converted back to double when they are loaded. For the BatchMode, a double
+    /// copy of the column is created when its values are requested with getRange(), and kept until the
+    /// column is modified.
+    void setFloatPrecision(bool flag) {
+      if (flag == _float) return;
+      if (flag) {
+        _vecF.assign(_vec.begin(), _vec.end());
+        std::vector<double>().swap(_vec);
+      } else {
+        _vec.assign(_vecF.begin(), _vecF.end());
+        std::vector<float>().swap(_vecF);
+      }
+      _float = flag;
+      clearBatchBuffer();
+    }
+
+    bool hasFloatPrecision() const { return _float; }
+
     void fill() {
-      _vec.push_back(*_buf);
+      if (_float) {
+        _vecF.push_back(*_buf);
+        clearBatchBuffer();
+      } else {
+        _vec.push_back(*_buf);
+      }
     }
 
     void write(Int_t i) {
-      assert(static_cast<std::size_t>(i) < _vec.size());
-      _vec[i] = *_buf ;
+      assert(static_cast<std::size_t>(i) < size());
+      if (_float) {
+        _vecF[i] = *_buf;
+        clearBatchBuffer();
+      } else {
+        _vec[i] = *_buf ;
+      }
     }
 
     void reset() {
       _vec.clear();
+      _vecF.clear();
+      clearBatchBuffer();
     }
 
     inline void load(std::size_t idx) const {
-      assert(idx < _vec.size());
-      *_buf = *(_vec.begin() + idx) ;
+      assert(idx < size());
+      *_buf = _float ? _vecF[idx] : _vec[idx];
       *_nativeBuf = *_buf ;
     }
 
     RooSpan<const double> getRange(std::size_t first, std::size_t last) const {
-      auto beg = std::min(_vec.cbegin() + first, _vec.cend());
-      auto end = std::min(_vec.cbegin() + last,  _vec.cend());
+      std::vector<double> const& vec = _float ? batchBuffer() : _vec;
+      auto beg = std::min(vec.cbegin() + first, vec.cend());
+      auto end = std::min(vec.cbegin() + last,  vec.cend());
 
       return RooSpan<const double>(beg, end);
     }
 
-    std::size_t size() const { return _vec.size() ; }
+    std::size_t size() const { return _float ? _vecF.size() : _vec.size() ; }
 
     void resize(Int_t siz) {
-      if (siz < Int_t(_vec.capacity()) / 2 && _vec.capacity() > (VECTOR_BUFFER_SIZE / sizeof(double))) {
+      if (_float) {
+        _vecF.resize(siz);
+        clearBatchBuffer();
+      } else if (siz < Int_t(_vec.capacity()) / 2 && _vec.capacity() > (VECTOR_BUFFER_SIZE / sizeof(double))) {
         // do an expensive copy, if we save at least a factor 2 in size
         std::vector<double> tmp;
         tmp.reserve(std::max(siz, Int_t(VECTOR_BUFFER_SIZE / sizeof(double))));
@@ -314,9 +358,11 @@ public:
     }
 
     void reserve(Int_t siz) {
-      _vec.reserve(siz);
+      if (_float) _vecF.reserve(siz);
+      else _vec.reserve(siz);
     }
 
+    /// The values in double precision. Only filled if hasFloatPrecision() is false.
     const std::vector<double>& data() const {
       return _vec;
     }
@@ -325,16 +371,28 @@ public:
 
   protected:
     std::vector<double> _vec;
+    std::vector<float> _vecF; ///< The values if they are stored in single precision
+    bool _float = false;      ///< Whether the values are stored in single precision
 
   private:
     friend class RooVectorDataStore ;
+
+    std::vector<double> const& batchBuffer() const {
+      if (_batchBuf.size() != _vecF.size()) _batchBuf.assign(_vecF.begin(), _vecF.end());
+      return _batchBuf;
+    }
+    void clearBatchBuffer() {
+      if (!_batchBuf.empty()) std::vector<double>().swap(_batchBuf);
+    }
+
+    mutable std::vector<double> _batchBuf; ///<! Double copy of the values in single precision for getRange()
     RooAbsReal* _nativeReal ; ///< Instance which our data belongs to. This is the variable in the dataset.
     RooAbsReal* _real ; ///< Instance where we should write data into when load() is called.
     double* _buf ; ///<!
     double* _nativeBuf ; ///<!
     RooChangeTracker* _tracker ;
     RooArgSet* _nset ; ///<!
-    ClassDef(RealVector,1) // STL-vector-based Data Storage class
+    ClassDef(RealVector,2) // STL-vector-based Data Storage class
   } ;
 
 
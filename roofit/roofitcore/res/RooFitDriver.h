@@ -36,6 +36,7 @@ namespace ROOT {
 namespace Experimental {
 
 struct NodeInfo;
+struct FusedKernel;
 
 class RooFitDriver {
 public:
@@ -57,6 +58,8 @@ public:
    ~RooFitDriver();
    std::vector<double> getValues();
    double getVal();
+   bool canComputeGradient() const;
+   void getGradient(RooArgList const &params, double *out);
    RooAbsReal &topNode() const;
 
    void print(std::ostream &os) const;
@@ -69,8 +72,12 @@ private:
    void markGPUNodes();
    void assignToGPU(NodeInfo &info);
    void computeCPUNode(const RooAbsArg *node, NodeInfo &info);
+   void computeCPUNodesInChunks(std::vector<NodeInfo *> &infos);
    void setOperMode(RooAbsArg *arg, RooAbsArg::OperMode opMode);
    void determineOutputSizes();
+   std::vector<bool> findParameterDependents() const;
+   void generateFusedKernels();
+   void computeFusedNode(NodeInfo &info);
 
    ///////////////////////////
    // Private member variables
@@ -96,6 +103,9 @@ private:
    std::stack<RooHelpers::ChangeOperModeRAII> _changeOperModeRAIIs;
 
    std::vector<std::unique_ptr<RooAbsData>> _splittedDataSets;
+
+   // kernels of the code generation backend, one per reducer node
+   std::vector<std::unique_ptr<FusedKernel>> _fusedKernels;
 };
 
 } // end namespace Experimental
@@ -46,6 +46,14 @@ public:
    inline RooAbsPdf *getPdf() const { return &*_pdf; }
    void computeBatch(cudaStream_t *, double *output, size_t nOut, RooFit::Detail::DataMap const &) const override;
    inline bool isReducerNode() const override { return true; }
+   // The expected number of events of the extended term is not computed in the graph
+   BatchDerivatives batchDerivatives() const override
+   {
+      return _isExtended ? BatchDerivatives::None : BatchDerivatives::Analytic;
+   }
+   void computeBatchDerivative(double *output, size_t nEvents, RooAbsArg const &server,
+                               RooFit::Detail::DataMap const &) const override;
+   bool translate(RooFit::Detail::CodegenContext &ctx) const override;
 
    RooArgSet prefixArgNames(std::string const &prefix);
 
@@ -57,6 +65,8 @@ private:
    double evaluate() const override { return _value; }
    void resetWeightVarNames();
    double getFinalValAfterOffsetting(ROOT::Math::KahanSum<double> &&result) const;
+   double finalizeUnbinned(ROOT::Math::KahanSum<double> result, std::size_t nEvents,
+                           RooFit::Detail::DataMap const &dataMap) const;
 
    RooTemplateProxy<RooAbsPdf> _pdf;
    RooArgSet _observables;
@@ -72,6 +82,8 @@ private:
    RooTemplateProxy<RooAbsReal> _weightSquaredVar;
    mutable std::vector<double> _binw;                  ///<!
    mutable std::vector<double> _logProbasBuffer;       ///<!
+   mutable std::vector<double> _binnedN;               ///<! Bin contents for which _lnGammaN was computed
+   mutable std::vector<double> _lnGammaN;              ///<! log(N!) of the bin contents, constant in a fit
    mutable ROOT::Math::KahanSum<double> _offset = 0.0; ///<! Offset as KahanSum to avoid loss of precision
 
 }; // end class RooNLLVar
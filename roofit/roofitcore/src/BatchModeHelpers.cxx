@@ -128,6 +128,10 @@ public:
       const_cast<RooAbsReal &>(_driver->topNode()).applyWeightSquared(flag);
    }
 
+   bool hasGradient() const override { return _driver->canComputeGradient(); }
+
+   void gradient(RooArgList const &params, double *out) const override { _driver->getGradient(params, out); }
+
    void printMultiline(std::ostream &os, Int_t /*contents*/, bool /*verbose*/ = false,
                        TString /*indent*/ = "") const override
    {
@@ -188,8 +192,11 @@ std::unique_ptr<RooAbsReal> RooFit::BatchModeHelpers::createNLL(std::unique_ptr<
       // Warning! This mutates "observables"
       nllTerms.addOwned(createSimultaneousNLL(*simPdf, observables, isExtended, rangeName, doOffset, splitRange));
    } else {
-      nllTerms.addOwned(
-         std::make_unique<RooNLLVarNew>("RooNLLVarNew", "RooNLLVarNew", finalPdf, observables, isExtended, doOffset));
+      // Like for the components of simultaneous pdfs, use the Poisson likelihood of the bins directly if requested
+      auto binnedInfo = RooHelpers::getBinnedL(finalPdf);
+      RooAbsPdf &nllPdf = binnedInfo.binnedPdf ? *binnedInfo.binnedPdf : finalPdf;
+      nllTerms.addOwned(std::make_unique<RooNLLVarNew>("RooNLLVarNew", "RooNLLVarNew", nllPdf, observables, isExtended,
+                                                       doOffset, 1, binnedInfo.isBinnedL));
    }
    if (constraints) {
       nllTerms.addOwned(std::move(constraints));
@@ -240,8 +247,8 @@ void RooFit::BatchModeHelpers::logArchitectureInfo(RooFit::BatchModeOption batch
    if (RooBatchCompute::dispatchCPU->architecture() == RooBatchCompute::Architecture::GENERIC) {
       log("using generic CPU library compiled with no vectorizations");
    } else {
-      log(std::string("using CPU computation library compiled with -m") +
-          RooBatchCompute::dispatchCPU->architectureName());
+      log("using CPU computation library compiled for the " + RooBatchCompute::dispatchCPU->architectureName() +
+          " instruction set");
    }
    if (batchMode == RooFit::BatchModeOption::Cuda) {
       log("using CUDA computation library");
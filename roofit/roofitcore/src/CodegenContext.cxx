@@ -0,0 +1,117 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2022, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooFit/Detail/CodegenContext.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace RooFit {
+namespace Detail {
+
+/// Returns the expression for the result of a node in the current event, which is either the name of a variable
+/// defined in the loop over the events, an element of a column of the dataset or a scalar input of the kernel.
+std::string const &CodegenContext::getResult(RooAbsArg const &arg) const
+{
+   auto found = _results.find(&arg);
+   if (found == _results.end()) {
+      throw std::runtime_error(std::string("CodegenContext::getResult(): the result of ") + arg.GetName() +
+                               " was not added to the kernel");
+   }
+   return found->second;
+}
+
+/// Whether the result of a node is the same for all events, i.e. a scalar input of the kernel.
+bool CodegenContext::isScalar(RooAbsArg const &arg) const
+{
+   return std::find_if(_scalars.begin(), _scalars.end(), [&](auto const &item) {
+             return item.second->namePtr() == arg.namePtr();
+          }) != _scalars.end();
+}
+
+/// Adds the result of a node in the current event, given as a C++ expression of the results of its servers.
+void CodegenContext::addResult(RooAbsArg const &arg, std::string const &expression)
+{
+   std::string name = "v" + std::to_string(_results.size());
+   _body += "      const double " + name + " = " + expression + ";\n";
+   _results[&arg] = std::move(name);
+}
+
+/// Adds `n` scalar inputs to the kernel, which are filled by `func` before each call of the kernel. Returns the
+/// expressions for these inputs.
+std::vector<std::string> CodegenContext::addScalars(std::size_t n, ScalarFunc func)
+{
+   std::vector<std::string> out;
+   for (std::size_t i = 0; i < n; ++i) {
+      out.emplace_back("scalars[" + std::to_string(_nScalars + i) + "]");
+   }
+   _scalarFuncs.emplace_back(_nScalars, std::move(func));
+   _nScalars += n;
+   return out;
+}
+
+/// Adds a term to the sum of the reducer node over the events.
+void CodegenContext::addToReduction(std::string const &term)
+{
+   _terms.emplace_back(term);
+}
+
+/// Adds a condition that has to be true for all events. If it isn't, the result of the kernel is discarded and the
+/// reducer node is computed by the CPU backend, which reports the evaluation errors.
+void CodegenContext::addValidityCheck(std::string const &condition)
+{
+   _body += "      if (!(" + condition + ")) return false;\n";
+}
+
+void CodegenContext::addColumn(RooAbsArg const &arg)
+{
+   _results[&arg] = "columns[" + std::to_string(_columns.size()) + "][i]";
+   _columns.emplace_back(&arg);
+}
+
+void CodegenContext::addScalar(RooAbsArg const &arg)
+{
+   _results[&arg] = "scalars[" + std::to_string(_nScalars) + "]";
+   _scalars.emplace_back(_nScalars, &arg);
+   ++_nScalars;
+}
+
+/// Returns the code of the kernel. The sum over the events is done with Kahan summation, with the same algorithm as
+/// ROOT::Math::KahanSum, and returned as the sum and the carry in `result`.
+std::string CodegenContext::buildCode(std::string const &functionName) const
+{
+   std::string terms;
+   for (std::string const &term : _terms) {
+      terms += (terms.empty() ? "" : " + ") + term;
+   }
+   return "#include <cmath>\n"
+          "#include <cstddef>\n\n"
+          "extern \"C\" bool " +
+          functionName +
+          "(double const *const *columns, double const *scalars, std::size_t nEvents, double *result)\n"
+          "{\n"
+          "   double sum = 0.;\n"
+          "   double carry = 0.;\n"
+          "   for (std::size_t i = 0; i < nEvents; ++i) {\n" +
+          _body + "      const double term = " + (terms.empty() ? "0." : terms) +
+          ";\n"
+          "      const double y = term - carry;\n"
+          "      const double t = sum + y;\n"
+          "      carry = (t - sum) - y;\n"
+          "      sum = t;\n"
+          "   }\n"
+          "   result[0] = sum;\n"
+          "   result[1] = carry;\n"
+          "   return true;\n"
+          "}\n";
+}
+
+} // namespace Detail
+} // namespace RooFit
@@ -442,6 +442,56 @@ void RooAbsMinimizerFcn::printEvalErrors() const
    ooccoutW(_context, Minimization) << msg.str() << endl;
 }
 
+/// Evaluate the function to be minimized given the parameters in `x`. If the evaluation fails and the error wall is
+/// enabled, a value larger than the largest value seen so far is returned to make the minimizer back out.
+double RooAbsMinimizerFcn::evaluateFunction(RooAbsReal &funct, const double *x) const
+{
+   // Set the parameter values for this iteration
+   for (unsigned index = 0; index < _nDim; index++) {
+      if (_logfile)
+         (*_logfile) << x[index] << " ";
+      SetPdfParamVal(index, x[index]);
+   }
+
+   // Calculate the function for these parameters
+   RooAbsReal::setHideOffset(false);
+   double fvalue = funct.getVal();
+   RooAbsReal::setHideOffset(true);
+
+   if (!std::isfinite(fvalue) || RooAbsReal::numEvalErrors() > 0 || fvalue > 1e30) {
+      printEvalErrors();
+      RooAbsReal::clearEvalErrorLog();
+      _numBadNLL++;
+
+      if (_doEvalErrorWall) {
+         const double badness = RooNaNPacker::unpackNaN(fvalue);
+         fvalue = (std::isfinite(_maxFCN) ? _maxFCN : 0.) + _recoverFromNaNStrength * badness;
+      }
+   } else {
+      if (_evalCounter > 0 && _evalCounter == _numBadNLL) {
+         // This is the first time we get a valid function value; while before, the
+         // function was always invalid. For invalid  cases, we returned values > 0.
+         // Now, we offset valid values such that they are < 0.
+         _funcOffset = -fvalue;
+      }
+      fvalue += _funcOffset;
+      _maxFCN = std::max(fvalue, _maxFCN);
+   }
+
+   // Optional logging
+   if (_logfile)
+      (*_logfile) << setprecision(15) << fvalue << setprecision(4) << endl;
+   if (isVerbose()) {
+      cout << "\nprevFCN" << (funct.isOffsetting() ? "-offset" : "") << " = " << setprecision(10) << fvalue
+           << setprecision(4) << "  ";
+      cout.flush();
+   }
+
+   finishDoEval();
+
+   return fvalue;
+}
+
 void RooAbsMinimizerFcn::finishDoEval() const
 {
 
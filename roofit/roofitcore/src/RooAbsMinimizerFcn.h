@@ -120,6 +120,8 @@ protected:
 
    void printEvalErrors() const;
 
+   double evaluateFunction(RooAbsReal &funct, const double *x) const;
+
    void finishDoEval() const;
 
    // members
@@ -31,6 +31,7 @@ implementations like RooAcceptReject and RooFoam
 #include "RooRealVar.h"
 #include "RooDataSet.h"
 #include "RooRandom.h"
+#include "RooVectorDataStore.h"
 #include "RooErrorHandler.h"
 
 #include "RooMsgService.h"
@@ -124,6 +125,8 @@ RooAbsNumGenerator::RooAbsNumGenerator(const RooAbsReal &func, const RooArgSet &
   cacheArgs.add(*_funcValStore);
   _cache= new RooDataSet("cache","Accept-Reject Event Cache",cacheArgs);
   assert(0 != _cache);
+  // the trial events are copied to the generated events, so they keep their full precision
+  if (auto vstore = dynamic_cast<RooVectorDataStore*>(_cache->store())) vstore->setFloatPrecision(false);
 
   // attach our function clone to the cache dataset
   const RooArgSet *cacheVars= _cache->get();
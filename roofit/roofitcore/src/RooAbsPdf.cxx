@@ -1388,6 +1388,9 @@ int RooAbsPdf::calcSumW2CorrectedCovariance(RooMinimizer &minimizer, RooAbsReal
 ///                                                          implemented for the PDFs of the model, likelihood computations are 2x to 10x faster.
 ///                                                          The relative difference of the single log-likelihoods w.r.t. the legacy mode is usually better than 1.E-12,
 ///                                                          and fit parameters usually agree to better than 1.E-6.
+///                                                          With `BatchMode("codegen")`, the likelihood is compiled into a single kernel that loops once over
+///                                                          the events. Models with nodes that don't support code generation fall back to `BatchMode("cpu")`.
+///                                                          The compiled kernels are kept in the directory `RooFit.CodeGen.CacheDir` of the `.rootrc` if set.
 /// <tr><td> `IntegrateBins(double precision)` <td> In binned fits, integrate the PDF over the bins instead of using the probability density at the bin centre.
 ///                                                 This can reduce the bias observed when fitting functions with high curvature to binned data.
 ///                                                 - precision > 0: Activate bin integration everywhere. Use precision between 0.01 and 1.E-6, depending on binning.
@@ -1420,6 +1423,10 @@ int RooAbsPdf::calcSumW2CorrectedCovariance(RooMinimizer &minimizer, RooAbsReal
 ///                                                  to force it out of that region. This can, however, mean that the fitter gets lost in this region. If
 ///                                                  this happens, try switching it off.
 /// <tr><td> `RecoverFromUndefinedRegions(double strength)` <td> When PDF is invalid (e.g. parameter in undefined region), try to direct minimiser away from that region.
+/// <tr><td> `AnalyticGradient(bool flag=true)` <td>  Pass the gradient of the likelihood to the minimizer instead of letting it compute the gradient
+///                                                  with finite differences. The gradient is propagated through the computation graph of the likelihood,
+///                                                  which is only supported with `BatchMode()` and if all function objects in the model that depend on
+///                                                  the parameters can compute their derivatives. Otherwise, this option is ignored.
 ///                                                              `strength` controls the magnitude of the penalty term. Leaving out this argument defaults to 10. Switch off with `strength = 0.`.
 ///
 /// <tr><td> `SumW2Error(bool flag)`         <td>  Apply correction to errors and covariance matrix.
@@ -1534,6 +1541,7 @@ std::unique_ptr<RooFitResult> RooAbsPdf::minimizeNLL(RooAbsReal & nll,
   RooMinimizer::Config minimizerConfig;
   minimizerConfig.parallelGradient = cfg.parallelGradient;
   minimizerConfig.parallelLikelihood = cfg.parallelLikelihood;
+  minimizerConfig.useGradient = cfg.useGradient;
   minimizerConfig.nWorkers = cfg.nWorkers;
   RooMinimizer m(nll, minimizerConfig);
 
@@ -1611,6 +1619,7 @@ RooFitResult* RooAbsPdf::fitTo(RooAbsData& data, const RooLinkedList& cmdList)
   pc.defineInt("minos","Minos",0,minimizerDefaults.minos) ;
   pc.defineInt("numee","PrintEvalErrors",0,minimizerDefaults.numee) ;
   pc.defineInt("doEEWall","EvalErrorWall",0,minimizerDefaults.doEEWall) ;
+  pc.defineInt("useGradient","AnalyticGradient",0,minimizerDefaults.useGradient) ;
   pc.defineInt("doWarn","Warnings",0,minimizerDefaults.doWarn) ;
   pc.defineInt("doSumW2","SumW2Error",0,minimizerDefaults.doSumW2) ;
   pc.defineInt("doAsymptoticError","AsymptoticError",0,minimizerDefaults.doAsymptotic) ;
@@ -1703,6 +1712,7 @@ RooFitResult* RooAbsPdf::fitTo(RooAbsData& data, const RooLinkedList& cmdList)
   cfg.minos = pc.getInt("minos");
   cfg.numee = pc.getInt("numee");
   cfg.doEEWall = pc.getInt("doEEWall");
+  cfg.useGradient = pc.getInt("useGradient");
   cfg.doWarn = pc.getInt("doWarn");
   cfg.doSumW2 = pc.getInt("doSumW2");
   cfg.doAsymptotic = pc.getInt("doAsymptoticError");
@@ -102,10 +102,13 @@
 #include <TSystem.h> // To print stack traces when caching errors are detected
 #endif
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <stdexcept>
 #include <sys/types.h>
 
 ClassImp(RooAbsReal)
@@ -4766,6 +4769,56 @@ void RooAbsReal::computeBatch(cudaStream_t*, double* output, size_t nEvents, Roo
 }
 
 
+/** Compute the derivatives of the output of computeBatch() with respect to a value server.
+\param output The array where the derivatives are stored. Element `i` is the derivative of the output of event `i`
+(or of the single output value) with respect to the value of the server for event `i` (or its single value).
+\param nEvents The larger of the number of outputs and the number of values of the server.
+\param server The server with respect to which the derivatives are computed.
+\param dataMap The inputs of computeBatch(), as for the computation of the value.
+
+The default implementation computes central finite differences, varying the values of the server in a copy of the
+data map, which is only correct if batchDerivatives() is BatchDerivatives::Numeric.
+**/
+void RooAbsReal::computeBatchDerivative(double* output, size_t nEvents, RooAbsArg const& server,
+                                        RooFit::Detail::DataMap const& dataMap) const {
+
+  const RooSpan<const double> values = dataMap.at(&server);
+  // the optimal step for central differences, relative to the value
+  const double relStep = std::cbrt(std::numeric_limits<double>::epsilon());
+
+  std::vector<double> steps(values.size());
+  std::vector<double> varied(values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    steps[i] = relStep * std::max(1., std::abs(values[i]));
+  }
+
+  RooFit::Detail::DataMap variedDataMap = dataMap;
+  variedDataMap.at(&server) = RooSpan<const double>(varied.data(), varied.size());
+
+  std::vector<double> up(nEvents);
+  std::vector<double> down(nEvents);
+  for (std::size_t i = 0; i < values.size(); ++i) varied[i] = values[i] + steps[i];
+  computeBatch(nullptr, up.data(), nEvents, variedDataMap);
+  for (std::size_t i = 0; i < values.size(); ++i) varied[i] = values[i] - steps[i];
+  computeBatch(nullptr, down.data(), nEvents, variedDataMap);
+
+  for (std::size_t i = 0; i < nEvents; ++i) {
+    output[i] = (up[i] - down[i]) / (2. * steps[values.size() > 1 ? i : 0]);
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the derivatives of this function with respect to the given
+/// parameters at their current values, for the functions where hasGradient()
+/// is `true`. The default implementation throws.
+
+void RooAbsReal::gradient(RooArgList const& /*params*/, double* /*out*/) const {
+  throw std::runtime_error(std::string("RooAbsReal::gradient(): ") + ClassName() +
+                           " doesn't implement the computation of the gradient");
+}
+
+
 
 
 double RooAbsReal::_DEBUG_getVal(const RooArgSet* normalisationSet) const {
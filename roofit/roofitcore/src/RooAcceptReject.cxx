@@ -24,6 +24,18 @@ the accept/reject sampling technique on any positively valued function.
 The RooAcceptReject generator is used by the various generator context
 classes to take care of generation of observables for which p.d.fs
 do not define internal methods
+
+The trial samples can also be evaluated in blocks with the BatchMode
+(see RooFit::BatchMode()), which is much faster for models of higher
+dimension that need many trial samples. This is enabled with the
+`batchSize` parameter of the configuration, and is used when the maximum
+of the function is determined by sampling (i.e. not for conditional
+observables):
+~~~ {.cpp}
+pdf.specialGeneratorConfig(true)->getConfigSection("RooAcceptReject").setRealValue("batchSize", 10000);
+~~~
+With the same random seed, the generated events are then different from
+the ones generated by evaluating the trial samples one by one.
 **/
 
 #include "Riostream.h"
@@ -41,8 +53,11 @@ do not define internal methods
 #include "RooRealBinding.h"
 #include "RooNumGenFactory.h"
 #include "RooNumGenConfig.h"
+#include "RooFitDriver.h"
 
+#include <algorithm>
 #include <assert.h>
+#include <cmath>
 
 using namespace std;
 
@@ -59,9 +74,10 @@ void RooAcceptReject::registerSampler(RooNumGenFactory& fact)
   RooRealVar nTrial1D("nTrial1D","Number of trial samples for 1-dim generation",1000,0,1e9) ;
   RooRealVar nTrial2D("nTrial2D","Number of trial samples for 2-dim generation",100000,0,1e9) ;
   RooRealVar nTrial3D("nTrial3D","Number of trial samples for N-dim generation",10000000,0,1e9) ;
+  RooRealVar batchSize("batchSize","Number of trial samples evaluated together in BatchMode (0 = one by one)",0,0,1e9) ;
 
   RooAcceptReject* proto = new RooAcceptReject ;
-  fact.storeProtoSampler(proto,RooArgSet(nTrial0D,nTrial1D,nTrial2D,nTrial3D)) ;
+  fact.storeProtoSampler(proto,RooArgSet(nTrial0D,nTrial1D,nTrial2D,nTrial3D,batchSize)) ;
 }
 
 
@@ -79,6 +95,7 @@ RooAcceptReject::RooAcceptReject(const RooAbsReal &func, const RooArgSet &genVar
   _minTrialsArray[1] = static_cast<Int_t>(config.getConfigSection("RooAcceptReject").getRealValue("nTrial1D")) ;
   _minTrialsArray[2] = static_cast<Int_t>(config.getConfigSection("RooAcceptReject").getRealValue("nTrial2D")) ;
   _minTrialsArray[3] = static_cast<Int_t>(config.getConfigSection("RooAcceptReject").getRealValue("nTrial3D")) ;
+  _batchSize = static_cast<UInt_t>(config.getConfigSection("RooAcceptReject").getRealValue("batchSize", 0.)) ;
 
   _realSampleDim = _realVars.getSize() ;
   _catSampleMult = 1 ;
@@ -143,6 +160,21 @@ RooAcceptReject::RooAcceptReject(const RooAbsReal &func, const RooArgSet &genVar
   _funcSum= 0;
   _totalEvents= 0;
   _eventsUsed= 0;
+
+  if (_batchSize > 0 && _isValid) {
+    RooArgSet proposalVars(_catVars);
+    proposalVars.add(_realVars);
+    _proposals = new RooDataSet("proposals","Accept-Reject Trial Samples",proposalVars);
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor
+
+RooAcceptReject::~RooAcceptReject()
+{
+  delete _proposals;
 }
 
 
@@ -164,7 +196,7 @@ const RooArgSet *RooAcceptReject::generateEvent(UInt_t remaining, double& resamp
     // maximum function value
 
     while(_totalEvents < _minTrials) {
-      addEventToCache();
+      addEventsToCache(_minTrials - _totalEvents);
 
       // Limit cache size to 1M events
       if (_cache->numEntries()>1000000) {
@@ -200,14 +232,10 @@ const RooArgSet *RooAcceptReject::generateEvent(UInt_t remaining, double& resamp
       Long64_t extra= 1 + (Long64_t)(1.05*remaining/eff);
       cxcoutD(Generation) << "RooAcceptReject::generateEvent: adding " << extra << " events to the cache, eff = " << eff << endl;
       double oldMax(_maxFuncVal);
-      while(extra--) {
-   addEventToCache();
-   if((_maxFuncVal > oldMax)) {
-     cxcoutD(Generation) << "RooAcceptReject::generateEvent: estimated function maximum increased from "
-               << oldMax << " to " << _maxFuncVal << endl;
-     oldMax = _maxFuncVal ;
-     // Trim cache here
-   }
+      addEventsToCache(extra);
+      if((_maxFuncVal > oldMax)) {
+   cxcoutD(Generation) << "RooAcceptReject::generateEvent: estimated function maximum increased from "
+             << oldMax << " to " << _maxFuncVal << endl;
       }
     }
 
@@ -298,6 +326,87 @@ void RooAcceptReject::addEventToCache()
 
 }
 
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the given number of trial events to our cache, one by one or in blocks
+/// of at most `batchSize` events that are evaluated together in BatchMode.
+
+void RooAcceptReject::addEventsToCache(Long64_t nEvents)
+{
+  if (_batchSize == 0) {
+    while(nEvents-- > 0) addEventToCache();
+    return;
+  }
+  while(nEvents > 0 && _batchSize > 0) {
+    std::size_t nBlock = std::min<Long64_t>(nEvents, _batchSize);
+    addEventBlockToCache(nBlock);
+    nEvents -= nBlock;
+  }
+  // the BatchMode values did not agree with the scalar values, continue one by one
+  while(nEvents-- > 0) addEventToCache();
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add a block of trial events to our cache, computing the function values of
+/// all of them together in BatchMode. On the first block, the values are
+/// compared with the scalar evaluation of the function, and if they don't
+/// agree the block is evaluated again one by one and BatchMode is disabled.
+
+void RooAcceptReject::addEventBlockToCache(std::size_t nEvents)
+{
+  _proposals->reset();
+  for(std::size_t i = 0; i < nEvents; ++i) {
+    for(auto * cat : static_range_cast<RooCategory*>(_catVars)) cat->randomize();
+    for(auto * real : static_range_cast<RooRealVar*>(_realVars)) real->randomize();
+    _proposals->add(RooArgSet(_catVars, _realVars));
+  }
+
+  std::vector<double> vals;
+  {
+    ROOT::Experimental::RooFitDriver driver(*_funcClone, RooArgSet{}, RooFit::BatchModeOption::Cpu);
+    driver.setData(*_proposals);
+    vals = driver.getValues();
+  }
+
+  if (!_batchValidated) {
+    _batchValidated = true;
+    for(std::size_t i = 0; i < std::min<std::size_t>(nEvents, 10); ++i) {
+      _realVars.assign(*_proposals->get(i));
+      _catVars.assign(*_proposals->get(i));
+      double val = _funcClone->getVal();
+      double batchVal = vals.size() == nEvents ? vals[i] : NAN;
+      if (!(std::abs(batchVal - val) <= 1e-6 * std::max(std::abs(val), 1e-300))) {
+        coutW(Generation) << "RooAcceptReject::addEventBlockToCache(" << _funcClone->GetName()
+                          << ") WARNING: function value in BatchMode (" << batchVal
+                          << ") differs from the scalar value (" << val
+                          << "), the trial samples are evaluated one by one" << endl;
+        _batchSize = 0;
+        vals.clear();
+        break;
+      }
+    }
+  }
+
+  for(std::size_t i = 0; i < nEvents; ++i) {
+    _realVars.assign(*_proposals->get(i));
+    _catVars.assign(*_proposals->get(i));
+
+    double val = vals.empty() ? _funcClone->getVal() : vals[i];
+    _funcValPtr->setVal(val);
+
+    if(val > _maxFuncVal) _maxFuncVal= 1.05*val;
+    _funcSum+= val;
+
+    _cache->fill();
+    _totalEvents++;
+  }
+
+  if (_verbose) {
+    cerr << "RooAcceptReject: generated " << _totalEvents << " events so far." << endl ;
+  }
+}
+
 double RooAcceptReject::getFuncMax()
 {
   // Empirically determine maximum value of function by taking a large number
@@ -306,7 +415,7 @@ double RooAcceptReject::getFuncMax()
 
   // Generate the minimum required number of samples for a reliable maximum estimate
   while(_totalEvents < _minTrials) {
-    addEventToCache();
+    addEventsToCache(_minTrials - _totalEvents);
 
     // Limit cache size to 1M events
     if (_cache->numEntries()>1000000) {
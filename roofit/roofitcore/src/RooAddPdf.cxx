@@ -68,6 +68,7 @@ An (enforced) condition for this assumption is that each \f$ \mathrm{PDF}_i \f$
 #include "RooAddHelpers.h"
 #include "RooAddGenContext.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodegenContext.h"
 #include "RooDataSet.h"
 #include "RooGlobalFunc.h"
 #include "RooRealProxy.h"
@@ -496,7 +497,6 @@ double RooAddPdf::getValV(const RooArgSet* normSet) const
 /// Compute addition of PDFs in batches.
 void RooAddPdf::computeBatch(cudaStream_t* stream, double* output, size_t nEvents, RooFit::Detail::DataMap const& dataMap) const
 {
-  _coefCache.resize(_pdfList.size());
   for(std::size_t i = 0; i < _coefList.size(); ++i) {
     auto coefVals = dataMap.at(&_coefList[i]);
     // We don't support per-event coefficients in this function. If the CPU
@@ -510,17 +510,11 @@ void RooAddPdf::computeBatch(cudaStream_t* stream, double* output, size_t nEvent
       RooAbsReal::computeBatch(stream, output, nEvents, dataMap);
       return;
     }
-    _coefCache[i] = coefVals[0];
   }
 
   RooBatchCompute::VarVector pdfs;
   RooBatchCompute::ArgVector coefs;
-  auto normAndCache = getNormAndCache(nullptr);
-  const RooArgSet* nset = normAndCache.first;
-  AddCacheElem* cache = normAndCache.second;
-  // We don't sync the coefficient values from the _coefList to the _coefCache
-  // because we have already done it using the dataMap.
-  updateCoefficients(*cache, nset, /*syncCoefValues=*/false);
+  AddCacheElem* cache = updateBatchCoefficients(dataMap);
 
   for (unsigned int pdfNo = 0; pdfNo < _pdfList.size(); ++pdfNo)
   {
@@ -536,6 +530,54 @@ void RooAddPdf::computeBatch(cudaStream_t* stream, double* output, size_t nEvent
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Update the coefficients from the scalar values of the coefficient
+/// functions in the data map, as used by computeBatch().
+
+AddCacheElem* RooAddPdf::updateBatchCoefficients(RooFit::Detail::DataMap const& dataMap) const
+{
+  _coefCache.resize(_pdfList.size());
+  for(std::size_t i = 0; i < _coefList.size(); ++i) {
+    _coefCache[i] = dataMap.at(&_coefList[i])[0];
+  }
+  auto normAndCache = getNormAndCache(nullptr);
+  AddCacheElem* cache = normAndCache.second;
+  // We don't sync the coefficient values from the _coefList to the _coefCache
+  // because we have already done it using the dataMap.
+  updateCoefficients(*cache, normAndCache.first, /*syncCoefValues=*/false);
+  return cache;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// The coefficients are computed before each call of the kernel of the code
+/// generation backend, the sum of the pdfs in the kernel.
+
+bool RooAddPdf::translate(RooFit::Detail::CodegenContext& ctx) const
+{
+  for(std::size_t i = 0; i < _coefList.size(); ++i) {
+    // per-event coefficients are not supported, like in computeBatch()
+    if(!ctx.isScalar(_coefList[i])) return false;
+  }
+
+  std::vector<std::string> coefs = ctx.addScalars(_pdfList.size(),
+      [this](RooFit::Detail::DataMap const& dataMap, double* out) {
+        AddCacheElem* cache = updateBatchCoefficients(dataMap);
+        for (unsigned int pdfNo = 0; pdfNo < _pdfList.size(); ++pdfNo) {
+          auto pdf = static_cast<RooAbsPdf*>(&_pdfList[pdfNo]);
+          out[pdfNo] = pdf->isSelectedComp() ? _coefCache[pdfNo] / cache->suppNormVal(pdfNo) : 0.;
+        }
+      });
+
+  std::string expression;
+  for (unsigned int pdfNo = 0; pdfNo < _pdfList.size(); ++pdfNo) {
+    expression += (expression.empty() ? "" : " + ") + coefs[pdfNo] + " * " + ctx.getResult(_pdfList[pdfNo]);
+  }
+  ctx.addResult(*this, "(" + expression + ")");
+  return true;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Reset error counter to given value, limiting the number
 /// of future error messages for this pdf to 'resetValue'
@@ -38,6 +38,7 @@ in the two sets.
 #include "RooChi2Var.h"
 #include "RooMsgService.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodegenContext.h"
 
 #include <algorithm>
 #include <cmath>
@@ -173,6 +174,27 @@ void RooAddition::computeBatch(cudaStream_t* stream, double* output, size_t nEve
   dispatch->compute(stream, RooBatchCompute::AddPdf, output, nEvents, pdfs, coefs);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the derivatives of the sum with respect to a term, i.e. the number
+/// of times the server appears in the sum.
+
+void RooAddition::computeBatchDerivative(double* output, size_t nEvents, RooAbsArg const& server,
+                                         RooFit::Detail::DataMap const&) const
+{
+  const double n = std::count(_set.begin(), _set.end(), &server);
+  std::fill(output, output + nEvents, n);
+}
+
+bool RooAddition::translate(RooFit::Detail::CodegenContext& ctx) const
+{
+  std::string expression;
+  for (const RooAbsArg* arg : _set) {
+    expression += (expression.empty() ? "" : " + ") + ctx.getResult(*arg);
+  }
+  ctx.addResult(*this, expression.empty() ? "0." : "(" + expression + ")");
+  return true;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the default error level for MINUIT error analysis
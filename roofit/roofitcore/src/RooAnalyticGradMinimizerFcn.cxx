@@ -0,0 +1,73 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2022, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+/// \class RooAnalyticGradMinimizerFcn
+/// Interface to the ROOT::Math::IMultiGradFunction for functions that compute their own gradient, see
+/// RooAbsReal::hasGradient(). Used by the RooMinimizer if RooMinimizer::Config::useGradient is set.
+
+#include "RooAnalyticGradMinimizerFcn.h"
+
+#include "RooAbsReal.h"
+#include "RooArgSet.h"
+
+#include <algorithm>
+
+namespace {
+
+RooArgSet getParameters(RooAbsReal const &funct)
+{
+   RooArgSet out;
+   funct.getParameters(nullptr, out);
+   return out;
+}
+
+} // namespace
+
+RooAnalyticGradMinimizerFcn::RooAnalyticGradMinimizerFcn(RooAbsReal *funct, RooMinimizer *context)
+   : RooAbsMinimizerFcn(getParameters(*funct), context), _funct(funct)
+{
+}
+
+RooAnalyticGradMinimizerFcn::RooAnalyticGradMinimizerFcn(const RooAnalyticGradMinimizerFcn &other)
+   : RooAbsMinimizerFcn(other), ROOT::Math::IMultiGradFunction(other), _funct(other._funct),
+     _gradParams(other._gradParams), _grad(other._grad)
+{
+}
+
+ROOT::Math::IBaseFunctionMultiDim *RooAnalyticGradMinimizerFcn::Clone() const
+{
+   return new RooAnalyticGradMinimizerFcn(*this);
+}
+
+/// Compute the gradient at `x`, unless it was already computed for these parameters.
+void RooAnalyticGradMinimizerFcn::updateGradient(const double *x) const
+{
+   if (_grad.size() == _nDim && std::equal(_gradParams.begin(), _gradParams.end(), x)) {
+      return;
+   }
+   for (unsigned int index = 0; index < _nDim; ++index) {
+      SetPdfParamVal(index, x[index]);
+   }
+   _gradParams.assign(x, x + _nDim);
+   _grad.resize(_nDim);
+   _funct->gradient(*_floatParamList, _grad.data());
+}
+
+void RooAnalyticGradMinimizerFcn::Gradient(const double *x, double *grad) const
+{
+   updateGradient(x);
+   std::copy(_grad.begin(), _grad.end(), grad);
+}
+
+double RooAnalyticGradMinimizerFcn::DoDerivative(const double *x, unsigned int icoord) const
+{
+   updateGradient(x);
+   return _grad[icoord];
+}
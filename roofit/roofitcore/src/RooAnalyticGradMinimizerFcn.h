@@ -0,0 +1,60 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2022, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef ROO_ANALYTIC_GRAD_MINIMIZER_FCN
+#define ROO_ANALYTIC_GRAD_MINIMIZER_FCN
+
+#include "RooAbsMinimizerFcn.h"
+
+#include "Math/IFunction.h" // IMultiGradFunction
+
+#include <vector>
+
+/// Function to be minimized that also provides its gradient, computed by the function itself with
+/// RooAbsReal::gradient(). Passing it to the fitter as a ROOT::Math::IMultiGradFunction makes Minuit2 use these
+/// gradients through its FCNGradientBase interface, instead of computing them with finite differences.
+class RooAnalyticGradMinimizerFcn : public RooAbsMinimizerFcn, public ROOT::Math::IMultiGradFunction {
+
+public:
+   RooAnalyticGradMinimizerFcn(RooAbsReal *funct, RooMinimizer *context);
+   RooAnalyticGradMinimizerFcn(const RooAnalyticGradMinimizerFcn &other);
+
+   ROOT::Math::IBaseFunctionMultiDim *Clone() const override;
+   unsigned int NDim() const override { return getNDim(); }
+
+   std::string getFunctionName() const override { return _funct->GetName(); }
+   std::string getFunctionTitle() const override { return _funct->GetTitle(); }
+
+   void setOffsetting(bool flag) override { _funct->enableOffsetting(flag); }
+   bool fit(ROOT::Fit::Fitter &fitter) const override
+   {
+      return fitter.FitFCN(static_cast<ROOT::Math::IMultiGradFunction const &>(*this));
+   }
+   ROOT::Math::IMultiGenFunction *getMultiGenFcn() override { return this; }
+
+   void Gradient(const double *x, double *grad) const override;
+
+private:
+   void setOptimizeConstOnFunction(RooAbsArg::ConstOpCode opcode, bool doAlsoTrackingOpt) override
+   {
+      _funct->constOptimizeTestStatistic(opcode, doAlsoTrackingOpt);
+   }
+
+   double DoEval(const double *x) const override { return evaluateFunction(*_funct, x); }
+   double DoDerivative(const double *x, unsigned int icoord) const override;
+   void updateGradient(const double *x) const;
+
+   RooAbsReal *_funct;
+   // cache of the last gradient, for the evaluation of single derivatives
+   mutable std::vector<double> _gradParams;
+   mutable std::vector<double> _grad;
+};
+
+#endif
@@ -100,6 +100,18 @@ void RooConstraintSum::computeBatch(cudaStream_t *, double *output, size_t /*siz
    output[0] = sum;
 }
 
+/// Compute the derivative of the sum of the negative logarithms of the constraints with respect to one of them.
+void RooConstraintSum::computeBatchDerivative(double *output, size_t /*size*/, RooAbsArg const &server,
+                                              RooFit::Detail::DataMap const &dataMap) const
+{
+   output[0] = 0.;
+   for (const auto comp : _set1) {
+      if (comp == &server) {
+         output[0] -= 1. / dataMap.at(comp)[0];
+      }
+   }
+}
+
 
 std::unique_ptr<RooArgSet> RooConstraintSum::fillNormSetForServer(RooArgSet const& /*normSet*/, RooAbsArg const& /*server*/) const {
   return std::make_unique<RooArgSet>(_paramSet);
@@ -1326,6 +1326,48 @@ void RooDataHist::weights(double* output, RooSpan<double const> xVals, int intOr
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// A vectorized version of RooDataHist::weight() without interpolation for
+/// histograms of any dimension. The bin indices of all events are computed
+/// one observable at a time with RooAbsBinning::binNumbers(), so the lookup
+/// involves no per-event virtual calls.
+/// \param[out] output An array of nEvents weights corresponding to the coordinates.
+/// \param[in] nEvents The number of events.
+/// \param[in] coords The values of the observables, aligned with the internal
+///                   histogram variables, which all need to be real-valued.
+///                   A span of size one is used for all events.
+/// \param[in] correctForBinSize Enable the inverse bin volume correction factor.
+
+void RooDataHist::weights(double* output, std::size_t nEvents, std::vector<RooSpan<double const>> const& coords,
+                          bool correctForBinSize)
+{
+  checkInit() ;
+
+  // Reuse the output buffer for bin indices and zero-initialize it
+  auto binIndices = reinterpret_cast<int*>(output + nEvents) - nEvents;
+  std::fill(binIndices, binIndices + nEvents, 0);
+
+  for (std::size_t iVar = 0; iVar < _vars.size(); ++iVar) {
+    assert(_lvbins[iVar]);
+    RooAbsBinning const& binning = *_lvbins[iVar];
+    RooSpan<double const> const& xVals = coords[iVar];
+    if (xVals.size() == 1) {
+      const int offset = _idxMult[iVar] * binning.binNumber(xVals[0]);
+      for (std::size_t i=0; i < nEvents; ++i) {
+        binIndices[i] += offset;
+      }
+    } else {
+      binning.binNumbers(xVals.data(), binIndices, nEvents, _idxMult[iVar]);
+    }
+  }
+
+  for (std::size_t i=0; i < nEvents; ++i) {
+    auto binIdx = binIndices[i];
+    output[i] = correctForBinSize ? _wgt[binIdx] / _binv[binIdx] : _wgt[binIdx];
+  }
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// A faster version of RooDataHist::weight that assumes the passed arguments
 /// are aligned with the histogram variables.
@@ -60,6 +60,9 @@
 /// which are also stored in the cache. Subsequent evaluations for different values of the convolution observable and
 /// identical parameters will be retrieved from the cache. If one or more
 /// of the parameters change, the cache will be updated, *i.e.*, a new FFT runs.
+/// Only the input PDFs whose parameters changed are sampled and transformed again,
+/// the transform of the other one is kept. When only the parameters of the physics
+/// model float in a fit, the resolution model is therefore transformed only once.
 ///
 /// The sampling density of the FFT is controlled by the binning of the
 /// the convolution observable, which can be changed using RooRealVar::setBins(N).
@@ -123,6 +126,8 @@
 #include "RooGlobalFunc.h"
 #include "RooConstVar.h"
 #include "RooUniformBinning.h"
+#include "RooAbsCategory.h"
+#include "RooAbsRealLValue.h"
 
 #include "TClass.h"
 #include "TComplex.h"
@@ -135,6 +140,56 @@ using namespace std;
 
 ClassImp(RooFFTConvPdf);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store the values of the parameters of `pdf`, i.e. of the leaves that are not
+/// observables of the cache histogram, in `values`. Returns true if they differ
+/// from the values stored before.
+
+bool updateParamValues(const RooAbsPdf& pdf, const RooArgSet& histObs, std::vector<double>& values)
+{
+  RooArgSet params ;
+  pdf.getParameters(&histObs, params) ;
+
+  std::vector<double> current ;
+  current.reserve(3*params.size()) ;
+  for (const auto arg : params) {
+    if (auto lvalue = dynamic_cast<const RooAbsRealLValue*>(arg)) {
+      current.push_back(lvalue->getVal()) ;
+      current.push_back(lvalue->getMin()) ;
+      current.push_back(lvalue->getMax()) ;
+    } else if (auto real = dynamic_cast<const RooAbsReal*>(arg)) {
+      current.push_back(real->getVal()) ;
+    } else if (auto cat = dynamic_cast<const RooAbsCategory*>(arg)) {
+      current.push_back(cat->getCurrentIndex()) ;
+    }
+  }
+
+  if (current == values) return false ;
+  values = std::move(current) ;
+  return true ;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Real->Complex transform of `input` with `fft`, the first half +1 of the
+/// complex output is stored in `spectrum`.
+
+void forwardTransform(TVirtualFFT& fft, std::vector<double>& input, Int_t N2, std::vector<std::complex<double>>& spectrum)
+{
+  fft.SetPoints(input.data()) ;
+  fft.Transform() ;
+
+  spectrum.resize(N2/2+1) ;
+  for (Int_t i=0 ; i<N2/2+1 ; i++) {
+    double re, im ;
+    fft.GetPointComplex(i,re,im) ;
+    spectrum[i] = {re, im} ;
+  }
+}
+
+} // namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor for numerical (FFT) convolution of PDFs.
@@ -408,9 +463,17 @@ RooArgList RooFFTConvPdf::FFTCacheElem::containedArgs(Action a)
 void RooFFTConvPdf::fillCacheObject(RooAbsCachedPdf::PdfCacheElem& cache) const
 {
   RooDataHist& cacheHist = *cache.hist() ;
+  auto& aux = static_cast<FFTCacheElem&>(cache) ;
+
+  aux.pdf1Clone->setOperMode(ADirty,true) ;
+  aux.pdf2Clone->setOperMode(ADirty,true) ;
 
-  ((FFTCacheElem&)cache).pdf1Clone->setOperMode(ADirty,true) ;
-  ((FFTCacheElem&)cache).pdf2Clone->setOperMode(ADirty,true) ;
+  // Only the inputs whose parameters changed since the last fill need to be
+  // sampled and transformed again, e.g. not the resolution model if only the
+  // parameters of the physics model are floating
+  aux.pdf1Changed = updateParamValues(*aux.pdf1Clone, *cacheHist.get(), aux.paramValues1) ;
+  aux.pdf2Changed = updateParamValues(*aux.pdf2Clone, *cacheHist.get(), aux.paramValues2) ;
+  aux.currentSlice = 0 ;
 
   // Determine if there other observables than the convolution observable in the cache
   RooArgSet otherObs ;
@@ -501,15 +564,34 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   //
   //
 
+  const std::size_t slice = aux.currentSlice++ ;
+  if (aux.spectrum1.size() <= slice) {
+    aux.spectrum1.resize(slice+1) ;
+    aux.spectrum2.resize(slice+1) ;
+  }
+  const bool scan1 = aux.pdf1Changed || aux.spectrum1[slice].empty() ;
+  const bool scan2 = aux.pdf2Changed || aux.spectrum2[slice].empty() ;
+
   Int_t N,N2,binShift1,binShift2 ;
 
   RooRealVar* histX = (RooRealVar*) cacheHist.get()->find(_x.arg().GetName()) ;
   if (_bufStrat==Extend) histX->setBinning(*aux.scanBinning) ;
-  std::vector<double> input1 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf1Clone,cacheHist,slicePos,N,N2,binShift1,_shift1) ;
-  std::vector<double> input2 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf2Clone,cacheHist,slicePos,N,N2,binShift2,_shift2) ;
+  std::vector<double> input1, input2 ;
+  if (scan1) {
+    input1 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf1Clone,cacheHist,slicePos,N,N2,binShift1,_shift1) ;
+    aux.binShift1 = binShift1 ;
+  }
+  if (scan2) {
+    input2 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf2Clone,cacheHist,slicePos,N,N2,binShift2,_shift2) ;
+  }
   if (_bufStrat==Extend) histX->setBinning(*aux.histBinning) ;
 
-
+  if (scan1 || scan2) {
+    aux.scanN = N ;
+    aux.scanN2 = N2 ;
+  }
+  N = aux.scanN ;
+  N2 = aux.scanN2 ;
 
 
   // Retrieve previously defined FFT transformation plans
@@ -524,20 +606,18 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
     }
   }
 
-  // Real->Complex FFT Transform on p.d.f. 1 sampling
-  aux.fftr2c1->SetPoints(input1.data());
-  aux.fftr2c1->Transform();
-
-  // Real->Complex FFT Transform on p.d.f 2 sampling
-  aux.fftr2c2->SetPoints(input2.data());
-  aux.fftr2c2->Transform();
+  // Real->Complex FFT Transform on p.d.f. 1 and p.d.f. 2 sampling, unless
+  // the transform of the previous fill is still valid
+  if (scan1) forwardTransform(*aux.fftr2c1, input1, N2, aux.spectrum1[slice]) ;
+  if (scan2) forwardTransform(*aux.fftr2c2, input2, N2, aux.spectrum2[slice]) ;
 
   // Loop over first half +1 of complex output results, multiply
   // and set as input of reverse transform
+  const auto& spectrum1 = aux.spectrum1[slice] ;
+  const auto& spectrum2 = aux.spectrum2[slice] ;
   for (Int_t i=0 ; i<N2/2+1 ; i++) {
-    double re1,re2,im1,im2 ;
-    aux.fftr2c1->GetPointComplex(i,re1,im1) ;
-    aux.fftr2c2->GetPointComplex(i,re2,im2) ;
+    const double re1 = spectrum1[i].real(), im1 = spectrum1[i].imag() ;
+    const double re2 = spectrum2[i].real(), im2 = spectrum2[i].imag() ;
     double re = re1*re2 - im1*im2 ;
     double im = re1*im2 + re2*im1 ;
     TComplex t(re,im) ;
@@ -547,7 +627,7 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   // Reverse Complex->Real FFT transform product
   aux.fftc2r->Transform() ;
 
-  Int_t totalShift = binShift1 + (N2-N)/2 ;
+  Int_t totalShift = aux.binShift1 + (N2-N)/2 ;
 
   // Store FFT result in cache
 
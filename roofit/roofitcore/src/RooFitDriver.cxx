@@ -44,11 +44,26 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 
 #include "NormalizationHelpers.h"
 
+#include <RooFit/Detail/CodegenContext.h>
+
+#include <Math/Util.h>
+#include <ROOT/TExecutor.hxx>
+#include <RVersion.h>
+#include <TEnv.h>
+#include <TInterpreter.h>
 #include <TList.h>
+#include <TMD5.h>
+#include <TSystem.h>
 
+#include <algorithm>
+#include <fstream>
+#include <functional>
 #include <iomanip>
+#include <mutex>
 #include <numeric>
+#include <stdexcept>
 #include <thread>
+#include <unordered_map>
 
 #define COUT_DEBUG ooccoutD(nullptr, FastEvaluations)
 
@@ -56,8 +71,74 @@ namespace {
 
 enum HeterogeneosIterations { CPUOnly = 2, GPUOnly = 1, Both = 3 };
 
+using FusedKernelFunc = bool (*)(double const *const *columns, double const *scalars, std::size_t nEvents,
+                                 double *result);
+
+/// Returns the function of a kernel of the code generation backend, given a function that returns its code for a
+/// function name. The functions are named after a hash of their code, and every kernel is jitted only once per
+/// process. If the `RooFit.CodeGen.CacheDir` resource is set, the kernels are also compiled with ACLiC into shared
+/// libraries in that directory, which later processes load instead of jitting the kernel. Returns `nullptr` if the
+/// kernel could not be compiled.
+FusedKernelFunc getFusedKernel(std::function<std::string(std::string const &)> const &makeCode)
+{
+   static std::mutex mutex;
+   static std::unordered_map<std::string, FusedKernelFunc> kernels;
+
+   TMD5 md5;
+   const std::string keySource = std::string(ROOT_RELEASE) + '\n' + gSystem->GetBuildCompilerVersion() + '\n' +
+                                 makeCode("kernel");
+   md5.Update(reinterpret_cast<const UChar_t *>(keySource.data()), keySource.size());
+   md5.Final();
+   const std::string name = std::string("roofitkernel_") + md5.AsString();
+
+   std::lock_guard<std::mutex> lock(mutex);
+   auto found = kernels.find(name);
+   if (found != kernels.end()) {
+      return found->second;
+   }
+   FusedKernelFunc &kernel = kernels[name];
+
+   TString dir = gEnv->GetValue("RooFit.CodeGen.CacheDir", "");
+   gSystem->ExpandPathName(dir);
+   const std::string libPath = std::string(dir.Data()) + "/" + name;
+   const std::string libFile = libPath + "." + gSystem->GetSoExt();
+   const std::string code = makeCode(name);
+
+   if (!dir.IsNull() && !gSystem->AccessPathName(libFile.c_str())) {
+      if (gSystem->Load(libFile.c_str()) >= 0) {
+         kernel = reinterpret_cast<FusedKernelFunc>(gSystem->DynFindSymbol(libFile.c_str(), name.c_str()));
+      }
+      if (kernel) {
+         return kernel;
+      }
+      oocoutW(nullptr, FastEvaluations) << "RooFitDriver: could not load the cached kernel " << libPath
+                                        << ", jitting it instead." << std::endl;
+   }
+
+   if (!gInterpreter->Declare(code.c_str())) {
+      return nullptr;
+   }
+   kernel = reinterpret_cast<FusedKernelFunc>(gInterpreter->Calc(("(long)&" + name).c_str()));
+
+   if (!dir.IsNull()) {
+      if (gSystem->AccessPathName(dir.Data()) && gSystem->mkdir(dir.Data(), /*recursive*/ true) != 0) {
+         oocoutW(nullptr, FastEvaluations) << "RooFitDriver: could not create the kernel cache directory " << dir
+                                           << "." << std::endl;
+         return kernel;
+      }
+      const std::string srcPath = libPath + ".C";
+      std::ofstream(srcPath) << code;
+      // compile only: this process already uses the jitted kernel
+      if (!gSystem->CompileMacro(srcPath.c_str(), "kOcs", libPath.c_str())) {
+         oocoutW(nullptr, FastEvaluations) << "RooFitDriver: the kernel " << srcPath << " could not be compiled."
+                                           << std::endl;
+      }
+   }
+   return kernel;
 }
 
+} // namespace
+
 namespace ROOT {
 namespace Experimental {
 
@@ -92,8 +173,12 @@ struct NodeInfo {
    bool isVariable = false;
    bool isDirty = true;
    bool isCategory = false;
+   bool computeInChunks = false;
+   bool isFused = false;               ///< Computed in the kernel of a reducer node by the code generation backend
+   FusedKernel *fusedKernel = nullptr; ///< The kernel that computes this reducer node
    std::size_t outputSize = 1;
    std::size_t lastSetValCount = std::numeric_limits<std::size_t>::max();
+   std::size_t nEvaluations = 0; ///< How many times the node was computed, see RooFitDriver::print()
    std::size_t originalDataToken = 0;
    double scalarBuffer = 0.0;
    std::vector<NodeInfo *> serverInfos;
@@ -110,6 +195,17 @@ struct NodeInfo {
    }
 };
 
+/// A kernel of the code generation backend, which computes a reducer node and all the nodes it depends on that
+/// depend on the events in a single loop over the events.
+struct FusedKernel {
+   RooFit::Detail::CodegenContext context;
+   FusedKernelFunc function = nullptr;
+   std::vector<NodeInfo *> nodes; ///< The nodes computed in the kernel except for the reducer, in topological order
+   std::vector<double const *> columns;
+   std::vector<double> scalars;
+   std::size_t nEvents = 0;
+};
+
 /// Construct a new RooFitDriver. The constructor analyzes and saves metadata about the graph,
 /// useful for the evaluation of it that will be done later. In case the CUDA mode is selected,
 /// there's also some CUDA-related initialization.
@@ -287,6 +383,22 @@ void RooFitDriver::setData(DataSpansMap const &dataSpans)
       }
    }
 
+   // Elementwise computations whose inputs are either scalar or as large as the output can be evaluated in chunks of
+   // the events: a chunk of the output only depends on the same chunk of the inputs.
+   for (auto &info : _nodes) {
+      info.computeInChunks = !info.isScalar && !info.fromDataset && !info.absArg->isReducerNode() &&
+                             info.absArg->canComputeBatchInChunks();
+      for (NodeInfo const *serverInfo : info.serverInfos) {
+         if (!serverInfo->isScalar && serverInfo->outputSize != info.outputSize) {
+            info.computeInChunks = false;
+         }
+      }
+   }
+
+   if (_batchMode == RooFit::BatchModeOption::CodeGen) {
+      generateFusedKernels();
+   }
+
    // Extra steps for initializing in cuda mode
    if (_batchMode != RooFit::BatchModeOption::Cuda)
       return;
@@ -345,6 +457,7 @@ void RooFitDriver::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
    auto nodeAbsReal = static_cast<RooAbsReal const *>(node);
 
    const std::size_t nOut = info.outputSize;
+   ++info.nEvaluations;
 
    if (nOut == 1) {
       _dataMapCPU.at(node) = RooSpan<const double>(&info.scalarBuffer, nOut);
@@ -377,6 +490,58 @@ void RooFitDriver::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
    }
 }
 
+/// Compute the given nodes in chunks of RooBatchCompute::minEventsPerTask events, which are distributed over the
+/// tasks of the implicit multithreading pool. Every task computes one chunk of all the nodes, in topological order.
+/// The list of nodes is cleared.
+void RooFitDriver::computeCPUNodesInChunks(std::vector<NodeInfo *> &infos)
+{
+   if (infos.empty())
+      return;
+
+   constexpr std::size_t chunkSize = RooBatchCompute::minEventsPerTask;
+
+   std::size_t nChunks = 0;
+   for (NodeInfo *info : infos) {
+      if (!info->buffer) {
+         info->buffer = _bufferManager.makeCpuBuffer(info->outputSize);
+      }
+      _dataMapCPU.at(info->absArg) = RooSpan<const double>(info->buffer->cpuWritePtr(), info->outputSize);
+      ++info->nEvaluations;
+      nChunks = std::max(nChunks, info->outputSize / chunkSize + (info->outputSize % chunkSize > 0));
+   }
+
+   auto computeChunk = [&](std::size_t iChunk) -> int {
+      const std::size_t begin = iChunk * chunkSize;
+      // The data map of this chunk points to the same chunk of the non-scalar inputs
+      RooFit::Detail::DataMap dataMap = _dataMapCPU;
+      for (NodeInfo *info : infos) {
+         if (begin >= info->outputSize)
+            continue;
+         const std::size_t nOut = std::min(chunkSize, info->outputSize - begin);
+         for (NodeInfo const *serverInfo : info->serverInfos) {
+            if (!serverInfo->isScalar) {
+               dataMap.at(serverInfo->absArg) =
+                  RooSpan<const double>(_dataMapCPU.at(serverInfo->absArg).data() + begin, nOut);
+            }
+         }
+         static_cast<RooAbsReal const *>(info->absArg)
+            ->computeBatch(nullptr, info->buffer->cpuWritePtr() + begin, nOut, dataMap);
+      }
+      return 0;
+   };
+
+   // The first chunk is computed in this thread, so that lazily evaluated state that the nodes rely on, like the
+   // values of coefficients that are read with getVal(), is up to date before the other chunks run concurrently.
+   computeChunk(0);
+   if (nChunks > 1) {
+      std::vector<std::size_t> indices(nChunks - 1);
+      std::iota(indices.begin(), indices.end(), 1);
+      ROOT::Internal::TExecutor ex;
+      ex.Map(computeChunk, indices);
+   }
+   infos.clear();
+}
+
 /// Returns the value of the top node in the computation graph
 double RooFitDriver::getVal()
 {
@@ -386,6 +551,17 @@ double RooFitDriver::getVal()
       return getValHeterogeneous();
    }
 
+   // With implicit multithreading, consecutive nodes that can be computed in chunks are collected and computed
+   // together. Scalar nodes don't depend on them and are computed right away, any other node needs their results.
+   const bool useChunks = ROOT::IsImplicitMTEnabled();
+   std::vector<NodeInfo *> chunkedNodes;
+
+   auto markClientsDirty = [](NodeInfo &info) {
+      for (NodeInfo *clientInfo : info.clientInfos) {
+         clientInfo->isDirty = true;
+      }
+   };
+
    for (auto &nodeInfo : _nodes) {
       RooAbsArg *node = nodeInfo.absArg;
       if (!nodeInfo.fromDataset) {
@@ -393,28 +569,291 @@ double RooFitDriver::getVal()
             auto *var = static_cast<RooRealVar const *>(node);
             if (nodeInfo.lastSetValCount != var->valueResetCounter()) {
                nodeInfo.lastSetValCount = var->valueResetCounter();
-               for (NodeInfo *clientInfo : nodeInfo.clientInfos) {
-                  clientInfo->isDirty = true;
-               }
+               markClientsDirty(nodeInfo);
                computeCPUNode(node, nodeInfo);
                nodeInfo.isDirty = false;
             }
          } else {
             if (nodeInfo.isDirty) {
-               for (NodeInfo *clientInfo : nodeInfo.clientInfos) {
-                  clientInfo->isDirty = true;
-               }
-               computeCPUNode(node, nodeInfo);
                nodeInfo.isDirty = false;
+               // The clients of a scalar node are only recomputed if its value changed, e.g. the likelihood of a
+               // channel whose normalization integral didn't change. Vector nodes always mark their clients dirty.
+               const double oldValue = nodeInfo.scalarBuffer;
+               const bool cutOff = nodeInfo.isScalar && nodeInfo.nEvaluations > 0;
+               if (nodeInfo.isFused) {
+                  // computed in the kernel of the reducer node
+               } else if (nodeInfo.fusedKernel) {
+                  computeFusedNode(nodeInfo);
+               } else if (useChunks && nodeInfo.computeInChunks) {
+                  chunkedNodes.push_back(&nodeInfo);
+               } else {
+                  if (!nodeInfo.isScalar || node->isReducerNode()) {
+                     computeCPUNodesInChunks(chunkedNodes);
+                  }
+                  computeCPUNode(node, nodeInfo);
+               }
+               if (!cutOff || nodeInfo.scalarBuffer != oldValue) {
+                  markClientsDirty(nodeInfo);
+               }
             }
          }
       }
    }
+   computeCPUNodesInChunks(chunkedNodes);
 
    // return the final value
    return _dataMapCPU.at(&topNode())[0];
 }
 
+/// Flag the nodes that depend on floating parameters.
+std::vector<bool> RooFitDriver::findParameterDependents() const
+{
+   std::vector<bool> dependsOnParams(_nodes.size(), false);
+   for (NodeInfo const &info : _nodes) {
+      if (info.fromDataset || info.isCategory) {
+         continue;
+      }
+      if (info.isVariable) {
+         dependsOnParams[info.iNode] = !info.absArg->isConstant();
+         continue;
+      }
+      for (NodeInfo const *serverInfo : info.serverInfos) {
+         if (dependsOnParams[serverInfo->iNode]) {
+            dependsOnParams[info.iNode] = true;
+            break;
+         }
+      }
+   }
+   return dependsOnParams;
+}
+
+/// Whether getGradient() can compute the derivatives of the top node, which requires every node that depends on
+/// floating parameters to provide its derivatives (see RooAbsReal::batchDerivatives()).
+bool RooFitDriver::canComputeGradient() const
+{
+   // the results of the nodes computed in kernels of the code generation backend are not stored
+   if (_batchMode == RooFit::BatchModeOption::Cuda || !_fusedKernels.empty() || _nodes.back().outputSize != 1) {
+      return false;
+   }
+   const std::vector<bool> dependsOnParams = findParameterDependents();
+   for (NodeInfo const &info : _nodes) {
+      if (dependsOnParams[info.iNode] && !info.isVariable &&
+          static_cast<RooAbsReal const *>(info.absArg)->batchDerivatives() == RooAbsReal::BatchDerivatives::None) {
+         return false;
+      }
+   }
+   return true;
+}
+
+/// Compute the derivatives of the top node with respect to the given parameters at their current values.
+/// The derivatives are propagated backwards through the computation graph (reverse-mode differentiation): each node
+/// adds its derivatives with respect to its servers, times the derivative of the top node with respect to itself,
+/// to the derivatives of the top node with respect to the servers. This costs about one evaluation of the graph,
+/// independent of the number of parameters.
+///
+/// \param[in] params The parameters that the derivatives are taken with respect to. Parameters that the top node
+///            doesn't depend on get a zero derivative.
+/// \param[out] out The derivatives, in the order of the parameters.
+void RooFitDriver::getGradient(RooArgList const &params, double *out)
+{
+   if (!canComputeGradient()) {
+      throw std::runtime_error("RooFitDriver::getGradient(): the computation graph of " +
+                               std::string(topNode().GetName()) + " doesn't support the computation of gradients");
+   }
+
+   // makes sure that the results of all nodes are up to date
+   getVal();
+
+   const std::vector<bool> dependsOnParams = findParameterDependents();
+
+   // The derivatives of the top node with respect to the results of each node
+   std::vector<std::vector<double>> adjoints(_nodes.size());
+   adjoints.back().assign(1, 1.0);
+   std::vector<double> derivatives;
+
+   for (std::size_t iNode = _nodes.size(); iNode-- > 0;) {
+      NodeInfo const &info = _nodes[iNode];
+      std::vector<double> const &adjoint = adjoints[iNode];
+      if (adjoint.empty() || info.isVariable) {
+         continue;
+      }
+      auto *node = static_cast<RooAbsReal const *>(info.absArg);
+      for (NodeInfo const *serverInfo : info.serverInfos) {
+         if (!dependsOnParams[serverInfo->iNode]) {
+            continue;
+         }
+         const std::size_t nServer = serverInfo->outputSize;
+         const std::size_t n = std::max(info.outputSize, nServer);
+         derivatives.resize(n);
+         node->computeBatchDerivative(derivatives.data(), n, *serverInfo->absArg, _dataMapCPU);
+
+         std::vector<double> &serverAdjoint = adjoints[serverInfo->iNode];
+         serverAdjoint.resize(nServer, 0.0);
+         for (std::size_t i = 0; i < n; ++i) {
+            serverAdjoint[nServer > 1 ? i : 0] += adjoint[info.outputSize > 1 ? i : 0] * derivatives[i];
+         }
+      }
+      // the derivatives with respect to this node are not needed anymore
+      std::vector<double>().swap(adjoints[iNode]);
+   }
+
+   std::unordered_map<TNamed const *, std::size_t> variableNodes;
+   for (NodeInfo const &info : _nodes) {
+      if (info.isVariable) {
+         variableNodes[info.absArg->namePtr()] = info.iNode;
+      }
+   }
+   for (std::size_t iParam = 0; iParam < params.size(); ++iParam) {
+      auto found = variableNodes.find(params[iParam].namePtr());
+      out[iParam] = found != variableNodes.end() && !adjoints[found->second].empty() ? adjoints[found->second][0] : 0.;
+   }
+}
+
+/// Generate the kernels of the code generation backend. Each reducer node gets a kernel that also computes all
+/// the nodes that it depends on that depend on the events, see RooFit::Detail::CodegenContext. If the graph contains
+/// nodes that don't support code generation, or nodes that depend on the events but are not the inputs of a reducer
+/// node, the CPU backend is used instead.
+void RooFitDriver::generateFusedKernels()
+{
+   _fusedKernels.clear();
+   for (NodeInfo &info : _nodes) {
+      info.isFused = false;
+      info.fusedKernel = nullptr;
+   }
+
+   auto isEventNode = [](NodeInfo const &info) { return !info.isScalar && !info.fromDataset; };
+
+   auto fallBack = [&](std::string const &reason) {
+      oocoutW(nullptr, FastEvaluations) << "RooFitDriver: " << reason << ", using the CPU backend instead of the "
+                                        << "code generation backend." << std::endl;
+      _fusedKernels.clear();
+      for (NodeInfo &info : _nodes) {
+         info.isFused = false;
+         info.fusedKernel = nullptr;
+      }
+   };
+
+   for (NodeInfo &reducer : _nodes) {
+      if (!reducer.absArg->isReducerNode()) {
+         continue;
+      }
+      // Find the nodes that depend on the events that the reducer depends on, going backwards through the
+      // topologically sorted nodes.
+      std::vector<bool> isInput(_nodes.size(), false);
+      isInput[reducer.iNode] = true;
+      for (std::size_t iNode = reducer.iNode + 1; iNode-- > 0;) {
+         if (!isInput[iNode]) {
+            continue;
+         }
+         for (NodeInfo const *serverInfo : _nodes[iNode].serverInfos) {
+            if (isEventNode(*serverInfo)) {
+               isInput[serverInfo->iNode] = true;
+            }
+         }
+      }
+
+      auto kernel = std::make_unique<FusedKernel>();
+      for (std::size_t iNode = 0; iNode < reducer.iNode; ++iNode) {
+         if (isInput[iNode]) {
+            kernel->nodes.emplace_back(&_nodes[iNode]);
+            kernel->nEvents = std::max(kernel->nEvents, _nodes[iNode].outputSize);
+         }
+      }
+      if (kernel->nodes.empty()) {
+         // the reducer only depends on scalars
+         continue;
+      }
+
+      RooFit::Detail::CodegenContext &ctx = kernel->context;
+      std::vector<NodeInfo *> nodes = kernel->nodes;
+      nodes.emplace_back(&reducer);
+
+      // The inputs from outside of the kernel: columns of the dataset and the results of the other nodes
+      std::vector<bool> isAdded(_nodes.size(), false);
+      for (NodeInfo const *info : nodes) {
+         for (NodeInfo const *serverInfo : info->serverInfos) {
+            if (isAdded[serverInfo->iNode] || isEventNode(*serverInfo)) {
+               continue;
+            }
+            isAdded[serverInfo->iNode] = true;
+            if (serverInfo->isScalar) {
+               ctx.addScalar(*serverInfo->absArg);
+            } else {
+               ctx.addColumn(*serverInfo->absArg);
+               kernel->columns.emplace_back(_dataMapCPU.at(serverInfo->absArg).data());
+            }
+         }
+      }
+
+      for (NodeInfo const *info : nodes) {
+         auto *node = dynamic_cast<RooAbsReal const *>(info->absArg);
+         if (!node || !node->translate(ctx)) {
+            fallBack(std::string("the node ") + info->absArg->GetName() + " of type " +
+                     info->absArg->ClassName() + " doesn't support code generation");
+            return;
+         }
+      }
+      if (!ctx._finalizer) {
+         fallBack(std::string("the reducer node ") + reducer.absArg->GetName() + " didn't set a finalizer");
+         return;
+      }
+
+      kernel->function = getFusedKernel([&ctx](std::string const &name) { return ctx.buildCode(name); });
+      if (!kernel->function) {
+         fallBack(std::string("the kernel for ") + reducer.absArg->GetName() + " could not be compiled");
+         return;
+      }
+      kernel->scalars.resize(ctx._nScalars);
+
+      for (NodeInfo *info : kernel->nodes) {
+         info->isFused = true;
+      }
+      reducer.fusedKernel = kernel.get();
+      _fusedKernels.emplace_back(std::move(kernel));
+   }
+
+   for (NodeInfo const &info : _nodes) {
+      if (isEventNode(info) && !info.isFused) {
+         fallBack(std::string("the node ") + info.absArg->GetName() + " depends on the events but is not an input " +
+                  "of a reducer node");
+         return;
+      }
+   }
+}
+
+/// Compute a reducer node with its kernel of the code generation backend. If some events have invalid values, the
+/// kernel discards its result, and the reducer and the nodes it depends on are computed by the CPU backend, which
+/// reports the evaluation errors.
+void RooFitDriver::computeFusedNode(NodeInfo &info)
+{
+   FusedKernel &kernel = *info.fusedKernel;
+   RooFit::Detail::CodegenContext const &ctx = kernel.context;
+
+   for (auto const &item : ctx._scalars) {
+      kernel.scalars[item.first] = _dataMapCPU.at(item.second)[0];
+   }
+   for (auto const &item : ctx._scalarFuncs) {
+      item.second(_dataMapCPU, kernel.scalars.data() + item.first);
+   }
+
+   double result[2];
+   if (kernel.function(kernel.columns.data(), kernel.scalars.data(), kernel.nEvents, result)) {
+      for (NodeInfo *nodeInfo : kernel.nodes) {
+         ++nodeInfo->nEvaluations;
+      }
+      ++info.nEvaluations;
+      ROOT::Math::KahanSum<double> sum{result[0], result[1]};
+      info.scalarBuffer = ctx._finalizer(sum, kernel.nEvents, _dataMapCPU);
+      _dataMapCPU.at(info.absArg) = RooSpan<const double>(&info.scalarBuffer, 1);
+      return;
+   }
+
+   for (NodeInfo *nodeInfo : kernel.nodes) {
+      computeCPUNode(nodeInfo->absArg, *nodeInfo);
+   }
+   computeCPUNode(info.absArg, info);
+}
+
 /// Returns the value of the top node in the computation graph
 double RooFitDriver::getValHeterogeneous()
 {
@@ -808,7 +1247,7 @@ void RooFitDriver::print(std::ostream &os) const
 {
    std::cout << "--- RooFit BatchMode evaluation ---\n";
 
-   std::vector<int> widths{9, 37, 20, 9, 10, 20};
+   std::vector<int> widths{9, 37, 20, 9, 10, 20, 11};
 
    auto printElement = [&](int iCol, auto const &t) {
       const char separator = ' ';
@@ -836,6 +1275,7 @@ void RooFitDriver::print(std::ostream &os) const
    printElement(3, "Size");
    printElement(4, "From Data");
    printElement(5, "1st value");
+   printElement(6, "Evaluations");
    std::cout << "\n";
 
    printHorizontalRow();
@@ -853,6 +1293,7 @@ void RooFitDriver::print(std::ostream &os) const
       printElement(3, nodeInfo.outputSize);
       printElement(4, nodeInfo.fromDataset);
       printElement(5, span[0]);
+      printElement(6, nodeInfo.nEvaluations);
 
       std::cout << "\n";
    }
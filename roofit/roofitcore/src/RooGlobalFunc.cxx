@@ -186,10 +186,11 @@ namespace RooFit {
       if(lower == "off") mode = BatchModeOption::Off;
       else if(lower == "cpu") mode = BatchModeOption::Cpu;
       else if(lower == "cuda") mode = BatchModeOption::Cuda;
+      else if(lower == "codegen") mode = BatchModeOption::CodeGen;
       else if(lower == "old") mode = BatchModeOption::Old;
       // Note that the "old" argument is undocumented, because accessing the
       // old batch mode is an advanced developer feature.
-      else throw std::runtime_error("Only supported string values for BatchMode() are \"off\", \"cpu\", or \"cuda\".");
+      else throw std::runtime_error("Only supported string values for BatchMode() are \"off\", \"cpu\", \"cuda\", or \"codegen\".");
       return RooCmdArg("BatchMode", static_cast<int>(mode));
   }
   /// Integrate the PDF over bins. Improves accuracy for binned fits. Switch off using `0.` as argument. \see RooAbsPdf::fitTo().
@@ -258,6 +259,7 @@ namespace RooFit {
   RooCmdArg ExternalConstraints(const RooArgSet& cpdfs)  { return RooCmdArg("ExternalConstraints",0,0,0,0,0,0,nullptr,nullptr,0,0,&cpdfs) ; }
   RooCmdArg PrintEvalErrors(Int_t numErrors)             { return RooCmdArg("PrintEvalErrors",numErrors,0,0,0,0,0,0,0) ; }
   RooCmdArg EvalErrorWall(bool flag)                   { return RooCmdArg("EvalErrorWall",flag,0,0,0,0,0,0,0) ; }
+  RooCmdArg AnalyticGradient(bool flag)                { return RooCmdArg("AnalyticGradient",flag,0,0,0,0,0,0,0) ; }
   RooCmdArg SumW2Error(bool flag)                      { return RooCmdArg("SumW2Error",flag,0,0,0,0,0,0,0) ; }
   RooCmdArg AsymptoticError(bool flag)                      { return RooCmdArg("AsymptoticError",flag,0,0,0,0,0,0,0) ; }
   RooCmdArg CloneData(bool flag)                       { return RooCmdArg("CloneData",flag,0,0,0,0,0,0,0) ; }
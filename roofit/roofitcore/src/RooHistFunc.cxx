@@ -201,7 +201,12 @@ void RooHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, RooFi
     _dataHist->weights(output, xVals, _intOrder, false, _cdfBoundaries);
     return;
   }
-  
+
+  if (_intOrder == 0 &&
+      RooHistPdf::computeBatchBinned(output, size, dataMap, _histObsList, _depList, *_dataHist, false)) {
+    return;
+  }
+
   std::vector<RooSpan<const double>> inputValues;
   for (const auto& obs : _depList) {
     auto realObs = dynamic_cast<const RooAbsReal*>(obs);
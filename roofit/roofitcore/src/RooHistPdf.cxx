@@ -190,14 +190,54 @@ RooHistPdf::~RooHistPdf()
 
 void RooHistPdf::computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const& dataMap) const {
 
-  // For interpolation and histograms of higher dimension, use base function
-  if(_pdfObsList.size() > 1) {
-      RooAbsReal::computeBatch(nullptr, output, nEvents, dataMap);
-      return;
+  if(_pdfObsList.size() == 1) {
+    auto xVals = dataMap.at(_pdfObsList[0]);
+    _dataHist->weights(output, xVals, _intOrder, !_unitNorm, _cdfBoundaries);
+    return;
   }
 
-  auto xVals = dataMap.at(_pdfObsList[0]);
-  _dataHist->weights(output, xVals, _intOrder, true, _cdfBoundaries);
+  // For interpolation and histograms with category observables, use base function
+  if(_intOrder != 0 ||
+     !computeBatchBinned(output, nEvents, dataMap, _histObsList, _pdfObsList, *_dataHist, !_unitNorm)) {
+    RooAbsReal::computeBatch(nullptr, output, nEvents, dataMap);
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Batch evaluation of a histogram of any dimension without interpolation,
+/// shared by RooHistPdf and RooHistFunc. Like in the scalar evaluation, the
+/// result is zero for events where an observable is outside of the range of
+/// the histogram observable it is mapped onto.
+/// \return False if the histogram has category observables, which are not
+///         supported. In that case, the output is not filled.
+
+bool RooHistPdf::computeBatchBinned(double* output, std::size_t nEvents, RooFit::Detail::DataMap const& dataMap,
+                                    RooArgSet const& histObsList, RooAbsCollection const& obsList,
+                                    RooDataHist& dataHist, bool correctForBinSize)
+{
+  std::vector<RooSpan<const double>> coords;
+  for (std::size_t i = 0; i < histObsList.size(); ++i) {
+    if (!dynamic_cast<RooAbsRealLValue*>(histObsList[i]) || !dynamic_cast<RooAbsReal*>(obsList[i])) {
+      return false;
+    }
+    coords.push_back(dataMap.at(obsList[i]));
+  }
+
+  dataHist.weights(output, nEvents, coords, correctForBinSize);
+
+  for (std::size_t iVar = 0; iVar < histObsList.size(); ++iVar) {
+    if (histObsList[iVar] == obsList[iVar]) continue;
+    auto const& histObs = static_cast<RooAbsRealLValue const&>(*histObsList[iVar]);
+    RooSpan<const double> const& xVals = coords[iVar];
+    for (std::size_t i = 0; i < nEvents; ++i) {
+      if (!histObs.inRange(xVals.size() == 1 ? xVals[0] : xVals[i], nullptr)) {
+        output[i] = 0.;
+      }
+    }
+  }
+
+  return true;
 }
 
 
@@ -51,6 +51,7 @@ automatic PDF optimization.
 #include "RooPlot.h"
 #include "RooMinimizerFcn.h"
 #include "RooGradMinimizerFcn.h"
+#include "RooAnalyticGradMinimizerFcn.h"
 #include "RooFitResult.h"
 #include "TestStatistics/MinuitFcnGrad.h"
 #include "RooFit/TestStatistics/RooAbsL.h"
@@ -134,6 +135,8 @@ RooMinimizer::RooMinimizer(RooAbsReal &function, Config const &cfg) : _cfg(cfg)
 
       if (_cfg.parallelGradient) // Old test statistic with parallel gradient
          _fcn = std::make_unique<RooGradMinimizerFcn>(&function, this);
+      else if (_cfg.useGradient && function.hasGradient()) // Function that computes its own gradient
+         _fcn = std::make_unique<RooAnalyticGradMinimizerFcn>(&function, this);
       else // Old test statistic non parallel
          _fcn = std::make_unique<RooMinimizerFcn>(&function, this);
    }
@@ -26,7 +26,6 @@
 #include "RooRealVar.h"
 #include "RooMsgService.h"
 #include "RooMinimizer.h"
-#include "RooNaNPacker.h"
 
 #include "TMatrixDSym.h"
 
@@ -76,50 +75,7 @@ void RooMinimizerFcn::setOptimizeConstOnFunction(RooAbsArg::ConstOpCode opcode,
 
 /// Evaluate function given the parameters in `x`.
 double RooMinimizerFcn::DoEval(const double *x) const {
-
-  // Set the parameter values for this iteration
-  for (unsigned index = 0; index < _nDim; index++) {
-    if (_logfile) (*_logfile) << x[index] << " " ;
-    SetPdfParamVal(index,x[index]);
-  }
-
-  // Calculate the function for these parameters
-  RooAbsReal::setHideOffset(false) ;
-  double fvalue = _funct->getVal();
-  RooAbsReal::setHideOffset(true) ;
-
-  if (!std::isfinite(fvalue) || RooAbsReal::numEvalErrors() > 0 || fvalue > 1e30) {
-    printEvalErrors();
-    RooAbsReal::clearEvalErrorLog() ;
-    _numBadNLL++ ;
-
-    if (_doEvalErrorWall) {
-      const double badness = RooNaNPacker::unpackNaN(fvalue);
-      fvalue = (std::isfinite(_maxFCN) ? _maxFCN : 0.) + _recoverFromNaNStrength * badness;
-    }
-  } else {
-    if (_evalCounter > 0 && _evalCounter == _numBadNLL) {
-      // This is the first time we get a valid function value; while before, the
-      // function was always invalid. For invalid  cases, we returned values > 0.
-      // Now, we offset valid values such that they are < 0.
-      _funcOffset = -fvalue;
-    }
-    fvalue += _funcOffset;
-    _maxFCN = std::max(fvalue, _maxFCN);
-  }
-
-  // Optional logging
-  if (_logfile)
-    (*_logfile) << setprecision(15) << fvalue << setprecision(4) << endl;
-  if (isVerbose()) {
-    cout << "\nprevFCN" << (_funct->isOffsetting()?"-offset":"") << " = " << setprecision(10)
-         << fvalue << setprecision(4) << "  " ;
-    cout.flush() ;
-  }
-
-  finishDoEval();
-
-  return fvalue;
+  return evaluateFunction(*_funct, x);
 }
 
 std::string RooMinimizerFcn::getFunctionName() const
@@ -25,18 +25,22 @@ functions from `RooBatchCompute` library to provide faster computation times.
 #include <RooNLLVarNew.h>
 
 #include <RooAddition.h>
+#include <RooBatchCompute.h>
 #include <RooFormulaVar.h>
 #include <RooNaNPacker.h>
 #include <RooRealVar.h>
 #include <RooFit/Detail/Buffers.h>
+#include <RooFit/Detail/CodegenContext.h>
 
 #include <ROOT/StringUtils.hxx>
+#include <ROOT/TExecutor.hxx>
 
 #include <TClass.h>
 #include <TMath.h>
 #include <Math/Util.h>
 #include <TMath.h>
 
+#include <algorithm>
 #include <numeric>
 #include <stdexcept>
 #include <vector>
@@ -137,6 +141,15 @@ void RooNLLVarNew::computeBatch(cudaStream_t * /*stream*/, double *output, size_
       ROOT::Math::KahanSum<double> sumWeightKahanSum{0.0};
       auto preds = dataMap.at(&*_pdf);
 
+      // The log(N!) terms only depend on the data, so they are recomputed only when the bin contents change
+      if (_binnedN.size() != nEvents || !std::equal(_binnedN.begin(), _binnedN.end(), weightSpan.data())) {
+         _binnedN.assign(weightSpan.data(), weightSpan.data() + nEvents);
+         _lnGammaN.resize(nEvents);
+         for (std::size_t i = 0; i < nEvents; ++i) {
+            _lnGammaN[i] = TMath::LnGamma(_binnedN[i] + 1);
+         }
+      }
+
       for (std::size_t i = 0; i < nEvents; ++i) {
 
          double eventWeight = weightSpan[i];
@@ -157,7 +170,7 @@ void RooNLLVarNew::computeBatch(cudaStream_t * /*stream*/, double *output, size_
 
          } else {
 
-            result += -1 * (-mu + N * log(mu) - TMath::LnGamma(N + 1));
+            result += -1 * (-mu + N * log(mu) - _lnGammaN[i]);
             sumWeightKahanSum += eventWeight;
          }
       }
@@ -175,28 +188,68 @@ void RooNLLVarNew::computeBatch(cudaStream_t * /*stream*/, double *output, size_
 
    auto probas = dataMap.at(_pdf);
 
-   _logProbasBuffer.resize(nEvents);
-   (*_pdf).getLogProbabilities(probas, _logProbasBuffer.data());
-
-   _sumWeight = weights.size() == 1 ? weights[0] * nEvents : kahanSum(weights);
-
-   if (_isExtended && _weightSquared && _sumWeight2 == 0.0) {
-      _sumWeight2 = weights.size() == 1 ? weightsSumW2[0] * nEvents : kahanSum(weightsSumW2);
+   // The events are summed in chunks of fixed size, which are processed in parallel if implicit multithreading is
+   // enabled. The sums of the chunks are added up in order, so the result doesn't depend on the number of threads.
+   constexpr std::size_t chunkSize = RooBatchCompute::minEventsPerTask;
+   const std::size_t nChunks = nEvents / chunkSize + (nEvents % chunkSize > 0);
+   std::vector<ROOT::Math::KahanSum<double>> chunkSums(nChunks);
+
+   // Returns 1 if the chunk contains probabilities for which getLog() reports evaluation errors or warnings, which
+   // is not thread safe: these chunks are summed afterwards in this thread.
+   auto sumChunk = [&](std::size_t iChunk) -> int {
+      const std::size_t end = std::min((iChunk + 1) * chunkSize, nEvents);
+      ROOT::Math::KahanSum<double> sum;
+      for (std::size_t i = iChunk * chunkSize; i < end; ++i) {
+         if (!(probas[i] > 0. && probas[i] <= 1e6))
+            return 1;
+
+         double eventWeight = weightSpan.size() > 1 ? weightSpan[i] : weightSpan[0];
+         if (0. == eventWeight * eventWeight)
+            continue;
+
+         sum.Add(-eventWeight * std::log(probas[i]));
+      }
+      chunkSums[iChunk] = sum;
+      return 0;
+   };
+
+   std::vector<int> sumInThisThread;
+   if (nChunks > 1) {
+      std::vector<std::size_t> indices(nChunks);
+      std::iota(indices.begin(), indices.end(), 0);
+      ROOT::Internal::TExecutor ex;
+      sumInThisThread = ex.Map(sumChunk, indices);
+   } else {
+      for (std::size_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+         sumInThisThread.push_back(sumChunk(iChunk));
+      }
    }
 
    ROOT::Math::KahanSum<double> kahanProb;
    RooNaNPacker packedNaN(0.f);
 
-   for (std::size_t i = 0; i < nEvents; ++i) {
+   for (std::size_t iChunk = 0; iChunk < nChunks; ++iChunk) {
+      if (sumInThisThread[iChunk]) {
+         const std::size_t begin = iChunk * chunkSize;
+         const std::size_t n = std::min(chunkSize, nEvents - begin);
+         _logProbasBuffer.resize(n);
+         (*_pdf).getLogProbabilities(RooSpan<const double>(probas.data() + begin, n), _logProbasBuffer.data());
 
-      double eventWeight = weightSpan.size() > 1 ? weightSpan[i] : weightSpan[0];
-      if (0. == eventWeight * eventWeight)
-         continue;
+         ROOT::Math::KahanSum<double> sum;
+         for (std::size_t i = 0; i < n; ++i) {
+
+            double eventWeight = weightSpan.size() > 1 ? weightSpan[begin + i] : weightSpan[0];
+            if (0. == eventWeight * eventWeight)
+               continue;
 
-      const double term = -eventWeight * _logProbasBuffer[i];
+            const double term = -eventWeight * _logProbasBuffer[i];
 
-      kahanProb.Add(term);
-      packedNaN.accumulate(term);
+            sum.Add(term);
+            packedNaN.accumulate(term);
+         }
+         chunkSums[iChunk] = sum;
+      }
+      kahanProb += chunkSums[iChunk];
    }
 
    if (packedNaN.getPayload() != 0.) {
@@ -204,19 +257,88 @@ void RooNLLVarNew::computeBatch(cudaStream_t * /*stream*/, double *output, size_
       kahanProb = packedNaN.getNaNWithPayload();
    }
 
+   output[0] = finalizeUnbinned(std::move(kahanProb), nEvents, dataMap);
+}
+
+/// Add the terms of the unbinned likelihood that don't depend on the single events to the sum of the event terms.
+double RooNLLVarNew::finalizeUnbinned(ROOT::Math::KahanSum<double> result, std::size_t nEvents,
+                                      RooFit::Detail::DataMap const &dataMap) const
+{
+   auto weights = dataMap.at(_weightVar);
+   auto weightsSumW2 = dataMap.at(_weightSquaredVar);
+
+   _sumWeight = weights.size() == 1 ? weights[0] * nEvents : kahanSum(weights);
+
+   if (_isExtended && _weightSquared && _sumWeight2 == 0.0) {
+      _sumWeight2 = weights.size() == 1 ? weightsSumW2[0] * nEvents : kahanSum(weightsSumW2);
+   }
+
    if (_isExtended) {
       assert(_sumWeight != 0.0);
       double expected = _pdf->expectedEvents(&_observables);
-      kahanProb += _pdf->extendedTerm(_sumWeight, expected, _weightSquared ? _sumWeight2 : 0.0);
+      result += _pdf->extendedTerm(_sumWeight, expected, _weightSquared ? _sumWeight2 : 0.0);
    }
 
    // If part of simultaneous PDF normalize probability over
    // number of simultaneous PDFs: -sum(log(p/n)) = -sum(log(p)) + N*log(n)
    if (_simCount > 1) {
-      kahanProb += _sumWeight * std::log(static_cast<double>(_simCount));
+      result += _sumWeight * std::log(static_cast<double>(_simCount));
+   }
+
+   return getFinalValAfterOffsetting(std::move(result));
+}
+
+/// Compute the derivatives of the likelihood with respect to the pdf value of every event, or the predicted density
+/// of every bin in the binned case. The offset and the terms for simultaneous fits don't depend on them.
+void RooNLLVarNew::computeBatchDerivative(double *output, size_t nEvents, RooAbsArg const &server,
+                                          RooFit::Detail::DataMap const &dataMap) const
+{
+   std::fill(output, output + nEvents, 0.);
+   if (&server != &_pdf.arg())
+      return;
+
+   auto weights = dataMap.at(_weightVar);
+   auto weightsSumW2 = dataMap.at(_weightSquaredVar);
+   auto weightSpan = _weightSquared ? weightsSumW2 : weights;
+   auto probas = dataMap.at(_pdf);
+
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      if (_binnedL) {
+         // Derivative of mu - N * log(mu) for the bins that contribute to the likelihood
+         const double N = weightSpan[i];
+         const double mu = probas[i] * _binw[i];
+         if ((mu > 0 || N <= 0) && !(std::abs(mu) < 1e-10 && std::abs(N) < 1e-10)) {
+            output[i] = _binw[i] * (1. - N / mu);
+         }
+         continue;
+      }
+      const double eventWeight = weightSpan.size() > 1 ? weightSpan[i] : weightSpan[0];
+      if (0. != eventWeight * eventWeight) {
+         output[i] = -eventWeight / probas[i];
+      }
+   }
+}
+
+bool RooNLLVarNew::translate(RooFit::Detail::CodegenContext &ctx) const
+{
+   // The bin widths of binned likelihoods are not passed to the kernel
+   if (_binnedL) {
+      return false;
    }
 
-   output[0] = getFinalValAfterOffsetting(std::move(kahanProb));
+   // The weights can be switched with applyWeightSquared() after the kernel was generated
+   const std::string weightSquared = ctx.addScalars(1, [this](RooFit::Detail::DataMap const &, double *out) {
+      out[0] = _weightSquared;
+   })[0];
+   const std::string weight = "(" + weightSquared + " != 0. ? " + ctx.getResult(_weightSquaredVar.arg()) + " : " +
+                              ctx.getResult(_weightVar.arg()) + ")";
+   const std::string &proba = ctx.getResult(_pdf.arg());
+
+   ctx.addValidityCheck(proba + " > 0. && " + proba + " <= 1e6");
+   ctx.addToReduction("(" + weight + " * " + weight + " == 0. ? 0. : -" + weight + " * std::log(" + proba + "))");
+   ctx.setFinalizer([this](ROOT::Math::KahanSum<double> const &sum, std::size_t nEvents,
+                           RooFit::Detail::DataMap const &dataMap) { return finalizeUnbinned(sum, nEvents, dataMap); });
+   return true;
 }
 
 void RooNLLVarNew::getParametersHook(const RooArgSet * /*nset*/, RooArgSet *params, bool /*stripDisconnected*/) const
@@ -12,6 +12,10 @@
 
 #include "RooNormalizedPdf.h"
 
+#include <RooFit/Detail/CodegenContext.h>
+
+#include <mutex>
+
 /**
  * \class RooNormalizedPdf
  *
@@ -19,6 +23,47 @@
  * normalization set into a new self-normalized pdf.
  */
 
+namespace {
+
+/// The RooFitDriver can compute different chunks of the events concurrently. The evaluation errors that are logged for
+/// invalid values are not thread safe, so the rare values that are not simply divided by the integral are normalized
+/// one thread at a time.
+std::mutex normalizationErrorMutex;
+
+} // namespace
+
+double RooNormalizedPdf::normalize(double rawVal, double normVal) const
+{
+   if (rawVal >= 0. && normVal > 0.)
+      return rawVal / normVal;
+   std::lock_guard<std::mutex> lock(normalizationErrorMutex);
+   return normalizeWithNaNPacking(rawVal, normVal);
+}
+
+/// Compute the derivatives of the normalized pdf with respect to the unnormalized pdf or the integral.
+void RooNormalizedPdf::computeBatchDerivative(double *output, size_t nEvents, RooAbsArg const &server,
+                                              RooFit::Detail::DataMap const &dataMap) const
+{
+   auto nums = dataMap.at(_pdf);
+   auto integralSpan = dataMap.at(_normIntegral);
+   const double wrtPdf = &server == &_pdf.arg() ? 1. : 0.;
+   const double wrtIntegral = &server == &_normIntegral.arg() ? 1. : 0.;
+
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      const double num = nums[nums.size() > 1 ? i : 0];
+      const double integral = integralSpan[integralSpan.size() > 1 ? i : 0];
+      output[i] = (wrtPdf - wrtIntegral * num / integral) / integral;
+   }
+}
+
+bool RooNormalizedPdf::translate(RooFit::Detail::CodegenContext &ctx) const
+{
+   // Invalid values are caught by the validity checks of the likelihood, which is then computed by the CPU backend
+   // to report the evaluation errors.
+   ctx.addResult(*this, ctx.getResult(_pdf.arg()) + " / " + ctx.getResult(_normIntegral.arg()));
+   return true;
+}
+
 void RooNormalizedPdf::computeBatch(cudaStream_t * /*stream*/, double *output, size_t nEvents,
                                     RooFit::Detail::DataMap const& dataMap) const
 {
@@ -27,12 +72,12 @@ void RooNormalizedPdf::computeBatch(cudaStream_t * /*stream*/, double *output, s
 
    if (integralSpan.size() == 1) {
       for (std::size_t i = 0; i < nEvents; ++i) {
-         output[i] = normalizeWithNaNPacking(nums[i], integralSpan[0]);
+         output[i] = normalize(nums[i], integralSpan[0]);
       }
    } else {
       assert(integralSpan.size() == nEvents);
       for (std::size_t i = 0; i < nEvents; ++i) {
-         output[i] = normalizeWithNaNPacking(nums[i], integralSpan[i]);
+         output[i] = normalize(nums[i], integralSpan[i]);
       }
    }
 }
@@ -60,6 +60,11 @@ public:
 
 protected:
    void computeBatch(cudaStream_t *, double *output, size_t size, RooFit::Detail::DataMap const &) const override;
+   bool canComputeBatchInChunks() const override { return true; }
+   BatchDerivatives batchDerivatives() const override { return BatchDerivatives::Analytic; }
+   void computeBatchDerivative(double *output, size_t nEvents, RooAbsArg const &server,
+                               RooFit::Detail::DataMap const &) const override;
+   bool translate(RooFit::Detail::CodegenContext &ctx) const override;
    double evaluate() const override
    {
       // Evaluate() should not be called in the BatchMode, but we still need it
@@ -72,6 +77,8 @@ protected:
    };
 
 private:
+   double normalize(double rawVal, double normVal) const;
+
    RooRealProxy _pdf;
    RooRealProxy _normIntegral;
    RooArgSet const &_normSet;
@@ -44,6 +44,7 @@ have to appear in any specific place in the list.
 #include "RooProdPdf.h"
 #include "RooBatchCompute.h"
 #include "RooRealProxy.h"
+#include "RooFit/Detail/CodegenContext.h"
 #include "RooProdGenContext.h"
 #include "RooGenProdProj.h"
 #include "RooProduct.h"
@@ -448,6 +449,42 @@ void RooProdPdf::computeBatch(cudaStream_t* stream, double* output, size_t nEven
   dispatch->compute(stream, RooBatchCompute::ProdPdf, output, nEvents, pdfs, special);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the derivatives of the product with respect to a factor, i.e. the
+/// product of the other factors.
+
+void RooProdPdf::computeBatchDerivative(double* output, size_t nEvents, RooAbsArg const& server,
+                                        RooFit::Detail::DataMap const& dataMap) const
+{
+  std::vector<RooSpan<const double>> factors;
+  factors.reserve(_pdfList.size());
+  for (const RooAbsArg* i:_pdfList) {
+    factors.push_back(dataMap.at(i));
+  }
+  std::fill(output, output + nEvents, 0.);
+  // The server can be more than one of the factors
+  for (std::size_t j = 0; j < factors.size(); ++j) {
+    if (&_pdfList[j] != &server) continue;
+    for (std::size_t i = 0; i < nEvents; ++i) {
+      double prod = 1.;
+      for (std::size_t k = 0; k < factors.size(); ++k) {
+        if (k != j) prod *= factors[k][factors[k].size() > 1 ? i : 0];
+      }
+      output[i] += prod;
+    }
+  }
+}
+
+bool RooProdPdf::translate(RooFit::Detail::CodegenContext& ctx) const
+{
+  std::string expression;
+  for (const RooAbsArg* factor : _pdfList) {
+    expression += (expression.empty() ? "" : " * ") + ctx.getResult(*factor);
+  }
+  ctx.addResult(*this, expression.empty() ? "1." : expression);
+  return true;
+}
+
 namespace {
 
 template<class T>
@@ -30,6 +30,7 @@ A RooProduct represents the product of a given set of RooAbsReal objects.
 #include "RooAbsCategory.h"
 #include "RooMsgService.h"
 #include "RooTrace.h"
+#include "RooFit/Detail/CodegenContext.h"
 
 #include <cmath>
 #include <memory>
@@ -401,6 +402,19 @@ void RooProduct::computeBatch(cudaStream_t* /*stream*/, double* output, size_t n
   }
 }
 
+bool RooProduct::translate(RooFit::Detail::CodegenContext& ctx) const
+{
+  // The indices of the categories are not known to the kernel
+  if (!_compCSet.empty()) return false;
+
+  std::string expression;
+  for (const auto item : _compRSet) {
+    expression += (expression.empty() ? "" : " * ") + ctx.getResult(*item);
+  }
+  ctx.addResult(*this, expression.empty() ? "1." : expression);
+  return true;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Forward the plot sampling hint from the p.d.f. that defines the observable obs
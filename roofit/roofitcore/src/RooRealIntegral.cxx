@@ -49,6 +49,8 @@ integration is performed in the various implementations of the RooAbsIntegrator
 
 #include "TClass.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <memory>
 
@@ -223,6 +225,8 @@ using namespace std;
 
 
 Int_t RooRealIntegral::_cacheAllNDim(2) ;
+Int_t RooRealIntegral::_numMemoSize(0) ;
+double RooRealIntegral::_numMemoTolerance(0.0) ;
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -856,6 +860,19 @@ double RooRealIntegral::evaluate() const
 
   case Hybrid:
     {
+      // Reuse a numeric result for parameter values seen recently. This is only
+      // done when all components are selected, as the integrand value depends
+      // on the component selection otherwise.
+      std::vector<double> memoKey;
+      const bool useMemo = _numMemoSize > 0 && (_globalSelectComp || !_respectCompSelect);
+      if (useMemo) {
+        fillMemoKey(memoKey);
+        if (const double* memoVal = findMemoEntry(memoKey)) {
+          retVal = *memoVal ;
+          break ;
+        }
+      }
+
       // Cache numeric integrals in >1d expensive object cache
       RooDouble* cacheVal(0) ;
       if ((_cacheNum && !_intList.empty()) || _intList.getSize()>=_cacheAllNDim) {
@@ -903,6 +920,8 @@ double RooRealIntegral::evaluate() const
         }
 
       }
+
+      if (useMemo) addMemoEntry(std::move(memoKey), retVal) ;
       break ;
     }
   case Analytic:
@@ -1050,6 +1069,10 @@ bool RooRealIntegral::redirectServersHook(const RooAbsCollection& newServerList,
   // Delete parameters cache if we have one
   _params.reset();
 
+  // The memoized results are keyed by the values of the old servers
+  _numMemo.clear();
+  _numMemoNext = 0;
+
   return RooAbsReal::redirectServersHook(newServerList, mustReplaceAll, nameChange, isRecursive);
 }
 
@@ -1172,6 +1195,108 @@ Int_t RooRealIntegral::getCacheAllNumeric()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Global switch to memoize the results of numeric integrations. Each integral
+/// keeps the last `nEntries` results together with the values of its parameters
+/// and the bounds of its numerically integrated observables, and returns a
+/// memoized result instead of integrating again if all of them are equal
+/// within the relative tolerance `relTolerance`. This avoids repeating the
+/// integration when a minimizer comes back to parameter values it has already
+/// visited, e.g. when computing the numeric gradient, which is where most of
+/// the time goes when fitting conditional pdfs or numeric convolutions.
+/// A non-zero tolerance trades precision for speed, as the result for the
+/// nearby parameter values is returned. `nEntries=0` (default) disables it.
+
+void RooRealIntegral::setNumericMemoization(Int_t nEntries, double relTolerance) {
+  _numMemoSize = nEntries > 0 ? nEntries : 0 ;
+  _numMemoTolerance = relTolerance > 0. ? relTolerance : 0. ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of numeric integration results memoized per integral.
+
+Int_t RooRealIntegral::getNumericMemoizationSize()
+{
+  return _numMemoSize ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the relative tolerance to reuse a memoized numeric integration result.
+
+double RooRealIntegral::getNumericMemoizationTolerance()
+{
+  return _numMemoTolerance ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the key identifying a numeric integration result: the values of the
+/// parameters of the integral and the bounds of the observables it depends on
+/// through their shape, like the integrated observables.
+
+void RooRealIntegral::fillMemoKey(std::vector<double>& key) const
+{
+  key.clear() ;
+  for (const auto arg : parameters()) {
+    if (auto real = dynamic_cast<const RooAbsReal*>(arg)) {
+      key.push_back(real->getVal()) ;
+    } else if (auto cat = dynamic_cast<const RooAbsCategory*>(arg)) {
+      key.push_back(cat->getCurrentIndex()) ;
+    }
+  }
+  for (const auto server : _serverList) {
+    auto var = dynamic_cast<const RooAbsRealLValue*>(server) ;
+    if (!var || !server->isShapeServer(*this)) continue ;
+    key.push_back(var->getMin()) ;
+    key.push_back(var->getMax()) ;
+    if (_rangeName) {
+      key.push_back(var->getMin(RooNameReg::str(_rangeName))) ;
+      key.push_back(var->getMax(RooNameReg::str(_rangeName))) ;
+    }
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the memoized numeric result for the given key, or nullptr if there is none.
+
+const double* RooRealIntegral::findMemoEntry(const std::vector<double>& key) const
+{
+  for (const auto& entry : _numMemo) {
+    if (entry.first.size() != key.size()) continue ;
+    bool match = true ;
+    for (std::size_t i = 0; i < key.size() && match; ++i) {
+      const double a = entry.first[i] ;
+      const double b = key[i] ;
+      match = a == b || std::abs(a - b) <= _numMemoTolerance * std::max(std::abs(a), std::abs(b)) ;
+    }
+    if (match) return &entry.second ;
+  }
+  return nullptr ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Memoize a numeric result, replacing the oldest entry if the memo is full.
+
+void RooRealIntegral::addMemoEntry(std::vector<double>&& key, double value) const
+{
+  const std::size_t size = _numMemoSize ;
+  if (_numMemo.size() > size) {
+    _numMemo.resize(size) ;
+    _numMemoNext = 0 ;
+  }
+  if (_numMemo.size() < size) {
+    _numMemo.emplace_back(std::move(key), value) ;
+    return ;
+  }
+  if (_numMemoNext >= size) _numMemoNext = 0 ;
+  _numMemo[_numMemoNext++] = {std::move(key), value} ;
+}
+
+
 std::unique_ptr<RooArgSet> RooRealIntegral::fillNormSetForServer(RooArgSet const& /*normSet*/,
                                                                  RooAbsArg const& /*server*/) const {
   return _funcNormSet ? std::make_unique<RooArgSet>(*_funcNormSet) : nullptr;
@@ -33,6 +33,7 @@ repeated applications of generate-and-fit operations on a workspace
 #include "RooDataSet.h"
 #include "RooMsgService.h"
 #include "RooStudyPackage.h"
+#include "RooRandom.h"
 #include "TFile.h"
 #include "TObjString.h"
 #include "TRegexp.h"
@@ -40,6 +41,14 @@ repeated applications of generate-and-fit operations on a workspace
 #include <string>
 #include "TROOT.h"
 #include "TSystem.h"
+#include "TMath.h"
+#include "ROOT/RConfig.hxx"
+
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <algorithm>
 
 using namespace std ;
 
@@ -95,6 +104,56 @@ void RooStudyManager::run(Int_t nExperiments)
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the experiments in parallel in forked processes. Unlike with runProof(),
+/// the workspace and the studies are not streamed to the workers: the forked
+/// processes share them with this process. Every experiment uses its own random
+/// seed, drawn from RooRandom::randomGenerator() before forking, so the results
+/// don't depend on how the experiments are distributed over the processes.
+/// \param[in] nExperiments Number of experiments.
+/// \param[in] nWorkers Number of processes. Zero means one per CPU core.
+
+void RooStudyManager::runParallel(Int_t nExperiments, unsigned int nWorkers)
+{
+#ifdef R__WIN32
+  coutW(Generation) << "RooStudyManager::runParallel(" << GetName() << ") running in forked processes is not supported on Windows, running sequentially" << endl ;
+  run(nExperiments) ;
+#else
+  if (nExperiments <= 0) return ;
+
+  std::vector<UInt_t> seeds(nExperiments) ;
+  for (auto& seed : seeds) {
+    seed = RooRandom::randomGenerator()->Integer(TMath::Limits<UInt_t>::Max()) ;
+  }
+
+  ROOT::TProcessExecutor pool(nWorkers) ;
+  const unsigned int nProcesses = std::min(pool.GetPoolSize(), static_cast<unsigned int>(nExperiments)) ;
+
+  coutP(Generation) << "RooStudyManager::runParallel(" << GetName() << ") running " << nExperiments
+                    << " experiments in " << nProcesses << " processes" << endl ;
+
+  auto runWorker = [&](unsigned int iWorker) {
+    _pkg->initialize() ;
+    for (Int_t i = iWorker ; i < nExperiments ; i += nProcesses) {
+      RooRandom::randomGenerator()->SetSeed(seeds[i]) ;
+      gRandom->SetSeed(seeds[i]) ;
+      _pkg->runOne() ;
+    }
+    auto olist = new TList ;
+    _pkg->exportData(olist, iWorker) ;
+    return olist ;
+  } ;
+
+  // Aggregate results data
+  for (TList* olist : pool.Map(runWorker, ROOT::TSeqU(nProcesses))) {
+    aggregateData(olist) ;
+    olist->Delete() ;
+    delete olist ;
+  }
+#endif
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Open PROOF-Lite session
 
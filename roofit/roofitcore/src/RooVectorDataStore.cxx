@@ -29,6 +29,17 @@ the requested column into the bound real.
 
 As a faster alternative to loading values one-by-one, one can use the function getBatches(),
 which returns spans pointing directly to the data.
+
+To reduce the memory of large datasets, the values of the real-valued columns can be stored
+in single precision with setFloatPrecision(), or for all datasets created afterwards (e.g.
+when importing a TTree) with setDefaultFloatPrecision():
+~~~ {.cpp}
+RooVectorDataStore::setDefaultFloatPrecision(true);
+RooDataSet data("data", "data", tree, RooArgSet(x, y));
+~~~
+The values are then rounded to float when they are filled into the dataset. For the BatchMode,
+a copy of the columns in double precision is created the first time that they are requested
+with getBatches().
 **/
 
 #include "RooVectorDataStore.h"
@@ -46,12 +57,19 @@ which returns spans pointing directly to the data.
 #include "ROOT/StringUtils.hxx"
 #include "TBuffer.h"
 
+#include <algorithm>
 #include <iomanip>
 using namespace std;
 
 ClassImp(RooVectorDataStore);
 ClassImp(RooVectorDataStore::RealVector);
 
+namespace {
+
+bool gDefaultFloatPrecision = false;
+
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -821,6 +839,8 @@ void RooVectorDataStore::cacheArgs(const RooAbsArg* owner, RooArgSet& newVarSet,
 
   _cacheOwner = (RooAbsArg*) owner ;
   RooVectorDataStore* newCache = new RooVectorDataStore("cache","cache",orderedArgs) ;
+  // cached function values are always stored in double precision
+  newCache->setFloatPrecision(false) ;
 
 
   RooAbsArg::setDirtyInhibit(true) ;
@@ -1077,9 +1097,10 @@ void RooVectorDataStore::dump()
   for (const auto elm : _realStoreList) {
     cout << "RealVector " << elm << " _nativeReal = " << elm->_nativeReal << " = " << elm->_nativeReal->GetName() << " bufptr = " << elm->_buf  << endl ;
     cout << " values : " ;
-    Int_t imax = elm->_vec.size()>10 ? 10 : elm->_vec.size() ;
+    auto values = elm->getRange(0, 10) ;
+    Int_t imax = values.size() ;
     for (Int_t i=0 ; i<imax ; i++) {
-      cout << elm->_vec[i] << " " ;
+      cout << values[i] << " " ;
     }
     cout << endl ;
   }
@@ -1089,9 +1110,10 @@ void RooVectorDataStore::dump()
     << " bufptr = " << elm->_buf  << " errbufptr = " << elm->_bufE << endl ;
 
     cout << " values : " ;
-    Int_t imax = elm->_vec.size()>10 ? 10 : elm->_vec.size() ;
+    auto values = elm->getRange(0, 10) ;
+    Int_t imax = values.size() ;
     for (Int_t i=0 ; i<imax ; i++) {
-      cout << elm->_vec[i] << " " ;
+      cout << values[i] << " " ;
     }
     cout << endl ;
     if (elm->_vecE) {
@@ -1284,6 +1306,7 @@ RooVectorDataStore::RealVector* RooVectorDataStore::addReal(RooAbsReal* real) {
 
   // If nothing found this will make an entry
   _realStoreList.push_back(new RealVector(real)) ;
+  _realStoreList.back()->setFloatPrecision(gDefaultFloatPrecision) ;
 
   return _realStoreList.back() ;
 }
@@ -1351,6 +1374,7 @@ RooVectorDataStore::RealFullVector* RooVectorDataStore::addRealFull(RooAbsReal*
 
   // If nothing found this will make an entry
   _realfStoreList.push_back(new RealFullVector(real)) ;
+  _realfStoreList.back()->setFloatPrecision(gDefaultFloatPrecision) ;
 
   return _realfStoreList.back() ;
 }
@@ -1368,11 +1392,11 @@ void RooVectorDataStore::recomputeSumWeight() {
     const std::string wgtName = _wgtVar->GetName();
     for(auto const* real : _realStoreList) {
       if(wgtName == real->_nativeReal->GetName())
-        arr = real->_vec.data();
+        arr = real->getRange(0, real->size()).data();
     }
     for(auto const* real : _realfStoreList) {
       if(wgtName == real->_nativeReal->GetName())
-        arr = real->_vec.data();
+        arr = real->getRange(0, real->size()).data();
     }
   }
   if(arr == nullptr) {
@@ -1392,11 +1416,11 @@ RooVectorDataStore::ArraysStruct  RooVectorDataStore::getArrays() const {
   out.size = size();
 
   for(auto const* real : _realStoreList) {
-    out.reals.emplace_back(real->_nativeReal->GetName(), real->_vec.data());
+    out.reals.emplace_back(real->_nativeReal->GetName(), real->getRange(0, real->size()).data());
   }
   for(auto const* realf : _realfStoreList) {
     std::string name = realf->_nativeReal->GetName();
-    out.reals.emplace_back(name, realf->_vec.data());
+    out.reals.emplace_back(name, realf->getRange(0, realf->size()).data());
     if(realf->_vecE) out.reals.emplace_back(name + "Err", realf->_vecE->data());
     if(realf->_vecEL) out.reals.emplace_back(name + "ErrLo", realf->_vecEL->data());
     if(realf->_vecEH) out.reals.emplace_back(name + "ErrHi", realf->_vecEH->data());
@@ -1412,3 +1436,49 @@ RooVectorDataStore::ArraysStruct  RooVectorDataStore::getArrays() const {
 
   return out;
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store the values of all real-valued columns in single precision, or convert
+/// them back to double precision. Single precision halves the memory of the
+/// columns, at the price of rounding the values to float.
+
+void RooVectorDataStore::setFloatPrecision(bool flag)
+{
+  for (auto realVec : _realStoreList) {
+    realVec->setFloatPrecision(flag);
+  }
+  for (auto fullVec : _realfStoreList) {
+    fullVec->setFloatPrecision(flag);
+  }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Whether any real-valued column is stored in single precision.
+
+bool RooVectorDataStore::hasFloatPrecision() const
+{
+  auto isFloat = [](const RealVector* realVec) { return realVec->hasFloatPrecision(); };
+  return std::any_of(_realStoreList.begin(), _realStoreList.end(), isFloat) ||
+         std::any_of(_realfStoreList.begin(), _realfStoreList.end(), isFloat);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set whether the real-valued columns of RooVectorDataStores that are created
+/// from now on are stored in single precision. See setFloatPrecision().
+
+void RooVectorDataStore::setDefaultFloatPrecision(bool flag)
+{
+  gDefaultFloatPrecision = flag;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Whether newly created RooVectorDataStores store their values in single precision.
+
+bool RooVectorDataStore::defaultFloatPrecision()
+{
+  return gDefaultFloatPrecision;
+}
@@ -81,6 +81,7 @@ and try reading again.
 #include <iostream>
 #include <fstream>
 #include <cstring>
+#include <unordered_set>
 
 namespace {
 
@@ -510,11 +511,13 @@ bool RooWorkspace::import(const RooAbsArg& inArg,
 
   // Mark nodes that are to be renamed with special attribute
   string topName2 = cloneTop->GetName() ;
+  bool renamedClones = false ;
   if (!renameConflictOrig) {
     // Mark all nodes to be imported for renaming following conflict resolution protocol
     for (const auto cnode : conflictNodes) {
       RooAbsArg* cnode2 = cloneSet.find(cnode->GetName()) ;
       string origName = cnode2->GetName() ;
+      renamedClones = true ;
       cnode2->SetName(Form("%s_%s",cnode2->GetName(),suffix)) ;
       cnode2->SetTitle(Form("%s (%s)",cnode2->GetTitle(),suffix)) ;
       string tag = Form("ORIGNAME:%s",origName.c_str()) ;
@@ -583,6 +586,7 @@ bool RooWorkspace::import(const RooAbsArg& inArg,
 
       if (varMap.find(cnode->GetName())!=varMap.end()) {
         string origName = cnode->GetName() ;
+        renamedClones = true ;
         cnode->SetName(varMap[cnode->GetName()].c_str()) ;
         string tag = Form("ORIGNAME:%s",origName.c_str()) ;
         cnode->setAttribute(tag.c_str()) ;
@@ -604,10 +608,15 @@ bool RooWorkspace::import(const RooAbsArg& inArg,
     }
   }
 
-  // Now clone again with renaming effective
+  // Now clone again with renaming effective. If no node was renamed, the
+  // first copy can be used as it is, which saves a deep copy of large models.
   RooArgSet cloneSet2;
   cloneSet2.useHashMapForFind(true); // Faster finding
-  RooArgSet(*cloneTop).snapshot(cloneSet2, !noRecursion);
+  if (renamedClones) {
+    RooArgSet(*cloneTop).snapshot(cloneSet2, !noRecursion);
+  } else {
+    cloneSet2.addOwned(std::move(cloneSet));
+  }
   RooAbsArg* cloneTop2 = cloneSet2.find(topName2.c_str()) ;
 
   // Make final check list of conflicting nodes
@@ -2466,12 +2475,16 @@ void RooWorkspace::Streamer(TBuffer &R__b)
 
      map<RooAbsArg*,vector<RooAbsArg *> > extClients, extValueClients, extShapeClients ;
 
+     // Set of the owned nodes for fast lookup, as large workspaces have many nodes and client links
+     const std::unordered_set<RooAbsArg const*> ownedNodes(_allOwnedNodes.begin(), _allOwnedNodes.end()) ;
+     auto isOwned = [&ownedNodes](RooAbsArg const* arg) { return ownedNodes.count(arg) > 0 ; } ;
+
      for(RooAbsArg* tmparg : _allOwnedNodes) {
 
        // Loop over client list of this arg
        std::vector<RooAbsArg *> clientsTmp{tmparg->_clientList.begin(), tmparg->_clientList.end()};
        for (auto client : clientsTmp) {
-         if (!_allOwnedNodes.containsInstance(*client)) {
+         if (!isOwned(client)) {
 
            const auto refCount = tmparg->_clientList.refCount(client);
            auto& bufferVec = extClients[tmparg];
@@ -2484,7 +2497,7 @@ void RooWorkspace::Streamer(TBuffer &R__b)
        // Loop over value client list of this arg
        clientsTmp.assign(tmparg->_clientListValue.begin(), tmparg->_clientListValue.end());
        for (auto vclient : clientsTmp) {
-         if (!_allOwnedNodes.containsInstance(*vclient)) {
+         if (!isOwned(vclient)) {
            cxcoutD(ObjectHandling) << "RooWorkspace::Streamer(" << GetName() << ") element " << tmparg->GetName()
                    << " has external value client link to " << vclient << " (" << vclient->GetName() << ") with ref count " << tmparg->_clientListValue.refCount(vclient) << endl ;
 
@@ -2499,7 +2512,7 @@ void RooWorkspace::Streamer(TBuffer &R__b)
        // Loop over shape client list of this arg
        clientsTmp.assign(tmparg->_clientListShape.begin(), tmparg->_clientListShape.end());
        for (auto sclient : clientsTmp) {
-         if (!_allOwnedNodes.containsInstance(*sclient)) {
+         if (!isOwned(sclient)) {
            cxcoutD(ObjectHandling) << "RooWorkspace::Streamer(" << GetName() << ") element " << tmparg->GetName()
                      << " has external shape client link to " << sclient << " (" << sclient->GetName() << ") with ref count " << tmparg->_clientListShape.refCount(sclient) << endl ;
 
@@ -26,7 +26,8 @@ namespace TestStatistics {
 LikelihoodGradientJob::LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood,
                                              std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean,
                                              std::size_t N_dim, RooMinimizer *minimizer)
-   : LikelihoodGradientWrapper(std::move(likelihood), std::move(calculation_is_clean), N_dim, minimizer), grad_(N_dim)
+   : LikelihoodGradientWrapper(std::move(likelihood), std::move(calculation_is_clean), N_dim, minimizer), grad_(N_dim),
+     shared_state_(N_dim * (sizeof(ROOT::Minuit2::DerivatorElement) + sizeof(double)))
 {
    // Note to future maintainers: take care when storing the minimizer_fcn pointer. The
    // RooAbsMinimizerFcn subclasses may get cloned inside MINUIT, which means the pointer
@@ -37,7 +38,7 @@ LikelihoodGradientJob::LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood
 
 LikelihoodGradientJob::LikelihoodGradientJob(const LikelihoodGradientJob &other)
    : MultiProcess::Job(other), LikelihoodGradientWrapper(other), grad_(other.grad_), gradf_(other.gradf_),
-     N_tasks_(other.N_tasks_), minuit_internal_x_(other.minuit_internal_x_)
+     N_tasks_(other.N_tasks_), minuit_internal_x_(other.minuit_internal_x_), shared_state_(other.shared_state_)
 {
 }
 
@@ -125,14 +126,17 @@ bool LikelihoodGradientJob::receive_task_result_on_master(const zmq::message_t &
 
 // SYNCHRONIZATION FROM MASTER TO WORKERS (STATE)
 
+/// The gradient and the parameter values are put in shared memory, only the state ID and the number of parameter
+/// values are published to the workers. No tasks of the previous state are being evaluated at this point.
 void LikelihoodGradientJob::update_workers_state()
 {
-   // TODO optimization: only send changed parameters (now sending all)
-   zmq::message_t gradient_message(grad_.begin(), grad_.end());
-   zmq::message_t minuit_internal_x_message(minuit_internal_x_.begin(), minuit_internal_x_.end());
+   assert(minuit_internal_x_.size() <= grad_.size());
+   auto *shared_grad = shared_state_.data<ROOT::Minuit2::DerivatorElement>();
+   auto *shared_x = reinterpret_cast<double *>(shared_grad + grad_.size());
+   std::copy(grad_.begin(), grad_.end(), shared_grad);
+   std::copy(minuit_internal_x_.begin(), minuit_internal_x_.end(), shared_x);
    ++state_id_;
-   get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, std::move(gradient_message),
-                                                             std::move(minuit_internal_x_message));
+   get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, minuit_internal_x_.size());
 }
 
 void LikelihoodGradientJob::update_workers_state_isCalculating()
@@ -150,19 +154,12 @@ void LikelihoodGradientJob::update_state()
    isCalculating_ = get_manager()->messenger().receive_from_master_on_worker<bool>(&more);
 
    if (more) {
-      auto gradient_message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>(&more);
-      assert(more);
-      auto gradient_message_begin = gradient_message.data<ROOT::Minuit2::DerivatorElement>();
-      auto gradient_message_end =
-         gradient_message_begin + gradient_message.size() / sizeof(ROOT::Minuit2::DerivatorElement);
-      std::copy(gradient_message_begin, gradient_message_end, grad_.begin());
-
-      auto minuit_internal_x_message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>(&more);
+      auto N_x = get_manager()->messenger().receive_from_master_on_worker<std::size_t>(&more);
       assert(!more);
-      auto minuit_internal_x_message_begin = minuit_internal_x_message.data<double>();
-      auto minuit_internal_x_message_end =
-         minuit_internal_x_message_begin + minuit_internal_x_message.size() / sizeof(double);
-      std::copy(minuit_internal_x_message_begin, minuit_internal_x_message_end, minuit_internal_x_.begin());
+      auto const *shared_grad = shared_state_.data<ROOT::Minuit2::DerivatorElement>();
+      auto const *shared_x = reinterpret_cast<double const *>(shared_grad + grad_.size());
+      std::copy(shared_grad, shared_grad + grad_.size(), grad_.begin());
+      minuit_internal_x_.assign(shared_x, shared_x + N_x);
 
       gradf_.SetupDifferentiate(minimizer_->getMultiGenFcn(), minuit_internal_x_.data(),
                                 minimizer_->fitter()->Config().ParamsSettings());
@@ -14,6 +14,7 @@
 #define ROOT_ROOFIT_TESTSTATISTICS_LikelihoodGradientJob
 
 #include "RooFit/MultiProcess/Job.h"
+#include "RooFit/MultiProcess/SharedMemory.h"
 #include "RooFit/TestStatistics/LikelihoodGradientWrapper.h"
 
 #include "Math/MinimizerOptions.h"
@@ -86,6 +87,9 @@ private:
    std::size_t N_tasks_at_workers_ = 0;
    std::vector<double> minuit_internal_x_;
 
+   // the gradient and minuit_internal_x_ as passed to the workers, see update_workers_state
+   MultiProcess::SharedMemory shared_state_;
+
    mutable bool isCalculating_ = false;
 };
 
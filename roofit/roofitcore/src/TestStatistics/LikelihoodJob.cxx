@@ -78,6 +78,15 @@ void LikelihoodJob::init_vars()
    // Save in lists
    vars_.add(varList);
    save_vars_.addClone(varList);
+
+   // The workers read the parameter values from shared memory, see updateWorkersParameters. Since workers are forked
+   // with the current values, the shared values have to start out the same.
+   shared_parameters_ = MultiProcess::SharedMemory(vars_.size() * sizeof(shared_parameter_t));
+   auto *shared = shared_parameters_.data<shared_parameter_t>();
+   for (std::size_t ix = 0; ix < vars_.size(); ++ix) {
+      auto *rar_val = dynamic_cast<RooAbsReal *>(&vars_[ix]);
+      shared[ix] = shared_parameter_t{rar_val ? rar_val->getVal() : 0., vars_[ix].isConstant()};
+   }
 }
 
 void LikelihoodJob::update_state()
@@ -87,21 +96,30 @@ void LikelihoodJob::update_state()
       switch (mode) {
       case update_state_mode::parameters: {
          state_id_ = get_manager()->messenger().receive_from_master_on_worker<RooFit::MultiProcess::State>();
-         auto message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>();
-         auto message_begin = message.data<update_state_t>();
-         auto message_end = message_begin + message.size() / sizeof(update_state_t);
-         std::vector<update_state_t> to_update(message_begin, message_end);
-         for (auto const &item : to_update) {
-            RooRealVar *rvar = (RooRealVar *)vars_.at(item.var_index);
-            rvar->setVal(static_cast<double>(item.value));
+         auto const *shared = shared_parameters_.data<shared_parameter_t>();
+         for (std::size_t ix = 0; ix < vars_.size(); ++ix) {
+            auto *rvar = dynamic_cast<RooRealVar *>(vars_.at(ix));
+            if (!rvar) {
+               continue;
+            }
+            shared_parameter_t const item = shared[ix];
+            if (rvar->getVal() != item.value) {
+               for (auto &cache : task_cache_) {
+                  if (cache.depends_on_var.empty() || cache.depends_on_var[ix]) {
+                     cache.valid = false;
+                  }
+               }
+               rvar->setVal(item.value);
+            }
             if (rvar->isConstant() != item.is_constant) {
-               rvar->setConstant(static_cast<bool>(item.is_constant));
+               rvar->setConstant(item.is_constant);
             }
          }
          break;
       }
       case update_state_mode::offsetting: {
          LikelihoodWrapper::enableOffsetting(get_manager()->messenger().receive_from_master_on_worker<bool>());
+         task_cache_.clear();
          break;
       }
       }
@@ -139,7 +157,9 @@ void LikelihoodJob::updateWorkersParameters()
    if (get_manager()->process_manager().is_master()) {
       bool valChanged = false;
       bool constChanged = false;
-      std::vector<update_state_t> to_update;
+      bool anyChanged = false;
+      // All tasks of the previous state have been evaluated, so the workers no longer need the shared values.
+      auto *shared = shared_parameters_.data<shared_parameter_t>();
       for (std::size_t ix = 0u; ix < static_cast<std::size_t>(vars_.getSize()); ++ix) {
          valChanged = !vars_[ix].isIdentical(save_vars_[ix], true);
          constChanged = (vars_[ix].isConstant() != save_vars_[ix].isConstant());
@@ -152,22 +172,22 @@ void LikelihoodJob::updateWorkersParameters()
             // copyCache is protected (so must be friend). Moved setting value to if-block below.
             //          _saveVars[ix].copyCache(&_vars[ix]);
 
-            // send message to queue (which will relay to workers)
+            // put the value in shared memory, the workers read it when they receive the new state ID
             RooAbsReal *rar_val = dynamic_cast<RooAbsReal *>(&vars_[ix]);
             if (rar_val) {
                double val = rar_val->getVal();
                dynamic_cast<RooRealVar *>(&save_vars_[ix])->setVal(val);
                bool isC = vars_[ix].isConstant();
-               to_update.push_back(update_state_t{ix, val, isC});
+               shared[ix] = shared_parameter_t{val, isC};
+               anyChanged = true;
             }
          }
       }
-      if (!to_update.empty()) {
+      if (anyChanged) {
          ++state_id_;
-         zmq::message_t message(to_update.begin(), to_update.end());
          // always send Job id first! This is used in worker_loop to route the
          // update_state call to the correct Job.
-         get_manager()->messenger().publish_from_master_to_workers(id_, update_state_mode::parameters, state_id_, std::move(message));
+         get_manager()->messenger().publish_from_master_to_workers(id_, update_state_mode::parameters, state_id_);
       }
    }
 }
@@ -242,6 +262,32 @@ void LikelihoodJob::evaluate_task(std::size_t task)
       }
    }
 
+   std::size_t components_first = 0;
+   std::size_t components_last = likelihood_->getNComponents();
+   if (likelihood_type_ == LikelihoodType::sum && getNComponentTasks() > 1) {
+      std::size_t component_task = task / getNEventTasks();
+      components_first = likelihood_->getNComponents() * component_task / getNComponentTasks();
+      if (component_task == getNComponentTasks() - 1) {
+         components_last = likelihood_->getNComponents();
+      } else {
+         components_last = likelihood_->getNComponents() * (component_task + 1) / getNComponentTasks();
+      }
+   }
+
+   // The result of the task is reused if none of the parameters of its components changed since it was computed
+   // (the cache entries are invalidated in update_state).
+   task_cache_t *cache = nullptr;
+   if (MultiProcess::Config::LikelihoodJob::cacheTaskResults) {
+      if (task_cache_.size() <= task) {
+         task_cache_.resize(task + 1);
+      }
+      cache = &task_cache_[task];
+      if (cache->valid) {
+         result_ = cache->result;
+         return;
+      }
+   }
+
    switch (likelihood_type_) {
    case LikelihoodType::unbinned:
    case LikelihoodType::binned: {
@@ -249,18 +295,10 @@ void LikelihoodJob::evaluate_task(std::size_t task)
       break;
    }
    case LikelihoodType::sum: {
-      std::size_t components_first = 0;
-      std::size_t components_last = likelihood_->getNComponents();
-      if (getNComponentTasks() > 1) {
-         std::size_t component_task = task / getNEventTasks();
-         components_first = likelihood_->getNComponents() * component_task / getNComponentTasks();
-         if (component_task == getNComponentTasks() - 1) {
-            components_last = likelihood_->getNComponents();
-         } else {
-            components_last = likelihood_->getNComponents() * (component_task + 1) / getNComponentTasks();
-         }
-      }
       result_ = likelihood_->evaluatePartition({section_first, section_last}, components_first, components_last);
+      if (cache && cache->depends_on_var.empty()) {
+         cache->depends_on_var = findComponentsParameters(components_first, components_last);
+      }
       break;
    }
 
@@ -270,6 +308,32 @@ void LikelihoodJob::evaluate_task(std::size_t task)
       break;
    }
    }
+
+   if (cache) {
+      cache->result = result_;
+      cache->valid = true;
+   }
+}
+
+/// Flag the entries of vars_ that the given range of components of a RooSumL likelihood depends on.
+std::vector<bool> LikelihoodJob::findComponentsParameters(std::size_t components_begin, std::size_t components_end)
+{
+   std::vector<bool> depends_on_var(vars_.size(), false);
+   auto const &components = static_cast<RooSumL *>(likelihood_.get())->GetComponents();
+   for (std::size_t ix = components_begin; ix < components_end; ++ix) {
+      // RooSubsidiaryL returns its own parameter set, the other likelihoods return a new one
+      std::unique_ptr<RooArgSet> owned_params;
+      RooArgSet *params = components[ix]->getParameters();
+      if (dynamic_cast<RooSubsidiaryL *>(components[ix].get()) == nullptr) {
+         owned_params.reset(params);
+      }
+      for (std::size_t var_ix = 0; var_ix < vars_.size(); ++var_ix) {
+         if (params->find(vars_[var_ix].GetName())) {
+            depends_on_var[var_ix] = true;
+         }
+      }
+   }
+   return depends_on_var;
 }
 
 void LikelihoodJob::enableOffsetting(bool flag)
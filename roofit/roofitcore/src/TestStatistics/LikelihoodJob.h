@@ -15,6 +15,7 @@
 
 #include "RooFit/MultiProcess/Job.h"
 #include "RooFit/MultiProcess/types.h"
+#include "RooFit/MultiProcess/SharedMemory.h"
 #include "RooFit/TestStatistics/LikelihoodWrapper.h"
 #include "RooArgList.h"
 
@@ -43,8 +44,8 @@ public:
    void evaluate_task(std::size_t task) override;
    void update_state() override;
 
-   struct update_state_t {
-      std::size_t var_index;
+   // the values of the parameters as passed to the workers in shared memory, one per entry of vars_
+   struct shared_parameter_t {
       double value;
       bool is_constant;
    };
@@ -68,6 +69,7 @@ private:
 
    RooArgList vars_;      // Variables
    RooArgList save_vars_; // Copy of variables
+   MultiProcess::SharedMemory shared_parameters_{0};
 
    LikelihoodType likelihood_type_;
    std::size_t n_tasks_at_workers_ = 0;
@@ -77,6 +79,15 @@ private:
    std::size_t n_component_tasks_;
    std::size_t getNEventTasks();
    std::size_t getNComponentTasks();
+
+   // worker-side cache of the task results, see Config::LikelihoodJob::cacheTaskResults
+   struct task_cache_t {
+      bool valid = false;
+      ROOT::Math::KahanSum<double> result;
+      std::vector<bool> depends_on_var; // per entry of vars_, empty if the task depends on all of them
+   };
+   std::vector<task_cache_t> task_cache_;
+   std::vector<bool> findComponentsParameters(std::size_t components_begin, std::size_t components_end);
 };
 
 std::ostream &operator<<(std::ostream &out, const LikelihoodJob::update_state_mode value);
@@ -307,6 +307,42 @@ TEST_F(LikelihoodJobTest, SimUnbinned)
    EXPECT_DOUBLE_EQ(nll0, nll1);
 }
 
+TEST_F(LikelihoodJobTest, SimUnbinnedCachedComponents)
+{
+   // The workers reuse the results of the components whose parameters didn't change, i.e. here of channel B when
+   // only mA changes. The results must still agree with a likelihood that is computed from scratch.
+   w.factory("ExtendPdf::egA(Gaussian::gA(x[-10,10],mA[2,-10,10],s[3,0.1,10]),nA[1000])");
+   w.factory("ExtendPdf::egB(Gaussian::gB(x,mB[-2,-10,10],s),nB[100])");
+   w.factory("SIMUL::model(index[A,B],A=egA,B=egB)");
+
+   pdf = w.pdf("model");
+   data = pdf->generate(RooArgSet(*w.var("x"), *w.cat("index")));
+
+   nll.reset(pdf->createNLL(*data));
+
+   likelihood = RooFit::TestStatistics::buildLikelihood(pdf, data);
+   std::size_t defaultNComponentTasks = RooFit::MultiProcess::Config::LikelihoodJob::defaultNComponentTasks;
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultNComponentTasks = 2;
+   auto nll_ts = LikelihoodWrapper::create(RooFit::TestStatistics::LikelihoodMode::multiprocess, likelihood, clean_flags);
+   RooFit::MultiProcess::Config::LikelihoodJob::defaultNComponentTasks = defaultNComponentTasks;
+
+   nll_ts->evaluate();
+   EXPECT_DOUBLE_EQ(nll->getVal(), nll_ts->getResult());
+
+   w.var("mA")->setVal(1.5);
+   nll_ts->evaluate();
+   EXPECT_DOUBLE_EQ(nll->getVal(), nll_ts->getResult());
+
+   w.var("mB")->setVal(-1.5);
+   nll_ts->evaluate();
+   EXPECT_DOUBLE_EQ(nll->getVal(), nll_ts->getResult());
+
+   // shared by both channels
+   w.var("s")->setVal(2.5);
+   nll_ts->evaluate();
+   EXPECT_DOUBLE_EQ(nll->getVal(), nll_ts->getResult());
+}
+
 TEST_F(LikelihoodJobTest, SimUnbinnedNonExtended)
 {
    // SIMULTANEOUS FIT OF 2 UNBINNED DATASETS
@@ -8,24 +8,30 @@
 #include <RooConstVar.h>
 #include <RooDataHist.h>
 #include <RooDataSet.h>
+#include <RooExponential.h>
 #include <RooFitResult.h>
 #include <RooFormulaVar.h>
 #include <RooGaussian.h>
 #include <RooGenericPdf.h>
 #include <RooHelpers.h>
+#include <RooNumGenConfig.h>
 #include <RooPoisson.h>
 #include <RooPolynomial.h>
 #include <RooProdPdf.h>
 #include <RooProduct.h>
+#include <RooRandom.h>
 #include <RooRealVar.h>
 #include <RooSimultaneous.h>
 #include <RooUniform.h>
 
 #include <TClass.h>
 #include <TRandom.h>
+#include <TROOT.h>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
 
@@ -347,3 +353,205 @@ TEST(RooAbsPdf, NormSetChange)
    // value, so val2 should be different from val1. }
    EXPECT_NE(v1, v2);
 }
+
+#ifdef R__USE_IMT
+// The BatchMode evaluation with implicit multithreading computes the graph and
+// sums the likelihood in chunks of a fixed size, so the result must not depend
+// on whether it runs in parallel.
+TEST(RooAbsPdf, BatchModeMultiThreaded)
+{
+   using namespace RooFit;
+
+   RooRealVar x("x", "x", 0, -10, 10);
+   RooRealVar y("y", "y", 0, -10, 10);
+   RooRealVar mean("mean", "mean", 1, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 2, 0.1, 10);
+   RooRealVar c("c", "c", -0.2, -2, 2);
+   RooRealVar frac("frac", "frac", 0.3, 0, 1);
+   RooGaussian sig("sig", "sig", x, mean, sigma);
+   RooExponential bkg("bkg", "bkg", x, c);
+   RooAddPdf modelX("modelX", "modelX", {sig, bkg}, {frac});
+   RooGaussian modelY("modelY", "modelY", y, RooConst(0), sigma);
+   RooProdPdf model("model", "model", {modelX, modelY});
+
+   std::unique_ptr<RooDataSet> data{model.generate({x, y}, 50000)};
+
+   auto nllValues = [&]() {
+      std::unique_ptr<RooAbsReal> nll{model.createNLL(*data, BatchMode("cpu"))};
+      std::vector<double> values{nll->getVal()};
+      mean.setVal(1.5);
+      values.push_back(nll->getVal());
+      sigma.setVal(2.5);
+      values.push_back(nll->getVal());
+      mean.setVal(1.);
+      sigma.setVal(2.);
+      return values;
+   };
+
+   const std::vector<double> serial = nllValues();
+   ROOT::EnableImplicitMT(4);
+   const std::vector<double> parallel = nllValues();
+   ROOT::DisableImplicitMT();
+
+   EXPECT_EQ(serial, parallel);
+}
+#endif
+
+// Verify that the gradient propagated through the computation graph of a BatchMode likelihood agrees with the
+// finite-difference derivatives of the likelihood, and that fits with the analytic gradient find the same minimum.
+TEST(RooAbsPdf, BatchModeAnalyticGradient)
+{
+   using namespace RooFit;
+
+   RooRealVar x("x", "x", 0, -10, 10);
+   RooRealVar y("y", "y", 0, -10, 10);
+   RooRealVar mean("mean", "mean", 1, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 2, 0.1, 10);
+   RooRealVar c("c", "c", -0.2, -2, 2);
+   RooRealVar frac("frac", "frac", 0.3, 0, 1);
+   RooGaussian sig("sig", "sig", x, mean, sigma);
+   RooExponential bkg("bkg", "bkg", x, c);
+   RooAddPdf modelX("modelX", "modelX", {sig, bkg}, {frac});
+   RooGaussian modelY("modelY", "modelY", y, RooConst(0), sigma);
+   RooProdPdf model("model", "model", {modelX, modelY});
+
+   std::unique_ptr<RooDataSet> data{model.generate({x, y}, 5000)};
+
+   RooArgList params{mean, sigma, c, frac};
+   std::unique_ptr<RooArgSet> snapshot{static_cast<RooArgSet *>(RooArgSet(params).snapshot())};
+
+   // move away from the generated values, where the gradient would be close to zero
+   mean.setVal(1.3);
+   sigma.setVal(1.8);
+   c.setVal(-0.3);
+   frac.setVal(0.4);
+
+   std::unique_ptr<RooAbsReal> nll{model.createNLL(*data, BatchMode("cpu"))};
+   ASSERT_TRUE(nll->hasGradient());
+
+   std::vector<double> gradient(params.size());
+   nll->gradient(params, gradient.data());
+
+   for (std::size_t i = 0; i < params.size(); ++i) {
+      auto &param = static_cast<RooRealVar &>(params[i]);
+      const double val = param.getVal();
+      const double step = 1e-5 * std::max(1., std::abs(val));
+      param.setVal(val + step);
+      const double up = nll->getVal();
+      param.setVal(val - step);
+      const double down = nll->getVal();
+      param.setVal(val);
+      const double numeric = (up - down) / (2 * step);
+      EXPECT_NEAR(gradient[i], numeric, 1e-4 * std::max(1., std::abs(numeric))) << param.GetName();
+   }
+
+   auto fit = [&](bool analyticGradient) {
+      RooArgSet(params).assign(*snapshot);
+      std::unique_ptr<RooFitResult> result{model.fitTo(*data, BatchMode("cpu"), AnalyticGradient(analyticGradient),
+                                                       Save(), PrintLevel(-1))};
+      return result;
+   };
+   std::unique_ptr<RooFitResult> resultNumeric = fit(false);
+   std::unique_ptr<RooFitResult> resultAnalytic = fit(true);
+
+   EXPECT_EQ(resultAnalytic->status(), 0);
+   EXPECT_NEAR(resultAnalytic->minNll(), resultNumeric->minNll(), 1e-4);
+   for (std::size_t i = 0; i < params.size(); ++i) {
+      auto &parNumeric = static_cast<RooRealVar &>(resultNumeric->floatParsFinal()[i]);
+      auto &parAnalytic = static_cast<RooRealVar &>(resultAnalytic->floatParsFinal()[i]);
+      EXPECT_NEAR(parAnalytic.getVal(), parNumeric.getVal(), 1e-2 * parNumeric.getError()) << parNumeric.GetName();
+   }
+}
+
+// Check that the likelihood compiled by the code generation backend agrees with the CPU backend.
+TEST(RooAbsPdf, BatchModeCodeGen)
+{
+   using namespace RooFit;
+
+   RooRealVar x("x", "x", 0, -10, 10);
+   RooRealVar y("y", "y", 0, -10, 10);
+   RooRealVar mean("mean", "mean", 1, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 2, 0.1, 10);
+   RooRealVar c("c", "c", -0.2, -2, 2);
+   RooRealVar frac("frac", "frac", 0.3, 0, 1);
+   RooGaussian sig("sig", "sig", x, mean, sigma);
+   RooExponential bkg("bkg", "bkg", x, c);
+   RooAddPdf modelX("modelX", "modelX", {sig, bkg}, {frac});
+   RooGaussian modelY("modelY", "modelY", y, RooConst(0), sigma);
+   RooProdPdf model("model", "model", {modelX, modelY});
+
+   std::unique_ptr<RooDataSet> data{model.generate({x, y}, 5000)};
+
+   std::unique_ptr<RooAbsReal> nllCpu{model.createNLL(*data, BatchMode("cpu"))};
+   std::unique_ptr<RooAbsReal> nllCodeGen{model.createNLL(*data, BatchMode("codegen"))};
+
+   EXPECT_NEAR(nllCodeGen->getVal(), nllCpu->getVal(), 1e-8 * std::abs(nllCpu->getVal()));
+
+   // the kernel has to pick up the new values of the parameters
+   mean.setVal(1.3);
+   sigma.setVal(1.8);
+   c.setVal(-0.3);
+   frac.setVal(0.4);
+   EXPECT_NEAR(nllCodeGen->getVal(), nllCpu->getVal(), 1e-8 * std::abs(nllCpu->getVal()));
+}
+
+// The BatchMode only recomputes the nodes that depend on the changed
+// parameters, so the likelihood of a channel of a simultaneous fit that
+// doesn't depend on them is taken from the previous evaluation. Check that the
+// result agrees with a likelihood that is computed from scratch.
+TEST(RooAbsPdf, BatchModeIncrementalEvaluation)
+{
+   using namespace RooFit;
+
+   RooRealVar x("x", "x", 0, -10, 10);
+   RooRealVar meanA("meanA", "meanA", 1, -5, 5);
+   RooRealVar meanB("meanB", "meanB", -1, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 2, 0.1, 10);
+   RooGaussian gaussA("gaussA", "gaussA", x, meanA, sigma);
+   RooGaussian gaussB("gaussB", "gaussB", x, meanB, sigma);
+
+   RooCategory sample("sample", "sample", {{"A", 0}, {"B", 1}});
+   RooSimultaneous simPdf("simPdf", "simPdf", sample);
+   simPdf.addPdf(gaussA, "A");
+   simPdf.addPdf(gaussB, "B");
+
+   std::unique_ptr<RooDataSet> data{simPdf.generate({x, sample}, 2000)};
+
+   std::unique_ptr<RooAbsReal> nll{simPdf.createNLL(*data, BatchMode("cpu"))};
+   nll->getVal();
+
+   auto checkNll = [&]() {
+      std::unique_ptr<RooAbsReal> nllRef{simPdf.createNLL(*data, BatchMode("cpu"))};
+      EXPECT_DOUBLE_EQ(nll->getVal(), nllRef->getVal());
+   };
+
+   meanA.setVal(1.5);
+   checkNll();
+   meanB.setVal(-0.5);
+   checkNll();
+   sigma.setVal(1.5);
+   checkNll();
+   // back to a previous value of one of the channels
+   meanA.setVal(1.);
+   checkNll();
+}
+
+// Accept-reject generation with the trial samples evaluated in blocks in BatchMode.
+TEST(RooAbsPdf, GenerateAcceptRejectBatched)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", 0, -5, 5);
+   RooRealVar y("y", "y", 0, -5, 5);
+   RooGenericPdf pdf("pdf", "pdf", "exp(-0.5 * (x * x + y * y))", {x, y});
+
+   RooRandom::randomGenerator()->SetSeed(1337);
+   pdf.specialGeneratorConfig(true)->getConfigSection("RooAcceptReject").setRealValue("batchSize", 1000);
+   std::unique_ptr<RooDataSet> data{pdf.generate({x, y}, 20000)};
+
+   ASSERT_EQ(data->numEntries(), 20000);
+   for (RooRealVar *var : {&x, &y}) {
+      EXPECT_NEAR(data->mean(*var), 0., 0.03);
+      EXPECT_NEAR(data->sigma(*var), 1., 0.03);
+   }
+}
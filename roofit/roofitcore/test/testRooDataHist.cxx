@@ -786,4 +786,53 @@ INSTANTIATE_TEST_SUITE_P(RooDataHist, WeightsTest,
                             ss << (std::get<2>(paramInfo.param) ? "CDF" : "");
                             ss << (std::get<3>(paramInfo.param) ? "UniformBins" : "");
                             return ss.str();
-                         });
\ No newline at end of file
+                         });
+
+/// Check the vectorized lookup of histograms with more than one dimension,
+/// where the observables of the RooHistPdf and RooHistFunc are mapped onto
+/// the histogram observables and can be outside of their ranges.
+TEST(RooDataHist, VectorizedWeights2D)
+{
+  RooHelpers::LocalChangeMsgLevel chmsglvl1{RooFit::WARNING, 0u, RooFit::DataHandling, true};
+  RooHelpers::LocalChangeMsgLevel chmsglvl2{RooFit::WARNING, 0u, RooFit::Fitting, true};
+
+  // One observable with uniform and one with variable bins
+  std::vector<double> yBoundaries{-1., -0.5, -0.2, 0., 0.1, 0.4, 1.};
+  TH2D h2("h2", "h2", 20, -1., 1., yBoundaries.size() - 1, yBoundaries.data());
+  for (int i = 0; i < 10000; ++i) {
+    h2.Fill(RooRandom::randomGenerator()->Gaus(0., 0.5), RooRandom::randomGenerator()->Gaus(0., 0.5));
+  }
+
+  RooRealVar x("x", "x", 0, -1., 1.);
+  RooRealVar y("y", "y", 0, -1., 1.);
+  RooDataHist dh{"dh", "dh", {x, y}, &h2};
+
+  RooRealVar u("u", "u", 0, -2., 2.);
+  RooRealVar v("v", "v", 0, -1., 1.);
+
+  RooHistPdf histPdf{"histPdf", "histPdf", {u, v}, {x, y}, dh};
+  RooHistFunc histFunc{"histFunc", "histFunc", {u, v}, {x, y}, dh};
+
+  std::size_t nVals = 10000;
+  RooDataSet data{"data", "data", {u, v}};
+  for (std::size_t i = 0; i < nVals; ++i) {
+    u.setVal(-2. + RooRandom::uniform() * 4.);
+    v.setVal(-1. + RooRandom::uniform() * 2.);
+    data.add({u, v});
+  }
+
+  for (RooAbsReal *absReal : {static_cast<RooAbsReal *>(&histPdf), static_cast<RooAbsReal *>(&histFunc)}) {
+    std::vector<double> weightsGetVal(nVals);
+    for (std::size_t i = 0; i < nVals; ++i) {
+      u.setVal(data.get(i)->getRealValue("u"));
+      v.setVal(data.get(i)->getRealValue("v"));
+      weightsGetVal[i] = absReal->getVal({u, v});
+    }
+
+    auto weightsGetValues = absReal->getValues(data);
+
+    for (std::size_t i = 0; i < nVals; ++i) {
+      EXPECT_NEAR(weightsGetVal[i], weightsGetValues[i], 1e-6) << absReal->GetName() << " in event " << i;
+    }
+  }
+}
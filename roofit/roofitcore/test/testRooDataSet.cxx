@@ -8,6 +8,7 @@
 #include <RooRealVar.h>
 #include <RooHelpers.h>
 #include <RooCategory.h>
+#include <RooVectorDataStore.h>
 #include <RooWorkspace.h>
 
 #include <TFile.h>
@@ -308,3 +309,38 @@ TEST(RooDataSet, ReduceWithCompositeDataStore)
    EXPECT_EQ(dataSetWeighted.weight(), dataSetComposite.weight());
    EXPECT_EQ(dataSetComposite.weight(), dataSetReduced.weight());
 }
+
+// Datasets that store their values in single precision.
+TEST(RooDataSet, FloatPrecision)
+{
+   RooRealVar x("x", "x", 0, 1);
+   RooRealVar w("w", "w", 0, 10);
+
+   RooVectorDataStore::setDefaultFloatPrecision(true);
+   RooDataSet data("data", "data", {x, w}, "w");
+   RooVectorDataStore::setDefaultFloatPrecision(false);
+
+   const std::size_t nEvents = 100;
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      x.setVal(0.1 + 0.0071 * i);
+      data.add(x, 0.3 + 0.01 * i);
+   }
+
+   auto &store = static_cast<RooVectorDataStore &>(*data.store());
+   EXPECT_TRUE(store.hasFloatPrecision());
+
+   auto batches = data.getBatches();
+   auto xBatch = batches[data.get()->find("x")];
+   ASSERT_EQ(xBatch.size(), nEvents);
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      const double expected = static_cast<float>(0.1 + 0.0071 * i);
+      EXPECT_EQ(data.get(i)->getRealValue("x"), expected);
+      EXPECT_EQ(xBatch[i], expected);
+      EXPECT_EQ(data.weight(), static_cast<float>(0.3 + 0.01 * i));
+   }
+
+   // converting back to double precision keeps the rounded values
+   store.setFloatPrecision(false);
+   EXPECT_FALSE(store.hasFloatPrecision());
+   EXPECT_EQ(data.get(7)->getRealValue("x"), static_cast<float>(0.1 + 0.0071 * 7));
+}
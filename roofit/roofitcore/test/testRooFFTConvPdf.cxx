@@ -0,0 +1,57 @@
+// Tests for RooFFTConvPdf
+
+#include <RooFFTConvPdf.h>
+#include <RooGaussian.h>
+#include <RooRealVar.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+/// The transform of an input pdf is reused if only the parameters of the
+/// other input changed, check that the convolution is still up to date.
+TEST(RooFFTConvPdf, ReuseInputTransforms)
+{
+   RooRealVar x("x", "x", -10, 10);
+   x.setBins(1000, "cache");
+   RooRealVar mean("mean", "mean", 0, -3, 3);
+   RooRealVar sigma("sigma", "sigma", 1, 0.5, 3);
+   RooRealVar resMean("resMean", "resMean", 0, -1, 1);
+   RooRealVar resSigma("resSigma", "resSigma", 0.5, 0.1, 2);
+
+   RooGaussian physics("physics", "physics", x, mean, sigma);
+   RooGaussian resolution("resolution", "resolution", x, resMean, resSigma);
+   RooFFTConvPdf conv("conv", "conv", x, physics, resolution);
+
+   // Convolution of two Gaussians, normalized over the range of x
+   auto expected = [&](double xVal) {
+      const double s = std::sqrt(sigma.getVal() * sigma.getVal() + resSigma.getVal() * resSigma.getVal());
+      RooRealVar xRef("xRef", "xRef", xVal, -10, 10);
+      RooRealVar mRef("mRef", "mRef", mean.getVal() + resMean.getVal());
+      RooRealVar sRef("sRef", "sRef", s);
+      RooGaussian ref("ref", "ref", xRef, mRef, sRef);
+      return ref.getVal(xRef);
+   };
+
+   auto check = [&]() {
+      for (double xVal : {-2.0, 0.0, 1.5}) {
+         x.setVal(xVal);
+         EXPECT_NEAR(conv.getVal(x), expected(xVal), 2e-3) << "at x = " << xVal;
+      }
+   };
+
+   check();
+   // Only the physics model changes
+   mean.setVal(1.0);
+   sigma.setVal(1.5);
+   check();
+   // Only the resolution model changes
+   resSigma.setVal(1.0);
+   check();
+   resMean.setVal(0.5);
+   check();
+   // Both change
+   mean.setVal(-1.0);
+   resSigma.setVal(0.3);
+   check();
+}
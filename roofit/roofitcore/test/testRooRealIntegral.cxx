@@ -6,6 +6,7 @@
 #include <RooGenericPdf.h>
 #include <RooProduct.h>
 #include <RooProjectedPdf.h>
+#include <RooRealIntegral.h>
 #include <RooRealVar.h>
 
 #include <gtest/gtest.h>
@@ -133,3 +134,45 @@ TEST(RooRealIntegral, IntegrateFuncWithShapeServers)
    EXPECT_EQ(gaussProj.servers().size(), 4);
    EXPECT_EQ(integ1->servers().size(), 4);
 }
+
+/// Check that the memoized results of numeric integrals are reused only for
+/// the parameter values and integration ranges they were computed with.
+TEST(RooRealIntegral, NumericMemoization)
+{
+   RooRealVar x("x", "", 0, -10, 10);
+   RooRealVar mu("mu", "", 0, -5, 5);
+   RooRealVar sigma("sigma", "", 1, 0.5, 2);
+
+   // The generic pdf can't be integrated analytically
+   RooGenericPdf pdf("pdf", "std::exp(-0.5*std::pow((x-mu)/sigma, 2))", {x, mu, sigma});
+   std::unique_ptr<RooAbsReal> integ{pdf.createIntegral(x)};
+
+   auto valueAt = [&](double muVal, double xMax) {
+      mu.setVal(muVal);
+      x.setMax(xMax);
+      return integ->getVal();
+   };
+
+   const double ref0 = valueAt(0.0, 10.0);
+   const double ref1 = valueAt(1.0, 10.0);
+   const double refRange = valueAt(0.0, 1.0);
+   const double refClose = valueAt(1.05, 10.0);
+
+   RooRealIntegral::setNumericMemoization(4);
+
+   // Exact matches only: every value is the one of the plain integration
+   EXPECT_DOUBLE_EQ(valueAt(0.0, 10.0), ref0);
+   EXPECT_DOUBLE_EQ(valueAt(1.0, 10.0), ref1);
+   EXPECT_DOUBLE_EQ(valueAt(0.0, 10.0), ref0);
+   EXPECT_DOUBLE_EQ(valueAt(0.0, 1.0), refRange);
+   EXPECT_DOUBLE_EQ(valueAt(1.05, 10.0), refClose);
+
+   // With a tolerance, the result for mu = 1 is reused for mu = 1.05
+   RooRealIntegral::setNumericMemoization(4, 0.1);
+   EXPECT_DOUBLE_EQ(valueAt(1.0, 10.0), ref1);
+   EXPECT_DOUBLE_EQ(valueAt(1.05, 10.0), ref1);
+   EXPECT_DOUBLE_EQ(valueAt(0.0, 1.0), refRange);
+
+   RooRealIntegral::setNumericMemoization(0);
+   EXPECT_DOUBLE_EQ(valueAt(1.05, 10.0), refClose);
+}
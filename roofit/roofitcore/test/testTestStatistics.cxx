@@ -8,9 +8,11 @@
 #include <RooFitResult.h>
 #include <RooGaussian.h>
 #include <RooGenericPdf.h>
+#include <RooHistFunc.h>
 #include <RooNLLVar.h>
 #include <RooRandom.h>
 #include <RooPlot.h>
+#include <RooRealSumPdf.h>
 #include <RooRealVar.h>
 
 #include <gtest/gtest.h>
@@ -320,3 +322,33 @@ TEST(RooNLLVar, CopyRangedNLL)
    EXPECT_FLOAT_EQ(nll->getVal(), nllrange->getVal());
    EXPECT_FLOAT_EQ(nllrange->getVal(), nllrangeClone->getVal());
 }
+
+/// The batch mode evaluates binned likelihoods of RooRealSumPdfs directly from the predicted bin contents, it has to
+/// agree with the legacy test statistics also when evaluated repeatedly.
+TEST(RooNLLVar, BinnedLikelihoodBatchMode)
+{
+   using namespace RooFit;
+
+   RooRealVar x("x", "x", 0, 10);
+   x.setBins(20);
+   RooRealVar mean("mean", "mean", 5, 0, 10);
+   RooRealVar sigma("sigma", "sigma", 2, 0.1, 10);
+   RooGaussian gauss("gauss", "gauss", x, mean, sigma);
+
+   RooRandom::randomGenerator()->SetSeed(42);
+   std::unique_ptr<RooDataHist> hist{gauss.generateBinned(x, 1000)};
+   std::unique_ptr<RooDataHist> data{gauss.generateBinned(x, 1000)};
+
+   RooHistFunc func("func", "func", x, *hist);
+   RooRealVar norm("norm", "norm", 1, 0, 2);
+   RooRealSumPdf pdf("pdf", "pdf", RooArgList{func}, RooArgList{norm}, true);
+   pdf.setAttribute("BinnedLikelihood");
+
+   std::unique_ptr<RooAbsReal> nll{pdf.createNLL(*data, BatchMode("off"))};
+   std::unique_ptr<RooAbsReal> nllBatch{pdf.createNLL(*data, BatchMode("cpu"))};
+
+   for (double val : {0.8, 1.0, 1.3, 1.0}) {
+      norm.setVal(val);
+      EXPECT_NEAR(nllBatch->getVal(), nll->getVal(), 1e-8 * std::abs(nll->getVal()));
+   }
+}
@@ -268,3 +268,31 @@ TEST(RooWorkspace, Issue_7809)
    ASSERT_EQ(static_cast<RooProdPdf*>(ws.pdf("p3"))->pdfList().size(), 2);
    ASSERT_EQ(static_cast<RooProduct*>(ws.function("p4"))->components().size(), 2);
 }
+
+/// Importing models with and without renaming must give self-contained copies
+/// in the workspace, also when nodes are recycled.
+TEST(RooWorkspace, ImportIsSelfContained)
+{
+   RooRealVar x("x", "x", -10, 10);
+   RooRealVar mean("mean", "mean", 0, -10, 10);
+   RooRealVar sigma("sigma", "sigma", 1, 0.1, 10);
+   RooGaussian gauss1("gauss1", "gauss1", x, mean, sigma);
+   RooGaussian gauss2("gauss2", "gauss2", x, mean, sigma);
+   RooProdPdf prod("prod", "prod", {gauss1, gauss2});
+
+   RooWorkspace ws;
+   ws.import(gauss1, RooFit::Silence());
+   ws.import(prod, RooFit::RecycleConflictNodes(), RooFit::Silence());
+   ws.import(gauss1, RooFit::RenameAllNodes("copy"), RooFit::RenameAllVariables("copy"), RooFit::Silence());
+
+   for (const char *name : {"gauss1", "prod", "gauss1_copy"}) {
+      RooAbsArg *top = ws.arg(name);
+      ASSERT_NE(top, nullptr) << name;
+      RooArgSet nodes;
+      top->treeNodeServerList(&nodes);
+      for (RooAbsArg *node : nodes) {
+         EXPECT_TRUE(ws.components().containsInstance(*node)) << node->GetName() << " of " << name;
+      }
+   }
+   EXPECT_EQ(ws.arg("x_copy"), ws.pdf("gauss1_copy")->findServer("x_copy"));
+}
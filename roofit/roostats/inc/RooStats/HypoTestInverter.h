@@ -22,6 +22,7 @@ class TGraphErrors;
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace RooStats {
 
@@ -97,6 +98,10 @@ public:
 
    bool RunOnePoint( double thisX, bool adaptive = false, double clTarget = -1 ) const;
 
+   /// Run the points of a fixed scan in parallel in this number of forked processes, which share the model with
+   /// this process instead of copying it. Zero runs the points in this process. The automatic scan is sequential.
+   void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+
    //bool RunAutoScan( double xMin, double xMax, double target, double epsilon=nullptr.005, unsigned int numAlgorithm=nullptr );
 
    bool RunLimit(double &limit, double &limitErr, double absTol = 0, double relTol = 0, const double *hint=nullptr) const;
@@ -160,6 +165,9 @@ protected:
 
    void CreateResults() const;
 
+   /// run the points of a fixed scan in forked processes
+   bool RunPointsParallel(const std::vector<double> &points) const;
+
    /// run the hybrid at a single point
    HypoTestResult * Eval( HypoTestCalculatorGeneric &hc, bool adaptive , double clsTarget) const;
 
@@ -199,6 +207,7 @@ private:
    double fXmin;
    double fXmax;
    double fNumErr;
+   unsigned int fNWorkers = 0; ///<! number of processes for parallel fixed scans
 
 protected:
 
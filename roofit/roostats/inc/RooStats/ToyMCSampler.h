@@ -226,6 +226,10 @@ class ToyMCSampler: public TestStatSampler {
       /// calling with argument or nullptr deactivates proof
       void SetProofConfig(ProofConfig *pc = nullptr) { fProofConfig = pc; }
 
+      /// Generate and evaluate the toys in parallel in this number of forked processes, which share the model with
+      /// this process instead of copying it. Zero runs the toys in this process. Not used if a ProofConfig is set.
+      void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
    protected:
@@ -238,6 +242,8 @@ class ToyMCSampler: public TestStatSampler {
       /// helper method for clearing  the cache
       virtual void ClearCache();
 
+      RooDataSet* GetSamplingDistributionsParallel(RooArgSet& paramPoint);
+
 
       /// densities, snapshots, and test statistics to reweight to
       RooAbsPdf *fPdf; ///< model (can be alt or null)
@@ -271,6 +277,8 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData; ///< in dev
 
       ProofConfig *fProofConfig;   ///<!
+      unsigned int fNWorkers = 0;  ///<! number of processes for parallel runs without PROOF
+      std::vector<UInt_t> fToySeeds; ///<! random seeds of the toys in a parallel run, one per toy
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler; ///<!
 
@@ -64,6 +64,13 @@ call HypoTestInverter::UseCLs().
 
 #include "RooStats/ProofConfig.h"
 
+#include "ROOT/RConfig.hxx"
+
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <memory>
@@ -406,6 +413,7 @@ HypoTestInverter & HypoTestInverter::operator= (const HypoTestInverter & rhs) {
    fXmin = rhs.fXmin;
    fXmax = rhs.fXmax;
    fNumErr = rhs.fNumErr;
+   fNWorkers = rhs.fNWorkers;
 
    return *this;
 }
@@ -643,16 +651,18 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
      return false;
    }
 
-   double thisX = xMin;
-   for (int i=0; i<nBins; i++) {
+   std::vector<double> points(nBins, xMin);
+   for (int i = 1; i < nBins; i++) { // avoids case of nBins = 1
+      if (scanLog)
+         points[i] = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
+      else
+         points[i] = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
+   }
 
-      if (i > 0) { // avoids case of nBins = 1
-         if (scanLog)
-            thisX = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
-         else
-            thisX = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
-      }
+   if (fNWorkers > 0 && points.size() > 1)
+      return RunPointsParallel(points);
 
+   for (double thisX : points) {
       const bool status = RunOnePoint(thisX);
 
       // check if failed status
@@ -664,6 +674,57 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
    return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the points of a fixed scan in forked processes, see SetNWorkers().
+/// Each process runs a contiguous range of the points in increasing order, so
+/// that the fits of a point start from the parameters found for the previous
+/// one as in a sequential scan. The toys of each process use their own random
+/// seed, drawn from RooRandom::randomGenerator() before forking.
+
+bool HypoTestInverter::RunPointsParallel(const std::vector<double> &points) const
+{
+#ifdef R__WIN32
+   oocoutW(nullptr, InputArguments)
+      << "HypoTestInverter: running points in forked processes is not supported on Windows, running sequentially." << endl;
+   for (double thisX : points) {
+      if (!RunOnePoint(thisX))
+         oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << thisX << " failed. Skipping." << std::endl;
+   }
+   return true;
+#else
+   ROOT::TProcessExecutor pool(fNWorkers);
+   const unsigned int nWorkers = std::min(pool.GetPoolSize(), static_cast<unsigned int>(points.size()));
+   std::vector<UInt_t> seeds(nWorkers);
+   for (auto &seed : seeds)
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<UInt_t>::Max());
+
+   auto runWorker = [&](unsigned int iWorker) {
+      RooRandom::randomGenerator()->SetSeed(seeds[iWorker]);
+      // collect only the points of this worker, the results already there are kept by the parent
+      fResults = nullptr;
+      CreateResults();
+      const std::size_t begin = points.size() * iWorker / nWorkers;
+      const std::size_t end = points.size() * (iWorker + 1) / nWorkers;
+      for (std::size_t i = begin; i < end; ++i) {
+         if (!RunOnePoint(points[i]))
+            oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << points[i] << " failed. Skipping." << std::endl;
+      }
+      return fResults;
+   };
+
+   for (HypoTestInverterResult *oneWorker : pool.Map(runWorker, ROOT::TSeqU(nWorkers))) {
+      if (!oneWorker)
+         continue;
+      for (int i = 0; i < oneWorker->ArraySize(); ++i) {
+         if (auto result = oneWorker->GetResult(i))
+            fResults->Add(oneWorker->GetXValue(i), *result);
+      }
+      delete oneWorker;
+   }
+   return true;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// run only one point at the given POI value
 
@@ -49,6 +49,13 @@ ToyMCStudy with the RooStudyManager.
 #include "RooCategory.h"
 
 #include "TMath.h"
+#include "ROOT/RConfig.hxx"
+
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <algorithm>
 
 
 using namespace RooFit;
@@ -304,7 +311,8 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 
    // ======= S I N G L E   R U N ? =======
    if(!fProofConfig)
-      return GetSamplingDistributionsSingleWorker(paramPointIn);
+      return fNWorkers > 0 ? GetSamplingDistributionsParallel(paramPointIn)
+                           : GetSamplingDistributionsSingleWorker(paramPointIn);
 
    // ======= P A R A L L E L   R U N =======
    if (!CheckConfig()){
@@ -346,6 +354,67 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the toys in parallel in forked processes, see SetNWorkers(). The
+/// processes share the model, the test statistics and the data of this
+/// process instead of streaming them like PROOF does. Each toy is generated
+/// with its own random seed, drawn from RooRandom::randomGenerator() before
+/// forking.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsParallel(RooArgSet& paramPointIn)
+{
+   if (!CheckConfig()){
+      oocoutE(nullptr, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << endl;
+      return nullptr;
+   }
+
+   // turn adaptive sampling off if given
+   if(fToysInTails) {
+      fToysInTails = 0;
+      oocoutW(nullptr, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+#ifdef R__WIN32
+   oocoutW(nullptr, InputArguments)
+      << "ToyMCSampler: running toys in forked processes is not supported on Windows, running sequentially." << endl;
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   const Int_t totToys = fNToys;
+   std::vector<UInt_t> seeds(std::max(totToys, 0));
+   for (auto &seed : seeds)
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<UInt_t>::Max());
+
+   ROOT::TProcessExecutor pool(fNWorkers);
+   const unsigned int nWorkers = std::max(1u, std::min(pool.GetPoolSize(), static_cast<unsigned int>(seeds.size())));
+
+   // each worker runs a contiguous range of the toys
+   auto runWorker = [&](unsigned int iWorker) {
+      const std::size_t begin = seeds.size() * iWorker / nWorkers;
+      const std::size_t end = seeds.size() * (iWorker + 1) / nWorkers;
+      fToySeeds.assign(seeds.begin() + begin, seeds.begin() + end);
+      fNToys = end - begin;
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   };
+
+   RooDataSet *output = nullptr;
+   for (RooDataSet *oneWorker : pool.Map(runWorker, ROOT::TSeqU(nWorkers))) {
+      if (!oneWorker)
+         continue;
+      if (!output) {
+         output = oneWorker;
+      } else {
+         output->append(*oneWorker);
+         delete oneWorker;
+      }
+   }
+   return output;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
@@ -398,6 +467,10 @@ RooDataSet* ToyMCSampler::GetSamplingDistributionsSingleWorker(RooArgSet& paramP
       // first one.
       double valueFirst = -999.0, weight = 1.0;
 
+      // in parallel runs, every toy has its own random seed
+      if (static_cast<std::size_t>(i) < fToySeeds.size())
+         RooRandom::randomGenerator()->SetSeed(fToySeeds[i]);
+
       // set variables to requested parameter point
       allVars->assign(*saveAll); // important for example for SimpleLikelihoodRatioTestStat
 
@@ -0,0 +1,69 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2026, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "RooArgSet.h"
+#include "RooDataSet.h"
+#include "RooRealVar.h"
+#include "RooWorkspace.h"
+#include "RooStats/AsymptoticCalculator.h"
+#include "RooStats/HypoTestInverter.h"
+#include "RooStats/HypoTestInverterResult.h"
+#include "RooStats/ModelConfig.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+/// A fixed scan run in forked processes gives the same points and CLs values as the sequential scan.
+TEST(HypoTestInverter, ParallelFixedScan)
+{
+   RooWorkspace w("w");
+   w.factory("Poisson::pdf(n[0,100], sum::nexp(prod::s(mu[1,0,10], 5), b[3]))");
+   RooRealVar &n = *w.var("n");
+   RooRealVar &mu = *w.var("mu");
+
+   RooDataSet data("data", "data", n);
+   n.setVal(5);
+   data.add(n);
+
+   RooStats::ModelConfig sbModel("sbModel", &w);
+   sbModel.SetPdf("pdf");
+   sbModel.SetObservables("n");
+   sbModel.SetParametersOfInterest("mu");
+   sbModel.SetSnapshot(mu);
+
+   RooStats::ModelConfig bModel(sbModel);
+   bModel.SetName("bModel");
+   mu.setVal(0);
+   bModel.SetSnapshot(mu);
+
+   RooStats::AsymptoticCalculator calculator(data, bModel, sbModel);
+   calculator.SetOneSided(true);
+
+   auto runScan = [&](unsigned int nWorkers) {
+      RooStats::HypoTestInverter inverter(calculator);
+      inverter.SetConfidenceLevel(0.95);
+      inverter.UseCLs(true);
+      inverter.SetFixedScan(7, 0.5, 3.5);
+      inverter.SetNWorkers(nWorkers);
+      return std::unique_ptr<RooStats::HypoTestInverterResult>{inverter.GetInterval()};
+   };
+
+   auto sequential = runScan(0);
+   auto parallel = runScan(3);
+
+   ASSERT_EQ(sequential->ArraySize(), 7);
+   ASSERT_EQ(parallel->ArraySize(), 7);
+   for (int i = 0; i < sequential->ArraySize(); ++i) {
+      EXPECT_DOUBLE_EQ(parallel->GetXValue(i), sequential->GetXValue(i));
+      EXPECT_NEAR(parallel->CLs(i), sequential->CLs(i), 1.E-6);
+   }
+   EXPECT_NEAR(parallel->UpperLimit(), sequential->UpperLimit(), 1.E-6);
+}
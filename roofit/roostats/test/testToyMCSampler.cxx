@@ -0,0 +1,58 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2022, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include "RooRealVar.h"
+#include "RooGaussian.h"
+#include "RooRandom.h"
+#include "RooStats/ProfileLikelihoodTestStat.h"
+#include "RooStats/SamplingDistribution.h"
+#include "RooStats/ToyMCSampler.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+
+/// Toys run in forked processes give the same test statistics regardless of the number of processes, because every
+/// toy has its own random seed.
+TEST(ToyMCSampler, ParallelToysIndependentOfNWorkers)
+{
+   RooRealVar x("x", "x", 0, -10, 10);
+   RooRealVar mu("mu", "mu", 0, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 1.);
+   RooGaussian gauss("gauss", "gauss", x, mu, sigma);
+
+   RooStats::ProfileLikelihoodTestStat testStat(gauss);
+   RooStats::ToyMCSampler sampler(testStat, 20);
+   sampler.SetPdf(gauss);
+   sampler.SetObservables(x);
+   sampler.SetNEventsPerToy(50);
+   sampler.SetParametersForTestStat(mu);
+
+   RooArgSet paramPoint{mu};
+
+   auto runToys = [&](unsigned int nWorkers) {
+      sampler.SetNWorkers(nWorkers);
+      RooRandom::randomGenerator()->SetSeed(1337);
+      std::unique_ptr<RooStats::SamplingDistribution> dist{sampler.GetSamplingDistribution(paramPoint)};
+      std::vector<double> values = dist->GetSamplingDistribution();
+      std::sort(values.begin(), values.end());
+      return values;
+   };
+
+   std::vector<double> values2 = runToys(2);
+   std::vector<double> values3 = runToys(3);
+
+   ASSERT_EQ(values2.size(), 20u);
+   ASSERT_EQ(values3.size(), 20u);
+   for (std::size_t i = 0; i < values2.size(); ++i) {
+      EXPECT_DOUBLE_EQ(values2[i], values3[i]);
+   }
+}
@@ -0,0 +1,363 @@
+// @(#)root/test:$Id$
+
+// This program measures the time spent in frequently used ROOT code paths,
+// so that performance regressions can be tracked from one commit to the next:
+//  -TBufferFile streaming of a histogram, write and read
+//  -TTree::Fill and TTree::GetEntry of a standard dataset
+//  -TH1D::Fill
+//  -an RDataFrame computation graph on the standard dataset
+//  -a binned maximum likelihood fit with the default minimizer
+//  -RNTuple write and read of the standard dataset (when built with root7)
+//
+// The standard dataset is generated with a fixed seed, and every benchmark is
+// repeated several times: the minimum real time is the stable metric to
+// track, the median is reported to judge the noise of the machine.
+//
+//  run with
+//     benchHotPaths                  default size
+//     benchHotPaths -n 0.1           a tenth of the default number of entries
+//     benchHotPaths -r 10            10 repetitions of each benchmark instead of 5
+//     benchHotPaths -j results.json  also write the results in JSON format
+//     benchHotPaths -f TTree         only run the benchmarks containing "TTree"
+
+#include "TBufferFile.h"
+#include "TF1.h"
+#include "TFile.h"
+#include "TH1.h"
+#include "TROOT.h"
+#include "TRandom3.h"
+#include "TStopwatch.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDFHelpers.hxx"
+
+#ifdef BENCH_HAS_RNTUPLE
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char *kDatasetFile = "benchHotPaths_data.root";
+const char *kTreeName = "events";
+const Long64_t kDefaultEntries = 2000000;
+
+/// Content of one entry of the standard dataset
+struct Event {
+   Float_t fPx = 0;
+   Float_t fPy = 0;
+   Float_t fPz = 0;
+   Double_t fE = 0;
+   Int_t fNtrk = 0;
+   Float_t fTrkPt[16] = {};
+};
+
+/// Fill an event with reproducible values, all benchmarks use the same sequence
+void GenerateEvent(TRandom3 &rnd, Event &ev)
+{
+   rnd.Rannor(ev.fPx, ev.fPy);
+   ev.fPz = rnd.Gaus(0, 10);
+   ev.fE = std::sqrt(ev.fPx * ev.fPx + ev.fPy * ev.fPy + ev.fPz * ev.fPz + 0.0196);
+   ev.fNtrk = rnd.Integer(16) + 1;
+   for (Int_t i = 0; i < ev.fNtrk; ++i)
+      ev.fTrkPt[i] = rnd.Exp(5.);
+}
+
+/// Create the TTree of the standard dataset, branches pointing to ev
+TTree *MakeTree(Event &ev)
+{
+   auto tree = new TTree(kTreeName, "benchHotPaths standard dataset");
+   tree->Branch("px", &ev.fPx, "px/F");
+   tree->Branch("py", &ev.fPy, "py/F");
+   tree->Branch("pz", &ev.fPz, "pz/F");
+   tree->Branch("e", &ev.fE, "e/D");
+   tree->Branch("ntrk", &ev.fNtrk, "ntrk/I");
+   tree->Branch("trkpt", ev.fTrkPt, "trkpt[ntrk]/F");
+   return tree;
+}
+
+struct BenchResult {
+   std::string fName;
+   Long64_t fItems = 0;
+   Double_t fMinRealTime = 0;
+   Double_t fMedianRealTime = 0;
+   Double_t fMinCpuTime = 0;
+};
+
+/// A benchmark processes a number of items and returns it, setup is done in the function itself
+struct Bench {
+   std::string fName;
+   std::function<Long64_t(Long64_t)> fRun;
+   Long64_t fItems;
+};
+
+BenchResult RunBench(const Bench &bench, int nrep)
+{
+   std::vector<Double_t> realTimes, cpuTimes;
+   Long64_t items = 0;
+   TStopwatch timer;
+   for (int rep = 0; rep < nrep; ++rep) {
+      timer.Start(kTRUE);
+      items = bench.fRun(bench.fItems);
+      timer.Stop();
+      realTimes.emplace_back(timer.RealTime());
+      cpuTimes.emplace_back(timer.CpuTime());
+   }
+   std::sort(realTimes.begin(), realTimes.end());
+   BenchResult res;
+   res.fName = bench.fName;
+   res.fItems = items;
+   res.fMinRealTime = realTimes.front();
+   res.fMedianRealTime = realTimes[realTimes.size() / 2];
+   res.fMinCpuTime = *std::min_element(cpuTimes.begin(), cpuTimes.end());
+   return res;
+}
+
+//______________________________________________________________________________
+Long64_t BenchBufferWrite(Long64_t n)
+{
+   TH1D h("hbuf", "streaming", 1000, 0, 1);
+   h.FillRandom("gaus", 10000);
+   for (Long64_t i = 0; i < n; ++i) {
+      TBufferFile buf(TBuffer::kWrite);
+      buf.WriteObject(&h);
+   }
+   return n;
+}
+
+Long64_t BenchBufferRead(Long64_t n)
+{
+   TH1D h("hbuf", "streaming", 1000, 0, 1);
+   h.FillRandom("gaus", 10000);
+   TBufferFile wbuf(TBuffer::kWrite);
+   wbuf.WriteObject(&h);
+   for (Long64_t i = 0; i < n; ++i) {
+      TBufferFile buf(TBuffer::kRead, wbuf.Length(), wbuf.Buffer(), kFALSE);
+      delete buf.ReadObject(TH1D::Class());
+   }
+   return n;
+}
+
+Long64_t BenchTreeFill(Long64_t n)
+{
+   TFile f(kDatasetFile, "RECREATE");
+   Event ev;
+   TRandom3 rnd(4357);
+   TTree *tree = MakeTree(ev);
+   for (Long64_t i = 0; i < n; ++i) {
+      GenerateEvent(rnd, ev);
+      tree->Fill();
+   }
+   tree->Write();
+   return n;
+}
+
+Long64_t BenchTreeGetEntry(Long64_t)
+{
+   TFile f(kDatasetFile);
+   auto tree = f.Get<TTree>(kTreeName);
+   Event ev;
+   tree->SetBranchAddress("px", &ev.fPx);
+   tree->SetBranchAddress("py", &ev.fPy);
+   tree->SetBranchAddress("pz", &ev.fPz);
+   tree->SetBranchAddress("e", &ev.fE);
+   tree->SetBranchAddress("ntrk", &ev.fNtrk);
+   tree->SetBranchAddress("trkpt", ev.fTrkPt);
+   const Long64_t nEntries = tree->GetEntries();
+   for (Long64_t i = 0; i < nEntries; ++i)
+      tree->GetEntry(i);
+   return nEntries;
+}
+
+Long64_t BenchHistFill(Long64_t n)
+{
+   TRandom3 rnd(4357);
+   std::vector<Double_t> values(1000000);
+   for (auto &v : values)
+      v = rnd.Gaus(0, 1);
+   TH1D h("hfill", "filling", 100, -5, 5);
+   for (Long64_t i = 0; i < n; ++i)
+      h.Fill(values[i % values.size()]);
+   return n;
+}
+
+Long64_t BenchDataFrame(Long64_t)
+{
+   ROOT::RDataFrame df(kTreeName, kDatasetFile);
+   auto pt = df.Define("pt", [](Float_t px, Float_t py) { return std::sqrt(px * px + py * py); }, {"px", "py"});
+   auto sel = pt.Filter([](Int_t ntrk) { return ntrk > 2; }, {"ntrk"});
+   auto hPt = sel.Histo1D<Float_t>({"hpt", "pt", 100, 0, 5}, "pt");
+   auto hTrk = sel.Histo1D<ROOT::RVec<Float_t>>({"htrk", "track pt", 100, 0, 20}, "trkpt");
+   auto sumE = df.Sum<Double_t>("e");
+   auto count = df.Count();
+   ROOT::RDF::RunGraphs({hPt, hTrk, sumE, count});
+   return *count;
+}
+
+Long64_t BenchFit(Long64_t n)
+{
+   TRandom3 rnd(4357);
+   TH1D h("hfit", "fit", 200, -5, 5);
+   for (Long64_t i = 0; i < 100000; ++i)
+      h.Fill(rnd.Gaus(0.2, 1.1));
+   TF1 f("ffit", "gaus", -5, 5);
+   for (Long64_t i = 0; i < n; ++i) {
+      f.SetParameters(1000, 0, 1);
+      h.Fit(&f, "QLN0");
+   }
+   return n;
+}
+
+#ifdef BENCH_HAS_RNTUPLE
+const char *kNTupleFile = "benchHotPaths_ntuple.root";
+
+Long64_t BenchNTupleWrite(Long64_t n)
+{
+   using ROOT::Experimental::RNTupleModel;
+   using ROOT::Experimental::RNTupleWriter;
+   auto model = RNTupleModel::Create();
+   auto px = model->MakeField<float>("px");
+   auto py = model->MakeField<float>("py");
+   auto pz = model->MakeField<float>("pz");
+   auto e = model->MakeField<double>("e");
+   auto trkpt = model->MakeField<std::vector<float>>("trkpt");
+   auto writer = RNTupleWriter::Recreate(std::move(model), kTreeName, kNTupleFile);
+   Event ev;
+   TRandom3 rnd(4357);
+   for (Long64_t i = 0; i < n; ++i) {
+      GenerateEvent(rnd, ev);
+      *px = ev.fPx;
+      *py = ev.fPy;
+      *pz = ev.fPz;
+      *e = ev.fE;
+      trkpt->assign(ev.fTrkPt, ev.fTrkPt + ev.fNtrk);
+      writer->Fill();
+   }
+   return n;
+}
+
+Long64_t BenchNTupleRead(Long64_t)
+{
+   auto reader = ROOT::Experimental::RNTupleReader::Open(kTreeName, kNTupleFile);
+   auto px = reader->GetView<float>("px");
+   auto py = reader->GetView<float>("py");
+   auto pz = reader->GetView<float>("pz");
+   auto e = reader->GetView<double>("e");
+   auto trkpt = reader->GetView<std::vector<float>>("trkpt");
+   double sum = 0;
+   for (auto i : reader->GetEntryRange())
+      sum += px(i) + py(i) + pz(i) + e(i) + trkpt(i).size();
+   return sum != 0 ? reader->GetNEntries() : 0;
+}
+#endif
+
+void PrintResults(const std::vector<BenchResult> &results)
+{
+   printf("\n%-22s %12s %12s %12s %12s %14s\n", "benchmark", "items", "min RT [s]", "median RT [s]", "min CPU [s]",
+          "items/s");
+   for (const auto &r : results)
+      printf("%-22s %12lld %12.4f %12.4f %12.4f %14.4g\n", r.fName.c_str(), r.fItems, r.fMinRealTime,
+             r.fMedianRealTime, r.fMinCpuTime, r.fMinRealTime > 0 ? r.fItems / r.fMinRealTime : 0.);
+}
+
+void WriteJSON(const char *fname, const std::vector<BenchResult> &results, int nrep)
+{
+   FILE *out = fopen(fname, "w");
+   if (!out) {
+      printf("Cannot open %s for writing\n", fname);
+      return;
+   }
+   fprintf(out, "{\n  \"root_version\": \"%s\",\n  \"git_commit\": \"%s\",\n  \"repetitions\": %d,\n",
+           gROOT->GetVersion(), gROOT->GetGitCommit(), nrep);
+   fprintf(out, "  \"benchmarks\": [\n");
+   for (std::size_t i = 0; i < results.size(); ++i) {
+      const auto &r = results[i];
+      fprintf(out,
+              "    {\"name\": \"%s\", \"items\": %lld, \"min_real_time\": %g, \"median_real_time\": %g, "
+              "\"min_cpu_time\": %g}%s\n",
+              r.fName.c_str(), r.fItems, r.fMinRealTime, r.fMedianRealTime, r.fMinCpuTime,
+              i + 1 < results.size() ? "," : "");
+   }
+   fprintf(out, "  ]\n}\n");
+   fclose(out);
+}
+
+} // anonymous namespace
+
+//______________________________________________________________________________
+int main(int argc, char **argv)
+{
+   Double_t scale = 1.;
+   int nrep = 5;
+   const char *jsonFile = nullptr;
+   const char *filter = nullptr;
+   for (int i = 1; i < argc; ++i) {
+      if (!strcmp(argv[i], "-n") && i + 1 < argc)
+         scale = atof(argv[++i]);
+      else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+         nrep = std::max(atoi(argv[++i]), 1);
+      else if (!strcmp(argv[i], "-j") && i + 1 < argc)
+         jsonFile = argv[++i];
+      else if (!strcmp(argv[i], "-f") && i + 1 < argc)
+         filter = argv[++i];
+      else {
+         printf("Usage: benchHotPaths [-n scale] [-r repetitions] [-j output.json] [-f name filter]\n");
+         return 1;
+      }
+   }
+
+   const Long64_t nEntries = std::max<Long64_t>(kDefaultEntries * scale, 1000);
+
+   // Reading benchmarks need the standard dataset, written by the preceding Fill benchmarks
+   std::vector<Bench> benches = {
+      {"TBufferFile::Write", BenchBufferWrite, std::max<Long64_t>(20000 * scale, 10)},
+      {"TBufferFile::Read", BenchBufferRead, std::max<Long64_t>(20000 * scale, 10)},
+      {"TTree::Fill", BenchTreeFill, nEntries},
+      {"TTree::GetEntry", BenchTreeGetEntry, nEntries},
+      {"TH1D::Fill", BenchHistFill, 20 * nEntries},
+      {"RDataFrame", BenchDataFrame, nEntries},
+      {"TH1::Fit", BenchFit, std::max<Long64_t>(200 * scale, 1)},
+#ifdef BENCH_HAS_RNTUPLE
+      {"RNTupleWriter::Fill", BenchNTupleWrite, nEntries},
+      {"RNTupleReader", BenchNTupleRead, nEntries},
+#endif
+   };
+
+   printf("benchHotPaths: %d repetitions per benchmark, %lld entries in the standard dataset\n", nrep, nEntries);
+
+   if (filter) {
+      BenchTreeFill(nEntries);
+#ifdef BENCH_HAS_RNTUPLE
+      BenchNTupleWrite(nEntries);
+#endif
+   }
+
+   std::vector<BenchResult> results;
+   for (const auto &bench : benches) {
+      if (filter && bench.fName.find(filter) == std::string::npos)
+         continue;
+      results.emplace_back(RunBench(bench, nrep));
+      printf("%-22s done\n", bench.fName.c_str());
+   }
+
+   PrintResults(results);
+   if (jsonFile)
+      WriteJSON(jsonFile, results, nrep);
+
+   gSystem->Unlink(kDatasetFile);
+#ifdef BENCH_HAS_RNTUPLE
+   gSystem->Unlink(kNTupleFile);
+#endif
+   return 0;
+}
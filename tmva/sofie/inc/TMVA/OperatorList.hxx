@@ -24,3 +24,7 @@
 #include "TMVA/ROperator_Shape.hxx"
 #include "TMVA/ROperator_ConvTranspose.hxx"
 #include "TMVA/ROperator_Custom.hxx"
+#include "TMVA/ROperator_QuantizeLinear.hxx"
+#include "TMVA/ROperator_DequantizeLinear.hxx"
+#include "TMVA/ROperator_QLinearMatMul.hxx"
+#include "TMVA/ROperator_QLinearAdd.hxx"
@@ -24,6 +24,10 @@ enum class Options {
    kDefault = 0x0,
    kNoSession = 0x1,
    kNoWeightFile = 0x2,
+   kNoOperatorFusion = 0x4, // do not fuse Relu and BatchNormalization into the preceding Gemm or Conv
+   kNoMemoryPool = 0x8,     // do not share the memory of the intermediate tensors which are not used at the same time
+   kInlineSmallGemm = 0x10, // compute the small matrix products of Gemm and Conv with fixed-size loops instead of BLAS
+   kGPU = 0x20,             // generate CUDA code, computing the model on a GPU with cuBLAS and CUDA kernels
 };
 
 std::underlying_type_t<Options> operator|(Options opA, Options opB);
@@ -54,6 +58,19 @@ private:
    std::unordered_set<std::string> fCustomOpHeaders;
    bool fUseWeightFile = true;
    bool fUseSession = true;
+   bool fInlineSmallGemm = false;     //! set by Generate with Options::kInlineSmallGemm
+   size_t fInlineGemmMaxSize = 32768; //! maximum number of multiply-adds of an inlined matrix product
+   bool fUseGPU = false;              //! set by Generate with Options::kGPU
+
+   // offsets in a common memory pool of the float intermediate tensors, so that the tensors which are not used at the
+   // same time share their memory; empty if it is not possible
+   std::unordered_map<std::string, size_t> PlanIntermediateMemory(size_t &poolSize) const;
+   // generate infer_batch, computing any number of events with infer, for the models taking batches of events
+   void GenerateInferBatch(size_t batchSize);
+   // generate the CUDA helpers and the kernels of the operators, for Options::kGPU
+   void GenerateGPUHelpers();
+   // generate the Session members holding the device memory of the tensors, for Options::kGPU
+   void GenerateGPUTensors(const std::unordered_map<std::string, size_t> &poolOffsets, size_t poolSize);
 
 public:
 
@@ -101,6 +118,9 @@ public:
 
 
    void Initialize(int batchSize=1);
+   // fuse the operators which can be computed together: a Relu into a preceding Gemm or Conv, and a
+   // BatchNormalization into the weights of a preceding Conv
+   void FuseOperators();
    void Generate(std::underlying_type_t<Options> options, int batchSize = 1);
    void Generate(Options options = Options::kDefault, int batchSize = 1) {
       Generate(static_cast<std::underlying_type_t<Options>>(options), batchSize);
@@ -136,6 +156,12 @@ public:
    void HeadInitializedTensors(std::string name, int n_print = 50);
 
    bool UseSession() const { return fUseSession;}
+   bool UseGPU() const { return fUseGPU; }
+   // the matrix products of at most this number of multiply-adds (M * N * K) are computed without BLAS with
+   // Options::kInlineSmallGemm, by loops specialized for their dimensions
+   void SetInlineGemmMaxSize(size_t size) { fInlineGemmMaxSize = size; }
+   // maximum number of multiply-adds of the matrix products to inline for the current Generate, 0 if none
+   size_t GetInlineGemmMaxSize() const { return fInlineSmallGemm ? fInlineGemmMaxSize : 0; }
 
    ~RModel() {}
 
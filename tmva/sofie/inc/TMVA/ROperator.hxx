@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 #include "TMVA/SOFIE_common.hxx"
 //#include "RModel.hxx"
@@ -31,6 +32,24 @@ public:
    virtual std::string GenerateSessionMembersCode(std::string /*opName*/) { return ""; }
    virtual std::string Header() { return "";}
 
+   // names of the tensors read and written by the operator, used to plan the memory of the intermediate tensors
+   const std::vector<std::string> &GetOpInputTensors() const { return fInputTensorNames; }
+   const std::vector<std::string> &GetOpOutputTensors() const { return fOutputTensorNames; }
+   // whether the generated code accesses the tensors of the operator only through their tensor_ pointers, so that the
+   // intermediate ones can be placed in the memory pool of the model. Operators using the fTensor_ vectors (or aliasing
+   // their output on their input) must return false
+   virtual bool SupportsMemoryPool() const { return true; }
+   // fuse a Relu reading the output of the operator into it: the operator then writes the rectified result directly
+   // into the tensor outputName. Return false if the operator does not support the fusion
+   virtual bool FuseRelu(const std::string & /*outputName*/) { return false; }
+   // whether the operator, once initialized, can be computed on a GPU with Options::kGPU
+   virtual bool SupportsGPU() const { return false; }
+   // CUDA kernels used by the code of GenerateGPU, emitted at namespace scope before the Session
+   virtual std::string GenerateGPUKernels(std::string /*OpName*/) { return ""; }
+   // code computing the operator on the GPU in infer, using the device pointers d_<tensor name> of its tensors and
+   // the cuBLAS handle fCublas of the Session
+   virtual std::string GenerateGPU(std::string /*OpName*/) { return ""; }
+
 
    //virtual void Forward_reference() = 0;
    //irtual void Forward_blas() = 0;
@@ -40,6 +59,33 @@ protected:
    
    const std::string SP = "   ";    ///< space used to correctly indent the generated C++ code
    bool fUseSession = false;        ///< flag to identify if using the session class 
+   std::vector<std::string> fInputTensorNames;  ///< names of the tensors read by the operator
+   std::vector<std::string> fOutputTensorNames; ///< names of the tensors written by the operator
+
+   // set the names of the input and output tensors of the operator, skipping the optional ones which are not given
+   void SetOpTensors(const std::vector<std::string> &inputs, const std::vector<std::string> &outputs) {
+      fInputTensorNames.clear();
+      fOutputTensorNames.clear();
+      for (auto &name : inputs)
+         if (!name.empty()) fInputTensorNames.push_back(name);
+      for (auto &name : outputs)
+         if (!name.empty()) fOutputTensorNames.push_back(name);
+   }
+
+   // CUDA kernel <opName>_kernel(x, y, n) computing y[id] = expr for the n elements, where expr reads x[id] as x
+   std::string GenerateGPUElementwiseKernel(const std::string &opName, const std::string &expr) const {
+      return "__global__ void " + opName + "_kernel(const float * in, float * out, int n) {\n" +
+             SP + "int id = blockIdx.x * blockDim.x + threadIdx.x;\n" +
+             SP + "if (id >= n) return;\n" +
+             SP + "const float x = in[id];\n" +
+             SP + "out[id] = " + expr + ";\n}\n";
+   }
+   // launch of the kernel of GenerateGPUElementwiseKernel on the n elements of the tensors nameX and nameY
+   std::string GenerateGPUElementwiseLaunch(const std::string &opName, const std::string &nameX,
+                                            const std::string &nameY, size_t n) const {
+      return SP + opName + "_kernel<<<" + std::to_string((n + 255) / 256) + ", 256>>>(d_" + nameX + ", d_" + nameY +
+             ", " + std::to_string(n) + ");\n";
+   }
 };
 
 
@@ -63,7 +63,9 @@ private:
 public:
    ROperator_BasicBinary(){}
    ROperator_BasicBinary(std::string nameA, std::string nameB, std::string nameY):
-      fNA(UTILITY::Clean_name(nameA)), fNB(UTILITY::Clean_name(nameB)), fNY(UTILITY::Clean_name(nameY)){}
+      fNA(UTILITY::Clean_name(nameA)), fNB(UTILITY::Clean_name(nameB)), fNY(UTILITY::Clean_name(nameY)){
+         SetOpTensors({fNA, fNB}, {fNY});
+      }
 
    // type of output given input
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input) override {
@@ -171,6 +173,30 @@ public:
       return out.str();
    }
 
+   // the broadcasting of the tensors which are not initialized is done on the CPU only
+   bool SupportsGPU() const override { return fNBroadcadstedA.empty() && fNBroadcadstedB.empty(); }
+
+   std::string GenerateGPUKernels(std::string OpName) override {
+      OpName = "op_" + OpName;
+      std::stringstream out;
+      out << "__global__ void " << OpName << "_kernel(const float * a, const float * b, float * y, int n) {\n";
+      out << SP << "int id = blockIdx.x * blockDim.x + threadIdx.x;\n";
+      out << SP << "if (id >= n) return;\n";
+      out << SP << "y[id] = " << BinaryOperatorTrait<T,Op>::Op("a[id]", "b[id]") << ";\n";
+      out << "}\n";
+      return out.str();
+   }
+
+   std::string GenerateGPU(std::string OpName) override {
+      OpName = "op_" + OpName;
+      size_t length = ConvertShapeToLength(fShapeY);
+      std::stringstream out;
+      out << "\n//------ " << BinaryOperatorTrait<T,Op>::Name() << " (GPU)\n";
+      out << SP << OpName << "_kernel<<<" << (length + 255) / 256 << ", 256>>>(d_" << fNA << ", d_" << fNB << ", d_"
+          << fNY << ", " << length << ");\n";
+      return out.str();
+   }
+
 };
 
 }//SOFIE
@@ -52,6 +52,7 @@ public:
    fNB(UTILITY::Clean_name(nameB)), fNMean(UTILITY::Clean_name(nameMean)), 
    fNVar(UTILITY::Clean_name(nameVar)), fNY(UTILITY::Clean_name(nameY))
    {
+      SetOpTensors({fNX, fNScale, fNB, fNMean, fNVar}, {fNY});
       if(std::is_same<T, float>::value){
       fType = "float";
       }
@@ -60,6 +61,9 @@ public:
 		      std::runtime_error("TMVA SOFIE Encountered unsupported type parsing a BatchNormalization operator");
       }
    }
+
+   // epsilon of the normalization, needed to fold it into a preceding Conv
+   float GetEpsilon() const { return fepsilon; }
 	
 
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input) {
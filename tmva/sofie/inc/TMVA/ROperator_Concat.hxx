@@ -34,6 +34,7 @@
             fInputs.reserve(inputs.size());
             for (auto & name : inputs)
                fInputs.push_back(UTILITY::Clean_name(name));
+            SetOpTensors(fInputs, {fOutput});
          }
 
          std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
@@ -5,6 +5,7 @@
 #include "TMVA/ROperator.hxx"
 #include "TMVA/RModel.hxx"
 
+#include <cmath>
 #include <memory>
 #include <sstream>
 #include <algorithm>
@@ -42,6 +43,9 @@ private:
 
    size_t fDim;   // dimension of the convolution
 
+   bool fFusedRelu = false; // a following Relu is applied to the output
+   size_t fInlineGemmMaxSize = 0; // the products of at most this size are computed by UTILITY::FixedSizeGemm
+
 
 public:
 
@@ -56,6 +60,7 @@ public:
       fNX(UTILITY::Clean_name(nameX)), fNW(UTILITY::Clean_name(nameW)),
       fNB(UTILITY::Clean_name(nameB)), fNY(UTILITY::Clean_name(nameY))
    {
+      SetOpTensors({fNX, fNW, fNB}, {fNY});
       if(std::is_same<T, float>::value) {
          fType = "float";
       } else {
@@ -72,6 +77,7 @@ public:
       fAttrPads(pads), fAttrStrides(strides),
       fNX(UTILITY::Clean_name(nameX)), fNW(UTILITY::Clean_name(nameW)), fNY(UTILITY::Clean_name(nameY))
    {
+      SetOpTensors({fNX, fNW}, {fNY});
       if(std::is_same<T, float>::value) {
          fType = "float";
       } else {
@@ -80,6 +86,65 @@ public:
       }
    }
 
+   bool FuseRelu(const std::string &outputName) {
+      fFusedRelu = true;
+      fNY = outputName;
+      fOutputTensorNames = {fNY};
+      return true;
+   }
+
+   // Fold a BatchNormalization of the output, y = scale * (conv(x, W) + B - mean) / sqrt(var + epsilon) + bias,
+   // into the weights and bias of the convolution: W'[m] = W[m] * s[m] and B'[m] = (B[m] - mean[m]) * s[m] + bias[m],
+   // with s[m] = scale[m] / sqrt(var[m] + epsilon) for the output channel m. The weights are updated in place and the
+   // new bias is stored in the bias tensor of the normalization, which must not be read by other operators.
+   // Return false, without changing anything, if the tensors are not initialized float tensors of the expected shapes.
+   bool FuseBatchNormalization(RModel &model, float epsilon, const std::string &nameScale, const std::string &nameBias,
+                               const std::string &nameMean, const std::string &nameVar, const std::string &outputName)
+   {
+      if (!model.IsInitializedTensor(fNW) || model.GetTensorType(fNW) != ETensorType::FLOAT)
+         return false;
+      const std::vector<size_t> shapeW = model.GetTensorShape(fNW);
+      if (shapeW.size() < 3 || shapeW[0] == 0)
+         return false;
+      const std::vector<size_t> shapeChannels = {shapeW[0]};
+      std::vector<std::string> names = {nameScale, nameBias, nameMean, nameVar};
+      if (!fNB.empty())
+         names.push_back(fNB);
+      for (auto &name : names) {
+         if (!model.IsInitializedTensor(name) || model.GetTensorType(name) != ETensorType::FLOAT ||
+             model.GetTensorShape(name) != shapeChannels)
+            return false;
+      }
+
+      auto data = [&](const std::string &name) {
+         return static_cast<const float *>(model.GetInitializedTensorData(name).get());
+      };
+      const float *w = data(fNW);
+      const float *b = fNB.empty() ? nullptr : data(fNB);
+      const float *scale = data(nameScale);
+      const float *bias = data(nameBias);
+      const float *mean = data(nameMean);
+      const float *var = data(nameVar);
+      const size_t nChannels = shapeW[0];
+      const size_t channelSize = ConvertShapeToLength(shapeW) / nChannels;
+      std::shared_ptr<void> newW(new float[nChannels * channelSize], std::default_delete<float[]>());
+      std::shared_ptr<void> newB(new float[nChannels], std::default_delete<float[]>());
+      float *w2 = static_cast<float *>(newW.get());
+      float *b2 = static_cast<float *>(newB.get());
+      for (size_t m = 0; m < nChannels; m++) {
+         const float s = scale[m] / std::sqrt(var[m] + epsilon);
+         for (size_t k = m * channelSize; k < (m + 1) * channelSize; k++)
+            w2[k] = w[k] * s;
+         b2[m] = ((b ? b[m] : 0.f) - mean[m]) * s + bias[m];
+      }
+      model.UpdateInitializedTensor(fNW, ETensorType::FLOAT, shapeW, newW);
+      model.UpdateInitializedTensor(nameBias, ETensorType::FLOAT, shapeChannels, newB);
+      fNB = nameBias;
+      fNY = outputName;
+      SetOpTensors({fNX, fNW, fNB}, {fNY});
+      return true;
+   }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input) {
       ETensorType out = input[0];
       return {out};
@@ -196,6 +261,7 @@ public:
 
    void Initialize(RModel& model) {
       fUseSession = model.UseSession();
+      fInlineGemmMaxSize = model.GetInlineGemmMaxSize();
       if (!model.CheckIfTensorAlreadyExist(fNX)) {
          throw
             std::runtime_error("TMVA SOFIE Conv op Input Tensor " + fNX + " is not found in model");
@@ -363,16 +429,25 @@ public:
       out << SP << SP << "}\n";
       out << SP << "}\n";
 
-      //out << SP << "char " << OpName << "_transA = 'T';\n";
-      out << SP << "char " << OpName << "_transA = 'N';\n";
-      out << SP << "char " << OpName << "_transB = 'N';\n";
-      out << SP << "int " << OpName << "_m = " << oHeight * oWidth * oDepth << ";\n"; // output h*w
       assert(fShapeY[1] == fShapeW[0]);
       assert(fShapeW[1] == fShapeX[1] / fAttrGroup);
-      out << SP << "int " << OpName << "_n = " << fShapeW[0] << ";\n"; // output channels
-      out << SP << "int " << OpName << "_k = " << fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * fAttrKernelShape[2] << ";\n";
-      out << SP << "float " << OpName << "_alpha = 1.0;\n";
-      out << SP << "float " << OpName << "_beta = 0.0;\n";
+      // product of the kernels (n x k) and of the im2col matrix (k x m), in row-major order
+      size_t gemmM = oHeight * oWidth * oDepth;
+      size_t gemmN = fShapeW[0] / fAttrGroup;
+      size_t gemmK = fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * fAttrKernelShape[2];
+      bool inlineGemm = (gemmM * gemmN * gemmK <= fInlineGemmMaxSize);
+      std::string fixedSizeGemm = "TMVA::Experimental::SOFIE::UTILITY::FixedSizeGemm<" + std::to_string(gemmN) + ", " +
+                                  std::to_string(gemmM) + ", " + std::to_string(gemmK) + ", false, false>(";
+      if (!inlineGemm) {
+         //out << SP << "char " << OpName << "_transA = 'T';\n";
+         out << SP << "char " << OpName << "_transA = 'N';\n";
+         out << SP << "char " << OpName << "_transB = 'N';\n";
+         out << SP << "int " << OpName << "_m = " << oHeight * oWidth * oDepth << ";\n"; // output h*w
+         out << SP << "int " << OpName << "_n = " << fShapeW[0] << ";\n"; // output channels
+         out << SP << "int " << OpName << "_k = " << fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * fAttrKernelShape[2] << ";\n";
+         out << SP << "float " << OpName << "_alpha = 1.0;\n";
+         out << SP << "float " << OpName << "_beta = 0.0;\n";
+      }
 
       if (fUseSession) {
          out << SP << fType << " * " << OpName << "_xcol = fVec_" << OpName << "_xcol.data();\n";
@@ -452,11 +527,16 @@ public:
                 << OpName << "_xcol);\n\n ";
          }
          // BLAS
-         out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
-             << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
-             << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
-         out << SP << SP << SP << OpName << "_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY
-             << " + out_offset, &" << OpName << "_m);\n";
+         if (inlineGemm) {
+            out << SP << SP << fixedSizeGemm << OpName << "_f, " << OpName << "_xcol, tensor_" << fNY
+                << " + out_offset, 1, 0);\n";
+         } else {
+            out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
+                << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
+                << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
+            out << SP << SP << SP << OpName << "_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY
+                << " + out_offset, &" << OpName << "_m);\n";
+         }
       } else {
          // case of group convolution
          // Unroll (IM2COL) the input tensor- make loop on groups and repeat operations (IM2COL + GEMM for each
@@ -499,17 +579,23 @@ public:
 
          // BLAS
          // n must be divided by the number of groups
-         out << SP << SP << SP << OpName << "_n = " << fShapeW[0] / fAttrGroup << ";\n";
+         if (!inlineGemm)
+            out << SP << SP << SP << OpName << "_n = " << fShapeW[0] / fAttrGroup << ";\n";
          // offset g must be  g * k * n
          out << SP << SP << SP << "size_t offset_f = g * "
              << fShapeW[0] * fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * fAttrKernelShape[2] / fAttrGroup 
              << ";\n";
-         out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
-             << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
-             << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
-         out << SP << SP << SP << OpName << "_f + offset_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY
-             << " + out_offset"
-             << ", &" << OpName << "_m);\n";
+         if (inlineGemm) {
+            out << SP << SP << fixedSizeGemm << OpName << "_f + offset_f, " << OpName << "_xcol, tensor_" << fNY
+                << " + out_offset, 1, 0);\n";
+         } else {
+            out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
+                << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
+                << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
+            out << SP << SP << SP << OpName << "_f + offset_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_"
+                << fNY << " + out_offset"
+                << ", &" << OpName << "_m);\n";
+         }
 
          out << SP << SP << "}\n"; // end of group loop
       }
@@ -517,7 +603,12 @@ public:
       out << SP << "}\n"; // end of batch size loop
 
     
-      if (fNB2 != "") {
+      if (fNB2 != "" && inlineGemm) {
+         // without BLAS at all for the small convolutions
+         out << SP << "for (int id = 0; id < " << fShapeY[0] * fShapeY[1] * oDepth * oHeight * oWidth << " ; id++){\n";
+         out << SP << SP << "tensor_" << fNY << "[id] += tensor_" << fNB2 << "[id];\n";
+         out << SP << "}\n";
+      } else if (fNB2 != "") {
          out << SP << "int " << OpName << "_size = " << fShapeY[0] * fShapeY[1] * oDepth * oHeight * oWidth << ";\n";
          out << SP << "float " << OpName << "_gamma = 1.0;\n";
          out << SP << "int " << OpName << "_incx = 1;\n";
@@ -527,6 +618,12 @@ public:
              << OpName << "_incx, tensor_" << fNY << ", &" << OpName << "_incy);\n";
 
       }
+      if (fFusedRelu) {
+         out << SP << "for (int id = 0; id < " << ConvertShapeToLength(fShapeY) << " ; id++){\n";
+         out << SP << SP << "tensor_" << fNY << "[id] = ((tensor_" << fNY << "[id] > 0 )? tensor_" << fNY
+             << "[id] : 0);\n";
+         out << SP << "}\n";
+      }
 
       
       return out.str();
@@ -77,6 +77,7 @@ public:
         fNX(UTILITY::Clean_name(nameX)), fNW(UTILITY::Clean_name(nameW)), fNB(UTILITY::Clean_name(nameB)),
         fNY(UTILITY::Clean_name(nameY))
    {
+      SetOpTensors({fNX, fNW, fNB}, {fNY});
       if (std::is_same<T, float>::value) {
          fType = "float";
       } else {
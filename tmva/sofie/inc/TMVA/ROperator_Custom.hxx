@@ -34,8 +34,12 @@ public:
         for(auto& it:Outputs){
             fOutputNames.emplace_back(UTILITY::Clean_name(it));
         }
+        SetOpTensors(fInputNames, fOutputNames);
     }
 
+    // the custom function is called with the fTensor_ vectors
+    bool SupportsMemoryPool() const { return false; }
+
     std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>>) {return {{}};};
     std::vector<ETensorType> TypeInference(std::vector<ETensorType>){ return {};};
 
@@ -0,0 +1,107 @@
+#ifndef TMVA_SOFIE_ROPERATOR_DEQUANTIZELINEAR
+#define TMVA_SOFIE_ROPERATOR_DEQUANTIZELINEAR
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+/// DequantizeLinear : y = (x - x_zero_point) * x_scale, with x of type T (int8_t, uint8_t or int32_t) and y float.
+/// The scale and the zero point are a scalar, or a 1-D tensor for a quantization per slice along the axis fAttrAxis.
+template <typename T>
+class ROperator_DequantizeLinear final : public ROperator
+{
+
+private:
+
+   int fAttrAxis = 1;
+   std::string fNX;
+   std::string fNScale;
+   std::string fNZeroPoint; // empty if there is no zero point (i.e. it is 0)
+   std::string fNY;
+   std::vector<size_t> fShape;
+   size_t fAxisLength = 1;  // number of scales, 1 for a quantization per tensor
+   size_t fAxisStride = 1;  // distance between two elements along fAttrAxis
+
+public:
+   ROperator_DequantizeLinear(){}
+   ROperator_DequantizeLinear(int axis, std::string nameX, std::string nameScale, std::string nameZeroPoint,
+                              std::string nameY):
+      fAttrAxis(axis), fNX(UTILITY::Clean_name(nameX)), fNScale(UTILITY::Clean_name(nameScale)),
+      fNZeroPoint(UTILITY::Clean_name(nameZeroPoint)), fNY(UTILITY::Clean_name(nameY))
+   {
+      if (fNZeroPoint.empty())
+         SetOpTensors({fNX, fNScale}, {fNY});
+      else
+         SetOpTensors({fNX, fNScale, fNZeroPoint}, {fNY});
+   }
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
+      return std::vector<ETensorType>(input.size(), ETensorType::FLOAT);
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      auto ret = input; //suggest copy to compiler
+      return ret;
+   }
+
+   void Initialize(RModel& model){
+      if (model.CheckIfTensorAlreadyExist(fNX) == false){
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear Op Input Tensor " + fNX + " is not found in model");
+      }
+      if (model.CheckIfTensorAlreadyExist(fNScale) == false){
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear Op scale tensor " + fNScale + " is not found in model");
+      }
+      if (!fNZeroPoint.empty() && model.CheckIfTensorAlreadyExist(fNZeroPoint) == false){
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear Op zero point tensor " + fNZeroPoint +
+                                  " is not found in model");
+      }
+      fShape = model.GetTensorShape(fNX);
+      fAxisLength = ConvertShapeToLength(model.GetTensorShape(fNScale));
+      if (fAxisLength > 1) {
+         if (fAttrAxis < 0) fAttrAxis += fShape.size();
+         if (fAttrAxis < 0 || fAttrAxis >= (int) fShape.size() || fShape[fAttrAxis] != fAxisLength)
+            throw std::runtime_error("TMVA SOFIE DequantizeLinear Op: the scale " + fNScale +
+                                     " does not match the axis " + std::to_string(fAttrAxis) + " of " + fNX);
+         for (size_t i = fAttrAxis + 1; i < fShape.size(); i++)
+            fAxisStride *= fShape[i];
+      }
+      model.AddIntermediateTensor(fNY, ETensorType::FLOAT, fShape);
+   }
+
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear called to Generate without being initialized first");
+      }
+      std::stringstream out;
+      size_t length = ConvertShapeToLength(fShape);
+      std::string index = (fAxisLength > 1) ? "[(id / " + std::to_string(fAxisStride) + ") % " +
+                                              std::to_string(fAxisLength) + "]" : "[0]";
+
+      out << "\n//------ DEQUANTIZELINEAR\n";
+      out << SP << "for (size_t id = 0; id < " << length << " ; id++){\n";
+      out << SP << SP << "tensor_" << fNY << "[id] = ";
+      if (fNZeroPoint.empty())
+         out << "float(tensor_" << fNX << "[id])";
+      else
+         out << "float(int32_t(tensor_" << fNX << "[id]) - int32_t(tensor_" << fNZeroPoint << index << "))";
+      out << " * tensor_" << fNScale << index << ";\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_DEQUANTIZELINEAR
@@ -92,6 +92,7 @@ template <typename T> class ROperator_GRU final : public ROperator {
          fNSequence_lens(UTILITY::Clean_name(nameSequence_lens)),
          fNInitial_h(UTILITY::Clean_name(nameInitial_h)),
          fNY(UTILITY::Clean_name(nameY)), fNY_h(UTILITY::Clean_name(nameY_h)) {
+      SetOpTensors({fNX, fNW, fNR, fNB, fNSequence_lens, fNInitial_h}, {fNY, fNY_h});
       if (std::is_same<T, float>::value) {
          fType = "float";
       } else {
@@ -40,12 +40,16 @@ namespace SOFIE{
 
       std::string fType;
 
+      bool fFusedRelu = false; // a following Relu is applied to the output
+      bool fInlineGemm = false; // the product is computed by UTILITY::FixedSizeGemm instead of BLAS
+
    public:
 
       ROperator_Gemm(){}
       ROperator_Gemm(float alpha, float beta, int_t transA, int_t transB, std::string nameA, std::string nameB, std::string nameY):
          fAttrAlpha(alpha), fAttrBeta(beta), fAttrTransA(transA), fAttrTransB(transB), fNA(UTILITY::Clean_name(nameA)),
          fNB(UTILITY::Clean_name(nameB)), fNY(UTILITY::Clean_name(nameY)) {
+         SetOpTensors({fNA, fNB}, {fNY});
 
          if (std::is_same<T, float>::value) {
             fType = "float";
@@ -57,6 +61,7 @@ namespace SOFIE{
       ROperator_Gemm(float alpha, float beta, int_t transA, int_t transB, std::string nameA, std::string nameB, std::string nameC, std::string nameY):
          fAttrAlpha(alpha), fAttrBeta(beta), fAttrTransA(transA), fAttrTransB(transB), fNA(UTILITY::Clean_name(nameA)),
          fNB(UTILITY::Clean_name(nameB)), fNC(UTILITY::Clean_name(nameC)), fNY(UTILITY::Clean_name(nameY)) {
+         SetOpTensors({fNA, fNB, fNC}, {fNY});
 
          if (std::is_same<T, float>::value) {
             fType = "float";
@@ -65,6 +70,13 @@ namespace SOFIE{
          }
       }
 
+      bool FuseRelu(const std::string &outputName){
+         fFusedRelu = true;
+         fNY = outputName;
+         fOutputTensorNames = {fNY};
+         return true;
+      }
+
       std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
          ETensorType out = input[0];
          return {out};
@@ -134,7 +146,8 @@ namespace SOFIE{
             //                << std::endl;
 
             if (broadcast_needed) {
-               if (!model.UseSession()) {
+               // on the GPU the bias is broadcasted here too, since the initialization code runs on the CPU
+               if (!model.UseSession() || model.UseGPU()) {
                   auto original_data = model.GetInitializedTensorData(fNC);
                   auto targetShape = UTILITY::UnidirectionalBroadcastShape(fShapeC, fShapeY);
                   if (fType == "float") {
@@ -160,6 +173,11 @@ namespace SOFIE{
          model.AddIntermediateTensor(fNY, model.GetTensorType(fNA), fShapeY);
          model.AddNeededStdLib("algorithm");
 
+         size_t m = (fAttrTransA ? fShapeA[1] : fShapeA[0]);
+         size_t n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         size_t k = (fAttrTransA ? fShapeA[0] : fShapeA[1]);
+         fInlineGemm = (m * n * k <= model.GetInlineGemmMaxSize());
+
       }
 
       std::string GenerateInitCode()
@@ -188,18 +206,22 @@ namespace SOFIE{
          }
          std::stringstream out;
          out << "\n//--------- Gemm\n";
-         out << SP << "char " << OpName << "_transA = " << (fAttrTransA ? "\'t\'" : "\'n\'") << ";\n";
-         out << SP << "char " << OpName << "_transB = " << (fAttrTransB ? "\'t\'" : "\'n\'") << ";\n";
          int m = (fAttrTransA ? fShapeA[1] : fShapeA[0]);
          int n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
          int k = (fAttrTransA ? fShapeA[0] : fShapeA[1]);
-         out << SP << "int " << OpName << "_m = " << m << ";\n";
-         out << SP << "int " << OpName << "_n = " << n << ";\n";
-         out << SP << "int " << OpName << "_k = " << k << ";\n";
-         out << SP << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
-         out << SP << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrBeta << ";\n";
-         out << SP << "int " << OpName << "_lda = " << (fAttrTransA ? m : k) << ";\n";
-         out << SP << "int " << OpName << "_ldb = " << (fAttrTransB ? k : n) << ";\n";
+         // without C the output is not read: it is not initialized and may share its memory with other tensors
+         float beta = (fNC != "") ? fAttrBeta : 0;
+         if (!fInlineGemm) {
+            out << SP << "char " << OpName << "_transA = " << (fAttrTransA ? "\'t\'" : "\'n\'") << ";\n";
+            out << SP << "char " << OpName << "_transB = " << (fAttrTransB ? "\'t\'" : "\'n\'") << ";\n";
+            out << SP << "int " << OpName << "_m = " << m << ";\n";
+            out << SP << "int " << OpName << "_n = " << n << ";\n";
+            out << SP << "int " << OpName << "_k = " << k << ";\n";
+            out << SP << "float " << OpName << "_alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ";\n";
+            out << SP << "float " << OpName << "_beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << beta << ";\n";
+            out << SP << "int " << OpName << "_lda = " << (fAttrTransA ? m : k) << ";\n";
+            out << SP << "int " << OpName << "_ldb = " << (fAttrTransB ? k : n) << ";\n";
+         }
          if (fNC != ""){
             size_t length = ConvertShapeToLength(fShapeY);
             if (fNC2 == fNC)
@@ -207,17 +229,66 @@ namespace SOFIE{
                assert(length == ConvertShapeToLength(fShapeC));
             out << SP << "std::copy(" << "tensor_" << fNC2 << ", " << "tensor_" << fNC2 << " + " << length << ", " << "tensor_" << fNY << ");\n";
          }
-         if (fType == "float"){
+         if (fInlineGemm) {
+            out << SP << "TMVA::Experimental::SOFIE::UTILITY::FixedSizeGemm<" << m << ", " << n << ", " << k << ", "
+                << (fAttrTransA ? "true" : "false") << ", " << (fAttrTransB ? "true" : "false") << ">(tensor_" << fNA
+                << ", tensor_" << fNB << ", tensor_" << fNY << ", "
+                << std::setprecision(std::numeric_limits<float>::max_digits10) << fAttrAlpha << ", " << beta << ");\n";
+         } else if (fType == "float"){
             out << SP << "BLAS::sgemm_(&" << OpName << "_transB, &" << OpName << "_transA, &" << OpName
              << "_n, &" << OpName << "_m, &" << OpName << "_k, &" << OpName << "_alpha, " << "tensor_" << fNB
              << ", &" << OpName << "_ldb, " << "tensor_" << fNA << ", &" << OpName << "_lda, &" << OpName << "_beta, " << "tensor_" << fNY << ", &"
              << OpName << "_n);\n";
           }
+         if (fFusedRelu) {
+            out << SP << "for (int id = 0; id < " << ConvertShapeToLength(fShapeY) << " ; id++){\n";
+            out << SP << SP << "tensor_" << fNY << "[id] = ((tensor_" << fNY << "[id] > 0 )? tensor_" << fNY << "[id] : 0);\n";
+            out << SP << "}\n";
+         }
 
           return out.str();
 
          }
 
+      bool SupportsGPU() const { return true; }
+
+      std::string GenerateGPUKernels(std::string OpName) {
+         if (!fFusedRelu) return "";
+         return GenerateGPUElementwiseKernel("op_" + OpName + "_relu", "x > 0 ? x : 0");
+      }
+
+      std::string GenerateGPU(std::string OpName) {
+         OpName = "op_" + OpName;
+         if (fShapeA.empty() || fShapeB.empty() || fShapeY.empty() || (fNC != "" && fShapeC.empty())) {
+            throw std::runtime_error("TMVA SOFIE Gemm Op called to Generate without being initialized first");
+         }
+         std::stringstream out;
+         out << "\n//--------- Gemm (GPU)\n";
+         int m = (fAttrTransA ? fShapeA[1] : fShapeA[0]);
+         int n = (fAttrTransB ? fShapeB[0] : fShapeB[1]);
+         int k = (fAttrTransA ? fShapeA[0] : fShapeA[1]);
+         float beta = (fNC != "") ? fAttrBeta : 0;
+         size_t length = ConvertShapeToLength(fShapeY);
+         out << SP << "{\n";
+         out << SP << SP << "const float alpha = " << std::setprecision(std::numeric_limits<float>::max_digits10)
+             << fAttrAlpha << ";\n";
+         out << SP << SP << "const float beta = " << std::setprecision(std::numeric_limits<float>::max_digits10) << beta
+             << ";\n";
+         if (fNC != "") {
+            out << SP << SP << "GPU::Check(cudaMemcpy(d_" << fNY << ", d_" << fNC << ", " << length
+                << " * sizeof(float), cudaMemcpyDeviceToDevice), \"cudaMemcpy\");\n";
+         }
+         // same column-major product as for BLAS::sgemm_: Y^T = op(B)^T * op(A)^T
+         out << SP << SP << "GPU::Check(cublasSgemm(fCublas.fHandle, " << (fAttrTransB ? "CUBLAS_OP_T" : "CUBLAS_OP_N")
+             << ", " << (fAttrTransA ? "CUBLAS_OP_T" : "CUBLAS_OP_N") << ", " << n << ", " << m << ", " << k
+             << ", &alpha, d_" << fNB << ", " << (fAttrTransB ? k : n) << ", d_" << fNA << ", " << (fAttrTransA ? m : k)
+             << ", &beta, d_" << fNY << ", " << n << "), \"cublasSgemm\");\n";
+         out << SP << "}\n";
+         if (fFusedRelu)
+            out << GenerateGPUElementwiseLaunch(OpName + "_relu", fNY, fNY, length);
+         return out.str();
+      }
+
 
 
    };
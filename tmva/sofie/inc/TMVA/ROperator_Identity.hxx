@@ -24,7 +24,9 @@ private:
 public:
    ROperator_Identity(){}
    ROperator_Identity(std::string nameX, std::string nameY):
-      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){}
+      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){
+      SetOpTensors({fNX}, {fNY});
+   }
 
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
@@ -44,6 +46,9 @@ public:
       model.AddIntermediateTensor(fNY, model.GetTensorType(fNX), fShape);
    }
 
+   // the output pointer is set to the input tensor
+   bool SupportsMemoryPool() const { return false; }
+
 
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
@@ -57,6 +62,16 @@ public:
       return out.str();
    }
 
+   bool SupportsGPU() const { return true; }
+
+   std::string GenerateGPU(std::string /*OpName*/){
+      std::stringstream out;
+      out << "\n//------ IDENTITY (GPU)\n";
+      out << SP << "GPU::Check(cudaMemcpy(d_" << fNY << ", d_" << fNX << ", " << ConvertShapeToLength(fShape)
+          << " * sizeof(float), cudaMemcpyDeviceToDevice), \"cudaMemcpy\");\n";
+      return out.str();
+   }
+
 };
 
 }//SOFIE
@@ -103,6 +103,7 @@ template <typename T> class ROperator_LSTM final : public ROperator {
          fNInitial_c(UTILITY::Clean_name(nameInitial_c)), fNP(UTILITY::Clean_name(nameP)),
          fNY(UTILITY::Clean_name(nameY)), fNY_h(UTILITY::Clean_name(nameY_h)),
          fNY_c(UTILITY::Clean_name(nameY_c)) {
+      SetOpTensors({fNX, fNW, fNR, fNB, fNSequence_lens, fNInitial_h, fNInitial_c, fNP}, {fNY, fNY_h, fNY_c});
       if (std::is_same<T, float>::value) {
          fType = "float";
       } else {
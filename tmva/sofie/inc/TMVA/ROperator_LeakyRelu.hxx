@@ -29,6 +29,7 @@ public:
    ROperator_LeakyRelu(float alpha,std::string nameX, std::string nameY):
    falpha(alpha),fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY))
    {
+      SetOpTensors({fNX}, {fNY});
       if(std::is_same<T, float>::value){
          fType = "float";
       }
@@ -73,6 +74,19 @@ public:
       return out.str();
    }
 
+   bool SupportsGPU() const { return true; }
+
+   std::string GenerateGPUKernels(std::string OpName){
+      std::stringstream alpha;
+      alpha << std::setprecision(std::numeric_limits<float>::max_digits10) << falpha;
+      return GenerateGPUElementwiseKernel("op_" + OpName, "x >= 0 ? x : " + alpha.str() + "f * x");
+   }
+
+   std::string GenerateGPU(std::string OpName){
+      return "\n//------ LEAKY RELU (GPU)\n" +
+             GenerateGPUElementwiseLaunch("op_" + OpName, fNX, fNY, ConvertShapeToLength(fShape));
+   }
+
 };
 
 }//SOFIE
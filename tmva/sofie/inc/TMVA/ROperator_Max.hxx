@@ -30,6 +30,7 @@ public:
       fInputNames.reserve(inputNames.size());
       for (auto & name : inputNames)
          fInputNames.push_back(UTILITY::Clean_name(name));
+      SetOpTensors(fInputNames, {fNY});
    }
 
    // type of output given input 
@@ -0,0 +1,106 @@
+#ifndef TMVA_SOFIE_ROPERATOR_QLINEARADD
+#define TMVA_SOFIE_ROPERATOR_QLINEARADD
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <limits>
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+/// QLinearAdd (com.microsoft domain) : sum of the quantized tensors a and b of the same shape, or b of length 1,
+/// c = saturate(round((a_scale * (a - a_zero_point) + b_scale * (b - b_zero_point)) / c_scale) + c_zero_point)
+/// with the output of type T (int8_t or uint8_t). The quantization is per tensor.
+template <typename T>
+class ROperator_QLinearAdd final : public ROperator
+{
+
+private:
+
+   std::string fNA;
+   std::string fNAScale;
+   std::string fNAZeroPoint;
+   std::string fNB;
+   std::string fNBScale;
+   std::string fNBZeroPoint;
+   std::string fNCScale;
+   std::string fNCZeroPoint;
+   std::string fNC;
+   std::vector<size_t> fShape;
+   bool fBScalar = false;
+
+public:
+   ROperator_QLinearAdd(){}
+   ROperator_QLinearAdd(std::string nameA, std::string nameAScale, std::string nameAZeroPoint, std::string nameB,
+                        std::string nameBScale, std::string nameBZeroPoint, std::string nameCScale,
+                        std::string nameCZeroPoint, std::string nameC):
+      fNA(UTILITY::Clean_name(nameA)), fNAScale(UTILITY::Clean_name(nameAScale)),
+      fNAZeroPoint(UTILITY::Clean_name(nameAZeroPoint)), fNB(UTILITY::Clean_name(nameB)),
+      fNBScale(UTILITY::Clean_name(nameBScale)), fNBZeroPoint(UTILITY::Clean_name(nameBZeroPoint)),
+      fNCScale(UTILITY::Clean_name(nameCScale)), fNCZeroPoint(UTILITY::Clean_name(nameCZeroPoint)),
+      fNC(UTILITY::Clean_name(nameC))
+   {
+      SetOpTensors({fNA, fNAScale, fNAZeroPoint, fNB, fNBScale, fNBZeroPoint, fNCScale, fNCZeroPoint}, {fNC});
+      if (!std::is_same<T, int8_t>::value && !std::is_same<T, uint8_t>::value)
+         throw std::runtime_error("TMVA SOFIE QLinearAdd supports only int8 and uint8 outputs");
+   }
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
+      return {input[0]};
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      return {input[0]};
+   }
+
+   void Initialize(RModel& model){
+      for (auto &name : {fNA, fNAScale, fNAZeroPoint, fNB, fNBScale, fNBZeroPoint, fNCScale, fNCZeroPoint}) {
+         if (model.CheckIfTensorAlreadyExist(name) == false)
+            throw std::runtime_error("TMVA SOFIE QLinearAdd Op Input Tensor " + name + " is not found in model");
+      }
+      fShape = model.GetTensorShape(fNA);
+      auto shapeB = model.GetTensorShape(fNB);
+      fBScalar = ConvertShapeToLength(shapeB) == 1;
+      if (!fBScalar && ConvertShapeToLength(shapeB) != ConvertShapeToLength(fShape)) {
+         throw std::runtime_error("TMVA SOFIE QLinearAdd Op does not support broadcasting " +
+                                  ConvertShapeToString(shapeB) + " to " + ConvertShapeToString(fShape));
+      }
+      model.AddIntermediateTensor(fNC, model.GetTensorType(fNA), fShape);
+      model.AddNeededStdLib("cmath");
+      model.AddNeededStdLib("algorithm");
+   }
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE QLinearAdd called to Generate without being initialized first");
+      }
+      std::stringstream out;
+      size_t length = ConvertShapeToLength(fShape);
+      std::string type = std::is_same<T, int8_t>::value ? "int8_t" : "uint8_t";
+
+      out << "\n//------ QLINEARADD\n";
+      out << SP << "for (size_t id = 0; id < " << length << " ; id++){\n";
+      out << SP << SP << "float " << OpName << "_q = std::nearbyint((tensor_" << fNAScale << "[0] * (int32_t(tensor_"
+          << fNA << "[id]) - int32_t(tensor_" << fNAZeroPoint << "[0])) + tensor_" << fNBScale
+          << "[0] * (int32_t(tensor_" << fNB << (fBScalar ? "[0]" : "[id]") << ") - int32_t(tensor_" << fNBZeroPoint
+          << "[0]))) / tensor_" << fNCScale << "[0]) + tensor_" << fNCZeroPoint << "[0];\n";
+      out << SP << SP << "tensor_" << fNC << "[id] = static_cast<" << type << ">(std::min(std::max(" << OpName
+          << "_q, " << (int) std::numeric_limits<T>::min() << ".f), " << (int) std::numeric_limits<T>::max()
+          << ".f));\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_QLINEARADD
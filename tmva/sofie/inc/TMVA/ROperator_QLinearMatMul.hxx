@@ -0,0 +1,142 @@
+#ifndef TMVA_SOFIE_ROPERATOR_QLINEARMATMUL
+#define TMVA_SOFIE_ROPERATOR_QLINEARMATMUL
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <limits>
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+/// QLinearMatMul : product of the quantized matrices a (M x K) and b (K x N), a with any number of leading
+/// dimensions that are flattened in M. The products are accumulated in int32 and the result is requantized to the
+/// output type T (int8_t or uint8_t) with the scale a_scale * b_scale / y_scale. The quantization of b can be per
+/// column, with a scale and a zero point of length N.
+template <typename T>
+class ROperator_QLinearMatMul final : public ROperator
+{
+
+private:
+
+   std::string fNA;
+   std::string fNAScale;
+   std::string fNAZeroPoint;
+   std::string fNB;
+   std::string fNBScale;
+   std::string fNBZeroPoint;
+   std::string fNYScale;
+   std::string fNYZeroPoint;
+   std::string fNY;
+   std::vector<size_t> fShapeA;
+   std::vector<size_t> fShapeB;
+   std::vector<size_t> fShapeY;
+   bool fBPerColumn = false;
+
+public:
+   ROperator_QLinearMatMul(){}
+   ROperator_QLinearMatMul(std::string nameA, std::string nameAScale, std::string nameAZeroPoint, std::string nameB,
+                           std::string nameBScale, std::string nameBZeroPoint, std::string nameYScale,
+                           std::string nameYZeroPoint, std::string nameY):
+      fNA(UTILITY::Clean_name(nameA)), fNAScale(UTILITY::Clean_name(nameAScale)),
+      fNAZeroPoint(UTILITY::Clean_name(nameAZeroPoint)), fNB(UTILITY::Clean_name(nameB)),
+      fNBScale(UTILITY::Clean_name(nameBScale)), fNBZeroPoint(UTILITY::Clean_name(nameBZeroPoint)),
+      fNYScale(UTILITY::Clean_name(nameYScale)), fNYZeroPoint(UTILITY::Clean_name(nameYZeroPoint)),
+      fNY(UTILITY::Clean_name(nameY))
+   {
+      SetOpTensors({fNA, fNAScale, fNAZeroPoint, fNB, fNBScale, fNBZeroPoint, fNYScale, fNYZeroPoint}, {fNY});
+      if (!std::is_same<T, int8_t>::value && !std::is_same<T, uint8_t>::value)
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul supports only int8 and uint8 outputs");
+   }
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
+      ETensorType out = std::is_same<T, int8_t>::value ? ETensorType::INT8 : ETensorType::UNINT8;
+      return std::vector<ETensorType>(1, out);
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      if (input.size() != 2 || input[0].size() < 2 || input[1].size() != 2 ||
+          input[0].back() != input[1][0]) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op needs a matrix a (... x M x K) and b (K x N)");
+      }
+      auto ret = input[0];
+      ret.back() = input[1][1];
+      return {ret};
+   }
+
+   void Initialize(RModel& model){
+      for (auto &name : {fNA, fNAScale, fNAZeroPoint, fNB, fNBScale, fNBZeroPoint, fNYScale, fNYZeroPoint}) {
+         if (model.CheckIfTensorAlreadyExist(name) == false)
+            throw std::runtime_error("TMVA SOFIE QLinearMatMul Op Input Tensor " + name + " is not found in model");
+      }
+      fShapeA = model.GetTensorShape(fNA);
+      fShapeB = model.GetTensorShape(fNB);
+      fShapeY = ShapeInference({fShapeA, fShapeB})[0];
+      if (ConvertShapeToLength(model.GetTensorShape(fNAScale)) != 1 ||
+          ConvertShapeToLength(model.GetTensorShape(fNYScale)) != 1) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op supports only a quantization per tensor of a and y");
+      }
+      size_t nBScale = ConvertShapeToLength(model.GetTensorShape(fNBScale));
+      if (nBScale != 1 && nBScale != fShapeB[1]) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op: the scale of b must be a scalar or one per column");
+      }
+      fBPerColumn = nBScale > 1;
+      model.AddIntermediateTensor(fNY, TypeInference({})[0], fShapeY);
+      model.AddNeededStdLib("cmath");
+      model.AddNeededStdLib("algorithm");
+   }
+
+   std::string GenerateSessionMembersCode(std::string OpName){
+      OpName = "op_" + OpName;
+      std::stringstream out;
+      // int32 accumulators of a row of the output
+      out << "std::vector<int32_t> fVec_" << OpName << "_acc = std::vector<int32_t>(" << fShapeB[1] << ");\n";
+      return out.str();
+   }
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShapeY.empty()) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul called to Generate without being initialized first");
+      }
+      std::stringstream out;
+      size_t m = ConvertShapeToLength(fShapeA) / fShapeA.back();
+      size_t k = fShapeB[0];
+      size_t n = fShapeB[1];
+      std::string type = std::is_same<T, int8_t>::value ? "int8_t" : "uint8_t";
+      std::string indexB = fBPerColumn ? "[j]" : "[0]";
+
+      out << "\n//------ QLINEARMATMUL\n";
+      out << SP << "int32_t * " << OpName << "_acc = fVec_" << OpName << "_acc.data();\n";
+      out << SP << "for (size_t i = 0; i < " << m << "; i++) {\n";
+      out << SP << SP << "std::fill(" << OpName << "_acc, " << OpName << "_acc + " << n << ", 0);\n";
+      out << SP << SP << "for (size_t l = 0; l < " << k << "; l++) {\n";
+      out << SP << SP << SP << "const int32_t a = int32_t(tensor_" << fNA << "[i * " << k << " + l]) - int32_t(tensor_"
+          << fNAZeroPoint << "[0]);\n";
+      out << SP << SP << SP << "for (size_t j = 0; j < " << n << "; j++)\n";
+      out << SP << SP << SP << SP << OpName << "_acc[j] += a * (int32_t(tensor_" << fNB << "[l * " << n
+          << " + j]) - int32_t(tensor_" << fNBZeroPoint << indexB << "));\n";
+      out << SP << SP << "}\n";
+      out << SP << SP << "for (size_t j = 0; j < " << n << "; j++) {\n";
+      out << SP << SP << SP << "float " << OpName << "_q = std::nearbyint(" << OpName << "_acc[j] * (tensor_"
+          << fNAScale << "[0] * tensor_" << fNBScale << indexB << " / tensor_" << fNYScale
+          << "[0])) + tensor_" << fNYZeroPoint << "[0];\n";
+      out << SP << SP << SP << "tensor_" << fNY << "[i * " << n << " + j] = static_cast<" << type
+          << ">(std::min(std::max(" << OpName << "_q, " << (int) std::numeric_limits<T>::min() << ".f), "
+          << (int) std::numeric_limits<T>::max() << ".f));\n";
+      out << SP << SP << "}\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_QLINEARMATMUL
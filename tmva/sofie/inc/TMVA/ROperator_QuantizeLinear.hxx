@@ -0,0 +1,120 @@
+#ifndef TMVA_SOFIE_ROPERATOR_QUANTIZELINEAR
+#define TMVA_SOFIE_ROPERATOR_QUANTIZELINEAR
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <limits>
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+/// QuantizeLinear : y = saturate(round(x / y_scale) + y_zero_point), with x float and y of type T (int8_t or
+/// uint8_t, the type of y_zero_point, uint8_t if there is none). The scale and the zero point are a scalar, or a 1-D
+/// tensor for a quantization per slice along the axis fAttrAxis.
+template <typename T>
+class ROperator_QuantizeLinear final : public ROperator
+{
+
+private:
+
+   int fAttrAxis = 1;
+   std::string fNX;
+   std::string fNScale;
+   std::string fNZeroPoint; // empty if there is no zero point (i.e. it is 0)
+   std::string fNY;
+   std::vector<size_t> fShape;
+   size_t fAxisLength = 1;  // number of scales, 1 for a quantization per tensor
+   size_t fAxisStride = 1;  // distance between two elements along fAttrAxis
+
+public:
+   ROperator_QuantizeLinear(){}
+   ROperator_QuantizeLinear(int axis, std::string nameX, std::string nameScale, std::string nameZeroPoint,
+                            std::string nameY):
+      fAttrAxis(axis), fNX(UTILITY::Clean_name(nameX)), fNScale(UTILITY::Clean_name(nameScale)),
+      fNZeroPoint(UTILITY::Clean_name(nameZeroPoint)), fNY(UTILITY::Clean_name(nameY))
+   {
+      if (fNZeroPoint.empty())
+         SetOpTensors({fNX, fNScale}, {fNY});
+      else
+         SetOpTensors({fNX, fNScale, fNZeroPoint}, {fNY});
+      if (!std::is_same<T, int8_t>::value && !std::is_same<T, uint8_t>::value)
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear supports only int8 and uint8 outputs");
+   }
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
+      ETensorType out = std::is_same<T, int8_t>::value ? ETensorType::INT8 : ETensorType::UNINT8;
+      return std::vector<ETensorType>(input.size(), out);
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      auto ret = input; //suggest copy to compiler
+      return ret;
+   }
+
+   void Initialize(RModel& model){
+      if (model.CheckIfTensorAlreadyExist(fNX) == false){
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op Input Tensor " + fNX + " is not found in model");
+      }
+      if (model.CheckIfTensorAlreadyExist(fNScale) == false){
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op scale tensor " + fNScale + " is not found in model");
+      }
+      if (!fNZeroPoint.empty() && model.CheckIfTensorAlreadyExist(fNZeroPoint) == false){
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op zero point tensor " + fNZeroPoint +
+                                  " is not found in model");
+      }
+      if (model.GetTensorType(fNX) != ETensorType::FLOAT){
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op supports only float inputs");
+      }
+      fShape = model.GetTensorShape(fNX);
+      fAxisLength = ConvertShapeToLength(model.GetTensorShape(fNScale));
+      if (fAxisLength > 1) {
+         if (fAttrAxis < 0) fAttrAxis += fShape.size();
+         if (fAttrAxis < 0 || fAttrAxis >= (int) fShape.size() || fShape[fAttrAxis] != fAxisLength)
+            throw std::runtime_error("TMVA SOFIE QuantizeLinear Op: the scale " + fNScale +
+                                     " does not match the axis " + std::to_string(fAttrAxis) + " of " + fNX);
+         for (size_t i = fAttrAxis + 1; i < fShape.size(); i++)
+            fAxisStride *= fShape[i];
+      }
+      model.AddIntermediateTensor(fNY, TypeInference({ETensorType::FLOAT})[0], fShape);
+      model.AddNeededStdLib("cmath");
+      model.AddNeededStdLib("algorithm");
+   }
+
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear called to Generate without being initialized first");
+      }
+      std::stringstream out;
+      size_t length = ConvertShapeToLength(fShape);
+      std::string type = std::is_same<T, int8_t>::value ? "int8_t" : "uint8_t";
+      std::string index = (fAxisLength > 1) ? "[(id / " + std::to_string(fAxisStride) + ") % " +
+                                              std::to_string(fAxisLength) + "]" : "[0]";
+
+      out << "\n//------ QUANTIZELINEAR\n";
+      out << SP << "for (size_t id = 0; id < " << length << " ; id++){\n";
+      out << SP << SP << "float " << OpName << "_q = std::nearbyint(tensor_" << fNX << "[id] / tensor_" << fNScale
+          << index << ")";
+      if (!fNZeroPoint.empty())
+         out << " + tensor_" << fNZeroPoint << index;
+      out << ";\n";
+      out << SP << SP << "tensor_" << fNY << "[id] = static_cast<" << type << ">(std::min(std::max(" << OpName
+          << "_q, " << (int) std::numeric_limits<T>::min() << ".f), " << (int) std::numeric_limits<T>::max()
+          << ".f));\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_QUANTIZELINEAR
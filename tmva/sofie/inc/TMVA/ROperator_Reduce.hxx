@@ -45,6 +45,7 @@ public:
    ROperator_Reduce(int keepdims,int attrAxes,std::string nameX, std::string nameY):
    fkeepdims(keepdims), fAttrAxes(attrAxes), fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)) {
       fReduceOpMode = Op;
+      SetOpTensors({fNX}, {fNY});
    }
 
    // type of output given input
@@ -41,6 +41,7 @@ public:
    {
       if (opMode == Reshape) fAllowZero = attr_value;
       if (opMode == Flatten) fAxis = attr_value;
+      SetOpTensors({fNData, fNShape}, {fNOutput});
    }
 
    // for squeeze/unsqueezed operators following old ONNX version (< 10)
@@ -50,6 +51,7 @@ public:
         fAttrAxes(attrAxes)
    {
       assert(fOpMode == Squeeze || fOpMode == Unsqueeze);
+      SetOpTensors({fNData}, {fNOutput});
    }
 
    // output type is same as input
@@ -175,6 +177,9 @@ public:
       model.AddIntermediateTensor(fNOutput, model.GetTensorType(fNData), fShapeOutput);
    }
 
+   // the data are copied between the fTensor_ vectors
+   bool SupportsMemoryPool() const { return false; }
+
    std::string Generate(std::string OpName)
    {
       OpName = "op_" + OpName;
@@ -206,6 +211,17 @@ public:
           << ".begin() );\n";
       return out.str();
    }
+
+   bool SupportsGPU() const { return true; }
+
+   std::string GenerateGPU(std::string /*OpName*/){
+      std::stringstream out;
+      out << "\n//------ RESHAPE (GPU)\n";
+      out << SP << "GPU::Check(cudaMemcpy(d_" << fNOutput << ", d_" << fNData << ", "
+          << ConvertShapeToLength(fShapeOutput) << " * sizeof(float), cudaMemcpyDeviceToDevice), \"cudaMemcpy\");\n";
+      return out.str();
+   }
+
 };
 
 }//SOFIE
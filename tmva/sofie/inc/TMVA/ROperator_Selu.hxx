@@ -24,7 +24,9 @@ private:
 public:
    ROperator_Selu(){}
    ROperator_Selu(std::string nameX, std::string nameY):
-      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){}
+      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){
+      SetOpTensors({fNX}, {fNY});
+   }
 
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
@@ -60,6 +62,18 @@ public:
       return out.str();
    }
 
+   bool SupportsGPU() const { return true; }
+
+   std::string GenerateGPUKernels(std::string OpName){
+      return GenerateGPUElementwiseKernel("op_" + OpName, "1.0507009873554804934193349852946f * (fmaxf(0.f, x) + "
+                                          "fminf(0.f, 1.6732632423543772848170429916717f * (expf(x) - 1)))");
+   }
+
+   std::string GenerateGPU(std::string OpName){
+      return "\n//------ SELU (GPU)\n" +
+             GenerateGPUElementwiseLaunch("op_" + OpName, fNX, fNY, ConvertShapeToLength(fShape));
+   }
+
 };
 
 }//SOFIE
@@ -24,7 +24,9 @@ private:
 public:
    ROperator_Sigmoid(){}
    ROperator_Sigmoid(std::string nameX, std::string nameY):
-      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){}
+      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){
+      SetOpTensors({fNX}, {fNY});
+   }
 
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
@@ -60,6 +62,17 @@ public:
       return out.str();
    }
 
+   bool SupportsGPU() const { return true; }
+
+   std::string GenerateGPUKernels(std::string OpName){
+      return GenerateGPUElementwiseKernel("op_" + OpName, "1 / (1 + expf(-x))");
+   }
+
+   std::string GenerateGPU(std::string OpName){
+      return "\n//------ SIGMOID (GPU)\n" +
+             GenerateGPUElementwiseLaunch("op_" + OpName, fNX, fNY, ConvertShapeToLength(fShape));
+   }
+
 };
 
 }//SOFIE
@@ -53,6 +53,9 @@ public:
         fNames[3] = fNames[2];
         fNames[2] = "";
     }
+    std::vector<std::string> inputs = fNames;
+    inputs.insert(inputs.begin(), fNData);
+    SetOpTensors(inputs, {fNOutput});
    }
    // ctor for versions < 10
    ROperator_Slice(std::string nameData, std::vector<IType> starts, std::vector<IType> ends, std::vector<IType> axes, std::string nameOutput)
@@ -62,6 +65,7 @@ public:
      fAttributes.push_back(starts);
      fAttributes.push_back(ends);
      fAttributes.push_back(axes); 
+     SetOpTensors({fNData}, {fNOutput});
     }
 
    // output type is same as input 
@@ -158,6 +162,9 @@ public:
       model.AddIntermediateTensor(fNOutput, model.GetTensorType(fNData), fShapeOutput);
    }
 
+   // the data are copied between the fTensor_ vectors
+   bool SupportsMemoryPool() const { return false; }
+
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
       if (fShapeInput.empty() || fShapeOutput.empty()){
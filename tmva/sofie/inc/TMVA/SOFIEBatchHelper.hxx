@@ -0,0 +1,137 @@
+#ifndef TMVA_SOFIE_SOFIE_BATCH_HELPER
+#define TMVA_SOFIE_SOFIE_BATCH_HELPER
+
+#include "ROOT/RDF/RActionImpl.hxx"
+#include "RtypesCore.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+class TTreeReader;
+
+namespace TMVA{
+namespace Experimental{
+
+/// SofieBatchHelper : RDataFrame action, booked with RInterface::Book(), evaluating a model generated by SOFIE on
+/// batches of entries instead of one entry at a time as SofieFunctor. The N input values of each entry (the features
+/// of the single input tensor of the model) are accumulated per slot, and the model is evaluated with the
+/// infer_batch function of its Session when batchSize entries are buffered, and at the end of the event loop.
+///
+/// The result is the model output of all the processed entries, ordered by entry number: for M output values per
+/// entry, the outputs of the i-th processed entry are the elements i * M to (i + 1) * M - 1. The entry number must
+/// be passed as first column:
+/// ~~~{.cpp}
+/// // generated with model.Generate(TMVA::Experimental::SOFIE::Options::kDefault, 256)
+/// using Helper_t = TMVA::Experimental::SofieBatchHelper<7, TMVA_SOFIE_Higgs_model::Session>;
+/// auto dnn = df.Book<ULong64_t, float, float, float, float, float, float, float>(
+///    Helper_t(df.GetNSlots(), "Higgs_model.dat"),
+///    {"rdfentry_", "m_jj", "m_jjj", "m_lv", "m_jlv", "m_bb", "m_wbb", "m_wwbb"});
+/// ~~~
+/// The model evaluation is efficient when the model is generated for a batch size of the order of the batchSize of
+/// the helper (64 - 1024 events): its matrix products are then computed for all the events of a batch at once.
+template <std::size_t N, typename Session_t, typename T = float>
+class SofieBatchHelper : public ROOT::Detail::RDF::RActionImpl<SofieBatchHelper<N, Session_t, T>> {
+
+   /// the buffered entries of a slot and the results of the evaluated batches
+   struct SlotData {
+      std::vector<T> fInputs;                  // N values per buffered entry
+      std::vector<ULong64_t> fEntries;         // entry numbers of the buffered entries
+      std::vector<ULong64_t> fDoneEntries;     // entry numbers of the evaluated entries
+      std::vector<T> fOutputs;                 // outputs of the evaluated entries
+      std::size_t fOutputSize = 0;             // number of outputs per entry
+   };
+
+   std::shared_ptr<std::vector<T>> fResult;
+   std::vector<Session_t> fSessions;
+   std::vector<SlotData> fSlots;
+   std::size_t fBatchSize;
+
+   void Evaluate(unsigned int slot)
+   {
+      auto &data = fSlots[slot];
+      if (data.fEntries.empty())
+         return;
+      auto y = fSessions[slot].infer_batch(data.fEntries.size(), data.fInputs.data());
+      data.fOutputSize = y.size() / data.fEntries.size();
+      data.fOutputs.insert(data.fOutputs.end(), y.begin(), y.end());
+      data.fDoneEntries.insert(data.fDoneEntries.end(), data.fEntries.begin(), data.fEntries.end());
+      data.fInputs.clear();
+      data.fEntries.clear();
+   }
+
+public:
+   using Result_t = std::vector<T>;
+
+   SofieBatchHelper(unsigned int nslots = 0, const std::string &filename = "", std::size_t batchSize = 256)
+      : fResult(std::make_shared<std::vector<T>>()), fBatchSize(batchSize > 0 ? batchSize : 1)
+   {
+      // one Session per slot, as for SofieFunctor
+      if (nslots < 1) nslots = 1;
+      fSessions.reserve(nslots);
+      for (unsigned int i = 0; i < nslots; i++) {
+         fSessions.emplace_back(filename);
+      }
+      fSlots.resize(nslots);
+   }
+   SofieBatchHelper(SofieBatchHelper &&) = default;
+   SofieBatchHelper(const SofieBatchHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   void Initialize()
+   {
+      for (auto &data : fSlots) {
+         data.fInputs.reserve(fBatchSize * N);
+         data.fEntries.reserve(fBatchSize);
+      }
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   template <typename... Cols>
+   void Exec(unsigned int slot, ULong64_t entry, const Cols &...cols)
+   {
+      static_assert(sizeof...(Cols) == N, "SofieBatchHelper: the entry number must be followed by N input columns");
+      auto &data = fSlots[slot];
+      data.fEntries.push_back(entry);
+      int expander[] = {(data.fInputs.push_back(static_cast<T>(cols)), 0)...};
+      (void)expander;
+      if (data.fEntries.size() >= fBatchSize)
+         Evaluate(slot);
+   }
+
+   void Finalize()
+   {
+      for (unsigned int slot = 0; slot < fSlots.size(); slot++)
+         Evaluate(slot);
+      // order the outputs of all the slots by entry number
+      std::vector<std::pair<ULong64_t, const T *>> outputs;
+      std::size_t outputSize = 0;
+      for (auto &data : fSlots) {
+         if (data.fOutputSize > 0) outputSize = data.fOutputSize;
+         for (std::size_t i = 0; i < data.fDoneEntries.size(); i++)
+            outputs.emplace_back(data.fDoneEntries[i], data.fOutputs.data() + i * data.fOutputSize);
+      }
+      std::sort(outputs.begin(), outputs.end(),
+                [](const std::pair<ULong64_t, const T *> &a, const std::pair<ULong64_t, const T *> &b) {
+                   return a.first < b.first;
+                });
+      fResult->clear();
+      fResult->reserve(outputs.size() * outputSize);
+      for (auto &output : outputs)
+         fResult->insert(fResult->end(), output.second, output.second + outputSize);
+      for (auto &data : fSlots)
+         data = SlotData();
+   }
+
+   std::string GetActionName() { return "SofieBatch"; }
+};
+
+}//Experimental
+}//TMVA
+
+#endif //TMVA_SOFIE_SOFIE_BATCH_HELPER
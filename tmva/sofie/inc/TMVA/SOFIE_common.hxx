@@ -31,6 +31,12 @@ typedef std::int64_t int_t;
 std::string ConvertTypeToString(ETensorType type);
 ETensorType ConvertStringToType(std::string type);
 
+/// whether the type is one of the integer types of the tensors of the quantized models
+/// (int8, uint8, int16, uint16 or int32)
+bool IsQuantizedType(ETensorType type);
+/// value of the element i of integer data of the given type, converted to int64_t
+std::int64_t GetIntegerValue(ETensorType type, const void *data, std::size_t i);
+
 struct Dim{
    bool isParam = false;
    size_t dim;
@@ -67,6 +73,12 @@ struct InitializedTensor{
       }
       switch(fType){
          case ETensorType::FLOAT: fSize*=sizeof(float); break;
+         // integer tensors of the quantized models
+         case ETensorType::INT8:
+         case ETensorType::UNINT8: break;
+         case ETensorType::INT16:
+         case ETensorType::UINT16: fSize*=sizeof(int16_t); break;
+         case ETensorType::INT32: fSize*=sizeof(int32_t); break;
          default:
           throw std::runtime_error("TMVA::SOFIE doesn't yet supports serialising data-type " + ConvertTypeToString(fType));
       }
@@ -80,6 +92,17 @@ struct InitializedTensor{
       fData=tData;
       break;
       }
+      case ETensorType::INT8:
+      case ETensorType::UNINT8:
+      case ETensorType::INT16:
+      case ETensorType::UINT16:
+      case ETensorType::INT32: {
+      // fSize is the size in bytes
+      std::shared_ptr<void> tData(malloc(fSize), free);
+      std::memcpy(tData.get(), fPersistentData, fSize);
+      fData=tData;
+      break;
+      }
       default: {
           throw std::runtime_error("TMVA::SOFIE doesn't yet supports serialising data-type " + ConvertTypeToString(fType));
       }
@@ -346,6 +369,43 @@ void Im2col_3d(const T *data_im, const int channels,
 
 
 
+/// FixedSizeGemm : matrix product Y = alpha * op(A) * op(B) + beta * Y of row-major matrices, with op(A) of shape
+/// (M, K), op(B) of shape (K, N) and op(X) = X or its transpose. It is used by the generated code instead of BLAS for
+/// the small matrices, whose BLAS calls cost more than the computation: the dimensions are known at compile time, so
+/// that the compiler unrolls and vectorizes the loops, and no BLAS library is needed.
+/// Y is not read when beta is 0, so that it can be left uninitialized
+template <int M, int N, int K, bool TransA, bool TransB>
+inline void FixedSizeGemm(const float *A, const float *B, float *Y, float alpha, float beta)
+{
+   for (int i = 0; i < M; i++) {
+      float *y = Y + i * N;
+      if (beta == 0) {
+         for (int j = 0; j < N; j++)
+            y[j] = 0;
+      } else if (beta != 1) {
+         for (int j = 0; j < N; j++)
+            y[j] *= beta;
+      }
+      if (TransB) {
+         // the rows of B are contiguous in k: dot products
+         for (int j = 0; j < N; j++) {
+            float sum = 0;
+            for (int k = 0; k < K; k++)
+               sum += (TransA ? A[k * M + i] : A[i * K + k]) * B[j * K + k];
+            y[j] += alpha * sum;
+         }
+      } else {
+         // the rows of B and Y are contiguous in j: axpy of the rows of B
+         for (int k = 0; k < K; k++) {
+            const float a = alpha * (TransA ? A[k * M + i] : A[i * K + k]);
+            const float *b = B + k * N;
+            for (int j = 0; j < N; j++)
+               y[j] += a * b[j];
+         }
+      }
+   }
+}
+
 }  // end namespace UTILITY
 
 namespace BLAS{
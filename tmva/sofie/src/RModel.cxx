@@ -1,9 +1,14 @@
 #include <limits>
 #include <algorithm>
 #include <cctype>
+#include <iterator>
+#include <map>
 
 #include "TMVA/RModel.hxx"
 #include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator_BatchNormalization.hxx"
+#include "TMVA/ROperator_Conv.hxx"
+#include "TMVA/ROperator_Relu.hxx"
 
 
 
@@ -33,6 +38,7 @@ namespace SOFIE{
       fGC = other.fGC;
       fNeededBlasRoutines = other.fNeededBlasRoutines;
       fNeededStdLib = other.fNeededStdLib;
+      fInlineGemmMaxSize = other.fInlineGemmMaxSize;
    }
 
    RModel& RModel::operator=(RModel&& other){
@@ -49,6 +55,7 @@ namespace SOFIE{
       fGC = other.fGC;
       fNeededBlasRoutines = other.fNeededBlasRoutines;
       fNeededStdLib = other.fNeededStdLib;
+      fInlineGemmMaxSize = other.fInlineGemmMaxSize;
       return *this;
    }
 
@@ -224,17 +231,203 @@ namespace SOFIE{
       }
    }
 
+   void RModel::FuseOperators(){
+      auto isOutput = [&](const std::string &name) {
+         return std::find(fOutputTensorNames.begin(), fOutputTensorNames.end(), name) != fOutputTensorNames.end();
+      };
+      auto countReaders = [&](const std::string &name, size_t *lastReader = nullptr) {
+         int n = 0;
+         for (size_t j = 0; j < fOperators.size(); j++) {
+            const auto &inputs = fOperators[j]->GetOpInputTensors();
+            if (std::find(inputs.begin(), inputs.end(), name) != inputs.end()) {
+               n++;
+               if (lastReader) *lastReader = j;
+            }
+         }
+         return n;
+      };
+      // the initialized tensors only read by the removed operators are removed too
+      std::vector<std::string> unusedTensors;
+
+      for (size_t i = 0; i < fOperators.size(); ) {
+         // the output of the operator must be read only by the operator to fuse
+         const auto &outputs = fOperators[i]->GetOpOutputTensors();
+         size_t next = 0;
+         if (outputs.size() != 1 || isOutput(outputs[0]) || countReaders(outputs[0], &next) != 1 || next <= i) {
+            i++;
+            continue;
+         }
+         ROperator *op = fOperators[next].get();
+         bool fused = false;
+         if (dynamic_cast<ROperator_Relu<float> *>(op)) {
+            fused = fOperators[i]->FuseRelu(op->GetOpOutputTensors()[0]);
+         } else if (auto bn = dynamic_cast<ROperator_BatchNormalization<float> *>(op)) {
+            auto conv = dynamic_cast<ROperator_Conv<float> *>(fOperators[i].get());
+            // inputs of the normalization: X, scale, bias, mean and variance
+            const auto &bnInputs = bn->GetOpInputTensors();
+            const auto &convInputs = fOperators[i]->GetOpInputTensors();
+            // the tensors which are modified must not be read by other operators
+            if (conv && bnInputs.size() == 5 && convInputs.size() >= 2 && countReaders(convInputs[1]) == 1 &&
+                (convInputs.size() < 3 || countReaders(convInputs[2]) == 1) && countReaders(bnInputs[2]) == 1) {
+               std::vector<std::string> candidates = {bnInputs[1], bnInputs[3], bnInputs[4]};
+               if (convInputs.size() == 3) candidates.push_back(convInputs[2]);
+               fused = conv->FuseBatchNormalization(*this, bn->GetEpsilon(), bnInputs[1], bnInputs[2], bnInputs[3],
+                                                    bnInputs[4], bn->GetOpOutputTensors()[0]);
+               if (fused)
+                  unusedTensors.insert(unusedTensors.end(), candidates.begin(), candidates.end());
+            }
+         }
+         if (fused) {
+            // the fused operator is tried again with its new successor, e.g. for a Conv, BatchNormalization and Relu
+            fOperators.erase(fOperators.begin() + next);
+         } else {
+            i++;
+         }
+      }
+
+      for (auto &name : unusedTensors) {
+         if (countReaders(name) == 0 && !isOutput(name))
+            fInitializedTensors.erase(name);
+      }
+   }
+
+   std::unordered_map<std::string, size_t> RModel::PlanIntermediateMemory(size_t &poolSize) const {
+      // the blocks are aligned to 64 bytes (with respect to the start of the pool)
+      const size_t alignment = 16;
+      poolSize = 0;
+
+      // the tensors which can be placed in the pool: float intermediate tensors written by a single operator, not
+      // outputs of the model, and only accessed through their pointers
+      std::unordered_set<std::string> excluded(fOutputTensorNames.begin(), fOutputTensorNames.end());
+      for (auto &op : fOperators) {
+         // the tensors of the operators are needed to know when they are used
+         if (op->GetOpOutputTensors().empty()) return {};
+         if (!op->SupportsMemoryPool()) {
+            excluded.insert(op->GetOpInputTensors().begin(), op->GetOpInputTensors().end());
+            excluded.insert(op->GetOpOutputTensors().begin(), op->GetOpOutputTensors().end());
+         }
+      }
+      // index of the first and last operators using each tensor
+      std::unordered_map<std::string, std::pair<size_t, size_t>> lifetimes;
+      std::vector<std::string> tensors; // in the order of their creation
+      for (size_t id = 0; id < fOperators.size(); id++) {
+         for (auto &name : fOperators[id]->GetOpOutputTensors()) {
+            auto info = fIntermediateTensorInfos.find(name);
+            if (info == fIntermediateTensorInfos.end() || info->second.type != ETensorType::FLOAT ||
+                excluded.count(name))
+               continue;
+            if (lifetimes.count(name)) {
+               // written by several operators
+               excluded.insert(name);
+               continue;
+            }
+            lifetimes[name] = {id, id};
+            tensors.push_back(name);
+         }
+         for (auto &name : fOperators[id]->GetOpInputTensors()) {
+            auto lifetime = lifetimes.find(name);
+            if (lifetime != lifetimes.end()) lifetime->second.second = id;
+         }
+      }
+
+      // greedy allocation in the order of execution: the outputs of an operator are allocated before the tensors
+      // read for the last time by it are released, so that its inputs and outputs never overlap
+      std::unordered_map<std::string, size_t> offsets;
+      std::map<size_t, size_t> freeBlocks; // offset and size of the free memory blocks
+      size_t next = 0;
+      for (size_t id = 0; id < fOperators.size(); id++) {
+         for (; next < tensors.size() && lifetimes.at(tensors[next]).first == id; next++) {
+            const std::string &name = tensors[next];
+            if (excluded.count(name)) continue;
+            size_t length = ConvertShapeToLength(fIntermediateTensorInfos.at(name).shape);
+            length = (length + alignment - 1) / alignment * alignment;
+            // smallest free block large enough, or the end of the pool
+            auto best = freeBlocks.end();
+            for (auto block = freeBlocks.begin(); block != freeBlocks.end(); ++block) {
+               if (block->second >= length && (best == freeBlocks.end() || block->second < best->second))
+                  best = block;
+            }
+            if (best != freeBlocks.end()) {
+               offsets[name] = best->first;
+               if (best->second > length)
+                  freeBlocks[best->first + length] = best->second - length;
+               freeBlocks.erase(best);
+            } else if (!freeBlocks.empty() && freeBlocks.rbegin()->first + freeBlocks.rbegin()->second == poolSize) {
+               // extend the free block at the end of the pool
+               offsets[name] = freeBlocks.rbegin()->first;
+               poolSize = offsets[name] + length;
+               freeBlocks.erase(std::prev(freeBlocks.end()));
+            } else {
+               offsets[name] = poolSize;
+               poolSize += length;
+            }
+         }
+         for (auto &name : tensors) {
+            auto offset = offsets.find(name);
+            if (offset == offsets.end() || lifetimes.at(name).second != id) continue;
+            size_t start = offset->second;
+            size_t length = ConvertShapeToLength(fIntermediateTensorInfos.at(name).shape);
+            length = (length + alignment - 1) / alignment * alignment;
+            // merge with the adjacent free blocks
+            auto after = freeBlocks.lower_bound(start);
+            if (after != freeBlocks.end() && start + length == after->first) {
+               length += after->second;
+               after = freeBlocks.erase(after);
+            }
+            if (after != freeBlocks.begin()) {
+               auto before = std::prev(after);
+               if (before->first + before->second == start) {
+                  start = before->first;
+                  length += before->second;
+                  freeBlocks.erase(before);
+               }
+            }
+            freeBlocks[start] = length;
+         }
+      }
+      return offsets;
+   }
+
    void RModel::Generate(std::underlying_type_t<Options> options, int batchSize){
       // session flag is used in operator initialize
       if (static_cast<std::underlying_type_t<Options>>(Options::kNoSession) & options)
          fUseSession = false;
       if (static_cast<std::underlying_type_t<Options>>(Options::kNoWeightFile) & options)
          fUseWeightFile = false;
+      fInlineSmallGemm = static_cast<std::underlying_type_t<Options>>(Options::kInlineSmallGemm) & options;
+      fUseGPU = static_cast<std::underlying_type_t<Options>>(Options::kGPU) & options;
       if (fUseWeightFile && !fUseSession) {
          throw std::runtime_error("TMVA-SOFIE: RModel::Generate: cannot use a separate weight file without generating a Session class");
       }
+      if (fUseGPU && !fUseSession) {
+         throw std::runtime_error("TMVA-SOFIE: RModel::Generate: the GPU code needs a Session class holding the device "
+                                  "memory");
+      }
       fGC.clear();
+      if (!(static_cast<std::underlying_type_t<Options>>(Options::kNoOperatorFusion) & options))
+         FuseOperators();
       Initialize(batchSize);
+      if (fUseGPU) {
+         for (size_t id = 0; id < fOperators.size(); id++) {
+            if (!fOperators[id]->SupportsGPU())
+               throw std::runtime_error("TMVA-SOFIE: RModel::Generate: operator " + std::to_string(id) +
+                                        " of the model cannot be computed on the GPU");
+         }
+         for (auto &i : fIntermediateTensorInfos) {
+            if (i.second.type != ETensorType::FLOAT)
+               throw std::runtime_error("TMVA-SOFIE: RModel::Generate: the GPU code supports only float tensors, " +
+                                        i.first + " is of type " + ConvertTypeToString(i.second.type));
+         }
+         for (auto &i : fReadyInputTensorInfos) {
+            if (i.second.type != ETensorType::FLOAT)
+               throw std::runtime_error("TMVA-SOFIE: RModel::Generate: the GPU code supports only float tensors, " +
+                                        i.first + " is of type " + ConvertTypeToString(i.second.type));
+         }
+      }
+      size_t poolSize = 0;
+      std::unordered_map<std::string, size_t> poolOffsets;
+      if (!(static_cast<std::underlying_type_t<Options>>(Options::kNoMemoryPool) & options))
+         poolOffsets = PlanIntermediateMemory(poolSize);
       fGC += ("//Code generated automatically by TMVA for Inference of Model file [" + fFileName + "] at [" + fParseTime.substr(0, fParseTime.length()-1) +"] \n");
       // add header guards
       std::string hgname = fName;
@@ -253,6 +446,12 @@ namespace SOFIE{
       fGC += "#include \"TMVA/SOFIE_common.hxx\"\n";
       if (fUseWeightFile)
          fGC += "#include <fstream>\n";
+      if (fUseGPU) {
+         fGC += "#include <cuda_runtime.h>\n";
+         fGC += "#include <cublas_v2.h>\n";
+         fGC += "#include <stdexcept>\n";
+         fGC += "#include <string>\n";
+      }
 
       fGC += "\nnamespace TMVA_SOFIE_" + fName + "{\n";
       if (!fNeededBlasRoutines.empty()) {
@@ -274,6 +473,8 @@ namespace SOFIE{
          }
          fGC += ("}//BLAS\n");
       }
+      if (fUseGPU)
+         GenerateGPUHelpers();
       if (fUseSession) {
          fGC += "struct Session {\n";
       }
@@ -300,20 +501,54 @@ namespace SOFIE{
             }
 
          }
-      }
-      for (auto&i: fIntermediateTensorInfos){
-         size_t length = ConvertShapeToLength(i.second.shape);
-         if (i.second.type == ETensorType::FLOAT){
-            fGC += "std::vector<float> fTensor_" + i.first  + " = std::vector<float>(" + std::to_string(length) + ");\n";
-            fGC += "float * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+         else if (IsQuantizedType(i.second.fType)) {
+            // the integer tensors of the quantized models (weights, scales and zero points) are small:
+            // they are always written in the generated code
+            size_t length = ConvertShapeToLength(i.second.fShape);
+            std::string type = ConvertTypeToString(i.second.fType);
+            fGC += type + " tensor_" + i.first + "[" + std::to_string(length) + "] = {";
+            std::stringstream values;
+            for (size_t idx = 0; idx < length; idx++) {
+               if (idx > 0) values << ", ";
+               values << GetIntegerValue(i.second.fType, i.second.fData.get(), idx);
+            }
+            fGC += values.str();
+            fGC += "};\n";
          }
-         if (i.second.type == ETensorType::DOUBLE){
-            fGC += "std::vector<double> fTensor_" + i.first  + " = std::vector<double>(" + std::to_string(length) + ");\n";
-            fGC += "double * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+      }
+      if (fUseGPU) {
+         // the intermediate tensors exist only on the GPU
+         GenerateGPUTensors(poolOffsets, poolSize);
+      } else {
+         if (poolSize > 0) {
+            fGC += "std::vector<float> fIntermediateMemoryPool = std::vector<float>(" + std::to_string(poolSize) + ");\n";
          }
-         if (i.second.type == ETensorType::INT64){
-            fGC += "std::vector<int64_t> fTensor_" + i.first  + " = std::vector<int64_t>(" + std::to_string(length) + ");\n";
-            fGC += "int64_t * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+         for (auto&i: fIntermediateTensorInfos){
+            size_t length = ConvertShapeToLength(i.second.shape);
+            auto offset = poolOffsets.find(i.first);
+            if (offset != poolOffsets.end()) {
+               fGC += "float * tensor_" + i.first + " = fIntermediateMemoryPool.data() + " +
+                      std::to_string(offset->second) + ";\n";
+               continue;
+            }
+            if (i.second.type == ETensorType::FLOAT){
+               fGC += "std::vector<float> fTensor_" + i.first  + " = std::vector<float>(" + std::to_string(length) + ");\n";
+               fGC += "float * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+            }
+            if (i.second.type == ETensorType::DOUBLE){
+               fGC += "std::vector<double> fTensor_" + i.first  + " = std::vector<double>(" + std::to_string(length) + ");\n";
+               fGC += "double * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+            }
+            if (i.second.type == ETensorType::INT64){
+               fGC += "std::vector<int64_t> fTensor_" + i.first  + " = std::vector<int64_t>(" + std::to_string(length) + ");\n";
+               fGC += "int64_t * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+            }
+            if (IsQuantizedType(i.second.type)){
+               std::string type = ConvertTypeToString(i.second.type);
+               fGC += "std::vector<" + type + "> fTensor_" + i.first  + " = std::vector<" + type + ">(" +
+                      std::to_string(length) + ");\n";
+               fGC += type + " * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+            }
          }
       }
       if (fUseSession) {
@@ -338,6 +573,13 @@ namespace SOFIE{
          for (size_t id = 0; id < fOperators.size() ; id++){
             fGC += fOperators[id]->GenerateInitCode();
          }
+         // copy the weights to the GPU once for all
+         for (auto &i : fInitializedTensors) {
+            if (!fUseGPU || i.second.fType != ETensorType::FLOAT) continue;
+            fGC += "   GPU::Check(cudaMemcpy(d_" + i.first + ", tensor_" + i.first + ", " +
+                   std::to_string(ConvertShapeToLength(i.second.fShape)) +
+                   " * sizeof(float), cudaMemcpyHostToDevice), \"cudaMemcpy\");\n";
+         }
          fGC += "}\n\n";
       }
 
@@ -387,28 +629,46 @@ namespace SOFIE{
          else if(i.second.type == ETensorType::DOUBLE){
             fGC += "double* tensor_" + i.first + ",";
          }
+         else if (IsQuantizedType(i.second.type)){
+            fGC += ConvertTypeToString(i.second.type) + "* tensor_" + i.first + ",";
+         }
       }
       fGC.pop_back(); //remove last ","
       fGC += "){\n";
 
       const std::string SP = "   ";
 
+      // on the GPU, the inputs are copied to the device memory and the outputs back to the host memory: the
+      // intermediate tensors stay on the GPU, so that there is a transfer of each per call of infer, i.e. per batch
+      auto outputCode = [&](const std::string &ret, const std::string &name) {
+         std::string length = std::to_string(ConvertShapeToLength(GetTensorShape(name)));
+         if (!fUseGPU)
+            return SP + "std::vector<" + outputType + "> " + ret + " (tensor_" + name + ", tensor_" + name + " + " +
+                   length + ");\n";
+         return SP + "std::vector<float> " + ret + "(" + length + ");\n" + SP + "GPU::Check(cudaMemcpy(" + ret +
+                ".data(), d_" + name + ", " + length + " * sizeof(float), cudaMemcpyDeviceToHost), \"cudaMemcpy\");\n";
+      };
+      if (fUseGPU) {
+         for (auto &i : fReadyInputTensorInfos) {
+            fGC += SP + "GPU::Check(cudaMemcpy(d_" + i.first + ", tensor_" + i.first + ", " +
+                   std::to_string(ConvertShapeToLength(i.second.shape)) +
+                   " * sizeof(float), cudaMemcpyHostToDevice), \"cudaMemcpy\");\n";
+         }
+      }
       for (size_t id = 0; id < fOperators.size() ; id++){
-         fGC+= (fOperators[id]->Generate(std::to_string(id)));
+         if (fUseGPU)
+            fGC += fOperators[id]->GenerateGPU(std::to_string(id));
+         else
+            fGC+= (fOperators[id]->Generate(std::to_string(id)));
       }
+      if (fUseGPU)
+         fGC += SP + "GPU::Check(cudaGetLastError(), \"kernel launch\");\n";
       if (outputSize == 1) {
-         size_t outputLength = ConvertShapeToLength(GetTensorShape(fOutputTensorNames[0]));
-
-         fGC += SP + "std::vector<" + outputType + "> ret (tensor_" + fOutputTensorNames[0] + ", tensor_" + fOutputTensorNames[0] + " + " +
-               std::to_string(outputLength) + ");\n";
+         fGC += outputCode("ret", fOutputTensorNames[0]);
       } else {
          for (size_t i = 0; i < outputSize; i++) {
             if (!fOutputTensorNames[i].empty()) {
-               size_t outputLength = ConvertShapeToLength(GetTensorShape(fOutputTensorNames[i]));
-               fGC += SP + "std::vector<" + outputType + "> ret_";
-               fGC += std::to_string(i);
-               fGC += " (tensor_" + fOutputTensorNames[i] + ", tensor_" + fOutputTensorNames[i] + " + " +
-               std::to_string(outputLength) + ");\n";
+               fGC += outputCode("ret_" + std::to_string(i), fOutputTensorNames[i]);
             }
          }
          fGC += SP + "std::vector<std::vector<" + outputType + ">> ret({";
@@ -427,6 +687,7 @@ namespace SOFIE{
       }
       fGC += SP + "return ret;\n";
       fGC += "}\n";
+      if (batchSize > 0) GenerateInferBatch(batchSize);
       if (fUseSession) {
          fGC += "};\n";
       }
@@ -434,6 +695,121 @@ namespace SOFIE{
       fGC += "\n#endif  // " + hgname + "\n";
    }
 
+   void RModel::GenerateInferBatch(size_t batchSize){
+      // only for the models taking batches of events, i.e. with a parametric first dimension of all the inputs, and
+      // with a single output having the batch size as first dimension
+      if (fOutputTensorNames.size() != 1 || fInputTensorInfos.size() != fInputTensorNames.size())
+         return;
+      for (auto &input : fInputTensorInfos) {
+         if (input.second.shape.empty() || !input.second.shape[0].isParam) return;
+      }
+      const auto &outputShape = GetTensorShape(fOutputTensorNames[0]);
+      if (outputShape.empty() || outputShape[0] != batchSize) return;
+      const std::string outputType = ConvertTypeToString(GetTensorType(fOutputTensorNames[0]));
+      const std::string sBatchSize = std::to_string(batchSize);
+      const std::string outputEventSize = std::to_string(ConvertShapeToLength(outputShape) / batchSize);
+      const std::string SP = "   ";
+
+      fGC += "\n// infer for any number of events, stored one after the other in the input tensors: they are\n";
+      fGC += "// computed by batches of " + sBatchSize + " events, the size used by infer, and the last batch is\n";
+      fGC += "// padded with zeros\n";
+      fGC += "std::vector<" + outputType + "> infer_batch(size_t nevents, ";
+      std::string args;
+      for (auto& i: fReadyInputTensorInfos){
+         fGC += ConvertTypeToString(i.second.type) + "* tensor_" + i.first + ",";
+         args += "batch_" + i.first + ",";
+      }
+      fGC.pop_back();
+      args.pop_back();
+      fGC += "){\n";
+      fGC += SP + "std::vector<" + outputType + "> ret;\n";
+      fGC += SP + "ret.reserve(nevents * " + outputEventSize + ");\n";
+      for (auto& i: fReadyInputTensorInfos){
+         fGC += SP + "std::vector<" + ConvertTypeToString(i.second.type) + "> pad_" + i.first + ";\n";
+      }
+      fGC += SP + "for (size_t first = 0; first < nevents; first += " + sBatchSize + ") {\n";
+      fGC += SP + SP + "size_t n = (nevents - first < " + sBatchSize + ") ? nevents - first : " + sBatchSize + ";\n";
+      for (auto& i: fReadyInputTensorInfos){
+         const std::string eventSize = std::to_string(ConvertShapeToLength(i.second.shape) / batchSize);
+         const std::string type = ConvertTypeToString(i.second.type);
+         fGC += SP + SP + type + "* batch_" + i.first + " = tensor_" + i.first + " + first * " + eventSize + ";\n";
+         fGC += SP + SP + "if (n < " + sBatchSize + ") {\n";
+         fGC += SP + SP + SP + "pad_" + i.first + ".assign(batch_" + i.first + ", batch_" + i.first + " + n * " +
+                eventSize + ");\n";
+         fGC += SP + SP + SP + "pad_" + i.first + ".resize(" + std::to_string(ConvertShapeToLength(i.second.shape)) +
+                ");\n";
+         fGC += SP + SP + SP + "batch_" + i.first + " = pad_" + i.first + ".data();\n";
+         fGC += SP + SP + "}\n";
+      }
+      fGC += SP + SP + "auto out = infer(" + args + ");\n";
+      fGC += SP + SP + "ret.insert(ret.end(), out.begin(), out.begin() + n * " + outputEventSize + ");\n";
+      fGC += SP + "}\n";
+      fGC += SP + "return ret;\n";
+      fGC += "}\n";
+   }
+
+   void RModel::GenerateGPUHelpers(){
+      fGC += "namespace GPU{\n";
+      fGC += "inline void Check(cudaError_t status, const char * what) {\n";
+      fGC += "   if (status != cudaSuccess)\n";
+      fGC += "      throw std::runtime_error(std::string(\"TMVA-SOFIE: CUDA error in \") + what + \": \" + "
+             "cudaGetErrorString(status));\n";
+      fGC += "}\n";
+      fGC += "inline void Check(cublasStatus_t status, const char * what) {\n";
+      fGC += "   if (status != CUBLAS_STATUS_SUCCESS)\n";
+      fGC += "      throw std::runtime_error(std::string(\"TMVA-SOFIE: cuBLAS error \") + std::to_string(status) + "
+             "\" in \" + what);\n";
+      fGC += "}\n";
+      // the Session owns its device memory and cuBLAS handle: it can be moved, e.g. into a vector, but not copied
+      fGC += "struct DeviceMemory {\n";
+      fGC += "   float * fData = nullptr;\n";
+      fGC += "   explicit DeviceMemory(size_t n) { Check(cudaMalloc(&fData, n * sizeof(float)), \"cudaMalloc\"); }\n";
+      fGC += "   DeviceMemory(DeviceMemory && other) : fData(other.fData) { other.fData = nullptr; }\n";
+      fGC += "   DeviceMemory(const DeviceMemory &) = delete;\n";
+      fGC += "   DeviceMemory & operator=(const DeviceMemory &) = delete;\n";
+      fGC += "   ~DeviceMemory() { if (fData) cudaFree(fData); }\n";
+      fGC += "};\n";
+      fGC += "struct CublasHandle {\n";
+      fGC += "   cublasHandle_t fHandle = nullptr;\n";
+      fGC += "   CublasHandle() { Check(cublasCreate(&fHandle), \"cublasCreate\"); }\n";
+      fGC += "   CublasHandle(CublasHandle && other) : fHandle(other.fHandle) { other.fHandle = nullptr; }\n";
+      fGC += "   CublasHandle(const CublasHandle &) = delete;\n";
+      fGC += "   CublasHandle & operator=(const CublasHandle &) = delete;\n";
+      fGC += "   ~CublasHandle() { if (fHandle) cublasDestroy(fHandle); }\n";
+      fGC += "};\n";
+      fGC += "}//GPU\n\n";
+      for (size_t id = 0; id < fOperators.size(); id++) {
+         fGC += fOperators[id]->GenerateGPUKernels(std::to_string(id));
+      }
+   }
+
+   void RModel::GenerateGPUTensors(const std::unordered_map<std::string, size_t> &poolOffsets, size_t poolSize){
+      fGC += "GPU::CublasHandle fCublas;\n";
+      // device copies of the weights, of the inputs and of the intermediate tensors
+      auto deviceTensor = [this](const std::string &name, size_t length) {
+         fGC += "GPU::DeviceMemory fDevice_" + name + " = GPU::DeviceMemory(" + std::to_string(length) + ");\n";
+         fGC += "float * d_" + name + " = fDevice_" + name + ".fData;\n";
+      };
+      for (auto &i : fInitializedTensors) {
+         if (i.second.fType == ETensorType::FLOAT)
+            deviceTensor(i.first, ConvertShapeToLength(i.second.fShape));
+      }
+      for (auto &i : fReadyInputTensorInfos) {
+         deviceTensor(i.first, ConvertShapeToLength(i.second.shape));
+      }
+      if (poolSize > 0) {
+         fGC += "GPU::DeviceMemory fDeviceMemoryPool = GPU::DeviceMemory(" + std::to_string(poolSize) + ");\n";
+      }
+      for (auto &i : fIntermediateTensorInfos) {
+         auto offset = poolOffsets.find(i.first);
+         if (offset != poolOffsets.end()) {
+            fGC += "float * d_" + i.first + " = fDeviceMemoryPool.fData + " + std::to_string(offset->second) + ";\n";
+         } else {
+            deviceTensor(i.first, ConvertShapeToLength(i.second.shape));
+         }
+      }
+   }
+
    void RModel::ReadInitializedTensorsFromFile() {
       // generate the code to read initialized tensors from a text data file
       if (fInitializedTensors.empty()) return;
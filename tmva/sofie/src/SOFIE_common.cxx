@@ -27,6 +27,12 @@ std::string ConvertTypeToString(ETensorType type){
       case ETensorType::FLOAT : {
          return "float";
       }
+      case ETensorType::INT8 : {
+         return "int8_t";
+      }
+      case ETensorType::UNINT8 : {
+         return "uint8_t";
+      }
       case ETensorType::INT16 : {
          return "int16_t";
       }
@@ -58,9 +64,24 @@ ETensorType ConvertStringToType(std::string type){
    if(type == "float32" || type == "float" || type == "Float"){
      return ETensorType::FLOAT;
    }
-   else if(type == "int64"){
+   else if(type == "int64" || type == "int64_t"){
      return ETensorType::INT64;
    }
+   else if (type == "int32" || type == "int32_t"){
+      return ETensorType::INT32;
+   }
+   else if (type == "int16" || type == "int16_t"){
+      return ETensorType::INT16;
+   }
+   else if (type == "uint16" || type == "uint16_t"){
+      return ETensorType::UINT16;
+   }
+   else if (type == "int8" || type == "int8_t"){
+      return ETensorType::INT8;
+   }
+   else if (type == "uint8" || type == "uint8_t"){
+      return ETensorType::UNINT8;
+   }
    else if (type == "double" || type == "float64"){
       return ETensorType::DOUBLE;
    }
@@ -69,6 +90,25 @@ ETensorType ConvertStringToType(std::string type){
    }
 }
 
+bool IsQuantizedType(ETensorType type){
+   return type == ETensorType::INT8 || type == ETensorType::UNINT8 || type == ETensorType::INT16 ||
+          type == ETensorType::UINT16 || type == ETensorType::INT32;
+}
+
+std::int64_t GetIntegerValue(ETensorType type, const void *data, std::size_t i){
+   switch (type) {
+   case ETensorType::INT8: return static_cast<const int8_t *>(data)[i];
+   case ETensorType::UNINT8: return static_cast<const uint8_t *>(data)[i];
+   case ETensorType::INT16: return static_cast<const int16_t *>(data)[i];
+   case ETensorType::UINT16: return static_cast<const uint16_t *>(data)[i];
+   case ETensorType::INT32: return static_cast<const int32_t *>(data)[i];
+   case ETensorType::INT64: return static_cast<const int64_t *>(data)[i];
+   default:
+      throw std::runtime_error("TMVA::SOFIE - GetIntegerValue called for the non integer type " +
+                               ConvertTypeToString(type));
+   }
+}
+
 std::string ConvertShapeToString(std::vector<size_t> shape) {
    std::stringstream out;
    out << "{ ";
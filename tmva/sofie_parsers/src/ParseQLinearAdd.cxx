@@ -0,0 +1,51 @@
+#include "TMVA/RModelParser_ONNX.hxx"
+#include "TMVA/ROperator_QLinearAdd.hxx"
+#include "onnx_proto3.pb.h"
+
+namespace TMVA {
+namespace Experimental {
+namespace SOFIE {
+
+ParserFuncSignature ParseQLinearAdd = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   // inputs: A, A_scale, A_zero_point, B, B_scale, B_zero_point, C_scale, C_zero_point
+   if (nodeproto.input_size() != 8) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser QLinearAdd op needs 8 inputs, it has " +
+                               std::to_string(nodeproto.input_size()));
+   }
+   for (int i = 0; i < 8; i++) {
+      if (!parser.IsRegisteredTensorType(nodeproto.input(i)))
+         throw std::runtime_error("TMVA::SOFIE ONNX Parser QLinearAdd op has input tensor " + nodeproto.input(i) +
+                                  " but its type is not yet registered");
+   }
+   // the output type is the type of the output zero point
+   ETensorType output_type = parser.GetTensorType(nodeproto.input(7));
+
+   std::unique_ptr<ROperator> op;
+   std::string output_name = nodeproto.output(0);
+
+   switch (output_type) {
+   case ETensorType::INT8:
+      op.reset(new ROperator_QLinearAdd<int8_t>(nodeproto.input(0), nodeproto.input(1), nodeproto.input(2),
+                                                 nodeproto.input(3), nodeproto.input(4), nodeproto.input(5),
+                                                 nodeproto.input(6), nodeproto.input(7), output_name));
+      break;
+   case ETensorType::UNINT8:
+      op.reset(new ROperator_QLinearAdd<uint8_t>(nodeproto.input(0), nodeproto.input(1), nodeproto.input(2),
+                                                  nodeproto.input(3), nodeproto.input(4), nodeproto.input(5),
+                                                  nodeproto.input(6), nodeproto.input(7), output_name));
+      break;
+   default:
+      throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator QLinearAdd does not yet support output type " +
+                               std::to_string(static_cast<int>(output_type)));
+   }
+
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, output_type);
+   }
+
+   return op;
+};
+
+} // namespace SOFIE
+} // namespace Experimental
+} // namespace TMVA
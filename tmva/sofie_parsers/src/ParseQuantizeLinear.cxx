@@ -0,0 +1,107 @@
+#include "TMVA/RModelParser_ONNX.hxx"
+#include "TMVA/ROperator_QuantizeLinear.hxx"
+#include "TMVA/ROperator_DequantizeLinear.hxx"
+#include "onnx_proto3.pb.h"
+
+namespace TMVA {
+namespace Experimental {
+namespace SOFIE {
+
+namespace {
+int GetAxisAttribute(const onnx::NodeProto &nodeproto)
+{
+   int axis = 1;
+   for (int_t i = 0; i < nodeproto.attribute_size(); i++) {
+      if (nodeproto.attribute(i).name() == "axis")
+         axis = nodeproto.attribute(i).i();
+   }
+   return axis;
+}
+} // namespace
+
+ParserFuncSignature ParseQuantizeLinear = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   auto input_name = nodeproto.input(0);
+   if (!parser.IsRegisteredTensorType(input_name)) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser QuantizeLinear op has input tensor" + input_name +
+                               " but its type is not yet registered");
+   }
+
+   // the output type is the type of the zero point, uint8 if there is none
+   std::string zero_point_name = (nodeproto.input_size() > 2) ? nodeproto.input(2) : "";
+   ETensorType output_type = ETensorType::UNINT8;
+   if (!zero_point_name.empty()) {
+      if (!parser.IsRegisteredTensorType(zero_point_name))
+         throw std::runtime_error("TMVA::SOFIE ONNX Parser QuantizeLinear op has zero point " + zero_point_name +
+                                  " but its type is not yet registered");
+      output_type = parser.GetTensorType(zero_point_name);
+   }
+
+   std::unique_ptr<ROperator> op;
+   int axis = GetAxisAttribute(nodeproto);
+   std::string output_name = nodeproto.output(0);
+
+   switch (output_type) {
+   case ETensorType::INT8:
+      op.reset(new ROperator_QuantizeLinear<int8_t>(axis, input_name, nodeproto.input(1), zero_point_name,
+                                                    output_name));
+      break;
+   case ETensorType::UNINT8:
+      op.reset(new ROperator_QuantizeLinear<uint8_t>(axis, input_name, nodeproto.input(1), zero_point_name,
+                                                     output_name));
+      break;
+   default:
+      throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator QuantizeLinear does not yet support output type " +
+                               std::to_string(static_cast<int>(output_type)));
+   }
+
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, output_type);
+   }
+
+   return op;
+};
+
+ParserFuncSignature ParseDequantizeLinear = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   ETensorType input_type;
+
+   auto input_name = nodeproto.input(0);
+   if (parser.IsRegisteredTensorType(input_name)) {
+      input_type = parser.GetTensorType(input_name);
+   } else {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser DequantizeLinear op has input tensor" + input_name +
+                               " but its type is not yet registered");
+   }
+
+   std::unique_ptr<ROperator> op;
+   int axis = GetAxisAttribute(nodeproto);
+   std::string zero_point_name = (nodeproto.input_size() > 2) ? nodeproto.input(2) : "";
+   std::string output_name = nodeproto.output(0);
+
+   switch (input_type) {
+   case ETensorType::INT8:
+      op.reset(new ROperator_DequantizeLinear<int8_t>(axis, input_name, nodeproto.input(1), zero_point_name,
+                                                      output_name));
+      break;
+   case ETensorType::UNINT8:
+      op.reset(new ROperator_DequantizeLinear<uint8_t>(axis, input_name, nodeproto.input(1), zero_point_name,
+                                                       output_name));
+      break;
+   case ETensorType::INT32:
+      op.reset(new ROperator_DequantizeLinear<int32_t>(axis, input_name, nodeproto.input(1), zero_point_name,
+                                                       output_name));
+      break;
+   default:
+      throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator DequantizeLinear does not yet support input "
+                               "type " + std::to_string(static_cast<int>(input_type)));
+   }
+
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, ETensorType::FLOAT);
+   }
+
+   return op;
+};
+
+} // namespace SOFIE
+} // namespace Experimental
+} // namespace TMVA
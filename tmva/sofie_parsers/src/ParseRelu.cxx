@@ -22,6 +22,7 @@ ParserFuncSignature ParseRelu = [](RModelParser_ONNX &parser, const onnx::NodePr
 
    switch (input_type) {
    case ETensorType::FLOAT: op.reset(new ROperator_Relu<float>(input_name, output_name)); break;
+   case ETensorType::INT8: op.reset(new ROperator_Relu<int8_t>(input_name, output_name)); break;
    default:
       throw std::runtime_error("TMVA::SOFIE - Unsupported - Operator Relu does not yet support input type " +
                                std::to_string(static_cast<int>(input_type)));
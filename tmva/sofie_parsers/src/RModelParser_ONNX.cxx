@@ -61,6 +61,23 @@ ETensorType RModelParser_ONNX::GetTensorType(const std::string &name)
    return fTensorTypeMap[UTILITY::Clean_name(name)];
 }
 
+namespace {
+// Read the data of an initializer of the integer types of the quantized models, which are stored in the int32_data
+// field of the TensorProto when they are not in raw_data
+template <typename T>
+std::shared_ptr<void> ReadIntegerTensorData(const onnx::TensorProto &tensorproto, std::size_t length)
+{
+   std::shared_ptr<void> data(malloc(length * sizeof(T)), free);
+   if (!tensorproto.raw_data().empty()) {
+      std::memcpy(data.get(), tensorproto.raw_data().c_str(), length * sizeof(T));
+   } else {
+      for (std::size_t i = 0; i < length && (int)i < tensorproto.int32_data_size(); i++)
+         static_cast<T *>(data.get())[i] = static_cast<T>(tensorproto.int32_data(i));
+   }
+   return data;
+}
+} // namespace
+
 // Declaration of operators
 // Unary operators
 extern ParserFuncSignature ParseSqrt;
@@ -100,6 +117,11 @@ extern ParserFuncSignature ParseMax;
 extern ParserFuncSignature ParseConcat;
 extern ParserFuncSignature ParseCast;
 extern ParserFuncSignature ParseShape;
+// Quantized operators
+extern ParserFuncSignature ParseQuantizeLinear;
+extern ParserFuncSignature ParseDequantizeLinear;
+extern ParserFuncSignature ParseQLinearMatMul;
+extern ParserFuncSignature ParseQLinearAdd;
 // Decalaration of fused operators
 extern ParserFuseFuncSignature ParseFuseConvAdd;
 extern ParserFuseFuncSignature ParseFuseConvTransposeAdd;
@@ -215,7 +237,8 @@ RModel RModelParser_ONNX::Parse(std::string filename, bool verbose)
       std::string input_name = valueinfoproto.name();
 
       ETensorType type = static_cast<ETensorType>(valueinfoproto.type().tensor_type().elem_type());
-      if (type != ETensorType::FLOAT && type != ETensorType::INT32 && type != ETensorType::INT64) {
+      if (type != ETensorType::FLOAT && type != ETensorType::INT32 && type != ETensorType::INT64 &&
+          type != ETensorType::INT8 && type != ETensorType::UNINT8) {
          throw std::runtime_error("TMVA::SOFIE Data type in input tensor " + input_name + " not supported!\n");
       }
 
@@ -309,6 +332,25 @@ RModel RModelParser_ONNX::Parse(std::string filename, bool verbose)
          allInitializedTensors[input_name] = i;
          break;
       }
+      // weights, scales and zero points of the quantized models
+      case ETensorType::INT8:
+      case ETensorType::UNINT8:
+      case ETensorType::INT16:
+      case ETensorType::UINT16:
+      case ETensorType::INT32: {
+         ETensorType type = static_cast<ETensorType>(graph.initializer(i).data_type());
+         std::shared_ptr<void> data;
+         switch (type) {
+         case ETensorType::INT8: data = ReadIntegerTensorData<int8_t>(*tensorproto, fLength); break;
+         case ETensorType::UNINT8: data = ReadIntegerTensorData<uint8_t>(*tensorproto, fLength); break;
+         case ETensorType::INT16: data = ReadIntegerTensorData<int16_t>(*tensorproto, fLength); break;
+         case ETensorType::UINT16: data = ReadIntegerTensorData<uint16_t>(*tensorproto, fLength); break;
+         default: data = ReadIntegerTensorData<int32_t>(*tensorproto, fLength);
+         }
+         rmodel.AddInitializedTensor(input_name, type, fShape, data);
+         allInitializedTensors[input_name] = i;
+         break;
+      }
       default:
          throw std::runtime_error("Data type in weight tensor " + graph.initializer(i).name() + " not supported!\n");
       }
@@ -451,6 +493,11 @@ RModel RModelParser_ONNX::Parse(std::string filename, bool verbose)
    RegisterOperator("Softmax", ParseSoftmax);
    RegisterOperator("Tanh", ParseTanh);
    RegisterOperator("Transpose", ParseTranspose);
+   // Quantized operators
+   RegisterOperator("QuantizeLinear", ParseQuantizeLinear);
+   RegisterOperator("DequantizeLinear", ParseDequantizeLinear);
+   RegisterOperator("QLinearMatMul", ParseQLinearMatMul);
+   RegisterOperator("QLinearAdd", ParseQLinearAdd);
 
    // fill model with operators
    if (verbose) {
@@ -0,0 +1,291 @@
+#ifndef TMVA_RBATCHGENERATOR
+#define TMVA_RBATCHGENERATOR
+
+#include "TMVA/RTensor.hxx"
+#include "TMVA/BatchGenerator/RBatchLoader.hxx"
+
+#include "ROOT/RDataFrame.hxx"
+#include "TChain.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace TMVA {
+namespace Experimental {
+
+namespace Internal {
+
+/// Chunk source of RBatchGenerator reading a TTree stored in one or several files: the RDataFrame of a chunk reads
+/// only the files containing its entries, with an RDatasetSpec restricted to the entry range of the chunk.
+/// Returns the source and the number of entries of the dataset.
+inline std::pair<std::function<ROOT::RDF::RNode(ULong64_t, ULong64_t)>, ULong64_t>
+MakeTreeChunkSource(const std::string &treeName, const std::vector<std::string> &fileNames)
+{
+   TChain chain(treeName.c_str());
+   for (auto &fileName : fileNames)
+      chain.Add(fileName.c_str());
+   // reads the number of entries of all the files, and their offsets in the chain
+   const ULong64_t nEntries = chain.GetEntries();
+   std::vector<std::string> files;
+   std::vector<ULong64_t> offsets;
+   for (int i = 0; i < chain.GetNtrees(); i++) {
+      files.emplace_back(chain.GetListOfFiles()->At(i)->GetTitle());
+      offsets.push_back(chain.GetTreeOffset()[i]);
+   }
+   offsets.push_back(nEntries);
+
+   auto source = [treeName, files, offsets](ULong64_t begin, ULong64_t end) {
+      // files [first, last) contain the entries [begin, end)
+      std::size_t first = std::upper_bound(offsets.begin(), offsets.end(), begin) - offsets.begin() - 1;
+      std::size_t last = std::lower_bound(offsets.begin(), offsets.end(), end) - offsets.begin();
+      std::vector<std::string> chunkFiles(files.begin() + first, files.begin() + last);
+      ROOT::RDF::Experimental::RDatasetSpec spec(
+         treeName, chunkFiles, {Long64_t(begin - offsets[first]), Long64_t(end - offsets[first])});
+      return ROOT::RDF::RNode(ROOT::RDataFrame(spec));
+   };
+   return {source, nEntries};
+}
+
+} // namespace Internal
+
+/// RBatchGenerator : streams shuffled mini-batches of columns of a dataset read with RDataFrame, for the training of
+/// machine learning models on datasets which do not fit in memory.
+///
+/// The dataset is divided in chunks of chunkSize consecutive entries. In a training epoch, started with StartEpoch,
+/// nLoaders background threads read the chunks in a random order, each chunk with its own RDataFrame event loop,
+/// shuffle the entries of the chunk and cut them in batches of batchSize entries. The batches are queued until they
+/// are taken with GetBatch, at most maxQueuedBatches at a time, so that the memory used is of the order of
+/// (nLoaders * chunkSize + maxQueuedBatches * batchSize) * columns.size() floats whatever the size of the dataset.
+///
+/// The last validationSplit fraction of the entries of each chunk is kept for the validation: it is read in the
+/// validation epochs, started with StartValidation, without shuffling. The split depends only on the entry numbers,
+/// not on the number of threads or on the epoch.
+///
+/// A batch is an RTensor<float> of shape {nEntries, columns.size()} in row-major layout, the last batch of an epoch
+/// can be smaller. GetBatch returns an empty tensor (of shape {0, columns.size()}) at the end of the epoch:
+/// ~~~{.cpp}
+/// TMVA::Experimental::RBatchGenerator<float, float, int> gen("tree", "data.root", {"x", "y", "label"}, 1024, 100000);
+/// for (int epoch = 0; epoch < 10; epoch++) {
+///    gen.StartEpoch();
+///    for (auto batch = gen.GetBatch(); batch.GetShape()[0] > 0; batch = gen.GetBatch()) {
+///       // train on batch
+///    }
+/// }
+/// ~~~
+/// In Python, iterating over the generator runs a training epoch giving NumPy arrays which share the memory of the
+/// batches, so that they are handed to PyTorch (`torch.from_numpy`) or TensorFlow (DLPack) without copy:
+/// ~~~{.py}
+/// gen = ROOT.TMVA.Experimental.RBatchGenerator["float", "float", "int"]("tree", "data.root", ["x", "y", "label"],
+///                                                                       1024, 100000, 0.1)
+/// for batch in gen:
+///     x = torch.from_numpy(batch)
+/// for batch in gen.validation_batches():
+///     ...
+/// ~~~
+/// Other data formats (e.g. RNTuple), or the filtering or definition of columns, are supported with a ChunkSource_t
+/// returning the RDataFrame computation graph reading the entries [begin, end) of the dataset. With implicit
+/// multi-threading enabled, the source must not use RInterface::Range.
+template <typename... Args>
+class RBatchGenerator {
+public:
+   /// function returning the RDataFrame node reading the entries [begin, end) of the dataset
+   using ChunkSource_t = std::function<ROOT::RDF::RNode(ULong64_t begin, ULong64_t end)>;
+
+private:
+   /// ForeachSlot functor appending the values of an entry to the rows read by its slot
+   struct RRowFiller {
+      std::vector<std::vector<float>> *fSlotRows;
+      void operator()(unsigned int slot, const Args &...values)
+      {
+         auto &rows = (*fSlotRows)[slot];
+         int expander[] = {(rows.push_back(static_cast<float>(values)), 0)...};
+         (void)expander;
+      }
+   };
+
+   ChunkSource_t fSource;
+   std::vector<std::string> fColumns;
+   ULong64_t fNumEntries = 0;
+   std::size_t fChunkSize;
+   float fValidationSplit;
+   bool fShuffle;
+   std::size_t fNumLoaders;
+   std::mt19937_64 fRng;
+
+   Internal::RBatchLoader fLoader;
+   std::vector<std::thread> fThreads;
+   std::vector<ULong64_t> fChunkOrder;
+   std::atomic<std::size_t> fNextChunk{0};
+   std::atomic<std::size_t> fActiveLoaders{0};
+   std::mutex fErrorMutex;
+   std::exception_ptr fError;
+
+   /// read the entries [begin, end) of the dataset, returns the number of entries passing the filters of the source
+   std::size_t LoadChunk(ULong64_t begin, ULong64_t end, std::vector<float> &rows)
+   {
+      auto node = fSource(begin, end);
+      std::vector<std::vector<float>> slotRows(node.GetNSlots());
+      node.ForeachSlot(RRowFiller{&slotRows}, fColumns);
+      rows.clear();
+      for (auto &r : slotRows)
+         rows.insert(rows.end(), r.begin(), r.end());
+      return rows.size() / sizeof...(Args);
+   }
+
+   /// loop of a loader thread: load the next chunks of fChunkOrder until all of them are done
+   void LoadChunks(bool validation, ULong64_t seed)
+   {
+      std::vector<float> rows;
+      std::vector<std::size_t> order;
+      try {
+         for (std::size_t i = fNextChunk++; i < fChunkOrder.size(); i = fNextChunk++) {
+            const ULong64_t chunk = fChunkOrder[i];
+            const ULong64_t begin = chunk * fChunkSize;
+            const ULong64_t end = std::min<ULong64_t>(begin + fChunkSize, fNumEntries);
+            const ULong64_t split = begin + ULong64_t((end - begin) * (1. - fValidationSplit) + 0.5);
+            if (validation ? split == end : split == begin)
+               continue;
+            std::size_t nRows = validation ? LoadChunk(split, end, rows) : LoadChunk(begin, split, rows);
+            order.resize(nRows);
+            std::iota(order.begin(), order.end(), 0);
+            if (fShuffle && !validation) {
+               std::mt19937_64 rng(seed + chunk);
+               std::shuffle(order.begin(), order.end(), rng);
+            }
+            if (!fLoader.AddRows(rows.data(), order))
+               return;
+         }
+      } catch (...) {
+         {
+            std::lock_guard<std::mutex> lock(fErrorMutex);
+            fError = std::current_exception();
+         }
+         fLoader.Stop();
+         return;
+      }
+      if (--fActiveLoaders == 0)
+         fLoader.Finish();
+   }
+
+   void StartLoading(bool validation)
+   {
+      StopLoading();
+      fLoader.Reset();
+      fError = nullptr;
+      fChunkOrder.resize((fNumEntries + fChunkSize - 1) / fChunkSize);
+      std::iota(fChunkOrder.begin(), fChunkOrder.end(), 0);
+      if (fShuffle && !validation)
+         std::shuffle(fChunkOrder.begin(), fChunkOrder.end(), fRng);
+      const ULong64_t seed = fRng();
+      fNextChunk = 0;
+      fActiveLoaders = fNumLoaders;
+      for (std::size_t i = 0; i < fNumLoaders; i++)
+         fThreads.emplace_back([this, validation, seed] { LoadChunks(validation, seed); });
+   }
+
+   RBatchGenerator(std::pair<ChunkSource_t, ULong64_t> source, const std::vector<std::string> &columns,
+                   std::size_t batchSize, std::size_t chunkSize, float validationSplit, bool shuffle,
+                   std::size_t nLoaders, std::size_t maxQueuedBatches, ULong64_t seed)
+      : RBatchGenerator(std::move(source.first), source.second, columns, batchSize, chunkSize, validationSplit,
+                        shuffle, nLoaders, maxQueuedBatches, seed)
+   {
+   }
+
+   void StopLoading()
+   {
+      if (fThreads.empty())
+         return;
+      fLoader.Stop();
+      for (auto &thread : fThreads)
+         thread.join();
+      fThreads.clear();
+   }
+
+public:
+   /// \param[in] source function returning the RDataFrame node reading a range of entries of the dataset
+   /// \param[in] nEntries number of entries of the dataset
+   /// \param[in] columns names of the columns of the batches, of types Args...
+   /// \param[in] batchSize number of entries of a batch
+   /// \param[in] chunkSize number of consecutive entries read and shuffled together
+   /// \param[in] validationSplit fraction of the entries of each chunk kept for the validation
+   /// \param[in] shuffle shuffle the chunks and their entries in the training epochs
+   /// \param[in] nLoaders number of threads loading chunks
+   /// \param[in] maxQueuedBatches maximum number of loaded batches waiting to be taken
+   /// \param[in] seed seed of the shuffling
+   RBatchGenerator(ChunkSource_t source, ULong64_t nEntries, const std::vector<std::string> &columns,
+                   std::size_t batchSize, std::size_t chunkSize, float validationSplit = 0., bool shuffle = true,
+                   std::size_t nLoaders = 1, std::size_t maxQueuedBatches = 10, ULong64_t seed = 0)
+      : fSource(std::move(source)), fColumns(columns), fNumEntries(nEntries), fChunkSize(chunkSize),
+        fValidationSplit(validationSplit), fShuffle(shuffle), fNumLoaders(std::max<std::size_t>(nLoaders, 1)),
+        fRng(seed), fLoader(batchSize, columns.size(), maxQueuedBatches)
+   {
+      if (columns.size() != sizeof...(Args))
+         throw std::runtime_error("RBatchGenerator: " + std::to_string(columns.size()) + " columns given for " +
+                                  std::to_string(sizeof...(Args)) + " column types");
+      if (batchSize == 0 || chunkSize == 0)
+         throw std::runtime_error("RBatchGenerator: the batch size and the chunk size must be positive");
+      if (validationSplit < 0. || validationSplit >= 1.)
+         throw std::runtime_error("RBatchGenerator: the validation split must be in [0, 1)");
+   }
+
+   /// Generator reading the tree treeName stored in the files fileNames (which can contain wildcards)
+   RBatchGenerator(const std::string &treeName, const std::vector<std::string> &fileNames,
+                   const std::vector<std::string> &columns, std::size_t batchSize, std::size_t chunkSize,
+                   float validationSplit = 0., bool shuffle = true, std::size_t nLoaders = 1,
+                   std::size_t maxQueuedBatches = 10, ULong64_t seed = 0)
+      : RBatchGenerator(Internal::MakeTreeChunkSource(treeName, fileNames), columns, batchSize, chunkSize,
+                        validationSplit, shuffle, nLoaders, maxQueuedBatches, seed)
+   {
+   }
+
+   RBatchGenerator(const std::string &treeName, const std::string &fileName, const std::vector<std::string> &columns,
+                   std::size_t batchSize, std::size_t chunkSize, float validationSplit = 0., bool shuffle = true,
+                   std::size_t nLoaders = 1, std::size_t maxQueuedBatches = 10, ULong64_t seed = 0)
+      : RBatchGenerator(treeName, std::vector<std::string>{fileName}, columns, batchSize, chunkSize, validationSplit,
+                        shuffle, nLoaders, maxQueuedBatches, seed)
+   {
+   }
+
+   RBatchGenerator(const RBatchGenerator &) = delete;
+   RBatchGenerator &operator=(const RBatchGenerator &) = delete;
+
+   ~RBatchGenerator() { StopLoading(); }
+
+   /// start the loading of a training epoch, interrupting the current epoch if any
+   void StartEpoch() { StartLoading(false); }
+
+   /// start the loading of a validation epoch, interrupting the current epoch if any
+   void StartValidation() { StartLoading(true); }
+
+   /// next batch of the current epoch, an empty tensor at its end. Rethrows the exceptions of the loaders.
+   RTensor<float> GetBatch()
+   {
+      RTensor<float> batch(static_cast<float *>(nullptr), {0, fColumns.size()});
+      if (!fLoader.GetBatch(batch)) {
+         StopLoading();
+         if (fError)
+            std::rethrow_exception(fError);
+      }
+      return batch;
+   }
+
+   ULong64_t GetNumEntries() const { return fNumEntries; }
+   std::size_t GetNumColumns() const { return fColumns.size(); }
+   const std::vector<std::string> &GetColumns() const { return fColumns; }
+};
+
+} // namespace Experimental
+} // namespace TMVA
+
+#endif // TMVA_RBATCHGENERATOR
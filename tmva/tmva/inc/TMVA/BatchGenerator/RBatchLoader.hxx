@@ -0,0 +1,130 @@
+#ifndef TMVA_RBATCHLOADER
+#define TMVA_RBATCHLOADER
+
+#include "TMVA/RTensor.hxx"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace TMVA {
+namespace Experimental {
+namespace Internal {
+
+/// RBatchLoader : thread-safe queue of the batches of an RBatchGenerator. The chunk loaders add rows of numColumns
+/// values, which are cut in batches of batchSize rows and queued until they are taken with GetBatch. A loader adding
+/// rows waits while maxBatches batches are queued, which bounds the memory used by the prefetching.
+class RBatchLoader {
+   std::size_t fBatchSize;
+   std::size_t fNumColumns;
+   std::size_t fMaxBatches;
+
+   std::mutex fMutex;
+   std::condition_variable fBatchQueued;  // a batch was queued, or the loading finished or was stopped
+   std::condition_variable fBatchTaken;   // a batch was taken, or the loading was stopped
+   std::deque<RTensor<float>> fBatches;
+   std::vector<float> fRemainder;         // rows of the incomplete batch shared by the loaders
+   bool fFinished = false;                // all the rows of the epoch were added
+   bool fStopped = false;                 // the loading is interrupted
+
+   /// queue a batch, waiting for a free place if needed; returns false if the loading was stopped
+   bool Enqueue(std::unique_lock<std::mutex> &lock, RTensor<float> &&batch)
+   {
+      fBatchTaken.wait(lock, [this] { return fBatches.size() < fMaxBatches || fStopped; });
+      if (fStopped)
+         return false;
+      fBatches.push_back(std::move(batch));
+      fBatchQueued.notify_one();
+      return true;
+   }
+
+public:
+   RBatchLoader(std::size_t batchSize, std::size_t numColumns, std::size_t maxBatches)
+      : fBatchSize(batchSize), fNumColumns(numColumns), fMaxBatches(std::max<std::size_t>(maxBatches, 1))
+   {
+   }
+
+   /// prepare the loading of a new epoch, dropping the batches left from the previous one
+   void Reset()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fBatches.clear();
+      fRemainder.clear();
+      fFinished = false;
+      fStopped = false;
+   }
+
+   /// add the rows of a chunk, in the given order; returns false if the loading was stopped
+   bool AddRows(const float *rows, const std::vector<std::size_t> &order)
+   {
+      std::size_t i = 0;
+      // the full batches of the chunk are built without holding the lock
+      for (; i + fBatchSize <= order.size(); i += fBatchSize) {
+         RTensor<float> batch({fBatchSize, fNumColumns});
+         for (std::size_t j = 0; j < fBatchSize; j++)
+            std::copy_n(rows + order[i + j] * fNumColumns, fNumColumns, batch.GetData() + j * fNumColumns);
+         std::unique_lock<std::mutex> lock(fMutex);
+         if (!Enqueue(lock, std::move(batch)))
+            return false;
+      }
+      // the last rows are batched together with the ones left by the other chunks
+      std::unique_lock<std::mutex> lock(fMutex);
+      for (; i < order.size(); i++) {
+         fRemainder.insert(fRemainder.end(), rows + order[i] * fNumColumns, rows + (order[i] + 1) * fNumColumns);
+         if (fRemainder.size() == fBatchSize * fNumColumns) {
+            RTensor<float> batch({fBatchSize, fNumColumns});
+            std::copy(fRemainder.begin(), fRemainder.end(), batch.GetData());
+            fRemainder.clear();
+            if (!Enqueue(lock, std::move(batch)))
+               return false;
+         }
+      }
+      return !fStopped;
+   }
+
+   /// called when all the rows were added: the incomplete batch is queued as a last, smaller batch
+   void Finish()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (!fRemainder.empty() && !fStopped) {
+         RTensor<float> batch({fRemainder.size() / fNumColumns, fNumColumns});
+         std::copy(fRemainder.begin(), fRemainder.end(), batch.GetData());
+         fBatches.push_back(std::move(batch));
+         fRemainder.clear();
+      }
+      fFinished = true;
+      fBatchQueued.notify_all();
+   }
+
+   /// interrupt the loading: the waiting loaders and consumers return
+   void Stop()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStopped = true;
+      fBatches.clear();
+      fBatchQueued.notify_all();
+      fBatchTaken.notify_all();
+   }
+
+   /// take the next batch, waiting for it if needed; returns false at the end of the epoch or if it was stopped
+   bool GetBatch(RTensor<float> &batch)
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fBatchQueued.wait(lock, [this] { return !fBatches.empty() || fFinished || fStopped; });
+      if (fBatches.empty())
+         return false;
+      batch = std::move(fBatches.front());
+      fBatches.pop_front();
+      fBatchTaken.notify_one();
+      return true;
+   }
+};
+
+} // namespace Internal
+} // namespace Experimental
+} // namespace TMVA
+
+#endif // TMVA_RBATCHLOADER
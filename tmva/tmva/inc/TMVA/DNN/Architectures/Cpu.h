@@ -206,6 +206,14 @@ public:
       //Tensor_t::MatrixToTensor(output_matrix, output); // this maybe is not needed
    }
 
+   /** Forward propagation in the dense layer: multiply \p input with the transpose of \p weights,
+    *  add the \p biases row-wise, copy the result to \p inputActivationFunc and apply the activation
+    *  function to \p output. The bias, the copy and the usual activation functions are applied in a
+    *  single pass over the output. */
+   static void DenseLayerForward(Tensor_t &output, Tensor_t &inputActivationFunc, const Tensor_t &input,
+                                 const Matrix_t &weights, const Matrix_t &biases, EActivationFunction activFunc,
+                                 const ActivationDescriptor_t activationDescr);
+
    /** @name Backward Propagation (Dense Layers)
     * Low-level functions required for the forward propagation of activations
     * through the network.
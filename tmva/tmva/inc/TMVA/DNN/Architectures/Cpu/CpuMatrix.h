@@ -21,6 +21,7 @@
 #define DL_USE_MTE // use MT with tbb
 #endif
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
@@ -171,6 +172,10 @@ public:
    // static function to get the number of elements for task
    static size_t GetNWorkItems(size_t nelements);
 
+   // static function to get the number of rows of the blocks of a matrix product with
+   // nRows rows and nOps multiply-adds, which are computed in parallel
+   static size_t GetNRowsPerBlock(size_t nRows, size_t nOps);
+
    // print matrix
    void Print() const
    {
@@ -206,6 +211,21 @@ size_t TCpuMatrix<AFloat>::GetNWorkItems(size_t nElements)
    // return nElements/(nCpu*10);
 }
 
+//______________________________________________________________________________
+template <typename AFloat>
+size_t TCpuMatrix<AFloat>::GetNRowsPerBlock(size_t nRows, size_t nOps)
+{
+   // a block has at least minRows rows and minOps multiply-adds, so that the parallel
+   // products are still efficient BLAS calls
+   const size_t minRows = 32;
+   const size_t minOps = 100000;
+   const size_t nCpu = TMVA::Config::Instance().GetNCpu();
+   size_t nBlocks = std::min({nCpu, nRows / minRows, nOps / minOps});
+   if (nBlocks <= 1)
+      return nRows;
+   return (nRows + nBlocks - 1) / nBlocks;
+}
+
 //______________________________________________________________________________
 template <typename AFloat>
 template <typename Function_t>
@@ -220,6 +220,18 @@ public:
          //Tensor_t::MatrixToTensor(output_matrix, output); // this maybe is not needed
    }
 
+   /** Forward propagation in the dense layer: matrix product, row-wise addition of the biases, copy of the
+    *  result to \p inputActivationFunc and activation function */
+   static void DenseLayerForward(Tensor_t &output, Tensor_t &inputActivationFunc, const Tensor_t &input,
+                                 const Matrix_t &weights, const Matrix_t &biases, EActivationFunction activFunc,
+                                 const ActivationDescriptor_t activationDescr)
+   {
+      MultiplyTranspose(output, input, weights);
+      AddRowWise(output, biases);
+      Copy(inputActivationFunc, output);
+      ActivationFunctionForward(output, activFunc, activationDescr);
+   }
+
    /** @name Backward Propagation (Dense Layers)
     * Low-level functions required for the forward propagation of activations
     * through the network.
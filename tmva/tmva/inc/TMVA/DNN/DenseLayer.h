@@ -192,13 +192,8 @@ auto TDenseLayer<Architecture_t>::Forward( Tensor_t &input, bool applyDropout) -
                                      static_cast<TWorkspace *> (nullptr),
                                      this->GetDropoutProbability());
    }
-   Architecture_t::MultiplyTranspose(this->GetOutput() , input, this->GetWeightsAt(0));
-   Architecture_t::AddRowWise(this->GetOutput(), this->GetBiasesAt(0));
-
-   //evaluate<Architecture_t>(this->GetOutput(), this->GetActivationFunction());
-   Architecture_t::Copy(this->GetInputActivation(),this->GetOutput());
-
-   Architecture_t::ActivationFunctionForward(this->GetOutput(), this->GetActivationFunction(), fActivationDesc);
+   Architecture_t::DenseLayerForward(this->GetOutput(), this->GetInputActivation(), input, this->GetWeightsAt(0),
+                                     this->GetBiasesAt(0), this->GetActivationFunction(), fActivationDesc);
 }
 
 //______________________________________________________________________________
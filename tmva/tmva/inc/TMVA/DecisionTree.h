@@ -108,6 +108,7 @@ namespace TMVA {
       Double_t TrainNode( const EventConstList & eventSample,  DecisionTreeNode *node ) { return TrainNodeFast( eventSample, node ); }
       Double_t TrainNodeFast( const EventConstList & eventSample,  DecisionTreeNode *node );
       Double_t TrainNodeFull( const EventConstList & eventSample,  DecisionTreeNode *node );
+      Double_t TrainNodeHistograms( DecisionTreeNode *node, const std::vector<Double_t> & hist );
       void    GetRandomisedVariables(Bool_t *useVariable, UInt_t *variableMap, UInt_t & nVars);
       std::vector<Double_t>  GetFisherCoefficients(const EventConstList &eventSample, UInt_t nFisherVars, UInt_t *mapVarInFisher);
 
@@ -193,6 +194,12 @@ namespace TMVA {
       inline void SetUseExclusiveVars(Bool_t t=kTRUE){fUseExclusiveVars = t;}
       inline void SetNVars(Int_t n){fNvars = n;}
 
+      // fixed cut grid of each variable, used by the histogram based node splitting
+      static std::vector<std::vector<Float_t>> ComputeBinEdges(const EventConstList & eventSample,
+                                                               UInt_t nVars, Int_t nCuts);
+      void SetBinEdges(const std::vector<std::vector<Float_t>> & edges);
+      Bool_t UseHistogramSplits() const { return !fBinEdges.empty() && !fUseFisherCuts; }
+
    private:
       // utility functions
 
@@ -202,6 +209,14 @@ namespace TMVA {
       // calculates the purity S/(S+B) of a given event sample
       Double_t SamplePurity(EventList eventSample);
 
+      UInt_t BuildTree( const EventConstList & eventSample, DecisionTreeNode *node, std::vector<Double_t> *nodeHist );
+
+      // histograms of the events of a node on the fixed cut grid, and their split to the daughter nodes
+      void FillNodeHistograms( const EventConstList & eventSample, std::vector<Double_t> & hist ) const;
+      void SplitNodeHistograms( std::vector<Double_t> & hist, const EventConstList & leftSample,
+                                const EventConstList & rightSample, std::vector<Double_t> & leftHist,
+                                std::vector<Double_t> & rightHist ) const;
+
       UInt_t    fNvars;               ///< number of variables used to separate S and B
       Int_t     fNCuts;               ///< number of grid point in variable cut scans
       Bool_t    fUseFisherCuts;       ///< use multivariate splits using the Fisher criterium
@@ -229,6 +244,9 @@ namespace TMVA {
 
       TRandom3  *fMyTrandom;          ///< random number generator for randomised trees
 
+      std::vector<std::vector<Float_t>> fBinEdges; ///< fixed cut values of each variable for the histogram based splitting
+      std::vector<UInt_t> fBinOffsets; ///< first bin of each variable in the node histograms, last entry = number of bins
+
       std::vector< Double_t > fVariableImportance; ///< the relative importance of the different variables
 
       UInt_t     fMaxDepth;           ///< max depth
@@ -118,6 +118,9 @@ namespace TMVA {
       // calculate the MVA value
       virtual Double_t GetMvaValue( Double_t* err = nullptr, Double_t* errUpper = nullptr );
 
+      // calculate the MVA values of a batch of events, thread-safe
+      virtual void GetBatchMvaValues( const Float_t* input, size_t nEvents, size_t nVariables, Double_t* output ) const;
+
       virtual const std::vector<Float_t> &GetRegressionValues();
 
       virtual const std::vector<Float_t> &GetMulticlassValues();
@@ -108,6 +108,9 @@ namespace TMVA {
       // calculate the MVA value
       Double_t GetMvaValue( Double_t* err = nullptr, Double_t* errUpper = nullptr);
 
+      // calculate the MVA values of a batch of events, thread-safe
+      void GetBatchMvaValues( const Float_t* input, size_t nEvents, size_t nVariables, Double_t* output ) const;
+
       // get the actual forest size (might be less than fNTrees, the requested one, if boosting is stopped early
       UInt_t   GetNTrees() const {return fForest.size();}
    private:
@@ -236,6 +239,8 @@ namespace TMVA {
       Bool_t                          fUseFisherCuts;       ///< use multivariate splits using the Fisher criterium
       Double_t                        fMinLinCorrForFisher; ///< the minimum linear correlation between two variables demanded for use in fisher criterium in node splitting
       Bool_t                          fUseExclusiveVars;    ///< individual variables already used in fisher criterium are not anymore analysed individually for node splitting
+      Bool_t                          fUseHistogramSplits;  ///< find the node splits on histograms of the variables binned once for the training
+      std::vector<std::vector<Float_t>> fBinEdges;          ///< cut grid of each variable used with fUseHistogramSplits
       Bool_t                          fUseYesNoLeaf;        ///< use sig or bkg classification in leave nodes or sig/bkg
       Double_t                        fNodePurityLimit;     ///< purity limit for sig/bkg nodes
       UInt_t                          fNNodesMax;           ///< max # of nodes
@@ -279,7 +284,7 @@ namespace TMVA {
 
 
       void                             DeterminePreselectionCuts(const std::vector<const TMVA::Event*>& eventSample);
-      Double_t                         ApplyPreselectionCuts(const Event* ev);
+      Double_t                         ApplyPreselectionCuts(const Event* ev) const;
 
       std::vector<Double_t> fLowSigCut;
       std::vector<Double_t> fLowBkgCut;
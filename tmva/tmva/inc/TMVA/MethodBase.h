@@ -200,10 +200,21 @@ namespace TMVA {
       // signal/background classification response
       Double_t GetMvaValue( const TMVA::Event* const ev, Double_t* err = nullptr, Double_t* errUpper = nullptr );
 
+      // signal/background classification response of nEvents events, whose nVariables input values are
+      // stored contiguously in input (event after event), written to output. The method is not modified:
+      // several threads can evaluate it at the same time. The default implementation serializes the calls
+      // to GetMvaValue, BDT, MLP and DL evaluate the events without taking a lock
+      virtual void GetBatchMvaValues( const Float_t* input, size_t nEvents, size_t nVariables, Double_t* output ) const;
+
    protected:
       // helper function to set errors to -1
       void NoErrorCalc(Double_t* const err, Double_t* const errUpper);
 
+      // input values of a batch of events after the variable transformations of the method, stored in buffer
+      // (or input itself if the method has no transformation). The transformations are serialized
+      const Float_t* GetTransformedBatch( const Float_t* input, size_t nEvents, size_t nVariables,
+                                          std::vector<Float_t>& buffer ) const;
+
       // signal/background classification response for all current set of data
       virtual std::vector<Double_t> GetMvaValues(Long64_t firstEvt = 0, Long64_t lastEvt = -1, Bool_t logProgress = false);
       // same as above but using a provided data set (used by MethodCategory)
@@ -61,6 +61,7 @@
 
 #include <vector>
 #include <map>
+#include <mutex>
 
 #ifdef R__HAS_TMVAGPU
 //#define USE_GPU_INFERENCE
@@ -207,6 +208,8 @@ private:
    HostBufferImpl_t fXInputBuffer;        // input host buffer corresponding to X (needed for GPU implementation)
    std::unique_ptr<MatrixImpl_t> fYHat;   // output prediction matrix of fNet
    std::unique_ptr<DeepNetImpl_t> fNet;
+   std::unique_ptr<DeepNetImpl_t> fBatchNet; //! copy of fNet with a larger batch size, used by GetBatchMvaValues
+   mutable std::mutex fBatchMutex;           //! serializes the evaluations using fBatchNet and fNet
 
 
    ClassDef(MethodDL, 0);
@@ -239,6 +242,8 @@ public:
    void Train();
 
    Double_t GetMvaValue(Double_t *err = nullptr, Double_t *errUpper = nullptr);
+   /*! Evaluate a batch of events, thread-safe */
+   virtual void GetBatchMvaValues(const Float_t *input, size_t nEvents, size_t nVariables, Double_t *output) const;
    virtual const std::vector<Float_t>& GetRegressionValues();
    virtual const std::vector<Float_t>& GetMulticlassValues();
 
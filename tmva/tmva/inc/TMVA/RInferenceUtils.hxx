@@ -1,7 +1,18 @@
 #ifndef TMVA_RINFERENCEUTILS
 #define TMVA_RINFERENCEUTILS
 
+#include "ROOT/RDF/RActionImpl.hxx"
+#include "RtypesCore.h"
+#include "TMVA/RTensor.hxx"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
 #include <utility> // std::forward, std::index_sequence
+#include <vector>
+
+class TTreeReader;
 
 namespace TMVA {
 namespace Experimental {
@@ -32,6 +43,118 @@ auto Compute(F &&f) -> Internal::ComputeHelper<std::make_index_sequence<N>, T, F
    return Internal::ComputeHelper<std::make_index_sequence<N>, T, F>(std::forward<F>(f));
 }
 
+/// RDataFrame action, booked with RInterface::Book(), evaluating a model with a Compute(const RTensor<T> &) method,
+/// e.g. RBDT, on batches of entries instead of one entry at a time as Compute(). The N inputs of each entry are
+/// accumulated per slot, and the model is evaluated on batchSize entries at once, e.g. walking many events through
+/// each tree of a RBDT together.
+///
+/// The result is the model output of all the processed entries, ordered by entry number: for M outputs per entry,
+/// the outputs of the i-th processed entry are the elements i * M to (i + 1) * M - 1. The entry number must be
+/// passed as first column:
+/// ~~~{.cpp}
+/// auto bdt = std::make_shared<TMVA::Experimental::RBDT<>>("myModel", "model.root");
+/// using Helper_t = TMVA::Experimental::RBatchComputeHelper<4, TMVA::Experimental::RBDT<>>;
+/// auto y = df.Book<ULong64_t, float, float, float, float>(Helper_t(bdt, df.GetNSlots()),
+///                                                        {"rdfentry_", "x1", "x2", "x3", "x4"});
+/// ~~~
+/// The model is shared by the slots: its Compute() method must be thread-safe, as the one of RBDT.
+template <std::size_t N, typename Model, typename T = float>
+class RBatchComputeHelper : public ROOT::Detail::RDF::RActionImpl<RBatchComputeHelper<N, Model, T>> {
+
+   /// the buffered entries of a slot and the results of the evaluated batches
+   struct SlotData {
+      std::vector<T> fInputs;              // N values per buffered entry
+      std::vector<ULong64_t> fEntries;     // entry numbers of the buffered entries
+      std::vector<ULong64_t> fDoneEntries; // entry numbers of the evaluated entries
+      std::vector<T> fOutputs;             // outputs of the evaluated entries
+      std::size_t fOutputSize = 0;         // number of outputs per entry
+   };
+
+   std::shared_ptr<std::vector<T>> fResult;
+   std::shared_ptr<Model> fModel;
+   std::vector<SlotData> fSlots;
+   std::size_t fBatchSize;
+
+   void Evaluate(unsigned int slot)
+   {
+      auto &data = fSlots[slot];
+      const std::size_t rows = data.fEntries.size();
+      if (rows == 0)
+         return;
+      RTensor<T> x(data.fInputs.data(), {rows, N});
+      auto y = fModel->Compute(x);
+      data.fOutputSize = y.GetShape()[1];
+      for (std::size_t i = 0; i < rows; i++)
+         for (std::size_t j = 0; j < data.fOutputSize; j++)
+            data.fOutputs.push_back(y(i, j));
+      data.fDoneEntries.insert(data.fDoneEntries.end(), data.fEntries.begin(), data.fEntries.end());
+      data.fInputs.clear();
+      data.fEntries.clear();
+   }
+
+public:
+   using Result_t = std::vector<T>;
+
+   RBatchComputeHelper(std::shared_ptr<Model> model, unsigned int nslots = 1, std::size_t batchSize = 1024)
+      : fResult(std::make_shared<std::vector<T>>()), fModel(std::move(model)), fSlots(nslots > 0 ? nslots : 1),
+        fBatchSize(batchSize > 0 ? batchSize : 1)
+   {
+   }
+   RBatchComputeHelper(RBatchComputeHelper &&) = default;
+   RBatchComputeHelper(const RBatchComputeHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   void Initialize()
+   {
+      for (auto &data : fSlots) {
+         data.fInputs.reserve(fBatchSize * N);
+         data.fEntries.reserve(fBatchSize);
+      }
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   template <typename... Cols>
+   void Exec(unsigned int slot, ULong64_t entry, const Cols &...cols)
+   {
+      static_assert(sizeof...(Cols) == N, "RBatchComputeHelper: the entry number must be followed by N input columns");
+      auto &data = fSlots[slot];
+      data.fEntries.push_back(entry);
+      int expander[] = {(data.fInputs.push_back(static_cast<T>(cols)), 0)...};
+      (void)expander;
+      if (data.fEntries.size() >= fBatchSize)
+         Evaluate(slot);
+   }
+
+   void Finalize()
+   {
+      for (unsigned int slot = 0; slot < fSlots.size(); slot++)
+         Evaluate(slot);
+      // order the outputs of all the slots by entry number
+      std::vector<std::pair<ULong64_t, const T *>> outputs;
+      std::size_t outputSize = 0;
+      for (auto &data : fSlots) {
+         if (data.fOutputSize > 0)
+            outputSize = data.fOutputSize;
+         for (std::size_t i = 0; i < data.fDoneEntries.size(); i++)
+            outputs.emplace_back(data.fDoneEntries[i], data.fOutputs.data() + i * data.fOutputSize);
+      }
+      std::sort(outputs.begin(), outputs.end(),
+                [](const std::pair<ULong64_t, const T *> &a, const std::pair<ULong64_t, const T *> &b) {
+                   return a.first < b.first;
+                });
+      fResult->clear();
+      fResult->reserve(outputs.size() * outputSize);
+      for (auto &output : outputs)
+         fResult->insert(fResult->end(), output.second, output.second + outputSize);
+      for (auto &data : fSlots)
+         data = SlotData();
+   }
+
+   std::string GetActionName() { return "BatchCompute"; }
+};
+
 } // namespace Experimental
 } // namespace TMVA
 
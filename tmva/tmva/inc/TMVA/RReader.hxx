@@ -196,6 +196,20 @@ public:
       if (fAnalysisType == Internal::AnalysisType::Multiclass)
          y = y.Reshape({numEntries, numClasses});
 
+      // Classification: the batch evaluation is thread-safe and does not need the lock
+      if (fAnalysisType == Internal::AnalysisType::Classification) {
+         std::vector<float> inputs(numEntries * numVars);
+         for (std::size_t i = 0; i < numEntries; i++) {
+            for (std::size_t j = 0; j < numVars; j++) {
+               inputs[i * numVars + j] = x(i, j);
+            }
+         }
+         const auto values = fReader->EvaluateBatchMVA(inputs, name);
+         for (std::size_t i = 0; i < numEntries; i++)
+            y(i) = values[i];
+         return y;
+      }
+
       // Fill output tensor
       for (std::size_t i = 0; i < numEntries; i++) {
          for (std::size_t j = 0; j < numVars; j++) {
@@ -93,6 +93,12 @@ namespace TMVA {
       Double_t EvaluateMVA( MethodBase* method,           Double_t aux = 0 );
       Double_t EvaluateMVA( const TString& methodTag,     Double_t aux = 0 );
 
+      // returns the MVA responses of nEvents events, whose input values are stored contiguously in input
+      // (event after event, in the order of the variables added to the reader). Neither the reader nor the
+      // method is modified: several threads can evaluate the same reader at the same time
+      void EvaluateBatchMVA( const Float_t* input, size_t nEvents, const TString& methodTag, Double_t* output ) const;
+      std::vector<Double_t> EvaluateBatchMVA( const std::vector<Float_t>& input, const TString& methodTag ) const;
+
       // returns error on MVA response for given event
       // NOTE: must be called AFTER "EvaluateMVA(...)" call !
       Double_t GetMVAError() const { return fMvaEventError; }
@@ -65,6 +65,8 @@ struct BranchlessTree {
    std::vector<int> fInputs;   ///< Cut variables / inputs
 
    inline T Inference(const T *input, const int stride);
+   inline void Inference(const T *inputs, const int rows, const int strideTree, const int strideBatch,
+                         T *predictions);
    inline void FillSparse();
    inline std::string GetInferenceCode(const std::string& funcName, const std::string& typeName);
 };
@@ -83,6 +85,39 @@ inline T BranchlessTree<T>::Inference(const T *input, const int stride)
    return fThresholds[index];
 }
 
+/// Perform inference on a batch of input vectors and add the tree scores to the predictions
+///
+/// The events are walked through the tree together, one level after the other, so that the nodes of the tree are
+/// read once per level for the whole batch and the loop over the events, without dependencies between its
+/// iterations, can be vectorized by the compiler.
+/// \param[in] inputs Pointer to data containing the input values
+/// \param[in] rows Number of events
+/// \param[in] strideTree Stride to go from one input variable to the next one
+/// \param[in] strideBatch Stride to go from one event to the next one
+/// \param[in,out] predictions Pointer to the buffer to which the tree scores of the events are added
+template <typename T>
+inline void BranchlessTree<T>::Inference(const T *inputs, const int rows, const int strideTree, const int strideBatch,
+                                         T *predictions)
+{
+   constexpr int kBlockSize = 64;
+   int index[kBlockSize];
+   const int *treeInputs = fInputs.data();
+   const T *thresholds = fThresholds.data();
+   for (int first = 0; first < rows; first += kBlockSize) {
+      const int n = std::min(kBlockSize, rows - first);
+      const T *input = inputs + first * strideBatch;
+      std::fill(index, index + n, 0);
+      for (int level = 0; level < fTreeDepth; ++level) {
+         for (int i = 0; i < n; ++i) {
+            const int node = index[i];
+            index[i] = 2 * node + 1 + (input[i * strideBatch + treeInputs[node] * strideTree] > thresholds[node]);
+         }
+      }
+      for (int i = 0; i < n; ++i)
+         predictions[first + i] += thresholds[index[i]];
+   }
+}
+
 /// Fill nodes of a sparse tree forming a full tree
 ///
 /// Sparse parts of the tree are marked with -1 values in the feature vector. The
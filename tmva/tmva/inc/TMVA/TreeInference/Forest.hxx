@@ -33,6 +33,9 @@
 #include "TUUID.h"
 #include "TGenericClassInfo.h" // ROOT::Internal::GetDemangledTypeName
 
+#include "ROOT/TSeq.hxx"
+#include "TMVA/Config.h"
+
 #include "BranchlessTree.hxx"
 #include "Objectives.hxx"
 
@@ -57,6 +60,24 @@ bool CompareTree(const BranchlessTree<T> &a, const BranchlessTree<T> &b)
    else
       return a.fInputs[0] < b.fInputs[0];
 }
+
+/// Number of events evaluated by all the trees of a forest before going to the next events
+constexpr int kForestBlockSize = 256;
+
+/// Call func(first) for the first event of each block of kForestBlockSize events, in parallel with the thread
+/// executor of TMVA if the multi-threading is enabled (see TMVA::Config::EnableMT and ROOT::EnableImplicitMT)
+template <typename F>
+void ForEachBlock(const int rows, F &&func)
+{
+   const int nBlocks = (rows + kForestBlockSize - 1) / kForestBlockSize;
+   if (nBlocks > 1 && TMVA::Config::Instance().IsMTEnabled()) {
+      TMVA::Config::Instance().GetThreadExecutor().Foreach([&](int block) { func(block * kForestBlockSize); },
+                                                           ROOT::TSeqI(nBlocks));
+   } else {
+      for (int block = 0; block < nBlocks; block++)
+         func(block * kForestBlockSize);
+   }
+}
 } // namespace Internal
 
 /// Forest base class
@@ -75,6 +96,10 @@ struct ForestBase {
 
 /// Perform inference of the forest on a batch of inputs
 ///
+/// The trees are evaluated one after the other on blocks of events, so that the inputs of a block stay in the
+/// cache while they are walked through all the trees. The blocks are processed in parallel if the multi-threading
+/// of TMVA is enabled.
+///
 /// \param[in] inputs Pointer to data containing the inputs
 /// \param[in] rows Number of events in inputs vector
 /// \param[in] layout Row major (true) or column major (false) memory layout
@@ -84,13 +109,15 @@ inline void ForestBase<T, ForestType>::Inference(const T *inputs, const int rows
 {
    const auto strideTree = layout ? 1 : rows;
    const auto strideBatch = layout ? fNumInputs : 1;
-   for (int i = 0; i < rows; i++) {
-      predictions[i] = 0.0;
-      for (auto &tree : fTrees) {
-         predictions[i] += tree.Inference(inputs + i * strideBatch, strideTree);
-      }
-      predictions[i] = fObjectiveFunc(predictions[i]);
-   }
+   Internal::ForEachBlock(rows, [&](int first) {
+      const int n = std::min(Internal::kForestBlockSize, rows - first);
+      T *y = predictions + first;
+      std::fill(y, y + n, T(0));
+      for (auto &tree : fTrees)
+         tree.Inference(inputs + first * strideBatch, n, strideTree, strideBatch, y);
+      for (int i = 0; i < n; i++)
+         y[i] = fObjectiveFunc(y[i]);
+   });
 }
 
 /// Forest using branchless trees
@@ -357,9 +384,20 @@ BranchlessJittedForest<T>::Load(const std::string &key, const std::string &filen
 template <typename T>
 void BranchlessJittedForest<T>::Inference(const T *inputs, const int rows, bool layout, T *predictions)
 {
-   this->fTrees(inputs, rows, layout, predictions);
-   for (int i = 0; i < rows; i++)
-      predictions[i] = this->fObjectiveFunc(predictions[i]);
+   // the jitted function takes the stride between the input variables from the number of rows: only the events in
+   // row major layout can be split in blocks
+   if (!layout) {
+      this->fTrees(inputs, rows, layout, predictions);
+      for (int i = 0; i < rows; i++)
+         predictions[i] = this->fObjectiveFunc(predictions[i]);
+      return;
+   }
+   Internal::ForEachBlock(rows, [&](int first) {
+      const int n = std::min(Internal::kForestBlockSize, rows - first);
+      this->fTrees(inputs + first * this->fNumInputs, n, layout, predictions + first);
+      for (int i = first; i < first + n; i++)
+         predictions[i] = this->fObjectiveFunc(predictions[i]);
+   });
 }
 
 } // namespace Experimental
@@ -36,6 +36,31 @@ void TCpu<AFloat>::ActivationFunctionForward(Tensor_t & X, EActivationFunction a
    // scaling and translation is not yet implemented
    TMVA::DNN::evaluate<TCpu<AFloat>>( X, activFunct);
 }
+//______________________________________________________________________________
+/// Compute dX = f'(X) * dY in a single parallel pass, with \p df the derivative f'
+template <typename AFloat, typename Function_t>
+void MapActivationGradients(TCpuTensor<AFloat> &dX, const TCpuTensor<AFloat> &dY, const TCpuTensor<AFloat> &X,
+                            Function_t df)
+{
+   AFloat *dataDX = dX.GetRawDataPointer();
+   const AFloat *dataDY = dY.GetRawDataPointer();
+   const AFloat *dataX = X.GetRawDataPointer();
+   const size_t nelements = dX.GetNoElements();
+   R__ASSERT(nelements == dY.GetNoElements() && nelements == X.GetNoElements());
+   const size_t nsteps = TCpuMatrix<AFloat>::GetNWorkItems(nelements);
+
+   auto ff = [&](UInt_t workerID) {
+      const size_t jMax = std::min(workerID + nsteps, nelements);
+      for (size_t j = workerID; j < jMax; ++j)
+         dataDX[j] = df(dataX[j]) * dataDY[j];
+      return 0;
+   };
+   if (nsteps < nelements)
+      TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(ff, ROOT::TSeqI(0, nelements, nsteps));
+   else
+      ff(0);
+}
+
 //______________________________________________________________________________
 template<typename AFloat>
 void TCpu<AFloat>::ActivationFunctionBackward(Tensor_t & dX, const Tensor_t & /* Y */,
@@ -46,10 +71,30 @@ void TCpu<AFloat>::ActivationFunctionBackward(Tensor_t & dX, const Tensor_t & /*
 {
    // scaling and translation not yet implemented
    // output tensor (Y) could also be used to speed up derivative calculation
-   // compute dx = f'(x)
-   TMVA::DNN::evaluateDerivative<TCpu<AFloat>>(dX, activFunct, X);
-    // Compute element-wise product.  dx = f'(x) * dY
-   Hadamard(dX, dY);
+   // compute dx = f'(x) * dY, in a single pass for the usual activation functions
+   switch (activFunct) {
+   case EActivationFunction::kIdentity:
+      MapActivationGradients(dX, dY, X, [](AFloat) { return AFloat(1.0); });
+      break;
+   case EActivationFunction::kRelu:
+      MapActivationGradients(dX, dY, X, [](AFloat x) { return (x < 0.0) ? AFloat(0.0) : AFloat(1.0); });
+      break;
+   case EActivationFunction::kSigmoid:
+      MapActivationGradients(dX, dY, X, [](AFloat x) {
+         AFloat sig = 1.0 / (1.0 + exp(-x));
+         return sig * (1.0 - sig);
+      });
+      break;
+   case EActivationFunction::kTanh:
+      MapActivationGradients(dX, dY, X, [](AFloat x) {
+         AFloat t = tanh(x);
+         return 1 - t * t;
+      });
+      break;
+   default:
+      TMVA::DNN::evaluateDerivative<TCpu<AFloat>>(dX, activFunct, X);
+      Hadamard(dX, dY);
+   }
 }
 //______________________________________________________________________________
 template<typename AFloat>
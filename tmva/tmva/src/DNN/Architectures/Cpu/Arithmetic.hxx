@@ -63,8 +63,18 @@ void TCpu<AReal>::Multiply(TCpuMatrix<AReal> &C,
     const AReal * BPointer = B.GetRawDataPointer();
           AReal * CPointer = C.GetRawDataPointer();
 
-    ::TMVA::DNN::Blas::Gemm(&transa, &transb, &m, &n, &k, &alpha,
-                            APointer, &m, BPointer, &k, &beta, CPointer, &m);
+    // the rows of A are split in blocks, whose products are computed in parallel
+    const int nRowsBlock = TCpuMatrix<AReal>::GetNRowsPerBlock(m, size_t(m) * n * k);
+    auto f = [&](UInt_t row) {
+       int mBlock = std::min(nRowsBlock, m - (int)row);
+       ::TMVA::DNN::Blas::Gemm(&transa, &transb, &mBlock, &n, &k, &alpha,
+                               APointer + row, &m, BPointer, &k, &beta, CPointer + row, &m);
+       return 0;
+    };
+    if (nRowsBlock < m)
+       TCpuMatrix<AReal>::GetThreadExecutor().Foreach(f, ROOT::TSeqI(0, m, nRowsBlock));
+    else
+       f(0);
 #else
    TMatrixT<AReal> tmp(C.GetNrows(), C.GetNcols());
    tmp.Mult(A,B);
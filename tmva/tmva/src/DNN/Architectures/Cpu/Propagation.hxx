@@ -16,6 +16,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "TMVA/DNN/Architectures/Cpu.h"
+#include <math.h>
 
 
 #ifdef R__HAS_TMVACPU
@@ -63,7 +64,17 @@ void TCpu<AFloat>::MultiplyTranspose(TCpuMatrix<AFloat> &output, const TCpuMatri
    const AFloat *B = Weights.GetRawDataPointer();
    AFloat *C = output.GetRawDataPointer();
 
-   ::TMVA::DNN::Blas::Gemm(&transa, &transb, &m, &n, &k, &alpha, A, &m, B, &n, &beta, C, &m);
+   // the events of the batch are split in blocks of rows, whose products are computed in parallel
+   const int nRowsBlock = TCpuMatrix<AFloat>::GetNRowsPerBlock(m, size_t(m) * n * k);
+   auto f = [&](UInt_t row) {
+      int mBlock = std::min(nRowsBlock, m - (int)row);
+      ::TMVA::DNN::Blas::Gemm(&transa, &transb, &mBlock, &n, &k, &alpha, A + row, &m, B, &n, &beta, C + row, &m);
+      return 0;
+   };
+   if (nRowsBlock < m)
+      TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI(0, m, nRowsBlock));
+   else
+      f(0);
 #else
    TMatrixT<AFloat> tmp(output.GetNrows(), output.GetNcols());
    tmp.MultT(input, Weights);
@@ -96,6 +107,70 @@ void TCpu<AFloat>::AddRowWise(TCpuMatrix<AFloat> &output, const TCpuMatrix<AFloa
 #endif
 }
 
+/// Add the biases row-wise to the matrix \p output, copy it to \p inputActivationFunc and apply \p f
+/// to its elements, in a single parallel pass over the column-major data
+template <typename AFloat, typename Function_t>
+void AddBiasesAndApply(TCpuMatrix<AFloat> &output, TCpuMatrix<AFloat> &inputActivationFunc,
+                       const TCpuMatrix<AFloat> &biases, Function_t f)
+{
+   AFloat *data = output.GetRawDataPointer();
+   AFloat *x = inputActivationFunc.GetRawDataPointer();
+   const AFloat *b = biases.GetRawDataPointer();
+   const size_t nRows = output.GetNrows();
+   const size_t nelements = output.GetNoElements();
+   R__ASSERT(inputActivationFunc.GetNoElements() == nelements);
+   R__ASSERT(output.GetNcols() <= biases.GetNoElements());
+   const size_t nsteps = TCpuMatrix<AFloat>::GetNWorkItems(nelements);
+
+   auto ff = [&](UInt_t workerID) {
+      const size_t jMax = std::min(workerID + nsteps, nelements);
+      size_t col = workerID / nRows;
+      size_t row = workerID % nRows;
+      for (size_t j = workerID; j < jMax; ++j) {
+         const AFloat value = data[j] + b[col];
+         x[j] = value;
+         data[j] = f(value);
+         if (++row == nRows) {
+            row = 0;
+            ++col;
+         }
+      }
+      return 0;
+   };
+   if (nsteps < nelements)
+      TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(ff, ROOT::TSeqI(0, nelements, nsteps));
+   else
+      ff(0);
+}
+
+template <typename AFloat>
+void TCpu<AFloat>::DenseLayerForward(TCpuTensor<AFloat> &output, TCpuTensor<AFloat> &inputActivationFunc,
+                                     const TCpuTensor<AFloat> &input, const TCpuMatrix<AFloat> &weights,
+                                     const TCpuMatrix<AFloat> &biases, EActivationFunction activFunc,
+                                     const ActivationDescriptor_t activationDescr)
+{
+   Matrix_t output_m = output.GetMatrix();
+   Matrix_t inputActivationFunc_m = inputActivationFunc.GetMatrix();
+   MultiplyTranspose(output_m, input.GetMatrix(), weights);
+
+   switch (activFunc) {
+   case EActivationFunction::kRelu:
+      AddBiasesAndApply(output_m, inputActivationFunc_m, biases, [](AFloat x) { return (x < 0.0) ? 0.0 : x; });
+      break;
+   case EActivationFunction::kSigmoid:
+      AddBiasesAndApply(output_m, inputActivationFunc_m, biases, [](AFloat x) { return 1.0 / (1.0 + exp(-x)); });
+      break;
+   case EActivationFunction::kTanh:
+      AddBiasesAndApply(output_m, inputActivationFunc_m, biases, [](AFloat x) { return tanh(x); });
+      break;
+   default:
+      // the other activation functions are applied in a second pass
+      AddBiasesAndApply(output_m, inputActivationFunc_m, biases, [](AFloat x) { return x; });
+      if (activFunc != EActivationFunction::kIdentity)
+         ActivationFunctionForward(output, activFunc, activationDescr);
+   }
+}
+
 template <typename AFloat>
 void TCpu<AFloat>::Backward(TCpuTensor<AFloat> &activationGradientsBackward, TCpuMatrix<AFloat> &weightGradients,
                             TCpuMatrix<AFloat> &biasGradients, const TCpuTensor<AFloat> &df,
@@ -287,6 +287,16 @@ TMVA::DecisionTree* TMVA::DecisionTree::CreateFromXML(void* node, UInt_t tmva_Ve
    return dt;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// building the decision tree by recursively calling the splitting of
+/// one (root-) node into two daughter nodes (returns the number of nodes)
+
+UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & eventSample,
+                                      TMVA::DecisionTreeNode *node)
+{
+   return this->BuildTree(eventSample, node, nullptr);
+}
+
 // #### Multithreaded DecisionTree::BuildTree
 #ifdef R__USE_IMT
 //====================================================================================
@@ -372,10 +382,13 @@ struct BuildNodeInfo{
 
 ////////////////////////////////////////////////////////////////////////////////
 /// building the decision tree by recursively calling the splitting of
-/// one (root-) node into two daughter nodes (returns the number of nodes)
+/// one (root-) node into two daughter nodes (returns the number of nodes).
+/// With the histogram based splitting, nodeHist are the histograms of the
+/// node already obtained when splitting its parent (filled here if NULL)
 
 UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & eventSample,
-                                      TMVA::DecisionTreeNode *node)
+                                      TMVA::DecisionTreeNode *node,
+                                      std::vector<Double_t> *nodeHist)
 {
    if (node==NULL) {
       //start with the root node
@@ -515,7 +528,13 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
 
       // Train the node and figure out the separation gain and split points
       Double_t separationGain;
-      if (fNCuts > 0){
+      std::vector<Double_t> hist;
+      if (UseHistogramSplits()) {
+         if (nodeHist) hist.swap(*nodeHist);
+         else this->FillNodeHistograms(eventSample, hist);
+         separationGain = this->TrainNodeHistograms(node, hist);
+      }
+      else if (fNCuts > 0){
          separationGain = this->TrainNodeFast(eventSample, node);
       }
       else {
@@ -594,8 +613,13 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
          node->SetLeft(leftNode);
          node->SetRight(rightNode);
 
-         this->BuildTree(rightSample, rightNode);
-         this->BuildTree(leftSample,  leftNode );
+         // the histograms of the daughters are only needed if they can be split further
+         std::vector<Double_t> rightHist, leftHist;
+         if (!hist.empty() && node->GetDepth()+1 < fMaxDepth)
+            this->SplitNodeHistograms(hist, leftSample, rightSample, leftHist, rightHist);
+
+         this->BuildTree(rightSample, rightNode, rightHist.empty() ? nullptr : &rightHist);
+         this->BuildTree(leftSample,  leftNode,  leftHist.empty() ? nullptr : &leftHist);
 
       }
    }
@@ -632,7 +656,8 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
 #else
 
 UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & eventSample,
-                                      TMVA::DecisionTreeNode *node)
+                                      TMVA::DecisionTreeNode *node,
+                                      std::vector<Double_t> *nodeHist)
 {
    if (node==NULL) {
       //start with the root node
@@ -759,7 +784,12 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
    if ((eventSample.size() >= 2*fMinSize  && s+b >= 2*fMinSize) && node->GetDepth() < fMaxDepth
        && ( ( s!=0 && b !=0 && !DoRegression()) || ( (s+b)!=0 && DoRegression()) ) ) {
       Double_t separationGain;
-      if (fNCuts > 0){
+      std::vector<Double_t> hist;
+      if (UseHistogramSplits()) {
+         if (nodeHist) hist.swap(*nodeHist);
+         else this->FillNodeHistograms(eventSample, hist);
+         separationGain = this->TrainNodeHistograms(node, hist);
+      } else if (fNCuts > 0){
          separationGain = this->TrainNodeFast(eventSample, node);
       } else {
          separationGain = this->TrainNodeFull(eventSample, node);
@@ -837,8 +867,13 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
          node->SetLeft(leftNode);
          node->SetRight(rightNode);
 
-         this->BuildTree(rightSample, rightNode);
-         this->BuildTree(leftSample,  leftNode );
+         // the histograms of the daughters are only needed if they can be split further
+         std::vector<Double_t> rightHist, leftHist;
+         if (!hist.empty() && node->GetDepth()+1 < fMaxDepth)
+            this->SplitNodeHistograms(hist, leftSample, rightSample, leftHist, rightHist);
+
+         this->BuildTree(rightSample, rightNode, rightHist.empty() ? nullptr : &rightHist);
+         this->BuildTree(leftSample,  leftNode,  leftHist.empty() ? nullptr : &leftHist);
 
       }
    }
@@ -2335,6 +2370,242 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
 }
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+/// Histogram based node splitting: the cut grid of each variable is fixed for
+/// the whole training (see ComputeBinEdges) instead of being recomputed from
+/// the range of each node as in TrainNodeFast. The events of a node are then
+/// histogrammed once on this grid, and only the smaller daughter of a split node
+/// is filled again: the histograms of the larger one are obtained by subtracting
+/// those of the smaller one from the histograms of the parent.
+///
+/// The histograms of a node are stored in a single vector, with for each bin
+/// (the bins of variable ivar start at fBinOffsets[ivar]) the weighted and the
+/// unweighted signal and background sums, and the sums of the weighted targets
+/// and squared targets for regression.
+
+namespace {
+   const UInt_t kNHistQuantities = 6;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// compute the cut grid of the histogram based node splitting: the nCuts
+/// quantiles of the distribution of each variable in the event sample. A value
+/// found at several quantiles (e.g. for integer variables) gives a single cut,
+/// so that a variable can have less than nCuts+1 bins
+
+std::vector<std::vector<Float_t>> TMVA::DecisionTree::ComputeBinEdges( const EventConstList & eventSample,
+                                                                        UInt_t nVars, Int_t nCuts )
+{
+   std::vector<std::vector<Float_t>> edges(nVars);
+   if (eventSample.empty() || nCuts <= 0) return edges;
+
+   auto fvarEdges = [&eventSample, &edges, nCuts](UInt_t ivar = 0){
+      std::vector<Float_t> values(eventSample.size());
+      for (UInt_t iev=0; iev<eventSample.size(); iev++) values[iev] = eventSample[iev]->GetValueFast(ivar);
+      std::sort(values.begin(), values.end());
+      for (Int_t icut=1; icut<=nCuts; icut++) {
+         Float_t cut = values[(values.size()-1) * icut / (nCuts+1)];
+         // a cut at the minimum would not separate any event
+         if (cut > values.front() && (edges[ivar].empty() || cut > edges[ivar].back())) edges[ivar].push_back(cut);
+      }
+      return 0;
+   };
+   TMVA::Config::Instance().GetThreadExecutor().Map(fvarEdges, ROOT::TSeqU(nVars));
+   return edges;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// set the cut grid of the histogram based node splitting, one vector of
+/// increasing cut values per variable (an empty grid switches it off)
+
+void TMVA::DecisionTree::SetBinEdges( const std::vector<std::vector<Float_t>> & edges )
+{
+   fBinEdges = edges;
+   fBinOffsets.assign(1, 0);
+   for (auto &varEdges : fBinEdges) fBinOffsets.push_back(fBinOffsets.back() + varEdges.size() + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// fill the histograms of the events of a node on the fixed cut grid: in
+/// parallel over partitions of the events when there are many events per bin,
+/// otherwise in parallel over the variables
+
+void TMVA::DecisionTree::FillNodeHistograms( const EventConstList & eventSample, std::vector<Double_t> & hist ) const
+{
+   if (fBinEdges.size() != fNvars) {
+      Log() << kFATAL << "<FillNodeHistograms> the cut grid has " << fBinEdges.size() << " variables instead of "
+            << fNvars << Endl;
+   }
+   const UInt_t nBinsTotal = fBinOffsets.back();
+
+   // add one event to the histograms of the variables firstVar to lastVar-1
+   auto fillEvent = [this](const TMVA::Event *evt, std::vector<Double_t> &h, UInt_t firstVar, UInt_t lastVar){
+      const Double_t weight = evt->GetWeight();
+      const Bool_t isSignal = (evt->GetClass() == fSigClass);
+      const Double_t tgt = DoRegression() ? evt->GetTarget(0) : 0;
+      for (UInt_t ivar=firstVar; ivar<lastVar; ivar++) {
+         const std::vector<Float_t> &edges = fBinEdges[ivar];
+         // events at a cut value go to the upper bin, as they go right in DecisionTreeNode::GoesRight
+         UInt_t iBin = fBinOffsets[ivar]
+                     + (std::upper_bound(edges.begin(), edges.end(), evt->GetValueFast(ivar)) - edges.begin());
+         Double_t *bin = &h[kNHistQuantities*iBin];
+         if (isSignal) { bin[0] += weight; bin[2] += 1; }
+         else          { bin[1] += weight; bin[3] += 1; }
+         bin[4] += weight*tgt;
+         bin[5] += weight*tgt*tgt;
+      }
+   };
+
+   hist.assign(kNHistQuantities*nBinsTotal, 0);
+   UInt_t nPartitions = TMVA::Config::Instance().GetThreadExecutor().GetPoolSize();
+   if (eventSample.size() >= 2*nPartitions*nBinsTotal) {
+      auto f = [&eventSample, &fillEvent, &hist, nPartitions, this](UInt_t partition = 0){
+         UInt_t start = 1.0*partition/nPartitions*eventSample.size();
+         UInt_t end   = (partition+1.0)/nPartitions*eventSample.size();
+         std::vector<Double_t> partHist(hist.size(), 0);
+         for (UInt_t iev=start; iev<end; iev++) fillEvent(eventSample[iev], partHist, 0, fNvars);
+         return partHist;
+      };
+      auto redfunc = [](const std::vector<std::vector<Double_t>> &v) -> std::vector<Double_t> {
+         std::vector<Double_t> sum(v.front());
+         for (UInt_t i=1; i<v.size(); i++)
+            for (UInt_t ibin=0; ibin<sum.size(); ibin++) sum[ibin] += v[i][ibin];
+         return sum;
+      };
+      hist = TMVA::Config::Instance().GetThreadExecutor().MapReduce(f, ROOT::TSeqU(nPartitions), redfunc);
+   }
+   else {
+      // each variable fills its own part of the histograms
+      auto fvarFill = [&eventSample, &fillEvent, &hist](UInt_t ivar = 0){
+         for (UInt_t iev=0; iev<eventSample.size(); iev++) fillEvent(eventSample[iev], hist, ivar, ivar+1);
+         return 0;
+      };
+      TMVA::Config::Instance().GetThreadExecutor().Map(fvarFill, ROOT::TSeqU(fNvars));
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// get the histograms of the daughters of a split node: only the daughter with
+/// the fewer events is filled, the histograms of the other one are the parent
+/// histograms (moved out of hist) minus the filled ones
+
+void TMVA::DecisionTree::SplitNodeHistograms( std::vector<Double_t> & hist, const EventConstList & leftSample,
+                                              const EventConstList & rightSample, std::vector<Double_t> & leftHist,
+                                              std::vector<Double_t> & rightHist ) const
+{
+   const Bool_t leftIsSmaller = leftSample.size() < rightSample.size();
+   std::vector<Double_t> &smallHist = leftIsSmaller ? leftHist : rightHist;
+   std::vector<Double_t> &largeHist = leftIsSmaller ? rightHist : leftHist;
+   this->FillNodeHistograms(leftIsSmaller ? leftSample : rightSample, smallHist);
+   largeHist.swap(hist);
+   for (UInt_t ibin=0; ibin<largeHist.size(); ibin++) largeHist[ibin] -= smallHist[ibin];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// decide how to split a node using the histograms of its events on the fixed
+/// cut grid: the cuts are scanned in parallel for the different variables, and
+/// the one with the best separation gain is used (as in TrainNodeFast, events
+/// below the cut are counted as "selected")
+
+Double_t TMVA::DecisionTree::TrainNodeHistograms( TMVA::DecisionTreeNode *node, const std::vector<Double_t> & hist )
+{
+   Bool_t *useVariable = new Bool_t[fNvars];
+   UInt_t *mapVariable = new UInt_t[fNvars];
+   if (fRandomisedTree) { // choose for each node splitting a random subset of variables to choose from
+      UInt_t tmp=fUseNvars;
+      GetRandomisedVariables(useVariable,mapVariable,tmp);
+   }
+   else {
+      for (UInt_t ivar=0; ivar < fNvars; ivar++) useVariable[ivar] = kTRUE;
+   }
+
+   // the totals of the node are the sums over the bins of any variable
+   Double_t nTotS = 0, nTotB = 0, nTotS_unWeighted = 0, nTotB_unWeighted = 0, target = 0, target2 = 0;
+   for (UInt_t ibin=fBinOffsets[0]; ibin<fBinOffsets[1]; ibin++) {
+      const Double_t *bin = &hist[kNHistQuantities*ibin];
+      nTotS += bin[0]; nTotB += bin[1];
+      nTotS_unWeighted += bin[2]; nTotB_unWeighted += bin[3];
+      target += bin[4]; target2 += bin[5];
+   }
+
+   std::vector<Double_t> separationGain(fNvars, -1);
+   std::vector<Int_t> cutIndex(fNvars, -1);
+   std::vector<Double_t> cutSelS(fNvars, 0), cutSelB(fNvars, 0);
+
+   auto fvarMaxSep = [&](UInt_t ivar = 0){
+      if (!useVariable[ivar] || almost_equal_float(node->GetSampleMax(ivar), node->GetSampleMin(ivar))) return 0;
+      Double_t slW = 0, blW = 0, sl = 0, bl = 0, tl = 0, t2l = 0;
+      const UInt_t nBins = fBinOffsets[ivar+1] - fBinOffsets[ivar];
+      for (UInt_t iBin=0; iBin+1<nBins; iBin++) { // the last bin would contain "all events" -->skip
+         const Double_t *bin = &hist[kNHistQuantities*(fBinOffsets[ivar]+iBin)];
+         slW += bin[0]; blW += bin[1];
+         sl  += bin[2]; bl  += bin[3];
+         tl  += bin[4]; t2l += bin[5];
+         Double_t sr = nTotS_unWeighted-sl;
+         Double_t br = nTotB_unWeighted-bl;
+         Double_t srW = nTotS-slW;
+         Double_t brW = nTotB-blW;
+         // both daughter nodes must match the minimum size, in unweighted and in weighted events
+         if ( (sl+bl) > 0 && (sr+br) > 0
+              && ((sl+bl)>=fMinSize && (sr+br)>=fMinSize)
+              && ((slW+blW)>=fMinSize && (srW+brW)>=fMinSize) ) {
+            Double_t sepTmp;
+            if (DoRegression()) sepTmp = fRegType->GetSeparationGain(slW+blW, tl, t2l, nTotS+nTotB, target, target2);
+            else                sepTmp = fSepType->GetSeparationGain(slW, blW, nTotS, nTotB);
+            if (separationGain[ivar] < sepTmp) {
+               separationGain[ivar] = sepTmp;
+               cutIndex[ivar]       = iBin;
+               cutSelS[ivar]        = slW;
+               cutSelB[ivar]        = blW;
+            }
+         }
+      }
+      return 0;
+   };
+   TMVA::Config::Instance().GetThreadExecutor().Map(fvarMaxSep, ROOT::TSeqU(fNvars));
+
+   // you found the best separation cut for each variable, now compare the variables
+   Double_t separationGainTotal = -1;
+   Int_t mxVar = -1;
+   for (UInt_t ivar=0; ivar < fNvars; ivar++) {
+      if (useVariable[ivar] && separationGainTotal < separationGain[ivar]) {
+         separationGainTotal = separationGain[ivar];
+         mxVar = ivar;
+      }
+   }
+
+   if (mxVar >= 0) {
+      Bool_t cutType = kTRUE;
+      if (DoRegression()) {
+         node->SetSeparationIndex(fRegType->GetSeparationIndex(nTotS+nTotB,target,target2));
+         node->SetResponse(target/(nTotS+nTotB));
+         if (almost_equal_double(target2/(nTotS+nTotB), target/(nTotS+nTotB)*target/(nTotS+nTotB))) {
+            node->SetRMS(0);
+         }else{
+            node->SetRMS(TMath::Sqrt(target2/(nTotS+nTotB) - target/(nTotS+nTotB)*target/(nTotS+nTotB)));
+         }
+      }
+      else {
+         node->SetSeparationIndex(fSepType->GetSeparationIndex(nTotS,nTotB));
+         cutType = (cutSelS[mxVar]/nTotS > cutSelB[mxVar]/nTotB);
+      }
+      node->SetSelector((UInt_t)mxVar);
+      node->SetCutValue(fBinEdges[mxVar][cutIndex[mxVar]]);
+      node->SetCutType(cutType);
+      node->SetSeparationGain(separationGainTotal);
+      node->SetNFisherCoeff(0);
+      fVariableImportance[mxVar] += separationGainTotal*separationGainTotal * (nTotS+nTotB) * (nTotS+nTotB);
+   }
+   else {
+      separationGainTotal = 0;
+   }
+
+   delete [] useVariable;
+   delete [] mapVariable;
+
+   return separationGainTotal;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// calculate the fisher coefficients for the event sample and the variables used
@@ -611,6 +611,63 @@ Double_t TMVA::MethodANNBase::GetMvaValue( Double_t* err, Double_t* errUpper )
    return neuron->GetActivationValue();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// get the mva values of a batch of events, whose input values are stored contiguously
+/// in input. The weights are copied from the synapses and the activations of the neurons
+/// are computed in local buffers: the network is only read, so that several threads can
+/// evaluate it at the same time
+
+void TMVA::MethodANNBase::GetBatchMvaValues( const Float_t* input, size_t nEvents, size_t nVariables, Double_t* output ) const
+{
+   std::vector<Float_t> buffer;
+   const Float_t* values = GetTransformedBatch(input, nEvents, nVariables, buffer);
+
+   // weights of the synapses of each layer, neuron after neuron; the bias neurons have none
+   Int_t numLayers = fNetwork->GetEntriesFast();
+   std::vector<Int_t> layerSize(numLayers);
+   std::vector<std::vector<Bool_t>> isBias(numLayers);
+   std::vector<std::vector<Double_t>> weights(numLayers);
+   for (Int_t i = 0; i < numLayers; i++) {
+      TObjArray* layer = (TObjArray*)fNetwork->At(i);
+      layerSize[i] = layer->GetEntriesFast();
+      isBias[i].resize(layerSize[i]);
+      for (Int_t j = 0; j < layerSize[i]; j++) {
+         TNeuron* neuron = (TNeuron*)layer->At(j);
+         isBias[i][j] = (i == 0) ? (j >= (Int_t)nVariables) : neuron->IsInputNeuron();
+         if (i == 0 || isBias[i][j]) continue;
+         for (Int_t k = 0; k < neuron->NumPreLinks(); k++)
+            weights[i].push_back(neuron->PreLinkAt(k)->GetWeight());
+      }
+   }
+
+   const Bool_t isSum = (fNeuronInputType == "sum");
+   const Bool_t isSqSum = (fNeuronInputType == "sqsum");
+   std::vector<Double_t> prev, cur;
+   for (size_t ievt = 0; ievt < nEvents; ievt++) {
+      prev.resize(layerSize[0]);
+      for (Int_t j = 0; j < layerSize[0]; j++)
+         prev[j] = isBias[0][j] ? 1.0 : values[ievt * nVariables + j];
+
+      for (Int_t i = 1; i < numLayers; i++) {
+         TActivation* activation = (i == numLayers-1) ? fOutput : fActivation;
+         const Double_t* w = weights[i].data();
+         cur.assign(layerSize[i], 1.0);
+         for (Int_t j = 0; j < layerSize[i]; j++) {
+            if (isBias[i][j]) continue;
+            Double_t sum = 0;
+            for (Int_t k = 0; k < layerSize[i-1]; k++) {
+               Double_t x = w[k] * prev[k];
+               sum += isSum ? x : (isSqSum ? x*x : TMath::Abs(x));
+            }
+            w += layerSize[i-1];
+            cur[j] = activation->Eval(sum);
+         }
+         std::swap(prev, cur);
+      }
+      output[ievt] = prev[0];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// get the regression value generated by the NN
 
@@ -181,6 +181,7 @@ TMVA::MethodBDT::MethodBDT( const TString& jobName,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fUseHistogramSplits(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -236,6 +237,7 @@ TMVA::MethodBDT::MethodBDT( DataSetInfo& theData,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fUseHistogramSplits(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -311,6 +313,9 @@ Bool_t TMVA::MethodBDT::HasAnalysisType( Types::EAnalysisType type, UInt_t numbe
 ///  - nCuts:           the number of steps in the optimisation of the cut for a node (if < 0, then
 ///                  step size is determined by the events)
 ///  - UseFisherCuts:   use multivariate splits using the Fisher criterion
+///  - UseHistogramSplits: bin the variables once at the nCuts quantiles of the training sample
+///                  and find the node splits on histograms, filling only the smaller daughter
+///                  of a split node and subtracting it from its parent for the other one
 ///  - UseYesNoLeaf     decide if the classification is done simply by the node type, or the S/B
 ///                  (from the training) in the leaf node
 ///  - NodePurityLimit  the minimum purity to classify a node as a signal node (used in pruning and boosting to determine
@@ -419,6 +424,7 @@ void TMVA::MethodBDT::DeclareOptions()
    DeclareOptionRef(fUseFisherCuts=kFALSE, "UseFisherCuts", "Use multivariate splits using the Fisher criterion");
    DeclareOptionRef(fMinLinCorrForFisher=.8,"MinLinCorrForFisher", "The minimum linear correlation between two variables demanded for use in Fisher criterion in node splitting");
    DeclareOptionRef(fUseExclusiveVars=kFALSE,"UseExclusiveVars","Variables already used in fisher criterion are not anymore analysed individually for node splitting");
+   DeclareOptionRef(fUseHistogramSplits=kFALSE,"UseHistogramSplits","Bin the variables once at the nCuts quantiles of the training sample and find the node splits on histograms (faster for large training samples)");
 
 
    DeclareOptionRef(fDoPreselection=kFALSE,"DoPreselection","and and apply automatic pre-selection for 100% efficient signal (bkg) cuts prior to training");
@@ -606,6 +612,12 @@ void TMVA::MethodBDT::ProcessOptions()
       fNCuts=20;
    }
 
+   if (fUseHistogramSplits && (fUseFisherCuts || fNCuts <= 0)) {
+      Log() << kWARNING << "The option UseHistogramSplits needs nCuts > 0 and does not support UseFisherCuts, "
+            << "I will ignore it!" << Endl;
+      fUseHistogramSplits = kFALSE;
+   }
+
    if (fNTrees==0){
       Log() << kERROR << " Zero Decision Trees demanded... that does not work !! "
             << " I set it to 1 .. just so that the program does not crash"
@@ -1264,6 +1276,11 @@ void TMVA::MethodBDT::Train()
       InitGradBoost(fEventSample);
    }
 
+   // the cut grid of the histogram based node splitting is the same for all the trees
+   if (fUseHistogramSplits) {
+      fBinEdges = DecisionTree::ComputeBinEdges(fEventSample, GetNvar(), fNCuts);
+   }
+
    Int_t itree=0;
    Bool_t continueBoost=kTRUE;
    //for (int itree=0; itree<fNTrees; itree++) {
@@ -1297,6 +1314,7 @@ void TMVA::MethodBDT::Train()
                                                  fRandomisedTrees, fUseNvars, fUsePoissonNvars, fMaxDepth,
                                                  itree*nClasses+i, fNodePurityLimit, itree*nClasses+1));
             fForest.back()->SetNVars(GetNvar());
+            if (fUseHistogramSplits) fForest.back()->SetBinEdges(fBinEdges);
             if (fUseFisherCuts) {
                fForest.back()->SetUseFisherCuts();
                fForest.back()->SetMinLinCorrForFisher(fMinLinCorrForFisher);
@@ -1324,6 +1342,7 @@ void TMVA::MethodBDT::Train()
 
          fForest.push_back(dt);
          fForest.back()->SetNVars(GetNvar());
+         if (fUseHistogramSplits) fForest.back()->SetBinEdges(fBinEdges);
          if (fUseFisherCuts) {
             fForest.back()->SetUseFisherCuts();
             fForest.back()->SetMinLinCorrForFisher(fMinLinCorrForFisher);
@@ -2489,6 +2508,42 @@ Double_t TMVA::MethodBDT::PrivateGetMvaValue(const TMVA::Event* ev, Double_t* er
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the MVA values of a batch of events, whose input values are stored
+/// contiguously in input. Same response as GetMvaValue, but the trees are only
+/// read, so that several threads can evaluate the forest at the same time.
+
+void TMVA::MethodBDT::GetBatchMvaValues(const Float_t* input, size_t nEvents, size_t nVariables, Double_t* output) const
+{
+   std::vector<Float_t> buffer;
+   const Float_t* values = GetTransformedBatch(input, nEvents, nVariables, buffer);
+
+   const UInt_t nTrees = fForest.size();
+   const Bool_t isGrad = (fBoostType == "Grad");
+   Double_t norm = 0;
+   for (UInt_t itree = 0; itree < nTrees; itree++) norm += fBoostWeights[itree];
+
+   Event ev(std::vector<Float_t>(nVariables), 0);
+   for (size_t ievt = 0; ievt < nEvents; ievt++) {
+      for (size_t ivar = 0; ivar < nVariables; ivar++) ev.SetVal(ivar, values[ievt * nVariables + ivar]);
+      if (fDoPreselection) {
+         Double_t val = ApplyPreselectionCuts(&ev);
+         if (TMath::Abs(val) > 0.05) {
+            output[ievt] = val;
+            continue;
+         }
+      }
+      Double_t sum = 0;
+      if (isGrad) {
+         for (UInt_t itree = 0; itree < nTrees; itree++) sum += fForest[itree]->CheckEvent(&ev, kFALSE);
+         output[ievt] = 2.0/(1.0+exp(-2.0*sum))-1;
+      } else {
+         for (UInt_t itree = 0; itree < nTrees; itree++) sum += fBoostWeights[itree] * fForest[itree]->CheckEvent(&ev, fUseYesNoLeaf);
+         output[ievt] = (norm > std::numeric_limits<double>::epsilon()) ? sum / norm : 0;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the multiclass MVA response for the BDT classifier.
 
@@ -3130,7 +3185,7 @@ void TMVA::MethodBDT::DeterminePreselectionCuts(const std::vector<const TMVA::Ev
 /// Apply the  preselection cuts before even bothering about any
 /// Decision Trees  in the GetMVA .. --> -1 for background +1 for Signal
 
-Double_t TMVA::MethodBDT::ApplyPreselectionCuts(const Event* ev)
+Double_t TMVA::MethodBDT::ApplyPreselectionCuts(const Event* ev) const
 {
    Double_t result=0;
 
@@ -118,6 +118,7 @@
 #include <sstream>
 #include <cstdlib>
 #include <algorithm>
+#include <mutex>
 #include <limits>
 
 
@@ -892,6 +893,53 @@ void TMVA::MethodBase::AddClassifierOutput( Types::ETreeType type )
    }
 }
 
+namespace {
+// serializes the batch evaluations of the methods which are not thread-safe, and the variable transformations
+std::mutex gBatchEvaluationMutex;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// get the MVA values of a batch of events, whose input values are stored contiguously
+/// in input. Default implementation for the methods whose evaluation is not thread-safe:
+/// the events are evaluated one by one with GetMvaValue, holding a global lock
+
+void TMVA::MethodBase::GetBatchMvaValues(const Float_t *input, size_t nEvents, size_t nVariables,
+                                         Double_t *output) const
+{
+   std::lock_guard<std::mutex> guard(gBatchEvaluationMutex);
+   MethodBase *self = const_cast<MethodBase *>(this);
+   Event ev(std::vector<Float_t>(nVariables), 0);
+   for (size_t ievt = 0; ievt < nEvents; ievt++) {
+      for (size_t ivar = 0; ivar < nVariables; ivar++)
+         ev.SetVal(ivar, input[ievt * nVariables + ivar]);
+      output[ievt] = self->GetMvaValue(&ev);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// apply the variable transformations of the method to a batch of events.
+/// The transformations use internal buffers, so that they are serialized
+
+const Float_t *TMVA::MethodBase::GetTransformedBatch(const Float_t *input, size_t nEvents, size_t nVariables,
+                                                     std::vector<Float_t> &buffer) const
+{
+   const TransformationHandler &handler = GetTransformationHandler();
+   if (handler.GetNumOfTransformations() == 0)
+      return input;
+
+   buffer.resize(nEvents * nVariables);
+   std::lock_guard<std::mutex> guard(gBatchEvaluationMutex);
+   Event ev(std::vector<Float_t>(nVariables), 0);
+   for (size_t ievt = 0; ievt < nEvents; ievt++) {
+      for (size_t ivar = 0; ivar < nVariables; ivar++)
+         ev.SetVal(ivar, input[ievt * nVariables + ivar]);
+      const Event *trEv = handler.Transform(&ev);
+      for (size_t ivar = 0; ivar < nVariables; ivar++)
+         buffer[ievt * nVariables + ivar] = trEv->GetValue(ivar);
+   }
+   return buffer.data();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// get all the MVA values for the events of the current Data type
 std::vector<Double_t> TMVA::MethodBase::GetMvaValues(Long64_t firstEvt, Long64_t lastEvt, Bool_t logProgress)
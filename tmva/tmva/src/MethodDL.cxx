@@ -1253,6 +1253,7 @@ void MethodDL::TrainDeepNet()
       // create a copy of DeepNet for evaluating but with batch size = 1
       // fNet is the saved network and will be with CPU or Referrence architecture
       if (trainingPhase == 1) {
+         fBatchNet.reset();
          fNet = std::unique_ptr<DeepNetImpl_t>(new DeepNetImpl_t(1, inputDepth, inputHeight, inputWidth, batchDepth,
                                                                  batchHeight, batchWidth, J, I, R, weightDecay));
          fBuildNet = true;
@@ -1821,6 +1822,74 @@ Double_t MethodDL::GetMvaValue(Double_t * /*errLower*/, Double_t * /*errUpper*/)
 
    return (TMath::IsNaN(mvaValue)) ? -999. : mvaValue;
 }
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate a batch of events, whose input values are stored contiguously in input.
+/// The networks used for the evaluation are shared, so that the calls are serialized
+/// with a lock of the method, but the events are evaluated in batches with a copy of
+/// fNet of larger batch size, whose matrix products are multi-threaded.
+/// Only the networks with a flat input (starting with a dense layer) are evaluated
+/// in batches, the others are evaluated event by event.
+////////////////////////////////////////////////////////////////////////////////
+void MethodDL::GetBatchMvaValues(const Float_t *input, size_t nEvents, size_t nVariables, Double_t *output) const
+{
+   if (!fNet || fNet->GetDepth() == 0) {
+      Log() << kFATAL << "The network has not been trained and fNet is not built" << Endl;
+   }
+   if (fXInput.GetShape().size() != 2 || fXInput.GetShape()[1] != nVariables) {
+      MethodBase::GetBatchMvaValues(input, nEvents, nVariables, output);
+      return;
+   }
+
+   std::lock_guard<std::mutex> guard(fBatchMutex);
+   MethodDL *self = const_cast<MethodDL *>(this);
+   std::vector<Float_t> buffer;
+   const Float_t *values = GetTransformedBatch(input, nEvents, nVariables, buffer);
+
+   // create the network used for the batches, with the same batch size as GetMvaValues
+   size_t batchSize = fTrainingSettings.empty() ? 1000 : fTrainingSettings.front().batchSize;
+   if (!fBatchNet && nEvents >= batchSize) {
+      size_t netBatchSize = GetBatchSize();
+      bool buildNet = fBuildNet;
+      self->SetBatchSize(batchSize);
+      self->fBatchNet = std::unique_ptr<DeepNetImpl_t>(new DeepNetImpl_t(
+         batchSize, GetInputDepth(), GetInputHeight(), GetInputWidth(), GetBatchDepth(), GetBatchHeight(),
+         GetBatchWidth(), fNet->GetLossFunction(), fNet->GetInitialization(), fNet->GetRegularization(),
+         fNet->GetWeightDecay()));
+      std::vector<DeepNetImpl_t> nets{};
+      self->fBuildNet = false;
+      self->CreateDeepNet(*self->fBatchNet, nets);
+      for (size_t i = 0; i < fBatchNet->GetDepth(); ++i)
+         fBatchNet->GetLayerAt(i)->CopyParameters(*fNet->GetLayerAt(i));
+      self->fBuildNet = buildNet;
+      self->SetBatchSize(netBatchSize);
+   }
+
+   size_t ievt = 0;
+   if (fBatchNet) {
+      batchSize = fBatchNet->GetBatchSize();
+      TensorImpl_t xInput(batchSize, nVariables);
+      MatrixImpl_t yHat(batchSize, fBatchNet->GetOutputWidth());
+      for (; ievt + batchSize <= nEvents; ievt += batchSize) {
+         // column-major input matrix: one row per event
+         ScalarImpl_t *x = xInput.GetRawDataPointer();
+         for (size_t i = 0; i < batchSize; i++)
+            for (size_t j = 0; j < nVariables; j++)
+               x[j * batchSize + i] = values[(ievt + i) * nVariables + j];
+         fBatchNet->Prediction(yHat, xInput, fOutputFunction);
+         for (size_t i = 0; i < batchSize; i++)
+            output[ievt + i] = TMath::IsNaN(yHat(i, 0)) ? -999. : yHat(i, 0);
+      }
+   }
+   // remaining events, evaluated one by one with fNet
+   for (; ievt < nEvents; ievt++) {
+      for (size_t j = 0; j < nVariables; j++)
+         self->fXInputBuffer[j] = values[ievt * nVariables + j];
+      self->fXInput.GetDeviceBuffer().CopyFrom(fXInputBuffer);
+      fNet->Prediction(*fYHat, self->fXInput, fOutputFunction);
+      output[ievt] = TMath::IsNaN((*fYHat)(0, 0)) ? -999. : (*fYHat)(0, 0);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Evaluate the DeepNet on a vector of input values stored in the TMVA Event class
 ////////////////////////////////////////////////////////////////////////////////
@@ -2155,7 +2224,7 @@ void MethodDL::ReadWeightsFromXML(void * rootXML)
    this->SetBatchWidth(batchWidth);
 
 
-
+   fBatchNet.reset();
    fNet = std::unique_ptr<DeepNetImpl_t>(new DeepNetImpl_t(batchSize, inputDepth, inputHeight, inputWidth, batchDepth,
                                                    batchHeight, batchWidth,
                                                    static_cast<ELossFunction>(lossFunctionChar),
@@ -559,6 +559,53 @@ Double_t TMVA::Reader::EvaluateMVA( MethodBase* method, Double_t aux )
                                (fCalculateError?&fMvaEventErrorUpper:0) );
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// evaluates the MVA for a batch of events, whose input values are stored contiguously
+/// in input, event after event. Thread-safe: the methods implementing
+/// MethodBase::GetBatchMvaValues (BDT, MLP, DL) evaluate the events without lock.
+/// Events with a NaN input value get the MVA value -999
+
+void TMVA::Reader::EvaluateBatchMVA( const Float_t* input, size_t nEvents, const TString& methodTag, Double_t* output ) const
+{
+   std::map<TString, IMethod*>::const_iterator it = fMethodMap.find( methodTag );
+   if (it == fMethodMap.end()) {
+      Log() << kFATAL << "<EvaluateBatchMVA> unknown classifier in map: " << methodTag << Endl;
+      return;
+   }
+   MethodBase* kl = dynamic_cast<TMVA::MethodBase*>(it->second);
+   if (kl == 0) {
+      Log() << kFATAL << methodTag << " is not a method" << Endl;
+      return;
+   }
+
+   const size_t nVariables = DataInfo().GetNVariables();
+   kl->GetBatchMvaValues( input, nEvents, nVariables, output );
+
+   for (size_t ievt = 0; ievt < nEvents; ievt++) {
+      for (size_t ivar = 0; ivar < nVariables; ivar++) {
+         if (TMath::IsNaN(input[ievt * nVariables + ivar])) {
+            output[ievt] = -999;
+            break;
+         }
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// evaluates the MVA for a batch of events stored in a vector, event after event
+
+std::vector<Double_t> TMVA::Reader::EvaluateBatchMVA( const std::vector<Float_t>& input, const TString& methodTag ) const
+{
+   const size_t nVariables = DataInfo().GetNVariables();
+   if (nVariables == 0 || input.size() % nVariables != 0)
+      Log() << kFATAL << "<EvaluateBatchMVA> the number of input values (" << input.size()
+            << ") is not a multiple of the number of variables (" << nVariables << ")" << Endl;
+
+   std::vector<Double_t> output(input.size() / nVariables);
+   EvaluateBatchMVA( input.data(), output.size(), methodTag, output.data() );
+   return output;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// evaluates MVA for given set of input variables
 
@@ -0,0 +1,80 @@
+// Tests of the histogram based node splitting of TMVA::DecisionTree
+
+#include <gtest/gtest.h>
+
+#include "TRandom3.h"
+
+#include "TMVA/DecisionTree.h"
+#include "TMVA/DecisionTreeNode.h"
+#include "TMVA/Event.h"
+#include "TMVA/GiniIndex.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// signal (class 0) in the corner x0 > 0.3 and x1 > 0.6 of the unit square
+std::vector<std::unique_ptr<TMVA::Event>> MakeEvents(UInt_t nEvents)
+{
+   TRandom3 rng(42);
+   std::vector<std::unique_ptr<TMVA::Event>> events;
+   for (UInt_t i = 0; i < nEvents; i++) {
+      std::vector<Float_t> values{Float_t(rng.Rndm()), Float_t(rng.Rndm())};
+      UInt_t cls = (values[0] > 0.3 && values[1] > 0.6) ? 0 : 1;
+      events.emplace_back(new TMVA::Event(values, cls));
+   }
+   return events;
+}
+
+} // namespace
+
+TEST(DecisionTreeHistogramSplits, ComputeBinEdges)
+{
+   std::vector<std::unique_ptr<TMVA::Event>> events;
+   for (UInt_t i = 0; i < 100; i++)
+      events.emplace_back(new TMVA::Event(std::vector<Float_t>{Float_t(i), Float_t(i % 3)}, 0));
+   TMVA::DecisionTree::EventConstList sample;
+   for (auto &e : events)
+      sample.push_back(e.get());
+
+   auto edges = TMVA::DecisionTree::ComputeBinEdges(sample, 2, 9);
+   ASSERT_EQ(edges.size(), 2u);
+   // continuous variable: one cut per decile
+   EXPECT_EQ(edges[0].size(), 9u);
+   EXPECT_TRUE(std::is_sorted(edges[0].begin(), edges[0].end()));
+   EXPECT_FLOAT_EQ(edges[0][4], 49.f);
+   // integer variable: a single cut per value above the minimum
+   EXPECT_EQ(edges[1], (std::vector<Float_t>{1.f, 2.f}));
+}
+
+TEST(DecisionTreeHistogramSplits, BuildTree)
+{
+   auto events = MakeEvents(20000);
+   TMVA::DecisionTree::EventConstList sample;
+   for (auto &e : events)
+      sample.push_back(e.get());
+
+   TMVA::GiniIndex gini;
+   TMVA::DecisionTree tree(&gini, 2.5, 40, nullptr, 0, kFALSE, 0, kFALSE, 3);
+   tree.SetNVars(2);
+   auto edges = TMVA::DecisionTree::ComputeBinEdges(sample, 2, 40);
+   tree.SetBinEdges(edges);
+   ASSERT_TRUE(tree.UseHistogramSplits());
+   tree.BuildTree(sample);
+
+   // the cuts are taken from the fixed grid
+   auto root = tree.GetRoot();
+   ASSERT_EQ(root->GetNodeType(), 0);
+   const auto &rootEdges = edges[root->GetSelector()];
+   EXPECT_NE(std::find(rootEdges.begin(), rootEdges.end(), root->GetCutValue()), rootEdges.end());
+
+   UInt_t nCorrect = 0;
+   for (auto &e : events) {
+      Double_t type = tree.CheckEvent(e.get(), kTRUE);
+      if ((type > 0) == (e->GetClass() == 0))
+         nCorrect++;
+   }
+   EXPECT_GT(nCorrect, 0.97 * events.size());
+}
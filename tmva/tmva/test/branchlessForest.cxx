@@ -81,6 +81,36 @@ TEST(BranchlessTree, InferenceSparseTreeDepth2)
    EXPECT_FLOAT_EQ(tree.Inference(input3, 1), 6.0);
 }
 
+TEST(BranchlessTree, InferenceBatch)
+{
+   BranchlessTree<float> tree;
+   tree.fTreeDepth = 2;
+   tree.fThresholds = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+   tree.fInputs = {0, 1, 2};
+   // more events than in a block of the batched inference, in row major layout
+   const int rows = 100;
+   std::vector<float> inputs(3 * rows);
+   for (int i = 0; i < rows; i++) {
+      inputs[3 * i] = (i % 2) ? 1.0 : -1.0;
+      inputs[3 * i + 1] = (i % 3) ? 0.0 : 2.0;
+      inputs[3 * i + 2] = (i % 5) ? 1.0 : 3.0;
+   }
+   std::vector<float> predictions(rows, 10.0);
+   tree.Inference(inputs.data(), rows, 1, 3, predictions.data());
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictions[i], 10.0 + tree.Inference(&inputs[3 * i], 1));
+
+   // column major layout
+   std::vector<float> columns(3 * rows);
+   for (int i = 0; i < rows; i++)
+      for (int j = 0; j < 3; j++)
+         columns[j * rows + i] = inputs[3 * i + j];
+   std::vector<float> predictions2(rows, 0.0);
+   tree.Inference(columns.data(), rows, rows, 1, predictions2.data());
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictions2[i], predictions[i] - 10.0);
+}
+
 TEST(BranchlessJittedTree, InferenceFullTreeDepth0)
 {
    BranchlessTree<float> tree;
@@ -277,3 +307,47 @@ TEST(BranchlessJittedForest, SortTrees)
    for (int i = 0; i < rows; i++)
       EXPECT_FLOAT_EQ(predictions1[i], predictions2[i]);
 }
+
+template <typename ForestType>
+void TestInferenceManyEvents(const std::string &tag)
+{
+   const auto maxDepth = 1;
+   const auto numInputs = 2;
+   const auto numTrees = 2;
+   WriteModel("myModel", "Test" + tag + "4.root", "identity", {0, 1}, {0, 0}, {0.0, 1.0, -1.0, 0.0, 2.0, -2.0},
+              {maxDepth}, {numTrees}, {numInputs}, {1});
+
+   ForestType forest;
+   forest.Load("myModel", "Test" + tag + "4.root", 0);
+
+   // several blocks of events, the last one incomplete
+   const int rows = 1000;
+   std::vector<float> inputs(numInputs * rows);
+   for (int i = 0; i < rows; i++) {
+      inputs[2 * i] = (i % 2) ? 1.0 : -1.0;
+      inputs[2 * i + 1] = (i % 3) ? 1.0 : -1.0;
+   }
+   std::vector<float> predictions(rows);
+   forest.Inference(inputs.data(), rows, true, predictions.data());
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictions[i], ((i % 2) ? -1.0 : 1.0) + ((i % 3) ? -2.0 : 2.0));
+
+#ifdef R__USE_IMT
+   TMVA::Config::Instance().EnableMT(4);
+   std::vector<float> predictionsMT(rows);
+   forest.Inference(inputs.data(), rows, true, predictionsMT.data());
+   TMVA::Config::Instance().DisableMT();
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictionsMT[i], predictions[i]);
+#endif
+}
+
+TEST(BranchlessForest, InferenceManyEvents)
+{
+   TestInferenceManyEvents<BranchlessForest<float>>("BranchlessForest");
+}
+
+TEST(BranchlessJittedForest, InferenceManyEvents)
+{
+   TestInferenceManyEvents<BranchlessJittedForest<float>>("BranchlessJittedForest");
+}
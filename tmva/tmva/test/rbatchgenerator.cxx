@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <TMVA/BatchGenerator/RBatchGenerator.hxx>
+
+#include <TSystem.h>
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <vector>
+
+using namespace TMVA::Experimental;
+
+static const std::string treename_ = "tree";
+static const std::vector<std::string> filenames_ = {"rbatchgenerator_1.root", "rbatchgenerator_2.root"};
+
+// two files of 1000 entries, with x the entry number in the chain and i = 2 * x
+class RBatchGeneratorTest : public ::testing::Test {
+protected:
+   static void SetUpTestCase()
+   {
+      for (std::size_t f = 0; f < filenames_.size(); f++) {
+         const float offset = 1000 * f;
+         ROOT::RDataFrame(1000)
+            .Define("x", [offset](ULong64_t e) { return offset + e; }, {"rdfentry_"})
+            .Define("i", [](float x) { return int(2 * x); }, {"x"})
+            .Snapshot<float, int>(treename_, filenames_[f], {"x", "i"});
+      }
+   }
+   static void TearDownTestCase()
+   {
+      for (auto &f : filenames_)
+         gSystem->Unlink(f.c_str());
+   }
+};
+
+// values of the column x of all the batches of an epoch, and check of the batch shapes
+static std::vector<float> ReadEpoch(RBatchGenerator<float, int> &gen, std::size_t batchSize)
+{
+   std::vector<float> x;
+   bool last = false;
+   for (auto batch = gen.GetBatch(); batch.GetShape()[0] > 0; batch = gen.GetBatch()) {
+      EXPECT_FALSE(last) << "only the last batch can be smaller than the batch size";
+      EXPECT_EQ(batch.GetShape()[1], 2u);
+      last = batch.GetShape()[0] < batchSize;
+      for (std::size_t j = 0; j < batch.GetShape()[0]; j++) {
+         EXPECT_EQ(batch(j, 1), 2 * batch(j, 0));
+         x.push_back(batch(j, 0));
+      }
+   }
+   return x;
+}
+
+TEST_F(RBatchGeneratorTest, TrainingAndValidationEpochs)
+{
+   RBatchGenerator<float, int> gen(treename_, filenames_, {"x", "i"}, 64, 300, 0.2, true, 2);
+   EXPECT_EQ(gen.GetNumEntries(), 2000u);
+
+   gen.StartEpoch();
+   auto train = ReadEpoch(gen, 64);
+   gen.StartValidation();
+   auto validation = ReadEpoch(gen, 64);
+   EXPECT_NEAR(validation.size(), 400, 10);
+
+   // every entry is read once, either for the training or for the validation
+   std::vector<float> all(train);
+   all.insert(all.end(), validation.begin(), validation.end());
+   std::sort(all.begin(), all.end());
+   std::vector<float> expected(2000);
+   std::iota(expected.begin(), expected.end(), 0.f);
+   EXPECT_EQ(all, expected);
+
+   // the training entries are shuffled, differently in each epoch
+   EXPECT_FALSE(std::is_sorted(train.begin(), train.end()));
+   gen.StartEpoch();
+   auto train2 = ReadEpoch(gen, 64);
+   EXPECT_NE(train, train2);
+   std::sort(train.begin(), train.end());
+   std::sort(train2.begin(), train2.end());
+   EXPECT_EQ(train, train2);
+
+   // the validation entries do not depend on the epoch nor on the number of loaders
+   gen.StartValidation();
+   EXPECT_EQ(ReadEpoch(gen, 64), validation);
+   RBatchGenerator<float, int> gen1(treename_, filenames_, {"x", "i"}, 64, 300, 0.2, true, 1);
+   gen1.StartValidation();
+   auto validation1 = ReadEpoch(gen1, 64);
+   std::sort(validation.begin(), validation.end());
+   std::sort(validation1.begin(), validation1.end());
+   EXPECT_EQ(validation1, validation);
+}
+
+TEST_F(RBatchGeneratorTest, NoShuffle)
+{
+   RBatchGenerator<float, int> gen(treename_, filenames_, {"x", "i"}, 100, 250, 0., false);
+   gen.StartEpoch();
+   auto x = ReadEpoch(gen, 100);
+   std::vector<float> expected(2000);
+   std::iota(expected.begin(), expected.end(), 0.f);
+   EXPECT_EQ(x, expected);
+}
+
+TEST_F(RBatchGeneratorTest, ChunkSource)
+{
+   // a source with a filter, keeping one entry out of four
+   auto source = [](ULong64_t begin, ULong64_t end) {
+      ROOT::RDF::Experimental::RDatasetSpec spec(treename_, filenames_, {Long64_t(begin), Long64_t(end)});
+      return ROOT::RDF::RNode(ROOT::RDataFrame(spec).Filter([](int i) { return i % 8 == 0; }, {"i"}));
+   };
+   RBatchGenerator<float, int> gen(source, 2000, {"x", "i"}, 32, 400);
+   gen.StartEpoch();
+   auto x = ReadEpoch(gen, 32);
+   EXPECT_EQ(x.size(), 500u);
+   for (auto v : x)
+      EXPECT_EQ(int(v) % 4, 0);
+}
+
+TEST_F(RBatchGeneratorTest, InterruptedEpoch)
+{
+   // small queue, so that the loaders are waiting when the epoch is interrupted
+   RBatchGenerator<float, int> gen(treename_, filenames_, {"x", "i"}, 10, 100, 0., true, 3, 2);
+   gen.StartEpoch();
+   EXPECT_EQ(gen.GetBatch().GetShape()[0], 10u);
+   gen.StartEpoch();
+   EXPECT_EQ(ReadEpoch(gen, 10).size(), 2000u);
+   gen.StartEpoch();
+   EXPECT_EQ(gen.GetBatch().GetShape()[0], 10u);
+   // the destructor stops the loaders
+}
+
+TEST_F(RBatchGeneratorTest, LoaderError)
+{
+   RBatchGenerator<float, int> gen(treename_, filenames_, {"x", "unknown"}, 10, 100);
+   gen.StartEpoch();
+   EXPECT_THROW(gen.GetBatch(), std::runtime_error);
+}
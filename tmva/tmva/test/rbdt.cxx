@@ -2,7 +2,9 @@
 
 #include "BDTHelpers.hxx"
 #include "TMVA/RBDT.hxx"
+#include "TMVA/RInferenceUtils.hxx"
 
+#include "ROOT/RDataFrame.hxx"
 #include "ROOT/RVec.hxx"
 
 #include <cmath>
@@ -125,3 +127,31 @@ TEST(RBDT, ColumnMajorInput)
    EXPECT_FLOAT_EQ(y(0, 0), 1.0);
    EXPECT_FLOAT_EQ(y(1, 0), 1.0);
 }
+
+TEST(RBDT, BatchComputeHelper)
+{
+   const auto maxDepth = 1;
+   const auto numInputs = 2;
+   const auto numOutputs = 3;
+   const auto numTrees = 3;
+   WriteModel("myModel", "TestRBDT6.root", "identity", {0, 1, 0}, {0, 1, 2},
+              {0.0, 1.0, -1.0, 0.0, -1.0, 1.0, 0.0, 2.0, -2.0}, {maxDepth}, {numTrees}, {numInputs}, {numOutputs});
+
+   auto bdt = std::make_shared<RBDT<>>("myModel", "TestRBDT6.root");
+   const unsigned int nEntries = 2500;
+   ROOT::RDataFrame df(nEntries);
+   auto df2 = df.Define("x1", [](ULong64_t e) { return (e % 2) ? 1.f : -1.f; }, {"rdfentry_"})
+                 .Define("x2", [](ULong64_t e) { return (e % 3) ? 1.f : -1.f; }, {"rdfentry_"});
+   // batches of 1000 entries, the last one incomplete
+   using Helper_t = RBatchComputeHelper<2, RBDT<>>;
+   auto y = df2.Book<ULong64_t, float, float>(Helper_t(bdt, df.GetNSlots(), 1000), {"rdfentry_", "x1", "x2"});
+   auto x1 = df2.Take<float>("x1");
+   auto x2 = df2.Take<float>("x2");
+
+   ASSERT_EQ(y->size(), numOutputs * nEntries);
+   for (unsigned int i = 0; i < nEntries; i++) {
+      auto expected = bdt->Compute({(*x1)[i], (*x2)[i]});
+      for (int j = 0; j < numOutputs; j++)
+         EXPECT_FLOAT_EQ((*y)[i * numOutputs + j], expected[j]);
+   }
+}
@@ -5,12 +5,16 @@
 #include <TSystem.h>
 #include <TMVA/Factory.h>
 #include <TMVA/DataLoader.h>
+#include <TMVA/Reader.h>
 
 #include <TMVA/RReader.hxx>
 #include <TMVA/RInferenceUtils.hxx>
 #include <TMVA/RTensor.hxx>
 #include <TMVA/RTensorUtils.hxx>
 
+#include <algorithm>
+#include <thread>
+
 using namespace TMVA::Experimental;
 
 // Classification
@@ -175,6 +179,41 @@ TEST(RReader, ClassificationComputeTensor)
    EXPECT_EQ(shapeY[0], shapeX[0]);
 }
 
+TEST(RReader, ClassificationBatchEvaluation)
+{
+   TrainClassificationModel();
+   ROOT::RDataFrame df("TreeS", filenameClassification);
+   auto dfRange = df.Range(1000);
+   auto x = AsTensor<float>(dfRange, variablesClassification);
+   const auto numEntries = x.GetShape()[0];
+   std::vector<float> inputs(x.GetData(), x.GetData() + x.GetSize());
+
+   std::vector<float> values(variablesClassification.size());
+   TMVA::Reader reader("Silent");
+   for (std::size_t j = 0; j < values.size(); j++)
+      reader.AddVariable(variablesClassification[j], &values[j]);
+   reader.BookMVA("BDT", modelClassification.c_str());
+
+   std::vector<double> expected(numEntries);
+   for (std::size_t i = 0; i < numEntries; i++) {
+      std::copy_n(inputs.begin() + i * values.size(), values.size(), values.begin());
+      expected[i] = reader.EvaluateMVA("BDT");
+   }
+
+   // the same reader evaluated by several threads at the same time
+   std::vector<std::vector<double>> results(4);
+   std::vector<std::thread> threads;
+   for (auto &r : results)
+      threads.emplace_back([&] { r = reader.EvaluateBatchMVA(inputs, "BDT"); });
+   for (auto &t : threads)
+      t.join();
+   for (auto &r : results) {
+      ASSERT_EQ(r.size(), numEntries);
+      for (std::size_t i = 0; i < numEntries; i++)
+         EXPECT_DOUBLE_EQ(r[i], expected[i]);
+   }
+}
+
 TEST(RReader, ClassificationComputeDataFrame)
 {
    TrainClassificationModel();
@@ -15,6 +15,8 @@
 #include <memory>
 
 namespace arrow {
+class RecordBatchReader;
+class Schema;
 class Table;
 }
 
@@ -30,6 +32,10 @@ namespace RDF {
 class RArrowDS final : public RDataSource {
 private:
    std::shared_ptr<arrow::Table> fTable;
+   /// The source of record batches in streaming mode, null if reading a whole table
+   std::shared_ptr<arrow::RecordBatchReader> fReader;
+   std::shared_ptr<arrow::Schema> fSchema;
+   ULong64_t fNStreamedEntries = 0; ///< In streaming mode, the number of entries of the record batches read so far
    std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
    std::vector<std::string> fColumnNames;
    size_t fNSlots = 0U;
@@ -37,9 +43,12 @@ private:
    std::vector<std::pair<size_t, size_t>> fGetterIndex; // (columnId, visitorId)
    std::vector<std::unique_ptr<ROOT::Internal::RDF::TValueGetter>> fValueGetters; // Visitors to be used to track and get entries. One per column.
    std::vector<void *> GetColumnReadersImpl(std::string_view name, const std::type_info &type) final;
+   void InitColumns();
+   std::vector<std::pair<ULong64_t, ULong64_t>> ReadNextRecordBatches();
 
 public:
    RArrowDS(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columns);
+   RArrowDS(std::shared_ptr<arrow::RecordBatchReader> reader, std::vector<std::string> const &columns);
    ~RArrowDS();
    const std::vector<std::string> &GetColumnNames() const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
@@ -54,6 +63,8 @@ public:
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
 RDataFrame MakeArrowDataFrame(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columnNames);
+RDataFrame
+MakeArrowDataFrame(std::shared_ptr<arrow::RecordBatchReader> reader, std::vector<std::string> const &columnNames);
 
 } // namespace RDF
 
@@ -0,0 +1,33 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RCACHEOPTIONS
+#define ROOT_RCACHEOPTIONS
+
+#include <string>
+
+namespace ROOT {
+
+namespace RDF {
+/// A collection of options to steer the creation of the dataset of a Cache() call
+struct RCacheOptions {
+   /// Write the cached columns to an RNTuple on disk instead of keeping them in memory. The RNTuple is reused by the
+   /// Cache() calls of later event loops and processes that cache the same columns of the same computation graph on
+   /// the same input dataset. Requires ROOT 7 support.
+   bool fPersistent = false;
+   /// Directory of the persistent cache. If empty, the value of `RDataFrame.Cache.Dir` in .rootrc is used.
+   std::string fDirectory;
+   /// Part of the key of the persistent cache. Compiled callables are identified by their type only, not by their
+   /// code: change the tag when it changes. Inputs other than a TTree or TChain cannot be told apart by RDataFrame,
+   /// in that case the tag must identify the input dataset and must not be empty.
+   std::string fTag;
+};
+} // ns RDF
+} // ns ROOT
+
+#endif
@@ -16,7 +16,6 @@
 
 #include <cstdint>
 #include <deque>
-#include <list>
 #include <unordered_map>
 #include <set>
 #include <memory>
@@ -42,38 +41,60 @@ private:
    // Regular expressions for type inference
    static const TRegexp fgIntRegex, fgDoubleRegex1, fgDoubleRegex2, fgDoubleRegex3, fgTrueRegex, fgFalseRegex;
 
+   /// The lines of the CSV file that make up one of the entry ranges returned by the last GetEntryRanges() call
+   struct RLineRange {
+      ULong64_t fFirstEntry;
+      ULong64_t fEndEntry;
+      std::uint64_t fBegin; ///< Offset in the file of the first line of the range
+      std::uint64_t fEnd;   ///< Offset in the file past the last line of the range
+   };
+
+   /// The values of the entry range a slot is processing, parsed by that slot, one vector per column.
+   /// Only the vector of the column's type is filled; the column readers point into it.
+   struct RSlotValues {
+      ULong64_t fFirstEntry = 0ULL;
+      ULong64_t fEndEntry = 0ULL;
+      std::vector<std::vector<double>> fDoubles;
+      std::vector<std::vector<Long64_t>> fLong64s;
+      std::vector<std::vector<std::string>> fStrings;
+      // This must be a deque to avoid the specialisation vector<bool>. This would not
+      // work given that the pointer to the boolean in that case cannot be taken
+      std::vector<std::deque<bool>> fBools;
+      std::vector<std::string> fFields;        ///< Reused buffer for the fields of a line
+      std::vector<bool> fColContainingEmpty;   ///< Per column, whether an empty cell was stored as 0 or false
+      std::unique_ptr<ROOT::Internal::RRawFile> fFile; ///< Clone of fCsvFile to read from if it is not memory-mapped
+   };
+
    std::uint64_t fDataPos = 0;
    bool fReadHeaders = false;
    unsigned int fNSlots = 0U;
    std::unique_ptr<ROOT::Internal::RRawFile> fCsvFile;
+   /// The mapping of the whole file if it could be memory-mapped, read from all slots
+   const char *fMappedData = nullptr;
+   std::uint64_t fMappedSize = 0;
    const char fDelimiter;
    const Long64_t fLinesChunkSize;
-   ULong64_t fEntryRangesRequested = 0ULL;
    ULong64_t fProcessedLines = 0ULL; // marks the progress of the consumption of the csv lines
    std::vector<std::string> fHeaders;
    std::unordered_map<std::string, ColType_t> fColTypes;
    std::set<std::string> fColContainingEmpty; // store columns which had empty entry
-   std::list<ColType_t> fColTypesList;
-   std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot]
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column]
-   std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
-   std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
-   std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
-   // This must be a deque to avoid the specialisation vector<bool>. This would not
-   // work given that the pointer to the boolean in that case cannot be taken
-   std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
+   std::vector<ColType_t> fColTypesList;       // the types of the columns, in the order of fHeaders
+   std::vector<std::vector<void *>> fColAddresses; // fColAddresses[column][slot]
+   std::vector<RLineRange> fLineRanges;
+   std::vector<RSlotValues> fSlotValues; // one per slot
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   void ParseRange(unsigned int slot, const RLineRange &range);
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final;
    void ValidateColTypes(std::vector<std::string> &) const;
    void InferColTypes(std::vector<std::string> &);
    void InferType(const std::string &, unsigned int);
-   std::vector<std::string> ParseColumns(const std::string &);
-   size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
+   std::vector<std::string> ParseColumns(const std::string &) const;
+   void ParseColumns(const char *line, std::size_t size, std::vector<std::string> &columns) const;
+   std::size_t ParseValue(const char *line, std::size_t size, std::size_t i, std::string &val) const;
    ColType_t GetType(std::string_view colName) const;
-   void FreeRecords();
+   void WarnColContainingEmpty();
 
 protected:
    std::string AsString() final;
@@ -98,7 +119,7 @@ public:
 /// \param[in] readHeaders `true` if the CSV file contains headers as first row, `false` otherwise
 ///                        (default `true`).
 /// \param[in] delimiter Delimiter character (default ',').
-/// \param[in] linesChunkSize bunch of lines to read, use -1 to read all
+/// \param[in] linesChunkSize bunch of lines to read, use -1 to let the data source choose
 /// \param[in] colTypes Allow user to specify custom column types, accepts an unordered map with keys being
 ///                      column type, values being type alias ('O' for boolean, 'D' for double, 'L' for
 ///                      Long64_t, 'T' for std::string)
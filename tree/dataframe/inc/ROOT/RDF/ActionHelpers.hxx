@@ -24,6 +24,7 @@
 #include "ROOT/RVec.hxx"
 #include "ROOT/TBufferMerger.hxx" // for SnapshotHelper
 #include "ROOT/RDF/RCutFlowReport.hxx"
+#include "ROOT/RDF/RNTupleSnapshotWriter.hxx" // for SnapshotHelperRNTuple
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
@@ -59,6 +60,9 @@
 #include <iomanip>
 #include <numeric> // std::accumulate in MeanHelper
 
+class TProfile;
+class TProfile2D;
+
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
@@ -351,11 +355,91 @@ extern template void BufferedFillHelper::Exec(unsigned int, const std::vector<in
 extern template void
 BufferedFillHelper::Exec(unsigned int, const std::vector<unsigned int> &, const std::vector<unsigned int> &);
 
+/// The number of coordinates passed to HIST::Fill (before the optional weight) if FillHelper can buffer them and
+/// flush them with FillN, 0 otherwise: this is the case for the basic one-dimensional histogram types and for the
+/// profiles, whose Fill methods do the same as their FillN.
+template <typename HIST>
+struct BatchFillDim : std::integral_constant<int, 0> {};
+template <>
+struct BatchFillDim<::TH1D> : std::integral_constant<int, 1> {};
+template <>
+struct BatchFillDim<::TH1F> : std::integral_constant<int, 1> {};
+template <>
+struct BatchFillDim<::TH1I> : std::integral_constant<int, 1> {};
+template <>
+struct BatchFillDim<::TProfile> : std::integral_constant<int, 2> {};
+template <>
+struct BatchFillDim<::TProfile2D> : std::integral_constant<int, 3> {};
+
+template <typename X>
+using IsNotArithmetic = std::integral_constant<bool, !std::is_arithmetic<X>::value>;
+
+template <typename... Xs>
+using AreArithmetic = std::integral_constant<bool, !Disjunction<IsNotArithmetic<Xs>...>::value>;
+
+// clang-format off
+/// Whether FillHelper can buffer the values passed to HIST::Fill: the coordinates and optionally a weight, all numbers.
+template <typename HIST, typename... Xs>
+struct IsBatchFillable
+   : std::integral_constant<bool, (BatchFillDim<HIST>::value > 0 &&
+                                   (sizeof...(Xs) == BatchFillDim<HIST>::value ||
+                                    sizeof...(Xs) == BatchFillDim<HIST>::value + 1) &&
+                                   AreArithmetic<Xs...>::value)> {};
+// clang-format on
+
+/// Fill h with the values of the coordinates in buffers and, if the last buffer is not empty, the weights in it, as a
+/// sequence of calls to h.Fill would.
+void FillWithBuffer(TH1 &h, const std::vector<std::vector<double>> &buffers);
+void FillWithBuffer(::TProfile &h, const std::vector<std::vector<double>> &buffers);
+void FillWithBuffer(::TProfile2D &h, const std::vector<std::vector<double>> &buffers);
+
 /// The generic Fill helper: it calls Fill on per-thread objects and then Merge to produce a final result.
 /// For one-dimensional histograms, if no axes are specified, RDataFrame uses BufferedFillHelper instead.
+/// Values for TH1D, TH1F, TH1I, TProfile and TProfile2D are accumulated per slot and filled in batches with FillN,
+/// which saves a virtual call and the buffer check per value and finds the bins of many values at a time, most notably
+/// when filling with the elements of collections.
 template <typename HIST = Hist_t>
 class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
+   // the number of values a slot accumulates before filling them in its histogram
+   static constexpr std::size_t fgBatchSize = 1024;
+
    std::vector<HIST *> fObjects;
+   // one per slot, only used if IsBatchFillable: the values of each coordinate, then the weights for weighted fills
+   std::vector<std::vector<std::vector<double>>> fBuffers;
+
+   // Fill the values directly or, for histograms that support it, through the buffer of the slot
+   template <typename... Xs, std::enable_if_t<!IsBatchFillable<HIST, Xs...>::value, int> = 0>
+   void FillValues(unsigned int slot, const Xs &...xs)
+   {
+      fObjects[slot]->Fill(xs...);
+   }
+
+   template <typename... Xs, std::enable_if_t<IsBatchFillable<HIST, Xs...>::value, int> = 0>
+   void FillValues(unsigned int slot, const Xs &...xs)
+   {
+      auto &buffers = fBuffers[slot];
+      std::size_t i = 0;
+      int expander[] = {(buffers[i++].emplace_back(xs), 0)...};
+      (void)expander;
+      if (buffers[0].size() == fgBatchSize)
+         FlushBuffer(slot);
+   }
+
+   template <typename H = HIST, std::enable_if_t<std::is_base_of<TH1, H>::value, int> = 0>
+   void FlushBuffer(unsigned int slot)
+   {
+      auto &buffers = fBuffers[slot];
+      if (buffers[0].empty())
+         return;
+      FillWithBuffer(*fObjects[slot], buffers);
+      for (auto &b : buffers)
+         b.clear();
+   }
+
+   template <typename H = HIST, std::enable_if_t<!std::is_base_of<TH1, H>::value, int> = 0>
+   void FlushBuffer(unsigned int)
+   {
+   }
 
    template <typename H = HIST, typename = decltype(std::declval<H>().Reset())>
    void ResetIfPossible(H *h)
@@ -456,12 +540,11 @@ class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    template <std::size_t ColIdx, typename End_t, typename... Its>
    void ExecLoop(unsigned int slot, End_t end, Its... its)
    {
-      auto *thisSlotH = fObjects[slot];
       // loop increments all of the iterators while leaving scalars unmodified
       // TODO this could be simplified with fold expressions or std::apply in C++17
       auto nop = [](auto &&...) {};
       for (; GetNthElement<ColIdx>(its...) != end; nop(++its...)) {
-         thisSlotH->Fill(*its...);
+         FillValues(slot, *its...);
       }
    }
 
@@ -477,6 +560,8 @@ public:
          fObjects[i] = new HIST(*fObjects[0]);
          UnsetDirectoryIfPossible(fObjects[i]);
       }
+      if (BatchFillDim<HIST>::value > 0)
+         fBuffers.assign(nSlots, std::vector<std::vector<double>>(BatchFillDim<HIST>::value + 1));
    }
 
    void InitTask(TTreeReader *, unsigned int) {}
@@ -485,7 +570,7 @@ public:
    template <typename... ValTypes, std::enable_if_t<!Disjunction<IsDataContainer<ValTypes>...>::value, int> = 0>
    auto Exec(unsigned int slot, const ValTypes &...x) -> decltype(fObjects[slot]->Fill(x...), void())
    {
-      fObjects[slot]->Fill(x...);
+      FillValues(slot, x...);
    }
 
    // at least one container argument
@@ -527,6 +612,9 @@ public:
 
    void Finalize()
    {
+      for (unsigned int slot = 0; slot < fBuffers.size(); ++slot)
+         FlushBuffer(slot);
+
       if (fObjects.size() == 1)
          return;
 
@@ -537,7 +625,12 @@ public:
          delete *it;
    }
 
-   HIST &PartialUpdate(unsigned int slot) { return *fObjects[slot]; }
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      if (!fBuffers.empty())
+         FlushBuffer(slot);
+      return *fObjects[slot];
+   }
 
    // Helper functions for RMergeableValue
    std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
@@ -1643,6 +1736,9 @@ public:
 
    std::string GetActionName() { return "Snapshot"; }
 
+   // the addresses of the input values are used as branch addresses of the output tree
+   bool SupportsBlockExecution() const final { return false; }
+
    ROOT::RDF::SampleCallback_t GetSampleCallback() final
    {
       return [this](unsigned int, const RSampleInfo &) mutable { fBranchAddressesNeedReset = true; };
@@ -1804,12 +1900,62 @@ public:
 
    std::string GetActionName() { return "Snapshot"; }
 
+   // the addresses of the input values are used as branch addresses of the output tree
+   bool SupportsBlockExecution() const final { return false; }
+
    ROOT::RDF::SampleCallback_t GetSampleCallback() final
    {
       return [this](unsigned int slot, const RSampleInfo &) mutable { fBranchAddressesNeedReset[slot] = 1; };
    }
 };
 
+/// Helper object for a Snapshot action with RNTuple output, in single- and multi-thread event loops.
+/// Each slot fills its own fill context of a RNTupleParallelWriter, see RNTupleSnapshotWriter.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotHelperRNTuple : public RActionImpl<SnapshotHelperRNTuple<ColTypes...>> {
+   std::unique_ptr<RNTupleSnapshotWriter> fWriter; // must use a ptr because RNTupleSnapshotWriter is not movable
+   TTree *fInputTree;                               // Input TTree or TChain, used to order the output entries
+   /// The data frame returned by Snapshot, which is set to read the RNTuple at the end of the event loop
+   std::shared_ptr<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void>> fOutputDataFrame;
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotHelperRNTuple(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options,
+                         TTree *inputTree,
+                         const std::shared_ptr<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void>> &output)
+      : fWriter(std::make_unique<RNTupleSnapshotWriter>(
+           nSlots, filename, dirname, ntuplename, ReplaceDotWithUnderscore(bnames),
+           std::vector<std::string>{TypeID2TypeName(typeid(ColTypes))...}, options)),
+        fInputTree(inputTree), fOutputDataFrame(output)
+   {
+   }
+   SnapshotHelperRNTuple(const SnapshotHelperRNTuple &) = delete;
+   SnapshotHelperRNTuple(SnapshotHelperRNTuple &&) = default;
+
+   void Initialize() { fWriter->Initialize(fInputTree); }
+
+   void InitTask(TTreeReader *, unsigned int slot) { fWriter->InitTask(slot); }
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      // the values are serialized by the call, so their addresses need not be stable
+      void *addresses[] = {static_cast<void *>(&values)..., nullptr};
+      fWriter->Fill(slot, addresses);
+   }
+
+   void FinalizeTask(unsigned int slot) { fWriter->FinalizeTask(slot); }
+
+   void Finalize() { fWriter->Finalize(*fOutputDataFrame); }
+
+   std::string GetActionName() { return "Snapshot"; }
+
+   ROOT::RDF::SampleCallback_t GetSampleCallback() final
+   {
+      return [this](unsigned int slot, const RSampleInfo &info) mutable { fWriter->UpdateSampleInfo(slot, info); };
+   }
+};
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
@@ -11,6 +11,7 @@
 #ifndef ROOT_RDF_COLUMNREADERUTILS
 #define ROOT_RDF_COLUMNREADERUTILS
 
+#include "RBlockColumnReader.hxx"
 #include "RColumnReaderBase.hxx"
 #include "RColumnRegister.hxx"
 #include "RDefineBase.hxx"
@@ -30,6 +31,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <typeinfo> // for typeid
 #include <vector>
 
@@ -40,6 +42,28 @@ namespace RDF {
 using namespace ROOT::TypeTraits;
 namespace RDFDetail = ROOT::Detail::RDF;
 
+/// In block execution mode, wrap the dataset column reader in a RBlockColumnReader that caches the values of a block.
+template <typename T, std::enable_if_t<IsBlockCacheable<T>::value, int> = 0>
+RDFDetail::RColumnReaderBase *GetBlockColumnReader(unsigned int slot, RDFDetail::RColumnReaderBase &datasetColReader,
+                                                   RLoopManager &lm, const std::string &colName)
+{
+   auto *blockColReader = lm.GetBlockColumnReader(slot, colName, typeid(T));
+   if (blockColReader != nullptr)
+      return blockColReader;
+
+   auto newReader = std::make_unique<RBlockColumnReader<T>>(datasetColReader, lm.GetBlockSize());
+   return lm.AddBlockColumnReader(slot, colName, std::move(newReader), typeid(T));
+}
+
+/// Values of this type cannot be copied in a block: the task running in this slot processes one entry at a time.
+template <typename T, std::enable_if_t<!IsBlockCacheable<T>::value, int> = 0>
+RDFDetail::RColumnReaderBase *GetBlockColumnReader(unsigned int slot, RDFDetail::RColumnReaderBase &datasetColReader,
+                                                   RLoopManager &lm, const std::string &)
+{
+   lm.DisableBlockExecution(slot);
+   return &datasetColReader;
+}
+
 template <typename T>
 RDFDetail::RColumnReaderBase *GetColumnReader(unsigned int slot, RColumnReaderBase *defineOrVariationReader,
                                               RLoopManager &lm, TTreeReader *r, const std::string &colName)
@@ -50,14 +74,18 @@ RDFDetail::RColumnReaderBase *GetColumnReader(unsigned int slot, RColumnReaderBa
    // Check if we already inserted a reader for this column in the dataset column readers (RDataSource or Tree/TChain
    // readers)
    auto *datasetColReader = lm.GetDatasetColumnReader(slot, colName, typeid(T));
-   if (datasetColReader != nullptr)
-      return datasetColReader;
+   if (datasetColReader == nullptr) {
+      assert(r != nullptr && "We could not find a reader for this column, this should never happen at this point.");
+
+      // Make a RTreeColumnReader for this column and insert it in RLoopManager's map
+      auto treeColReader = std::make_unique<RTreeColumnReader<T>>(*r, colName);
+      datasetColReader = lm.AddTreeColumnReader(slot, *r, colName, std::move(treeColReader), typeid(T));
+   }
 
-   assert(r != nullptr && "We could not find a reader for this column, this should never happen at this point.");
+   if (lm.UsesBlockExecution())
+      return GetBlockColumnReader<T>(slot, *datasetColReader, lm, colName);
 
-   // Make a RTreeColumnReader for this column and insert it in RLoopManager's map
-   auto treeColReader = std::make_unique<RTreeColumnReader<T>>(*r, colName);
-   return lm.AddTreeColumnReader(slot, colName, std::move(treeColReader), typeid(T));
+   return datasetColReader;
 }
 
 /// This type aggregates some of the arguments passed to GetColumnReaders.
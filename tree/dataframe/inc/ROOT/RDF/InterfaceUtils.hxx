@@ -251,6 +251,8 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// The data frame returned by Snapshot. Only used for RNTuple output, which sets it up at the end of the event loop
+   std::shared_ptr<RInterface<RLoopManager, void>> fOutputDataFrame;
 };
 
 // Snapshot action
@@ -276,7 +278,15 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    std::vector<bool> isDefine = makeIsDefine();
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      // single- or multi-thread snapshot to RNTuple
+      using Helper_t = SnapshotHelperRNTuple<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      auto *inputTree = prevNode->GetLoopManagerUnchecked()->GetTree();
+      actionPtr.reset(new Action_t(Helper_t(nSlots, filename, dirname, treename, outputColNames, options, inputTree,
+                                            snapHelperArgs->fOutputDataFrame),
+                                   colNames, prevNode, colRegister));
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
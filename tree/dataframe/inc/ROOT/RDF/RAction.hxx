@@ -109,10 +109,30 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevNode.CheckFilters(slot, entry))
+      if (fPrevNode.CheckFilters(slot, entry)) {
+         RProfileScope scope(fProfiler, slot, fProfileId);
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
    }
 
+   void RunBlock(unsigned int slot, Long64_t firstEntry, std::size_t n) final
+   {
+      const auto &mask = fPrevNode.CheckFiltersBlock(slot, firstEntry, n);
+      RProfileScope scope(fProfiler, slot, fProfileId);
+      ULong64_t nExecs = 0ull;
+      for (std::size_t i = 0u; i < n; ++i) {
+         if (mask[i]) {
+            CallExec(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+            ++nExecs;
+         }
+      }
+      scope.SetNEntries(nExecs);
+   }
+
+   bool SupportsBlockExecution() const final { return fHelper.SupportsBlockExecution(); }
+
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
    /// Clean-up operations to be performed at the end of a task.
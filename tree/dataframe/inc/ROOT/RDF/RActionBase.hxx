@@ -12,10 +12,12 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
 
@@ -42,6 +44,9 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   /// The profiler of the current event loop (null if not profiling) and the id of this node in it.
+   RLoopProfiler *fProfiler = nullptr;
+   unsigned int fProfileId = 0u;
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -64,6 +69,14 @@ public:
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Block execution mode counterpart of Run: process the n consecutive entries starting at firstEntry.
+   virtual void RunBlock(unsigned int slot, Long64_t firstEntry, std::size_t n)
+   {
+      for (std::size_t i = 0u; i < n; ++i)
+         Run(slot, firstEntry + i);
+   }
+   /// Return false if this action can not be run in block execution mode (see RLoopManager::SetBlockSize).
+   virtual bool SupportsBlockExecution() const { return true; }
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -76,6 +89,14 @@ public:
    // overridden by RJittedAction
    virtual bool HasRun() const { return fHasRun; }
    virtual void SetHasRun() { fHasRun = true; }
+   /// Time the execution of this action in the next event loop (or stop timing it with nullptr).
+   virtual void SetProfiler(RLoopProfiler *profiler, unsigned int id)
+   {
+      fProfiler = profiler;
+      fProfileId = id;
+   }
+   /// The name of the action, e.g. "Histo1D".
+   virtual std::string GetActionName() = 0;
 
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap) = 0;
@@ -71,6 +71,11 @@ public:
    /// Override this method to register a callback that is executed before the processing a new data sample starts.
    /// The callback will be invoked in the same conditions as with DefinePerSample().
    virtual ROOT::RDF::SampleCallback_t GetSampleCallback() { return {}; }
+
+   /// Override this method to return false if the helper relies on its input values having the same address at every
+   /// call to Exec (e.g. because it uses them as branch addresses). In block execution mode the values of each entry
+   /// of a block are stored at a different address, so event loops that book such actions are run entry by entry.
+   virtual bool SupportsBlockExecution() const { return true; }
 };
 
 } // namespace RDF
@@ -0,0 +1,76 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RBLOCKCOLUMNREADER
+#define ROOT_RDF_RBLOCKCOLUMNREADER
+
+#include "RColumnReaderBase.hxx"
+#include <Rtypes.h> // Long64_t, R__CLING_PTRCHECK
+
+#include <cstddef> // std::size_t
+#include <memory>
+#include <type_traits>
+
+namespace ROOT {
+namespace VecOps {
+template <typename T>
+class RVecView;
+}
+namespace Internal {
+namespace RDF {
+
+namespace RDFDetail = ROOT::Detail::RDF;
+
+/// Column reader used in block execution mode: it keeps a copy of the values of a dataset column for all the entries
+/// of the current block, so that nodes can access them in any order after the data source moved past them.
+class R__CLING_PTRCHECK(off) RBlockColumnReaderBase : public RDFDetail::RColumnReaderBase {
+public:
+   /// Store the value of the underlying reader for the given entry at position idx of the block.
+   /// Position 0 is filled first and sets the first entry of a new block.
+   virtual void Fill(std::size_t idx, Long64_t entry) = 0;
+};
+
+template <typename T>
+class R__CLING_PTRCHECK(off) RBlockColumnReader final : public RBlockColumnReaderBase {
+   /// Non-owning reference to the dataset column reader whose values are copied.
+   RDFDetail::RColumnReaderBase &fReader;
+   std::unique_ptr<T[]> fValues;
+   Long64_t fFirstEntry = -1;
+
+   void *GetImpl(Long64_t entry) final { return &fValues[entry - fFirstEntry]; }
+
+public:
+   RBlockColumnReader(RDFDetail::RColumnReaderBase &reader, std::size_t blockSize)
+      : fReader(reader), fValues(new T[blockSize])
+   {
+   }
+
+   void Fill(std::size_t idx, Long64_t entry) final
+   {
+      if (idx == 0)
+         fFirstEntry = entry;
+      fValues[idx] = fReader.template Get<T>(entry);
+   }
+};
+
+/// Whether the values of a column of type T can be copied in a RBlockColumnReader.
+template <typename T>
+struct IsBlockCacheable
+   : std::integral_constant<bool, std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value> {
+};
+
+/// Views on the buffers of the current entry cannot be kept for the other entries of a block.
+template <typename T>
+struct IsBlockCacheable<ROOT::VecOps::RVecView<T>> : std::false_type {
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RBLOCKCOLUMNREADER
@@ -67,6 +67,8 @@ public:
    void AddFriend(const std::vector<std::pair<std::string, std::string>> &treeAndFileNameGlobs,
                   const std::string &alias = "");
 
+   RDatasetSpec &WithGlobalRange(const REntryRange &entryRange = {});
+
    const std::vector<std::string> &GetTreeNames() const;
    const std::vector<std::string> &GetFileNameGlobs() const;
    Long64_t GetEntryRangeBegin() const;
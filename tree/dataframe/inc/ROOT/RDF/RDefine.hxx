@@ -17,11 +17,15 @@
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RStringView.hxx"
+#include "ROOT/RVec.hxx" // RVecArenaScope
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
 #include <array>
+#include <cstddef> // std::size_t
 #include <deque>
+#include <memory>
+#include <new> // placement new
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -70,28 +74,66 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// The map key is the full variation name, e.g. "pt:up".
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
 
+   /// Values for the entries of the current block, in block execution mode. Each entry of a block is evaluated at
+   /// most once, and its value must stay available while other entries of the same block are being evaluated.
+   struct RBlockResults {
+      std::unique_ptr<ret_type[]> fValues;
+      std::vector<Long64_t> fEntries; ///< The entry for which each element of fValues was evaluated, -1 if none
+      std::size_t fSize = 0;          ///< Zero if block execution is not in use
+   };
+   std::vector<RBlockResults> fBlockResults;
+
+   using IsRVecResult_t = std::integral_constant<bool, RDFInternal::IsRVec<ret_type>::value>;
+
+   /// Call the expression with the values of the input columns, which are read before (outside of the arena scope).
+   template <typename... Args>
+   ret_type CallExpression(unsigned int slot, std::true_type /*isRVecResult*/, Args &&...args)
+   {
+      ROOT::Internal::VecOps::RVecArenaScope arenaScope(fLoopManager->GetRVecArena(slot));
+      return fExpression(std::forward<Args>(args)...);
+   }
+
+   template <typename... Args>
+   ret_type CallExpression(unsigned int, std::false_type /*isRVecResult*/, Args &&...args)
+   {
+      return fExpression(std::forward<Args>(args)...);
+   }
+
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
+   ret_type EvalHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
       (void)entry; // avoid unused parameter warning (gcc 12.1)
+      return CallExpression(slot, IsRVecResult_t{}, fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
+   ret_type EvalHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
       (void)entry; // avoid unused parameter warning (gcc 12.1)
+      return CallExpression(slot, IsRVecResult_t{}, slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void
-   UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
+   ret_type
+   EvalHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
+   {
+      return CallExpression(slot, IsRVecResult_t{}, slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
+   }
+
+   /// Evaluate the expression for the given entry and store its value in result.
+   void Evaluate(ret_type &result, unsigned int slot, Long64_t entry, std::false_type /*isRVecResult*/)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      result = EvalHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+   }
+
+   void Evaluate(ret_type &result, unsigned int slot, Long64_t entry, std::true_type /*isRVecResult*/)
+   {
+      // the buffer of result may belong to an arena that was reset since (see RLoopManager::GetRVecArena()): it must
+      // not be written, so instead of assigning the new value, which could copy it into that buffer, result is
+      // constructed anew
+      ret_type value = EvalHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+      result.~ret_type();
+      new (&result) ret_type(std::move(value));
    }
 
 public:
@@ -99,7 +141,8 @@ public:
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots()),
+        fBlockResults(lm.GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -113,28 +156,64 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+
+      auto &block = fBlockResults[slot];
+      const std::size_t blockSize = fLoopManager->UsesBlockExecution() ? fLoopManager->GetBlockSize() : 0u;
+      if (blockSize != block.fSize) {
+         block.fValues.reset(blockSize > 0 ? new ret_type[blockSize] : nullptr);
+         block.fSize = blockSize;
+      }
+      block.fEntries.assign(blockSize, -1);
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
    void *GetValuePtr(unsigned int slot) final
    {
+      if (fEquivalentDefine)
+         return fEquivalentDefine->GetValuePtr(slot);
       return static_cast<void *>(&fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()]);
    }
 
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    void Update(unsigned int slot, Long64_t entry) final
    {
+      if (fEquivalentDefine) {
+         fEquivalentDefine->Update(slot, entry);
+         return;
+      }
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          // evaluate this define expression, cache the result
-         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         RDFInternal::RProfileScope scope(fProfiler, slot, fProfileId);
+         Evaluate(fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()], slot, entry, IsRVecResult_t{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
    }
 
+   void *UpdateAndGetValuePtr(unsigned int slot, Long64_t entry) final
+   {
+      if (fEquivalentDefine)
+         return fEquivalentDefine->UpdateAndGetValuePtr(slot, entry);
+      auto &block = fBlockResults[slot];
+      if (block.fSize == 0u) {
+         Update(slot, entry);
+         return GetValuePtr(slot);
+      }
+      // the entries of a block are consecutive and at most fSize, so they all map to different elements
+      const auto idx = static_cast<std::size_t>(entry % block.fSize);
+      if (block.fEntries[idx] != entry) {
+         RDFInternal::RProfileScope scope(fProfiler, slot, fProfileId);
+         Evaluate(block.fValues[idx], slot, entry, IsRVecResult_t{});
+         block.fEntries[idx] = entry;
+      }
+      return static_cast<void *>(&block.fValues[idx]);
+   }
+
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
 
+   const void *GetExpressionId() const final { return RDFInternal::GetFunctionId(fExpression); }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
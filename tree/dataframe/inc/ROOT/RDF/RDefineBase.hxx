@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
@@ -48,6 +49,11 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   /// A define that computes the same values, which this one forwards to during the event loop (null if none).
+   RDefineBase *fEquivalentDefine = nullptr;
+   /// The profiler of the current event loop (null if not profiling) and the id of this node in it.
+   RDFInternal::RLoopProfiler *fProfiler = nullptr;
+   unsigned int fProfileId = 0u;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -64,12 +70,36 @@ public:
    std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Update the value for the given entry and return its (type-erased) address. Outside of block execution mode this
+   /// is the address returned by GetValuePtr, otherwise each entry of the current block has its own.
+   virtual void *UpdateAndGetValuePtr(unsigned int slot, Long64_t entry)
+   {
+      Update(slot, entry);
+      return GetValuePtr(slot);
+   }
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
 
    const std::vector<std::string> &GetVariations() const { return fVariationDeps; }
+   const std::string &GetVariationName() const { return fVariation; }
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
+
+   /// The define that is registered with the RLoopManager and evaluated: this one, or the one it wraps for RJittedDefine.
+   virtual RDefineBase *GetConcreteDefine() { return this; }
+   /// An identifier of the expression, equal for defines that evaluate the same function of their inputs, or null if
+   /// it cannot be established (e.g. lambdas or other callables that might carry state).
+   virtual const void *GetExpressionId() const { return nullptr; }
+   /// Forward the evaluation to an equivalent define (or stop forwarding with nullptr). See RLoopManager::OptimizeGraph.
+   void SetEquivalentDefine(RDefineBase *define) { fEquivalentDefine = define; }
+   /// Time the evaluation of this define in the next event loop (or stop timing it with nullptr).
+   void SetProfiler(RDFInternal::RLoopProfiler *profiler, unsigned int id)
+   {
+      fProfiler = profiler;
+      fProfileId = id;
+   }
 
    /// Create clones of this Define that work with values in varied "universes".
    virtual void MakeVariations(const std::vector<std::string> &variations) = 0;
@@ -63,6 +63,9 @@ public:
       // no-op
    }
 
+   // the value only changes between samples, also in block execution mode
+   void *UpdateAndGetValuePtr(unsigned int slot, Long64_t) final { return GetValuePtr(slot); }
+
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    void Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id) final
    {
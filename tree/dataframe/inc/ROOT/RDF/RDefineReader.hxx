@@ -29,23 +29,13 @@ class R__CLING_PTRCHECK(off) RDefineReader final : public ROOT::Detail::RDF::RCo
    /// Non-owning reference to the node responsible for the defined column.
    RDFDetail::RDefineBase &fDefine;
 
-   /// Non-owning ptr to the defined value.
-   void *fValuePtr = nullptr;
-
    /// The slot this value belongs to.
    unsigned int fSlot = std::numeric_limits<unsigned int>::max();
 
-   void *GetImpl(Long64_t entry) final
-   {
-      fDefine.Update(fSlot, entry);
-      return fValuePtr;
-   }
+   void *GetImpl(Long64_t entry) final { return fDefine.UpdateAndGetValuePtr(fSlot, entry); }
 
 public:
-   RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define)
-      : fDefine(define), fValuePtr(define.GetValuePtr(slot)), fSlot(slot)
-   {
-   }
+   RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define) : fDefine(define), fSlot(slot) {}
 };
 
 }
@@ -91,12 +91,15 @@ public:
 
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      if (fEquivalentFilter)
+         return fEquivalentFilter->CheckFilters(slot, entry);
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          if (!fPrevNode.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
             // evaluate this filter, cache the result
+            RDFInternal::RProfileScope scope(fProfiler, slot, fProfileId);
             auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
             passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
                    : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
@@ -107,6 +110,31 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   const RDFInternal::RMaskedEntryRange &CheckFiltersBlock(unsigned int slot, Long64_t firstEntry, std::size_t n) final
+   {
+      if (fEquivalentFilter)
+         return fEquivalentFilter->CheckFiltersBlock(slot, firstEntry, n);
+      auto &mask = fBlockMasks[slot];
+      if (!mask.Holds(firstEntry, n)) {
+         const auto &prevMask = fPrevNode.CheckFiltersBlock(slot, firstEntry, n);
+         mask.Reset(firstEntry, n, false);
+         ULong64_t accepted = 0ull;
+         ULong64_t rejected = 0ull;
+         RDFInternal::RProfileScope scope(fProfiler, slot, fProfileId);
+         for (std::size_t i = 0u; i < n; ++i) {
+            if (!prevMask[i])
+               continue;
+            const bool passed = CheckFilterHelper(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+            mask[i] = passed;
+            passed ? ++accepted : ++rejected;
+         }
+         scope.SetNEntries(accepted + rejected);
+         fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += accepted;
+         fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += rejected;
+      }
+      return mask;
+   }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
@@ -121,6 +149,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBlockMasks[slot].Invalidate();
    }
 
    // recursive chain of `Report`s
@@ -163,6 +192,9 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final { fValues[slot].fill(nullptr); }
 
+   const RNodeBase *GetPrevNode() const final { return &fPrevNode; }
+   const void *GetExpressionId() const final { return RDFInternal::GetFunctionId(fFilter); }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap) final
    {
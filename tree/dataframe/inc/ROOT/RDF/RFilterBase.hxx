@@ -12,6 +12,7 @@
 #define ROOT_RFILTERBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "ROOT/RVec.hxx"
@@ -41,6 +42,7 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   std::vector<RDFInternal::RMaskedEntryRange> fBlockMasks; ///< Per-slot selection of the current block, if any
    const std::string fName;
    const ROOT::RDF::ColumnNames_t fColumnNames;
    RDFInternal::RColumnRegister fColRegister;
@@ -48,6 +50,11 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   /// A filter that computes the same selection, which this one forwards to during the event loop (null if none).
+   RFilterBase *fEquivalentFilter = nullptr;
+   /// The profiler of the current event loop (null if not profiling) and the id of this node in it.
+   RDFInternal::RLoopProfiler *fProfiler = nullptr;
+   unsigned int fProfileId = 0u;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -72,6 +79,24 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+
+   const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
+   const RDFInternal::RColumnRegister &GetColRegister() const { return fColRegister; }
+   const std::string &GetVariationName() const { return fVariation; }
+   /// The filter that is evaluated: this one, or the one it wraps for RJittedFilter (null if not jitted yet).
+   virtual RFilterBase *GetConcreteFilter() { return this; }
+   /// The node upstream of this filter, or null if unknown.
+   virtual const RNodeBase *GetPrevNode() const { return nullptr; }
+   /// An identifier of the filter expression, see RDefineBase::GetExpressionId.
+   virtual const void *GetExpressionId() const { return nullptr; }
+   /// Forward the evaluation to an equivalent filter (or stop forwarding with nullptr). See RLoopManager::OptimizeGraph.
+   void SetEquivalentFilter(RFilterBase *filter) { fEquivalentFilter = filter; }
+   /// Time the evaluation of this filter in the next event loop (or stop timing it with nullptr).
+   void SetProfiler(RDFInternal::RLoopProfiler *profiler, unsigned int id)
+   {
+      fProfiler = profiler;
+      fProfileId = id;
+   }
 };
 
 } // ns RDF
@@ -0,0 +1,166 @@
+/**
+ \file ROOT/RDF/RHistFillHelper.hxx
+ \ingroup dataframe
+*/
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RHISTFILLHELPER
+#define ROOT_RDF_RHISTFILLHELPER
+
+#include "ROOT/RDF/RActionImpl.hxx"
+#include "ROOT/RDF/Utils.hxx" // IsDataContainer
+#include "ROOT/RHistConcurrentFill.hxx"
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RHistFillHelper
+\ingroup dataframe
+\brief Action helper filling a ROOT 7 histogram (RHist) in the RDataFrame event loop, booked with RInterface::Book().
+
+All the processing slots fill the same histogram, each through its own RHistConcurrentFiller: the slots buffer SIZE
+values and fill them in one go under the lock of the RHistConcurrentFillManager. In contrast to Fill() with TH1s,
+there is no copy of the histogram per slot and no merge at the end of the event loop.
+
+~~~{.cpp}
+using ROOT::Experimental::RH2D;
+auto hist = std::make_shared<RH2D>(ROOT::Experimental::RAxisConfig{100, 0., 1.},
+                                   ROOT::Experimental::RAxisConfig{{0., 1., 2., 3., 10.}});
+ROOT::RDF::Experimental::RHistFillHelper<RH2D> helper(hist, df.GetNSlots());
+auto result = df.Book<double, double, float>(std::move(helper), {"x", "y", "weight"});
+~~~
+
+The columns are the GetNDim() coordinates, optionally followed by the weight. Collection columns (e.g. RVecs) are
+filled element by element and must all have the same size in each entry; the values of scalar columns are used for
+all the elements, e.g. for an event weight.
+*/
+template <class HIST, int SIZE = 1024>
+class R__CLING_PTRCHECK(off) RHistFillHelper : public ROOT::Detail::RDF::RActionImpl<RHistFillHelper<HIST, SIZE>> {
+   using Manager_t = ROOT::Experimental::RHistConcurrentFillManager<HIST, SIZE>;
+   using Filler_t = ROOT::Experimental::RHistConcurrentFiller<HIST, SIZE>;
+   using CoordArray_t = typename HIST::CoordArray_t;
+   using Weight_t = typename HIST::Weight_t;
+   static constexpr int kNDim = HIST::GetNDim();
+   static constexpr std::size_t kNoCollection = std::size_t(-1);
+
+   std::shared_ptr<HIST> fResult;
+   std::unique_ptr<Manager_t> fManager;             // the fillers refer to it, hence it is held by pointer
+   std::vector<std::unique_ptr<Filler_t>> fFillers; // one per slot
+   unsigned int fNSlots;
+
+   template <typename T, std::enable_if_t<ROOT::Internal::RDF::IsDataContainer<T>::value, int> = 0>
+   static std::size_t UpdateSize(std::size_t size, const T &col)
+   {
+      if (size != kNoCollection && size != col.size())
+         throw std::runtime_error("Cannot fill a RHist with collections of different sizes.");
+      return col.size();
+   }
+
+   template <typename T, std::enable_if_t<!ROOT::Internal::RDF::IsDataContainer<T>::value, int> = 0>
+   static std::size_t UpdateSize(std::size_t size, const T &)
+   {
+      return size;
+   }
+
+   template <typename T, std::enable_if_t<ROOT::Internal::RDF::IsDataContainer<T>::value, int> = 0>
+   static double GetValue(const T &col, std::size_t i)
+   {
+      return col[i];
+   }
+
+   template <typename T, std::enable_if_t<!ROOT::Internal::RDF::IsDataContainer<T>::value, int> = 0>
+   static double GetValue(const T &col, std::size_t)
+   {
+      return col;
+   }
+
+   template <std::size_t... Is, typename Values>
+   static void FillValues(Filler_t &filler, std::index_sequence<Is...>, const Values &values, std::false_type)
+   {
+      filler.Fill(CoordArray_t(std::get<Is>(values)...));
+   }
+
+   template <std::size_t... Is, typename Values>
+   static void FillValues(Filler_t &filler, std::index_sequence<Is...>, const Values &values, std::true_type)
+   {
+      filler.Fill(CoordArray_t(std::get<Is>(values)...), static_cast<Weight_t>(std::get<kNDim>(values)));
+   }
+
+public:
+   using Result_t = HIST;
+
+   RHistFillHelper(const std::shared_ptr<HIST> &h, unsigned int nSlots) : fResult(h), fNSlots(nSlots) {}
+   RHistFillHelper(RHistFillHelper &&) = default;
+   RHistFillHelper(const RHistFillHelper &) = delete;
+
+   void Initialize()
+   {
+      fFillers.clear();
+      fManager.reset(new Manager_t(*fResult));
+      for (unsigned int i = 0; i < fNSlots; ++i)
+         fFillers.emplace_back(new Filler_t(*fManager));
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   template <typename... Cols>
+   void Exec(unsigned int slot, const Cols &...cols)
+   {
+      static_assert(sizeof...(Cols) == kNDim || sizeof...(Cols) == kNDim + 1,
+                    "The number of columns must be the number of dimensions of the histogram, plus one for a weight.");
+      std::size_t size = kNoCollection;
+      int expander[] = {(size = UpdateSize(size, cols), 0)...};
+      (void)expander;
+      if (size == kNoCollection)
+         size = 1;
+
+      Filler_t &filler = *fFillers[slot];
+      for (std::size_t i = 0; i < size; ++i)
+         FillValues(filler, std::make_index_sequence<kNDim>{}, std::make_tuple(GetValue(cols, i)...),
+                    std::integral_constant<bool, sizeof...(Cols) == kNDim + 1>{});
+   }
+
+   void Finalize()
+   {
+      for (auto &filler : fFillers)
+         filler->Flush();
+      fFillers.clear();
+      fManager.reset();
+   }
+
+   std::shared_ptr<HIST> GetResultPtr() const { return fResult; }
+
+   std::string GetActionName() { return "FillRHist"; }
+
+   RHistFillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      return RHistFillHelper(result, fNSlots);
+   }
+};
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif
@@ -11,6 +11,7 @@
 #ifndef ROOT_RDF_TINTERFACE
 #define ROOT_RDF_TINTERFACE
 
+#include "ROOT/RCacheOptions.hxx"
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/ActionHelpers.hxx"
 #include "ROOT/RDF/HistoModels.hxx"
@@ -23,6 +24,7 @@
 #include "ROOT/RDF/RVariation.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RPersistentCache.hxx"
 #include "ROOT/RDF/RRange.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RDF/RDFDescription.hxx"
@@ -915,6 +917,16 @@ public:
    /// not meant to be written out with that name (which is not a valid C++ variable name). Instead, go through an
    /// Alias(): `df.Alias("nbar", "#bar").Snapshot(..., {"nbar"})`.
    ///
+   /// ### Writing an RNTuple
+   ///
+   /// With `RSnapshotOptions::fOutputFormat` set to `ESnapshotOutputFormat::kRNTuple` (and ROOT built with ROOT 7
+   /// support), the output is an RNTuple in a new file. Every processing slot fills its own fill context of an
+   /// RNTupleParallelWriter, so that serialization and compression run in the threads of the event loop and only
+   /// complete clusters are written under a lock. As for TTree output, in multi-thread runs the order of the output
+   /// clusters is unspecified, unless `RSnapshotOptions::fPreserveEntryOrder` is set: then the output of each task is
+   /// kept in memory until the end of the event loop and written in the order of the input TTree/TChain.
+   /// Sub-directories and file modes other than "RECREATE" are not supported for RNTuple output.
+   ///
    /// ### Example invocations:
    ///
    /// ~~~{.cpp}
@@ -1180,6 +1192,53 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in memory or, persistently, on disk.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options RCacheOptions struct with extra options to steer the creation of the cached dataset.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// With RCacheOptions::fPersistent, the cached columns are written to an RNTuple in a cache directory (see
+   /// RCacheOptions::fDirectory and `RDataFrame.Cache.Dir` in .rootrc) instead of being kept in memory. Only the
+   /// entries that pass the upstream Filters and Ranges are written. The file of the RNTuple is named after a hash of
+   /// the input dataset (names, sizes and modification times of the files of a TTree or TChain), the entry range, the
+   /// Filters, Ranges and Defines that the cached columns depend on and the cached columns themselves: the next
+   /// Cache() call with the same columns of the same computation graph, also in another process, reads that RNTuple
+   /// instead of running an event loop. Jitted expressions are compared by their code, compiled callables by their
+   /// type only: change RCacheOptions::fTag to invalidate the cache when their code or the functions called by
+   /// jitted expressions change. Old entries are never removed from the cache directory.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDF::RCacheOptions opts;
+   /// opts.fPersistent = true;
+   /// auto selected = df.Filter("expensive_selection(x)").Define("y", "f(x)").Cache({"x", "y"}, opts);
+   /// ~~~
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      if (!options.fPersistent || columnList.empty())
+         return Cache(columnList);
+
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "Cache");
+      const auto validColumnNames =
+         GetValidatedColumnNames(columnListWithoutSizeColumns.size(), columnListWithoutSizeColumns);
+      const auto colTypes = GetValidatedArgTypes(validColumnNames, fColRegister, fLoopManager->GetTree(), fDataSource,
+                                                 "Cache", /*vector2rvec=*/false);
+      RDFInternal::RPersistentCache cache(*fLoopManager, *fProxiedPtr, fColRegister, validColumnNames, colTypes,
+                                          options);
+      if (!cache.Exists()) {
+         RSnapshotOptions snapshotOptions;
+         snapshotOptions.fOutputFormat = ESnapshotOutputFormat::kRNTuple;
+         snapshotOptions.fPreserveEntryOrder = true;
+         // the dataframe returned by Snapshot reads the temporary file, the cached one is opened below
+         Snapshot(cache.GetNTupleName(), cache.BeginWrite(), validColumnNames, snapshotOptions).GetValue();
+         cache.Commit();
+      }
+      RInterface<RLoopManager> resRDF(std::make_shared<ROOT::Detail::RDF::RLoopManager>(0));
+      cache.Open(resRDF);
+      return resRDF;
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end).
@@ -2791,7 +2850,12 @@ private:
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      // the RNTuple output is only readable after the event loop: until then, the returned data frame is empty
+      const bool isRNTuple = options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+      auto newRDF = isRNTuple ? std::make_shared<ROOT::RDataFrame>(0ull)
+                              : std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      if (isRNTuple)
+         snapHelperArgs->fOutputDataFrame = newRDF;
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, ColumnTypes...>(validCols, newRDF, snapHelperArgs,
                                                                                     fProxiedPtr);
@@ -209,6 +209,10 @@ public:
    ColumnNames_t GetDefinedColumnNames();
    unsigned int GetNSlots() const;
    unsigned int GetNRuns() const;
+   void SetBlockSize(unsigned int blockSize);
+   void EnableProfiling(bool enable = true);
+   void EnableRVecArena(bool enable = true);
+   const ROOT::RDF::Experimental::RProfileReport &GetProfileReport() const;
 };
 } // namespace RDF
 } // namespace ROOT
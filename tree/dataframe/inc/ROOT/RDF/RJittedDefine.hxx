@@ -39,11 +39,13 @@ class RJittedDefine : public RDefineBase {
    /// The expectation is that this always compares equal to fConcreteDefine->GetTypeId() (which however is only
    /// available after jitting). It can be null if TypeName2TypeID failed to figure out this type.
    const std::type_info *fTypeId = nullptr;
+   const std::string fExpression; ///< The code of the expression, as passed to Define or DefinePerSample
 
 public:
    RJittedDefine(std::string_view name, std::string_view type, RLoopManager &lm,
-                 const RDFInternal::RColumnRegister &colRegister, const ColumnNames_t &columns)
-      : RDefineBase(name, type, colRegister, lm, columns)
+                 const RDFInternal::RColumnRegister &colRegister, const ColumnNames_t &columns,
+                 std::string_view expression)
+      : RDefineBase(name, type, colRegister, lm, columns), fExpression(expression)
    {
       // try recovering the type_info of this type, no problem if we fail (as long as no one calls GetTypeId)
       try {
@@ -54,11 +56,14 @@ public:
    ~RJittedDefine();
 
    void SetDefine(std::unique_ptr<RDefineBase> c) { fConcreteDefine = std::move(c); }
+   RDefineBase *GetConcreteDefine() final { return fConcreteDefine.get(); }
+   const std::string &GetExpression() const { return fExpression; }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
+   void *UpdateAndGetValuePtr(unsigned int slot, Long64_t entry) final;
    void Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id) final;
    void FinalizeSlot(unsigned int slot) final;
    void MakeVariations(const std::vector<std::string> &variations) final;
@@ -38,15 +38,20 @@ namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
 /// at a later time, from jitted code.
 class RJittedFilter final : public RFilterBase {
    std::unique_ptr<RFilterBase> fConcreteFilter = nullptr;
+   const std::string fExpression; ///< The code of the filter expression, as passed to Filter
+   const RNodeBase *fPrevNode;
 
 public:
-   RJittedFilter(RLoopManager *lm, std::string_view name, const std::vector<std::string> &variations);
+   RJittedFilter(RLoopManager *lm, std::string_view name, std::string_view expression, const RNodeBase &prevNode,
+                 const RDFInternal::RColumnRegister &colRegister, const ColumnNames_t &columns,
+                 const std::vector<std::string> &variations);
    ~RJittedFilter();
 
    void SetFilter(std::unique_ptr<RFilterBase> f);
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   const RDFInternal::RMaskedEntryRange &CheckFiltersBlock(unsigned int slot, Long64_t firstEntry, std::size_t n) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -58,6 +63,9 @@ public:
    void InitNode() final;
    void AddFilterName(std::vector<std::string> &filters) final;
    void FinalizeSlot(unsigned int slot) final;
+   RFilterBase *GetConcreteFilter() final { return fConcreteFilter.get(); }
+   const RNodeBase *GetPrevNode() const final { return fPrevNode; }
+   const std::string &GetExpression() const { return fExpression; }
    std::shared_ptr<RDFGraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap) final;
    std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final;
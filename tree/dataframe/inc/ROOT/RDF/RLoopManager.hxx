@@ -12,18 +12,25 @@
 #define ROOT_RLOOPMANAGER
 
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
+#include "ROOT/RDF/RBlockColumnReader.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RLoopProfiler.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
+#include "ROOT/RVec.hxx" // RVecArena
 
+#include <cstddef> // std::size_t
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility> // std::pair
 #include <vector>
 
 // forward declarations
@@ -118,6 +125,9 @@ class RLoopManager : public RNodeBase {
    std::vector<RRangeBase *> fBookedRanges;
    std::vector<RDefineBase *> fBookedDefines;
    std::vector<RDFInternal::RVariationBase *> fBookedVariations;
+   /// Subsets of fBookedFilters and fBookedDefines that are evaluated in the current event loop. See OptimizeGraph().
+   std::vector<RFilterBase *> fFiltersToInit;
+   std::vector<RDefineBase *> fDefinesToInit;
 
    /// Shared pointer to the input TTree. It does not delete the pointee if the TTree/TChain was passed directly as an
    /// argument to RDataFrame's ctor (in which case we let users retain ownership).
@@ -144,11 +154,54 @@ class RLoopManager : public RNodeBase {
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
 
+   /// Maximum number of entries per block in block execution mode, 0 or 1 if disabled. See SetBlockSize().
+   unsigned int fBlockSize{0};
+   /// Whether the current event loop runs in block execution mode. Set by InitNodes().
+   bool fUseBlockExecution{false};
+
+   /// Whether the RVecs returned by Define expressions allocate their buffers from fRVecArenas. See SetRVecArena().
+   bool fUseRVecArena{false};
+   /// Per-slot arenas of the RVecs returned by Define expressions, reset after each entry (or block) is processed.
+   /// Empty if the arenas are not in use in the current event loop.
+   std::vector<std::unique_ptr<ROOT::Internal::VecOps::RVecArena>> fRVecArenas;
+
+   /// Entries of the block that is being accumulated in a processing slot.
+   struct RBlockState {
+      Long64_t fFirstEntry{-1};
+      std::size_t fSize{0};
+      std::size_t fCapacity{0};
+      bool fNewSample{false}; ///< Whether the sample callbacks must run before the block
+      std::vector<RDFInternal::RBlockColumnReaderBase *> fReaders; ///< Non-owning, see fBlockColumnReaders
+   };
+   std::vector<RBlockState> fBlockStates;
+   /// The (all-true) selection of the current block of each slot, returned by CheckFiltersBlock.
+   std::vector<RDFInternal::RMaskedEntryRange> fBlockMasks;
+   /// Block readers wrapping the dataset column readers (one map per slot), only used in block execution mode.
+   std::vector<std::unordered_map<std::string, std::unique_ptr<RDFInternal::RBlockColumnReaderBase>>>
+      fBlockColumnReaders;
+
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
    ROOT::Internal::TreeUtils::RNoCleanupNotifier fNoCleanupNotifier;
 
+   /// Processing time of a task of a multi-thread event loop.
+   struct RTaskTime {
+      unsigned int fSlot;
+      ULong64_t fNEntries;
+      double fSeconds;
+   };
+   /// The task times of the current event loop, summarized at the end of the event loop. See ReportTaskTimes().
+   std::vector<RTaskTime> fTaskTimes;
+   std::mutex fTaskTimesMutex;
+
+   /// Whether the following event loops are profiled. See SetProfiling().
+   bool fProfilingEnabled{false};
+   /// The profiler of the current event loop, null if it is not profiled.
+   std::unique_ptr<RDFInternal::RLoopProfiler> fProfiler;
+   /// The profile of the last profiled event loop.
+   ROOT::RDF::Experimental::RProfileReport fProfileReport;
+
    void RunEmptySourceMT();
    void RunEmptySource();
    void RunTreeProcessorMT();
@@ -156,11 +209,19 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void AddTaskTime(unsigned int slot, ULong64_t nEntries, double seconds);
+   void ReportTaskTimes();
+   void SetupProfiler();
+   void ReportProfile(const std::string &traceFile);
+   void RunAndCheckFiltersBlock(unsigned int slot, Long64_t firstEntry, std::size_t n);
+   void PushEntryToBlock(unsigned int slot, Long64_t entry);
+   void FlushBlock(unsigned int slot);
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
+   void OptimizeGraph();
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
    void UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range);
    void UpdateSampleInfo(unsigned int slot, TTreeReader &r);
@@ -181,6 +242,8 @@ public:
    TTree *GetTree() const;
    ::TDirectory *GetDirectory() const;
    ULong64_t GetNEmptyEntries() const { return fNEmptyEntries; }
+   /// The range of entries of the input dataset that is processed, [begin, end).
+   std::pair<Long64_t, Long64_t> GetEntryRange() const { return {fBeginEntry, fEndEntry}; }
    RDataSource *GetDataSource() const { return fDataSource.get(); }
    void Register(RDFInternal::RActionBase *actionPtr);
    void Deregister(RDFInternal::RActionBase *actionPtr);
@@ -193,6 +256,7 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   const RDFInternal::RMaskedEntryRange &CheckFiltersBlock(unsigned int slot, Long64_t firstEntry, std::size_t n) final;
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -206,9 +270,30 @@ public:
    bool HasDataSourceColumnReaders(const std::string &col, const std::type_info &ti) const;
    void AddDataSourceColumnReaders(const std::string &col, std::vector<std::unique_ptr<RColumnReaderBase>> &&readers,
                                    const std::type_info &ti);
-   RColumnReaderBase *AddTreeColumnReader(unsigned int slot, const std::string &col,
+   RColumnReaderBase *AddTreeColumnReader(unsigned int slot, TTreeReader &r, const std::string &col,
                                           std::unique_ptr<RColumnReaderBase> &&reader, const std::type_info &ti);
    RColumnReaderBase *GetDatasetColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const;
+   RColumnReaderBase *AddBlockColumnReader(unsigned int slot, const std::string &col,
+                                           std::unique_ptr<RDFInternal::RBlockColumnReaderBase> &&reader,
+                                           const std::type_info &ti);
+   RColumnReaderBase *GetBlockColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const;
+
+   void SetBlockSize(unsigned int blockSize);
+   unsigned int GetBlockSize() const { return fBlockSize; }
+   /// Whether the event loop that is being run processes entries in blocks.
+   bool UsesBlockExecution() const { return fUseBlockExecution; }
+   void DisableBlockExecution(unsigned int slot);
+
+   void SetRVecArena(bool enable) { fUseRVecArena = enable; }
+   /// The arena for the RVecs returned by the Define expressions evaluated in this slot, nullptr if not in use.
+   ROOT::Internal::VecOps::RVecArena *GetRVecArena(unsigned int slot) const
+   {
+      return fRVecArenas.empty() ? nullptr : fRVecArenas[slot].get();
+   }
+
+   void SetProfiling(bool enable) { fProfilingEnabled = enable; }
+   /// The profile of the last event loop that ran with profiling enabled, empty if none did.
+   const ROOT::RDF::Experimental::RProfileReport &GetProfileReport() const { return fProfileReport; }
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) final {}
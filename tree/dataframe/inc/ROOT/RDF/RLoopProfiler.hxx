@@ -0,0 +1,185 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RLOOPPROFILER
+#define ROOT_RDF_RLOOPPROFILER
+
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RColumnReaderBase;
+} // namespace RDF
+} // namespace Detail
+
+namespace RDF {
+namespace Experimental {
+class RProfileReport;
+} // namespace Experimental
+} // namespace RDF
+
+namespace Internal {
+namespace RDF {
+
+/// Collects the timing information of one event loop of a RLoopManager that runs with profiling enabled.
+///
+/// Nodes of the computation graph are registered before the event loop and time their own work with a RProfileScope.
+/// Scopes nest (e.g. a Filter reads a Define, which reads a column), so every slot keeps a stack of the time spent in
+/// the nested scopes: a node is only charged its self time, excluding the nodes it called.
+class RLoopProfiler {
+public:
+   using Clock_t = std::chrono::steady_clock;
+   enum class ENodeKind { kFilter, kDefine, kAction, kColumn };
+
+private:
+   struct RNodeInfo {
+      std::string fName;
+      ENodeKind fKind;
+   };
+
+   /// The counters of a processing slot, indexed by node. Only ever accessed by the thread that owns the slot.
+   struct RSlotData {
+      std::vector<Clock_t::rep> fSelfTimes;
+      std::vector<ULong64_t> fEntries;
+      std::vector<ULong64_t> fBytes;
+      std::vector<Clock_t::rep> fChildTimes; ///< Time spent in the nested scopes, one element per open scope
+      Clock_t::time_point fTaskStart;
+      Clock_t::time_point fTaskInitEnd;
+      double fTaskCpuStart = 0.;
+   };
+
+   struct RTask {
+      unsigned int fSlot;
+      Clock_t::time_point fStart;
+      Clock_t::duration fRealTime;
+      Clock_t::duration fInitTime;
+      double fCpuTime;
+   };
+
+   struct RPhase {
+      std::string fName;
+      Clock_t::time_point fStart;
+      Clock_t::duration fRealTime;
+      double fCpuTime;
+   };
+
+   const Clock_t::time_point fStart;
+   std::vector<RNodeInfo> fNodes;
+   std::mutex fNodesMutex; ///< Column nodes are added while slots are being initialized concurrently
+   std::vector<RSlotData> fSlots;
+   std::vector<RTask> fTasks;
+   std::mutex fTasksMutex;
+   std::vector<RPhase> fPhases;
+   double fPhaseCpuStart = 0.;
+
+   void ResizeSlot(RSlotData &slot) const;
+
+public:
+   explicit RLoopProfiler(unsigned int nSlots);
+   RLoopProfiler(const RLoopProfiler &) = delete;
+   RLoopProfiler &operator=(const RLoopProfiler &) = delete;
+
+   /// Register a node of the computation graph, to be called before the event loop. Returns the id of the node.
+   unsigned int AddNode(const std::string &name, ENodeKind kind);
+   /// Wrap a reader of a TTree column so that its reading time and the bytes of the baskets it loads are recorded.
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+   MakeProfiledReader(unsigned int slot, TTreeReader &r, const std::string &colName,
+                      std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader);
+
+   Clock_t::time_point Enter(unsigned int slot)
+   {
+      fSlots[slot].fChildTimes.push_back(0);
+      return Clock_t::now();
+   }
+
+   void Exit(unsigned int slot, unsigned int node, Clock_t::time_point start, ULong64_t nEntries)
+   {
+      const auto elapsed = (Clock_t::now() - start).count();
+      auto &s = fSlots[slot];
+      const auto childTime = s.fChildTimes.back();
+      s.fChildTimes.pop_back();
+      s.fSelfTimes[node] += elapsed - childTime;
+      s.fEntries[node] += nEntries;
+      if (!s.fChildTimes.empty())
+         s.fChildTimes.back() += elapsed;
+   }
+
+   void AddBytes(unsigned int slot, unsigned int node, ULong64_t nBytes) { fSlots[slot].fBytes[node] += nBytes; }
+
+   void BeginTask(unsigned int slot);
+   /// Mark the end of the initialization of the nodes for the current task of this slot.
+   void EndTaskInit(unsigned int slot);
+   void EndTask(unsigned int slot);
+
+   /// Phases of the event loop (jitting, initialization...) run one after the other in the main thread.
+   void BeginPhase(const std::string &name);
+   void EndPhase();
+
+   ROOT::RDF::Experimental::RProfileReport MakeReport() const;
+};
+
+/// Times the work of a node of the computation graph in a processing slot, if profiling is enabled (non-null profiler).
+class RProfileScope {
+   RLoopProfiler *const fProfiler;
+   const unsigned int fSlot;
+   const unsigned int fNode;
+   ULong64_t fNEntries = 1ull;
+   RLoopProfiler::Clock_t::time_point fStart;
+
+public:
+   RProfileScope(RLoopProfiler *profiler, unsigned int slot, unsigned int node)
+      : fProfiler(profiler), fSlot(slot), fNode(node)
+   {
+      if (fProfiler)
+         fStart = fProfiler->Enter(fSlot);
+   }
+   RProfileScope(const RProfileScope &) = delete;
+   RProfileScope &operator=(const RProfileScope &) = delete;
+   ~RProfileScope()
+   {
+      if (fProfiler)
+         fProfiler->Exit(fSlot, fNode, fStart, fNEntries);
+   }
+
+   /// Set the number of entries processed in this scope (one by default).
+   void SetNEntries(ULong64_t n) { fNEntries = n; }
+};
+
+/// Times a phase of the event loop, if profiling is enabled (non-null profiler).
+class RProfilePhase {
+   RLoopProfiler *const fProfiler;
+
+public:
+   RProfilePhase(RLoopProfiler *profiler, const std::string &name) : fProfiler(profiler)
+   {
+      if (fProfiler)
+         fProfiler->BeginPhase(name);
+   }
+   RProfilePhase(const RProfilePhase &) = delete;
+   RProfilePhase &operator=(const RProfilePhase &) = delete;
+   ~RProfilePhase()
+   {
+      if (fProfiler)
+         fProfiler->EndPhase();
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,48 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RMASKEDENTRYRANGE
+#define ROOT_RDF_RMASKEDENTRYRANGE
+
+#include <Rtypes.h> // Long64_t
+
+#include <cstddef> // std::size_t
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// The selection of a block of consecutive entries, as produced by the nodes of the computation graph in block
+/// execution mode: element i tells whether entry FirstEntry() + i passed all the filters up to that node.
+class RMaskedEntryRange {
+   std::vector<char> fMask; // not std::vector<bool>, so that elements are cheap to access
+   Long64_t fFirstEntry{-1};
+
+public:
+   Long64_t FirstEntry() const { return fFirstEntry; }
+   std::size_t Size() const { return fMask.size(); }
+   /// Return true if this object holds the selection for the block of n entries starting at firstEntry.
+   bool Holds(Long64_t firstEntry, std::size_t n) const { return fFirstEntry == firstEntry && fMask.size() == n; }
+   /// Start the selection of a new block, setting all elements to value.
+   void Reset(Long64_t firstEntry, std::size_t n, bool value)
+   {
+      fFirstEntry = firstEntry;
+      fMask.assign(n, value);
+   }
+   void Invalidate() { fFirstEntry = -1; }
+
+   char &operator[](std::size_t i) { return fMask[i]; }
+   bool operator[](std::size_t i) const { return fMask[i]; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RMASKEDENTRYRANGE
@@ -49,6 +49,11 @@ void MergeValues(RMergeableValue<T> &OutputMergeable, const RMergeableValue<Ts>
 template <typename T, typename... Ts>
 void MergeValues(RMergeableVariations<T> &OutputMergeable, const RMergeableVariations<Ts> &... InputMergeables);
 
+class RMergeableValueBase;
+
+void MergeValueLists(const std::vector<RMergeableValueBase *> &OutputMergeables,
+                     const std::vector<const RMergeableValueBase *> &InputMergeables);
+
 /**
 \class ROOT::Detail::RDF::RMergeableValueBase
 \brief Base class of RMergeableValue.
@@ -59,6 +64,21 @@ object along the call chain. This class is never used in the public API and has
 no meaning for the final user.
 */
 class RMergeableValueBase {
+   friend void MergeValueLists(const std::vector<RMergeableValueBase *> &OutputMergeables,
+                               const std::vector<const RMergeableValueBase *> &InputMergeables);
+
+   /////////////////////////////////////////////////////////////////////////////
+   /// \brief Aggregate the information contained in another mergeable of the
+   ///        same type into this, without knowing the type of the result.
+   /// \throws std::invalid_argument If the other object is of a different type.
+   ///
+   /// Reimplemented by RMergeableValue and RMergeableVariations, which forward
+   /// to their typed `Merge` method.
+   virtual void MergeAny(const RMergeableValueBase &)
+   {
+      throw std::invalid_argument("This mergeable value cannot be merged without knowing its type.");
+   }
+
 public:
    virtual ~RMergeableValueBase() = default;
    /**
@@ -159,6 +179,14 @@ class RMergeableValue : public RMergeableValueBase {
    /// (namespaceROOT_1_1Detail_1_1RDF.html#af16fefbe2d120983123ddf8a1e137277).
    virtual void Merge(const RMergeableValue<T> &) = 0;
 
+   void MergeAny(const RMergeableValueBase &other) final
+   {
+      const auto *othercast = dynamic_cast<const RMergeableValue<T> *>(&other);
+      if (!othercast)
+         throw std::invalid_argument("Results from different actions cannot be merged together.");
+      Merge(*othercast);
+   }
+
 protected:
    T fValue;
 
@@ -649,6 +677,14 @@ class RMergeableVariations final : public RMergeableVariationsBase {
       }
    }
 
+   void MergeAny(const RMergeableValueBase &other) final
+   {
+      const auto *othercast = dynamic_cast<const RMergeableVariations<T> *>(&other);
+      if (!othercast)
+         throw std::invalid_argument("Results from different actions cannot be merged together.");
+      Merge(*othercast);
+   }
+
 public:
    /**
       Default constructor. Needed to allow serialization of ROOT objects. See
@@ -0,0 +1,70 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNTUPLESNAPSHOTWRITER
+#define ROOT_RDF_RNTUPLESNAPSHOTWRITER
+
+#include "ROOT/RSnapshotOptions.hxx"
+#include <ROOT/RStringView.hxx>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class TTree;
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+}
+} // namespace Detail
+
+namespace RDF {
+template <typename T, typename V>
+class RInterface;
+class RSampleInfo;
+} // namespace RDF
+
+namespace Internal {
+namespace RDF {
+
+/// Type-erased writer of the RNTuple output of a Snapshot, used by SnapshotHelperRNTuple.
+/// Every processing slot fills its own RNTupleFillContext of a RNTupleParallelWriter, so that serialization and
+/// compression run in the threads of the event loop and only complete clusters are written under a lock.
+/// The implementation lives in the ROOTDataFrame library and is only available if ROOT is built with ROOT 7 support,
+/// otherwise the constructor throws.
+class RNTupleSnapshotWriter {
+   struct RImpl;
+   std::unique_ptr<RImpl> fImpl;
+
+public:
+   RNTupleSnapshotWriter(unsigned int nSlots, std::string_view fileName, std::string_view dirName,
+                         std::string_view ntupleName, const std::vector<std::string> &fieldNames,
+                         const std::vector<std::string> &typeNames, const ROOT::RDF::RSnapshotOptions &options);
+   RNTupleSnapshotWriter(const RNTupleSnapshotWriter &) = delete;
+   RNTupleSnapshotWriter &operator=(const RNTupleSnapshotWriter &) = delete;
+   ~RNTupleSnapshotWriter();
+
+   /// Create the output file and the parallel writer. The input tree, if any, is used to order the output entries.
+   void Initialize(TTree *inputTree);
+   void InitTask(unsigned int slot);
+   /// Called for the first and every following sample of a task, see RSampleInfo.
+   void UpdateSampleInfo(unsigned int slot, const ROOT::RDF::RSampleInfo &info);
+   /// Fill one entry: `values` holds the addresses of the values of all fields, in order.
+   void Fill(unsigned int slot, void *const *values);
+   void FinalizeTask(unsigned int slot);
+   /// Write out the remaining clusters and the RNTuple footer, and make `output` read the written RNTuple.
+   void Finalize(ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void> &output);
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
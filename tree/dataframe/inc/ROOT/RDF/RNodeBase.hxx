@@ -12,8 +12,10 @@
 #define ROOT_RDFNODEBASE
 
 #include "RtypesCore.h"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "TError.h" // R__ASSERT
 
+#include <cstddef> // std::size_t
 #include <memory>
 #include <string>
 #include <vector>
@@ -54,6 +56,10 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Block execution mode counterpart of CheckFilters: return the selection of the n consecutive entries starting at
+   /// firstEntry. The result is cached, so that all children of this node share a single evaluation per block.
+   virtual const ROOT::Internal::RDF::RMaskedEntryRange &
+   CheckFiltersBlock(unsigned int slot, Long64_t firstEntry, std::size_t n) = 0;
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
@@ -71,6 +77,9 @@ public:
 
    virtual RLoopManager *GetLoopManagerUnchecked() { return fLoopManager; }
 
+   /// Number of active nodes hanging from this one, as counted before the event loop. See RLoopManager::EvalChildrenCounts.
+   unsigned int GetNChildren() const { return fNChildren; }
+
    const std::vector<std::string> &GetVariations() const { return fVariations; }
 
    /// Return a clone of this node that acts as a Filter working with values in the variationName "universe".
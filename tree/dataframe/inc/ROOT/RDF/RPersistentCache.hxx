@@ -0,0 +1,72 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPERSISTENTCACHE
+#define ROOT_RDF_RPERSISTENTCACHE
+
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+class RNodeBase;
+} // namespace RDF
+} // namespace Detail
+
+namespace RDF {
+struct RCacheOptions;
+template <typename T, typename V>
+class RInterface;
+} // namespace RDF
+
+namespace Internal {
+namespace RDF {
+class RColumnRegister;
+
+/// The dataset of a persistent Cache() call, see RCacheOptions::fPersistent.
+///
+/// It is an RNTuple in the cache directory, in a file named after a hash of the ROOT version, the input dataset (names,
+/// sizes and modification times of the files of a TTree or TChain and of its friends), the entry range, the
+/// Filters, Ranges and Defines that the cached columns depend on (code of jitted expressions, type of compiled
+/// callables), the cached columns with their types and the user tag. The file is written under a temporary name and
+/// renamed when complete, so that concurrent processes never read a partially written cache.
+/// The implementation lives in the ROOTDataFrame library and is only available if ROOT is built with ROOT 7 support,
+/// otherwise the constructor throws.
+class RPersistentCache {
+   std::string fPath;          ///< The file of the cached dataset
+   std::string fTemporaryPath; ///< The file being written, empty if none
+
+public:
+   RPersistentCache(ROOT::Detail::RDF::RLoopManager &lm, const ROOT::Detail::RDF::RNodeBase &node,
+                    const RColumnRegister &colRegister, const std::vector<std::string> &columns,
+                    const std::vector<std::string> &columnTypes, const ROOT::RDF::RCacheOptions &options);
+   RPersistentCache(const RPersistentCache &) = delete;
+   RPersistentCache &operator=(const RPersistentCache &) = delete;
+   /// Remove the temporary file of a write that was not committed.
+   ~RPersistentCache();
+
+   /// The name of the RNTuple of the cached dataset.
+   static std::string GetNTupleName() { return "Cache"; }
+   const std::string &GetPath() const { return fPath; }
+   /// Whether the dataset is cached, i.e. was written by an earlier Cache() call.
+   bool Exists() const;
+   /// Create the cache directory if needed and return the file to write the dataset to, see Commit().
+   std::string BeginWrite();
+   /// Move the written dataset to its place in the cache, where it is found by later Cache() calls.
+   void Commit();
+   /// Make `output` read the cached dataset.
+   void Open(ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void> &output) const;
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,96 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILEREPORT
+#define ROOT_RDF_RPROFILEREPORT
+
+#include "RtypesCore.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RProfileReport
+\ingroup dataframe
+\brief Where the time of an event loop went, as recorded by RInterfaceBase::EnableProfiling().
+
+The report lists the phases of the event loop (jitting, initialization of the nodes, event loop proper and
+finalization of the results), the tasks run by each processing slot and, per node of the computation graph, the time
+spent in it, the number of entries it processed and, for TTree columns, the bytes read. Times are in seconds, start
+times relative to the beginning of the profiled Run.
+
+The time of a node is its self time, i.e. it excludes the time spent in the nodes it reads from: a Filter is charged
+for its expression but not for the Define it reads, a Define that reads a TTree column is not charged for reading and
+decompressing it (which is charged to the column node). Entries are the evaluations of the expression of the node, or of
+the reads of a new entry of the column. Bytes read are the compressed sizes of the baskets loaded for the branch of a
+TTree column; columns of other data sources are not timed separately.
+**/
+class RProfileReport {
+public:
+   struct RPhase {
+      std::string fName;
+      double fStart;
+      double fRealTime;
+      double fCpuTime; ///< Process CPU time, i.e. summed over all threads
+   };
+
+   struct RSlotStats {
+      double fTime = 0.;
+      ULong64_t fEntries = 0ull;
+      ULong64_t fBytes = 0ull;
+   };
+
+   struct RNode {
+      std::string fName;
+      std::string fKind;              ///< "Filter", "Define", "Action" or "Column"
+      std::vector<RSlotStats> fSlots; ///< Per processing slot
+      double GetTime() const;
+      ULong64_t GetEntries() const;
+      ULong64_t GetBytes() const;
+   };
+
+   struct RTask {
+      unsigned int fSlot;
+      double fStart;
+      double fRealTime;
+      double fCpuTime; ///< CPU time of the thread that ran the task
+      double fInitTime; ///< Time spent creating the column readers and initializing the nodes for the task
+   };
+
+private:
+   std::vector<RPhase> fPhases;
+   std::vector<RNode> fNodes;
+   std::vector<RTask> fTasks;
+
+public:
+   RProfileReport() = default;
+   RProfileReport(std::vector<RPhase> phases, std::vector<RNode> nodes, std::vector<RTask> tasks);
+
+   /// Whether the report is empty, i.e. no event loop has run with profiling enabled.
+   bool IsEmpty() const { return fPhases.empty(); }
+   const std::vector<RPhase> &GetPhases() const { return fPhases; }
+   const std::vector<RNode> &GetNodes() const { return fNodes; }
+   const std::vector<RTask> &GetTasks() const { return fTasks; }
+   /// Return the first node with the given name (e.g. name of a Filter or a column), throw if there is none.
+   const RNode &GetNode(const std::string &name) const;
+
+   void Print() const;
+   void WriteJSON(std::ostream &os) const;
+   void WriteChromeTrace(std::ostream &os) const;
+};
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif
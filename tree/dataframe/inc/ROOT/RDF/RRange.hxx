@@ -60,6 +60,8 @@ public:
    // otherwise if fPrevNode is fLoopManager we get a use after delete
    ~RRange() { fLoopManager->Deregister(this); }
 
+   const RNodeBase *GetPrevNode() const final { return &fPrevNode; }
+
    /// Ranges act as filters when it comes to selecting entries that downstream nodes should process
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
@@ -87,6 +89,27 @@ public:
       return fLastResult;
    }
 
+   const ROOT::Internal::RDF::RMaskedEntryRange &
+   CheckFiltersBlock(unsigned int slot, Long64_t firstEntry, std::size_t n) final
+   {
+      if (!fBlockMask.Holds(firstEntry, n)) {
+         const auto &prevMask = fPrevNode.CheckFiltersBlock(slot, firstEntry, n);
+         fBlockMask.Reset(firstEntry, n, false);
+         for (std::size_t i = 0u; i < n && !fHasStopped; ++i) {
+            if (!prevMask[i])
+               continue;
+            fBlockMask[i] = !(fNProcessedEntries < fStart || (fStop > 0 && fNProcessedEntries >= fStop) ||
+                              (fStride != 1 && (fNProcessedEntries - fStart) % fStride != 0));
+            ++fNProcessedEntries;
+            if (fNProcessedEntries == fStop) {
+               fHasStopped = true;
+               fPrevNode.StopProcessing();
+            }
+         }
+      }
+      return fBlockMask;
+   }
+
    // recursive chain of `Report`s
    // RRange simply forwards these calls to the previous node
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { fPrevNode.PartialReport(rep); }
@@ -40,6 +40,7 @@ protected:
    bool fLastResult{true};
    ULong64_t fNProcessedEntries{0};
    bool fHasStopped{false};    ///< True if the end of the range has been reached
+   ROOT::Internal::RDF::RMaskedEntryRange fBlockMask; ///< Selection of the current block, in block execution mode
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
    std::unordered_map<std::string, std::shared_ptr<RRangeBase>> fVariedRanges;
 
@@ -53,6 +54,11 @@ public:
    ~RRangeBase() override;
 
    void InitNode() { ResetCounters(); }
+   unsigned int GetStart() const { return fStart; }
+   unsigned int GetStop() const { return fStop; }
+   unsigned int GetStride() const { return fStride; }
+   /// The node upstream of this range.
+   virtual const RNodeBase *GetPrevNode() const = 0;
 };
 
 } // ns RDF
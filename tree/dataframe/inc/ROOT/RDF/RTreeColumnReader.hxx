@@ -13,6 +13,7 @@
 
 #include "RColumnReaderBase.hxx"
 #include <ROOT/RVec.hxx>
+#include <ROOT/RVecView.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
@@ -140,6 +141,71 @@ public:
    ~RTreeColumnReader() override { fTreeArray.reset(); }
 };
 
+/// RTreeColumnReader specialization for TTree collections read as RVecView<T>, via TTreeReaderArrays.
+///
+/// The view looks directly at the memory of the TTreeReaderArray, also if the elements are not contiguous (e.g. a data
+/// member of the elements of a non-split collection) as long as they lie at a constant distance from each other. The
+/// elements are only copied otherwise, e.g. for objects allocated one by one.
+template <typename T>
+class R__CLING_PTRCHECK(off) RTreeColumnReader<ROOT::VecOps::RVecView<T>> final
+   : public ROOT::Detail::RDF::RColumnReaderBase {
+   using View_t = ROOT::VecOps::RVecView<T>;
+
+   std::unique_ptr<TTreeReaderArray<T>> fTreeArray;
+
+   /// We return a reference to this view to clients, to guarantee a stable address.
+   View_t fView;
+   /// Copy of the elements of the current entry, only used if they do not lie at a constant distance.
+   RVec<T> fCopy;
+   /// Whether the elements were found to be contiguous, in which case the distances are not checked anymore.
+   bool fIsContiguous = false;
+   Long64_t fLastEntry = -1;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      if (entry == fLastEntry)
+         return &fView;
+      fLastEntry = entry;
+
+      auto &readerArray = *fTreeArray;
+      const std::size_t size = readerArray.GetSize();
+      if (size == 0) {
+         fView = View_t();
+         return &fView;
+      }
+      // the address of the first element in the reader array is not necessarily equal to
+      // the address returned by the GetAddress method
+      const auto *first = &readerArray.At(0);
+      if (fIsContiguous) {
+         fView = View_t(first, size);
+         return &fView;
+      }
+
+      auto address = [&readerArray](std::size_t i) { return reinterpret_cast<const char *>(&readerArray.At(i)); };
+      const std::ptrdiff_t stride = size > 1 ? address(1) - address(0) : sizeof(T);
+      bool constantStride = true;
+      for (std::size_t i = 2; i < size && constantStride; ++i)
+         constantStride = address(i) - address(i - 1) == stride;
+      if (constantStride) {
+         fIsContiguous = size > 1 && stride == static_cast<std::ptrdiff_t>(sizeof(T));
+         fView = View_t(first, size, stride);
+      } else {
+         fCopy.assign(readerArray.begin(), readerArray.end());
+         fView = View_t(fCopy);
+      }
+      return &fView;
+   }
+
+public:
+   RTreeColumnReader(TTreeReader &r, const std::string &colName)
+      : fTreeArray(std::make_unique<TTreeReaderArray<T>>(r, colName.c_str()))
+   {
+   }
+
+   /// See the other class template specializations for an explanation.
+   ~RTreeColumnReader() override { fTreeArray.reset(); }
+};
+
 /// RTreeColumnReader specialization for arrays of boolean values read via TTreeReaderArrays.
 ///
 /// TTreeReaderArray<bool> is used whenever the RDF column type is RVec<bool>.
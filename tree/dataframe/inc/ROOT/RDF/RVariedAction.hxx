@@ -46,6 +46,13 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
    /// Owning pointers to upstream nodes for each systematic variation (with the "nominal" at index 0).
    std::vector<std::shared_ptr<PrevNodeType>> fPrevNodes;
 
+   /// For each variation, the index of the first variation with the same upstream node. Variations the filters do
+   /// not depend on share the nominal upstream node, whose filters are then checked only once per entry.
+   std::vector<unsigned int> fPrevNodeIdx;
+
+   /// Whether the upstream node of each variation passed the current entry, per slot.
+   std::vector<std::vector<char>> fPassed;
+
    /// Column readers per slot (outer dimension), per variation and per input column (inner dimension, std::array).
    std::vector<std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>>> fInputValues;
 
@@ -75,11 +82,27 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
       return prevFilters;
    }
 
+   std::vector<unsigned int> MakePrevNodeIdx() const
+   {
+      std::vector<unsigned int> prevNodeIdx(fPrevNodes.size());
+      for (auto varIdx = 0u; varIdx < fPrevNodes.size(); ++varIdx) {
+         prevNodeIdx[varIdx] = varIdx;
+         for (auto otherIdx = 0u; otherIdx < varIdx; ++otherIdx) {
+            if (fPrevNodes[otherIdx] == fPrevNodes[varIdx]) {
+               prevNodeIdx[varIdx] = prevNodeIdx[otherIdx];
+               break;
+            }
+         }
+      }
+      return prevNodeIdx;
+   }
+
 public:
    RVariedAction(std::vector<Helper> &&helpers, const ColumnNames_t &columns, std::shared_ptr<PrevNode> prevNode,
                  const RColumnRegister &colRegister)
       : RActionBase(prevNode->GetLoopManagerUnchecked(), columns, colRegister, prevNode->GetVariations()),
-        fHelpers(std::move(helpers)), fPrevNodes(MakePrevFilters(prevNode)), fInputValues(GetNSlots())
+        fHelpers(std::move(helpers)), fPrevNodes(MakePrevFilters(prevNode)), fPrevNodeIdx(MakePrevNodeIdx()),
+        fPassed(GetNSlots(), std::vector<char>(fPrevNodes.size())), fInputValues(GetNSlots())
    {
       fLoopManager->Register(this);
 
@@ -122,9 +145,16 @@ public:
 
    void Run(unsigned int slot, Long64_t entry) final
    {
+      auto &passed = fPassed[slot];
       for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
+         const auto prevIdx = fPrevNodeIdx[varIdx];
+         // prevIdx <= varIdx, so passed[prevIdx] is already set for this entry if prevIdx != varIdx
+         if (prevIdx == varIdx)
+            passed[varIdx] = fPrevNodes[varIdx]->CheckFilters(slot, entry);
+         if (passed[prevIdx]) {
+            RProfileScope scope(fProfiler, slot, fProfileId);
             CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
+         }
       }
    }
 
@@ -133,6 +163,8 @@ public:
       std::for_each(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) { f->IncrChildrenCount(); });
    }
 
+   std::string GetActionName() final { return "Varied " + fHelpers[0].GetActionName(); }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
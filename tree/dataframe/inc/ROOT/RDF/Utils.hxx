@@ -197,6 +197,14 @@ void InterpreterDeclare(const std::string &code);
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// Run jitted code from the persistent cache of compiled libraries (see `RDataFrame.JitCache.Dir` in system.rootrc).
+/// Return false, without side effects, if the cache is disabled or if it does not hold this code yet.
+bool RunCachedJitCode(const std::string &code);
+
+/// Compile jitted code that was just run through the interpreter into the persistent cache, if enabled, so that
+/// later processes can skip the interpreter. Compilation failures only disable the cache for this code.
+void AddToJitCache(const std::string &code);
+
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
@@ -221,6 +229,24 @@ constexpr std::size_t CacheLineStep() {
    return (kCacheLineSize + sizeof(T) - 1) / sizeof(T);
 }
 
+template <typename F>
+using IsFunctionPointer = std::integral_constant<bool, std::is_pointer<F>::value &&
+                                                          std::is_function<std::remove_pointer_t<F>>::value>;
+
+/// Identifier of a callable that is a pointer to a free function, e.g. one of the functions declared for jitted
+/// expressions. Null for any other callable, since its result might depend on its state.
+template <typename F, std::enable_if_t<IsFunctionPointer<F>::value, int> = 0>
+const void *GetFunctionId(F f)
+{
+   return reinterpret_cast<const void *>(f);
+}
+
+template <typename F, std::enable_if_t<!IsFunctionPointer<F>::value, int> = 0>
+const void *GetFunctionId(const F &)
+{
+   return nullptr;
+}
+
 void CheckReaderTypeMatches(const std::type_info &colType, const std::type_info &requestedType,
                             const std::string &colName);
 
@@ -46,6 +46,9 @@ class RNTupleColumnReader;
 class RNTupleDS final : public ROOT::RDF::RDataSource {
    /// Clones of the first source, one for each slot
    std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fSources;
+   /// Clones of the first source with the cluster cache turned off, one for each slot.  Only created if there are
+   /// late materialized columns, which are connected to these sources.
+   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fLateSources;
 
    /// We prepare a column reader prototype for every column. If a column reader is actually requested
    /// in GetColumnReaders(), we move a clone of the prototype into the hands of RDataFrame.
@@ -54,10 +57,23 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<std::string> fColumnNames;
    std::vector<std::string> fColumnTypes;
    std::vector<size_t> fActiveColumns;
+   /// Names of the columns whose pages are only read on demand, see MaterializeLate()
+   std::vector<std::string> fLateColumns;
 
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
+   /// A value range of a column; clusters whose recorded column statistics are outside the range are skipped
+   struct RClusterValueRange {
+      std::string fColumnName;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RClusterValueRange> fClusterValueRanges;
+
+   /// Returns the entry ranges of the clusters that may contain entries within fClusterValueRanges
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetSelectedClusterRanges();
+
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
    /// of fieldId. For instance, if fieldId refers to an `std::vector<Jet>`, with
@@ -83,6 +99,20 @@ public:
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   /// Promise that only entries whose value of the given column is within [min, max] are of interest, typically
+   /// because of a corresponding Filter(). Clusters whose column statistics (see
+   /// RNTupleWriteOptions::SetEnableColumnStatistics()) show no value in [min, max] are then skipped without being
+   /// read.  Clusters without statistics for the column are always processed.  The column must be a numerical
+   /// field of fundamental type.  Entries in the processed clusters still need to be filtered.
+   void SkipClustersOutsideRange(std::string_view colName, double min, double max);
+
+   /// Read the pages of the given column only when an entry requests the column's value.  Typically used for
+   /// heavy columns, such as large collections, that are only needed by entries passing a Filter() on other, cheap
+   /// columns.  By default, the pages of all the columns used by the computation graph are loaded for every cluster.
+   /// Late materialized columns are instead read page by page, so that their pages without any selected entry are
+   /// never read or decompressed.  Must be called before the data source is passed to RDataFrame.
+   void MaterializeLate(std::string_view colName);
+
    void Initialize() final;
    void Finalize() final;
 
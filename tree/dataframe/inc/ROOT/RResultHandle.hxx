@@ -14,6 +14,7 @@
 #include "ROOT/RResultPtr.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RMergeableValue.hxx"
 #include "ROOT/RDF/Utils.hxx" // TypeID2TypeName
 
 #include <memory>
@@ -22,6 +23,15 @@
 #include <stdexcept> // std::runtime_error
 
 namespace ROOT {
+namespace RDF {
+class RResultHandle;
+}
+namespace Detail {
+namespace RDF {
+std::unique_ptr<RMergeableValueBase> GetMergeableValue(ROOT::RDF::RResultHandle &handle);
+}
+} // namespace Detail
+
 namespace RDF {
 
 class RResultHandle {
@@ -34,6 +44,9 @@ class RResultHandle {
 
    // The ROOT::RDF::RunGraphs helper has to access the loop manager to check whether two RResultHandles belong to the same computation graph
    friend void RunGraphs(std::vector<RResultHandle>);
+   // Type-erased counterpart of GetMergeableValue(RResultPtr<T> &)
+   friend std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase>
+   ROOT::Detail::RDF::GetMergeableValue(RResultHandle &handle);
 
    /// Get the pointer to the encapsulated result.
    /// Ownership is not transferred to the caller.
@@ -129,6 +142,25 @@ public:
 };
 
 } // namespace RDF
+
+namespace Detail {
+namespace RDF {
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Retrieve a mergeable value from an RResultHandle.
+/// \param[in] handle The result handle, its event loop is run if needed.
+/// \returns A type-erased RMergeableValue holding a copy of the result.
+///
+/// Unlike GetMergeableValue(RResultPtr<T> &), the type of the result does not
+/// need to be known. Mergeables obtained this way can be merged with
+/// MergeValueLists.
+inline std::unique_ptr<RMergeableValueBase> GetMergeableValue(ROOT::RDF::RResultHandle &handle)
+{
+   handle.ThrowIfNull();
+   handle.Get();
+   return handle.fActionPtr->GetMergeableValue();
+}
+} // namespace RDF
+} // namespace Detail
 } // namespace ROOT
 
 #endif // ROOT_RDF_RRESULTHANDLE
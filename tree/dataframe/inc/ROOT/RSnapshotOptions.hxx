@@ -18,6 +18,12 @@
 namespace ROOT {
 
 namespace RDF {
+/// The format of the dataset written by Snapshot
+enum class ESnapshotOutputFormat {
+   kTTree,  ///< A TTree, merged through a TBufferMerger in multi-thread event loops
+   kRNTuple ///< An RNTuple, filled through one fill context per processing slot (requires ROOT 7 support)
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +43,10 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kTTree; ///< Format of the output dataset
+   /// For RNTuple output of multi-thread event loops, write the entries in the order of the input dataset. The
+   /// compressed output of the tasks is then kept in memory until the end of the event loop.
+   bool fPreserveEntryOrder = false;
 };
 } // ns RDF
 } // ns ROOT
@@ -47,6 +47,10 @@ is used:
   - For expressions ("SELECT 1+1 FROM table"), the type of the first row of the result set determines the column type.
     That can result in a column to be of thought of type NULL where subsequent rows actually have meaningful values.
     The provided SELECT query can be used to avoid such ambiguities.
+
+The rows of the result set are fetched in batches, by default of 1024 rows, into column buffers. Every batch is split
+in one entry range per slot, such that the processing of the rows runs in parallel if implicit multi-threading is
+enabled, while sqlite steps through the result set in a single thread.
 */
 class RSqliteDS final : public ROOT::RDF::RDataSource {
 private:
@@ -66,7 +70,6 @@ private:
       explicit Value_t(ETypes type);
 
       ETypes fType;
-      bool fIsActive; ///< Not all columns of the query are necessarily used by the RDF. Allows for skipping them.
       Long64_t fInteger;
       double fReal;
       std::string fText;
@@ -75,15 +78,29 @@ private:
       void *fPtr; ///< Points to one of the values; an address to this pointer is returned by GetColumnReadersImpl.
    };
 
+   /// The values of a column for the rows of the current batch; only the vector of the column's type is used.
+   struct ColumnBuffer_t {
+      std::vector<Long64_t> fIntegers;
+      std::vector<double> fReals;
+      std::vector<std::string> fTexts;
+      std::vector<std::vector<unsigned char>> fBlobs;
+   };
+
    void SqliteError(int errcode);
+   void FillBuffers(unsigned int row);
 
    std::unique_ptr<Internal::RSqliteDSDataSet> fDataSet;
    unsigned int fNSlots;
    ULong64_t fNRow;
+   unsigned int fBatchSize;
+   ULong64_t fBatchBegin = 0; ///< Entry number of the first row in the column buffers
    std::vector<std::string> fColumnNames;
    std::vector<ETypes> fColumnTypes;
-   /// The data source is inherently single-threaded and returns only one row at a time. This vector holds the results.
-   std::vector<Value_t> fValues;
+   std::vector<bool> fIsActive; ///< Not all columns of the query are necessarily used by the RDF
+   /// The values of the current entry of every slot, indexed by slot and column.
+   std::vector<std::vector<Value_t>> fValues;
+   /// The rows of the current batch, one buffer per column, filled only for the active columns.
+   std::vector<ColumnBuffer_t> fBuffers;
 
    // clang-format off
    /// Corresponds to the types defined in ETypes.
@@ -97,7 +114,7 @@ private:
    // clang-format on
 
 public:
-   RSqliteDS(const std::string &fileName, const std::string &query);
+   RSqliteDS(const std::string &fileName, const std::string &query, unsigned int batchSize = 1024);
    ~RSqliteDS();
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final;
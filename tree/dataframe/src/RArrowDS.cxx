@@ -23,6 +23,17 @@ ROOT::RDF::MakeArrowDataFrame, which accepts one parameter:
 The types of the columns are derived from the types in the associated
 arrow::Schema.
 
+Numeric columns and arrays of numbers are read in place, without copying
+the Arrow buffers. The event loop processes the table in entry ranges
+that start and end at record batch (chunk) boundaries, so that in
+multi-threaded runs each task works on its own record batches.
+
+Datasets that do not fit in memory can be streamed with the overload of
+ROOT::RDF::MakeArrowDataFrame that takes an arrow::RecordBatchReader, e.g.
+an IPC stream reader or the reader returned by a Parquet file reader:
+record batches are read as the event loop proceeds, up to one per
+processing slot at a time. A stream can only be processed by one event loop.
+
 */
 // clang-format on
 
@@ -32,6 +43,7 @@ arrow::Schema.
 #include <snprintf.h>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -41,6 +53,7 @@ arrow::Schema.
 #pragma GCC diagnostic ignored "-Wshadow"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <arrow/record_batch.h>
 #include <arrow/table.h>
 #include <arrow/stl.h>
 #if defined(__GNUC__)
@@ -214,22 +227,42 @@ private:
    std::vector<ULong64_t> fChunkIndex;
    arrow::ArrayVector fChunks;
 
-public:
-   TValueGetter(size_t slots, arrow::ArrayVector chunks)
-      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0), fChunks{chunks}
+   void BuildChunkIndex(ULong64_t next)
    {
+      fFirstEntryPerChunk.clear();
+      fChunkIndex.clear();
       fChunkIndex.reserve(fChunks.size());
-      size_t next = 0;
-      for (auto &chunk : chunks) {
+      for (auto &chunk : fChunks) {
          fFirstEntryPerChunk.push_back(next);
          next += chunk->length();
          fChunkIndex.push_back(next);
       }
+   }
+
+public:
+   TValueGetter(size_t slots, arrow::ArrayVector chunks)
+      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0), fChunks{chunks}
+   {
+      BuildChunkIndex(0);
       for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
          fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
       }
    }
 
+   /// Replace the chunks to read from, e.g. with the next record batches of a stream.
+   /// The first of the new chunks starts at entry firstEntry.
+   void SetChunks(arrow::ArrayVector chunks, ULong64_t firstEntry)
+   {
+      fChunks = std::move(chunks);
+      BuildChunkIndex(firstEntry);
+      std::fill(fLastChunkPerSlot.begin(), fLastChunkPerSlot.end(), 0);
+      // no entry of the new chunks can be served from the cache
+      std::fill(fLastEntryPerSlot.begin(), fLastEntryPerSlot.end(), std::numeric_limits<ULong64_t>::max());
+   }
+
+   /// The end of each chunk, i.e. the first entry of the next one.
+   const std::vector<ULong64_t> &GetChunkEnds() const { return fChunkIndex; }
+
    /// This returns the ptr to the ptr to actual data.
    std::vector<void *> SlotPtrs()
    {
@@ -249,6 +282,11 @@ public:
       // queried.
       size_t ci = 0;
       assert(slot < fLastChunkPerSlot.size());
+      // The entry is not in the chunks we currently hold, as it happens for the first InitSlot of a stream.
+      if (fChunkIndex.empty() || entry < fFirstEntryPerChunk.front() || entry >= fChunkIndex.back()) {
+         fValuesPtrPerSlot[slot] = nullptr;
+         return;
+      }
       if (fLastEntryPerSlot[slot] < entry) {
          ci = fLastChunkPerSlot.at(slot);
       }
@@ -386,72 +424,64 @@ public:
 /// \param[in] inColumns the name of the columns to use
 /// In case columns is empty, we use all the columns found in the table
 RArrowDS::RArrowDS(std::shared_ptr<arrow::Table> inTable, std::vector<std::string> const &inColumns)
-   : fTable{inTable}, fColumnNames{inColumns}
+   : fTable{inTable}, fSchema{inTable->schema()}, fColumnNames{inColumns}
 {
-   auto &columnNames = fColumnNames;
-   auto &table = fTable;
-   auto &index = fGetterIndex;
-   // We want to allow people to specify which columns they
-   // need so that we can think of upfront IO optimizations.
-   auto filterWantedColumns = [&columnNames, &table]() {
-      if (columnNames.empty()) {
-         for (auto &field : table->schema()->fields()) {
-            columnNames.push_back(field->name());
-         }
-      }
-   };
-
-   // To support both arrow 0.14.0 and 0.16.0
-   using ColumnType = decltype(fTable->column(0));
-
-   auto getRecordsFirstColumn = [&columnNames, &table]() {
-      if (columnNames.empty()) {
-         throw std::runtime_error("At least one column required");
-      }
-      const auto name = columnNames.front();
-      const auto columnIdx = table->schema()->GetFieldIndex(name);
-      return table->column(columnIdx)->length();
-   };
+   InitColumns();
 
    // All columns are supposed to have the same number of entries.
-   auto verifyColumnSize = [&table](ColumnType column, int columnIdx, int nRecords) {
-      if (column->length() != nRecords) {
+   const auto nRecords = fTable->column(fGetterIndex.front().first)->length();
+   for (auto &link : fGetterIndex) {
+      if (fTable->column(link.first)->length() != nRecords) {
          std::string msg = "Column ";
-         msg += table->schema()->field(columnIdx)->name() + " has a different number of entries.";
+         msg += fSchema->field(link.first)->name() + " has a different number of entries.";
          throw std::runtime_error(msg);
       }
-   };
+   }
+}
 
-   /// For the moment we support only a few native types.
-   auto verifyColumnType = [&table](ColumnType column, int columnIdx) {
-      auto verifyType = std::make_unique<VerifyValidColumnType>();
-      auto result = column->type()->Accept(verifyType.get());
-      if (result.ok() == false) {
-         std::string msg = "Column ";
-         msg += table->schema()->field(columnIdx)->name() + " contains an unsupported type.";
-         throw std::runtime_error(msg);
-      }
-   };
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create an Arrow RDataSource for RDataFrame that streams record batches.
+/// \param[in] inReader the reader of the record batches, consumed by the event loop.
+/// \param[in] inColumns the name of the columns to use
+/// In case columns is empty, we use all the columns found in the schema of the reader
+RArrowDS::RArrowDS(std::shared_ptr<arrow::RecordBatchReader> inReader, std::vector<std::string> const &inColumns)
+   : fReader{inReader}, fSchema{inReader->schema()}, fColumnNames{inColumns}
+{
+   InitColumns();
+}
 
-   /// This is used to create an index between the columnId
-   /// and the associated getter.
-   auto addColumnToGetterIndex = [&index](int columnId) { index.push_back(std::make_pair(columnId, index.size())); };
+/// Fill the list of columns if it is empty, check the columns and build the index of the value getters.
+void RArrowDS::InitColumns()
+{
+   // We want to allow people to specify which columns they
+   // need so that we can think of upfront IO optimizations.
+   if (fColumnNames.empty()) {
+      for (auto &field : fSchema->fields()) {
+         fColumnNames.push_back(field->name());
+      }
+   }
+   if (fColumnNames.empty()) {
+      throw std::runtime_error("At least one column required");
+   }
 
    /// Assuming we can get called more than once, we need to
    /// reset the getter index each time.
-   auto resetGetterIndex = [&index]() { index.clear(); };
-
-   /// This is what initialization actually does
-   filterWantedColumns();
-   resetGetterIndex();
-   auto nRecords = getRecordsFirstColumn();
+   fGetterIndex.clear();
    for (auto &columnName : fColumnNames) {
-      auto columnIdx = fTable->schema()->GetFieldIndex(columnName);
-      addColumnToGetterIndex(columnIdx);
+      const auto columnIdx = fSchema->GetFieldIndex(columnName);
+      if (columnIdx < 0) {
+         throw std::runtime_error("The dataset does not have column " + columnName);
+      }
+
+      /// For the moment we support only a few native types.
+      VerifyValidColumnType verifyType;
+      if (!fSchema->field(columnIdx)->type()->Accept(&verifyType).ok()) {
+         throw std::runtime_error("Column " + columnName + " contains an unsupported type.");
+      }
 
-      auto column = fTable->column(columnIdx);
-      verifyColumnSize(column, columnIdx, nRecords);
-      verifyColumnType(column, columnIdx);
+      /// This is used to create an index between the columnId
+      /// and the associated getter.
+      fGetterIndex.push_back(std::make_pair(columnIdx, fGetterIndex.size()));
    }
 }
 
@@ -468,13 +498,15 @@ const std::vector<std::string> &RArrowDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RArrowDS::GetEntryRanges()
 {
+   if (fReader)
+      return ReadNextRecordBatches();
    auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
    return entryRanges;
 }
 
 std::string RArrowDS::GetTypeName(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       std::string msg = "The dataset does not have column ";
       msg += colName;
@@ -492,7 +524,7 @@ std::string RArrowDS::GetTypeName(std::string_view colName) const
 
 bool RArrowDS::HasColumn(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       return false;
    }
@@ -516,20 +548,39 @@ void RArrowDS::InitSlot(unsigned int slot, ULong64_t entry)
    }
 }
 
-void splitInEqualRanges(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges, int nRecords, unsigned int nSlots)
+/// Split the entries in ranges that start and end at the chunk (record batch) boundaries of the columns read, so that
+/// tasks do not share chunks. Consecutive small chunks are grouped in one range, chunks with more than
+/// nRecords / nSlots entries are split in equal parts.
+void splitInChunkAlignedRanges(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges, std::vector<ULong64_t> boundaries,
+                               ULong64_t nRecords, unsigned int nSlots)
 {
    ranges.clear();
-   const auto chunkSize = nRecords / nSlots;
-   const auto remainder = 1U == nSlots ? 0 : nRecords % nSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(nSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
-   }
-   ranges.back().second += remainder;
+   const auto maxEntries = std::max<ULong64_t>(1, nRecords / nSlots);
+   boundaries.push_back(nRecords);
+   std::sort(boundaries.begin(), boundaries.end());
+   boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+   ULong64_t start = 0; // first entry of the range being built
+   ULong64_t prev = 0;  // end of the previous chunk
+   for (auto end : boundaries) {
+      if (end <= prev || end > nRecords)
+         continue;
+      const auto length = end - prev;
+      if (length > maxEntries) {
+         if (start < prev)
+            ranges.emplace_back(start, prev);
+         const auto nPieces = (length + maxEntries - 1) / maxEntries;
+         for (ULong64_t i = 0; i < nPieces; ++i)
+            ranges.emplace_back(prev + i * length / nPieces, prev + (i + 1) * length / nPieces);
+         start = end;
+      } else if (end - start > maxEntries) {
+         ranges.emplace_back(start, prev);
+         start = prev;
+      }
+      prev = end;
+   }
+   if (start < prev)
+      ranges.emplace_back(start, prev);
 }
 
 int getNRecords(std::shared_ptr<arrow::Table> &table, std::vector<std::string> &columnNames)
@@ -560,8 +611,11 @@ void RArrowDS::SetNSlots(unsigned int nSlots)
 
    fValueGetters.clear();
    for (size_t ci = 0; ci != nColumns; ++ci) {
-      auto chunkedArray = getData(fTable->column(fGetterIndex[ci].first));
-      fValueGetters.emplace_back(std::make_unique<ROOT::Internal::RDF::TValueGetter>(nSlots, chunkedArray->chunks()));
+      // In streaming mode, the getters are pointed to the record batches as they are read.
+      arrow::ArrayVector chunks;
+      if (fTable)
+         chunks = getData(fTable->column(fGetterIndex[ci].first))->chunks();
+      fValueGetters.emplace_back(std::make_unique<ROOT::Internal::RDF::TValueGetter>(nSlots, chunks));
    }
 }
 
@@ -579,7 +633,7 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
       throw std::runtime_error("No column found at index " + std::to_string(column));
    };
 
-   const int columnIdx = fTable->schema()->GetFieldIndex(std::string(colName));
+   const int columnIdx = fSchema->GetFieldIndex(std::string(colName));
    const int getterIdx = findGetterIndex(columnIdx);
    assert(getterIdx != -1);
    assert((unsigned int)getterIdx < fValueGetters.size());
@@ -588,8 +642,50 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
 
 void RArrowDS::Initialize()
 {
-   auto nRecords = getNRecords(fTable, fColumnNames);
-   splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
+   if (fReader) {
+      if (fNStreamedEntries > 0)
+         throw std::runtime_error("RArrowDS: the record batch stream has already been read, it cannot be processed "
+                                  "by more than one event loop");
+      return;
+   }
+
+   std::vector<ULong64_t> chunkBoundaries;
+   for (auto &getter : fValueGetters) {
+      const auto &ends = getter->GetChunkEnds();
+      chunkBoundaries.insert(chunkBoundaries.end(), ends.begin(), ends.end());
+   }
+   splitInChunkAlignedRanges(fEntryRanges, std::move(chunkBoundaries), getNRecords(fTable, fColumnNames), fNSlots);
+}
+
+/// In streaming mode, read the next record batches, up to one per slot, and point the value getters to them.
+/// Every record batch is an entry range of its own; an empty list of ranges signals the end of the stream.
+std::vector<std::pair<ULong64_t, ULong64_t>> RArrowDS::ReadNextRecordBatches()
+{
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+   while (batches.size() < fNSlots) {
+      std::shared_ptr<arrow::RecordBatch> batch;
+      auto status = fReader->ReadNext(&batch);
+      if (!status.ok())
+         throw std::runtime_error("RArrowDS: could not read the next record batch: " + status.ToString());
+      if (!batch)
+         break; // end of the stream
+      if (batch->num_rows() == 0)
+         continue;
+      ranges.emplace_back(fNStreamedEntries, fNStreamedEntries + batch->num_rows());
+      fNStreamedEntries += batch->num_rows();
+      batches.emplace_back(std::move(batch));
+   }
+   if (batches.empty())
+      return ranges;
+
+   for (auto link : fGetterIndex) {
+      arrow::ArrayVector chunks;
+      for (auto &batch : batches)
+         chunks.emplace_back(batch->column(link.first));
+      fValueGetters[link.second]->SetChunks(std::move(chunks), ranges.front().first);
+   }
+   return ranges;
 }
 
 std::string RArrowDS::GetLabel()
@@ -609,6 +705,21 @@ RDataFrame MakeArrowDataFrame(std::shared_ptr<arrow::Table> table, std::vector<s
    return tdf;
 }
 
+/// \brief Factory method to create a Apache Arrow RDataFrame that streams record batches.
+///
+/// Creates a RDataFrame that reads the record batches of an arrow::RecordBatchReader while the
+/// event loop runs, e.g. from an Arrow IPC stream or a Parquet file, without loading the whole dataset in memory.
+/// The stream is consumed by the first event loop: booking more actions after that results in an error.
+/// \param[in] reader the reader of the record batches to use as a source.
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the schema of the reader
+RDataFrame
+MakeArrowDataFrame(std::shared_ptr<arrow::RecordBatchReader> reader, std::vector<std::string> const &columnNames)
+{
+   ROOT::RDataFrame tdf(std::make_unique<RArrowDS>(reader, columnNames));
+   return tdf;
+}
+
 } // namespace RDF
 
 } // namespace ROOT
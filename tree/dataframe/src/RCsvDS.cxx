@@ -21,7 +21,7 @@ ROOT::RDF::MakeCsvDataFrame, which accepts five parameters:
 2. Boolean that specifies whether the first row of the CSV file contains headers or
 not (optional, default `true`). If `false`, header names will be automatically generated as Col0, Col1, ..., ColN.
 3. Delimiter (optional, default ',').
-4. Chunk size (optional, default is -1 to read all) - number of lines to read at a time
+4. Chunk size (optional, default is -1 to let RCsvDS choose, see below) - number of lines to read at a time
 5. Column Types (optional, default is an empty map). A map with column names as keys and their type
 (expressed as a single character, see below) as values.
 
@@ -68,9 +68,11 @@ double-quote characters must be represented by a pair of double-quote characters
     2000,Mercury,Cougar
 ~~~
 
-The current implementation of RCsvDS reads the entire CSV file content into memory before
-RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
-important to check both how much memory is available and the size of the CSV file.
+RCsvDS processes the file in chunks of lines, memory-mapping it when it is a local file. Every chunk is divided
+into one entry range per processing slot at line boundaries, and each slot parses the lines of its own range into
+typed column buffers. With multi-threading enabled, the parsing thus runs in parallel. Only the chunk being processed
+is held in memory: the chunk size is the number of lines given to MakeCsvDataFrame,
+or about 64 MB of the file per slot by default.
 
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
@@ -84,10 +86,84 @@ Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored
 #include <TError.h>
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
-#include <sstream>
 #include <string>
 
+namespace {
+
+/// If the size of the chunks is not given by the user, each GetEntryRanges() call covers about this many bytes of
+/// the file per slot
+constexpr std::uint64_t kDefaultChunkBytesPerSlot = 64 * 1024 * 1024;
+/// Size of the blocks read from files that cannot be memory-mapped
+constexpr std::size_t kReadBlockSize = 4 * 1024 * 1024;
+
+/// Sequential access to the lines of a CSV file starting at a given offset. The bytes come from the memory mapping
+/// of the file if there is one and are read in blocks otherwise. Line breaks are searched with memchr, which the C
+/// library implements with vector instructions. A trailing '\r' (Windows line break) is not part of the line.
+class RLineScanner {
+   ROOT::Internal::RRawFile *fFile;
+   std::string fBuffer;
+   const char *fData = nullptr;
+   std::size_t fSize = 0;
+   std::size_t fPos = 0;        ///< Position of the next line in fData
+   std::uint64_t fDataOffset;   ///< Offset in the file of fData[0]
+   bool fAtEndOfFile = false;   ///< Whether fData extends to the end of the file
+
+   void ReadBlock()
+   {
+      // keep the beginning of an incomplete line
+      fBuffer.erase(0, fPos);
+      fDataOffset += fPos;
+      fPos = 0;
+      const auto nKept = fBuffer.size();
+      fBuffer.resize(nKept + kReadBlockSize);
+      const auto nRead = fFile->ReadAt(&fBuffer[nKept], kReadBlockSize, fDataOffset + nKept);
+      fBuffer.resize(nKept + nRead);
+      fAtEndOfFile = nRead < kReadBlockSize;
+      fData = fBuffer.data();
+      fSize = fBuffer.size();
+   }
+
+public:
+   RLineScanner(const char *mappedData, std::uint64_t mappedSize, ROOT::Internal::RRawFile *file, std::uint64_t offset)
+      : fFile(file), fDataOffset(offset)
+   {
+      if (mappedData) {
+         fData = mappedData + offset;
+         fSize = mappedSize - offset;
+         fAtEndOfFile = true;
+      }
+   }
+
+   /// Find the next line; returns false at the end of the file
+   bool Next(const char *&line, std::size_t &length)
+   {
+      while (true) {
+         const char *begin = fData + fPos;
+         const auto nAvailable = fSize - fPos;
+         auto lineBreak = nAvailable > 0 ? static_cast<const char *>(memchr(begin, '\n', nAvailable)) : nullptr;
+         if (lineBreak || fAtEndOfFile) {
+            if (!lineBreak && nAvailable == 0)
+               return false;
+            length = lineBreak ? lineBreak - begin : nAvailable;
+            fPos += lineBreak ? length + 1 : length;
+            if (length > 0 && begin[length - 1] == '\r')
+               --length;
+            line = begin;
+            return true;
+         }
+         ReadBlock();
+      }
+   }
+
+   /// The offset in the file of the next line
+   std::uint64_t GetPos() const { return fDataOffset + fPos; }
+};
+
+} // anonymous namespace
+
 namespace ROOT {
 
 namespace RDF {
@@ -117,47 +193,75 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+/// Parse the lines of an entry range into the column buffers of a slot. This runs in the thread processing the range.
+void RCsvDS::ParseRange(unsigned int slot, const RLineRange &range)
 {
-   auto i = 0U;
-
-   auto columns = ParseColumns(line);
-
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
+   auto &values = fSlotValues[slot];
+   const auto nEntries = range.fEndEntry - range.fFirstEntry;
+   const auto nColumns = fHeaders.size();
+   for (auto i = 0u; i < nColumns; ++i) {
+      switch (fColTypesList[i]) {
+      case 'D': values.fDoubles[i].clear(); values.fDoubles[i].reserve(nEntries); break;
+      case 'L': values.fLong64s[i].clear(); values.fLong64s[i].reserve(nEntries); break;
+      case 'O': values.fBools[i].clear(); break;
+      case 'T': values.fStrings[i].clear(); values.fStrings[i].reserve(nEntries); break;
+      }
+   }
 
-      switch (colType) {
-      case 'D': {
-         record.emplace_back(new double((col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN()));
-         break;
+   RLineScanner scanner(fMappedData, fMappedSize, values.fFile.get(), range.fBegin);
+   auto &columns = values.fFields;
+   const char *line = nullptr;
+   std::size_t length = 0;
+   ULong64_t nParsed = 0;
+   while (nParsed < nEntries && scanner.Next(line, length)) {
+      if (length == 0)
+         continue; // skip empty lines
+      ParseColumns(line, length, columns);
+      if (columns.size() != nColumns) {
+         throw std::runtime_error("RCsvDS: record " + std::to_string(range.fFirstEntry + nParsed) + " has " +
+                                  std::to_string(columns.size()) + " fields instead of " + std::to_string(nColumns));
       }
-      case 'L': {
-         if (col != "nan") {
-            record.emplace_back(new Long64_t(std::stoll(col)));
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            record.emplace_back(new Long64_t(0));
+
+      for (auto i = 0u; i < nColumns; ++i) {
+         auto &col = columns[i];
+         switch (fColTypesList[i]) {
+         case 'D': {
+            values.fDoubles[i].push_back((col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN());
+            break;
+         }
+         case 'L': {
+            if (col != "nan") {
+               values.fLong64s[i].push_back(std::stoll(col));
+            } else {
+               values.fColContainingEmpty[i] = true;
+               values.fLong64s[i].push_back(0);
+            }
+            break;
+         }
+         case 'O': {
+            if (col != "nan") {
+               // same as reading the value with std::boolalpha
+               const auto start = col.find_first_not_of(" \t\n\v\f\r");
+               values.fBools[i].push_back(start != std::string::npos && col.compare(start, 4, "true") == 0);
+            } else {
+               values.fColContainingEmpty[i] = true;
+               values.fBools[i].push_back(false);
+            }
+            break;
+         }
+         case 'T': {
+            values.fStrings[i].emplace_back(std::move(col));
+            break;
          }
-         break;
-      }
-      case 'O': {
-         auto b = new bool();
-         record.emplace_back(b);
-         if (col != "nan") {
-            std::istringstream(col) >> std::boolalpha >> *b;
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            *b = false;
          }
-         break;
-      }
-      case 'T': {
-         record.emplace_back(new std::string(col));
-         break;
-      }
       }
-      ++i;
+      ++nParsed;
    }
+   if (nParsed != nEntries)
+      throw std::runtime_error("RCsvDS: the CSV file " + fCsvFile->GetUrl() + " was modified while being read");
+
+   values.fFirstEntry = range.fFirstEntry;
+   values.fEndEntry = range.fEndEntry;
 }
 
 void RCsvDS::GenerateHeaders(size_t size)
@@ -183,19 +287,10 @@ std::vector<void *> RCsvDS::GetColumnReadersImpl(std::string_view colName, const
 
    const auto &colNames = GetColumnNames();
    const auto index = std::distance(colNames.begin(), std::find(colNames.begin(), colNames.end(), colName));
+   // the addresses are set by SetEntry to point to the values parsed by the slot
    std::vector<void *> ret(fNSlots);
    for (auto slot : ROOT::TSeqU(fNSlots)) {
-      auto &val = fColAddresses[index][slot];
-      if (ti == typeid(double)) {
-         val = &fDoubleEvtValues[index][slot];
-      } else if (ti == typeid(Long64_t)) {
-         val = &fLong64EvtValues[index][slot];
-      } else if (ti == typeid(std::string)) {
-         val = &fStringEvtValues[index][slot];
-      } else {
-         val = &fBoolEvtValues[index][slot];
-      }
-      ret[slot] = &val;
+      ret[slot] = &fColAddresses[index][slot];
    }
    return ret;
 }
@@ -243,7 +338,6 @@ void RCsvDS::InferColTypes(std::vector<std::string> &columns)
       if (columns[i] == "nan") {
          // could not find a non-empty value, default to double
          fColTypes[fHeaders[i]] = 'D';
-         fColTypesList.push_back('D');
       } else {
          InferType(columns[i], i);
       }
@@ -268,50 +362,67 @@ void RCsvDS::InferType(const std::string &col, unsigned int idxCol)
    // TODO: Date
 
    fColTypes[fHeaders[idxCol]] = type;
-   fColTypesList.push_back(type);
 }
 
-std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
+std::vector<std::string> RCsvDS::ParseColumns(const std::string &line) const
 {
    std::vector<std::string> columns;
-
-   for (size_t i = 0; i < line.size(); ++i) {
-      i = ParseValue(line, columns, i);
-   }
-
+   ParseColumns(line.data(), line.size(), columns);
    return columns;
 }
 
-size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i)
+/// Split a line in its fields. The strings of columns are reused, columns is resized to the number of fields.
+void RCsvDS::ParseColumns(const char *line, std::size_t size, std::vector<std::string> &columns) const
 {
-   std::string val;
-   bool quoted = false;
-   const size_t prevPos = i; // used to check if cell is empty
+   std::size_t nColumns = 0;
+   auto nextColumn = [&columns, &nColumns]() -> std::string & {
+      if (nColumns == columns.size())
+         columns.emplace_back();
+      return columns[nColumns++];
+   };
+
+   for (std::size_t i = 0; i < size; ++i) {
+      i = ParseValue(line, size, i, nextColumn());
+
+      // if the line ends with the delimiter, we need to append the default column value
+      // for the _next_, last column that won't be parsed (because we are out of characters)
+      if (i == size - 1 && line[i] == fDelimiter)
+         nextColumn() = "nan";
+   }
+   columns.resize(nColumns);
+}
 
-   for (; i < line.size(); ++i) {
-      if (line[i] == fDelimiter && !quoted) {
-         break;
-      } else if (line[i] == '"') {
-         // Keep just one quote for escaped quotes, none for the normal quotes
-         if (line[i + 1] != '"') {
-            quoted = !quoted;
+std::size_t RCsvDS::ParseValue(const char *line, std::size_t size, std::size_t i, std::string &val) const
+{
+   val.clear();
+   const std::size_t prevPos = i; // used to check if cell is empty
+
+   // Fast path for fields without quotes, which are copied up to the next delimiter
+   auto delimiter = static_cast<const char *>(memchr(line + i, fDelimiter, size - i));
+   const std::size_t end = delimiter ? delimiter - line : size;
+   if (!memchr(line + i, '"', end - i)) {
+      val.assign(line + i, end - i);
+      i = end;
+   } else {
+      bool quoted = false;
+      for (; i < size; ++i) {
+         if (line[i] == fDelimiter && !quoted) {
+            break;
+         } else if (line[i] == '"') {
+            // Keep just one quote for escaped quotes, none for the normal quotes
+            if (i + 1 == size || line[i + 1] != '"') {
+               quoted = !quoted;
+            } else {
+               val += line[++i];
+            }
          } else {
-            val += line[++i];
+            val += line[i];
          }
-      } else {
-         val += line[i];
       }
    }
 
    if (prevPos == i || val == "nan" || val == "NaN") // empty cell or explicit nan/NaN
-      columns.emplace_back("nan");
-   else
-      columns.emplace_back(std::move(val));
-
-   // if the line ends with the delimiter, we need to append the default column value
-   // for the _next_, last column that won't be parsed (because we are out of characters)
-   if (i == line.size() - 1 && line[i] == fDelimiter)
-      columns.emplace_back("nan");
+      val = "nan";
 
    return i;
 }
@@ -322,15 +433,18 @@ size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &col
 /// \param[in] readHeaders `true` if the CSV file contains headers as first row, `false` otherwise
 ///                        (default `true`).
 /// \param[in] delimiter Delimiter character (default ',').
-/// \param[in] linesChunkSize bunch of lines to read, use -1 to read all
+/// \param[in] linesChunkSize bunch of lines to read, use -1 to let the data source choose
 /// \param[in] colTypes Allows users to manually specify column types. Accepts an unordered map with keys being
 ///                     column names, values being type specifiers ('O' for boolean, 'D' for double, 'L' for
 ///                     Long64_t, 'T' for std::string)
 RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long64_t linesChunkSize,
                std::unordered_map<std::string, char> &&colTypes)
-   : fReadHeaders(readHeaders), fCsvFile(ROOT::Internal::RRawFile::Create(fileName)), fDelimiter(delimiter),
-     fLinesChunkSize(linesChunkSize), fColTypes(std::move(colTypes))
+   : fReadHeaders(readHeaders), fDelimiter(delimiter), fLinesChunkSize(linesChunkSize), fColTypes(std::move(colTypes))
 {
+   ROOT::Internal::RRawFile::ROptions options;
+   options.fUseMmap = true;
+   fCsvFile = ROOT::Internal::RRawFile::Create(fileName, options);
+
    std::string line;
 
    // Read the headers if present
@@ -362,9 +476,16 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
 
       // Infer types of columns with first record
       InferColTypes(columns);
+      for (const auto &header : fHeaders)
+         fColTypesList.push_back(fColTypes[header]);
 
       // rewind
       fCsvFile->Seek(fDataPos);
+
+      if (fCsvFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap) {
+         fMappedSize = fCsvFile->GetSize();
+         fMappedData = reinterpret_cast<const char *>(fCsvFile->GetMappedData(fMappedSize, 0));
+      }
    } else {
       std::string msg = "Could not infer column types of CSV file ";
       msg += fileName;
@@ -372,48 +493,45 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
    }
 }
 
-void RCsvDS::FreeRecords()
-{
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'D': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'L': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'O': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 'T': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
-   }
-   fRecords.clear();
-}
-
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
-RCsvDS::~RCsvDS()
-{
-   FreeRecords();
-}
+RCsvDS::~RCsvDS() = default;
 
 void RCsvDS::Finalize()
 {
    fCsvFile->Seek(fDataPos);
    fProcessedLines = 0ULL;
-   fEntryRangesRequested = 0ULL;
-   FreeRecords();
+   fLineRanges.clear();
+   for (auto &values : fSlotValues) {
+      for (auto i = 0u; i < fHeaders.size(); ++i) {
+         if (values.fColContainingEmpty[i])
+            fColContainingEmpty.insert(fHeaders[i]);
+         values.fColContainingEmpty[i] = false;
+         values.fDoubles[i].clear();
+         values.fLong64s[i].clear();
+         values.fStrings[i].clear();
+         values.fBools[i].clear();
+      }
+      values.fFirstEntry = values.fEndEntry = 0ULL;
+   }
+   WarnColContainingEmpty();
+}
+
+void RCsvDS::WarnColContainingEmpty()
+{
+   if (fColContainingEmpty.empty())
+      return;
+
+   std::string msg = "";
+   for (const auto &col : fColContainingEmpty) {
+      const auto colT = GetTypeName(col);
+      msg += "Column \"" + col + "\" of type " + colT + " contains empty cell(s) or NaN(s).\n";
+      msg += "There is no `nan` equivalent for type " + colT + ", hence ";
+      msg += std::string(colT == "Long64_t" ? "`0`" : "`false`") + " is stored.\n";
+   }
+   msg += "Please manually set the column type to `double` (with `D`) in `MakeCsvDataFrame` to read NaNs instead.\n";
+   Warning("RCsvDS", "%s", msg.c_str());
+   fColContainingEmpty.clear();
 }
 
 const std::vector<std::string> &RCsvDS::GetColumnNames() const
@@ -423,40 +541,36 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
-   // Read records and store them in memory
-   auto linesToRead = fLinesChunkSize;
-   FreeRecords();
-
-   std::string line;
-   while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
-      if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
-      --linesToRead;
-   }
-
-   if (!fColContainingEmpty.empty()) {
-      std::string msg = "";
-      for (const auto &col : fColContainingEmpty) {
-         const auto colT = GetTypeName(col);
-         msg += "Column \"" + col + "\" of type " + colT + " contains empty cell(s) or NaN(s).\n";
-         msg += "There is no `nan` equivalent for type " + colT + ", hence ";
-         msg += std::string(colT == "Long64_t" ? "`0`" : "`false`") + " is stored.\n";
-      }
-      msg += "Please manually set the column type to `double` (with `D`) in `MakeCsvDataFrame` to read NaNs instead.\n";
-      Warning("RCsvDS", "%s", msg.c_str());
+   // Find the lines of the next chunk. They are not parsed here but by the slot processing them, see SetEntry().
+   const auto chunkBegin = fCsvFile->GetFilePos();
+   const auto maxChunkBytes = kDefaultChunkBytesPerSlot * fNSlots;
+   auto chunkEnd = chunkBegin;
+   ULong64_t nRecords = 0;
+   RLineScanner scanner(fMappedData, fMappedSize, fCsvFile.get(), chunkBegin);
+   const char *line = nullptr;
+   std::size_t length = 0;
+   while ((-1LL == fLinesChunkSize ? chunkEnd - chunkBegin < maxChunkBytes
+                                   : nRecords < static_cast<ULong64_t>(fLinesChunkSize)) &&
+          scanner.Next(line, length)) {
+      if (length == 0)
+         continue; // skip empty lines
+      ++nRecords;
+      chunkEnd = scanner.GetPos();
    }
+   fCsvFile->Seek(chunkEnd);
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
+         Info("GetEntryRanges", "Attempted to read a chunk of %llu bytes per slot of CSV file, %llu lines read",
+              static_cast<ULong64_t>(kDefaultChunkBytesPerSlot), nRecords);
       } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file, %llu lines read", fLinesChunkSize,
+              nRecords);
       }
    }
 
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
+   fLineRanges.clear();
    if (0 == nRecords)
       return entryRanges;
 
@@ -465,16 +579,26 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
    auto start = fProcessedLines;
    auto end = start;
 
+   // Find the file offsets of the boundaries between the ranges, the last range ends with the chunk
+   RLineScanner rangeScanner(fMappedData, fMappedSize, fCsvFile.get(), chunkBegin);
    for (auto i : ROOT::TSeqU(fNSlots)) {
       start = end;
       end += chunkSize;
+      if (i == fNSlots - 1)
+         end += remainder;
+      RLineRange range{start, end, rangeScanner.GetPos(), chunkEnd};
+      if (i < fNSlots - 1) {
+         for (auto nLines = start; nLines < end && rangeScanner.Next(line, length);) {
+            if (length > 0)
+               ++nLines;
+         }
+         range.fEnd = rangeScanner.GetPos();
+      }
+      fLineRanges.emplace_back(range);
       entryRanges.emplace_back(start, end);
-      (void)i;
    }
-   entryRanges.back().second += remainder;
 
    fProcessedLines += nRecords;
-   fEntryRangesRequested++;
 
    return entryRanges;
 }
@@ -502,31 +626,37 @@ bool RCsvDS::HasColumn(std::string_view colName) const
 
 bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   // Here we need to normalise the entry to the number of lines we already processed.
-   const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
-   const auto recordPos = entry - offset;
-   int colIndex = 0;
-   for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
-      switch (colType) {
+   auto &values = fSlotValues[slot];
+   if (entry < values.fFirstEntry || entry >= values.fEndEntry) {
+      const auto range = std::find_if(fLineRanges.begin(), fLineRanges.end(), [entry](const RLineRange &r) {
+         return r.fFirstEntry <= entry && entry < r.fEndEntry;
+      });
+      if (range == fLineRanges.end())
+         throw std::runtime_error("RCsvDS: entry " + std::to_string(entry) + " is not part of the current entry ranges");
+      ParseRange(slot, *range);
+   }
+
+   const auto recordPos = entry - values.fFirstEntry;
+   for (auto colIndex = 0u; colIndex < fColTypesList.size(); ++colIndex) {
+      auto &address = fColAddresses[colIndex][slot];
+      switch (fColTypesList[colIndex]) {
       case 'D': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
+         address = &values.fDoubles[colIndex][recordPos];
          break;
       }
       case 'L': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
+         address = &values.fLong64s[colIndex][recordPos];
          break;
       }
       case 'O': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
+         address = &values.fBools[colIndex][recordPos];
          break;
       }
       case 'T': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
+         address = &values.fStrings[colIndex][recordPos];
          break;
       }
       }
-      colIndex++;
    }
    return true;
 }
@@ -541,11 +671,18 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    // Initialize the entire set of addresses
    fColAddresses.resize(nColumns, std::vector<void *>(fNSlots, nullptr));
 
-   // Initialize the per event data holders
-   fDoubleEvtValues.resize(nColumns, std::vector<double>(fNSlots));
-   fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
-   fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
-   fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
+   // Initialize the per slot buffers of the parsed values
+   fSlotValues.resize(fNSlots);
+   for (auto &values : fSlotValues) {
+      values.fDoubles.resize(nColumns);
+      values.fLong64s.resize(nColumns);
+      values.fStrings.resize(nColumns);
+      values.fBools.resize(nColumns);
+      values.fColContainingEmpty.resize(nColumns, false);
+      // Without a memory mapping, every slot reads its range through its own file object
+      if (!fMappedData)
+         values.fFile = fCsvFile->Clone();
+   }
 }
 
 std::string RCsvDS::GetLabel()
@@ -10,6 +10,8 @@
 
 #include "ROOT/RDF/ActionHelpers.hxx"
 #include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "TProfile.h"
+#include "TProfile2D.h"
 
 namespace ROOT {
 namespace Internal {
@@ -38,6 +40,36 @@ ULong64_t &CountHelper::PartialUpdate(unsigned int slot)
    return fCounts[slot];
 }
 
+void FillWithBuffer(TH1 &h, const std::vector<std::vector<double>> &buffers)
+{
+   const auto &xs = buffers[0];
+   const double *w = buffers[1].empty() ? nullptr : buffers[1].data();
+   // FillN assumes that the number of bins does not change while filling: extendable axes are filled value by value
+   if (h.GetXaxis()->CanExtend()) {
+      for (std::size_t i = 0; i < xs.size(); ++i) {
+         if (w)
+            h.Fill(xs[i], w[i]);
+         else
+            h.Fill(xs[i]);
+      }
+      return;
+   }
+   h.FillN(static_cast<Int_t>(xs.size()), xs.data(), w);
+}
+
+// The profiles fill value by value if their axes can be extended
+void FillWithBuffer(::TProfile &h, const std::vector<std::vector<double>> &buffers)
+{
+   const double *w = buffers[2].empty() ? nullptr : buffers[2].data();
+   h.FillN(static_cast<Int_t>(buffers[0].size()), buffers[0].data(), buffers[1].data(), w);
+}
+
+void FillWithBuffer(::TProfile2D &h, const std::vector<std::vector<double>> &buffers)
+{
+   const double *w = buffers[3].empty() ? nullptr : buffers[3].data();
+   h.FillN(static_cast<Int_t>(buffers[0].size()), buffers[0].data(), buffers[1].data(), buffers[2].data(), w);
+}
+
 void BufferedFillHelper::UpdateMinMax(unsigned int slot, double v)
 {
    auto &thisMin = fMin[slot * CacheLineStep<BufEl_t>()];
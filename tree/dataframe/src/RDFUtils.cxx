@@ -15,21 +15,29 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RLogger.hxx"
 #include "RtypesCore.h"
+#include "RVersion.h" // ROOT_RELEASE
 #include "TBranch.h"
 #include "TBranchElement.h"
 #include "TClass.h"
 #include "TClassEdit.h"
 #include "TClassRef.h"
+#include "TEnv.h"
 #include "TError.h" // Info
 #include "TInterpreter.h"
 #include "TLeaf.h"
+#include "TMD5.h"
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
+#include "TSystem.h"
 #include "TTree.h"
 
 #include <stdexcept>
 #include <string>
+#include <cctype> // std::isalnum, std::isxdigit
+#include <cstdlib> // std::getenv, std::strtoull
 #include <cstring>
+#include <fstream>
 #include <typeinfo>
+#include <vector>
 
 using namespace ROOT::Detail::RDF;
 using namespace ROOT::RDF;
@@ -40,6 +48,89 @@ ROOT::Experimental::RLogChannel &ROOT::Detail::RDF::RDFLogChannel()
    return c;
 }
 
+namespace {
+/// All the code declared through InterpreterDeclare in this process, in order. Jitted code refers to these
+/// declarations (e.g. R_rdf::func0), so they are part of the key and of the source of the cached libraries.
+std::string &GetDeclaredCode()
+{
+   static std::string code;
+   return code;
+}
+
+/// The jitted code with the addresses of the objects it operates on replaced by placeholders: it is the same in all
+/// processes that book the same computation graph.
+struct RJitCacheEntry {
+   std::string fKey;                ///< Hash of the ROOT version, compiler, declarations and code
+   std::string fCode;               ///< Code with the n-th address replaced by `a[n]`
+   std::vector<void *> fAddresses;  ///< The addresses that were replaced, in order
+};
+
+std::string GetJitCacheDir()
+{
+   const char *envDir = std::getenv("ROOT_RDF_JITCACHE");
+   TString dir = envDir ? envDir : gEnv->GetValue("RDataFrame.JitCache.Dir", "");
+   if (dir.IsNull())
+      return "";
+   gSystem->ExpandPathName(dir);
+   return dir.Data();
+}
+
+RJitCacheEntry MakeJitCacheEntry(const std::string &code)
+{
+   RJitCacheEntry entry;
+   auto &out = entry.fCode;
+   out.reserve(code.size());
+   const auto size = code.size();
+   char quote = 0; // the delimiter of the string or character literal we are in, if any
+   for (std::size_t i = 0; i < size;) {
+      const char c = code[i];
+      if (quote != 0) {
+         out += c;
+         if (c == '\\' && i + 1 < size) {
+            out += code[i + 1];
+            i += 2;
+            continue;
+         }
+         if (c == quote)
+            quote = 0;
+         ++i;
+         continue;
+      }
+      const auto prev = i > 0 ? static_cast<unsigned char>(code[i - 1]) : ' ';
+      const bool startsToken = !(std::isalnum(prev) || prev == '_');
+      if (c == '0' && startsToken && i + 2 < size && (code[i + 1] == 'x' || code[i + 1] == 'X') &&
+          std::isxdigit(static_cast<unsigned char>(code[i + 2]))) {
+         // an address printed by PrettyPrintAddr
+         auto end = i + 2;
+         while (end < size && std::isxdigit(static_cast<unsigned char>(code[end])))
+            ++end;
+         const auto addr = std::strtoull(code.substr(i, end - i).c_str(), nullptr, 16);
+         entry.fAddresses.emplace_back(reinterpret_cast<void *>(addr));
+         out += "a[" + std::to_string(entry.fAddresses.size() - 1) + "]";
+         i = end;
+         continue;
+      }
+      if (c == '"' || c == '\'')
+         quote = c;
+      out += c;
+      ++i;
+   }
+
+   TMD5 md5;
+   const std::string keySource = std::string(ROOT_RELEASE) + '\n' + gSystem->GetBuildCompilerVersion() + '\n' +
+                                 GetDeclaredCode() + '\n' + entry.fCode;
+   md5.Update(reinterpret_cast<const UChar_t *>(keySource.data()), keySource.size());
+   md5.Final();
+   entry.fKey = md5.AsString();
+   return entry;
+}
+
+std::string GetJitCacheLibName(const RJitCacheEntry &entry)
+{
+   return "rdfjit_" + entry.fKey;
+}
+} // anonymous namespace
+
 namespace ROOT {
 namespace Internal {
 namespace RDF {
@@ -322,6 +413,7 @@ void InterpreterDeclare(const std::string &code)
          "the crash\n All RDF objects that have not run an event loop yet should be considered in an invalid state.\n";
       throw std::runtime_error(msg);
    }
+   GetDeclaredCode().append(code).append("\n");
 }
 
 Long64_t InterpreterCalc(const std::string &code, const std::string &context)
@@ -360,6 +452,80 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context)
    return 0; // we used to forward the return value of Calc, but that's not possible anymore.
 }
 
+bool RunCachedJitCode(const std::string &code)
+{
+   const auto dir = GetJitCacheDir();
+   if (dir.empty())
+      return false;
+
+   const auto entry = MakeJitCacheEntry(code);
+   const auto libName = GetJitCacheLibName(entry);
+   const auto libPath = dir + "/" + libName + "." + gSystem->GetSoExt();
+   if (gSystem->AccessPathName(libPath.c_str()))
+      return false; // not in the cache yet
+
+   if (gSystem->Load(libPath.c_str()) < 0) {
+      Warning("RDataFrame::JitCache", "Could not load %s, jitting the code instead.", libPath.c_str());
+      return false;
+   }
+   using JitFunc_t = void (*)(void **);
+   auto func = reinterpret_cast<JitFunc_t>(gSystem->DynFindSymbol(libPath.c_str(), libName.c_str()));
+   if (func == nullptr) {
+      Warning("RDataFrame::JitCache", "Could not find the entry point of %s, jitting the code instead.",
+              libPath.c_str());
+      return false;
+   }
+
+   R__LOG_INFO(RDFLogChannel()) << "Running the jitted code from the cached library " << libPath << '.';
+   auto addresses = entry.fAddresses;
+   func(addresses.data());
+   return true;
+}
+
+void AddToJitCache(const std::string &code)
+{
+   const auto dir = GetJitCacheDir();
+   if (dir.empty())
+      return;
+
+   const auto entry = MakeJitCacheEntry(code);
+   const auto libName = GetJitCacheLibName(entry);
+   const auto libPath = dir + "/" + libName;
+   const auto srcPath = libPath + ".C";
+   const auto failedPath = libPath + ".failed";
+   // already compiled, being compiled by another process, or known not to compile
+   if (!gSystem->AccessPathName((libPath + "." + gSystem->GetSoExt()).c_str()) ||
+       !gSystem->AccessPathName(srcPath.c_str()) || !gSystem->AccessPathName(failedPath.c_str()))
+      return;
+
+   if (gSystem->AccessPathName(dir.c_str()) && gSystem->mkdir(dir.c_str(), /*recursive*/ true) != 0) {
+      Warning("RDataFrame::JitCache", "Could not create the cache directory %s.", dir.c_str());
+      return;
+   }
+
+   {
+      // The code lives in its own namespace because cling already knows about the declarations of this process.
+      // Unqualified std names are valid in jitted code, as in the interpreter.
+      std::ofstream src(srcPath);
+      src << "#include \"ROOT/RDataFrame.hxx\"\n#include \"ROOT/RVec.hxx\"\n#include \"TMath.h\"\n\n"
+          << "namespace R_rdf_" << entry.fKey << " {\nusing namespace std;\n"
+          << GetDeclaredCode() << "\nextern \"C\" void " << libName << "(void **a)\n{\n"
+          << entry.fCode << "\n}\n} // namespace R_rdf_" << entry.fKey << '\n';
+      if (!src) {
+         Warning("RDataFrame::JitCache", "Could not write %s.", srcPath.c_str());
+         return;
+      }
+   }
+
+   R__LOG_INFO(RDFLogChannel()) << "Compiling the jitted code into the cached library " << libPath << '.';
+   // compile only: this process already runs the interpreted version of the same code
+   if (!gSystem->CompileMacro(srcPath.c_str(), "kOcs", libPath.c_str())) {
+      Warning("RDataFrame::JitCache",
+              "The jitted code could not be compiled in %s: it will be jitted in every process.", srcPath.c_str());
+      std::ofstream failed(failedPath);
+   }
+}
+
 bool IsInternalColumn(std::string_view colName)
 {
    const auto str = colName.data();
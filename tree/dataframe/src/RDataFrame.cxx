@@ -947,6 +947,9 @@ to tag "up"). The _full_ variation name will be composed of the varied column na
 Note how we use the "pt" column as usual in the Filter() and Define() calls and we simply use "x" as the value to fill
 the resulting histogram. To produce the varied results, RDataFrame will automatically execute the Filter and Define
 calls for each variation and fill the histogram with values and cuts that depend on the variation.
+Only the Filter and Define calls that depend on a varied column are executed once per variation: the others, as well
+as the Vary() expression, which returns the values of all variations at once, are executed once per entry and shared by
+all variations.
 
 There is no limitation to the complexity of a Vary() expression, and just like for Define() and Filter() calls users are
 not limited to string expressions but they can also pass any valid C++ callable, including lambda functions and
@@ -127,6 +127,16 @@ void RDatasetSpec::AddFriend(const std::vector<std::pair<std::string, std::strin
    fFriendInfo.AddFriend(treeAndFileNameGlobs, alias);
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Set the global entry range to be processed, replacing the one given at construction.
+/// \param[in] entryRange The global entry range to be processed, {begin (inclusive), end (exclusive)}
+/// \return A reference to this specification, to chain further calls.
+RDatasetSpec &RDatasetSpec::WithGlobalRange(const REntryRange &entryRange)
+{
+   fEntryRange = entryRange;
+   return *this;
+}
+
 const std::vector<std::string> &RDatasetSpec::GetTreeNames() const
 {
    return fTreeNames;
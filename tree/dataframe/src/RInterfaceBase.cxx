@@ -384,6 +384,85 @@ unsigned int ROOT::RDF::RInterfaceBase::GetNRuns() const
    return fLoopManager->GetNRuns();
 }
 
+/// \brief Process the following event loops in blocks of consecutive entries (experimental).
+/// \param[in] blockSize Maximum number of entries per block. 0 or 1 (the default) process one entry at a time.
+///
+/// In block execution mode, each processing slot accumulates up to blockSize consecutive entries, copying the values
+/// of the columns read from the dataset, and then runs every Filter, Define and action of the computation graph over
+/// the whole block, so that each node's code runs in a tight loop. Results are the same as in the default mode, but
+/// values of Defines are only guaranteed to stay valid until the end of a block.
+///
+/// The setting applies to the whole computation graph and is ignored, i.e. entries are processed one at a time, for
+/// event loops that involve Range, Vary or Snapshot. Columns whose type is not default-constructible and
+/// copy-assignable are also processed one entry at a time.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df(1000000);
+/// df.SetBlockSize(256);
+/// auto h = df.Define("x", "gRandom->Gaus()").Filter("x > 0").Histo1D("x");
+/// ~~~
+void ROOT::RDF::RInterfaceBase::SetBlockSize(unsigned int blockSize)
+{
+   fLoopManager->SetBlockSize(blockSize);
+}
+
+/// \brief Profile the following event loops of the computation graph (experimental).
+/// \param[in] enable Whether to profile them.
+///
+/// A profiled event loop records the time spent jitting, initializing the nodes, running the event loop and finalizing
+/// the results, the tasks run by each processing slot and, per Filter, Define, action and TTree column, the time spent
+/// in it, the entries it processed and the bytes read. See GetProfileReport() to retrieve the profile. Timing every
+/// node at every entry slows down the event loop noticeably for cheap expressions, so profiling is off by default.
+///
+/// Setting `RDataFrame.Profile` to a file name in the ROOT configuration profiles all event loops and writes the
+/// profile of each one to that file in the Chrome trace format.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("Events", "file.root");
+/// df.EnableProfiling();
+/// auto h = df.Filter("nMuon > 1").Define("pt", "Muon_pt[0]").Histo1D("pt");
+/// h->Draw();
+/// std::ofstream out("trace.json");
+/// df.GetProfileReport().WriteChromeTrace(out);
+/// ~~~
+void ROOT::RDF::RInterfaceBase::EnableProfiling(bool enable)
+{
+   fLoopManager->SetProfiling(enable);
+}
+
+/// \brief Allocate the RVecs returned by Define expressions from per-slot arenas in the following event loops
+/// (experimental).
+/// \param[in] enable Whether to use the arenas.
+///
+/// The buffers of the RVecs of trivially copyable elements (e.g. RVecF, RVecI) built by Define expressions which
+/// outgrow their inline storage are then taken from a per-slot memory arena, which is reset after each entry (or block
+/// of entries, see SetBlockSize()) is processed. This replaces a malloc and free pair per temporary RVec by a pointer
+/// increment, which pays off in Define-heavy graphs with many short-lived collections.
+///
+/// The RVecs defined for an entry must not be used after it was processed: Define expressions must not store them
+/// (or the RVecs created from them in the Define expression) in state that outlives the call, e.g. a member of a
+/// functor or a variable captured by reference. The copies made by actions, e.g. Take, are not affected.
+///
+/// Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("Events", "file.root");
+/// df.EnableRVecArena();
+/// auto h = df.Define("goodPt", "Muon_pt[Muon_pt > 20]").Histo1D("goodPt");
+/// ~~~
+void ROOT::RDF::RInterfaceBase::EnableRVecArena(bool enable)
+{
+   fLoopManager->SetRVecArena(enable);
+}
+
+/// \brief Return the profile of the last event loop that ran with profiling enabled (experimental).
+/// The profile is empty if no event loop was profiled. See EnableProfiling().
+const ROOT::RDF::Experimental::RProfileReport &ROOT::RDF::RInterfaceBase::GetProfileReport() const
+{
+   return fLoopManager->GetProfileReport();
+}
+
 ROOT::RDF::ColumnNames_t ROOT::RDF::RInterfaceBase::GetColumnTypeNamesList(const ColumnNames_t &columnList)
 {
    std::vector<std::string> types;
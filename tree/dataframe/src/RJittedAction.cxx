@@ -73,6 +73,18 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBlock(unsigned int slot, Long64_t firstEntry, std::size_t n)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBlock(slot, firstEntry, n);
+}
+
+bool RJittedAction::SupportsBlockExecution() const
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->SupportsBlockExecution();
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
@@ -125,6 +137,18 @@ void RJittedAction::SetHasRun()
    return fConcreteAction->SetHasRun();
 }
 
+void RJittedAction::SetProfiler(RLoopProfiler *profiler, unsigned int id)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->SetProfiler(profiler, id);
+}
+
+std::string RJittedAction::GetActionName()
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
 std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RJittedAction::GetGraph(
    std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap)
 {
@@ -45,6 +45,12 @@ void RJittedDefine::Update(unsigned int slot, Long64_t entry)
    fConcreteDefine->Update(slot, entry);
 }
 
+void *RJittedDefine::UpdateAndGetValuePtr(unsigned int slot, Long64_t entry)
+{
+   assert(fConcreteDefine != nullptr);
+   return fConcreteDefine->UpdateAndGetValuePtr(slot, entry);
+}
+
 void RJittedDefine::Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id)
 {
    assert(fConcreteDefine != nullptr);
@@ -17,8 +17,11 @@
 
 using namespace ROOT::Detail::RDF;
 
-RJittedFilter::RJittedFilter(RLoopManager *lm, std::string_view name, const std::vector<std::string> &variations)
-   : RFilterBase(lm, name, lm->GetNSlots(), RDFInternal::RColumnRegister(nullptr), /*columnNames*/ {}, variations)
+RJittedFilter::RJittedFilter(RLoopManager *lm, std::string_view name, std::string_view expression,
+                             const RNodeBase &prevNode, const RDFInternal::RColumnRegister &colRegister,
+                             const ColumnNames_t &columns, const std::vector<std::string> &variations)
+   : RFilterBase(lm, name, lm->GetNSlots(), colRegister, columns, variations), fExpression(expression),
+     fPrevNode(&prevNode)
 {
    // Jitted nodes of the computation graph (e.g. RJittedAction, RJittedDefine) usually don't need to register
    // themselves with the RLoopManager: the _concrete_ nodes will be registered with the RLoopManager right before
@@ -59,6 +62,13 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const ROOT::Internal::RDF::RMaskedEntryRange &
+RJittedFilter::CheckFiltersBlock(unsigned int slot, Long64_t firstEntry, std::size_t n)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBlock(slot, firstEntry, n);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
@@ -23,6 +23,7 @@
 #include "TBranchObject.h"
 #include "TChain.h"
 #include "TEntryList.h"
+#include "TEnv.h"
 #include "TFile.h"
 #include "TFriendElement.h"
 #include "TROOT.h" // IsImplicitMTEnabled
@@ -38,6 +39,8 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -46,6 +49,7 @@
 #include <sstream>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <set>
 #include <limits> // For MaxTreeSizeRAII. Revert when #6640 will be solved.
@@ -346,21 +350,24 @@ RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
      fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBlockStates(fNSlots), fBlockMasks(fNSlots), fBlockColumnReaders(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
    : fNEmptyEntries(nEmptyEntries), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles), fNewSampleNotifier(fNSlots),
-     fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBlockStates(fNSlots), fBlockMasks(fNSlots), fBlockColumnReaders(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
    : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
-     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBlockStates(fNSlots), fBlockMasks(fNSlots), fBlockColumnReaders(fNSlots)
 {
    fDataSource->SetNSlots(fNSlots);
 }
@@ -368,7 +375,8 @@ RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t
 RLoopManager::RLoopManager(ROOT::RDF::Experimental::RDatasetSpec &&spec)
    : fBeginEntry(spec.GetEntryRangeBegin()), fEndEntry(spec.GetEntryRangeEnd()), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBlockStates(fNSlots), fBlockMasks(fNSlots), fBlockColumnReaders(fNSlots)
 {
    const auto &treeNames = spec.GetTreeNames();
    const auto &fileNameGlobs = spec.GetFileNameGlobs();
@@ -454,16 +462,22 @@ void RLoopManager::RunEmptySourceMT()
       RCallCleanUpTask cleanup(*this, slot);
       InitNodeSlots(nullptr, slot);
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
+      TStopwatch taskTime;
       try {
          UpdateSampleInfo(slot, range);
          for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+            if (fUseBlockExecution)
+               PushEntryToBlock(slot, currEntry);
+            else
+               RunAndCheckFilters(slot, currEntry);
          }
+         FlushBlock(slot);
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
       }
+      AddTaskTime(slot, range.second - range.first, taskTime.RealTime());
    };
 
    ROOT::TThreadExecutor pool;
@@ -481,8 +495,12 @@ void RLoopManager::RunEmptySource()
    try {
       UpdateSampleInfo(/*slot*/0, {0, fNEmptyEntries});
       for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+         if (fUseBlockExecution)
+            PushEntryToBlock(0, currEntry);
+         else
+            RunAndCheckFilters(0, currEntry);
       }
+      FlushBlock(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -512,14 +530,21 @@ void RLoopManager::RunTreeProcessorMT()
       const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
       const auto nEntries = entryRange.second - entryRange.first;
       auto count = entryCount.fetch_add(nEntries);
+      TStopwatch taskTime;
       try {
          // recursive call to check filters and conditionally execute actions
          while (r.Next()) {
             if (fNewSampleNotifier.CheckFlag(slot)) {
+               // the entries accumulated so far belong to the previous tree
+               FlushBlock(slot);
                UpdateSampleInfo(slot, r);
             }
-            RunAndCheckFilters(slot, count++);
+            if (fUseBlockExecution)
+               PushEntryToBlock(slot, count++);
+            else
+               RunAndCheckFilters(slot, count++);
          }
+         FlushBlock(slot);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -531,6 +556,7 @@ void RLoopManager::RunTreeProcessorMT()
          throw std::runtime_error("An error was encountered while processing the data. TTreeReader status code is: " +
                                   std::to_string(r.GetEntryStatus()));
       }
+      AddTaskTime(slot, nEntries, taskTime.RealTime());
    });
 #endif // no-op otherwise (will not be called)
 }
@@ -557,10 +583,16 @@ void RLoopManager::RunTreeReader()
    try {
       while (r.Next() && fNStopsReceived < fNChildren) {
          if (fNewSampleNotifier.CheckFlag(0)) {
+            // the entries accumulated so far belong to the previous tree
+            FlushBlock(0);
             UpdateSampleInfo(/*slot*/0, r);
          }
-         RunAndCheckFilters(0, r.GetCurrentEntry());
+         if (fUseBlockExecution)
+            PushEntryToBlock(0, r.GetCurrentEntry());
+         else
+            RunAndCheckFilters(0, r.GetCurrentEntry());
       }
+      FlushBlock(0);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -589,10 +621,14 @@ void RLoopManager::RunDataSource()
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
                if (fDataSource->SetEntry(0u, entry)) {
-                  RunAndCheckFilters(0u, entry);
+                  if (fUseBlockExecution)
+                     PushEntryToBlock(0u, entry);
+                  else
+                     RunAndCheckFilters(0u, entry);
                }
             }
          }
+         FlushBlock(0u);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -621,22 +657,37 @@ void RLoopManager::RunDataSourceMT()
       const auto start = range.first;
       const auto end = range.second;
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
+      TStopwatch taskTime;
       try {
          for (auto entry = start; entry < end; ++entry) {
             if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+               if (fUseBlockExecution)
+                  PushEntryToBlock(slot, entry);
+               else
+                  RunAndCheckFilters(slot, entry);
             }
          }
+         FlushBlock(slot);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
       }
       fDataSource->CallFinalizeSlot(slot);
+      AddTaskTime(slot, end - start, taskTime.RealTime());
+   };
+
+   // Start from the largest ranges, so that the small ones fill the gaps at the end instead of a large one being
+   // processed alone by a single worker.
+   auto sortBySize = [](std::vector<std::pair<ULong64_t, ULong64_t>> &ranges) {
+      std::stable_sort(ranges.begin(), ranges.end(), [](const auto &a, const auto &b) {
+         return a.second - a.first > b.second - b.first;
+      });
    };
 
    fDataSource->CallInitialize();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty()) {
+      sortBySize(ranges);
       pool.Foreach(runOnRange, ranges);
       ranges = fDataSource->GetEntryRanges();
    }
@@ -661,6 +712,107 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       namedFilterPtr->CheckFilters(slot, entry);
    for (auto &callback : fCallbacks)
       callback(slot);
+
+   // the RVecs defined for this entry (if any) are not used anymore
+   if (!fRVecArenas.empty())
+      fRVecArenas[slot]->Reset();
+}
+
+/// Block execution mode counterpart of RunAndCheckFilters: process the n consecutive entries starting at firstEntry.
+/// Every node evaluates its filter or expression for the whole block before the next node runs.
+void RLoopManager::RunAndCheckFiltersBlock(unsigned int slot, Long64_t firstEntry, std::size_t n)
+{
+   for (auto &actionPtr : fBookedActions)
+      actionPtr->RunBlock(slot, firstEntry, n);
+   for (auto &namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBlock(slot, firstEntry, n);
+   for (std::size_t i = 0; i < n; ++i)
+      for (auto &callback : fCallbacks)
+         callback(slot);
+}
+
+/// Add an entry to the block of this slot, copying the values of the dataset columns, and process the block when it
+/// is full. A block only contains consecutive entries of the same sample.
+void RLoopManager::PushEntryToBlock(unsigned int slot, Long64_t entry)
+{
+   auto &block = fBlockStates[slot];
+   if (block.fSize > 0 && entry != block.fFirstEntry + static_cast<Long64_t>(block.fSize))
+      FlushBlock(slot);
+
+   if (block.fSize == 0) {
+      block.fFirstEntry = entry;
+      block.fNewSample = fNewSampleNotifier.CheckFlag(slot);
+      fNewSampleNotifier.UnsetFlag(slot);
+   }
+   for (auto *reader : block.fReaders)
+      reader->Fill(block.fSize, entry);
+   ++block.fSize;
+
+   if (block.fSize >= block.fCapacity)
+      FlushBlock(slot);
+}
+
+/// Process the entries accumulated in the block of this slot, if any.
+void RLoopManager::FlushBlock(unsigned int slot)
+{
+   auto &block = fBlockStates[slot];
+   if (block.fSize == 0)
+      return;
+
+   // data-block callbacks run before the rest of the graph
+   if (block.fNewSample) {
+      for (auto &callback : fSampleCallbacks)
+         callback.second(slot, fSampleInfos[slot]);
+      block.fNewSample = false;
+   }
+
+   const auto n = block.fSize;
+   block.fSize = 0;
+   RunAndCheckFiltersBlock(slot, block.fFirstEntry, n);
+
+   // the RVecs defined for the entries of this block (if any) are not used anymore
+   if (!fRVecArenas.empty())
+      fRVecArenas[slot]->Reset();
+}
+
+/// Record the processing time of a task of a multi-thread event loop. Thread-safe.
+void RLoopManager::AddTaskTime(unsigned int slot, ULong64_t nEntries, double seconds)
+{
+   R__LOG_DEBUG(0, RDFLogChannel()) << "Task on slot " << slot << " processed " << nEntries << " entries in "
+                                    << seconds << "s.";
+   std::lock_guard<std::mutex> lock(fTaskTimesMutex);
+   fTaskTimes.push_back({slot, nEntries, seconds});
+}
+
+/// Log a summary of the task times of the last multi-thread event loop and clear them.
+/// The imbalance is the ratio between the busiest slot's processing time and the average over slots: values much
+/// larger than 1 mean that most workers sat idle while a few finished their tasks.
+void RLoopManager::ReportTaskTimes()
+{
+   if (fTaskTimes.empty())
+      return;
+
+   std::vector<double> slotTimes(fNSlots, 0.);
+   double minTime = fTaskTimes[0].fSeconds;
+   double maxTime = 0.;
+   double totTime = 0.;
+   ULong64_t maxTaskEntries = 0ull;
+   for (const auto &t : fTaskTimes) {
+      slotTimes[t.fSlot] += t.fSeconds;
+      minTime = std::min(minTime, t.fSeconds);
+      maxTime = std::max(maxTime, t.fSeconds);
+      totTime += t.fSeconds;
+      maxTaskEntries = std::max(maxTaskEntries, t.fNEntries);
+   }
+   const double maxSlotTime = *std::max_element(slotTimes.begin(), slotTimes.end());
+   const double meanSlotTime = totTime / fNSlots;
+
+   R__LOG_INFO(RDFLogChannel()) << "Processed " << fTaskTimes.size() << " tasks in " << fNSlots
+                                << " slots. Task time min/mean/max: " << minTime << "/" << totTime / fTaskTimes.size()
+                                << "/" << maxTime << "s, largest task: " << maxTaskEntries
+                                << " entries, slot imbalance (max/mean busy time): "
+                                << (meanSlotTime > 0. ? maxSlotTime / meanSlotTime : 1.) << '.';
+   fTaskTimes.clear();
 }
 
 /// Build TTreeReaderValues for all nodes
@@ -668,18 +820,28 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   if (fProfiler)
+      fProfiler->BeginTask(slot);
+
+   // the block readers of this slot register themselves while the nodes create their column readers
+   fBlockStates[slot] = RBlockState{};
+   fBlockStates[slot].fCapacity = fBlockSize;
+
    SetupSampleCallbacks(r, slot);
    for (auto &ptr : fBookedActions)
       ptr->InitSlot(r, slot);
-   for (auto &ptr : fBookedFilters)
+   for (auto &ptr : fFiltersToInit)
       ptr->InitSlot(r, slot);
-   for (auto &ptr : fBookedDefines)
+   for (auto &ptr : fDefinesToInit)
       ptr->InitSlot(r, slot);
    for (auto &ptr : fBookedVariations)
       ptr->InitSlot(r, slot);
 
    for (auto &callback : fCallbacksOnce)
       callback(slot);
+
+   if (fProfiler)
+      fProfiler->EndTaskInit(slot);
 }
 
 void RLoopManager::SetupSampleCallbacks(TTreeReader *r, unsigned int slot) {
@@ -726,12 +888,79 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
 void RLoopManager::InitNodes()
 {
    EvalChildrenCounts();
+   OptimizeGraph();
+
+   // Ranges stop the event loop at a given entry and Vary'ed nodes are not aware of blocks: the few actions that need
+   // stable addresses for their input values (e.g. Snapshot) also require processing one entry at a time.
+   fUseBlockExecution = fBlockSize > 1 && fBookedRanges.empty() && fBookedVariations.empty() &&
+                        std::all_of(fBookedActions.begin(), fBookedActions.end(),
+                                    [](RDFInternal::RActionBase *a) { return a->SupportsBlockExecution(); });
+
+   if (!fUseRVecArena) {
+      fRVecArenas.clear();
+   } else if (fRVecArenas.empty()) {
+      for (unsigned int slot = 0; slot < fNSlots; ++slot)
+         fRVecArenas.emplace_back(new ROOT::Internal::VecOps::RVecArena());
+   }
+
    for (auto &filter : fBookedFilters)
       filter->InitNode();
    for (auto &range : fBookedRanges)
       range->InitNode();
    for (auto &ptr : fBookedActions)
       ptr->Initialize();
+
+   SetupProfiler();
+}
+
+/// Register the nodes that take part in the event loop with the profiler, if the event loop is profiled, so that they
+/// time their work. Nodes of previous event loops stop timing theirs.
+void RLoopManager::SetupProfiler()
+{
+   auto *profiler = fProfiler.get();
+   for (auto *filter : fBookedFilters)
+      filter->SetProfiler(nullptr, 0u);
+   for (auto *define : fBookedDefines)
+      define->SetProfiler(nullptr, 0u);
+   for (auto *action : fBookedActions)
+      action->SetProfiler(nullptr, 0u);
+   if (profiler == nullptr)
+      return;
+
+   using ENodeKind = RDFInternal::RLoopProfiler::ENodeKind;
+   for (auto *filter : fFiltersToInit)
+      filter->SetProfiler(profiler, profiler->AddNode(filter->HasName() ? filter->GetName() : "Unnamed Filter",
+                                                      ENodeKind::kFilter));
+   for (auto *define : fDefinesToInit)
+      define->SetProfiler(profiler, profiler->AddNode(define->GetName(), ENodeKind::kDefine));
+   for (auto *action : fBookedActions)
+      action->SetProfiler(profiler, profiler->AddNode(action->GetActionName(), ENodeKind::kAction));
+}
+
+/// Store the profile of the event loop that just finished, log its slowest nodes and write it to the trace file, if
+/// any.
+void RLoopManager::ReportProfile(const std::string &traceFile)
+{
+   fProfileReport = fProfiler->MakeReport();
+
+   std::vector<const ROOT::RDF::Experimental::RProfileReport::RNode *> nodes;
+   for (const auto &node : fProfileReport.GetNodes())
+      nodes.push_back(&node);
+   std::sort(nodes.begin(), nodes.end(), [](const auto *a, const auto *b) { return a->GetTime() > b->GetTime(); });
+   std::string slowest;
+   for (std::size_t i = 0; i < std::min<std::size_t>(nodes.size(), 3u); ++i)
+      slowest += (i > 0 ? ", " : "") + nodes[i]->fKind + " " + nodes[i]->fName + " (" +
+                 std::to_string(nodes[i]->GetTime()) + "s)";
+   R__LOG_INFO(RDFLogChannel()) << "Profiled " << nodes.size() << " nodes, slowest: " << slowest << '.';
+
+   if (traceFile.empty())
+      return;
+   std::ofstream out(traceFile);
+   if (!out) {
+      R__LOG_ERROR(RDFLogChannel()) << "Cannot write the profile of the event loop to " << traceFile << '.';
+      return;
+   }
+   fProfileReport.WriteChromeTrace(out);
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -766,9 +995,9 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
       fNewSampleNotifier.GetChainNotifyLink(slot).RemoveLink(*r->GetTree());
    for (auto &ptr : fBookedActions)
       ptr->FinalizeSlot(slot);
-   for (auto &ptr : fBookedFilters)
+   for (auto &ptr : fFiltersToInit)
       ptr->FinalizeSlot(slot);
-   for (auto &ptr : fBookedDefines)
+   for (auto &ptr : fDefinesToInit)
       ptr->FinalizeSlot(slot);
 
    if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT) {
@@ -777,6 +1006,11 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
       for (auto &v : fDatasetColumnReaders[slot])
          v.second.reset();
    }
+   fBlockColumnReaders[slot].clear();
+   fBlockStates[slot].fReaders.clear();
+
+   if (fProfiler)
+      fProfiler->EndTask(slot);
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
@@ -794,11 +1028,16 @@ void RLoopManager::Jit()
 
    TStopwatch s;
    s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   // with a persistent jit cache, a previous process might have compiled this very code already
+   const bool fromCache = RDFInternal::RunCachedJitCode(code);
+   if (!fromCache)
+      RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
    s.Stop();
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
                                                         : " in less than 1ms.");
+   if (!fromCache)
+      RDFInternal::AddToJitCache(code);
 }
 
 /// Trigger counting of number of children nodes for each node of the functional graph.
@@ -815,6 +1054,154 @@ void RLoopManager::EvalChildrenCounts()
       namedFilterPtr->TriggerChildrenCount();
 }
 
+/// Decide which filters and defines take part in the event loop. This is done once before starting the event loop,
+/// after the children counts have been evaluated.
+///
+/// Filters that no action and no named filter depends on are never evaluated, and neither are the defines that are only
+/// read by them or by nobody: their per-slot initialization (e.g. the creation of the column readers) is skipped.
+///
+/// If `RDataFrame.MergeEquivalentNodes` is set in the ROOT configuration, defines and unnamed filters that evaluate the
+/// same expression on the same inputs (and, for filters, downstream of the same node) are merged: all but the first
+/// forward to the first one, so that the expression is evaluated once per entry. Since an expression is only known to
+/// be the same if it is the same free function, in practice this applies to identical jitted expressions booked in
+/// different branches of the computation graph. It is opt-in as expressions with side effects or that draw random
+/// numbers would be evaluated once instead of once per node.
+void RLoopManager::OptimizeGraph()
+{
+   for (auto *filter : fBookedFilters)
+      filter->SetEquivalentFilter(nullptr);
+   for (auto *define : fBookedDefines)
+      define->SetEquivalentDefine(nullptr);
+   fFiltersToInit.clear();
+   fDefinesToInit.clear();
+
+   // Varied nodes are created and wired up at booking time, in ways that do not show in the column registers
+   if (!fBookedVariations.empty()) {
+      fFiltersToInit = fBookedFilters;
+      fDefinesToInit = fBookedDefines;
+      return;
+   }
+
+   std::unordered_set<RDefineBase *> usedDefines;
+   std::vector<RDefineBase *> toVisit;
+   auto markUsed = [&](const ColumnNames_t &columns, const RDFInternal::RColumnRegister &colRegister) {
+      for (const auto &column : columns) {
+         auto *define = colRegister.GetDefine(colRegister.ResolveAlias(column));
+         if (define != nullptr && (define = define->GetConcreteDefine()) != nullptr && usedDefines.insert(define).second)
+            toVisit.emplace_back(define);
+      }
+   };
+
+   for (auto *action : fBookedActions)
+      markUsed(action->GetColumnNames(), action->GetColRegister());
+   for (auto *filter : fBookedFilters) {
+      // a RJittedFilter forwards everything to its concrete filter, which is booked as well
+      if (filter->GetConcreteFilter() == filter && (filter->GetNChildren() > 0 || filter->HasName())) {
+         fFiltersToInit.emplace_back(filter);
+         markUsed(filter->GetColumnNames(), filter->GetColRegister());
+      }
+   }
+   while (!toVisit.empty()) {
+      auto *define = toVisit.back();
+      toVisit.pop_back();
+      markUsed(define->GetColumnNames(), define->GetColRegister());
+   }
+   for (auto *define : fBookedDefines)
+      if (usedDefines.count(define) > 0)
+         fDefinesToInit.emplace_back(define);
+
+   if (gEnv->GetValue("RDataFrame.MergeEquivalentNodes", 0) == 0)
+      return;
+
+   auto toString = [](const void *ptr) { return std::to_string(reinterpret_cast<std::uintptr_t>(ptr)); };
+
+   // Defines are keyed by type, expression and (deduplicated) inputs. Inputs are resolved on demand, as a define might
+   // be booked before the concrete define of a jitted column it reads.
+   std::unordered_map<RDefineBase *, RDefineBase *> canonicalDefines;
+   std::unordered_map<std::string, RDefineBase *> definesByKey;
+   std::function<RDefineBase *(RDefineBase *)> getCanonicalDefine = [&](RDefineBase *define) -> RDefineBase * {
+      const auto it = canonicalDefines.find(define);
+      if (it != canonicalDefines.end())
+         return it->second;
+      RDefineBase *canonical = define;
+      if (define->GetExpressionId() != nullptr && define->GetVariations().empty() &&
+          define->GetVariationName() == "nominal") {
+         std::string key = std::string(typeid(*define).name()) + '|' + toString(define->GetExpressionId());
+         const auto &colRegister = define->GetColRegister();
+         for (const auto &column : define->GetColumnNames()) {
+            const auto name = colRegister.ResolveAlias(column);
+            auto *input = colRegister.GetDefine(name);
+            if (input != nullptr)
+               input = input->GetConcreteDefine();
+            key += '|' + (input != nullptr ? toString(getCanonicalDefine(input)) : "c:" + name);
+         }
+         canonical = definesByKey.emplace(key, define).first->second;
+      }
+      canonicalDefines[define] = canonical;
+      return canonical;
+   };
+
+   // Same for unnamed filters, which are also keyed by the upstream node
+   std::unordered_map<const RNodeBase *, RFilterBase *> bookedFilters;
+   for (auto *filter : fBookedFilters)
+      bookedFilters[filter] = filter;
+   std::unordered_map<const RNodeBase *, RFilterBase *> canonicalFilters;
+   std::unordered_map<std::string, RFilterBase *> filtersByKey;
+   std::function<const RNodeBase *(const RNodeBase *)> getCanonicalNode;
+   getCanonicalNode = [&](const RNodeBase *node) -> const RNodeBase * {
+      const auto bookedIt = bookedFilters.find(node);
+      if (bookedIt == bookedFilters.end())
+         return node; // the RLoopManager itself or a range
+      const auto it = canonicalFilters.find(node);
+      if (it != canonicalFilters.end())
+         return it->second;
+      RFilterBase *filter = bookedIt->second;
+      RFilterBase *canonical = filter;
+      if (filter->GetConcreteFilter() != filter) {
+         if (filter->GetConcreteFilter() != nullptr)
+            canonical = bookedFilters.at(getCanonicalNode(filter->GetConcreteFilter()));
+      } else if (!filter->HasName() && filter->GetExpressionId() != nullptr && filter->GetPrevNode() != nullptr &&
+                 filter->GetVariationName() == "nominal") {
+         std::string key = std::string(typeid(*filter).name()) + '|' + toString(filter->GetExpressionId()) + '|' +
+                           toString(getCanonicalNode(filter->GetPrevNode()));
+         const auto &colRegister = filter->GetColRegister();
+         for (const auto &column : filter->GetColumnNames()) {
+            const auto name = colRegister.ResolveAlias(column);
+            auto *input = colRegister.GetDefine(name);
+            if (input != nullptr)
+               input = input->GetConcreteDefine();
+            key += '|' + (input != nullptr ? toString(getCanonicalDefine(input)) : "c:" + name);
+         }
+         canonical = filtersByKey.emplace(key, filter).first->second;
+      }
+      canonicalFilters[node] = canonical;
+      return canonical;
+   };
+
+   const auto nDefines = fDefinesToInit.size();
+   const auto nFilters = fFiltersToInit.size();
+   auto isMerged = [&](RDefineBase *define) {
+      auto *canonical = getCanonicalDefine(define);
+      if (canonical == define)
+         return false;
+      define->SetEquivalentDefine(canonical);
+      return true;
+   };
+   fDefinesToInit.erase(std::remove_if(fDefinesToInit.begin(), fDefinesToInit.end(), isMerged), fDefinesToInit.end());
+   auto isMergedFilter = [&](RFilterBase *filter) {
+      auto *canonical = bookedFilters.at(getCanonicalNode(filter));
+      if (canonical == filter)
+         return false;
+      filter->SetEquivalentFilter(canonical);
+      return true;
+   };
+   fFiltersToInit.erase(std::remove_if(fFiltersToInit.begin(), fFiltersToInit.end(), isMergedFilter),
+                        fFiltersToInit.end());
+
+   R__LOG_INFO(RDFLogChannel()) << "Merged " << nDefines - fDefinesToInit.size() << " Define and "
+                                << nFilters - fFiltersToInit.size() << " Filter nodes into equivalent ones.";
+}
+
 /// Start the event loop with a different mechanism depending on IMT/no IMT, data source/no data source.
 /// Also perform a few setup and clean-up operations (jit actions if necessary, clear booked actions after the loop...).
 /// The jitting phase is skipped if the `jit` parameter is `false` (unsafe, use with care).
@@ -827,24 +1214,45 @@ void RLoopManager::Run(bool jit)
 
    ThrowIfNSlotsChanged(GetNSlots());
 
-   if (jit)
+   const std::string traceFile = gEnv->GetValue("RDataFrame.Profile", "");
+   if (fProfilingEnabled || !traceFile.empty())
+      fProfiler = std::make_unique<RDFInternal::RLoopProfiler>(fNSlots);
+   else
+      fProfiler.reset();
+
+   if (jit) {
+      RDFInternal::RProfilePhase phase(fProfiler.get(), "Jit");
       Jit();
+   }
 
-   InitNodes();
+   {
+      RDFInternal::RProfilePhase phase(fProfiler.get(), "InitNodes");
+      InitNodes();
+   }
 
    TStopwatch s;
    s.Start();
-   switch (fLoopType) {
-   case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
-   case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
-   case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
-   case ELoopType::kNoFiles: RunEmptySource(); break;
-   case ELoopType::kROOTFiles: RunTreeReader(); break;
-   case ELoopType::kDataSource: RunDataSource(); break;
+   {
+      RDFInternal::RProfilePhase phase(fProfiler.get(), "EventLoop");
+      switch (fLoopType) {
+      case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
+      case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
+      case ELoopType::kDataSourceMT: RunDataSourceMT(); break;
+      case ELoopType::kNoFiles: RunEmptySource(); break;
+      case ELoopType::kROOTFiles: RunTreeReader(); break;
+      case ELoopType::kDataSource: RunDataSource(); break;
+      }
    }
    s.Stop();
+   ReportTaskTimes();
+
+   {
+      RDFInternal::RProfilePhase phase(fProfiler.get(), "Finalize");
+      CleanUpNodes();
+   }
 
-   CleanUpNodes();
+   if (fProfiler)
+      ReportProfile(traceFile);
 
    fNRuns++;
 
@@ -928,6 +1336,15 @@ bool RLoopManager::CheckFilters(unsigned int, Long64_t)
    return true;
 }
 
+const RDFInternal::RMaskedEntryRange &
+RLoopManager::CheckFiltersBlock(unsigned int slot, Long64_t firstEntry, std::size_t n)
+{
+   auto &mask = fBlockMasks[slot];
+   if (!mask.Holds(firstEntry, n))
+      mask.Reset(firstEntry, n, true);
+   return mask;
+}
+
 /// Call `FillReport` on all booked filters
 void RLoopManager::Report(ROOT::RDF::RCutFlowReport &rep) const
 {
@@ -1043,7 +1460,7 @@ void RLoopManager::AddDataSourceColumnReaders(const std::string &col,
 // Differently from AddDataSourceColumnReaders, this can be called from multiple threads concurrently
 /// \brief Register a new RTreeColumnReader with this RLoopManager.
 /// \return A shared pointer to the inserted column reader.
-RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const std::string &col,
+RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, TTreeReader &r, const std::string &col,
                                                      std::unique_ptr<RColumnReaderBase> &&reader,
                                                      const std::type_info &ti)
 {
@@ -1051,6 +1468,8 @@ RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const st
    const auto key = MakeDatasetColReadersKey(col, ti);
    // if a reader for this column and this slot was already there, we are doing something wrong
    assert(readers.find(key) == readers.end() || readers[key] == nullptr);
+   if (fProfiler)
+      reader = fProfiler->MakeProfiledReader(slot, r, col, std::move(reader));
    auto *rptr = reader.get();
    readers[key] = std::move(reader);
    return rptr;
@@ -1067,6 +1486,47 @@ RLoopManager::GetDatasetColumnReader(unsigned int slot, const std::string &col,
       return nullptr;
 }
 
+/// \brief Register the block reader wrapping a dataset column reader of this slot.
+/// \return A non-owning pointer to the inserted column reader.
+RColumnReaderBase *RLoopManager::AddBlockColumnReader(unsigned int slot, const std::string &col,
+                                                      std::unique_ptr<RDFInternal::RBlockColumnReaderBase> &&reader,
+                                                      const std::type_info &ti)
+{
+   auto &readers = fBlockColumnReaders[slot];
+   const auto key = MakeDatasetColReadersKey(col, ti);
+   assert(readers.find(key) == readers.end());
+   auto *rptr = reader.get();
+   fBlockStates[slot].fReaders.emplace_back(rptr);
+   readers[key] = std::move(reader);
+   return rptr;
+}
+
+RColumnReaderBase *
+RLoopManager::GetBlockColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const
+{
+   const auto key = MakeDatasetColReadersKey(col, ti);
+   auto it = fBlockColumnReaders[slot].find(key);
+   if (it != fBlockColumnReaders[slot].end())
+      return it->second.get();
+   else
+      return nullptr;
+}
+
+/// \brief Set the maximum number of entries processed together in block execution mode.
+/// With blockSize larger than 1, the following event loops accumulate up to blockSize consecutive entries per
+/// processing slot and run each node of the computation graph over the whole block. 0 or 1 disable block execution.
+void RLoopManager::SetBlockSize(unsigned int blockSize)
+{
+   fBlockSize = blockSize;
+}
+
+/// Process the current task of this slot one entry at a time, e.g. because a column type cannot be cached in a block.
+/// Nodes keep their block bookkeeping, which simply sees blocks of one entry.
+void RLoopManager::DisableBlockExecution(unsigned int slot)
+{
+   fBlockStates[slot].fCapacity = 1;
+}
+
 void RLoopManager::AddSampleCallback(void *nodePtr, SampleCallback_t &&callback)
 {
    if (callback)
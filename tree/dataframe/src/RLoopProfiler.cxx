@@ -0,0 +1,208 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RLoopProfiler.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "ROOT/RConfig.hxx" // R__WIN32
+#include "TBranch.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+
+#include <algorithm>
+#include <ctime>
+
+#ifdef R__WIN32
+#include "Windows4Root.h"
+#endif
+
+using ROOT::Internal::RDF::RLoopProfiler;
+
+namespace {
+
+/// CPU time used so far by the calling thread, in seconds.
+double GetThreadCpuTime()
+{
+#ifdef R__WIN32
+   FILETIME creation, exit, kernel, user;
+   if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+      return 0.;
+   auto toSeconds = [](const FILETIME &t) {
+      return ((static_cast<ULong64_t>(t.dwHighDateTime) << 32) | t.dwLowDateTime) * 1e-7;
+   };
+   return toSeconds(kernel) + toSeconds(user);
+#else
+   timespec ts;
+   if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+      return 0.;
+   return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+/// CPU time used so far by the process, in seconds.
+double GetProcessCpuTime()
+{
+   return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+}
+
+double ToSeconds(RLoopProfiler::Clock_t::duration d)
+{
+   return std::chrono::duration<double>(d).count();
+}
+
+/// Forwards to the reader of a TTree column, timing the reads and adding up the compressed size of the baskets that
+/// the branch loads.
+class R__CLING_PTRCHECK(off) RProfiledTreeColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fReader;
+   RLoopProfiler &fProfiler;
+   const unsigned int fSlot;
+   const unsigned int fNode;
+   TTreeReader &fTreeReader;
+   const std::string fColName;
+   TBranch *fBranch = nullptr;
+   Int_t fTreeNumber = -1;
+   Int_t fLastBasket = -1;
+   Long64_t fLastEntry = -1;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      ROOT::Internal::RDF::RProfileScope scope(&fProfiler, fSlot, fNode);
+      scope.SetNEntries(entry != fLastEntry ? 1u : 0u);
+      fLastEntry = entry;
+      // the address of the value, the reader does not care about the type it is asked for
+      void *value = &fReader->Get<char>(entry);
+
+      auto *tree = fTreeReader.GetTree();
+      if (tree->GetTreeNumber() != fTreeNumber) {
+         // a new tree of a chain, or the first read
+         fTreeNumber = tree->GetTreeNumber();
+         fBranch = tree->GetBranch(fColName.c_str());
+         fLastBasket = -1;
+      }
+      if (fBranch != nullptr) {
+         const auto basket = fBranch->GetReadBasket();
+         if (basket != fLastBasket && basket >= 0 && basket < fBranch->GetMaxBaskets()) {
+            fLastBasket = basket;
+            fProfiler.AddBytes(fSlot, fNode, fBranch->GetBasketBytes()[basket]);
+         }
+      }
+      return value;
+   }
+
+public:
+   RProfiledTreeColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader, RLoopProfiler &profiler,
+                             unsigned int slot, unsigned int node, TTreeReader &r, const std::string &colName)
+      : fReader(std::move(reader)), fProfiler(profiler), fSlot(slot), fNode(node), fTreeReader(r), fColName(colName)
+   {
+   }
+};
+
+} // anonymous namespace
+
+RLoopProfiler::RLoopProfiler(unsigned int nSlots) : fStart(Clock_t::now()), fSlots(nSlots) {}
+
+void RLoopProfiler::ResizeSlot(RSlotData &slot) const
+{
+   slot.fSelfTimes.resize(fNodes.size(), 0);
+   slot.fEntries.resize(fNodes.size(), 0ull);
+   slot.fBytes.resize(fNodes.size(), 0ull);
+}
+
+unsigned int RLoopProfiler::AddNode(const std::string &name, ENodeKind kind)
+{
+   fNodes.push_back({name, kind});
+   for (auto &slot : fSlots)
+      ResizeSlot(slot);
+   return fNodes.size() - 1;
+}
+
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+RLoopProfiler::MakeProfiledReader(unsigned int slot, TTreeReader &r, const std::string &colName,
+                                  std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader)
+{
+   unsigned int node = 0u;
+   {
+      // the readers of all slots of the same column share one node, which is added by the first slot that reads it
+      std::lock_guard<std::mutex> lock(fNodesMutex);
+      const auto it = std::find_if(fNodes.begin(), fNodes.end(), [&colName](const RNodeInfo &n) {
+         return n.fKind == ENodeKind::kColumn && n.fName == colName;
+      });
+      node = std::distance(fNodes.begin(), it);
+      if (it == fNodes.end())
+         fNodes.push_back({colName, ENodeKind::kColumn});
+      ResizeSlot(fSlots[slot]);
+   }
+   return std::make_unique<RProfiledTreeColumnReader>(std::move(reader), *this, slot, node, r, colName);
+}
+
+void RLoopProfiler::BeginTask(unsigned int slot)
+{
+   auto &s = fSlots[slot];
+   s.fTaskStart = Clock_t::now();
+   s.fTaskInitEnd = s.fTaskStart;
+   s.fTaskCpuStart = GetThreadCpuTime();
+}
+
+void RLoopProfiler::EndTaskInit(unsigned int slot)
+{
+   fSlots[slot].fTaskInitEnd = Clock_t::now();
+}
+
+void RLoopProfiler::EndTask(unsigned int slot)
+{
+   const auto &s = fSlots[slot];
+   const RTask task{slot, s.fTaskStart, Clock_t::now() - s.fTaskStart, s.fTaskInitEnd - s.fTaskStart,
+                    GetThreadCpuTime() - s.fTaskCpuStart};
+   std::lock_guard<std::mutex> lock(fTasksMutex);
+   fTasks.push_back(task);
+}
+
+void RLoopProfiler::BeginPhase(const std::string &name)
+{
+   fPhases.push_back({name, Clock_t::now(), Clock_t::duration::zero(), 0.});
+   fPhaseCpuStart = GetProcessCpuTime();
+}
+
+void RLoopProfiler::EndPhase()
+{
+   auto &phase = fPhases.back();
+   phase.fRealTime = Clock_t::now() - phase.fStart;
+   phase.fCpuTime = GetProcessCpuTime() - fPhaseCpuStart;
+}
+
+ROOT::RDF::Experimental::RProfileReport RLoopProfiler::MakeReport() const
+{
+   using ROOT::RDF::Experimental::RProfileReport;
+
+   std::vector<RProfileReport::RPhase> phases;
+   for (const auto &p : fPhases)
+      phases.push_back({p.fName, ToSeconds(p.fStart - fStart), ToSeconds(p.fRealTime), p.fCpuTime});
+
+   const char *kindNames[] = {"Filter", "Define", "Action", "Column"};
+   std::vector<RProfileReport::RNode> nodes;
+   for (std::size_t i = 0; i < fNodes.size(); ++i) {
+      RProfileReport::RNode node{fNodes[i].fName, kindNames[static_cast<int>(fNodes[i].fKind)], {}};
+      for (const auto &s : fSlots) {
+         RProfileReport::RSlotStats stats;
+         // a slot that never read a column was not resized for it
+         if (i < s.fSelfTimes.size())
+            stats = {ToSeconds(Clock_t::duration(s.fSelfTimes[i])), s.fEntries[i], s.fBytes[i]};
+         node.fSlots.push_back(stats);
+      }
+      nodes.push_back(std::move(node));
+   }
+
+   std::vector<RProfileReport::RTask> tasks;
+   for (const auto &t : fTasks)
+      tasks.push_back(
+         {t.fSlot, ToSeconds(t.fStart - fStart), ToSeconds(t.fRealTime), t.fCpuTime, ToSeconds(t.fInitTime)});
+   std::sort(tasks.begin(), tasks.end(),
+             [](const RProfileReport::RTask &a, const RProfileReport::RTask &b) { return a.fStart < b.fStart; });
+
+   return RProfileReport(std::move(phases), std::move(nodes), std::move(tasks));
+}
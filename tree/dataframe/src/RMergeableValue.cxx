@@ -0,0 +1,50 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RMergeableValue.hxx"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h" // IsImplicitMTEnabled
+#endif
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Merge two lists of type-erased mergeables, element by element.
+/// \param[in,out] OutputMergeables The mergeables where the information will
+///                be aggregated.
+/// \param[in] InputMergeables The mergeables containing the partial results,
+///            in the same order as the outputs.
+/// \throws std::invalid_argument If the lists have different sizes or if any
+///         two corresponding mergeables hold results of different types.
+///
+/// This is meant for distributed RDataFrame, where every task returns the
+/// partial results of all the actions of the computation graph. Compared to
+/// calling MergeValues for every pair of results, the whole lists are merged
+/// in one call and the results of different actions are merged concurrently
+/// if implicit multi-threading is enabled.
+void ROOT::Detail::RDF::MergeValueLists(const std::vector<RMergeableValueBase *> &OutputMergeables,
+                                        const std::vector<const RMergeableValueBase *> &InputMergeables)
+{
+   if (OutputMergeables.size() != InputMergeables.size())
+      throw std::invalid_argument("Lists of results of different size cannot be merged together.");
+
+   auto merge = [&](std::size_t i) { OutputMergeables[i]->MergeAny(*InputMergeables[i]); };
+
+   std::vector<std::size_t> indices(OutputMergeables.size());
+   std::iota(indices.begin(), indices.end(), 0);
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && indices.size() > 1) {
+      ROOT::TThreadExecutor{}.Foreach(merge, indices);
+      return;
+   }
+#endif
+   std::for_each(indices.begin(), indices.end(), merge);
+}
@@ -20,6 +20,7 @@
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RStringView.hxx>
@@ -74,11 +75,17 @@ public:
    // Field is only used for reading
    void GenerateColumnsImpl() final { assert(false && "Cardinality fields must only be used for reading"); }
 
-   void GenerateColumnsImpl(const RNTupleDescriptor &) final
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final
    {
-      RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
-         ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      auto type = EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc);
+      RColumnModel model(type, true /* isSorted*/);
+      if (type == EColumnType::kSplitIndex32) {
+         fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
+            ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(model, 0)));
+      } else {
+         fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
+            ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      }
       fPrincipalColumn = fColumns[0].get();
    }
 
@@ -291,7 +298,8 @@ RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std:
    // TODO(jblomer): check incoming type
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
    auto clone = fColumnReaderPrototypes[index]->Clone();
-   clone->Connect(*fSources[slot]);
+   const bool isLate = std::find(fLateColumns.begin(), fLateColumns.end(), name) != fLateColumns.end();
+   clone->Connect(isLate ? *fLateSources[slot] : *fSources[slot]);
    return clone;
 }
 
@@ -300,6 +308,73 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+void RNTupleDS::SkipClustersOutsideRange(std::string_view colName, double min, double max)
+{
+   fClusterValueRanges.push_back({std::string(colName), min, max});
+}
+
+void RNTupleDS::MaterializeLate(std::string_view colName)
+{
+   if (fNSlots > 0)
+      throw RException(R__FAIL("late materialization must be set before the data source is used by RDataFrame"));
+   if (!HasColumn(colName))
+      throw RException(R__FAIL("cannot materialize unknown column " + std::string(colName) + " late"));
+   if (std::find(fLateColumns.begin(), fLateColumns.end(), colName) == fLateColumns.end())
+      fLateColumns.emplace_back(colName);
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetSelectedClusterRanges()
+{
+   auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+
+   std::vector<DescriptorId_t> columnIds;
+   for (const auto &valueRange : fClusterValueRanges) {
+      auto fieldId = descriptorGuard->GetFieldZeroId();
+      std::string_view name = valueRange.fColumnName;
+      while (fieldId != kInvalidDescriptorId && !name.empty()) {
+         const auto pos = name.find('.');
+         fieldId = descriptorGuard->FindFieldId(name.substr(0, pos), fieldId);
+         name = (pos == std::string_view::npos) ? std::string_view() : name.substr(pos + 1);
+      }
+      const auto columnId = (fieldId == kInvalidDescriptorId) ? kInvalidDescriptorId
+                                                               : descriptorGuard->FindColumnId(fieldId, 0);
+      if (columnId == kInvalidDescriptorId)
+         throw RException(R__FAIL("cannot skip clusters by value of unknown column " + valueRange.fColumnName));
+      columnIds.emplace_back(columnId);
+   }
+
+   std::vector<std::pair<ULong64_t, ULong64_t>> clusterRanges;
+   for (const auto &clusterDesc : descriptorGuard->GetClusterIterable()) {
+      bool isSelected = true;
+      for (std::size_t i = 0; i < columnIds.size(); ++i) {
+         const auto &statistics = clusterDesc.GetColumnRange(columnIds[i]).fStatistics;
+         if (statistics && ((statistics->fMax < fClusterValueRanges[i].fMin) ||
+                            (statistics->fMin > fClusterValueRanges[i].fMax))) {
+            isSelected = false;
+            break;
+         }
+      }
+      if (isSelected) {
+         const auto first = clusterDesc.GetFirstEntryIndex();
+         clusterRanges.emplace_back(first, first + clusterDesc.GetNEntries());
+      }
+   }
+
+   // In single-threaded mode, merge adjacent clusters into a single range; otherwise, each cluster is a separate
+   // task for the slots
+   std::sort(clusterRanges.begin(), clusterRanges.end());
+   if (fNSlots > 1)
+      return clusterRanges;
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   for (const auto &r : clusterRanges) {
+      if (!ranges.empty() && ranges.back().second == r.first)
+         ranges.back().second = r.second;
+      else
+         ranges.emplace_back(r);
+   }
+   return ranges;
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
    // TODO(jblomer): use cluster boundaries for the entry ranges
@@ -307,6 +382,11 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    if (fHasSeenAllRanges)
       return ranges;
 
+   if (!fClusterValueRanges.empty()) {
+      fHasSeenAllRanges = true;
+      return GetSelectedClusterRanges();
+   }
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
@@ -352,6 +432,18 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
       assert(i == (fSources.size() - 1));
       fSources[i]->Attach();
    }
+
+   if (fLateColumns.empty())
+      return;
+   // The late columns are connected to separate page sources that populate pages directly from storage.  With the
+   // cluster cache, any page access would load the complete cluster for all the connected columns.  The column readers
+   // only read entries for which the value is actually requested, i.e. for entries that passed the filters.
+   auto options = fSources[0]->GetReadOptions();
+   options.SetClusterCache(RNTupleReadOptions::EClusterCache::kOff);
+   for (unsigned int i = 0; i < fNSlots; ++i) {
+      fLateSources.emplace_back(fSources[0]->CloneWithOptions(options));
+      fLateSources[i]->Attach();
+   }
 }
 } // namespace Experimental
 } // namespace ROOT
@@ -0,0 +1,220 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RNTupleSnapshotWriter.hxx"
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDF/RSampleInfo.hxx"
+
+#ifdef R__RDF_HAS_RNTUPLE
+#include "ROOT/InternalTreeUtils.hxx" // GetFileNamesFromTree
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleDS.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#endif
+
+#include "Compression.h"
+#include "TString.h"
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+using ROOT::Internal::RDF::RNTupleSnapshotWriter;
+
+#ifdef R__RDF_HAS_RNTUPLE
+
+struct RNTupleSnapshotWriter::RImpl {
+   /// Position of a task in the input dataset: index of the input file and first entry
+   using TaskKey_t = std::pair<std::size_t, ULong64_t>;
+
+   struct RSlot {
+      std::shared_ptr<ROOT::Experimental::RNTupleFillContext> fContext;
+      /// A bare entry that captures the input values, must be destructed before the fill context
+      std::unique_ptr<ROOT::Experimental::REntry> fEntry;
+      TaskKey_t fTaskKey{0u, 0ull};
+      bool fNeedsTaskKey = true;
+   };
+
+   /// A task of an event loop with fPreserveEntryOrder, whose clusters are staged until the end of the event loop
+   struct RFinishedTask {
+      TaskKey_t fKey;
+      std::shared_ptr<ROOT::Experimental::RNTupleFillContext> fContext;
+   };
+
+   const std::string fFileName;
+   const std::string fNTupleName;
+   const std::vector<std::string> fFieldNames;
+   const std::vector<std::string> fTypeNames;
+   const ROOT::RDF::RSnapshotOptions fOptions;
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   std::vector<RSlot> fSlots;
+   std::vector<std::string> fInputFiles; ///< The files of the input TTree or TChain, in order
+   std::mutex fFinishedTasksMutex;
+   std::vector<RFinishedTask> fFinishedTasks;
+
+   RImpl(unsigned int nSlots, std::string_view fileName, std::string_view ntupleName,
+         const std::vector<std::string> &fieldNames, const std::vector<std::string> &typeNames,
+         const ROOT::RDF::RSnapshotOptions &options)
+      : fFileName(fileName), fNTupleName(ntupleName), fFieldNames(fieldNames), fTypeNames(typeNames),
+        fOptions(options), fSlots(nSlots)
+   {
+   }
+
+   void MakeFillContext(RSlot &slot)
+   {
+      slot.fContext = fWriter->CreateFillContext();
+      if (fOptions.fPreserveEntryOrder)
+         slot.fContext->EnableStagedClusterCommitting();
+      slot.fEntry = slot.fContext->GetModel()->CreateBareEntry();
+   }
+
+   TaskKey_t MakeTaskKey(const ROOT::RDF::RSampleInfo &info) const
+   {
+      // samples of a TTree input are called "<filename>/<treename>", other samples are ordered by entry only
+      const auto &id = info.AsString();
+      std::size_t fileIdx = 0u;
+      if (!fInputFiles.empty()) {
+         const auto it = std::find_if(fInputFiles.begin(), fInputFiles.end(), [&id](const std::string &f) {
+            return id.size() > f.size() && id.compare(0, f.size(), f) == 0 && id[f.size()] == '/';
+         });
+         fileIdx = std::distance(fInputFiles.begin(), it);
+      }
+      return {fileIdx, info.EntryRange().first};
+   }
+};
+
+RNTupleSnapshotWriter::RNTupleSnapshotWriter(unsigned int nSlots, std::string_view fileName, std::string_view dirName,
+                                             std::string_view ntupleName, const std::vector<std::string> &fieldNames,
+                                             const std::vector<std::string> &typeNames,
+                                             const ROOT::RDF::RSnapshotOptions &options)
+   : fImpl(std::make_unique<RImpl>(nSlots, fileName, ntupleName, fieldNames, typeNames, options))
+{
+   if (!dirName.empty())
+      throw std::invalid_argument("Snapshot: RNTuple output cannot be written into a sub-directory of the output file");
+   TString mode = options.fMode;
+   mode.ToLower();
+   if (mode != "recreate" && mode != "create" && mode != "new")
+      throw std::invalid_argument("Snapshot: RNTuple output requires a new output file, file mode \"" +
+                                  options.fMode + "\" is not supported");
+   for (std::size_t i = 0; i < typeNames.size(); ++i) {
+      if (typeNames[i].empty())
+         throw std::runtime_error("Snapshot: the type of column \"" + fieldNames[i] +
+                                  "\" is not known to the interpreter, it cannot be written to an RNTuple");
+   }
+}
+
+RNTupleSnapshotWriter::~RNTupleSnapshotWriter() = default;
+
+void RNTupleSnapshotWriter::Initialize(TTree *inputTree)
+{
+   auto model = ROOT::Experimental::RNTupleModel::Create();
+   for (std::size_t i = 0; i < fImpl->fFieldNames.size(); ++i) {
+      auto field = ROOT::Experimental::Detail::RFieldBase::Create(fImpl->fFieldNames[i], fImpl->fTypeNames[i]);
+      model->AddField(field.Unwrap());
+   }
+
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(
+      ROOT::CompressionSettings(fImpl->fOptions.fCompressionAlgorithm, fImpl->fOptions.fCompressionLevel));
+   fImpl->fWriter = ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), fImpl->fNTupleName,
+                                                                         fImpl->fFileName, writeOptions);
+
+   fImpl->fInputFiles.clear();
+   if (inputTree != nullptr)
+      fImpl->fInputFiles = ROOT::Internal::TreeUtils::GetFileNamesFromTree(*inputTree);
+}
+
+void RNTupleSnapshotWriter::InitTask(unsigned int slotIdx)
+{
+   auto &slot = fImpl->fSlots[slotIdx];
+   // without ordering, a slot keeps filling the same context across tasks; with ordering, a task is a sequence of
+   // consecutive input entries and gets its own context
+   if (!slot.fContext)
+      fImpl->MakeFillContext(slot);
+   slot.fNeedsTaskKey = true;
+}
+
+void RNTupleSnapshotWriter::UpdateSampleInfo(unsigned int slotIdx, const ROOT::RDF::RSampleInfo &info)
+{
+   auto &slot = fImpl->fSlots[slotIdx];
+   if (slot.fNeedsTaskKey) {
+      slot.fTaskKey = fImpl->MakeTaskKey(info);
+      slot.fNeedsTaskKey = false;
+   }
+}
+
+void RNTupleSnapshotWriter::Fill(unsigned int slotIdx, void *const *values)
+{
+   auto &slot = fImpl->fSlots[slotIdx];
+   std::size_t i = 0;
+   for (auto &value : *slot.fEntry)
+      value = value.GetField()->CaptureValue(values[i++]);
+   slot.fContext->Fill(*slot.fEntry);
+}
+
+void RNTupleSnapshotWriter::FinalizeTask(unsigned int slotIdx)
+{
+   if (!fImpl->fOptions.fPreserveEntryOrder)
+      return;
+
+   auto &slot = fImpl->fSlots[slotIdx];
+   if (slot.fContext->GetNEntries() > 0) {
+      // stage the last cluster of the task; the context is kept alive (and cannot be reused) until Finalize()
+      slot.fContext->CommitCluster();
+      std::lock_guard<std::mutex> lock(fImpl->fFinishedTasksMutex);
+      fImpl->fFinishedTasks.push_back({slot.fTaskKey, slot.fContext});
+   }
+   slot.fEntry.reset();
+   slot.fContext.reset();
+}
+
+void RNTupleSnapshotWriter::Finalize(ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void> &output)
+{
+   auto &finished = fImpl->fFinishedTasks;
+   std::stable_sort(finished.begin(), finished.end(),
+                    [](const RImpl::RFinishedTask &a, const RImpl::RFinishedTask &b) { return a.fKey < b.fKey; });
+   for (auto &task : finished)
+      task.fContext->CommitStagedClusters();
+   finished.clear();
+
+   // fill contexts commit their open cluster on destruction and must be gone before the parallel writer
+   for (auto &slot : fImpl->fSlots) {
+      slot.fEntry.reset();
+      slot.fContext.reset();
+   }
+   fImpl->fWriter.reset();
+
+   output = ROOT::Experimental::MakeNTupleDataFrame(fImpl->fNTupleName, fImpl->fFileName);
+}
+
+#else // R__RDF_HAS_RNTUPLE
+
+struct RNTupleSnapshotWriter::RImpl {
+};
+
+RNTupleSnapshotWriter::RNTupleSnapshotWriter(unsigned int, std::string_view, std::string_view, std::string_view,
+                                             const std::vector<std::string> &, const std::vector<std::string> &,
+                                             const ROOT::RDF::RSnapshotOptions &)
+{
+   throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON");
+}
+
+RNTupleSnapshotWriter::~RNTupleSnapshotWriter() = default;
+
+void RNTupleSnapshotWriter::Initialize(TTree *) {}
+void RNTupleSnapshotWriter::InitTask(unsigned int) {}
+void RNTupleSnapshotWriter::UpdateSampleInfo(unsigned int, const ROOT::RDF::RSampleInfo &) {}
+void RNTupleSnapshotWriter::Fill(unsigned int, void *const *) {}
+void RNTupleSnapshotWriter::FinalizeTask(unsigned int) {}
+void RNTupleSnapshotWriter::Finalize(ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void> &) {}
+
+#endif // R__RDF_HAS_RNTUPLE
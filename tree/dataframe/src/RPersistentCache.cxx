@@ -0,0 +1,251 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RPersistentCache.hxx"
+#include "ROOT/RCacheOptions.hxx"
+#include "ROOT/RDataFrame.hxx"
+
+#ifdef R__RDF_HAS_RNTUPLE
+#include "ROOT/InternalTreeUtils.hxx" // GetFileNamesFromTree, GetFriendInfo
+#include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RJittedDefine.hxx"
+#include "ROOT/RDF/RJittedFilter.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RRangeBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // RDFLogChannel
+#include "ROOT/RLogger.hxx"
+#include "ROOT/RNTupleDS.hxx"
+#include "RVersion.h" // ROOT_RELEASE
+#include "TEnv.h"
+#include "TMD5.h"
+#include "TString.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include <typeinfo>
+#include <unordered_map>
+#endif
+
+#include <stdexcept>
+
+using ROOT::Internal::RDF::RPersistentCache;
+
+#ifdef R__RDF_HAS_RNTUPLE
+
+namespace {
+
+using ROOT::Detail::RDF::RDefineBase;
+using ROOT::Detail::RDF::RFilterBase;
+using ROOT::Detail::RDF::RLoopManager;
+using ROOT::Detail::RDF::RNodeBase;
+using ROOT::Internal::RDF::RColumnRegister;
+
+/// Describes the part of a computation graph that some columns depend on, in a form that is the same in all processes
+/// that book the same graph. Every node is described once, on its own line; later references use its number.
+class RGraphDescription {
+   std::string fText;
+   std::unordered_map<const void *, std::string> fRefs;
+
+   const std::string &Add(const void *node, const std::string &desc)
+   {
+      const auto ref = "#" + std::to_string(fRefs.size());
+      fText += ref + " = " + desc + '\n';
+      return fRefs[node] = ref;
+   }
+
+   std::string DescribeColumns(const std::vector<std::string> &columns, const RColumnRegister &colRegister)
+   {
+      std::string desc = "(";
+      for (const auto &column : columns)
+         desc += DescribeColumn(column, colRegister) + ", ";
+      return desc + ")";
+   }
+
+public:
+   const std::string &GetText() const { return fText; }
+
+   std::string DescribeColumn(const std::string &column, const RColumnRegister &colRegister)
+   {
+      const auto name = colRegister.ResolveAlias(column);
+      RDefineBase *define = colRegister.GetDefine(name);
+      if (define == nullptr)
+         return "input column " + name;
+      const auto it = fRefs.find(define);
+      if (it != fRefs.end())
+         return it->second;
+
+      std::string desc = "Define " + define->GetName() + " of type " + define->GetTypeName() + " = ";
+      if (const auto *jitted = dynamic_cast<const ROOT::Detail::RDF::RJittedDefine *>(define))
+         desc += "jitted \"" + jitted->GetExpression() + "\"";
+      else
+         desc += std::string("compiled ") + typeid(*define).name();
+      desc += DescribeColumns(define->GetColumnNames(), define->GetColRegister());
+      return Add(define, desc);
+   }
+
+   std::string DescribeNode(const RNodeBase &node)
+   {
+      if (dynamic_cast<const RLoopManager *>(&node) != nullptr)
+         return "input";
+      const auto it = fRefs.find(&node);
+      if (it != fRefs.end())
+         return it->second;
+
+      std::string desc;
+      const RNodeBase *prevNode = nullptr;
+      if (const auto *range = dynamic_cast<const ROOT::Detail::RDF::RRangeBase *>(&node)) {
+         desc = "Range(" + std::to_string(range->GetStart()) + ", " + std::to_string(range->GetStop()) + ", " +
+                std::to_string(range->GetStride()) + ")";
+         prevNode = range->GetPrevNode();
+      } else if (const auto *filter = dynamic_cast<const RFilterBase *>(&node)) {
+         desc = "Filter \"" + filter->GetName() + "\" = ";
+         if (const auto *jitted = dynamic_cast<const ROOT::Detail::RDF::RJittedFilter *>(filter))
+            desc += "jitted \"" + jitted->GetExpression() + "\"";
+         else
+            desc += std::string("compiled ") + typeid(*filter).name();
+         desc += DescribeColumns(filter->GetColumnNames(), filter->GetColRegister());
+         prevNode = filter->GetPrevNode();
+      }
+      if (prevNode == nullptr)
+         throw std::runtime_error("Cache: the computation graph of a persistent cache contains a node of type " +
+                                  std::string(typeid(node).name()) + ", which cannot be described.");
+      desc += " after " + DescribeNode(*prevNode);
+      return Add(&node, desc);
+   }
+};
+
+std::string DescribeFile(const std::string &fileName)
+{
+   // the size and modification time of local files, remote files are only identified by their name
+   FileStat_t stat;
+   if (gSystem->GetPathInfo(fileName.c_str(), stat) != 0)
+      return fileName;
+   return fileName + " " + std::to_string(stat.fSize) + " " + std::to_string(stat.fMtime);
+}
+
+std::string DescribeDataset(RLoopManager &lm, const std::string &tag)
+{
+   std::string desc;
+   if (auto *tree = lm.GetTree()) {
+      desc = "TTree";
+      for (const auto &treeName : ROOT::Internal::TreeUtils::GetTreeFullPaths(*tree))
+         desc += " " + treeName;
+      desc += '\n';
+      for (const auto &fileName : ROOT::Internal::TreeUtils::GetFileNamesFromTree(*tree))
+         desc += "file " + DescribeFile(fileName) + '\n';
+      const auto friendInfo = ROOT::Internal::TreeUtils::GetFriendInfo(*tree);
+      for (std::size_t i = 0; i < friendInfo.fFriendNames.size(); ++i) {
+         desc += "friend " + friendInfo.fFriendNames[i].first + " " + friendInfo.fFriendNames[i].second + '\n';
+         for (const auto &fileName : friendInfo.fFriendFileNames[i])
+            desc += "file " + DescribeFile(fileName) + '\n';
+      }
+   } else if (auto *ds = lm.GetDataSource()) {
+      if (tag.empty())
+         throw std::runtime_error("Cache: the input of a data source (" + ds->GetLabel() +
+                                  ") cannot be identified, a persistent cache requires a tag that identifies it.");
+      desc = "data source " + ds->GetLabel() + '\n';
+   } else {
+      desc = "empty source " + std::to_string(lm.GetNEmptyEntries()) + '\n';
+   }
+   const auto range = lm.GetEntryRange();
+   return desc + "entries " + std::to_string(range.first) + " " + std::to_string(range.second) + '\n';
+}
+
+std::string GetCacheDir(const std::string &dir)
+{
+   TString expanded =
+      dir.empty() ? gEnv->GetValue("RDataFrame.Cache.Dir", "$(HOME)/.cache/root/rdfcache") : dir.c_str();
+   gSystem->ExpandPathName(expanded);
+   return expanded.Data();
+}
+
+} // anonymous namespace
+
+RPersistentCache::RPersistentCache(ROOT::Detail::RDF::RLoopManager &lm, const ROOT::Detail::RDF::RNodeBase &node,
+                                   const RColumnRegister &colRegister, const std::vector<std::string> &columns,
+                                   const std::vector<std::string> &columnTypes, const ROOT::RDF::RCacheOptions &options)
+{
+   RGraphDescription graph;
+   std::string cachedColumns;
+   for (std::size_t i = 0; i < columns.size(); ++i)
+      cachedColumns += "cache " + columns[i] + " of type " + columnTypes[i] + " = " +
+                       graph.DescribeColumn(columns[i], colRegister) + '\n';
+   const auto selection = graph.DescribeNode(node);
+
+   const std::string keySource = std::string(ROOT_RELEASE) + '\n' + DescribeDataset(lm, options.fTag) +
+                                 graph.GetText() + cachedColumns + "selection " + selection + '\n' +
+                                 "tag " + options.fTag + '\n';
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keySource.data()), keySource.size());
+   md5.Final();
+   fPath = GetCacheDir(options.fDirectory) + "/rdfcache_" + md5.AsString() + ".root";
+}
+
+RPersistentCache::~RPersistentCache()
+{
+   if (!fTemporaryPath.empty())
+      gSystem->Unlink(fTemporaryPath.c_str());
+}
+
+bool RPersistentCache::Exists() const
+{
+   return !gSystem->AccessPathName(fPath.c_str());
+}
+
+std::string RPersistentCache::BeginWrite()
+{
+   const std::string dir = gSystem->GetDirName(fPath.c_str()).Data();
+   if (gSystem->AccessPathName(dir.c_str()) && gSystem->mkdir(dir.c_str(), /*recursive*/ true) != 0)
+      throw std::runtime_error("Cache: could not create the directory of the persistent cache " + dir);
+   // unique per process, renamed by Commit
+   fTemporaryPath = fPath.substr(0, fPath.size() - 5) + "_" + std::to_string(gSystem->GetPid()) + ".tmp.root";
+   R__LOG_INFO(RDFLogChannel()) << "Writing the persistent cache " << fPath << '.';
+   return fTemporaryPath;
+}
+
+void RPersistentCache::Commit()
+{
+   // another process might have committed the same dataset in the meantime, the last one wins
+   if (gSystem->Rename(fTemporaryPath.c_str(), fPath.c_str()) != 0)
+      throw std::runtime_error("Cache: could not move " + fTemporaryPath + " to " + fPath);
+   fTemporaryPath.clear();
+}
+
+void RPersistentCache::Open(ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void> &output) const
+{
+   R__LOG_INFO(RDFLogChannel()) << "Reading the persistent cache " << fPath << '.';
+   output = ROOT::Experimental::MakeNTupleDataFrame(GetNTupleName(), fPath);
+}
+
+#else // R__RDF_HAS_RNTUPLE
+
+RPersistentCache::RPersistentCache(ROOT::Detail::RDF::RLoopManager &, const ROOT::Detail::RDF::RNodeBase &,
+                                   const RColumnRegister &, const std::vector<std::string> &,
+                                   const std::vector<std::string> &, const ROOT::RDF::RCacheOptions &)
+{
+   throw std::runtime_error("Cache: a persistent cache requires ROOT to be built with root7=ON");
+}
+
+RPersistentCache::~RPersistentCache() = default;
+
+bool RPersistentCache::Exists() const
+{
+   return false;
+}
+
+std::string RPersistentCache::BeginWrite()
+{
+   return "";
+}
+
+void RPersistentCache::Commit() {}
+void RPersistentCache::Open(ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void> &) const {}
+
+#endif // R__RDF_HAS_RNTUPLE
@@ -0,0 +1,213 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfileReport.hxx"
+#include "TString.h" // Printf
+
+#include <algorithm>
+#include <cstdio>
+#include <ostream>
+#include <stdexcept>
+
+using ROOT::RDF::Experimental::RProfileReport;
+
+namespace {
+
+std::string EscapeJSON(const std::string &s)
+{
+   std::string out;
+   out.reserve(s.size());
+   for (const char c : s) {
+      switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\t': out += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+         } else {
+            out += c;
+         }
+      }
+   }
+   return out;
+}
+
+/// Format a time in seconds as microseconds, the unit of the Chrome trace event format.
+std::string ToMicroseconds(double seconds)
+{
+   char buf[32];
+   snprintf(buf, sizeof(buf), "%.3f", seconds * 1e6);
+   return buf;
+}
+
+std::string ToString(double x)
+{
+   char buf[32];
+   snprintf(buf, sizeof(buf), "%.9g", x);
+   return buf;
+}
+
+} // anonymous namespace
+
+double RProfileReport::RNode::GetTime() const
+{
+   double t = 0.;
+   for (const auto &s : fSlots)
+      t += s.fTime;
+   return t;
+}
+
+ULong64_t RProfileReport::RNode::GetEntries() const
+{
+   ULong64_t n = 0ull;
+   for (const auto &s : fSlots)
+      n += s.fEntries;
+   return n;
+}
+
+ULong64_t RProfileReport::RNode::GetBytes() const
+{
+   ULong64_t n = 0ull;
+   for (const auto &s : fSlots)
+      n += s.fBytes;
+   return n;
+}
+
+RProfileReport::RProfileReport(std::vector<RPhase> phases, std::vector<RNode> nodes, std::vector<RTask> tasks)
+   : fPhases(std::move(phases)), fNodes(std::move(nodes)), fTasks(std::move(tasks))
+{
+}
+
+const RProfileReport::RNode &RProfileReport::GetNode(const std::string &name) const
+{
+   const auto it = std::find_if(fNodes.begin(), fNodes.end(), [&name](const RNode &n) { return n.fName == name; });
+   if (it == fNodes.end())
+      throw std::runtime_error("RProfileReport: there is no node called \"" + name + "\".");
+   return *it;
+}
+
+/// Print the phases and the nodes, slowest first.
+void RProfileReport::Print() const
+{
+   for (const auto &p : fPhases)
+      Printf("%-20s: real=%.6fs cpu=%.6fs", p.fName.c_str(), p.fRealTime, p.fCpuTime);
+
+   std::vector<const RNode *> sorted;
+   for (const auto &n : fNodes)
+      sorted.push_back(&n);
+   std::stable_sort(sorted.begin(), sorted.end(),
+                    [](const RNode *a, const RNode *b) { return a->GetTime() > b->GetTime(); });
+   for (const auto *n : sorted)
+      Printf("%-6s %-20s: time=%.6fs entries=%-10llu bytes=%llu", n->fKind.c_str(), n->fName.c_str(), n->GetTime(),
+             n->GetEntries(), n->GetBytes());
+}
+
+/// Write the report as a JSON object with the lists "phases", "tasks" and "nodes", the latter with per-slot statistics.
+void RProfileReport::WriteJSON(std::ostream &os) const
+{
+   os << "{\n  \"phases\": [";
+   for (std::size_t i = 0; i < fPhases.size(); ++i) {
+      const auto &p = fPhases[i];
+      os << (i > 0 ? "," : "") << "\n    {\"name\": \"" << EscapeJSON(p.fName)
+         << "\", \"start\": " << ToString(p.fStart) << ", \"realTime\": " << ToString(p.fRealTime)
+         << ", \"cpuTime\": " << ToString(p.fCpuTime) << "}";
+   }
+   os << "\n  ],\n  \"tasks\": [";
+   for (std::size_t i = 0; i < fTasks.size(); ++i) {
+      const auto &t = fTasks[i];
+      os << (i > 0 ? "," : "") << "\n    {\"slot\": " << t.fSlot << ", \"start\": " << ToString(t.fStart)
+         << ", \"realTime\": " << ToString(t.fRealTime) << ", \"cpuTime\": " << ToString(t.fCpuTime)
+         << ", \"initTime\": " << ToString(t.fInitTime) << "}";
+   }
+   os << "\n  ],\n  \"nodes\": [";
+   for (std::size_t i = 0; i < fNodes.size(); ++i) {
+      const auto &n = fNodes[i];
+      os << (i > 0 ? "," : "") << "\n    {\"name\": \"" << EscapeJSON(n.fName) << "\", \"kind\": \"" << n.fKind
+         << "\", \"time\": " << ToString(n.GetTime()) << ", \"entries\": " << n.GetEntries()
+         << ", \"bytes\": " << n.GetBytes() << ", \"slots\": [";
+      for (std::size_t s = 0; s < n.fSlots.size(); ++s) {
+         const auto &stats = n.fSlots[s];
+         os << (s > 0 ? ", " : "") << "{\"time\": " << ToString(stats.fTime) << ", \"entries\": " << stats.fEntries
+            << ", \"bytes\": " << stats.fBytes << "}";
+      }
+      os << "]}";
+   }
+   os << "\n  ]\n}\n";
+}
+
+/// Write the report in the Chrome trace event format, which can be loaded in chrome://tracing or
+/// https://ui.perfetto.dev. The phases and the tasks of each slot are shown on a timeline. Since nodes run interleaved
+/// entry by entry, their time is shown in a second process, with one track per slot on which the nodes are laid out
+/// one after the other, slowest first: only their durations are meaningful, not their position in time.
+void RProfileReport::WriteChromeTrace(std::ostream &os) const
+{
+   bool first = true;
+   auto beginEvent = [&]() -> std::ostream & {
+      os << (first ? "\n" : ",\n") << "  {";
+      first = false;
+      return os;
+   };
+
+   os << "{\"traceEvents\": [";
+   beginEvent() << "\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, \"args\": {\"name\": \"RDataFrame event "
+                   "loop\"}}";
+   beginEvent() << "\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": 0, "
+                   "\"args\": {\"name\": \"phases\"}}";
+   beginEvent() << "\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"RDataFrame nodes "
+                   "(self time per slot)\"}}";
+
+   for (const auto &p : fPhases) {
+      beginEvent() << "\"name\": \"" << EscapeJSON(p.fName) << "\", \"cat\": \"phase\", \"ph\": \"X\", \"pid\": 0, "
+                   << "\"tid\": 0, \"ts\": " << ToMicroseconds(p.fStart) << ", \"dur\": " << ToMicroseconds(p.fRealTime)
+                   << ", \"args\": {\"cpuTime\": " << ToString(p.fCpuTime) << "}}";
+   }
+
+   unsigned int nSlots = 0u;
+   for (const auto &n : fNodes)
+      nSlots = std::max(nSlots, static_cast<unsigned int>(n.fSlots.size()));
+   for (const auto &t : fTasks)
+      nSlots = std::max(nSlots, t.fSlot + 1);
+
+   for (unsigned int slot = 0u; slot < nSlots; ++slot) {
+      beginEvent() << "\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << slot + 1
+                   << ", \"args\": {\"name\": \"slot " << slot << "\"}}";
+      beginEvent() << "\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << slot + 1
+                   << ", \"args\": {\"name\": \"slot " << slot << "\"}}";
+   }
+
+   for (const auto &t : fTasks) {
+      beginEvent() << "\"name\": \"task\", \"cat\": \"task\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << t.fSlot + 1
+                   << ", \"ts\": " << ToMicroseconds(t.fStart) << ", \"dur\": " << ToMicroseconds(t.fRealTime)
+                   << ", \"args\": {\"cpuTime\": " << ToString(t.fCpuTime)
+                   << ", \"initTime\": " << ToString(t.fInitTime) << "}}";
+   }
+
+   for (unsigned int slot = 0u; slot < nSlots; ++slot) {
+      std::vector<const RNode *> sorted;
+      for (const auto &n : fNodes)
+         if (slot < n.fSlots.size() && n.fSlots[slot].fEntries > 0)
+            sorted.push_back(&n);
+      std::stable_sort(sorted.begin(), sorted.end(), [slot](const RNode *a, const RNode *b) {
+         return a->fSlots[slot].fTime > b->fSlots[slot].fTime;
+      });
+      double ts = 0.;
+      for (const auto *n : sorted) {
+         const auto &stats = n->fSlots[slot];
+         beginEvent() << "\"name\": \"" << EscapeJSON(n->fName) << "\", \"cat\": \"" << n->fKind
+                      << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << slot + 1 << ", \"ts\": " << ToMicroseconds(ts)
+                      << ", \"dur\": " << ToMicroseconds(stats.fTime) << ", \"args\": {\"entries\": " << stats.fEntries
+                      << ", \"bytes\": " << stats.fBytes << "}}";
+         ts += stats.fTime;
+      }
+   }
+   os << "\n], \"displayTimeUnit\": \"ms\"}\n";
+}
@@ -24,6 +24,7 @@ void RRangeBase::ResetCounters()
    fLastCheckedEntry = -1;
    fNProcessedEntries = 0;
    fHasStopped = false;
+   fBlockMask.Invalidate();
 }
 
 // outlined to pin virtual table
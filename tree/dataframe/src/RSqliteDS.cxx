@@ -16,6 +16,7 @@
 #include "TSystem.h"
 
 #include <algorithm>
+#include <cassert>
 #include <cctype>
 #include <cerrno>
 #include <cstring> // for memcpy
@@ -334,7 +335,7 @@ struct RSqliteDSDataSet {
 }
 
 RSqliteDS::Value_t::Value_t(RSqliteDS::ETypes type)
-   : fType(type), fIsActive(false), fInteger(0), fReal(0.0), fText(), fBlob(), fNull(nullptr)
+   : fType(type), fInteger(0), fReal(0.0), fText(), fBlob(), fNull(nullptr)
 {
    switch (type) {
    case ETypes::kInteger: fPtr = &fInteger; break;
@@ -352,10 +353,11 @@ constexpr char const *RSqliteDS::fgTypeNames[];
 /// \brief Build the dataframe
 /// \param[in] fileName The path to an sqlite3 file, will be opened read-only
 /// \param[in] query A valid sqlite3 SELECT query
+/// \param[in] batchSize The number of rows fetched at once and split among the slots
 ///
 /// The constructor opens the sqlite file, prepares the query engine and determines the column names and types.
-RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
-   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0)
+RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query, unsigned int batchSize)
+   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(1), fNRow(0), fBatchSize(std::max(batchSize, 1u))
 {
    static bool hasSqliteVfs = RegisterSqliteVfs();
    if (!hasSqliteVfs)
@@ -386,7 +388,8 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
    if ((retval != SQLITE_ROW) && (retval != SQLITE_DONE))
       SqliteError(retval);
 
-   fValues.reserve(colCount);
+   fValues.resize(1);
+   fValues[0].reserve(colCount);
    for (int i = 0; i < colCount; ++i) {
       fColumnNames.emplace_back(sqlite3_column_name(fDataSet->fQuery, i));
       int type = SQLITE_NULL;
@@ -414,28 +417,30 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
       switch (type) {
       case SQLITE_INTEGER:
          fColumnTypes.push_back(ETypes::kInteger);
-         fValues.emplace_back(ETypes::kInteger);
+         fValues[0].emplace_back(ETypes::kInteger);
          break;
       case SQLITE_FLOAT:
          fColumnTypes.push_back(ETypes::kReal);
-         fValues.emplace_back(ETypes::kReal);
+         fValues[0].emplace_back(ETypes::kReal);
          break;
       case SQLITE_TEXT:
          fColumnTypes.push_back(ETypes::kText);
-         fValues.emplace_back(ETypes::kText);
+         fValues[0].emplace_back(ETypes::kText);
          break;
       case SQLITE_BLOB:
          fColumnTypes.push_back(ETypes::kBlob);
-         fValues.emplace_back(ETypes::kBlob);
+         fValues[0].emplace_back(ETypes::kBlob);
          break;
       case SQLITE_NULL:
          // TODO: Null values in first rows are not well handled
          fColumnTypes.push_back(ETypes::kNull);
-         fValues.emplace_back(ETypes::kNull);
+         fValues[0].emplace_back(ETypes::kNull);
          break;
       default: throw std::runtime_error("Unhandled data type");
       }
    }
+   fIsActive.resize(colCount, false);
+   fBuffers.resize(colCount);
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -476,28 +481,86 @@ RDataSource::Record_t RSqliteDS::GetColumnReadersImpl(std::string_view name, con
       throw std::runtime_error(errmsg);
    }
 
-   fValues[index].fIsActive = true;
-   return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+   fIsActive[index] = true;
+   std::vector<void *> ptrs;
+   for (auto &slotValues : fValues)
+      ptrs.emplace_back(&slotValues[index].fPtr);
+   return ptrs;
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Returns a range of size 1 as long as more rows are available in the SQL result set.
-/// This inherently serialized the RDF independent of the number of slots.
+/// Stores the values of the active columns of the current sqlite query row in the column buffers. The buffers only
+/// grow, so that the memory of the text and blob values is reused by the next batches.
+void RSqliteDS::FillBuffers(unsigned int row)
+{
+   unsigned N = fBuffers.size();
+   for (unsigned i = 0; i < N; ++i) {
+      if (!fIsActive[i])
+         continue;
+
+      auto &buffer = fBuffers[i];
+      int nbytes;
+      switch (fColumnTypes[i]) {
+      case ETypes::kInteger:
+         if (buffer.fIntegers.size() <= row)
+            buffer.fIntegers.resize(row + 1);
+         buffer.fIntegers[row] = sqlite3_column_int64(fDataSet->fQuery, i);
+         break;
+      case ETypes::kReal:
+         if (buffer.fReals.size() <= row)
+            buffer.fReals.resize(row + 1);
+         buffer.fReals[row] = sqlite3_column_double(fDataSet->fQuery, i);
+         break;
+      case ETypes::kText:
+         if (buffer.fTexts.size() <= row)
+            buffer.fTexts.resize(row + 1);
+         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+         if (nbytes == 0) {
+            buffer.fTexts[row].clear();
+         } else {
+            buffer.fTexts[row] = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
+         }
+         break;
+      case ETypes::kBlob:
+         if (buffer.fBlobs.size() <= row)
+            buffer.fBlobs.resize(row + 1);
+         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
+         buffer.fBlobs[row].resize(nbytes);
+         if (nbytes > 0) {
+            std::memcpy(buffer.fBlobs[row].data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
+         }
+         break;
+      case ETypes::kNull: break;
+      default: throw std::runtime_error("Unhandled column type");
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Fetches the next batch of rows of the SQL result set into the column buffers and splits it in one entry range
+/// per slot. Stepping through the result set is serial, the processing of the ranges runs in parallel.
 std::vector<std::pair<ULong64_t, ULong64_t>> RSqliteDS::GetEntryRanges()
 {
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   int retval = sqlite3_step(fDataSet->fQuery);
-   switch (retval) {
-   case SQLITE_DONE: return entryRanges;
-   case SQLITE_ROW:
-      entryRanges.emplace_back(fNRow, fNRow + 1);
-      fNRow++;
-      return entryRanges;
-   default:
-      SqliteError(retval);
-      // Never here
-      abort();
+   fBatchBegin = fNRow;
+   unsigned int nRows = 0;
+   while (nRows < fBatchSize) {
+      int retval = sqlite3_step(fDataSet->fQuery);
+      if (retval == SQLITE_DONE)
+         break;
+      if (retval != SQLITE_ROW)
+         SqliteError(retval);
+      FillBuffers(nRows);
+      ++nRows;
    }
+   if (nRows == 0)
+      return entryRanges;
+
+   const ULong64_t nRanges = std::min<ULong64_t>(fNSlots, nRows);
+   for (ULong64_t i = 0; i < nRanges; ++i)
+      entryRanges.emplace_back(fBatchBegin + nRows * i / nRanges, fBatchBegin + nRows * (i + 1) / nRanges);
+   fNRow += nRows;
+   return entryRanges;
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -547,35 +610,22 @@ RDataFrame MakeSqliteDataFrame(std::string_view fileName, std::string_view query
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Stores the result of the current active sqlite query row as a C++ value.
-bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
+/// Makes the values of the given entry of the current batch the values of the slot.
+bool RSqliteDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
-   assert(entry + 1 == fNRow);
-   (void)entry;
-   unsigned N = fValues.size();
+   assert(entry >= fBatchBegin && entry < fNRow);
+   const auto row = entry - fBatchBegin;
+   auto &values = fValues[slot];
+   unsigned N = values.size();
    for (unsigned i = 0; i < N; ++i) {
-      if (!fValues[i].fIsActive)
+      if (!fIsActive[i])
          continue;
 
-      int nbytes;
-      switch (fValues[i].fType) {
-      case ETypes::kInteger: fValues[i].fInteger = sqlite3_column_int64(fDataSet->fQuery, i); break;
-      case ETypes::kReal: fValues[i].fReal = sqlite3_column_double(fDataSet->fQuery, i); break;
-      case ETypes::kText:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         if (nbytes == 0) {
-            fValues[i].fText = "";
-         } else {
-            fValues[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
-         }
-         break;
-      case ETypes::kBlob:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         fValues[i].fBlob.resize(nbytes);
-         if (nbytes > 0) {
-            std::memcpy(fValues[i].fBlob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
-         }
-         break;
+      switch (values[i].fType) {
+      case ETypes::kInteger: values[i].fInteger = fBuffers[i].fIntegers[row]; break;
+      case ETypes::kReal: values[i].fReal = fBuffers[i].fReals[row]; break;
+      case ETypes::kText: values[i].fText = fBuffers[i].fTexts[row]; break;
+      case ETypes::kBlob: values[i].fBlob = fBuffers[i].fBlobs[row]; break;
       case ETypes::kNull: break;
       default: throw std::runtime_error("Unhandled column type");
       }
@@ -584,14 +634,18 @@ bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
-/// Almost a no-op, many slots can in fact reduce the performance due to thread synchronization.
+/// Creates the values of every slot; the rows of a batch are split among the slots.
 void RSqliteDS::SetNSlots(unsigned int nSlots)
 {
-   if (nSlots > 1) {
-      ::Warning("SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                             "Consider turning off IMT.");
+   fNSlots = std::max(nSlots, 1u);
+   fValues.resize(1);
+   for (unsigned int slot = 1; slot < fNSlots; ++slot) {
+      std::vector<Value_t> values;
+      values.reserve(fColumnTypes.size());
+      for (auto type : fColumnTypes)
+         values.emplace_back(type);
+      fValues.emplace_back(std::move(values));
    }
-   fNSlots = nSlots;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,106 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RVec.hxx>
+#include <TTree.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using ROOT::RVecF;
+
+namespace {
+struct RResults {
+   ULong64_t fCount;
+   double fSum;
+   std::vector<ULong64_t> fEntries;
+   std::vector<float> fLast;
+   ULong64_t fNamedPass;
+   ULong64_t fNamedAll;
+};
+
+RResults RunGraph(bool useBlocks)
+{
+   ROOT::RDataFrame df(100);
+   df.SetBlockSize(useBlocks ? 7 : 0);
+   auto x = df.Define("x", [](ULong64_t e) { return static_cast<double>(e) * 0.5; }, {"rdfentry_"})
+               .Define("y", [](double x) { return x * x; }, {"x"});
+   auto even = x.Filter([](ULong64_t e) { return e % 2 == 0; }, {"rdfentry_"}, "even");
+   auto sel = even.Filter([](double y) { return y < 500.; }, {"y"});
+   auto count = sel.Count();
+   auto sum = sel.Sum<double>("y");
+   auto entries = sel.Take<ULong64_t>("rdfentry_");
+   auto last = sel.Define("v", [](double x) { return RVecF{float(x), float(x + 1)}; }, {"x"})
+                  .Define("l", [](const RVecF &v) { return v.back(); }, {"v"})
+                  .Take<float>("l");
+   auto report = df.Report();
+
+   const auto &info = report->At("even");
+   return {*count, *sum, *entries, *last, info.GetPass(), info.GetAll()};
+}
+
+void ExpectEqual(const RResults &blocks, const RResults &entries)
+{
+   EXPECT_EQ(blocks.fCount, entries.fCount);
+   EXPECT_DOUBLE_EQ(blocks.fSum, entries.fSum);
+   EXPECT_EQ(blocks.fEntries, entries.fEntries);
+   EXPECT_EQ(blocks.fLast, entries.fLast);
+   EXPECT_EQ(blocks.fNamedPass, entries.fNamedPass);
+   EXPECT_EQ(blocks.fNamedAll, entries.fNamedAll);
+}
+} // anonymous namespace
+
+TEST(RDFBlockExecution, EmptySource)
+{
+   const auto entries = RunGraph(false);
+   const auto blocks = RunGraph(true);
+   ExpectEqual(blocks, entries);
+   EXPECT_EQ(blocks.fNamedAll, 100ull);
+}
+
+TEST(RDFBlockExecution, TTree)
+{
+   TTree t("t", "t");
+   int i = 0;
+   float f = 0.f;
+   t.Branch("i", &i);
+   t.Branch("f", &f);
+   for (i = 0; i < 123; ++i) {
+      f = i * 0.25f;
+      t.Fill();
+   }
+
+   auto book = [&t](bool useBlocks) {
+      ROOT::RDataFrame df(t);
+      df.SetBlockSize(useBlocks ? 16 : 0);
+      auto sel = df.Filter([](int i) { return i % 3 != 0; }, {"i"}, "not3").Define("g", [](float f) { return 2 * f; },
+                                                                                     {"f"});
+      auto fs = sel.Take<float>("g");
+      auto sum = sel.Sum<int>("i");
+      auto report = df.Report();
+      return std::make_pair(*fs, *sum + report->At("not3").GetAll());
+   };
+
+   EXPECT_EQ(book(true), book(false));
+}
+
+TEST(RDFBlockExecution, FallbackWithRange)
+{
+   ROOT::RDataFrame df(50);
+   df.SetBlockSize(8);
+   auto entries = df.Range(5, 20).Take<ULong64_t>("rdfentry_");
+   std::vector<ULong64_t> expected;
+   for (ULong64_t e = 5; e < 20; ++e)
+      expected.emplace_back(e);
+   EXPECT_EQ(*entries, expected);
+}
+
+TEST(RDFBlockExecution, DefinePerSample)
+{
+   ROOT::RDataFrame df(20);
+   df.SetBlockSize(4);
+   auto sum = df.DefinePerSample("s", [](unsigned int, const ROOT::RDF::RSampleInfo &) { return 2; })
+                 .Define("z", [](int s, ULong64_t e) { return s * int(e); }, {"s", "rdfentry_"})
+                 .Sum<int>("z");
+   EXPECT_EQ(*sum, 2 * 190);
+}
@@ -1,5 +1,7 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/TSeq.hxx"
+#include "TProfile.h"
+#include "TProfile2D.h"
 
 #include "gtest/gtest.h"
 
@@ -346,3 +348,47 @@ TEST(RDataFrameHisto, FillVecBool)
     EXPECT_EQ(h->GetBinContent(2), n);
     EXPECT_EQ(h->GetBinContent(3), 0u);
 }
+
+// the profiles are filled in batches of values: the result must be the same as when filling them one value at a time
+TEST(RDataFrameHisto, ProfileFillBatches)
+{
+   const auto n = 3000u;
+   auto df = ROOT::RDataFrame(n)
+                .Define("x", [](ULong64_t e) { return (e % 101) / 10.; }, {"rdfentry_"})
+                .Define("y", [](ULong64_t e) { return (e % 7) * 1.5; }, {"rdfentry_"})
+                .Define("z", [](ULong64_t e) { return (e % 13) * 0.5; }, {"rdfentry_"})
+                .Define("w", [](ULong64_t e) { return 1. + e % 3; }, {"rdfentry_"})
+                .Define("v", [](double x) { return ROOT::RVecD{x, x + 0.5, x - 1.}; }, {"x"});
+   auto p1 = df.Profile1D({"p1", "p1", 20, 0., 10.}, "x", "y", "w");
+   auto p1v = df.Profile1D({"p1v", "p1v", 20, 0., 10.}, "v", "y");
+   auto p2 = df.Profile2D({"p2", "p2", 20, 0., 10., 5, 0., 10.}, "x", "y", "z", "w");
+
+   TProfile e1("e1", "e1", 20, 0., 10.);
+   TProfile e1v("e1v", "e1v", 20, 0., 10.);
+   TProfile2D e2("e2", "e2", 20, 0., 10., 5, 0., 10.);
+   for (ULong64_t e = 0; e < n; ++e) {
+      const double x = (e % 101) / 10.;
+      const double y = (e % 7) * 1.5;
+      const double z = (e % 13) * 0.5;
+      const double w = 1. + e % 3;
+      e1.Fill(x, y, w);
+      for (double v : {x, x + 0.5, x - 1.})
+         e1v.Fill(v, y);
+      e2.Fill(x, y, z, w);
+   }
+
+   EXPECT_EQ(p1->GetEntries(), e1.GetEntries());
+   EXPECT_EQ(p1v->GetEntries(), e1v.GetEntries());
+   EXPECT_EQ(p2->GetEntries(), e2.GetEntries());
+   for (int bin = 0; bin < e1.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(p1->GetBinContent(bin), e1.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(p1->GetBinError(bin), e1.GetBinError(bin));
+      EXPECT_DOUBLE_EQ(p1v->GetBinContent(bin), e1v.GetBinContent(bin));
+   }
+   for (int bin = 0; bin < e2.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(p2->GetBinContent(bin), e2.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(p2->GetBinEntries(bin), e2.GetBinEntries(bin));
+   }
+   EXPECT_DOUBLE_EQ(p1->GetMean(2), e1.GetMean(2));
+   EXPECT_DOUBLE_EQ(p2->GetMean(3), e2.GetMean(3));
+}
@@ -5,6 +5,7 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RTrivialDS.hxx"
+#include "TEnv.h"
 #include "TMemFile.h"
 #include "TSystem.h"
 #include "TTree.h"
@@ -877,3 +878,31 @@ TEST(RDataFrameUtils, RegexWithFriendsInJittedFilters)
    EXPECT_EQ(df.Filter("fr.x < 0 && x > 0").Count().GetValue(), 1);
    EXPECT_EQ(df.Filter("x > 0 && fr.x < 0").Count().GetValue(), 1);
 }
+
+TEST(RDataFrameInterface, JitCache)
+{
+   const auto cacheDir = "RDataFrameInterfaceJitCache";
+   gSystem->mkdir(cacheDir);
+   const auto oldDir = gEnv->GetValue("RDataFrame.JitCache.Dir", "");
+   gEnv->SetValue("RDataFrame.JitCache.Dir", cacheDir);
+
+   // the same graph, booked twice: the second event loop runs the code compiled after the first one
+   auto book = []() {
+      ROOT::RDataFrame df(10);
+      return df.Define("x", "rdfentry_ * 2").Filter("x > 4").Sum<ULong64_t>("x");
+   };
+   const auto first = *book();
+   void *dir = gSystem->OpenDirectory(cacheDir);
+   int nLibs = 0;
+   while (const char *f = gSystem->GetDirEntry(dir))
+      nLibs += TString(f).EndsWith(TString(".") + gSystem->GetSoExt());
+   gSystem->FreeDirectory(dir);
+   const auto second = *book();
+
+   EXPECT_EQ(first, 84ull);
+   EXPECT_EQ(second, first);
+   EXPECT_EQ(nLibs, 1);
+
+   gEnv->SetValue("RDataFrame.JitCache.Dir", oldDir);
+   gSystem->Exec((std::string("rm -rf ") + cacheDir).c_str());
+}
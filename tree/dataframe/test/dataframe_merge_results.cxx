@@ -401,3 +401,26 @@ TEST(RDataFrameMergeResults, MergeVariedHisto)
       EXPECT_EQ(histo.GetEntries(), 20);
    }
 }
+
+TEST(RDataFrameMergeResults, MergeValueLists)
+{
+   ROOT::RDataFrame df1{100};
+   ROOT::RDataFrame df2{100};
+
+   auto col1 = df1.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+   auto col2 = df2.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+
+   auto mc1 = GetMergeableValue(col1.Count());
+   auto mc2 = GetMergeableValue(col2.Count());
+   auto mh1 = GetMergeableValue(col1.Histo1D<double>({"name", "title", 10, 0, 100}, "x"));
+   auto mh2 = GetMergeableValue(col2.Histo1D<double>({"name", "title", 10, 0, 100}, "x"));
+
+   ROOT::Detail::RDF::MergeValueLists({mc1.get(), mh1.get()}, {mc2.get(), mh2.get()});
+
+   EXPECT_EQ(mc1->GetValue(), 200);
+   EXPECT_EQ(mh1->GetValue().GetEntries(), 200);
+   EXPECT_DOUBLE_EQ(mh1->GetValue().GetMean(), 49.5);
+
+   // Results of different types in the same position
+   EXPECT_THROW(ROOT::Detail::RDF::MergeValueLists({mc1.get()}, {mh2.get()}), std::invalid_argument);
+}
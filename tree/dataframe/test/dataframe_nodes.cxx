@@ -1,6 +1,8 @@
 #include "ROOT/TestSupport.hxx"
 
 #include <ROOT/RDataFrame.hxx>
+#include <TEnv.h>
+#include <TInterpreter.h>
 #include <TStatistic.h> // To check reading of columns with types which are mothers of the column type
 #include <TSystem.h>
 
@@ -103,3 +105,31 @@ TEST(RDataFrameNodes, InheritanceOfDefines)
    ROOT::RDataFrame(1).Define("x", createStat).Snapshot<TStatistic>("t", ofileName, {"x"})->Foreach(checkStat, {"x"});
    gSystem->Unlink(ofileName);
 }
+
+TEST(RDataFrameNodes, MergeEquivalentNodes)
+{
+   gInterpreter->Declare("int gMergeNodesCalls = 0; ULong64_t MergeNodesTwice(ULong64_t e) { ++gMergeNodesCalls; "
+                         "return 2 * e; }");
+   auto book = [] {
+      ROOT::RDataFrame df(10);
+      auto b1 = df.Define("x", "MergeNodesTwice(rdfentry_)").Filter("x > 4");
+      auto b2 = df.Define("y", "MergeNodesTwice(rdfentry_)").Filter("y > 4");
+      auto b3 = df.Define("x", "MergeNodesTwice(rdfentry_)").Filter("x > 4", "named");
+      auto unused = df.Define("z", "MergeNodesTwice(rdfentry_)").Filter("z > 4");
+      auto s1 = b1.Sum<ULong64_t>("x");
+      auto s2 = b2.Define("w", "y + 1").Sum<ULong64_t>("w");
+      auto c3 = b3.Count();
+      gInterpreter->ProcessLine("gMergeNodesCalls = 0;");
+      EXPECT_EQ(*s1, 84ull);
+      EXPECT_EQ(*s2, 91ull);
+      EXPECT_EQ(*c3, 7ull);
+      return gInterpreter->ProcessLine("gMergeNodesCalls;");
+   };
+
+   // without merging, the unused branch is still not evaluated
+   EXPECT_EQ(book(), 30);
+
+   gEnv->SetValue("RDataFrame.MergeEquivalentNodes", 1);
+   EXPECT_EQ(book(), 10);
+   gEnv->SetValue("RDataFrame.MergeEquivalentNodes", 0);
+}
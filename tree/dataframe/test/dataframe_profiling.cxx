@@ -0,0 +1,86 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDF/RProfileReport.hxx>
+#include <TFile.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using ROOT::RDF::Experimental::RProfileReport;
+
+TEST(RDFProfiling, DisabledByDefault)
+{
+   ROOT::RDataFrame df(10);
+   EXPECT_EQ(*df.Count(), 10ull);
+   EXPECT_TRUE(df.GetProfileReport().IsEmpty());
+}
+
+TEST(RDFProfiling, NodeEntries)
+{
+   ROOT::RDataFrame df(100);
+   df.EnableProfiling();
+   auto x = df.Define("x", [](ULong64_t e) { return static_cast<double>(e); }, {"rdfentry_"});
+   auto sum = x.Filter([](double v) { return v < 30.; }, {"x"}, "low").Sum<double>("x");
+   EXPECT_DOUBLE_EQ(*sum, 435.);
+
+   const auto &report = df.GetProfileReport();
+   ASSERT_FALSE(report.IsEmpty());
+   std::vector<std::string> phases;
+   for (const auto &p : report.GetPhases())
+      phases.push_back(p.fName);
+   EXPECT_EQ(phases, (std::vector<std::string>{"Jit", "InitNodes", "EventLoop", "Finalize"}));
+   EXPECT_FALSE(report.GetTasks().empty());
+
+   const auto &define = report.GetNode("x");
+   EXPECT_EQ(define.fKind, "Define");
+   EXPECT_EQ(define.GetEntries(), 100ull);
+   const auto &filter = report.GetNode("low");
+   EXPECT_EQ(filter.fKind, "Filter");
+   EXPECT_EQ(filter.GetEntries(), 100ull);
+   const auto &action = report.GetNode("Sum");
+   EXPECT_EQ(action.fKind, "Action");
+   EXPECT_EQ(action.GetEntries(), 30ull);
+   EXPECT_GE(action.GetTime(), 0.);
+   EXPECT_THROW(report.GetNode("nope"), std::runtime_error);
+
+   // profiling stops, the report of the last profiled event loop stays
+   df.EnableProfiling(false);
+   EXPECT_EQ(*df.Count(), 100ull);
+   EXPECT_EQ(df.GetProfileReport().GetNode("x").GetEntries(), 100ull);
+}
+
+TEST(RDFProfiling, TreeColumnBytes)
+{
+   const auto fname = "dataframe_profiling_tree.root";
+   {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      t.Branch("i", &i);
+      for (i = 0; i < 1000; ++i)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::RDataFrame df("t", fname);
+   df.EnableProfiling();
+   EXPECT_EQ(*df.Filter([](int i) { return i % 2 == 0; }, {"i"}).Count(), 500ull);
+
+   const auto &column = df.GetProfileReport().GetNode("i");
+   EXPECT_EQ(column.fKind, "Column");
+   EXPECT_EQ(column.GetEntries(), 1000ull);
+   EXPECT_GT(column.GetBytes(), 0ull);
+
+   std::ostringstream json;
+   df.GetProfileReport().WriteJSON(json);
+   EXPECT_NE(json.str().find("\"name\": \"i\", \"kind\": \"Column\""), std::string::npos);
+   std::ostringstream trace;
+   df.GetProfileReport().WriteChromeTrace(trace);
+   EXPECT_EQ(trace.str().find("{\"traceEvents\": ["), 0u);
+   EXPECT_NE(trace.str().find("\"name\": \"EventLoop\", \"cat\": \"phase\""), std::string::npos);
+
+   gSystem->Unlink(fname);
+}
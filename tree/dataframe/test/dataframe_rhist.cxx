@@ -0,0 +1,85 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDF/RHistFillHelper.hxx>
+#include <ROOT/RHist.hxx>
+#include <ROOT/RVec.hxx>
+#include <TROOT.h>
+
+#include <memory>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+using ROOT::Experimental::RAxisConfig;
+using ROOT::Experimental::RH1D;
+using ROOT::Experimental::RH2D;
+using ROOT::RDF::Experimental::RHistFillHelper;
+
+namespace {
+ROOT::RDF::RNode MakeDataFrame(unsigned int nEntries)
+{
+   return ROOT::RDataFrame(nEntries)
+      .Define("x", [](ULong64_t e) { return (e % 100) / 100.; }, {"rdfentry_"})
+      .Define("y", [](ULong64_t e) { return (e % 7) * 1.5; }, {"rdfentry_"})
+      .Define("w", [](ULong64_t e) { return 1. + e % 3; }, {"rdfentry_"})
+      .Define("v", [](double x) { return ROOT::RVecD{x, x + 0.5}; }, {"x"});
+}
+
+void CheckFill(ROOT::RDF::RNode df, unsigned int nEntries)
+{
+   auto h1 = std::make_shared<RH1D>(RAxisConfig{10, 0., 1.});
+   auto h2 = std::make_shared<RH2D>(RAxisConfig{10, 0., 1.}, RAxisConfig{{0., 1., 2., 4., 10.}});
+   auto hv = std::make_shared<RH1D>(RAxisConfig{10, 0., 1.});
+   auto r1 = df.Book<double>(RHistFillHelper<RH1D>(h1, df.GetNSlots()), {"x"});
+   auto r2 = df.Book<double, double, double>(RHistFillHelper<RH2D>(h2, df.GetNSlots()), {"x", "y", "w"});
+   // collection and scalar weight
+   auto rv = df.Book<ROOT::RVecD, double>(RHistFillHelper<RH1D>(hv, df.GetNSlots()), {"v", "w"});
+
+   RH1D e1(RAxisConfig{10, 0., 1.});
+   RH2D e2(RAxisConfig{10, 0., 1.}, RAxisConfig{{0., 1., 2., 4., 10.}});
+   RH1D ev(RAxisConfig{10, 0., 1.});
+   for (ULong64_t e = 0; e < nEntries; ++e) {
+      const double x = (e % 100) / 100.;
+      const double w = 1. + e % 3;
+      e1.Fill({x});
+      e2.Fill({x, (e % 7) * 1.5}, w);
+      ev.Fill({x}, w);
+      ev.Fill({x + 0.5}, w);
+   }
+
+   EXPECT_EQ(r1.GetPtr(), h1.get());
+   EXPECT_EQ(r1->GetEntries(), int64_t(nEntries));
+   EXPECT_EQ(r2->GetEntries(), int64_t(nEntries));
+   EXPECT_EQ(rv->GetEntries(), int64_t(2 * nEntries));
+   for (double x = 0.05; x < 1.; x += 0.1) {
+      EXPECT_EQ(r1->GetBinContent({x}), e1.GetBinContent({x}));
+      EXPECT_EQ(rv->GetBinContent({x}), ev.GetBinContent({x}));
+      for (double y : {0.5, 1.5, 3., 6.})
+         EXPECT_EQ(r2->GetBinContent({x, y}), e2.GetBinContent({x, y}));
+   }
+}
+} // namespace
+
+TEST(RDFRHist, Fill)
+{
+   CheckFill(MakeDataFrame(1000), 1000);
+}
+
+TEST(RDFRHist, CollectionsOfDifferentSizes)
+{
+   auto df = ROOT::RDataFrame(1).Define("a", [] { return ROOT::RVecD{1., 2.}; }).Define("b", [] {
+      return ROOT::RVecD{1.};
+   });
+   auto h = std::make_shared<RH1D>(RAxisConfig{10, 0., 10.});
+   auto r = df.Book<ROOT::RVecD, ROOT::RVecD>(RHistFillHelper<RH1D>(h, df.GetNSlots()), {"a", "b"});
+   EXPECT_THROW(r.GetValue(), std::runtime_error);
+}
+
+#ifdef R__USE_IMT
+TEST(RDFRHist, FillMT)
+{
+   ROOT::EnableImplicitMT(4);
+   // the weights are small integers, so the sums don't depend on the order of the fills
+   CheckFill(MakeDataFrame(100000), 100000);
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -843,6 +843,49 @@ TEST_P(RDFSimpleTests, HistosOneWeightPerEvent)
    EXPECT_DOUBLE_EQ(h3->GetMean(), 2.);
 }
 
+TEST_P(RDFSimpleTests, BatchedHistoFills)
+{
+   // more values than fit in the fill buffer of a slot, with some under- and overflows
+   auto df = RDataFrame(3000).Define("x", [](ULong64_t e) { return (e % 120) * 0.1 - 1.; }, {"rdfentry_"})
+                .Define("w", [](ULong64_t e) { return 1. + e % 3; }, {"rdfentry_"})
+                .Define("v", [](double x) { return ROOT::RVecF{float(x), float(2 * x), float(3 * x)}; }, {"x"});
+   const TH1DModel model{"h", "h", 20, 0., 10.};
+   auto hx = df.Histo1D<double>(model, "x");
+   auto hxw = df.Histo1D<double, double>(model, "x", "w");
+   auto hv = df.Histo1D<ROOT::RVecF>(model, "v");
+   auto hvw = df.Histo1D<ROOT::RVecF, double>(model, "v", "w");
+   auto hf = df.Fill<double>(TH1F("hf", "hf", 20, 0., 10.), {"x"});
+
+   TH1D refx("refx", "refx", 20, 0., 10.), refxw("refxw", "refxw", 20, 0., 10.);
+   TH1D refv("refv", "refv", 20, 0., 10.), refvw("refvw", "refvw", 20, 0., 10.);
+   for (ULong64_t e = 0; e < 3000; ++e) {
+      const double x = (e % 120) * 0.1 - 1.;
+      const double w = 1. + e % 3;
+      refx.Fill(x);
+      refxw.Fill(x, w);
+      for (auto m : {1.f, 2.f, 3.f}) {
+         refv.Fill(float(m * x));
+         refvw.Fill(float(m * x), w);
+      }
+   }
+
+   auto expectEqual = [](const TH1 &h, const TH1 &ref) {
+      EXPECT_EQ(h.GetEntries(), ref.GetEntries());
+      // the merge of the per-slot histograms can change the order of the sums
+      EXPECT_NEAR(h.GetMean(), ref.GetMean(), 1e-9);
+      EXPECT_NEAR(h.GetStdDev(), ref.GetStdDev(), 1e-9);
+      for (int i = 0; i <= ref.GetNbinsX() + 1; ++i) {
+         EXPECT_DOUBLE_EQ(h.GetBinContent(i), ref.GetBinContent(i));
+         EXPECT_DOUBLE_EQ(h.GetBinError(i), ref.GetBinError(i));
+      }
+   };
+   expectEqual(*hx, refx);
+   expectEqual(*hxw, refxw);
+   expectEqual(*hv, refv);
+   expectEqual(*hvw, refvw);
+   expectEqual(*hf, refx);
+}
+
 TEST_P(RDFSimpleTests, ManyRangesPerWorker)
 {
    auto filename = "ManyRangesPerWorker_file.root";
@@ -1008,6 +1051,27 @@ TEST_P(RDFSimpleTests, FillWithCustomClassJitted)
    EXPECT_EQ(h.GetEntries(), 10);
 }
 
+TEST_P(RDFSimpleTests, RVecArena)
+{
+   auto run = [](bool useArena, unsigned int blockSize) {
+      ROOT::RDataFrame df(1000);
+      df.EnableRVecArena(useArena);
+      df.SetBlockSize(blockSize);
+      // RVecs of up to 49 elements, with and without heap (or arena) allocations
+      auto d = df.Define("v", [](ULong64_t e) { return ROOT::RVecD(e % 50, 0.5 * e); }, {"rdfentry_"})
+                  .Define("w", [](const ROOT::RVecD &v) { return v * v + 1.; }, {"v"})
+                  .Filter([](const ROOT::RVecD &w) { return w.size() % 3 != 0; }, {"w"})
+                  .Define("s", [](const ROOT::RVecD &w) { return ROOT::VecOps::Sum(w); }, {"w"});
+      auto sum = d.Sum<double>("s");
+      auto h = d.Histo1D<ROOT::RVecD>("w");
+      return std::make_pair(*sum, h->GetEntries());
+   };
+
+   const auto expected = run(false, 0);
+   EXPECT_EQ(run(true, 0), expected);
+   EXPECT_EQ(run(true, 8), expected);
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
@@ -70,3 +70,34 @@ TEST(RDFSimpleTests, SplitCollectionArrayView)
    test_splitcoll_arrayview(fileName, treeName);
    gSystem->Unlink(fileName);
 }
+
+TEST(RDFSimpleTests, SplitCollectionRVecView)
+{
+   auto fileName = "myfile_test_splitcoll_rvecview.root";
+   auto treeName = "myTree";
+   fill_tree(fileName, treeName);
+   {
+      // no copy, hence no warning: the view looks at the data member of the elements of the non-split collection
+      ROOT::RDataFrame df(treeName, fileName);
+      auto sums =
+         df.Define("s", [](const ROOT::RVecView<float> &a) { return ROOT::VecOps::Sum(a); }, {"v.a"}).Take<float>("s");
+      auto nAbove = df.Define("n", [](const ROOT::RVecView<float> &a) { return int(ROOT::VecOps::Sum(a > 4.f)); },
+                              {"v.a"})
+                       .Sum<int>("n");
+      auto checks = df.Filter(
+                         [](const ROOT::RVecView<float> &a, const ROOT::RVec<TwoFloats> &v) {
+                            EXPECT_EQ(a.size(), v.size());
+                            for (std::size_t i = 0; i < a.size(); ++i)
+                               EXPECT_EQ(a[i], v[i].a);
+                            return true;
+                         },
+                         {"v.a", "v"})
+                       .Count();
+      ASSERT_EQ(sums->size(), 10u);
+      for (int i = 0; i < 10; ++i)
+         EXPECT_FLOAT_EQ((*sums)[i], i * (i + 1) / 2.f);
+      EXPECT_EQ(*nAbove, 15); // 1 + 2 + 3 + 4 + 5 elements above 4 in the last 5 entries
+      EXPECT_EQ(*checks, 10ull);
+   }
+   gSystem->Unlink(fileName);
+}
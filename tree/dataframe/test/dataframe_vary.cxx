@@ -3,6 +3,7 @@
 #include <ROOT/RDFHelpers.hxx>
 #include <TSystem.h>
 
+#include <atomic>
 #include <thread> // std::thread::hardware_concurrency
 
 #include "SimpleFiller.h" // for VaryFill
@@ -1587,6 +1588,38 @@ TEST_P(RDFVary, ManyVariationsManyColumns)
    }
 }
 
+// Filters and Defines that do not depend on the varied column are evaluated once per entry for all variations
+TEST_P(RDFVary, ManyVariationsInvariantNodes)
+{
+   std::atomic_int nFilterCalls{0};
+   std::atomic_int nDefineCalls{0};
+   auto d = ROOT::RDataFrame(10)
+               .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+               .Define("y",
+                       [&nDefineCalls](int x) {
+                          ++nDefineCalls;
+                          return 2 * x;
+                       },
+                       {"x"})
+               .Vary(
+                  "x", [](int x) { return ROOT::RVecI(300, x + 1); }, {"x"}, 300, "syst")
+               .Filter(
+                  [&nFilterCalls](int y) {
+                     ++nFilterCalls;
+                     return y % 4 == 0;
+                  },
+                  {"y"});
+
+   auto sx = d.Sum<int>("x");
+   auto sxs = ROOT::RDF::Experimental::VariationsFor(sx);
+
+   EXPECT_EQ(sxs["nominal"], 20);
+   for (int i = 0; i < 300; ++i)
+      EXPECT_EQ(sxs["syst:" + std::to_string(i)], 25);
+   EXPECT_EQ(nFilterCalls, 10);
+   EXPECT_EQ(nDefineCalls, 10);
+}
+
 // instantiate single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFVary, ::testing::Values(false));
 
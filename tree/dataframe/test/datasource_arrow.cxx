@@ -73,6 +73,18 @@ std::shared_ptr<Table> createTestTable()
    return table_;
 }
 
+// The same content as createTestTable, in chunks of 4 and 2 entries
+std::shared_ptr<Table> createChunkedTestTable()
+{
+   auto table = createTestTable();
+   std::vector<std::shared_ptr<ChunkedArray>> columns;
+   for (int i = 0; i < table->num_columns(); ++i) {
+      auto array = table->column(i)->chunk(0);
+      columns.emplace_back(std::make_shared<ChunkedArray>(ArrayVector{array->Slice(0, 4), array->Slice(4)}));
+   }
+   return Table::Make(table->schema(), columns);
+}
+
 TEST(RArrowDS, ColTypeNames)
 {
    RArrowDS tds(createTestTable(), {"Name", "Age", "Height", "Married", "Babies"});
@@ -113,6 +125,73 @@ TEST(RArrowDS, EntryRanges)
    EXPECT_EQ(6U, ranges[2].second);
 }
 
+TEST(RArrowDS, ChunkAlignedEntryRanges)
+{
+   RArrowDS tds(createChunkedTestTable(), {});
+   tds.SetNSlots(2U);
+   tds.Initialize();
+
+   // The first chunk is larger than 6/2 entries and is split, the second one is a range of its own
+   auto ranges = tds.GetEntryRanges();
+
+   ASSERT_EQ(3U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(2U, ranges[0].second);
+   EXPECT_EQ(2U, ranges[1].first);
+   EXPECT_EQ(4U, ranges[1].second);
+   EXPECT_EQ(4U, ranges[2].first);
+   EXPECT_EQ(6U, ranges[2].second);
+}
+
+TEST(RArrowDS, RecordBatchReader)
+{
+   auto table = createTestTable();
+   auto reader = std::make_shared<TableBatchReader>(*table);
+   reader->set_chunksize(4);
+   RArrowDS tds(reader, {});
+
+   EXPECT_EQ(5U, tds.GetColumnNames().size());
+   EXPECT_STREQ("Long64_t", tds.GetTypeName("Age").c_str());
+
+   tds.SetNSlots(1U);
+   auto valsAge = tds.GetColumnReaders<Long64_t>("Age");
+   auto valsName = tds.GetColumnReaders<std::string>("Name");
+   tds.Initialize();
+   tds.InitSlot(0U, 0ull);
+
+   std::vector<Long64_t> refsAge = {64, 50, 40, 30, 2, 0};
+   std::vector<std::string> refsName = {"Harry", "Bob,Bob", "\"Joe\"", "Tom", " John  ", " Mary Ann "};
+   std::vector<std::pair<ULong64_t, ULong64_t>> expectedRanges = {{0ull, 4ull}, {4ull, 6ull}};
+   for (auto &expected : expectedRanges) {
+      auto ranges = tds.GetEntryRanges();
+      ASSERT_EQ(1U, ranges.size());
+      EXPECT_EQ(expected, ranges[0]);
+      for (auto i : ROOT::TSeqU(ranges[0].first, ranges[0].second)) {
+         tds.SetEntry(0U, i);
+         EXPECT_EQ(refsAge[i], **valsAge[0]);
+         EXPECT_EQ(refsName[i], *((std::string *)*valsName[0]));
+      }
+   }
+   EXPECT_TRUE(tds.GetEntryRanges().empty());
+}
+
+TEST(RArrowDS, FromARDFRecordBatchReader)
+{
+   auto table = createTestTable();
+   auto reader = std::make_shared<TableBatchReader>(*table);
+   reader->set_chunksize(4);
+   auto rdf = MakeArrowDataFrame(reader, {});
+   auto sum = rdf.Sum<unsigned int>("Babies");
+   auto c = rdf.Filter("Married").Count();
+
+   EXPECT_EQ(31U, *sum);
+   EXPECT_EQ(3U, *c);
+
+   // the stream has been consumed by the first event loop
+   auto c2 = rdf.Count();
+   EXPECT_THROW(*c2, std::runtime_error);
+}
+
 TEST(RArrowDS, ColumnReaders)
 {
    RArrowDS tds(createTestTable(), {});
@@ -237,6 +316,29 @@ TEST(RArrowDS, FromARDFMT)
    EXPECT_DOUBLE_EQ(.8, *min);
 }
 
+TEST(RArrowDS, FromARDFChunkedMT)
+{
+   auto rdf = MakeArrowDataFrame(createChunkedTestTable(), {});
+   auto sum = rdf.Sum<unsigned int>("Babies");
+   auto names = rdf.Take<std::string>("Name");
+
+   EXPECT_EQ(31U, *sum);
+   EXPECT_EQ(6U, names->size());
+}
+
+TEST(RArrowDS, FromARDFRecordBatchReaderMT)
+{
+   auto table = createChunkedTestTable();
+   auto reader = std::make_shared<TableBatchReader>(*table);
+   reader->set_chunksize(1);
+   auto rdf = MakeArrowDataFrame(reader, {});
+   auto max = rdf.Max<double>("Height");
+   auto c = rdf.Count();
+
+   EXPECT_DOUBLE_EQ(200.5, *max);
+   EXPECT_EQ(6U, *c);
+}
+
 TEST(RArrowDS, FromARDFWithJittingMT)
 {
    std::unique_ptr<RDataSource> tds(new RArrowDS(createTestTable(), {}));
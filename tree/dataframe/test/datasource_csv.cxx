@@ -6,6 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+
 using namespace ROOT::RDF;
 
 auto fileName0 = "RCsvDS_test_headers.csv";
@@ -182,6 +185,47 @@ TEST(RCsvDS, ProgressiveReadingEntryRanges)
    EXPECT_EQ(2U, numIterations); // we should have processed 2 chunks
 }
 
+TEST(RCsvDS, ParseRangesOutOfOrder)
+{
+   const auto fileName = "RCsvDS_test_parseranges.csv";
+   {
+      std::ofstream f(fileName);
+      f << "x,y,s,b\r\n";
+      for (int i = 0; i < 1000; ++i) {
+         f << i << "," << i + 0.5 << ",\"s," << i << "\"," << (i % 2 ? "true" : "false") << "\r\n";
+         if (i % 100 == 0)
+            f << "\r\n";
+      }
+   }
+
+   RCsvDS tds(fileName);
+   const auto nSlots = 4U;
+   tds.SetNSlots(nSlots);
+   auto valsX = tds.GetColumnReaders<Long64_t>("x");
+   auto valsY = tds.GetColumnReaders<double>("y");
+   auto valsS = tds.GetColumnReaders<std::string>("s");
+   auto valsB = tds.GetColumnReaders<bool>("b");
+   tds.Initialize();
+   auto ranges = tds.GetEntryRanges();
+   ASSERT_EQ(nSlots, ranges.size());
+   EXPECT_EQ(1000U, ranges.back().second);
+
+   // every slot parses its own range, independently of the others
+   for (auto slot = nSlots; slot-- > 0;) {
+      for (auto i = ranges[slot].first; i < ranges[slot].second; ++i) {
+         tds.SetEntry(slot, i);
+         EXPECT_EQ(Long64_t(i), **valsX[slot]);
+         EXPECT_DOUBLE_EQ(i + 0.5, **valsY[slot]);
+         EXPECT_EQ("s," + std::to_string(i), **valsS[slot]);
+         EXPECT_EQ(i % 2 == 1, **valsB[slot]);
+      }
+   }
+   EXPECT_TRUE(tds.GetEntryRanges().empty());
+   tds.Finalize();
+
+   std::remove(fileName);
+}
+
 TEST(RCsvDS, ProgressiveReadingRDF)
 {
    // Even chunks
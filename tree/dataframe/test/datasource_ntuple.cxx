@@ -1,3 +1,4 @@
+#include <ROOT/RCacheOptions.hxx>
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RNTupleDS.hxx>
 #include <ROOT/RVec.hxx>
@@ -6,8 +7,14 @@
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <TSystem.h>
+
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
 using ROOT::Experimental::RNTupleDS;
 using ROOT::Experimental::RNTupleWriter;
 using ROOT::Experimental::RNTupleModel;
@@ -135,3 +142,113 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+static void SnapshotRNTupleTest(bool preserveOrder)
+{
+   const auto fileName = std::string("RNTupleDS_snapshot_") + (preserveOrder ? "ordered" : "unordered") + ".root";
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   opts.fPreserveEntryOrder = preserveOrder;
+
+   const ULong64_t nEntries = 10000;
+   auto out = ROOT::RDataFrame(nEntries)
+                 .Define("x", [](ULong64_t e) { return static_cast<int>(e); }, {"rdfentry_"})
+                 .Define("v", [](int x) { return ROOT::RVecF(x % 3, float(x)); }, {"x"})
+                 .Filter([](int x) { return x % 2 == 0; }, {"x"})
+                 .Snapshot("ntuple", fileName, {"x", "v"}, opts);
+
+   auto xs = out->Take<int>("x");
+   auto sizes = out->Define("n", [](const ROOT::RVecF &v) { return int(v.size()); }, {"v"}).Sum<int>("n");
+   ASSERT_EQ(xs->size(), nEntries / 2);
+   std::vector<int> sorted = *xs;
+   if (!preserveOrder)
+      std::sort(sorted.begin(), sorted.end());
+   int expectedSizes = 0;
+   for (std::size_t i = 0; i < sorted.size(); ++i) {
+      EXPECT_EQ(sorted[i], static_cast<int>(2 * i));
+      expectedSizes += (2 * i) % 3;
+   }
+   EXPECT_EQ(*sizes, expectedSizes);
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleSnapshot, Basics)
+{
+   SnapshotRNTupleTest(/*preserveOrder=*/false);
+}
+
+TEST(RNTupleSnapshot, MT)
+{
+   IMTRAII _;
+   SnapshotRNTupleTest(/*preserveOrder=*/false);
+}
+
+TEST(RNTupleSnapshot, MTPreserveOrder)
+{
+   IMTRAII _;
+   SnapshotRNTupleTest(/*preserveOrder=*/true);
+}
+
+TEST(RNTupleSnapshot, UnsupportedOptions)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto df = ROOT::RDataFrame(1).Define("x", [] { return 1; });
+   EXPECT_THROW(df.Snapshot("dir/ntuple", "RNTupleDS_snapshot_dir.root", {"x"}, opts), std::invalid_argument);
+   opts.fMode = "UPDATE";
+   EXPECT_THROW(df.Snapshot("ntuple", "RNTupleDS_snapshot_update.root", {"x"}, opts), std::invalid_argument);
+}
+
+static void RemoveDirectory(const char *dirName)
+{
+   void *dir = gSystem->OpenDirectory(dirName);
+   if (dir == nullptr)
+      return;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      if (std::string(entry) != "." && std::string(entry) != "..")
+         gSystem->Unlink((std::string(dirName) + "/" + entry).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(dirName);
+}
+
+static int gNCacheEvaluations = 0;
+
+static ROOT::RDF::RNode MakeCachedGraph(ULong64_t nEntries = 10)
+{
+   return ROOT::RDataFrame(nEntries)
+      .Define("x", [](ULong64_t e) { ++gNCacheEvaluations; return static_cast<int>(e); }, {"rdfentry_"})
+      .Filter("x % 2 == 0");
+}
+
+TEST(RNTupleCache, Persistent)
+{
+   const auto dirName = "RNTupleDS_cache";
+   RemoveDirectory(dirName);
+   ROOT::RDF::RCacheOptions opts;
+   opts.fPersistent = true;
+   opts.fDirectory = dirName;
+
+   auto evens = MakeCachedGraph().Cache({"x"}, opts);
+   EXPECT_EQ(gNCacheEvaluations, 10);
+   EXPECT_EQ(*evens.Take<int>("x"), std::vector<int>({0, 2, 4, 6, 8}));
+
+   // same graph and input dataset: read from the cache
+   auto cached = MakeCachedGraph().Cache({"x"}, opts);
+   EXPECT_EQ(gNCacheEvaluations, 10);
+   EXPECT_EQ(*cached.Take<int>("x"), std::vector<int>({0, 2, 4, 6, 8}));
+
+   // a different selection, input dataset or tag is a different cache entry
+   auto selected = MakeCachedGraph().Filter("x > 4").Cache({"x"}, opts);
+   EXPECT_EQ(gNCacheEvaluations, 20);
+   EXPECT_EQ(*selected.Count(), 2ull);
+   auto moreEntries = MakeCachedGraph(12).Cache({"x"}, opts);
+   EXPECT_EQ(gNCacheEvaluations, 32);
+   EXPECT_EQ(*moreEntries.Count(), 6ull);
+   opts.fTag = "v2";
+   MakeCachedGraph().Cache({"x"}, opts);
+   EXPECT_EQ(gNCacheEvaluations, 42);
+
+   RemoveDirectory(dirName);
+}
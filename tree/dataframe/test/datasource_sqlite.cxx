@@ -124,13 +124,11 @@ TEST(RSqliteDS, ColumnReaders)
 {
    RSqliteDS rds(fileName0, query0);
    const auto nSlots = 2U;
-   ROOT_EXPECT_WARNING(rds.SetNSlots(nSlots), "SetNSlots",
-                       "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                       "Consider turning off IMT.");
+   rds.SetNSlots(nSlots);
    auto vals = rds.GetColumnReaders<Long64_t>("fint");
    rds.Initialize();
    auto ranges = rds.GetEntryRanges();
-   EXPECT_EQ(1U, ranges.size());
+   EXPECT_EQ(2U, ranges.size());
    for (auto i : ROOT::TSeq<unsigned>(0, nSlots)) {
       EXPECT_TRUE(rds.SetEntry(i, ranges[0].first));
       auto val = **vals[i];
@@ -147,10 +145,6 @@ TEST(RSqliteDS, GetEntryRanges)
    auto ranges = rds.GetEntryRanges();
    ASSERT_EQ(1U, ranges.size());
    EXPECT_EQ(0U, ranges[0].first);
-   EXPECT_EQ(1U, ranges[0].second);
-   ranges = rds.GetEntryRanges();
-   ASSERT_EQ(1U, ranges.size());
-   EXPECT_EQ(1U, ranges[0].first);
    EXPECT_EQ(2U, ranges[0].second);
    ranges = rds.GetEntryRanges();
    EXPECT_EQ(0U, ranges.size());
@@ -160,7 +154,41 @@ TEST(RSqliteDS, GetEntryRanges)
    ranges = rds.GetEntryRanges();
    EXPECT_EQ(1U, ranges.size());
    EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(2U, ranges[0].second);
+}
+
+TEST(RSqliteDS, GetEntryRangesBatches)
+{
+   // One row per batch
+   RSqliteDS rds(fileName0, query0, 1);
+   rds.SetNSlots(2);
+   rds.Initialize();
+   auto ranges = rds.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(1U, ranges[0].second);
+   ranges = rds.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(1U, ranges[0].first);
+   EXPECT_EQ(2U, ranges[0].second);
+   ranges = rds.GetEntryRanges();
+   EXPECT_EQ(0U, ranges.size());
+
+   // Both rows in one batch, split between the two slots
+   RSqliteDS rds2(fileName0, query0);
+   rds2.SetNSlots(2);
+   auto vtext = rds2.GetColumnReaders<std::string>("ftext");
+   rds2.Initialize();
+   ranges = rds2.GetEntryRanges();
+   ASSERT_EQ(2U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
    EXPECT_EQ(1U, ranges[0].second);
+   EXPECT_EQ(1U, ranges[1].first);
+   EXPECT_EQ(2U, ranges[1].second);
+   EXPECT_TRUE(rds2.SetEntry(1, 1));
+   EXPECT_TRUE(rds2.SetEntry(0, 0));
+   EXPECT_EQ("1", **vtext[0]);
+   EXPECT_EQ("2", **vtext[1]);
 }
 
 TEST(RSqliteDS, SetEntry)
@@ -184,7 +212,6 @@ TEST(RSqliteDS, SetEntry)
    EXPECT_EQ('1', (**vblob[0])[0]);
    EXPECT_EQ(nullptr, **vnull[0]);
 
-   rds.GetEntryRanges();
    EXPECT_TRUE(rds.SetEntry(0, 1));
    EXPECT_EQ(2, **vint[0]);
    EXPECT_NEAR(2.0, **vreal[0], epsilon);
@@ -202,7 +229,6 @@ TEST(RSqliteDS, IMT)
    const auto nSlots = 4U;
    ROOT::EnableImplicitMT(nSlots);
 
-   ROOT::TestSupport::CheckDiagsRAII diagRAII{kWarning, "SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. Consider turning off IMT."};
    auto rdf = MakeSqliteDataFrame(fileName0, query0);
    EXPECT_EQ(3, *rdf.Sum("fint"));
    EXPECT_NEAR(3.0, *rdf.Sum("freal"), epsilon);
@@ -133,12 +133,14 @@ class ROnDiskPageMapHeap : public ROnDiskPageMap {
 private:
    /// The memory region containing the on-disk pages.
    std::unique_ptr<unsigned char []> fMemory;
+   /// The size of fMemory, accounted for the cluster pool in MemoryAccounting
+   std::size_t fSize = 0;
 public:
-   explicit ROnDiskPageMapHeap(std::unique_ptr<unsigned char []> memory) : fMemory(std::move(memory)) {}
+   explicit ROnDiskPageMapHeap(std::unique_ptr<unsigned char []> memory, std::size_t size = 0);
    ROnDiskPageMapHeap(const ROnDiskPageMapHeap &other) = delete;
    ROnDiskPageMapHeap(ROnDiskPageMapHeap &&other) = default;
    ROnDiskPageMapHeap &operator =(const ROnDiskPageMapHeap &other) = delete;
-   ROnDiskPageMapHeap &operator =(ROnDiskPageMapHeap &&other) = default;
+   ROnDiskPageMapHeap &operator =(ROnDiskPageMapHeap &&other);
    ~ROnDiskPageMapHeap() override;
 };
 
@@ -198,6 +200,8 @@ public:
    const ColumnSet_t &GetAvailColumns() const { return fAvailColumns; }
    bool ContainsColumn(DescriptorId_t columnId) const { return fAvailColumns.count(columnId) > 0; }
    size_t GetNOnDiskPages() const { return fOnDiskPages.size(); }
+   /// The sum of the packed and compressed sizes of the on-disk pages
+   std::size_t GetNBytesOnDisk() const;
 };
 
 } // namespace Detail
@@ -17,8 +17,10 @@
 #define ROOT7_RClusterPool
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -50,6 +52,12 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+In adaptive mode (RNTupleReadOptions::SetAdaptiveClusterBunchSize()), the cluster bunch size is adjusted whenever
+the main thread moves on to a new cluster. If the main thread had to wait for the previous cluster for more than
+a small fraction of the time it spent processing it, the bunch size is doubled. After a number of waiting-free
+bunches, the bunch size is decremented again. In any case, the bunch size is capped such that two bunches of
+clusters of the average size found in the pool fit in the configured pool memory.
 */
 // clang-format on
 class RClusterPool {
@@ -95,6 +103,24 @@ private:
    unsigned int fWindowPre = 0;
    /// The number of clusters that are being read in a single vector read.
    unsigned int fClusterBunchSize;
+   /// If true, fClusterBunchSize is adjusted by AdaptClusterBunchSize()
+   bool fIsAdaptive = false;
+   /// In adaptive mode, the upper limit for fClusterBunchSize
+   unsigned int fMaxClusterBunchSize;
+   /// In adaptive mode, the approximate limit for the compressed size of the clusters in the pool
+   std::size_t fMaxPoolSize = 0;
+   /// The cluster that has been returned by the last call to GetCluster()
+   DescriptorId_t fLastClusterId = kInvalidDescriptorId;
+   /// Time at which the last call to GetCluster() returned; used to measure the time the consumer spends on a cluster
+   std::chrono::steady_clock::time_point fLastReturnTime;
+   /// Time that the main thread was blocked waiting for the cluster fLastClusterId to arrive
+   std::chrono::steady_clock::duration fLastWaitTime{0};
+   /// The number of clusters since the last time the main thread had to wait for data
+   unsigned int fNClustersNoWait = 0;
+   /// Upper limit for the compressed size of the clusters that are unzipped together by one UnzipClusters() call.
+   /// Larger values give the task scheduler more pages to balance; the limit bounds the amount of memory that is
+   /// allocated for unzipped pages before the clusters are handed over to the main thread.
+   std::size_t fMaxUnzipGroupSize = kDefaultMaxUnzipGroupSize;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
@@ -120,8 +146,8 @@ private:
    /// data to arrive (blocked by the kernel) and therefore can safely run in addition to the application
    /// main threads.
    std::thread fThreadIo;
-   /// The unzip thread takes a loaded cluster and passes it to fPageSource->UnzipCluster() on it. If implicit
-   /// multi-threading is turned off, the UnzipCluster() call is a no-op. Otherwise, the UnzipCluster() call
+   /// The unzip thread takes the loaded clusters and passes them to fPageSource->UnzipClusters(). If implicit
+   /// multi-threading is turned off, the UnzipClusters() call is a no-op. Otherwise, the UnzipClusters() call
    /// schedules the unzipping of pages using the application's task scheduler.
    std::thread fThreadUnzip;
 
@@ -132,18 +158,27 @@ private:
    size_t FindFreeSlot() const;
    /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
    void ExecReadClusters();
-   /// The unzip thread routine which takes a loaded cluster and passes it to fPageSource.UnzipCluster (which
-   /// might be a no-op if IMT is off). Marks the cluster as ready to be picked up by the main thread.
+   /// The unzip thread routine which takes the loaded clusters and passes them to fPageSource.UnzipClusters (which
+   /// might be a no-op if IMT is off), in groups of at most fMaxUnzipGroupSize compressed bytes.
+   /// Marks the clusters as ready to be picked up by the main thread.
    void ExecUnzipClusters();
    /// Returns the given cluster from the pool, which needs to contain at least the columns `columns`.
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
    RCluster *WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns);
+   /// Called in adaptive mode by GetCluster() when the main thread moves on to a new cluster.  Updates
+   /// fClusterBunchSize according to the waiting time for the previous cluster and the memory use of the pool.
+   void AdaptClusterBunchSize();
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
+   static constexpr std::size_t kDefaultMaxUnzipGroupSize = 256 * 1024 * 1024;
+   /// In adaptive mode, the number of waiting-free bunches after which the bunch size is decremented
+   static constexpr unsigned int kNBunchesBeforeShrink = 8;
    RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
+   /// Uses the cluster bunch settings of the read options, including the adaptive mode
+   RClusterPool(RPageSource &pageSource, const RNTupleReadOptions &options);
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
    ~RClusterPool();
@@ -158,6 +193,8 @@ public:
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
+
+   unsigned int GetClusterBunchSize() const { return fClusterBunchSize; }
 }; // class RClusterPool
 
 } // namespace Detail
@@ -104,6 +104,9 @@ public:
       R__ASSERT(model.GetType() == ColumnT);
       auto column = new RColumn(model, index);
       column->fElement = std::unique_ptr<RColumnElementBase>(new RColumnElement<CppT, ColumnT>(nullptr));
+      if (model.GetBitsOnStorage() > 0)
+         column->fElement->SetBitsOnStorage(model.GetBitsOnStorage());
+      column->fElement->SetValueRange(model.GetValueRange().first, model.GetValueRange().second);
       return column;
    }
 
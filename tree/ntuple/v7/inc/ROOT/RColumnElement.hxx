@@ -28,6 +28,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #ifndef R__LITTLE_ENDIAN
 #ifdef R__BYTESWAP
@@ -98,7 +99,13 @@ public:
    virtual ~RColumnElementBase() = default;
 
    static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
+   /// Like Generate(EColumnType) but additionally applies the precision settings of the column model
+   static std::unique_ptr<RColumnElementBase> Generate(const RColumnModel &model);
    static std::size_t GetBitsOnStorage(EColumnType type);
+   /// Takes into account the number of bits of column types with configurable precision
+   static std::size_t GetBitsOnStorage(const RColumnModel &model);
+   /// The allowed number of bits on storage for column types with configurable precision, {0, 0} otherwise
+   static std::pair<std::size_t, std::size_t> GetValidBitRange(EColumnType type);
    static std::string GetTypeName(EColumnType type);
 
    /// Write one or multiple column elements into destination
@@ -114,6 +121,10 @@ public:
    /// Derived, typed classes tell whether the on-storage layout is bitwise identical to the memory layout
    virtual bool IsMappable() const { R__ASSERT(false); return false; }
    virtual std::size_t GetBitsOnStorage() const { R__ASSERT(false); return 0; }
+   /// Only column types with a configurable precision accept a number of bits different from their default
+   virtual void SetBitsOnStorage(std::size_t bitsOnStorage) { R__ASSERT(bitsOnStorage == GetBitsOnStorage()); }
+   /// Used by quantized column types; ignored otherwise
+   virtual void SetValueRange(double /* min */, double /* max */) {}
 
    /// If the on-storage layout and the in-memory layout differ, packing creates an on-disk page from an in-memory page
    virtual void Pack(void *destination, void *source, std::size_t count) const
@@ -160,6 +171,116 @@ public:
    }
 };
 
+/**
+ * Base class for columns in split encoding. On storage, the least significant bytes of all the elements of a page come
+ * first, followed by all the second bytes and so on. Bytes are taken from the value rather than from memory, so the
+ * split layout is independent of the architecture's byte order. Before splitting, index columns are delta encoded
+ * with respect to the previous element of the page and integer columns are zigzag encoded. Both transformations
+ * turn the typical small (absolute) values into runs of zero high-order bytes, which compress much better.
+ */
+template <typename CppT, typename UIntT, bool IsDeltaT, bool IsZigzagT>
+class RColumnElementSplitLE : public RColumnElementBase {
+   static_assert(sizeof(CppT) == sizeof(UIntT) && std::is_unsigned<UIntT>::value,
+                 "split encoding needs an unsigned integer of the element's size");
+   static constexpr std::size_t kNBits = sizeof(UIntT) * 8;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(CppT);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElementSplitLE(void *rawContent) : RColumnElementBase(rawContent, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      auto srcArray = reinterpret_cast<const unsigned char *>(src);
+      auto byteArray = reinterpret_cast<unsigned char *>(dst);
+      UIntT prev = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+         UIntT value;
+         std::memcpy(&value, srcArray + i * kSize, kSize);
+         UIntT encoded = value;
+         if (IsDeltaT) {
+            encoded = static_cast<UIntT>(value - prev);
+            prev = value;
+         }
+         if (IsZigzagT)
+            encoded = static_cast<UIntT>(encoded << 1) ^ static_cast<UIntT>(0 - (encoded >> (kNBits - 1)));
+         for (std::size_t b = 0; b < kSize; ++b)
+            byteArray[b * count + i] = static_cast<unsigned char>(encoded >> (8 * b));
+      }
+   }
+
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      auto byteArray = reinterpret_cast<const unsigned char *>(src);
+      auto dstArray = reinterpret_cast<unsigned char *>(dst);
+      UIntT prev = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+         UIntT value = 0;
+         for (std::size_t b = 0; b < kSize; ++b)
+            value |= static_cast<UIntT>(static_cast<UIntT>(byteArray[b * count + i]) << (8 * b));
+         if (IsZigzagT)
+            value = static_cast<UIntT>(value >> 1) ^ static_cast<UIntT>(0 - (value & 1));
+         if (IsDeltaT) {
+            value = static_cast<UIntT>(value + prev);
+            prev = value;
+         }
+         std::memcpy(dstArray + i * kSize, &value, kSize);
+      }
+   }
+};
+
+/**
+ * Base class for floating point columns stored as single precision floats with only the fBitsOnStorage most
+ * significant bits kept, i.e. sign, exponent and the upper part of the mantissa. Values are rounded to the nearest
+ * representable value. The packed elements are stored as a little-endian bit stream.
+ */
+template <typename CppT>
+class RColumnElementTrunc : public RColumnElementBase {
+   std::size_t fBitsOnStorage = 32;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(CppT);
+   explicit RColumnElementTrunc(void *rawContent) : RColumnElementBase(rawContent, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final { fBitsOnStorage = bitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
+/**
+ * Base class for floating point columns whose values are mapped linearly from the closed interval [fMin, fMax]
+ * onto the unsigned integers of fBitsOnStorage bits. Values outside the interval are clamped to its limits.
+ * The packed elements are stored as a little-endian bit stream.
+ */
+template <typename CppT>
+class RColumnElementQuant : public RColumnElementBase {
+   std::size_t fBitsOnStorage = 32;
+   double fMin = 0.0;
+   double fMax = 0.0;
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(CppT);
+   explicit RColumnElementQuant(void *rawContent) : RColumnElementBase(rawContent, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final { fBitsOnStorage = bitsOnStorage; }
+   void SetValueRange(double min, double max) final
+   {
+      fMin = min;
+      fMax = max;
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final;
+   void Unpack(void *dst, void *src, std::size_t count) const final;
+};
+
 /**
  * Pairs of C++ type and column type, like float and EColumnType::kReal32
  */
@@ -406,6 +527,67 @@ public:
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
 };
 
+template <>
+class RColumnElement<std::int16_t, EColumnType::kSplitInt16>
+   : public RColumnElementSplitLE<std::int16_t, std::uint16_t, false /* IsDeltaT */, true /* IsZigzagT */> {
+public:
+   explicit RColumnElement(std::int16_t *value) : RColumnElementSplitLE(value) {}
+};
+
+template <>
+class RColumnElement<std::uint16_t, EColumnType::kSplitInt16>
+   : public RColumnElementSplitLE<std::uint16_t, std::uint16_t, false /* IsDeltaT */, true /* IsZigzagT */> {
+public:
+   explicit RColumnElement(std::uint16_t *value) : RColumnElementSplitLE(value) {}
+};
+
+template <>
+class RColumnElement<std::int32_t, EColumnType::kSplitInt32>
+   : public RColumnElementSplitLE<std::int32_t, std::uint32_t, false /* IsDeltaT */, true /* IsZigzagT */> {
+public:
+   explicit RColumnElement(std::int32_t *value) : RColumnElementSplitLE(value) {}
+};
+
+template <>
+class RColumnElement<std::uint32_t, EColumnType::kSplitInt32>
+   : public RColumnElementSplitLE<std::uint32_t, std::uint32_t, false /* IsDeltaT */, true /* IsZigzagT */> {
+public:
+   explicit RColumnElement(std::uint32_t *value) : RColumnElementSplitLE(value) {}
+};
+
+template <>
+class RColumnElement<std::int64_t, EColumnType::kSplitInt64>
+   : public RColumnElementSplitLE<std::int64_t, std::uint64_t, false /* IsDeltaT */, true /* IsZigzagT */> {
+public:
+   explicit RColumnElement(std::int64_t *value) : RColumnElementSplitLE(value) {}
+};
+
+template <>
+class RColumnElement<std::uint64_t, EColumnType::kSplitInt64>
+   : public RColumnElementSplitLE<std::uint64_t, std::uint64_t, false /* IsDeltaT */, true /* IsZigzagT */> {
+public:
+   explicit RColumnElement(std::uint64_t *value) : RColumnElementSplitLE(value) {}
+};
+
+template <>
+class RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32>
+   : public RColumnElementSplitLE<ClusterSize_t, ClusterSize_t::ValueType, true /* IsDeltaT */, false /* IsZigzagT */> {
+public:
+   explicit RColumnElement(ClusterSize_t *value) : RColumnElementSplitLE(value) {}
+};
+
+template <>
+class RColumnElement<float, EColumnType::kReal32Trunc> : public RColumnElementTrunc<float> {
+public:
+   explicit RColumnElement(float *value) : RColumnElementTrunc(value) {}
+};
+
+template <>
+class RColumnElement<float, EColumnType::kReal32Quant> : public RColumnElementQuant<float> {
+public:
+   explicit RColumnElement(float *value) : RColumnElementQuant(value) {}
+};
+
 template <>
 class RColumnElement<RColumnSwitch, EColumnType::kSwitch> : public RColumnElementBase {
 public:
@@ -18,7 +18,9 @@
 
 #include <ROOT/RStringView.hxx>
 
+#include <cstdint>
 #include <string>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -50,6 +52,18 @@ enum class EColumnType {
    kInt32,
    kInt16,
    kInt8,
+   // Like kIndex but stored delta + split encoded, see RColumnElementSplitLE
+   kSplitIndex32,
+   // Like kInt64, kInt32, kInt16 but stored zigzag + split encoded
+   kSplitInt64,
+   kSplitInt32,
+   kSplitInt16,
+   // IEEE-754 single precision float with the least significant mantissa bits cut; the number of bits is
+   // set per column, see RColumnModel::GetBitsOnStorage()
+   kReal32Trunc,
+   // Floating point values linearly mapped onto the unsigned integers of a configurable number of bits
+   // over a fixed value range, see RColumnModel::GetValueRange()
+   kReal32Quant,
    kMax,
 };
 
@@ -64,16 +78,29 @@ class RColumnModel {
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// For column types of configurable precision, the number of bits per element on storage; zero if the number of
+   /// bits is given by the column type
+   std::uint16_t fBitsOnStorage = 0;
+   /// For quantized columns, the interval of values that is mapped onto the integers of fBitsOnStorage bits
+   std::pair<double, double> fValueRange{0.0, 0.0};
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
    RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted) {}
+   RColumnModel(EColumnType type, bool isSorted, std::uint16_t bitsOnStorage,
+                std::pair<double, double> valueRange = {0.0, 0.0})
+      : fType(type), fIsSorted(isSorted), fBitsOnStorage(bitsOnStorage), fValueRange(valueRange)
+   {
+   }
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   std::uint16_t GetBitsOnStorage() const { return fBitsOnStorage; }
+   std::pair<double, double> GetValueRange() const { return fValueRange; }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fBitsOnStorage == other.fBitsOnStorage) &&
+             (fValueRange == other.fValueRange);
    }
 };
 
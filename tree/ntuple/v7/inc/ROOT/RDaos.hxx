@@ -212,7 +212,8 @@ private:
      \param map A `MultiObjectRWOperation_t` that describes read/write operations to perform.
      \param cid The `daos_oclass_id_t` used to qualify OIDs.
      \param fn Either `&RDaosObject::Fetch` (read) or `&RDaosObject::Update` (write).
-     \return 0 if the operation succeeded; a negative DAOS error number otherwise.
+     \return 0 if the operation succeeded; a negative DAOS error number if the requests could not be launched or
+     awaited; otherwise, the number of requests that completed with an error.
      */
    int VectorReadWrite(MultiObjectRWOperation_t &map, ObjClassId_t cid,
                        int (RDaosObject::*fn)(RDaosObject::FetchUpdateArgs &));
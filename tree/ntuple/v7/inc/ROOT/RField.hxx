@@ -100,6 +100,9 @@ protected:
    RColumn* fPrincipalColumn;
    /// The columns are connected either to a sink or to a source (not to both); they are owned by the field.
    std::vector<std::unique_ptr<RColumn>> fColumns;
+   /// Integer and index columns of the field use split encoding, see RColumnElementSplitLE. When reading, it is set
+   /// according to the on-disk column type.
+   bool fIsSplitEncoded = false;
 
    /// Creates the backing columns corresponsing to the field type for writing
    virtual void GenerateColumnsImpl() = 0;
@@ -243,6 +246,12 @@ public:
    std::string GetDescription() const { return fDescription; }
    void SetDescription(std::string_view description) { fDescription = std::string(description); }
 
+   /// Selects the split encoding for the field's integer or index column. Small values and monotonic offsets
+   /// compress considerably better in split encoding. Needs to be set before the field is connected to a page sink;
+   /// it has no effect for other column types.
+   void SetSplitEncoding(bool value) { fIsSplitEncoded = value; }
+   bool IsSplitEncoded() const { return fIsSplitEncoded; }
+
    DescriptorId_t GetOnDiskId() const { return fOnDiskId; }
    void SetOnDiskId(DescriptorId_t id) { fOnDiskId = id; }
 
@@ -743,9 +752,15 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+private:
+   /// Real32 by default; SetTruncated() and SetQuantized() select a reduced precision on storage
+   RColumnModel fColumnModel{EColumnType::kReal32, false /* isSorted*/};
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+      auto clone = std::make_unique<RField>(newName);
+      clone->fColumnModel = fColumnModel;
+      return clone;
    }
 
 public:
@@ -759,6 +774,15 @@ public:
    void GenerateColumnsImpl() final;
    void GenerateColumnsImpl(const RNTupleDescriptor &desc) final;
 
+   /// Store the values as single precision floats cut to their nBits most significant bits, i.e. with nBits - 9
+   /// bits of mantissa. Like Float16_t in TTree. Needs to be set before the field is connected to a page sink.
+   void SetTruncated(std::size_t nBits);
+   /// Store the values as nBits unsigned integers that linearly map onto [minValue, maxValue]. Values outside the
+   /// range are clamped. Like Float16_t with a range in TTree. Needs to be set before connecting to a page sink.
+   void SetQuantized(double minValue, double maxValue, std::size_t nBits);
+   /// After connecting to a page source, reflects the on-disk representation
+   const RColumnModel &GetColumnModel() const { return fColumnModel; }
+
    float *Map(NTupleSize_t globalIndex) {
       return fPrincipalColumn->Map<float>(globalIndex);
    }
@@ -32,8 +32,10 @@
 
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -435,6 +437,109 @@ public:
    const RNTupleModel *GetModel() const { return fModel.get(); }
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A fill context of an RNTupleParallelWriter, to be used by a single thread
+
+Every fill context has its own clone of the model and its own cluster.  Filled entries are serialized and
+compressed within the calling thread.  Complete clusters are written to the shared page sink of the parallel
+writer, which assigns the entry range of the clusters in the order in which they are committed (or, with staged
+cluster committing, in the order of the CommitStagedClusters() calls).
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   NTupleSize_t fLastCommitted = 0;
+   NTupleSize_t fNEntries = 0;
+   /// Keeps track of the number of bytes written into the current cluster
+   std::size_t fUnzippedClusterSize = 0;
+   /// Limit for committing cluster no matter the other tunables
+   std::size_t fMaxUnzippedClusterSize;
+   /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
+   NTupleSize_t fUnzippedClusterSizeEst;
+
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   ~RNTupleFillContext();
+
+   void Fill() { Fill(*fModel->GetDefaultEntry()); }
+   /// The entry must have been created by CreateEntry() of this very fill context
+   void Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      for (auto &value : entry) {
+         fUnzippedClusterSize += value.GetField()->Append(value);
+      }
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+   }
+   /// Write the entries filled so far into a new cluster of the shared sink
+   void CommitCluster();
+   /// From now on, keep committed clusters in memory until CommitStagedClusters() instead of writing them to the
+   /// shared sink.  This lets the caller control the order of the clusters of different fill contexts.
+   void EnableStagedClusterCommitting();
+   /// Commit the open cluster and write all the staged clusters to the shared sink
+   void CommitStagedClusters();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+   /// The number of entries filled through this context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled concurrently from several threads
+
+Similar to TBufferMerger for TTree: every thread obtains its own fill context by CreateFillContext() and fills
+entries through it.  The fill contexts share a single page sink.  Clusters are written as a whole, so entries
+filled through the same context stay together within a cluster, but the order of entries of different contexts
+is unspecified.  All fill contexts must be destructed before the parallel writer.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// Serializes access to the shared sink
+   std::mutex fMutex;
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The model of the shared sink; fill contexts use clones of this model
+   std::unique_ptr<RNTupleModel> fModel;
+   /// The total number of entries committed to fSink, protected by fMutex
+   NTupleSize_t fNEntries = 0;
+   std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
+
+public:
+   /// Throws an exception if the model is null.
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName, std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model or the sink is null.  The sink must not be a buffered sink.
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Creates a new fill context, which must be used by only one thread at a time.  Thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RCollectionNTuple
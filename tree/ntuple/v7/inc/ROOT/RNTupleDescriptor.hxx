@@ -30,6 +30,7 @@
 #include <map>
 #include <memory>
 #include <ostream>
+#include <optional>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -205,12 +206,22 @@ public:
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
 
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// Value range of the elements of a numerical column in a cluster, see
+      /// RNTupleWriteOptions::SetEnableColumnStatistics().  The bounds are stored as double; for 64bit integers,
+      /// they are widened such that they still enclose all the values.
+      struct RStatistics {
+         double fMin = 0.0;
+         double fMax = 0.0;
+
+         bool operator==(const RStatistics &other) const { return fMin == other.fMin && fMax == other.fMax; }
+      };
+      /// Only set if statistics have been collected for this column
+      std::optional<RStatistics> fStatistics;
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fStatistics == other.fStatistics;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -864,6 +875,9 @@ public:
 
    RResult<void> CommitColumnRange(DescriptorId_t columnId, std::uint64_t firstElementIndex,
                                    std::uint32_t compressionSettings, const RClusterDescriptor::RPageRange &pageRange);
+   /// Attaches value statistics to a column range that has been committed before
+   RResult<void>
+   SetColumnStatistics(DescriptorId_t columnId, const RClusterDescriptor::RColumnRange::RStatistics &statistics);
 
    /// Move out the full cluster descriptor including page locations
    RResult<RClusterDescriptor> MoveDescriptor();
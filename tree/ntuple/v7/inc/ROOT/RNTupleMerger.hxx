@@ -19,6 +19,16 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RSpan.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -38,6 +48,54 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates ntuples with identical schema by copying their compressed pages
+
+The merger fast-clones the sealed (compressed) pages of all the clusters of the input sources into the destination
+sink, i.e. pages are neither decompressed nor recompressed.  This requires that the input ntuples have the same
+schema and that their pages are compressed with the compression settings of the destination.
+
+Reading and writing are pipelined: while the pages of a cluster are committed to the destination, the pages of
+the next cluster are read from the source in a background thread.  At most two clusters are held in memory at
+any time.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// The sealed pages of a single cluster of a source, re-indexed by the column ids of the destination
+   struct RClusterPages {
+      /// Number of entries in the cluster
+      NTupleSize_t fNEntries = 0;
+      /// Holds the on-disk bytes of all the pages of the cluster
+      std::unique_ptr<unsigned char[]> fBuffer;
+      /// The sealed pages, pointing into fBuffer; indexed by the destination column id
+      std::vector<Detail::RPageStorage::SealedPageSequence_t> fSealedPages;
+      /// The column statistics of the cluster, as pairs of destination column id and statistics
+      std::vector<std::pair<DescriptorId_t, RClusterDescriptor::RColumnRange::RStatistics>> fStatistics;
+   };
+
+   /// Maps the column ids of a source to the column ids of the destination
+   using ColumnIdMap_t = std::unordered_map<DescriptorId_t, DescriptorId_t>;
+
+   /// Returns a map from "qualified field name.column index" to the column id
+   static std::unordered_map<std::string, DescriptorId_t> GetColumnNames(const RNTupleDescriptor &desc);
+   /// Verifies that the source schema matches the destination schema and returns the column id mapping
+   static ColumnIdMap_t MapColumns(const RNTupleDescriptor &source, const RNTupleDescriptor &destination);
+   /// Reads all sealed pages of the given cluster
+   static RClusterPages LoadClusterPages(Detail::RPageSource &source, const RNTupleDescriptor &desc,
+                                         DescriptorId_t clusterId, const ColumnIdMap_t &columnIdMap,
+                                         int compression);
+
+public:
+   /// Appends the entries of all sources, in order, to the destination.  The sources are attached by the merger
+   /// and the destination is created from the schema of the first source.  The destination is committed
+   /// (CommitDataset) when the merge completes.  Throws an RException if the sources cannot be fast-cloned.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -60,6 +60,8 @@ class RNTupleWriteOptions {
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
    bool fUseBufferedWrite = true;
+   /// If set, the page sink records the minimum and maximum value of numerical columns for every cluster
+   bool fEnableColumnStatistics = false;
 
 public:
    virtual ~RNTupleWriteOptions() = default;
@@ -85,6 +87,9 @@ public:
 
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   bool GetEnableColumnStatistics() const { return fEnableColumnStatistics; }
+   void SetEnableColumnStatistics(bool val) { fEnableColumnStatistics = val; }
 };
 
 // clang-format off
@@ -129,12 +134,37 @@ public:
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// If turned on, the cluster pool starts with fClusterBunchSize and adjusts the bunch size at runtime: it grows
+   /// while the reader has to wait for clusters to arrive and it shrinks when waiting stopped or when the clusters
+   /// in the pool would exceed fMaxClusterPoolSize
+   bool fAdaptiveClusterBunchSize = false;
+   /// Upper limit for the cluster bunch size in adaptive mode
+   unsigned int fMaxClusterBunchSize = 16;
+   /// Approximate limit for the compressed size of the clusters kept in the cluster pool in adaptive mode
+   std::size_t fMaxClusterPoolSize = 512 * 1024 * 1024;
+   /// If turned on, unsealed pages are shared with other page sources of the process through
+   /// RPageCache::GetShared(), so that the same pages are decompressed only once
+   bool fUseSharedPageCache = false;
+   /// If turned on, local files are memory-mapped as a whole. Clusters then reference the on-disk pages in the
+   /// mapping instead of reading them into a heap buffer, and uncompressed pages whose on-disk and in-memory
+   /// representations match are handed out without a copy.
+   bool fUseMmap = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   bool GetAdaptiveClusterBunchSize() const { return fAdaptiveClusterBunchSize; }
+   void SetAdaptiveClusterBunchSize(bool val) { fAdaptiveClusterBunchSize = val; }
+   unsigned int GetMaxClusterBunchSize() const { return fMaxClusterBunchSize; }
+   void SetMaxClusterBunchSize(unsigned int val) { fMaxClusterBunchSize = val; }
+   std::size_t GetMaxClusterPoolSize() const { return fMaxClusterPoolSize; }
+   void SetMaxClusterPoolSize(std::size_t val) { fMaxClusterPoolSize = val; }
+   bool GetUseSharedPageCache() const { return fUseSharedPageCache; }
+   void SetUseSharedPageCache(bool val) { fUseSharedPageCache = val; }
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
 };
 
 } // namespace Experimental
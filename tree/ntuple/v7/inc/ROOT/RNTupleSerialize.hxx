@@ -64,6 +64,9 @@ public:
    static constexpr std::uint32_t kFlagSortAscColumn     = 0x01;
    static constexpr std::uint32_t kFlagSortDesColumn     = 0x02;
    static constexpr std::uint32_t kFlagNonNegativeColumn = 0x04;
+   static constexpr std::uint32_t kFlagValueRangeColumn  = 0x08;
+
+   static constexpr std::uint32_t kFlagColumnStatistics = 0x01;
 
    static constexpr DescriptorId_t kZeroFieldId = std::uint64_t(-2);
 
@@ -18,8 +18,10 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -68,6 +70,9 @@ public:
    RNTupleGlobalRange(NTupleSize_t start, NTupleSize_t end) : fStart(start), fEnd(end) {}
    RIterator begin() { return RIterator(fStart); }
    RIterator end() { return RIterator(fEnd); }
+   NTupleSize_t GetFirst() const { return fStart; }
+   NTupleSize_t GetLast() const { return fEnd - 1; }
+   NTupleSize_t GetSize() const { return fEnd - fStart; }
 };
 
 
@@ -145,7 +150,9 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top-level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access. For such fields, the
+elements can also be accessed in bulk, page by page, through MapSpan() and ForEachSpan(). The returned spans
+point directly into the unzipped pages of the page pool.
 */
 // clang-format on
 template <typename T>
@@ -216,6 +223,33 @@ public:
    MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Returns the elements from globalIndex up to the end of the page that contains globalIndex. No data is copied.
+   /// The span remains valid until the view is used to access an element on another page.
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   MapSpan(NTupleSize_t globalIndex) {
+      NTupleSize_t nItems;
+      const C *buffer = fField.MapV(globalIndex, nItems);
+      return std::span<const C>(buffer, nItems);
+   }
+
+   /// Calls `func(firstIndex, span)` for consecutive spans of elements that cover the given range. Every span covers
+   /// (part of) a single page and is only valid during the call to `func`. No data is copied.
+   template <typename FuncT, typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<RField<C>>::value>
+   ForEachSpan(const RNTupleGlobalRange &range, FuncT &&func) {
+      NTupleSize_t index = range.GetFirst();
+      NTupleSize_t nRemaining = range.GetSize();
+      while (nRemaining > 0) {
+         NTupleSize_t nItems;
+         const C *buffer = fField.MapV(index, nItems);
+         nItems = std::min(nItems, nRemaining);
+         func(index, std::span<const C>(buffer, nItems));
+         index += nItems;
+         nRemaining -= nItems;
+      }
+   }
 };
 
 
@@ -0,0 +1,119 @@
+/// \file ROOT/RPageCache.hxx
+/// \ingroup NTuple ROOT7
+/// \author Jakob Blomer <jblomer@cern.ch>
+/// \date 2022-11-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageCache
+#define ROOT7_RPageCache
+
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageCache
+\ingroup NTuple
+\brief A process-wide, size-bounded cache of unsealed page buffers shared by page sources
+
+Page sources that have RNTupleReadOptions::SetUseSharedPageCache() turned on look up decompressed and unpacked
+pages in the cache before unsealing them, and they add the pages they unseal. Thus multiple readers of the same
+ntuple, e.g. RDataFrame slots or repeated passes over the data, decompress every page only once.
+
+Page sources copy the buffers they find in the cache, which is much cheaper than decompression and keeps the
+memory of every page in a page pool distinct. The buffers inserted by a page source are shared with the source's own
+page. When the cache grows larger than its maximum size, the least recently used buffers are evicted. The cache is
+thread-safe.
+*/
+// clang-format on
+class RPageCache {
+public:
+   /// Identifies a page of a certain ntuple. The storage id names the ntuple, e.g. by its file and name. The
+   /// element size distinguishes different in-memory representations of the same on-disk page.
+   struct RKey {
+      std::string fStorageId;
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      NTupleSize_t fPageNo = 0;
+      std::size_t fElementSize = 0;
+
+      bool operator==(const RKey &other) const
+      {
+         return fStorageId == other.fStorageId && fColumnId == other.fColumnId && fClusterId == other.fClusterId &&
+                fPageNo == other.fPageNo && fElementSize == other.fElementSize;
+      }
+   };
+   using Buffer_t = std::shared_ptr<unsigned char[]>;
+
+   static constexpr std::size_t kDefaultMaxSize = 256 * 1024 * 1024;
+
+private:
+   struct RKeyHash {
+      std::size_t operator()(const RKey &key) const;
+   };
+   struct REntry {
+      RKey fKey;
+      Buffer_t fBuffer;
+      std::size_t fSize;
+   };
+
+   std::mutex fLock;
+   std::size_t fMaxSize;
+   /// The sum of the sizes of the cached buffers
+   std::size_t fSize = 0;
+   /// Most recently used entries first
+   std::list<REntry> fEntries;
+   std::unordered_map<RKey, std::list<REntry>::iterator, RKeyHash> fIndex;
+
+   /// Drops entries from the tail of fEntries until the cache fits into maxSize; expects the lock to be held
+   void EvictUntil(std::size_t maxSize);
+
+public:
+   /// The cache used by all page sources of the process
+   static RPageCache &GetShared();
+
+   explicit RPageCache(std::size_t maxSize = kDefaultMaxSize) : fMaxSize(maxSize) {}
+   RPageCache(const RPageCache &) = delete;
+   RPageCache &operator=(const RPageCache &) = delete;
+   ~RPageCache() = default;
+
+   /// Returns an empty buffer if the page is not in the cache
+   Buffer_t Find(const RKey &key);
+   /// Adds a buffer of the given size in bytes. Buffers larger than the maximum cache size are not added. If the key
+   /// is already in the cache, e.g. because of a concurrent insertion, the cached buffer is kept.
+   void Insert(const RKey &key, Buffer_t buffer, std::size_t size);
+   void Clear();
+
+   std::size_t GetMaxSize();
+   void SetMaxSize(std::size_t maxSize);
+   std::size_t GetSize();
+   std::size_t GetNPages();
+};
+
+} // namespace Detail
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
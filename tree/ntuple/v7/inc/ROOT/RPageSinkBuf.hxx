@@ -21,9 +21,11 @@
 #include <ROOT/RPageStorage.hxx>
 
 #include <deque>
+#include <future>
 #include <iterator>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -35,6 +37,12 @@ namespace Detail {
 \ingroup NTuple
 \brief Wrapper sink that coalesces cluster column page writes
 *
+* If a task scheduler is set, pages are sealed in parallel tasks as soon as they are committed.  Once all the pages
+* of a cluster are sealed, they are written to the inner sink in a background thread while the next cluster is
+* being filled.  Without a task scheduler, the pages are sealed when the cluster is committed.  In both cases, the
+* inner sink receives all the pages of a cluster in a single CommitSealedPageV() call, which it can use to batch the
+* writes.
+*
 * TODO(jblomer): The interplay of derived class and RPageSink is not yet optimally designed for page storage wrapper
 * classes like this one. Header and footer serialization, e.g., are done twice.  To be revised.
 */
@@ -126,6 +134,25 @@ private:
    /// Vector of buffered column pages. Indexed by column id.
    std::vector<RColumnBuf> fBufferedColumns;
 
+   /// A cluster whose sealed pages are written to the inner sink in the background
+   struct RPendingCluster {
+      NTupleSize_t fNEntries = 0;
+      /// Owns the pages and the compression buffers referenced by fToCommit
+      std::deque<RColumnBuf::BufferedPages_t> fPages;
+      std::vector<RSealedPageGroup> fToCommit;
+      /// The column statistics collected by this sink, to be passed on to the inner sink
+      std::vector<ColumnStatistics_t> fStatistics;
+   };
+   RPendingCluster fPendingCluster;
+   /// Set while fPendingCluster is being committed to the inner sink.  Declared last so that it is destructed
+   /// (i.e., the background commit is awaited) before the other members.
+   std::future<void> fPendingCommit;
+
+   /// Waits for the background commit of the previous cluster, if any, and rethrows its exceptions
+   void WaitForPendingCommit();
+   /// Passes on the given column statistics of the open cluster to the inner sink
+   void CommitStatistics(const std::vector<ColumnStatistics_t> &statistics);
+
 protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
    RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
@@ -140,7 +167,7 @@ public:
    RPageSinkBuf& operator=(const RPageSinkBuf&) = delete;
    RPageSinkBuf(RPageSinkBuf&&) = default;
    RPageSinkBuf& operator=(RPageSinkBuf&&) = default;
-   ~RPageSinkBuf() override = default;
+   ~RPageSinkBuf() override;
 
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
    void ReleasePage(RPage &page) final;
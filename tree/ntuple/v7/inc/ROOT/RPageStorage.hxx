@@ -31,6 +31,7 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_set>
 #include <vector>
@@ -202,6 +203,13 @@ protected:
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
+   using ColumnStatistics_t = std::optional<RClusterDescriptor::RColumnRange::RStatistics>;
+   /// Scans a committed page and widens the column statistics accordingly
+   using StatisticsUpdateFunc_t = void (*)(const RPage &page, ColumnStatistics_t &statistics);
+   /// If column statistics are enabled, the update functions of the numerical columns.  Indexed by column id,
+   /// nullptr for columns that do not record statistics.
+   std::vector<StatisticsUpdateFunc_t> fStatisticsUpdaters;
+
    virtual void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) = 0;
    virtual RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) = 0;
    virtual RNTupleLocator CommitSealedPageImpl(DescriptorId_t columnId,
@@ -257,6 +265,8 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return *fOptions; }
+   /// Returns the descriptor of the data written so far
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -271,6 +281,9 @@ public:
    void CommitSealedPage(DescriptorId_t columnId, const RPageStorage::RSealedPage &sealedPage);
    /// Write a vector of preprocessed pages to storage. The corresponding columns must have been added before.
    void CommitSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges);
+   /// Widen the statistics of the given column in the currently open cluster.  Used to pass on the statistics
+   /// of pages that are committed in sealed form, i.e. whose content cannot be inspected anymore by this sink.
+   void UpdateColumnStatistics(DescriptorId_t columnId, const RClusterDescriptor::RColumnRange::RStatistics &stats);
    /// Finalize the current cluster and create a new one for the following data.
    /// Returns the number of bytes written to storage (excluding meta-data).
    std::uint64_t CommitCluster(NTupleSize_t nEntries);
@@ -381,7 +394,9 @@ protected:
    std::unique_ptr<RNTupleDecompressor> fDecompressor;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
-   // Only called if a task scheduler is set. No-op be default.
+   /// Only called if a task scheduler is set. No-op be default. Implementations add one task per page to the task
+   /// scheduler; they must neither reset nor wait for the task scheduler. That is done by UnzipClusters(), so that
+   /// the pages of several clusters can be decompressed by a single group of tasks.
    virtual void UnzipClusterImpl(RCluster * /* cluster */)
       { }
 
@@ -414,6 +429,13 @@ public:
                                               const RNTupleReadOptions &options = RNTupleReadOptions());
    /// Open the same storage multiple time, e.g. for reading in multiple threads
    virtual std::unique_ptr<RPageSource> Clone() const = 0;
+   /// Like Clone() but the new page source uses the given read options instead of the ones of this page source
+   std::unique_ptr<RPageSource> CloneWithOptions(const RNTupleReadOptions &options) const
+   {
+      auto clone = Clone();
+      clone->fOptions = options;
+      return clone;
+   }
 
    EPageStorageType GetType() final { return EPageStorageType::kSource; }
    const RNTupleReadOptions &GetReadOptions() const { return fOptions; }
@@ -466,6 +488,10 @@ public:
    /// actual implementation will only run if a task scheduler is set. In practice, a task scheduler is set
    /// if implicit multi-threading is turned on.
    void UnzipCluster(RCluster *cluster);
+   /// Like UnzipCluster() but for several clusters at once. The pages of all the given clusters are scheduled
+   /// in the same task group, which lets the task scheduler balance large and small pages across clusters and
+   /// columns. Returns once all the pages are unzipped.
+   void UnzipClusters(std::span<RCluster *> clusters);
 
    /// Returns the default metrics object.  Subclasses might alternatively override the method and provide their own metrics object.
    RNTupleMetrics &GetMetrics() override { return fMetrics; };
@@ -19,6 +19,7 @@
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleSerialize.hxx>
 #include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageCache.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
@@ -141,6 +142,8 @@ private:
    RNTupleDescriptorBuilder fDescriptorBuilder;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// Identifies the ntuple in the shared page cache; empty if the shared page cache is not used
+   std::string fSharedPageCacheId;
 
    /// Deserialized header and footer into a minimal descriptor held by fDescriptorBuilder
    void InitDescriptor(const Internal::RFileNTupleAnchor &anchor);
@@ -151,6 +154,18 @@ private:
                                                             std::string_view path, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Creates a page from a buffer of the RPageCache. If isCopy is true, the page gets its own copy of the buffer;
+   /// otherwise it shares the memory with the cache. The page is registered with the page pool if isPreload is
+   /// false and preloaded otherwise.
+   RPage MakeSharedPage(DescriptorId_t columnId, const RPageCache::Buffer_t &buffer, std::size_t elementSize,
+                        ClusterSize_t::ValueType nElements, NTupleSize_t rangeFirst,
+                        const RPage::RClusterInfo &clusterInfo, bool isCopy, bool isPreload);
+
+   /// Creates a page whose buffer references the sealed page in the memory-mapped file (see
+   /// RNTupleReadOptions::SetUseMmap()). Returns a null page if the sealed page is not part of the mapping or if it
+   /// needs to be decompressed or unpacked. The page is neither registered nor preloaded with the page pool.
+   RPage MakeMappedPage(DescriptorId_t columnId, const RSealedPage &sealedPage, std::uint64_t position,
+                        const RColumnElementBase &element);
 
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
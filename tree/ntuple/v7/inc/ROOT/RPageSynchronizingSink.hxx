@@ -0,0 +1,111 @@
+/// \file ROOT/RPageSynchronizingSink.hxx
+/// \ingroup NTuple ROOT7
+/// \author Jakob Blomer <jblomer@cern.ch>
+/// \date 2022-11-02
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageSynchronizingSink
+#define ROOT7_RPageSynchronizingSink
+
+#include <ROOT/RPageStorage.hxx>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSynchronizingSink
+\ingroup NTuple
+\brief Wrapper sink that seals pages locally and forwards full clusters to a sink shared between threads
+*
+* Every fill context of a parallel writer owns one synchronizing sink.  Pages are sealed (packed and compressed)
+* in the thread that fills them, so that compression runs in parallel.  On CommitCluster(), the sealed pages are
+* committed to the shared inner sink under the given mutex, which also assigns the entry range of the cluster.
+* The inner sink must have been created with the same model as the one used for this sink.
+*
+* If cluster staging is enabled, committed clusters are kept in memory until CommitStagedClusters(), which lets the
+* owner decide the order of the clusters of different synchronizing sinks in the inner sink.
+*/
+// clang-format on
+class RPageSynchronizingSink : public RPageSink {
+private:
+   /// The sealed pages of a column in the currently open cluster together with the memory they point to
+   struct RColumnPages {
+      RPageStorage::SealedPageSequence_t fSealedPages;
+      std::vector<std::unique_ptr<unsigned char[]>> fBuffers;
+
+      RColumnPages() = default;
+      RColumnPages(const RColumnPages &) = delete;
+      RColumnPages &operator=(const RColumnPages &) = delete;
+      RColumnPages(RColumnPages &&) = default;
+      RColumnPages &operator=(RColumnPages &&) = default;
+   };
+
+   /// The shared sink, responsible for actually performing I/O
+   RPageSink &fInnerSink;
+   /// Protects fInnerSink and fInnerNEntries
+   std::mutex &fMutex;
+   /// The number of entries committed to the inner sink by all the synchronizing sinks
+   NTupleSize_t &fInnerNEntries;
+   /// The number of entries committed by this sink
+   NTupleSize_t fNEntries = 0;
+   /// The pages of the currently open cluster, indexed by column id
+   std::vector<RColumnPages> fBufferedColumns;
+
+   /// A committed cluster that has not yet been forwarded to the inner sink
+   struct RStagedCluster {
+      NTupleSize_t fNEntries = 0;
+      std::vector<RColumnPages> fColumns;
+      std::vector<std::optional<RClusterDescriptor::RColumnRange::RStatistics>> fStatistics;
+   };
+   bool fStageClusters = false;
+   std::vector<RStagedCluster> fStagedClusters;
+
+   /// Forward a cluster to the inner sink; fMutex must be locked by the caller
+   std::uint64_t CommitToInnerSink(RStagedCluster &cluster);
+
+protected:
+   void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final;
+   RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) final;
+   void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) final;
+
+public:
+   RPageSynchronizingSink(RPageSink &inner, std::mutex &mutex, NTupleSize_t &innerNEntries);
+   RPageSynchronizingSink(const RPageSynchronizingSink &) = delete;
+   RPageSynchronizingSink &operator=(const RPageSynchronizingSink &) = delete;
+   ~RPageSynchronizingSink() override = default;
+
+   /// Keep committed clusters in memory instead of forwarding them to the inner sink
+   void EnableStagedClusters() { fStageClusters = true; }
+   /// Forward the staged clusters to the inner sink, in the order in which they were committed
+   void CommitStagedClusters();
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
+   void ReleasePage(RPage &page) final;
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -14,6 +14,7 @@
  *************************************************************************/
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RMemoryAccounting.hxx>
 
 #include <TError.h>
 
@@ -27,7 +28,31 @@ ROOT::Experimental::Detail::ROnDiskPageMap::~ROnDiskPageMap() = default;
 ////////////////////////////////////////////////////////////////////////////////
 
 
-ROOT::Experimental::Detail::ROnDiskPageMapHeap::~ROnDiskPageMapHeap() = default;
+ROOT::Experimental::Detail::ROnDiskPageMapHeap::ROnDiskPageMapHeap(std::unique_ptr<unsigned char[]> memory,
+                                                                   std::size_t size)
+   : fMemory(std::move(memory)), fSize(size)
+{
+   if (fMemory)
+      MemoryAccounting::Add(EMemoryTag::kClusterPool, fSize);
+}
+
+ROOT::Experimental::Detail::ROnDiskPageMapHeap &
+ROOT::Experimental::Detail::ROnDiskPageMapHeap::operator=(ROnDiskPageMapHeap &&other)
+{
+   if (fMemory)
+      MemoryAccounting::Add(EMemoryTag::kClusterPool, -std::int64_t(fSize));
+   ROnDiskPageMap::operator=(std::move(other));
+   fMemory = std::move(other.fMemory);
+   fSize = other.fSize;
+   return *this;
+}
+
+ROOT::Experimental::Detail::ROnDiskPageMapHeap::~ROnDiskPageMapHeap()
+{
+   // A moved-from page map does not own memory anymore
+   if (fMemory)
+      MemoryAccounting::Add(EMemoryTag::kClusterPool, -std::int64_t(fSize));
+}
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -71,3 +96,11 @@ void ROOT::Experimental::Detail::RCluster::SetColumnAvailable(DescriptorId_t col
 {
    fAvailColumns.insert(columnId);
 }
+
+std::size_t ROOT::Experimental::Detail::RCluster::GetNBytesOnDisk() const
+{
+   std::size_t nbytes = 0;
+   for (const auto &kv : fOnDiskPages)
+      nbytes += kv.second.GetSize();
+   return nbytes;
+}
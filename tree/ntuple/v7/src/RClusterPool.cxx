@@ -52,6 +52,7 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
 ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
    : fPageSource(pageSource)
    , fClusterBunchSize(clusterBunchSize)
+   , fMaxClusterBunchSize(clusterBunchSize)
    , fPool(2 * clusterBunchSize)
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
@@ -59,6 +60,20 @@ ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource,
    R__ASSERT(clusterBunchSize > 0);
 }
 
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, const RNTupleReadOptions &options)
+   : RClusterPool(pageSource, options.GetClusterBunchSize())
+{
+   if (!options.GetAdaptiveClusterBunchSize())
+      return;
+
+   fIsAdaptive = true;
+   fMaxClusterBunchSize = std::max(options.GetMaxClusterBunchSize(), fClusterBunchSize);
+   fMaxPoolSize = options.GetMaxClusterPoolSize();
+   // The pool is only accessed by the main thread, so that it can be safely resized after the pipeline threads
+   // have been started. It must have room for two bunches of the largest possible bunch size.
+   fPool.resize(2 * fMaxClusterBunchSize);
+}
+
 ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
 {
    {
@@ -91,14 +106,27 @@ void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
          }
       }
 
-      for (auto &item : unzipItems) {
-         if (!item.fCluster)
+      std::size_t i = 0;
+      while (i < unzipItems.size()) {
+         if (!unzipItems[i].fCluster)
             return;
 
-         fPageSource.UnzipCluster(item.fCluster.get());
+         // The pages of a group of clusters are decompressed by the same set of tasks.  The group is closed when
+         // it reaches the size limit, at the end of the work items, or at the termination item (empty cluster).
+         std::vector<RCluster *> group;
+         std::size_t groupSize = 0;
+         const auto groupBegin = i;
+         while ((i < unzipItems.size()) && unzipItems[i].fCluster && (groupSize < fMaxUnzipGroupSize)) {
+            group.emplace_back(unzipItems[i].fCluster.get());
+            groupSize += group.back()->GetNBytesOnDisk();
+            ++i;
+         }
+
+         fPageSource.UnzipClusters(group);
 
-         // Afterwards the GetCluster() method in the main thread can pick-up the cluster
-         item.fPromise.set_value(std::move(item.fCluster));
+         // Afterwards the GetCluster() method in the main thread can pick-up the clusters
+         for (auto j = groupBegin; j < i; ++j)
+            unzipItems[j].fPromise.set_value(std::move(unzipItems[j].fCluster));
       }
    } // while (true)
 }
@@ -231,10 +259,45 @@ public:
 
 } // anonymous namespace
 
+void ROOT::Experimental::Detail::RClusterPool::AdaptClusterBunchSize()
+{
+   // Time spent by the consumer on the last cluster; the waiting time is not included because it is spent inside
+   // GetCluster()
+   const auto consumerTime = std::chrono::steady_clock::now() - fLastReturnTime;
+   if (fLastWaitTime > consumerTime / 20) {
+      fNClustersNoWait = 0;
+      fClusterBunchSize = std::min(2 * fClusterBunchSize, fMaxClusterBunchSize);
+   } else if (++fNClustersNoWait >= kNBunchesBeforeShrink * fClusterBunchSize) {
+      fNClustersNoWait = 0;
+      if (fClusterBunchSize > 1)
+         fClusterBunchSize--;
+   }
+
+   std::size_t nClusters = 0;
+   std::size_t szPool = 0;
+   for (const auto &cptr : fPool) {
+      if (!cptr)
+         continue;
+      nClusters++;
+      szPool += cptr->GetNBytesOnDisk();
+   }
+   if (szPool > 0) {
+      // The look-ahead window comprises two bunches
+      const auto maxBunchSize = fMaxPoolSize / (2 * (szPool / nClusters) + 1);
+      fClusterBunchSize = std::clamp(maxBunchSize, std::size_t(1), std::size_t(fClusterBunchSize));
+   }
+}
+
 ROOT::Experimental::Detail::RCluster *
 ROOT::Experimental::Detail::RClusterPool::GetCluster(
    DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns)
 {
+   if (clusterId != fLastClusterId) {
+      if (fIsAdaptive && (fLastClusterId != kInvalidDescriptorId))
+         AdaptClusterBunchSize();
+      fLastWaitTime = std::chrono::steady_clock::duration(0);
+   }
+
    std::set<DescriptorId_t> keep;
    RProvides provide;
    {
@@ -367,7 +430,10 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
       }
    } // work queue lock guard
 
-   return WaitFor(clusterId, columns);
+   auto result = WaitFor(clusterId, columns);
+   fLastClusterId = clusterId;
+   fLastReturnTime = std::chrono::steady_clock::now();
+   return result;
 }
 
 
@@ -407,7 +473,9 @@ ROOT::Experimental::Detail::RClusterPool::WaitFor(
          // is released.  We need to release the lock before potentially blocking on the cluster future.
       }
 
+      const auto startWait = std::chrono::steady_clock::now();
       auto cptr = itr->fFuture.get();
+      fLastWaitTime += std::chrono::steady_clock::now() - startWait;
       if (result) {
          result->Adopt(std::move(*cptr));
       } else {
@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <bitset>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -48,6 +50,18 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitIndex32:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
+   case EColumnType::kSplitInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>(nullptr);
+   case EColumnType::kReal32Trunc:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal32Trunc>>(nullptr);
+   case EColumnType::kReal32Quant:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal32Quant>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -55,6 +69,37 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    return nullptr;
 }
 
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
+ROOT::Experimental::Detail::RColumnElementBase::Generate(const RColumnModel &model)
+{
+   auto element = Generate(model.GetType());
+   if (model.GetBitsOnStorage() > 0)
+      element->SetBitsOnStorage(model.GetBitsOnStorage());
+   element->SetValueRange(model.GetValueRange().first, model.GetValueRange().second);
+   return element;
+}
+
+std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(const RColumnModel &model)
+{
+   if (model.GetBitsOnStorage() > 0)
+      return model.GetBitsOnStorage();
+   return GetBitsOnStorage(model.GetType());
+}
+
+std::pair<std::size_t, std::size_t>
+ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(EColumnType type)
+{
+   switch (type) {
+   // At least sign, exponent, and one bit of mantissa
+   case EColumnType::kReal32Trunc:
+      return {10, 32};
+   case EColumnType::kReal32Quant:
+      return {1, 32};
+   default:
+      return {0, 0};
+   }
+}
+
 std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(EColumnType type) {
    switch (type) {
    case EColumnType::kReal32:
@@ -79,6 +124,18 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kSplitIndex32:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitInt32:
+      return 32;
+   case EColumnType::kSplitInt16:
+      return 16;
+   case EColumnType::kReal32Trunc:
+      return 32;
+   case EColumnType::kReal32Quant:
+      return 32;
    default:
       R__ASSERT(false);
    }
@@ -110,11 +167,135 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Index";
    case EColumnType::kSwitch:
       return "Switch";
+   case EColumnType::kSplitIndex32:
+      return "SplitIndex32";
+   case EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case EColumnType::kSplitInt32:
+      return "SplitInt32";
+   case EColumnType::kSplitInt16:
+      return "SplitInt16";
+   case EColumnType::kReal32Trunc:
+      return "Real32Trunc";
+   case EColumnType::kReal32Quant:
+      return "Real32Quant";
    default:
       return "UNKNOWN";
    }
 }
 
+namespace {
+
+/// Writes count values of nBits each, as returned by the encode function for every element index, into a
+/// little-endian bit stream
+template <typename EncodeT>
+void PackBits(void *dst, std::size_t count, std::size_t nBits, EncodeT encode)
+{
+   auto byteArray = reinterpret_cast<unsigned char *>(dst);
+   // Holds less than 8 bits between iterations, so that it never overflows for values of up to 32 bits
+   std::uint64_t accumulator = 0;
+   std::size_t nAccumulated = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      accumulator |= static_cast<std::uint64_t>(encode(i)) << nAccumulated;
+      nAccumulated += nBits;
+      while (nAccumulated >= 8) {
+         *byteArray++ = static_cast<unsigned char>(accumulator);
+         accumulator >>= 8;
+         nAccumulated -= 8;
+      }
+   }
+   if (nAccumulated > 0)
+      *byteArray = static_cast<unsigned char>(accumulator);
+}
+
+/// Reverse of PackBits(): passes the element index and the nBits value read from the bit stream to decode
+template <typename DecodeT>
+void UnpackBits(const void *src, std::size_t count, std::size_t nBits, DecodeT decode)
+{
+   auto byteArray = reinterpret_cast<const unsigned char *>(src);
+   const std::uint64_t mask = (std::uint64_t(1) << nBits) - 1;
+   std::uint64_t accumulator = 0;
+   std::size_t nAccumulated = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      while (nAccumulated < nBits) {
+         accumulator |= static_cast<std::uint64_t>(*byteArray++) << nAccumulated;
+         nAccumulated += 8;
+      }
+      decode(i, static_cast<std::uint32_t>(accumulator & mask));
+      accumulator >>= nBits;
+      nAccumulated -= nBits;
+   }
+}
+
+} // anonymous namespace
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementTrunc<CppT>::Pack(void *dst, void *src, std::size_t count) const
+{
+   auto srcArray = reinterpret_cast<const CppT *>(src);
+   const std::size_t nDropped = 32 - fBitsOnStorage;
+   PackBits(dst, count, fBitsOnStorage, [&](std::size_t i) {
+      const float value = static_cast<float>(srcArray[i]);
+      std::uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      if (nDropped == 0)
+         return bits;
+      if ((bits & 0x7f800000) == 0x7f800000) {
+         // Infinity or NaN: no rounding and make sure that NaN keeps a non-zero mantissa
+         if (bits & 0x007fffff)
+            bits |= 0x00400000;
+      } else {
+         // Round half away from zero; a carry into the exponent correctly yields the next power of two
+         bits += std::uint32_t(1) << (nDropped - 1);
+      }
+      return bits >> nDropped;
+   });
+}
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementTrunc<CppT>::Unpack(void *dst, void *src, std::size_t count) const
+{
+   auto dstArray = reinterpret_cast<CppT *>(dst);
+   const std::size_t nDropped = 32 - fBitsOnStorage;
+   UnpackBits(src, count, fBitsOnStorage, [&](std::size_t i, std::uint32_t packed) {
+      const std::uint32_t bits = static_cast<std::uint32_t>(static_cast<std::uint64_t>(packed) << nDropped);
+      float value;
+      std::memcpy(&value, &bits, sizeof(value));
+      dstArray[i] = value;
+   });
+}
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementQuant<CppT>::Pack(void *dst, void *src, std::size_t count) const
+{
+   auto srcArray = reinterpret_cast<const CppT *>(src);
+   const double maxQuant = static_cast<double>((std::uint64_t(1) << fBitsOnStorage) - 1);
+   const double scale = (fMax > fMin) ? maxQuant / (fMax - fMin) : 0.0;
+   PackBits(dst, count, fBitsOnStorage, [&](std::size_t i) {
+      const double value = static_cast<double>(srcArray[i]);
+      // Written such that NaN maps to the lower limit
+      if (!(value > fMin))
+         return std::uint32_t(0);
+      if (value >= fMax)
+         return static_cast<std::uint32_t>(maxQuant);
+      return static_cast<std::uint32_t>(std::min(std::round((value - fMin) * scale), maxQuant));
+   });
+}
+
+template <typename CppT>
+void ROOT::Experimental::Detail::RColumnElementQuant<CppT>::Unpack(void *dst, void *src, std::size_t count) const
+{
+   auto dstArray = reinterpret_cast<CppT *>(dst);
+   const double maxQuant = static_cast<double>((std::uint64_t(1) << fBitsOnStorage) - 1);
+   const double step = (fMax - fMin) / maxQuant;
+   UnpackBits(src, count, fBitsOnStorage, [&](std::size_t i, std::uint32_t packed) {
+      dstArray[i] = static_cast<CppT>(fMin + packed * step);
+   });
+}
+
+template class ROOT::Experimental::Detail::RColumnElementTrunc<float>;
+template class ROOT::Experimental::Detail::RColumnElementQuant<float>;
+
 void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::RColumnSwitch,
                                                 ROOT::Experimental::EColumnType::kSwitch>::Pack(void *dst, void *src,
                                                                                                 std::size_t count) const
@@ -231,7 +231,13 @@ int ROOT::Experimental::Detail::RDaosContainer::WriteSingleAkey(const void *buff
 int ROOT::Experimental::Detail::RDaosContainer::VectorReadWrite(MultiObjectRWOperation_t &map, ObjClassId_t cid,
                                                                 int (RDaosObject::*fn)(RDaosObject::FetchUpdateArgs &))
 {
-   using request_t = std::tuple<std::unique_ptr<RDaosObject>, RDaosObject::FetchUpdateArgs>;
+   using request_t = std::tuple<std::shared_ptr<RDaosObject>, RDaosObject::FetchUpdateArgs>;
+
+   if (map.empty())
+      return 0;
+
+   // Every object is opened only once, even if several of its distribution keys are accessed
+   std::unordered_map<ROidDkeyPair, std::shared_ptr<RDaosObject>, ROidDkeyPair::Hash> objects;
 
    int ret;
    std::vector<request_t> requests{};
@@ -242,23 +248,46 @@ int ROOT::Experimental::Detail::RDaosContainer::VectorReadWrite(MultiObjectRWOpe
    if ((ret = fPool->fEventQueue->InitializeEvent(&parent_event)) < 0)
       return ret;
 
+   // All the requests are launched before waiting for any of them, so that the fetches/updates of the different
+   // (object, distribution key) pairs are served concurrently by the storage targets
+   int errLaunch = 0;
    for (auto &[key, batch] : map) {
+      ROidDkeyPair objectKey;
+      objectKey.oid = batch.fOid;
+      auto &object = objects[objectKey];
+      if (!object)
+         object = std::make_shared<RDaosObject>(*this, batch.fOid, cid.fCid);
       requests.push_back(std::make_tuple(
-         std::make_unique<RDaosObject>(*this, batch.fOid, cid.fCid),
+         object,
          RDaosObject::FetchUpdateArgs{batch.fDistributionKey, batch.fAttributeKeys, batch.fIovs, /*is_async=*/true}));
 
-      if ((ret = fPool->fEventQueue->InitializeEvent(std::get<1>(requests.back()).GetEventPointer(), &parent_event)) <
-          0)
-         return ret;
+      if ((errLaunch = fPool->fEventQueue->InitializeEvent(std::get<1>(requests.back()).GetEventPointer(),
+                                                           &parent_event)) < 0) {
+         requests.pop_back();
+         break;
+      }
 
       // Launch operation
-      if ((ret = (std::get<0>(requests.back()).get()->*fn)(std::get<1>(requests.back()))) < 0)
-         return ret;
+      if ((errLaunch = (std::get<0>(requests.back()).get()->*fn)(std::get<1>(requests.back()))) < 0)
+         break;
    }
 
-   // Sets parent barrier and waits for all children launched before it.
-   if ((ret = fPool->fEventQueue->WaitOnParentBarrier(&parent_event)) < 0)
-      return ret;
+   // Even if launching failed, the requests already in flight reference the buffers of `requests` and `map`, so they
+   // need to complete before returning. Sets parent barrier and waits for all children launched before it.
+   int errWait = requests.empty() ? 0 : fPool->fEventQueue->WaitOnParentBarrier(&parent_event);
+
+   int nFailed = 0;
+   for (auto &r : requests) {
+      auto evPtr = std::get<1>(r).GetEventPointer();
+      if (evPtr->ev_error != 0)
+         ++nFailed;
+      fPool->fEventQueue->FinalizeEvent(evPtr);
+   }
+   ret = fPool->fEventQueue->FinalizeEvent(&parent_event);
 
-   return fPool->fEventQueue->FinalizeEvent(&parent_event);
+   if (errLaunch < 0)
+      return errLaunch;
+   if (errWait < 0)
+      return errWait;
+   return (nFailed > 0) ? nFailed : ret;
 }
@@ -275,6 +275,7 @@ ROOT::Experimental::Detail::RFieldBase::Clone(std::string_view newName) const
    auto clone = CloneImpl(newName);
    clone->fOnDiskId = fOnDiskId;
    clone->fDescription = fDescription;
+   clone->fIsSplitEncoded = fIsSplitEncoded;
    return clone;
 }
 
@@ -463,14 +464,21 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+   if (fIsSplitEncoded) {
+      RColumnModel model(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(model, 0)));
+   } else {
+      RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc) == EColumnType::kSplitIndex32;
    GenerateColumnsImpl();
 }
 
@@ -563,16 +571,49 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 //------------------------------------------------------------------------------
 
 
+void ROOT::Experimental::RField<float>::SetTruncated(std::size_t nBits)
+{
+   const auto validBitRange = Detail::RColumnElementBase::GetValidBitRange(EColumnType::kReal32Trunc);
+   if (nBits < validBitRange.first || nBits > validBitRange.second) {
+      throw RException(R__FAIL("invalid number of bits for truncated float field '" + GetName() + "': " +
+                               std::to_string(nBits)));
+   }
+   fColumnModel = RColumnModel(EColumnType::kReal32Trunc, false /* isSorted*/, nBits);
+}
+
+void ROOT::Experimental::RField<float>::SetQuantized(double minValue, double maxValue, std::size_t nBits)
+{
+   const auto validBitRange = Detail::RColumnElementBase::GetValidBitRange(EColumnType::kReal32Quant);
+   if (nBits < validBitRange.first || nBits > validBitRange.second) {
+      throw RException(R__FAIL("invalid number of bits for quantized float field '" + GetName() + "': " +
+                               std::to_string(nBits)));
+   }
+   if (!(minValue < maxValue))
+      throw RException(R__FAIL("invalid value range for quantized float field '" + GetName() + "'"));
+   fColumnModel = RColumnModel(EColumnType::kReal32Quant, false /* isSorted*/, nBits, {minValue, maxValue});
+}
+
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
+   switch (fColumnModel.GetType()) {
+   case EColumnType::kReal32Trunc:
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<float, EColumnType::kReal32Trunc>(fColumnModel, 0)));
+      break;
+   case EColumnType::kReal32Quant:
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<float, EColumnType::kReal32Quant>(fColumnModel, 0)));
+      break;
+   default:
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<float, EColumnType::kReal32>(fColumnModel, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal32}, 0, desc);
+   EnsureColumnType({EColumnType::kReal32, EColumnType::kReal32Trunc, EColumnType::kReal32Quant}, 0, desc);
+   fColumnModel = desc.GetColumnDescriptor(desc.FindColumnId(GetOnDiskId(), 0)).GetModel();
    GenerateColumnsImpl();
 }
 
@@ -606,14 +647,21 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl()
 {
+   if (fIsSplitEncoded) {
+      RColumnModel model(EColumnType::kSplitInt16, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int16_t, EColumnType::kSplitInt16>(model, 0)));
+      return;
+   }
    RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int16_t, EColumnType::kInt16>(model, 0)));
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<std::int16_t, EColumnType::kInt16>(model, 0)));
 }
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kInt16, EColumnType::kSplitInt16}, 0, desc) == EColumnType::kSplitInt16;
    GenerateColumnsImpl();
 }
 
@@ -626,14 +674,21 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl()
 {
+   if (fIsSplitEncoded) {
+      RColumnModel model(EColumnType::kSplitInt16, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint16_t, EColumnType::kSplitInt16>(model, 0)));
+      return;
+   }
    RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::uint16_t, EColumnType::kInt16>(model, 0)));
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<std::uint16_t, EColumnType::kInt16>(model, 0)));
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kInt16, EColumnType::kSplitInt16}, 0, desc) == EColumnType::kSplitInt16;
    GenerateColumnsImpl();
 }
 
@@ -646,14 +701,21 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl()
 {
+   if (fIsSplitEncoded) {
+      RColumnModel model(EColumnType::kSplitInt32, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int32_t, EColumnType::kSplitInt32>(model, 0)));
+      return;
+   }
    RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int32_t, EColumnType::kInt32>(model, 0)));
+   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+      Detail::RColumn::Create<std::int32_t, EColumnType::kInt32>(model, 0)));
 }
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kInt32, EColumnType::kSplitInt32}, 0, desc) == EColumnType::kSplitInt32;
    GenerateColumnsImpl();
 }
 
@@ -666,6 +728,12 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 {
+   if (fIsSplitEncoded) {
+      RColumnModel model(EColumnType::kSplitInt32, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint32_t, EColumnType::kSplitInt32>(model, 0)));
+      return;
+   }
    RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
       Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
@@ -673,7 +741,8 @@ void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kInt32, EColumnType::kSplitInt32}, 0, desc) == EColumnType::kSplitInt32;
    GenerateColumnsImpl();
 }
 
@@ -686,6 +755,12 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 {
+   if (fIsSplitEncoded) {
+      RColumnModel model(EColumnType::kSplitInt64, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::uint64_t, EColumnType::kSplitInt64>(model, 0)));
+      return;
+   }
    RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
       Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
@@ -693,7 +768,8 @@ void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt64}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kInt64, EColumnType::kSplitInt64}, 0, desc) == EColumnType::kSplitInt64;
    GenerateColumnsImpl();
 }
 
@@ -706,6 +782,12 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl()
 {
+   if (fIsSplitEncoded) {
+      RColumnModel model(EColumnType::kSplitInt64, false /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int64_t, EColumnType::kSplitInt64>(model, 0)));
+      return;
+   }
    RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
       Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
@@ -713,11 +795,15 @@ void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl()
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kInt32}, 0, desc);
+   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kSplitInt64, EColumnType::kInt32}, 0, desc);
    RColumnModel model(type, false /* isSorted*/);
    if (type == EColumnType::kInt64) {
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
          Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
+   } else if (type == EColumnType::kSplitInt64) {
+      fIsSplitEncoded = true;
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<std::int64_t, EColumnType::kSplitInt64>(model, 0)));
    } else {
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
          Detail::RColumn::Create<std::int64_t, EColumnType::kInt32>(model, 0)));
@@ -733,9 +819,15 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fIsSplitEncoded) {
+      RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+   } else {
+      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
 
    RColumnModel modelChars(EColumnType::kChar, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
@@ -744,7 +836,8 @@ void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc) == EColumnType::kSplitIndex32;
    EnsureColumnType({EColumnType::kChar}, 1, desc);
    GenerateColumnsImpl();
 }
@@ -1096,14 +1189,21 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fIsSplitEncoded) {
+      RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+   } else {
+      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
 }
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc) == EColumnType::kSplitIndex32;
    GenerateColumnsImpl();
 }
 
@@ -1247,14 +1347,21 @@ void ROOT::Experimental::RRVecField::ReadGlobalImpl(NTupleSize_t globalIndex, De
 
 void ROOT::Experimental::RRVecField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(
-      std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fIsSplitEncoded) {
+      RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+   } else {
+      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
 }
 
 void ROOT::Experimental::RRVecField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc) == EColumnType::kSplitIndex32;
    GenerateColumnsImpl();
 }
 
@@ -1427,14 +1534,21 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fIsSplitEncoded) {
+      RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+   } else {
+      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
 }
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc) == EColumnType::kSplitIndex32;
    GenerateColumnsImpl();
 }
 
@@ -1842,14 +1956,21 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fIsSplitEncoded) {
+      RColumnModel modelIndex(EColumnType::kSplitIndex32, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kSplitIndex32>(modelIndex, 0)));
+   } else {
+      RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
+         Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   }
 }
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   fIsSplitEncoded =
+      EnsureColumnType({EColumnType::kIndex, EColumnType::kSplitIndex32}, 0, desc) == EColumnType::kSplitIndex32;
    GenerateColumnsImpl();
 }
 
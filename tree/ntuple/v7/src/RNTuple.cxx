@@ -21,6 +21,7 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RPageSynchronizingSink.hxx>
 #ifdef R__USE_IMT
 #include <ROOT/TTaskGroup.hxx>
 #endif
@@ -390,6 +391,104 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
 //------------------------------------------------------------------------------
 
 
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+   fSink->Create(*fModel);
+
+   const auto &writeOpts = fSink->GetWriteOptions();
+   fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
+   // First estimate is a factor 2 compression if compression is used at all
+   const int scale = writeOpts.GetCompression() ? 2 : 1;
+   fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitStagedClusters();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted)
+      return;
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fSink->CommitCluster(fNEntries);
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+void ROOT::Experimental::RNTupleFillContext::EnableStagedClusterCommitting()
+{
+   // fill contexts are only created by RNTupleParallelWriter::CreateFillContext()
+   static_cast<Detail::RPageSynchronizingSink &>(*fSink).EnableStagedClusters();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitStagedClusters()
+{
+   CommitCluster();
+   static_cast<Detail::RPageSynchronizingSink &>(*fSink).CommitStagedClusters();
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   fModel->Freeze();
+   fSink->Create(*fModel);
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   for (const auto &context : fFillContexts) {
+      if (!context.expired()) {
+         R__LOG_ERROR(NTupleLog()) << "RNTupleFillContext has not been destructed before the parallel writer";
+         std::terminate();
+      }
+   }
+   if (fNEntries > 0)
+      fSink->CommitClusterGroup();
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   // Fill contexts buffer and seal their pages themselves
+   auto unbufferedOptions = options;
+   unbufferedOptions.SetUseBufferedWrite(false);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, unbufferedOptions));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+   auto sink = std::make_unique<Detail::RPageSynchronizingSink>(*fSink, fMutex, fNEntries);
+   // The constructor of RNTupleFillContext is private, so std::make_shared cannot be used
+   auto context = std::shared_ptr<RNTupleFillContext>(new RNTupleFillContext(fModel->Clone(), std::move(sink)));
+   fFillContexts.push_back(context);
+   return context;
+}
+
+//------------------------------------------------------------------------------
+
+
 ROOT::Experimental::RCollectionNTupleWriter::RCollectionNTupleWriter(std::unique_ptr<REntry> defaultEntry)
    : fOffset(0), fDefaultEntry(std::move(defaultEntry))
 {
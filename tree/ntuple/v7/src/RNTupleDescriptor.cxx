@@ -415,6 +415,16 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(
    return RResult<void>::Success();
 }
 
+ROOT::Experimental::RResult<void> ROOT::Experimental::RClusterDescriptorBuilder::SetColumnStatistics(
+   DescriptorId_t columnId, const RClusterDescriptor::RColumnRange::RStatistics &statistics)
+{
+   auto itr = fCluster.fColumnRanges.find(columnId);
+   if (itr == fCluster.fColumnRanges.end())
+      return R__FAIL("statistics for uncommitted column range");
+   itr->second.fStatistics = statistics;
+   return RResult<void>::Success();
+}
+
 
 ROOT::Experimental::RResult<ROOT::Experimental::RClusterDescriptor>
 ROOT::Experimental::RClusterDescriptorBuilder::MoveDescriptor()
@@ -17,7 +17,13 @@
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <algorithm>
+#include <future>
+#include <utility>
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
    if (inputs == nullptr || mergeInfo == nullptr) {
@@ -36,3 +42,135 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+std::unordered_map<std::string, ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::RNTupleMerger::GetColumnNames(const RNTupleDescriptor &desc)
+{
+   std::unordered_map<std::string, DescriptorId_t> result;
+   for (std::size_t i = 0; i < desc.GetNColumns(); ++i) {
+      const auto &columnDesc = desc.GetColumnDescriptor(i);
+      result[desc.GetQualifiedFieldName(columnDesc.GetFieldId()) + "." + std::to_string(columnDesc.GetIndex())] =
+         columnDesc.GetId();
+   }
+   return result;
+}
+
+ROOT::Experimental::RNTupleMerger::ColumnIdMap_t
+ROOT::Experimental::RNTupleMerger::MapColumns(const RNTupleDescriptor &source, const RNTupleDescriptor &destination)
+{
+   if (source.GetNColumns() != destination.GetNColumns()) {
+      throw RException(R__FAIL("cannot merge ntuple '" + source.GetName() + "': number of columns differs (" +
+                               std::to_string(source.GetNColumns()) + " vs. " +
+                               std::to_string(destination.GetNColumns()) + ")"));
+   }
+
+   const auto destinationColumns = GetColumnNames(destination);
+   ColumnIdMap_t columnIdMap;
+   for (const auto &[name, sourceId] : GetColumnNames(source)) {
+      auto itr = destinationColumns.find(name);
+      if (itr == destinationColumns.end())
+         throw RException(R__FAIL("cannot merge ntuple '" + source.GetName() + "': unexpected column " + name));
+      if (!(source.GetColumnDescriptor(sourceId).GetModel() ==
+            destination.GetColumnDescriptor(itr->second).GetModel())) {
+         throw RException(R__FAIL("cannot merge ntuple '" + source.GetName() + "': column type mismatch for " + name));
+      }
+      columnIdMap[sourceId] = itr->second;
+   }
+   return columnIdMap;
+}
+
+ROOT::Experimental::RNTupleMerger::RClusterPages
+ROOT::Experimental::RNTupleMerger::LoadClusterPages(Detail::RPageSource &source, const RNTupleDescriptor &desc,
+                                                    DescriptorId_t clusterId, const ColumnIdMap_t &columnIdMap,
+                                                    int compression)
+{
+   const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+
+   RClusterPages result;
+   result.fNEntries = clusterDesc.GetNEntries();
+   result.fSealedPages.resize(columnIdMap.size());
+
+   std::size_t nBytes = 0;
+   for (const auto &[sourceId, _] : columnIdMap) {
+      if (clusterDesc.GetColumnRange(sourceId).fCompressionSettings != compression) {
+         throw RException(R__FAIL("cannot fast-clone ntuple '" + desc.GetName() + "': compression settings " +
+                                  std::to_string(clusterDesc.GetColumnRange(sourceId).fCompressionSettings) +
+                                  " differ from destination compression " + std::to_string(compression)));
+      }
+      for (const auto &pageInfo : clusterDesc.GetPageRange(sourceId).fPageInfos)
+         nBytes += pageInfo.fLocator.fBytesOnStorage;
+   }
+   result.fBuffer = std::make_unique<unsigned char[]>(nBytes);
+
+   unsigned char *buffer = result.fBuffer.get();
+   for (const auto &[sourceId, destinationId] : columnIdMap) {
+      if (const auto &statistics = clusterDesc.GetColumnRange(sourceId).fStatistics)
+         result.fStatistics.emplace_back(destinationId, *statistics);
+      std::uint32_t firstElementInPage = 0;
+      for (const auto &pageInfo : clusterDesc.GetPageRange(sourceId).fPageInfos) {
+         auto &sealedPage = result.fSealedPages[destinationId].emplace_back();
+         sealedPage.fBuffer = buffer;
+         source.LoadSealedPage(sourceId, RClusterIndex(clusterId, firstElementInPage), sealedPage);
+         buffer += sealedPage.fSize;
+         firstElementInPage += pageInfo.fNElements;
+      }
+   }
+   return result;
+}
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no input ntuples to merge"));
+
+   std::unique_ptr<RNTupleModel> model;
+   NTupleSize_t nEntries = 0;
+   const auto compression = destination.GetWriteOptions().GetCompression();
+   for (auto source : sources) {
+      source->Attach();
+      auto desc = source->GetSharedDescriptorGuard()->Clone();
+      if (!model) {
+         // The model needs to stay alive until the destination is committed
+         model = desc->GenerateModel();
+         destination.Create(*model);
+      }
+      const auto columnIdMap = MapColumns(*desc, destination.GetDescriptor());
+
+      std::vector<DescriptorId_t> clusterIds;
+      for (const auto &clusterDesc : desc->GetClusterIterable())
+         clusterIds.emplace_back(clusterDesc.GetId());
+      std::sort(clusterIds.begin(), clusterIds.end(), [&desc](DescriptorId_t a, DescriptorId_t b) {
+         return desc->GetClusterDescriptor(a).GetFirstEntryIndex() < desc->GetClusterDescriptor(b).GetFirstEntryIndex();
+      });
+      if (clusterIds.empty())
+         continue;
+
+      auto fnLoad = [&, source](DescriptorId_t clusterId) {
+         return LoadClusterPages(*source, *desc, clusterId, columnIdMap, compression);
+      };
+      // Read ahead the next cluster while the current one is written
+      auto nextCluster = std::async(std::launch::async, fnLoad, clusterIds[0]);
+      for (std::size_t i = 0; i < clusterIds.size(); ++i) {
+         auto cluster = nextCluster.get();
+         if (i + 1 < clusterIds.size())
+            nextCluster = std::async(std::launch::async, fnLoad, clusterIds[i + 1]);
+
+         std::vector<Detail::RPageStorage::RSealedPageGroup> toCommit;
+         toCommit.reserve(cluster.fSealedPages.size());
+         for (std::size_t columnId = 0; columnId < cluster.fSealedPages.size(); ++columnId) {
+            const auto &sealedPages = cluster.fSealedPages[columnId];
+            toCommit.emplace_back(columnId, sealedPages.cbegin(), sealedPages.cend());
+         }
+         destination.CommitSealedPageV(toCommit);
+         for (const auto &[columnId, statistics] : cluster.fStatistics)
+            destination.UpdateColumnStatistics(columnId, statistics);
+         nEntries += cluster.fNEntries;
+         destination.CommitCluster(nEntries);
+      }
+      destination.CommitClusterGroup();
+   }
+   destination.CommitDataset();
+}
@@ -188,16 +188,26 @@ std::uint32_t SerializeColumnListV1(
 
          auto type = c.GetModel().GetType();
          pos += RNTupleSerializer::SerializeColumnType(type, *where);
-         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(type), *where);
+         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(c.GetModel()), *where);
          pos += RNTupleSerializer::SerializeUInt32(context.GetPhysFieldId(c.GetFieldId()), *where);
          std::uint32_t flags = 0;
          // TODO(jblomer): add support for descending columns in the column model
          if (c.GetModel().GetIsSorted())
             flags |= RNTupleSerializer::kFlagSortAscColumn;
          // TODO(jblomer): fix for unsigned integer types
-         if (type == ROOT::Experimental::EColumnType::kIndex)
+         if (type == ROOT::Experimental::EColumnType::kIndex || type == ROOT::Experimental::EColumnType::kSplitIndex32)
             flags |= RNTupleSerializer::kFlagNonNegativeColumn;
+         if (type == ROOT::Experimental::EColumnType::kReal32Quant)
+            flags |= RNTupleSerializer::kFlagValueRangeColumn;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
+         if (flags & RNTupleSerializer::kFlagValueRangeColumn) {
+            std::uint64_t bits;
+            const auto valueRange = c.GetModel().GetValueRange();
+            memcpy(&bits, &valueRange.first, sizeof(bits));
+            pos += RNTupleSerializer::SerializeUInt64(bits, *where);
+            memcpy(&bits, &valueRange.second, sizeof(bits));
+            pos += RNTupleSerializer::SerializeUInt64(bits, *where);
+         }
 
          pos += RNTupleSerializer::SerializeFramePostscript(buffer ? frame : nullptr, pos - frame);
 
@@ -246,11 +256,32 @@ RResult<std::uint32_t> DeserializeColumnV1(
    bytes += RNTupleSerializer::DeserializeUInt32(bytes, fieldId);
    bytes += RNTupleSerializer::DeserializeUInt32(bytes, flags);
 
-   if (ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type) != bitsOnStorage)
+   const auto validBitRange = ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(type);
+   if (validBitRange.second > 0) {
+      if (bitsOnStorage < validBitRange.first || bitsOnStorage > validBitRange.second)
+         return R__FAIL("invalid number of bits for column type");
+   } else if (ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type) != bitsOnStorage) {
       return R__FAIL("column element size mismatch");
+   }
+
+   std::pair<double, double> valueRange{0.0, 0.0};
+   if (flags & RNTupleSerializer::kFlagValueRangeColumn) {
+      if (fnFrameSizeLeft() < 2 * sizeof(std::uint64_t))
+         return R__FAIL("column record frame too short");
+      std::uint64_t bits;
+      bytes += RNTupleSerializer::DeserializeUInt64(bytes, bits);
+      memcpy(&valueRange.first, &bits, sizeof(bits));
+      bytes += RNTupleSerializer::DeserializeUInt64(bytes, bits);
+      memcpy(&valueRange.second, &bits, sizeof(bits));
+   } else if (type == EColumnType::kReal32Quant) {
+      return R__FAIL("quantized column without value range");
+   }
 
    const bool isSorted = (flags & (RNTupleSerializer::kFlagSortAscColumn | RNTupleSerializer::kFlagSortDesColumn));
-   columnDesc.FieldId(fieldId).Model({type, isSorted});
+   if (validBitRange.second > 0)
+      columnDesc.FieldId(fieldId).Model({type, isSorted, bitsOnStorage, valueRange});
+   else
+      columnDesc.FieldId(fieldId).Model({type, isSorted});
 
    return frameSize;
 }
@@ -441,6 +472,18 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
          return SerializeUInt16(0x0C, buffer);
       case EColumnType::kInt8:
          return SerializeUInt16(0x0D, buffer);
+      case EColumnType::kSplitIndex32:
+         return SerializeUInt16(0x0F, buffer);
+      case EColumnType::kSplitInt64:
+         return SerializeUInt16(0x13, buffer);
+      case EColumnType::kSplitInt32:
+         return SerializeUInt16(0x14, buffer);
+      case EColumnType::kSplitInt16:
+         return SerializeUInt16(0x15, buffer);
+      case EColumnType::kReal32Trunc:
+         return SerializeUInt16(0x16, buffer);
+      case EColumnType::kReal32Quant:
+         return SerializeUInt16(0x17, buffer);
       default:
          throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
@@ -490,6 +533,24 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
       case 0x0D:
          type = EColumnType::kInt8;
          break;
+      case 0x0F:
+         type = EColumnType::kSplitIndex32;
+         break;
+      case 0x13:
+         type = EColumnType::kSplitInt64;
+         break;
+      case 0x14:
+         type = EColumnType::kSplitInt32;
+         break;
+      case 0x15:
+         type = EColumnType::kSplitInt16;
+         break;
+      case 0x16:
+         type = EColumnType::kReal32Trunc;
+         break;
+      case 0x17:
+         type = EColumnType::kReal32Quant;
+         break;
       default:
          return R__FAIL("unexpected on-disk column type");
    }
@@ -1003,6 +1064,15 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          }
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
+         // Optional trailing fields; readers that do not know about them skip to the end of the frame
+         if (columnRange.fStatistics) {
+            pos += SerializeUInt32(kFlagColumnStatistics, *where);
+            std::uint64_t bits;
+            memcpy(&bits, &columnRange.fStatistics->fMin, sizeof(bits));
+            pos += SerializeUInt64(bits, *where);
+            memcpy(&bits, &columnRange.fStatistics->fMax, sizeof(bits));
+            pos += SerializeUInt64(bits, *where);
+         }
 
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
@@ -1395,6 +1465,22 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
          clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
+
+         if (fnInnerFrameSizeLeft() >= static_cast<int>(sizeof(std::uint32_t))) {
+            std::uint32_t flags;
+            bytes += DeserializeUInt32(bytes, flags);
+            if (flags & kFlagColumnStatistics) {
+               if (fnInnerFrameSizeLeft() < static_cast<int>(2 * sizeof(std::uint64_t)))
+                  return R__FAIL("page list frame too short");
+               RClusterDescriptor::RColumnRange::RStatistics statistics;
+               std::uint64_t bits;
+               bytes += DeserializeUInt64(bytes, bits);
+               memcpy(&statistics.fMin, &bits, sizeof(bits));
+               bytes += DeserializeUInt64(bytes, bits);
+               memcpy(&statistics.fMax, &bits, sizeof(bits));
+               clusters[i].SetColumnStatistics(j, statistics);
+            }
+         }
          bytes = innerFrame + innerFrameSize;
       }
 
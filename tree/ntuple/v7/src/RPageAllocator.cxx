@@ -14,6 +14,7 @@
  *************************************************************************/
 
 
+#include <ROOT/RMemoryAccounting.hxx>
 #include <ROOT/RPageAllocator.hxx>
 
 #include <TError.h>
@@ -24,10 +25,13 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorHeap
    R__ASSERT((elementSize > 0) && (nElements > 0));
    auto nbytes = elementSize * nElements;
    auto buffer = new unsigned char[nbytes];
+   MemoryAccounting::Add(EMemoryTag::kPages, nbytes);
    return RPage(columnId, buffer, elementSize, nElements);
 }
 
 void ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(const RPage& page)
 {
+   if (page.GetBuffer())
+      MemoryAccounting::Add(EMemoryTag::kPages, -std::int64_t(page.GetElementSize() * page.GetMaxElements()));
    delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
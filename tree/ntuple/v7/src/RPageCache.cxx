@@ -0,0 +1,105 @@
+/// \file RPageCache.cxx
+/// \ingroup NTuple ROOT7
+/// \author Jakob Blomer <jblomer@cern.ch>
+/// \date 2022-11-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RPageCache.hxx>
+
+#include <functional>
+#include <utility>
+
+std::size_t ROOT::Experimental::Detail::RPageCache::RKeyHash::operator()(const RKey &key) const
+{
+   auto hash = std::hash<std::string>()(key.fStorageId);
+   // Boost-style hash combination
+   for (std::uint64_t value : {key.fColumnId, key.fClusterId, key.fPageNo, std::uint64_t(key.fElementSize)})
+      hash ^= std::hash<std::uint64_t>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+   return hash;
+}
+
+ROOT::Experimental::Detail::RPageCache &ROOT::Experimental::Detail::RPageCache::GetShared()
+{
+   static RPageCache gPageCache;
+   return gPageCache;
+}
+
+void ROOT::Experimental::Detail::RPageCache::EvictUntil(std::size_t maxSize)
+{
+   while (fSize > maxSize) {
+      const auto &entry = fEntries.back();
+      fSize -= entry.fSize;
+      fIndex.erase(entry.fKey);
+      fEntries.pop_back();
+   }
+}
+
+ROOT::Experimental::Detail::RPageCache::Buffer_t
+ROOT::Experimental::Detail::RPageCache::Find(const RKey &key)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   auto itr = fIndex.find(key);
+   if (itr == fIndex.end())
+      return nullptr;
+   fEntries.splice(fEntries.begin(), fEntries, itr->second);
+   return itr->second->fBuffer;
+}
+
+void ROOT::Experimental::Detail::RPageCache::Insert(const RKey &key, Buffer_t buffer, std::size_t size)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   auto itr = fIndex.find(key);
+   if (itr != fIndex.end()) {
+      fEntries.splice(fEntries.begin(), fEntries, itr->second);
+      return;
+   }
+   if (size > fMaxSize)
+      return;
+
+   EvictUntil(fMaxSize - size);
+   fEntries.push_front(REntry{key, std::move(buffer), size});
+   fIndex[key] = fEntries.begin();
+   fSize += size;
+}
+
+void ROOT::Experimental::Detail::RPageCache::Clear()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   fIndex.clear();
+   fEntries.clear();
+   fSize = 0;
+}
+
+std::size_t ROOT::Experimental::Detail::RPageCache::GetMaxSize()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fMaxSize;
+}
+
+void ROOT::Experimental::Detail::RPageCache::SetMaxSize(std::size_t maxSize)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   fMaxSize = maxSize;
+   EvictUntil(fMaxSize);
+}
+
+std::size_t ROOT::Experimental::Detail::RPageCache::GetSize()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fSize;
+}
+
+std::size_t ROOT::Experimental::Detail::RPageCache::GetNPages()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fEntries.size();
+}
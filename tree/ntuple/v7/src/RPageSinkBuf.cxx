@@ -33,6 +33,26 @@ ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink
    fMetrics.ObserveMetrics(fInnerSink->GetMetrics());
 }
 
+ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
+{
+   if (fPendingCommit.valid())
+      fPendingCommit.wait();
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::WaitForPendingCommit()
+{
+   if (fPendingCommit.valid())
+      fPendingCommit.get();
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitStatistics(const std::vector<ColumnStatistics_t> &statistics)
+{
+   for (std::size_t i = 0; i < statistics.size(); ++i) {
+      if (statistics[i])
+         fInnerSink->UpdateColumnStatistics(i, *statistics[i]);
+   }
+}
+
 void ROOT::Experimental::Detail::RPageSinkBuf::CreateImpl(const RNTupleModel &model,
                                                           unsigned char * /* serializedHeader */,
                                                           std::uint32_t /* length */)
@@ -80,6 +100,7 @@ ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(
    DescriptorId_t columnId, const RSealedPage &sealedPage)
 {
+   WaitForPendingCommit();
    fInnerSink->CommitSealedPage(columnId, sealedPage);
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
@@ -94,43 +115,82 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
       fTaskScheduler->Reset();
    }
 
-   // If we have only sealed pages in all buffered columns, commit them in a single `CommitSealedPageV()` call
+   // The inner sink is not thread-safe; only one cluster can be in flight
+   WaitForPendingCommit();
+
+   // If we have only sealed pages in all buffered columns, commit them in a single `CommitSealedPageV()` call.
+   // This happens in the background so that filling can continue with the next cluster.
    bool singleCommitCall = std::all_of(fBufferedColumns.begin(), fBufferedColumns.end(),
                                        [](auto &bufColumn) { return bufColumn.HasSealedPagesOnly(); });
    if (singleCommitCall) {
-      std::vector<RSealedPageGroup> toCommit;
-      toCommit.reserve(fBufferedColumns.size());
-      for (auto &bufColumn : fBufferedColumns) {
-         const auto &sealedPages = bufColumn.GetSealedPages();
-         toCommit.emplace_back(bufColumn.GetHandle().fId, sealedPages.cbegin(), sealedPages.cend());
+      fPendingCluster.fNEntries = nEntries;
+      fPendingCluster.fPages.clear();
+      for (auto &bufColumn : fBufferedColumns)
+         fPendingCluster.fPages.emplace_back(bufColumn.DrainBufferedPages());
+
+      // The returned number of bytes is known without waiting for the write: it is the size of the sealed pages
+      std::uint64_t nbytes = 0;
+      fPendingCluster.fToCommit.clear();
+      fPendingCluster.fToCommit.reserve(fBufferedColumns.size());
+      for (std::size_t i = 0; i < fBufferedColumns.size(); ++i) {
+         const auto &sealedPages = std::get<RPageStorage::SealedPageSequence_t>(fPendingCluster.fPages[i]);
+         fPendingCluster.fToCommit.emplace_back(fBufferedColumns[i].GetHandle().fId, sealedPages.cbegin(),
+                                                sealedPages.cend());
+         for (const auto &sealedPage : sealedPages)
+            nbytes += sealedPage.fSize;
       }
-      fInnerSink->CommitSealedPageV(toCommit);
 
-      for (auto &bufColumn : fBufferedColumns)
-         bufColumn.DrainBufferedPages();
-      return fInnerSink->CommitCluster(nEntries);
+      fPendingCluster.fStatistics.clear();
+      for (const auto &columnRange : fOpenColumnRanges)
+         fPendingCluster.fStatistics.emplace_back(columnRange.fStatistics);
+
+      fPendingCommit = std::async(std::launch::async, [this]() {
+         fInnerSink->CommitSealedPageV(fPendingCluster.fToCommit);
+         CommitStatistics(fPendingCluster.fStatistics);
+         fInnerSink->CommitCluster(fPendingCluster.fNEntries);
+         for (auto &pages : fPendingCluster.fPages) {
+            for (auto &zipItem : std::get<std::deque<RColumnBuf::RPageZipItem>>(pages))
+               fInnerSink->ReleasePage(zipItem.fPage);
+         }
+         fPendingCluster.fPages.clear();
+      });
+      return nbytes;
    }
 
-   // Otherwise, try to do it per column
-   for (auto &bufColumn : fBufferedColumns) {
-      // In practice, either all (see above) or none of the buffered pages have been sealed, depending on whether
-      // a task scheduler is available. The rare condition of a few columns consisting only of sealed pages should
-      // not happen unless the API is misused.
-      if (bufColumn.HasSealedPagesOnly())
-         throw RException(R__FAIL("only a few columns have all pages sealed"));
-
-      // Slow path: if the buffered column contains both sealed and unsealed pages, commit them one by one.
-      // TODO(jalopezg): coalesce contiguous sealed pages and commit via `CommitSealedPageV()`.
-      auto drained = bufColumn.DrainBufferedPages();
-      for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained)) {
-         if (bufPage.IsSealed()) {
-            fInnerSink->CommitSealedPage(bufColumn.GetHandle().fId, *bufPage.fSealedPage);
-         } else {
-            fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage.fPage);
+   // Otherwise, the pages have not been sealed by parallel tasks. We seal the remaining pages here and still
+   // commit the cluster in a single `CommitSealedPageV()` call, so that the inner sink can batch the page writes
+   // (e.g., a single vector write of all the cluster's pages for DAOS).
+   std::deque<RColumnBuf::BufferedPages_t> drained;
+   std::vector<RPageStorage::SealedPageSequence_t> sealedPages(fBufferedColumns.size());
+   std::vector<RSealedPageGroup> toCommit;
+   for (std::size_t i = 0; i < fBufferedColumns.size(); ++i) {
+      auto &bufColumn = fBufferedColumns[i];
+      drained.emplace_back(bufColumn.DrainBufferedPages());
+      auto &zipItems = std::get<std::deque<RColumnBuf::RPageZipItem>>(drained.back());
+      if (zipItems.empty())
+         continue;
+      for (auto &zipItem : zipItems) {
+         if (zipItem.IsSealed()) {
+            const auto &s = *zipItem.fSealedPage;
+            sealedPages[i].emplace_back(s.fBuffer, s.fSize, s.fNElements);
+            continue;
          }
-         ReleasePage(bufPage.fPage);
+         zipItem.AllocateSealedPageBuf();
+         sealedPages[i].emplace_back(SealPage(zipItem.fPage, *bufColumn.GetHandle().fColumn->GetElement(),
+                                              GetWriteOptions().GetCompression(), zipItem.fBuf.get()));
       }
+      toCommit.emplace_back(bufColumn.GetHandle().fId, sealedPages[i].cbegin(), sealedPages[i].cend());
    }
+   fInnerSink->CommitSealedPageV(toCommit);
+   for (auto &pages : drained) {
+      for (auto &zipItem : std::get<std::deque<RColumnBuf::RPageZipItem>>(pages))
+         ReleasePage(zipItem.fPage);
+   }
+
+   std::vector<ColumnStatistics_t> statistics;
+   for (const auto &columnRange : fOpenColumnRanges)
+      statistics.emplace_back(columnRange.fStatistics);
+   CommitStatistics(statistics);
    return fInnerSink->CommitCluster(nEntries);
 }
 
@@ -138,6 +198,7 @@ ROOT::Experimental::RNTupleLocator
 ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterGroupImpl(unsigned char * /* serializedPageList */,
                                                                  std::uint32_t /* length */)
 {
+   WaitForPendingCommit();
    fInnerSink->CommitClusterGroup();
    // We're not using that locator any further, so it is safe to return a dummy one
    return RNTupleLocator{};
@@ -146,6 +207,7 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterGroupImpl(unsigned char *
 void ROOT::Experimental::Detail::RPageSinkBuf::CommitDatasetImpl(unsigned char * /* serializedFooter */,
                                                                  std::uint32_t /* length */)
 {
+   WaitForPendingCommit();
    fInnerSink->CommitDataset();
 }
 
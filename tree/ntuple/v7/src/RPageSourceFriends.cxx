@@ -102,6 +102,8 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFri
             auto compressionSettings = c.GetColumnRange(originColumnId).fCompressionSettings;
 
             clusterBuilder.CommitColumnRange(virtualColumnId, firstElementIndex, compressionSettings, pageRange);
+            if (const auto &statistics = c.GetColumnRange(originColumnId).fStatistics)
+               clusterBuilder.SetColumnStatistics(virtualColumnId, *statistics);
          }
          fBuilder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
          fIdBiMap.Insert({i, c.GetId()}, fNextId);
@@ -31,6 +31,10 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
 
@@ -107,8 +111,22 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
 
 void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 {
-   if (fTaskScheduler)
+   UnzipClusters(std::span<RCluster *>(&cluster, 1));
+}
+
+void ROOT::Experimental::Detail::RPageSource::UnzipClusters(std::span<RCluster *> clusters)
+{
+   if (!fTaskScheduler)
+      return;
+
+   std::unique_ptr<RNTupleAtomicTimer> timer;
+   if (fCounters)
+      timer = std::make_unique<RNTupleAtomicTimer>(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+
+   fTaskScheduler->Reset();
+   for (auto cluster : clusters)
       UnzipClusterImpl(cluster);
+   fTaskScheduler->Wait();
 }
 
 
@@ -268,11 +286,85 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSink> ROOT::Experimental::Detai
    return realSink;
 }
 
+namespace {
+
+using RColumnStatistics = ROOT::Experimental::RClusterDescriptor::RColumnRange::RStatistics;
+using StatisticsUpdateFunc_t = void (*)(const ROOT::Experimental::Detail::RPage &, std::optional<RColumnStatistics> &);
+
+template <typename T>
+void UpdateStatistics(const ROOT::Experimental::Detail::RPage &page, std::optional<RColumnStatistics> &statistics)
+{
+   const auto nElements = page.GetNElements();
+   if (nElements == 0)
+      return;
+
+   // For floating point types, NaN values fail both comparisons and are thus ignored
+   T min = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+   T max = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::lowest();
+   const auto values = reinterpret_cast<const T *>(page.GetBuffer());
+   for (std::uint32_t i = 0; i < nElements; ++i) {
+      min = std::min(min, values[i]);
+      max = std::max(max, values[i]);
+   }
+
+   double dMin = min;
+   double dMax = max;
+   if constexpr (std::is_integral_v<T> && (sizeof(T) == 8)) {
+      // Conversion to double may round to the nearest representable value; make sure the range stays inclusive
+      dMin = std::nextafter(dMin, -std::numeric_limits<double>::infinity());
+      dMax = std::nextafter(dMax, std::numeric_limits<double>::infinity());
+   }
+   if (!statistics) {
+      statistics = RColumnStatistics{dMin, dMax};
+   } else {
+      statistics->fMin = std::min(statistics->fMin, dMin);
+      statistics->fMax = std::max(statistics->fMax, dMax);
+   }
+}
+
+/// Returns the statistics function for the principal column of fields of a fundamental numerical type
+StatisticsUpdateFunc_t GetStatisticsUpdater(const std::string &typeName, const ROOT::Experimental::Detail::RColumn &column)
+{
+   using ROOT::Experimental::EColumnType;
+   if (column.GetIndex() != 0)
+      return nullptr;
+   const auto type = column.GetModel().GetType();
+   if (typeName == "float" && type == EColumnType::kReal32)
+      return UpdateStatistics<float>;
+   if (typeName == "double" && type == EColumnType::kReal64)
+      return UpdateStatistics<double>;
+   if (typeName == "std::int8_t" && type == EColumnType::kInt8)
+      return UpdateStatistics<std::int8_t>;
+   if (typeName == "std::uint8_t" && type == EColumnType::kInt8)
+      return UpdateStatistics<std::uint8_t>;
+   if (typeName == "std::int16_t" && (type == EColumnType::kInt16 || type == EColumnType::kSplitInt16))
+      return UpdateStatistics<std::int16_t>;
+   if (typeName == "std::uint16_t" && (type == EColumnType::kInt16 || type == EColumnType::kSplitInt16))
+      return UpdateStatistics<std::uint16_t>;
+   if (typeName == "std::int32_t" && (type == EColumnType::kInt32 || type == EColumnType::kSplitInt32))
+      return UpdateStatistics<std::int32_t>;
+   if (typeName == "std::uint32_t" && (type == EColumnType::kInt32 || type == EColumnType::kSplitInt32))
+      return UpdateStatistics<std::uint32_t>;
+   if (typeName == "std::int64_t" && (type == EColumnType::kInt64 || type == EColumnType::kSplitInt64))
+      return UpdateStatistics<std::int64_t>;
+   if (typeName == "std::uint64_t" && (type == EColumnType::kInt64 || type == EColumnType::kSplitInt64))
+      return UpdateStatistics<std::uint64_t>;
+   return nullptr;
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RPageStorage::ColumnHandle_t
 ROOT::Experimental::Detail::RPageSink::AddColumn(DescriptorId_t fieldId, const RColumn &column)
 {
    auto columnId = fDescriptorBuilder.GetDescriptor().GetNColumns();
    fDescriptorBuilder.AddColumn(columnId, fieldId, column.GetModel(), column.GetIndex());
+   if (GetWriteOptions().GetEnableColumnStatistics()) {
+      const auto &typeName = fDescriptorBuilder.GetDescriptor().GetFieldDescriptor(fieldId).GetTypeName();
+      fStatisticsUpdaters.resize(columnId + 1, nullptr);
+      fStatisticsUpdaters[columnId] = GetStatisticsUpdater(typeName, column);
+   }
    return ColumnHandle_t{columnId, &column};
 }
 
@@ -322,6 +414,9 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
    pageInfo.fNElements = page.GetNElements();
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
    fOpenPageRanges.at(columnHandle.fId).fPageInfos.emplace_back(pageInfo);
+
+   if (columnHandle.fId < fStatisticsUpdaters.size() && fStatisticsUpdaters[columnHandle.fId])
+      fStatisticsUpdaters[columnHandle.fId](page, fOpenColumnRanges[columnHandle.fId].fStatistics);
 }
 
 
@@ -365,6 +460,18 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
    }
 }
 
+void ROOT::Experimental::Detail::RPageSink::UpdateColumnStatistics(
+   DescriptorId_t columnId, const RClusterDescriptor::RColumnRange::RStatistics &stats)
+{
+   auto &statistics = fOpenColumnRanges.at(columnId).fStatistics;
+   if (!statistics) {
+      statistics = stats;
+   } else {
+      statistics->fMin = std::min(statistics->fMin, stats.fMin);
+      statistics->fMax = std::max(statistics->fMax, stats.fMax);
+   }
+}
+
 std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
 {
    auto nbytes = CommitClusterImpl(nEntries);
@@ -379,6 +486,10 @@ std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experim
       std::swap(fullRange, fOpenPageRanges[i]);
       clusterBuilder.CommitColumnRange(i, fOpenColumnRanges[i].fFirstElementIndex,
                                        fOpenColumnRanges[i].fCompressionSettings, fullRange);
+      if (fOpenColumnRanges[i].fStatistics) {
+         clusterBuilder.SetColumnStatistics(i, *fOpenColumnRanges[i].fStatistics);
+         fOpenColumnRanges[i].fStatistics.reset();
+      }
       fOpenColumnRanges[i].fFirstElementIndex += fOpenColumnRanges[i].fNElements;
       fOpenColumnRanges[i].fNElements = 0;
    }
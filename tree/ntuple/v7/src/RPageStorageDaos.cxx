@@ -371,7 +371,7 @@ ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view nt
                                                              const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options), fPageAllocator(std::make_unique<RPageAllocatorDaos>()),
      fPagePool(std::make_shared<RPagePool>()), fURI(uri),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(std::make_unique<RClusterPool>(*this, options))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceDaos");
@@ -640,7 +640,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
       szPayload += clusterBufSz;
 
       clusterBuffers[i] = new unsigned char[clusterBufSz];
-      pageMaps[i] = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char[]>(clusterBuffers[i]));
+      pageMaps[i] =
+         std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char[]>(clusterBuffers[i]), clusterBufSz);
 
       // Fill the cluster page maps and the input dictionary for the RDaosContainer::ReadV() call
       for (const auto &s : onDiskClusterPages) {
@@ -683,20 +684,18 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
 
 void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *cluster)
 {
-   RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-   fTaskScheduler->Reset();
-
    const auto clusterId = cluster->GetId();
    auto descriptorGuard = GetSharedDescriptorGuard();
    const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterId);
 
-   std::vector<std::unique_ptr<RColumnElementBase>> allElements;
+   // The tasks outlive this method call, so the column elements are shared with them
+   std::vector<std::shared_ptr<RColumnElementBase>> allElements;
 
    const auto &columnsInCluster = cluster->GetAvailColumns();
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
@@ -708,7 +707,7 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
 
          auto taskFunc =
             [this, columnId, clusterId, firstInPage, onDiskPage,
-             element = allElements.back().get(),
+             element = allElements.back(),
              nElements = pi.fNElements,
              indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex
             ] () {
@@ -732,6 +731,4 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
    } // for all columns in cluster
 
    fCounters->fNPagePopulated.Add(cluster->GetNOnDiskPages());
-
-   fTaskScheduler->Wait();
 }
@@ -23,6 +23,7 @@
 #include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPage.hxx>
 #include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageCache.hxx>
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RRawFile.hxx>
@@ -135,7 +136,7 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(
    DescriptorId_t columnId, const RPageStorage::RSealedPage &sealedPage)
 {
    const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
-      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(columnId).GetModel().GetType());
+      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(columnId).GetModel());
    const auto bytesPacked = (bitsOnStorage * sealedPage.fNElements + 7) / 8;
 
    return WriteSealedPage(sealedPage, bytesPacked);
@@ -215,7 +216,7 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    : RPageSource(ntupleName, options)
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
    , fPagePool(std::make_shared<RPagePool>())
-   , fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+   , fClusterPool(std::make_unique<RClusterPool>(*this, options))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
@@ -226,7 +227,9 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    const RNTupleReadOptions &options)
    : RPageSourceFile(ntupleName, options)
 {
-   fFile = ROOT::Internal::RRawFile::Create(path);
+   ROOT::Internal::RRawFile::ROptions rawFileOptions;
+   rawFileOptions.fUseMmap = options.GetUseMmap();
+   fFile = ROOT::Internal::RRawFile::Create(path, rawFileOptions);
    R__ASSERT(fFile);
    fReader = Internal::RMiniFileReader(fFile.get());
 }
@@ -272,6 +275,13 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
 
    auto ntplDesc = fDescriptorBuilder.MoveDescriptor();
 
+   if (fOptions.GetUseSharedPageCache()) {
+      // The header and footer sizes guard against stale cache entries of a file that got rewritten
+      fSharedPageCacheId = fFile->GetUrl() + "#" + fNTupleName + "#" +
+                           std::to_string(ntplDesc.GetOnDiskHeaderSize()) + "#" +
+                           std::to_string(ntplDesc.GetOnDiskFooterSize());
+   }
+
    for (const auto &cgDesc : ntplDesc.GetClusterGroupIterable()) {
       auto buffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLength());
       auto zipBuffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLocator().fBytesOnStorage);
@@ -326,13 +336,33 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
    const void *sealedPageBuffer = nullptr; // points either to directReadBuffer or to a read-only page in the cluster
    std::unique_ptr<unsigned char []> directReadBuffer; // only used if cluster pool is turned off
 
+   const RPageCache::RKey sharedKey{fSharedPageCacheId, columnId, clusterId, pageInfo.fPageNo, elementSize};
+   const RPage::RClusterInfo pageClusterInfo(clusterId, clusterInfo.fColumnOffset);
+   const auto rangeFirst = clusterInfo.fColumnOffset + pageInfo.fFirstInPage;
+   auto fnFindSharedPage = [&]() {
+      if (fSharedPageCacheId.empty())
+         return RPage();
+      auto buffer = RPageCache::GetShared().Find(sharedKey);
+      if (!buffer)
+         return RPage();
+      return MakeSharedPage(columnId, buffer, elementSize, pageInfo.fNElements, rangeFirst, pageClusterInfo,
+                            true /* isCopy */, false /* isPreload */);
+   };
+
    if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
-      directReadBuffer = std::make_unique<unsigned char[]>(bytesOnStorage);
-      fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.fPosition);
+      auto sharedPage = fnFindSharedPage();
+      if (!sharedPage.IsNull())
+         return sharedPage;
+
+      sealedPageBuffer = fFile->GetMappedData(bytesOnStorage, pageInfo.fLocator.fPosition);
+      if (!sealedPageBuffer) {
+         directReadBuffer = std::make_unique<unsigned char[]>(bytesOnStorage);
+         fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.fPosition);
+         fCounters->fNRead.Inc();
+         sealedPageBuffer = directReadBuffer.get();
+      }
       fCounters->fNPageLoaded.Inc();
-      fCounters->fNRead.Inc();
       fCounters->fSzReadPayload.Add(bytesOnStorage);
-      sealedPageBuffer = directReadBuffer.get();
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
          fCurrentCluster = fClusterPool->GetCluster(clusterId, fActiveColumns);
@@ -341,6 +371,9 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       auto cachedPage = fPagePool->GetPage(columnId, RClusterIndex(clusterId, idxInCluster));
       if (!cachedPage.IsNull())
          return cachedPage;
+      auto sharedPage = fnFindSharedPage();
+      if (!sharedPage.IsNull())
+         return sharedPage;
 
       ROnDiskPage::Key key(columnId, pageInfo.fPageNo);
       auto onDiskPage = fCurrentCluster->GetOnDiskPage(key);
@@ -348,22 +381,78 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       sealedPageBuffer = onDiskPage->GetAddress();
    }
 
+   auto mappedPage = MakeMappedPage(columnId, {sealedPageBuffer, bytesOnStorage, pageInfo.fNElements},
+                                    pageInfo.fLocator.fPosition, *element);
+   if (!mappedPage.IsNull()) {
+      fCounters->fNPagePopulated.Inc();
+      mappedPage.SetWindow(rangeFirst, pageClusterInfo);
+      fPagePool->RegisterPage(mappedPage, RPageDeleter([](const RPage & /*page*/, void * /*userData*/) {}, nullptr));
+      return mappedPage;
+   }
+
    std::unique_ptr<unsigned char []> pageBuffer;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
       pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
    }
+   fCounters->fNPagePopulated.Inc();
+
+   if (!fSharedPageCacheId.empty()) {
+      RPageCache::Buffer_t buffer(pageBuffer.release());
+      RPageCache::GetShared().Insert(sharedKey, buffer, elementSize * pageInfo.fNElements);
+      return MakeSharedPage(columnId, buffer, elementSize, pageInfo.fNElements, rangeFirst, pageClusterInfo,
+                            false /* isCopy */, false /* isPreload */);
+   }
 
    auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), elementSize, pageInfo.fNElements);
-   newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
-                     RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+   newPage.SetWindow(rangeFirst, pageClusterInfo);
    fPagePool->RegisterPage(newPage,
       RPageDeleter([](const RPage &page, void * /*userData*/)
       {
          RPageAllocatorFile::DeletePage(page);
       }, nullptr));
-   fCounters->fNPagePopulated.Inc();
+   return newPage;
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceFile::MakeMappedPage(DescriptorId_t columnId, const RSealedPage &sealedPage,
+                                                            std::uint64_t position, const RColumnElementBase &element)
+{
+   if (!element.IsMappable() || (sealedPage.fSize != element.GetPackedSize(sealedPage.fNElements)))
+      return RPage();
+   // Only pages that point into the mapping live as long as the page source; other sealed pages are owned by a
+   // cluster or by a temporary buffer
+   if (fFile->GetMappedData(sealedPage.fSize, position) != sealedPage.fBuffer)
+      return RPage();
+   // The mapping is read-only; pages of a page source are never written to
+   return fPageAllocator->NewPage(columnId, const_cast<void *>(sealedPage.fBuffer), element.GetSize(),
+                                  sealedPage.fNElements);
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::MakeSharedPage(
+   DescriptorId_t columnId, const RPageCache::Buffer_t &buffer, std::size_t elementSize,
+   ClusterSize_t::ValueType nElements, NTupleSize_t rangeFirst, const RPage::RClusterInfo &clusterInfo, bool isCopy,
+   bool isPreload)
+{
+   RPage newPage;
+   RPageDeleter deleter;
+   if (isCopy) {
+      auto pageBuffer = new unsigned char[elementSize * nElements];
+      memcpy(pageBuffer, buffer.get(), elementSize * nElements);
+      newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, nElements);
+      deleter = RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorFile::DeletePage(page); },
+                             nullptr);
+   } else {
+      newPage = fPageAllocator->NewPage(columnId, buffer.get(), elementSize, nElements);
+      // The deleter keeps a reference to the shared buffer until the page is released
+      deleter = RPageDeleter([buffer](const RPage & /*page*/, void * /*userData*/) {}, nullptr);
+   }
+   newPage.SetWindow(rangeFirst, clusterInfo);
+   if (isPreload)
+      fPagePool->PreloadPage(newPage, deleter);
+   else
+      fPagePool->RegisterPage(newPage, deleter);
    return newPage;
 }
 
@@ -463,6 +552,27 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
       }
    }
 
+   // If the file is memory-mapped, the page map references the on-disk pages in place and no read is issued.
+   // The mapping is owned by fFile, which outlives the cluster pool and thus all the clusters.
+   if (!onDiskPages.empty() && fFile->GetMappedData(onDiskPages[0].fSize, onDiskPages[0].fOffset)) {
+      auto pageMap = std::make_unique<ROnDiskPageMap>();
+      std::size_t szPayload = 0;
+      for (const auto &s : onDiskPages) {
+         auto mappedPage = fFile->GetMappedData(s.fSize, s.fOffset);
+         R__ASSERT(mappedPage);
+         pageMap->Register(ROnDiskPage::Key(s.fColumnId, s.fPageNo), ROnDiskPage(const_cast<unsigned char *>(mappedPage), s.fSize));
+         szPayload += s.fSize;
+      }
+      fCounters->fSzReadPayload.Add(szPayload);
+      fCounters->fNPageLoaded.Add(onDiskPages.size());
+
+      auto cluster = std::make_unique<RCluster>(clusterKey.fClusterId);
+      cluster->Adopt(std::move(pageMap));
+      for (auto colId : clusterKey.fColumnSet)
+         cluster->SetColumnAvailable(colId);
+      return cluster;
+   }
+
    // Linearize the page requests by file offset
    std::sort(onDiskPages.begin(), onDiskPages.end(),
       [](const ROnDiskPageLocator &a, const ROnDiskPageLocator &b) {return a.fOffset < b.fOffset;});
@@ -530,8 +640,9 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    fCounters->fSzReadOverhead.Add(szOverhead);
 
    // Register the on disk pages in a page map
-   auto buffer = new unsigned char[reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize];
-   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer));
+   const std::size_t bufferSize = reinterpret_cast<intptr_t>(req.fBuffer) + req.fSize;
+   auto buffer = new unsigned char[bufferSize];
+   auto pageMap = std::make_unique<ROnDiskPageMapHeap>(std::unique_ptr<unsigned char []>(buffer), bufferSize);
    for (const auto &s : onDiskPages) {
       ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
       pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
@@ -561,6 +672,8 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
    }
 
    auto nReqs = readRequests.size();
+   if (nReqs == 0)
+      return clusters;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
       fFile->ReadV(&readRequests[0], nReqs);
@@ -574,20 +687,18 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
 
 void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *cluster)
 {
-   RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-   fTaskScheduler->Reset();
-
    const auto clusterId = cluster->GetId();
    auto descriptorGuard = GetSharedDescriptorGuard();
    const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterId);
 
-   std::vector<std::unique_ptr<RColumnElementBase>> allElements;
+   // The tasks outlive this method call, so the column elements are shared with them
+   std::vector<std::shared_ptr<RColumnElementBase>> allElements;
 
    const auto &columnsInCluster = cluster->GetAvailColumns();
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
@@ -597,15 +708,47 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
          auto onDiskPage = cluster->GetOnDiskPage(key);
          R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
 
+         const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+         auto mappedPage = MakeMappedPage(columnId, {onDiskPage->GetAddress(), onDiskPage->GetSize(), pi.fNElements},
+                                          pi.fLocator.fPosition, *allElements.back());
+         if (!mappedPage.IsNull()) {
+            mappedPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+            fPagePool->PreloadPage(mappedPage,
+                                   RPageDeleter([](const RPage & /*page*/, void * /*userData*/) {}, nullptr));
+            firstInPage += pi.fNElements;
+            pageNo++;
+            continue;
+         }
+
+         const RPageCache::RKey sharedKey{fSharedPageCacheId, columnId, clusterId, pageNo,
+                                          allElements.back()->GetSize()};
+         if (!fSharedPageCacheId.empty()) {
+            if (auto buffer = RPageCache::GetShared().Find(sharedKey)) {
+               MakeSharedPage(columnId, buffer, sharedKey.fElementSize, pi.fNElements, indexOffset + firstInPage,
+                              RPage::RClusterInfo(clusterId, indexOffset), true /* isCopy */, true /* isPreload */);
+               firstInPage += pi.fNElements;
+               pageNo++;
+               continue;
+            }
+         }
+
          auto taskFunc =
-            [this, columnId, clusterId, firstInPage, onDiskPage,
-             element = allElements.back().get(),
-             nElements = pi.fNElements,
-             indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex
+            [this, columnId, clusterId, firstInPage, onDiskPage, sharedKey, indexOffset,
+             element = allElements.back(),
+             nElements = pi.fNElements
             ] () {
                auto pageBuffer = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element);
                fCounters->fSzUnzip.Add(element->GetSize() * nElements);
 
+               if (!sharedKey.fStorageId.empty()) {
+                  RPageCache::Buffer_t buffer(pageBuffer.release());
+                  RPageCache::GetShared().Insert(sharedKey, buffer, element->GetSize() * nElements);
+                  MakeSharedPage(columnId, buffer, element->GetSize(), nElements, indexOffset + firstInPage,
+                                 RPage::RClusterInfo(clusterId, indexOffset), false /* isCopy */,
+                                 true /* isPreload */);
+                  return;
+               }
+
                auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), element->GetSize(), nElements);
                newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
                fPagePool->PreloadPage(newPage,
@@ -623,6 +766,4 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
    } // for all columns in cluster
 
    fCounters->fNPagePopulated.Add(cluster->GetNOnDiskPages());
-
-   fTaskScheduler->Wait();
 }
@@ -0,0 +1,148 @@
+/// \file RPageSynchronizingSink.cxx
+/// \ingroup NTuple ROOT7
+/// \author Jakob Blomer <jblomer@cern.ch>
+/// \date 2022-11-02
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageSynchronizingSink.hxx>
+
+#include <cstring>
+
+ROOT::Experimental::Detail::RPageSynchronizingSink::RPageSynchronizingSink(RPageSink &inner, std::mutex &mutex,
+                                                                           NTupleSize_t &innerNEntries)
+   : RPageSink(inner.GetNTupleName(), inner.GetWriteOptions()),
+     fInnerSink(inner),
+     fMutex(mutex),
+     fInnerNEntries(innerNEntries)
+{
+}
+
+void ROOT::Experimental::Detail::RPageSynchronizingSink::CreateImpl(const RNTupleModel & /* model */,
+                                                                    unsigned char * /* serializedHeader */,
+                                                                    std::uint32_t /* length */)
+{
+   // The inner sink has already been created by the owner of the shared sink
+   fBufferedColumns.resize(fDescriptorBuilder.GetDescriptor().GetNColumns());
+}
+
+ROOT::Experimental::RNTupleLocator
+ROOT::Experimental::Detail::RPageSynchronizingSink::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   // Seal the page in the filling thread; the buffer is large enough because the compressor falls back to
+   // storing the page uncompressed
+   auto &bufColumn = fBufferedColumns.at(columnHandle.fId);
+   auto buf = std::make_unique<unsigned char[]>(page.GetNBytes());
+   auto sealedPage =
+      SealPage(page, *columnHandle.fColumn->GetElement(), GetWriteOptions().GetCompression(), buf.get());
+   // Uncompressed mappable pages are not copied by SealPage() and still point to the page buffer
+   if (sealedPage.fBuffer != buf.get()) {
+      memcpy(buf.get(), sealedPage.fBuffer, sealedPage.fSize);
+      sealedPage.fBuffer = buf.get();
+   }
+   bufColumn.fSealedPages.emplace_back(std::move(sealedPage));
+   bufColumn.fBuffers.emplace_back(std::move(buf));
+   // The locators of this sink never get written out
+   return RNTupleLocator{};
+}
+
+ROOT::Experimental::RNTupleLocator
+ROOT::Experimental::Detail::RPageSynchronizingSink::CommitSealedPageImpl(DescriptorId_t columnId,
+                                                                         const RSealedPage &sealedPage)
+{
+   auto &bufColumn = fBufferedColumns.at(columnId);
+   auto buf = std::make_unique<unsigned char[]>(sealedPage.fSize);
+   memcpy(buf.get(), sealedPage.fBuffer, sealedPage.fSize);
+   bufColumn.fSealedPages.emplace_back(buf.get(), sealedPage.fSize, sealedPage.fNElements);
+   bufColumn.fBuffers.emplace_back(std::move(buf));
+   return RNTupleLocator{};
+}
+
+std::uint64_t
+ROOT::Experimental::Detail::RPageSynchronizingSink::CommitToInnerSink(RStagedCluster &cluster)
+{
+   std::vector<RSealedPageGroup> toCommit;
+   toCommit.reserve(cluster.fColumns.size());
+   for (std::size_t i = 0; i < cluster.fColumns.size(); ++i) {
+      const auto &sealedPages = cluster.fColumns[i].fSealedPages;
+      toCommit.emplace_back(i, sealedPages.cbegin(), sealedPages.cend());
+   }
+
+   fInnerSink.CommitSealedPageV(toCommit);
+   for (std::size_t i = 0; i < cluster.fStatistics.size(); ++i) {
+      if (cluster.fStatistics[i])
+         fInnerSink.UpdateColumnStatistics(i, *cluster.fStatistics[i]);
+   }
+   fInnerNEntries += cluster.fNEntries;
+   return fInnerSink.CommitCluster(fInnerNEntries);
+}
+
+std::uint64_t
+ROOT::Experimental::Detail::RPageSynchronizingSink::CommitClusterImpl(ROOT::Experimental::NTupleSize_t nEntries)
+{
+   RStagedCluster cluster;
+   cluster.fNEntries = nEntries - fNEntries;
+   cluster.fColumns.resize(fBufferedColumns.size());
+   std::swap(cluster.fColumns, fBufferedColumns);
+   cluster.fStatistics.reserve(fOpenColumnRanges.size());
+   for (const auto &columnRange : fOpenColumnRanges)
+      cluster.fStatistics.emplace_back(columnRange.fStatistics);
+   fNEntries = nEntries;
+
+   if (fStageClusters) {
+      fStagedClusters.emplace_back(std::move(cluster));
+      return 0;
+   }
+
+   std::lock_guard<std::mutex> guard(fMutex);
+   return CommitToInnerSink(cluster);
+}
+
+void ROOT::Experimental::Detail::RPageSynchronizingSink::CommitStagedClusters()
+{
+   if (fStagedClusters.empty())
+      return;
+   {
+      std::lock_guard<std::mutex> guard(fMutex);
+      for (auto &cluster : fStagedClusters)
+         CommitToInnerSink(cluster);
+   }
+   fStagedClusters.clear();
+}
+
+ROOT::Experimental::RNTupleLocator
+ROOT::Experimental::Detail::RPageSynchronizingSink::CommitClusterGroupImpl(unsigned char * /* serializedPageList */,
+                                                                           std::uint32_t /* length */)
+{
+   throw RException(R__FAIL("cluster groups must be committed to the shared sink"));
+}
+
+void ROOT::Experimental::Detail::RPageSynchronizingSink::CommitDatasetImpl(unsigned char * /* serializedFooter */,
+                                                                           std::uint32_t /* length */)
+{
+   throw RException(R__FAIL("the data set must be committed to the shared sink"));
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSynchronizingSink::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      throw RException(R__FAIL("invalid call: request empty page"));
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageSynchronizingSink::ReleasePage(RPage &page)
+{
+   RPageAllocatorHeap::DeletePage(page);
+}
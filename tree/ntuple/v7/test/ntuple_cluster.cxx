@@ -14,8 +14,10 @@
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -55,6 +57,8 @@ public:
    /// Records the cluster IDs requests by LoadClusters() calls
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RCluster::ColumnSet_t> fReqsColumns;
+   /// Simulates a slow storage backend
+   std::chrono::milliseconds fLoadDelay{0};
 
    RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
@@ -77,6 +81,7 @@ public:
    { }
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final
    {
+      std::this_thread::sleep_for(fLoadDelay);
       std::vector<std::unique_ptr<RCluster>> result;
       for (auto key : clusterKeys) {
          fReqsClusterIds.emplace_back(key.fClusterId);
@@ -126,6 +131,7 @@ TEST(Cluster, Basics)
    onDiskPage = cluster->GetOnDiskPage(ROnDiskPage::Key(5, 1));
    EXPECT_EQ(&memory[1], onDiskPage->GetAddress());
    EXPECT_EQ(2U, onDiskPage->GetSize());
+   EXPECT_EQ(3U, cluster->GetNBytesOnDisk());
 }
 
 TEST(Cluster, AdoptPageMaps)
@@ -281,6 +287,33 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterPool, AdaptiveBunchSize)
+{
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetAdaptiveClusterBunchSize(true);
+   options.SetMaxClusterBunchSize(2);
+
+   RPageSourceMock p1;
+   p1.fLoadDelay = std::chrono::milliseconds(50);
+   RClusterPool c1(p1, options);
+   EXPECT_EQ(1U, c1.GetClusterBunchSize());
+   // The consumer is much faster than the storage and has to wait for every cluster
+   for (unsigned i = 0; i < 3; ++i)
+      c1.GetCluster(i, {0});
+   EXPECT_EQ(2U, c1.GetClusterBunchSize());
+   c1.WaitForInFlightClusters();
+
+   // Without the adaptive mode, the bunch size stays fixed
+   RPageSourceMock p2;
+   p2.fLoadDelay = std::chrono::milliseconds(50);
+   RClusterPool c2(p2, 1);
+   for (unsigned i = 0; i < 3; ++i)
+      c2.GetCluster(i, {0});
+   EXPECT_EQ(1U, c2.GetClusterBunchSize());
+   c2.WaitForInFlightClusters();
+}
+
+
 TEST(PageStorageFile, LoadClusters)
 {
    FileRaii fileGuard("test_pagestoragefile_loadclusters.root");
@@ -80,3 +80,56 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+TEST(RNTupleMerger, FastClone)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_out.root");
+
+   for (auto path : {fileGuard1.GetPath(), fileGuard2.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTracks = model->MakeField<std::vector<float>>("tracks");
+      auto offset = (path == fileGuard1.GetPath()) ? 0 : 1000;
+      RNTupleWriter ntuple(std::move(model), std::make_unique<RPageSinkFile>("ntpl", path, RNTupleWriteOptions()));
+      for (int i = 0; i < 1000; ++i) {
+         *wrPt = offset + i;
+         *wrTracks = std::vector<float>(i % 3, offset + i);
+         ntuple.Fill();
+         if (i == 500)
+            ntuple.CommitCluster();
+      }
+   }
+
+   {
+      RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+      RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+      std::vector<RPageSource *> sources{&source1, &source2};
+      RPageSinkFile destination("ntpl", fileGuard3.GetPath(), RNTupleWriteOptions());
+      RNTupleMerger merger;
+      merger.Merge(sources, destination);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard3.GetPath());
+   EXPECT_EQ(2000U, ntuple->GetNEntries());
+   EXPECT_EQ(4U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewTracks = ntuple->GetView<std::vector<float>>("tracks");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(std::vector<float>(i % 1000 % 3, i), viewTracks(i));
+   }
+
+   // Fast-cloning requires the destination compression to match the source pages
+   {
+      FileRaii fileGuard4("test_ntuple_merge_out_uncompressed.root");
+      RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+      std::vector<RPageSource *> sources{&source1};
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      RPageSinkFile destination("ntpl", fileGuard4.GetPath(), options);
+      RNTupleMerger merger;
+      EXPECT_THROW(merger.Merge(sources, destination), RException);
+   }
+}
@@ -1,5 +1,8 @@
 #include "ntuple_test.hxx"
 
+#include <cmath>
+#include <limits>
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -50,3 +53,185 @@ TEST(Packing, RColumnSwitch)
    EXPECT_EQ(0xaa, s2.GetIndex());
    EXPECT_EQ(0x55, s2.GetTag());
 }
+
+TEST(Packing, SplitInt)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32> element(
+      nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   std::int32_t mem[] = {0, -1, 1, -2, 0x01020304};
+   unsigned char disk[20];
+   element.Pack(disk, mem, 5);
+   // zigzag encoded: 0, 1, 2, 3, 0x02040608; the least significant bytes come first
+   unsigned char expected[] = {0, 1, 2, 3, 0x08, 0, 0, 0, 0, 0x06, 0, 0, 0, 0, 0x04, 0, 0, 0, 0, 0x02};
+   for (unsigned i = 0; i < 20; ++i) {
+      EXPECT_EQ(expected[i], disk[i]);
+   }
+   std::int32_t unpacked[5];
+   element.Unpack(unpacked, disk, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(mem[i], unpacked[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64> element64(
+      nullptr);
+   std::uint64_t mem64[] = {0, std::uint64_t(-1), 42, 0x8000000000000000};
+   unsigned char disk64[32];
+   element64.Pack(disk64, mem64, 4);
+   std::uint64_t unpacked64[4];
+   element64.Unpack(unpacked64, disk64, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(mem64[i], unpacked64[i]);
+   }
+}
+
+TEST(Packing, SplitIndex)
+{
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32> element(
+      nullptr);
+   ClusterSize_t mem[] = {ClusterSize_t{5}, ClusterSize_t{7}, ClusterSize_t{7}, ClusterSize_t{300}};
+   unsigned char disk[16];
+   element.Pack(disk, mem, 4);
+   // delta encoded: 5, 2, 0, 293 = 0x125
+   unsigned char expected[] = {5, 2, 0, 0x25, 0, 0, 0, 0x01, 0, 0, 0, 0, 0, 0, 0, 0};
+   for (unsigned i = 0; i < 16; ++i) {
+      EXPECT_EQ(expected[i], disk[i]);
+   }
+   ClusterSize_t unpacked[4];
+   element.Unpack(unpacked, disk, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(mem[i], unpacked[i]);
+   }
+}
+
+TEST(Packing, SplitEncodedFields)
+{
+   FileRaii fileGuard("test_ntuple_packing_split.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldInt = std::make_unique<RField<std::int16_t>>("int");
+   fieldInt->SetSplitEncoding(true);
+   model->AddField(std::move(fieldInt));
+   auto fieldVec = std::make_unique<RField<std::vector<std::uint32_t>>>("vec");
+   fieldVec->SetSplitEncoding(true);
+   fieldVec->GetSubFields()[0]->SetSplitEncoding(true);
+   model->AddField(std::move(fieldVec));
+   model->MakeField<std::int64_t>("plain");
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto entry = writer->GetModel()->GetDefaultEntry();
+      for (int i = 0; i < 100; ++i) {
+         *entry->Get<std::int16_t>("int") = -i;
+         *entry->Get<std::vector<std::uint32_t>>("vec") = std::vector<std::uint32_t>(i % 3, i);
+         *entry->Get<std::int64_t>("plain") = i;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   auto columnType = [&](const std::string &fieldName, std::uint32_t columnIndex) {
+      auto fieldId = desc->FindFieldId(fieldName);
+      return desc->GetColumnDescriptor(desc->FindColumnId(fieldId, columnIndex)).GetModel().GetType();
+   };
+   EXPECT_EQ(EColumnType::kSplitInt16, columnType("int", 0));
+   EXPECT_EQ(EColumnType::kSplitIndex32, columnType("vec", 0));
+   EXPECT_EQ(EColumnType::kInt64, columnType("plain", 0));
+
+   auto viewInt = reader->GetView<std::int16_t>("int");
+   auto viewVec = reader->GetView<std::vector<std::uint32_t>>("vec");
+   auto viewPlain = reader->GetView<std::int64_t>("plain");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_EQ(-static_cast<int>(i), viewInt(i));
+      EXPECT_EQ(std::vector<std::uint32_t>(i % 3, i), viewVec(i));
+      EXPECT_EQ(static_cast<std::int64_t>(i), viewPlain(i));
+   }
+}
+
+TEST(Packing, Real32Trunc)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32Trunc> element(nullptr);
+   element.SetBitsOnStorage(21);
+   EXPECT_EQ(21u, element.GetBitsOnStorage());
+   EXPECT_EQ(6u, element.GetPackedSize(2));
+
+   float mem[] = {1.0f, -3.14159265f, 1.0e-30f, 65504.f, std::numeric_limits<float>::infinity()};
+   unsigned char disk[14];
+   element.Pack(disk, mem, 5);
+   float unpacked[5];
+   element.Unpack(unpacked, disk, 5);
+   EXPECT_FLOAT_EQ(1.0f, unpacked[0]);
+   for (unsigned i = 0; i < 4; ++i) {
+      // 12 mantissa bits
+      EXPECT_NEAR(mem[i], unpacked[i], std::abs(mem[i]) / 4096.);
+   }
+   EXPECT_EQ(std::numeric_limits<float>::infinity(), unpacked[4]);
+}
+
+TEST(Packing, Real32Quant)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32Quant> element(nullptr);
+   element.SetBitsOnStorage(10);
+   element.SetValueRange(-1.0, 1.0);
+
+   float mem[] = {-1.0f, 1.0f, 0.5f, 0.123f, -2.0f, 3.0f};
+   unsigned char disk[8];
+   element.Pack(disk, mem, 6);
+   float unpacked[6];
+   element.Unpack(unpacked, disk, 6);
+   EXPECT_FLOAT_EQ(-1.0f, unpacked[0]);
+   EXPECT_FLOAT_EQ(1.0f, unpacked[1]);
+   EXPECT_NEAR(0.5f, unpacked[2], 1.0 / 1023);
+   EXPECT_NEAR(0.123f, unpacked[3], 1.0 / 1023);
+   // Clamped
+   EXPECT_FLOAT_EQ(-1.0f, unpacked[4]);
+   EXPECT_FLOAT_EQ(1.0f, unpacked[5]);
+}
+
+TEST(Packing, ReducedPrecisionFields)
+{
+   FileRaii fileGuard("test_ntuple_packing_reduced_precision.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldTrunc = std::make_unique<RField<float>>("trunc");
+   fieldTrunc->SetTruncated(16);
+   model->AddField(std::move(fieldTrunc));
+   auto fieldQuant = std::make_unique<RField<float>>("quant");
+   fieldQuant->SetQuantized(0.0, 100.0, 20);
+   model->AddField(std::move(fieldQuant));
+   auto fieldInvalid = std::make_unique<RField<float>>("invalid");
+   EXPECT_THROW(fieldInvalid->SetTruncated(8), RException);
+   EXPECT_THROW(fieldInvalid->SetQuantized(1.0, 1.0, 8), RException);
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto entry = writer->GetModel()->GetDefaultEntry();
+      for (int i = 0; i < 1000; ++i) {
+         *entry->Get<float>("trunc") = 0.1f * i;
+         *entry->Get<float>("quant") = 0.1f * i;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = reader->GetDescriptor();
+   auto columnModel = [&](const std::string &fieldName) {
+      return desc->GetColumnDescriptor(desc->FindColumnId(desc->FindFieldId(fieldName), 0)).GetModel();
+   };
+   EXPECT_EQ(EColumnType::kReal32Trunc, columnModel("trunc").GetType());
+   EXPECT_EQ(16u, columnModel("trunc").GetBitsOnStorage());
+   EXPECT_EQ(EColumnType::kReal32Quant, columnModel("quant").GetType());
+   EXPECT_EQ(20u, columnModel("quant").GetBitsOnStorage());
+   EXPECT_DOUBLE_EQ(0.0, columnModel("quant").GetValueRange().first);
+   EXPECT_DOUBLE_EQ(100.0, columnModel("quant").GetValueRange().second);
+
+   auto viewTrunc = reader->GetView<float>("trunc");
+   auto viewQuant = reader->GetView<float>("quant");
+   for (auto i : reader->GetEntryRange()) {
+      const float expected = 0.1f * i;
+      // 7 bits of mantissa
+      EXPECT_NEAR(expected, viewTrunc(i), expected / 128.);
+      EXPECT_NEAR(expected, viewQuant(i), 100.0 / ((1 << 20) - 1));
+   }
+}
@@ -56,3 +56,130 @@ TEST(Pages, Pool)
    page = pool.GetPage(1, 55);
    EXPECT_TRUE(page.IsNull());
 }
+
+TEST(Pages, Cache)
+{
+   RPageCache cache(10);
+   auto fnKey = [](NTupleSize_t pageNo) { return RPageCache::RKey{"storage", 0, 0, pageNo, 1}; };
+   auto fnBuffer = [](unsigned char value) {
+      RPageCache::Buffer_t buffer(new unsigned char[4]);
+      buffer[0] = value;
+      return buffer;
+   };
+
+   EXPECT_FALSE(cache.Find(fnKey(0)));
+   cache.Insert(fnKey(0), fnBuffer(0), 4);
+   cache.Insert(fnKey(1), fnBuffer(1), 4);
+   EXPECT_EQ(8u, cache.GetSize());
+   ASSERT_TRUE(cache.Find(fnKey(0)));
+   EXPECT_EQ(0, cache.Find(fnKey(0))[0]);
+
+   // Evicts the least recently used page 1
+   cache.Insert(fnKey(2), fnBuffer(2), 4);
+   EXPECT_EQ(2u, cache.GetNPages());
+   EXPECT_FALSE(cache.Find(fnKey(1)));
+   EXPECT_TRUE(cache.Find(fnKey(0)));
+   EXPECT_TRUE(cache.Find(fnKey(2)));
+
+   // Existing entries are kept
+   cache.Insert(fnKey(2), fnBuffer(42), 4);
+   EXPECT_EQ(2, cache.Find(fnKey(2))[0]);
+   // Too large for the cache
+   cache.Insert(fnKey(3), fnBuffer(3), 11);
+   EXPECT_FALSE(cache.Find(fnKey(3)));
+   EXPECT_EQ(2u, cache.GetNPages());
+
+   cache.SetMaxSize(4);
+   EXPECT_EQ(1u, cache.GetNPages());
+   cache.Clear();
+   EXPECT_EQ(0u, cache.GetNPages());
+   EXPECT_EQ(0u, cache.GetSize());
+}
+
+TEST(Pages, SharedCache)
+{
+   FileRaii fileGuard("test_ntuple_pages_shared_cache.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldTracks = model->MakeField<std::vector<float>>("tracks");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 1000; ++i) {
+         *fieldPt = i;
+         *fieldTracks = std::vector<float>(i % 5, i);
+         writer->Fill();
+         if (i % 100 == 99)
+            writer->CommitCluster();
+      }
+   }
+
+   RPageCache::GetShared().Clear();
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      options.SetUseSharedPageCache(true);
+
+      std::vector<std::int64_t> szUnzip;
+      for (int pass = 0; pass < 2; ++pass) {
+         auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+         reader->EnableMetrics();
+         auto viewPt = reader->GetView<float>("pt");
+         auto viewTracks = reader->GetView<std::vector<float>>("tracks");
+         for (auto i : reader->GetEntryRange()) {
+            EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+            EXPECT_EQ(std::vector<float>(i % 5, i), viewTracks(i));
+         }
+         auto counter = reader->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.szUnzip");
+         ASSERT_NE(nullptr, counter);
+         szUnzip.emplace_back(counter->GetValueAsInt());
+      }
+      if (clusterCache == RNTupleReadOptions::EClusterCache::kOn)
+         EXPECT_GT(szUnzip[0], 0);
+      // The second pass finds all the pages in the shared cache
+      EXPECT_EQ(0, szUnzip[1]);
+   }
+   EXPECT_GT(RPageCache::GetShared().GetNPages(), 0u);
+   RPageCache::GetShared().Clear();
+}
+
+TEST(Pages, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_pages_mmap.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *fieldPt = i;
+         writer->Fill();
+         if (i % 100 == 99)
+            writer->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      for (bool useMmap : {false, true}) {
+         RNTupleReadOptions options;
+         options.SetClusterCache(clusterCache);
+         options.SetUseMmap(useMmap);
+         auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+         reader->EnableMetrics();
+         auto viewPt = reader->GetView<float>("pt");
+         for (auto i : reader->GetEntryRange()) {
+            EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+         }
+         auto counter = reader->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.szUnzip");
+         ASSERT_NE(nullptr, counter);
+         if (!useMmap) {
+            EXPECT_GT(counter->GetValueAsInt(), 0);
+         } else {
+#ifndef _WIN32
+            // Uncompressed, mappable pages are used in place of the memory-mapped file
+            EXPECT_EQ(0, counter->GetValueAsInt());
+#endif
+         }
+      }
+   }
+}
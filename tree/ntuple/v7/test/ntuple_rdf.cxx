@@ -48,3 +48,85 @@ TEST(RNTuple, RDF)
    EXPECT_EQ(2U, *rdf.Min("R_rdf_sizeof_jets"));
    EXPECT_EQ(3U, *rdf.Min("R_rdf_sizeof_klass.v1"));
 }
+
+TEST(RNTuple, RDFSkipClusters)
+{
+   FileRaii fileGuard("test_ntuple_rdf_skip_clusters.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrN = model->MakeField<std::int64_t>("n");
+      RNTupleWriteOptions options;
+      options.SetEnableColumnStatistics(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      // Four clusters with pt values in [0, 10), [10, 20), [20, 30), [30, 40)
+      for (int i = 0; i < 40; ++i) {
+         *wrPt = i;
+         *wrN = -i;
+         ntuple->Fill();
+         if (i % 10 == 9)
+            ntuple->CommitCluster();
+      }
+   }
+
+   {
+      auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+      const auto desc = ntuple->GetDescriptor();
+      const auto ptColumnId = desc->FindColumnId(desc->FindFieldId("pt"), 0);
+      const auto nColumnId = desc->FindColumnId(desc->FindFieldId("n"), 0);
+      ASSERT_EQ(4U, desc->GetNClusters());
+      for (const auto &clusterDesc : desc->GetClusterIterable()) {
+         const auto first = static_cast<double>(clusterDesc.GetFirstEntryIndex());
+         const auto &ptStatistics = clusterDesc.GetColumnRange(ptColumnId).fStatistics;
+         ASSERT_TRUE(ptStatistics);
+         EXPECT_DOUBLE_EQ(first, ptStatistics->fMin);
+         EXPECT_DOUBLE_EQ(first + 9, ptStatistics->fMax);
+         const auto &nStatistics = clusterDesc.GetColumnRange(nColumnId).fStatistics;
+         ASSERT_TRUE(nStatistics);
+         EXPECT_LE(nStatistics->fMin, -(first + 9));
+         EXPECT_GE(nStatistics->fMax, -first);
+      }
+   }
+
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(RPageSource::Create("ntuple", fileGuard.GetPath()));
+   ds->SkipClustersOutsideRange("pt", 15, 25);
+   ROOT::RDataFrame df(std::move(ds));
+   // Only the second and third cluster are read
+   EXPECT_EQ(20U, *df.Count());
+   EXPECT_EQ(11U, *df.Filter("pt >= 15 && pt <= 25").Count());
+}
+
+TEST(RNTuple, RDFLateMaterialization)
+{
+   FileRaii fileGuard("test_ntuple_rdf_late_materialization.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(64);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 100; ++i) {
+         *wrPt = i;
+         *wrJets = std::vector<float>(i % 5, i);
+         ntuple->Fill();
+         if (i % 50 == 49)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(RPageSource::Create("ntuple", fileGuard.GetPath()));
+   EXPECT_THROW(ds->MaterializeLate("nonexistent"), RException);
+   ds->MaterializeLate("jets");
+   ds->MaterializeLate("R_rdf_sizeof_jets");
+   ROOT::RDataFrame df(std::move(ds));
+   auto dfSelected = df.Filter("pt >= 90");
+   auto nJets = dfSelected.Sum<std::size_t>("R_rdf_sizeof_jets");
+   auto sumJets = dfSelected.Define("sum", "ROOT::VecOps::Sum(jets)").Sum<float>("sum");
+   EXPECT_EQ(20U, *nJets);
+   float expected = 0;
+   for (int i = 90; i < 100; ++i)
+      expected += (i % 5) * i;
+   EXPECT_FLOAT_EQ(expected, *sumJets);
+   EXPECT_EQ(100U, *df.Count());
+}
@@ -432,10 +432,11 @@ TEST(RPageSinkBuf, CommitSealedPageV)
       ntuple->Fill();
       ntuple->Fill();
       ntuple->CommitCluster();
-      // Parallel zip not available; all pages committed separately
-      EXPECT_EQ(3, counters.fNCommitPage);
+      // Parallel zip not available; the pages are sealed on committing the cluster and still written by a single
+      // call to `CommitSealedPageV()`
+      EXPECT_EQ(0, counters.fNCommitPage);
       EXPECT_EQ(0, counters.fNCommitSealedPage);
-      EXPECT_EQ(0, counters.fNCommitSealedPageV);
+      EXPECT_EQ(1, counters.fNCommitSealedPageV);
    }
    ROOT::EnableImplicitMT();
    {
@@ -448,7 +449,8 @@ TEST(RPageSinkBuf, CommitSealedPageV)
       auto ntuple = std::make_unique<RNTupleWriter>(std::move(model), std::make_unique<RPageSinkBuf>(std::move(sink)));
       ntuple->Fill();
       ntuple->Fill();
-      ntuple->CommitCluster();
+      // The sealed pages are written in the background; committing the cluster group waits for the write
+      ntuple->CommitCluster(true /* commitClusterGroup */);
       // All pages in all columns committed via a single call to `CommitSealedPageV()`
       EXPECT_EQ(0, counters.fNCommitPage);
       EXPECT_EQ(0, counters.fNCommitSealedPage);
@@ -507,3 +509,92 @@ TEST(RPageSink, MultipleClusterGroups)
    ntuple->LoadEntry(2);
    EXPECT_EQ(12.0, *rdPt);
 }
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer.root");
+
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 10000;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<int>("thread");
+      model->MakeField<std::vector<float>>("values");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto context = writer->CreateFillContext();
+            auto entry = context->CreateEntry();
+            auto thread = entry->Get<int>("thread");
+            auto values = entry->Get<std::vector<float>>("values");
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *thread = t;
+               *values = std::vector<float>(i % 4, static_cast<float>(i));
+               context->Fill(*entry);
+               if (i % 1000 == 999)
+                  context->CommitCluster();
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), ntuple->GetNEntries());
+   EXPECT_EQ(static_cast<std::size_t>(kNThreads * kNEntriesPerThread / 1000),
+             ntuple->GetDescriptor()->GetNClusters());
+
+   auto viewThread = ntuple->GetView<int>("thread");
+   auto viewValues = ntuple->GetView<std::vector<float>>("values");
+   std::vector<int> nEntriesPerThread(kNThreads, 0);
+   for (auto i : ntuple->GetEntryRange()) {
+      const auto t = viewThread(i);
+      ASSERT_GE(t, 0);
+      ASSERT_LT(t, kNThreads);
+      // Entries of the same fill context are written in order
+      const auto idx = nEntriesPerThread[t]++;
+      EXPECT_EQ(std::vector<float>(idx % 4, static_cast<float>(idx)), viewValues(i));
+   }
+   for (auto n : nEntriesPerThread)
+      EXPECT_EQ(kNEntriesPerThread, n);
+}
+
+TEST(RNTupleParallelWriter, StagedClusters)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_staged.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<int>("i");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+
+      auto first = writer->CreateFillContext();
+      auto second = writer->CreateFillContext();
+      first->EnableStagedClusterCommitting();
+      second->EnableStagedClusterCommitting();
+      auto fill = [](RNTupleFillContext &context, int begin, int end) {
+         auto entry = context.CreateEntry();
+         for (int i = begin; i < end; ++i) {
+            *entry->Get<int>("i") = i;
+            context.Fill(*entry);
+            if (i % 10 == 9)
+               context.CommitCluster();
+         }
+      };
+      // the second context is filled and committed first, but its clusters are written last
+      fill(*second, 50, 100);
+      fill(*first, 0, 50);
+      first->CommitStagedClusters();
+      second->CommitStagedClusters();
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(100u, ntuple->GetNEntries());
+   EXPECT_EQ(10u, ntuple->GetDescriptor()->GetNClusters());
+   auto viewI = ntuple->GetView<int>("i");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_EQ(static_cast<int>(i), viewI(i));
+}
@@ -93,6 +93,43 @@ TEST(RNTuple, BulkView)
    }
 }
 
+TEST(RNTuple, BulkViewSpan)
+{
+   FileRaii fileGuard("test_ntuple_bulk_view_span.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto eltsPerPage = 10'000;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(eltsPerPage * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 100'000; i++) {
+         *fieldPt = i;
+         ntuple->Fill();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+
+   auto span = viewPt.MapSpan(eltsPerPage - 2);
+   ASSERT_EQ(2U, span.size());
+   EXPECT_FLOAT_EQ(eltsPerPage - 2, span[0]);
+   EXPECT_FLOAT_EQ(eltsPerPage - 1, span[1]);
+
+   NTupleSize_t nSeen = 0;
+   unsigned int nSpans = 0;
+   viewPt.ForEachSpan(RNTupleGlobalRange(5, 3 * eltsPerPage + 5), [&](NTupleSize_t first, std::span<const float> s) {
+      EXPECT_EQ(5 + nSeen, first);
+      for (std::size_t i = 0; i < s.size(); ++i)
+         EXPECT_FLOAT_EQ(first + i, s[i]);
+      nSeen += s.size();
+      nSpans++;
+   });
+   EXPECT_EQ(3U * eltsPerPage, nSeen);
+   EXPECT_EQ(4U, nSpans);
+}
+
 TEST(RNTuple, BulkViewCollection)
 {
    FileRaii fileGuard("test_ntuple_bulk_view_collection.root");
@@ -28,6 +28,8 @@ struct Data {
    std::vector<std::string> fBranchNames;
    /// If the branch names should use regex matching.
    bool fUseRegex = false;
+   /// If the time spent waiting for I/O and decompressing should be measured separately.
+   bool fStageTimes = false;
 };
 
 struct Result {
@@ -45,6 +47,10 @@ struct Result {
    ULong64_t fCompressedBytesRead;
    /// Size of ROOT's thread pool for the run (0 indicates a single-thread run with no thread pool present).
    unsigned int fThreadPoolSize;
+   /// Time spent in storage reads, summed over all threads. Only measured if Data::fStageTimes is set.
+   double fDiskTime = 0.;
+   /// Time spent decompressing baskets, summed over all threads. Only measured if Data::fStageTimes is set.
+   double fUnzipTime = 0.;
 };
 
 struct EntryRange {
@@ -55,6 +61,8 @@ struct EntryRange {
 struct ByteData {
    ULong64_t fUncompressedBytesRead;
    ULong64_t fCompressedBytesRead;
+   double fDiskTime = 0.;
+   double fUnzipTime = 0.;
 };
 
 struct ReadSpeedRegex {
@@ -68,8 +76,9 @@ std::vector<std::string> GetMatchingBranchNames(const std::string &fileName, con
                                                 const std::vector<ReadSpeedRegex> &regexes);
 
 // Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
+// If stageTimes is true, also return the time spent in storage reads and in decompression.
 ByteData ReadTree(TFile *file, const std::string &treeName, const std::vector<std::string> &branchNames,
-                  EntryRange range = {-1, -1});
+                  EntryRange range = {-1, -1}, bool stageTimes = false);
 
 Result EvalThroughputST(const Data &d);
 
@@ -21,12 +21,14 @@
 namespace ReadSpeed {
 
 void PrintThroughput(const Result &r);
+void PrintThroughputJSON(const Result &r);
 
 struct Args {
    Data fData;
    unsigned int fNThreads = 0;
    bool fAllBranches = false;
    bool fShouldRun = false;
+   bool fJSONOutput = false;
 };
 
 Args ParseArgs(const std::vector<std::string> &args);
@@ -22,6 +22,7 @@
 #include <TBranch.h>
 #include <TStopwatch.h>
 #include <TTree.h>
+#include <TTreePerfStats.h>
 
 #include <algorithm>
 #include <cassert>
@@ -122,13 +123,17 @@ ByteData SumBytes(const std::vector<ByteData> &bytesData) {
    const auto compressedBytes =
       std::accumulate(bytesData.begin(), bytesData.end(), 0ull,
                         [](ULong64_t sum, const ByteData &o) { return sum + o.fCompressedBytesRead; });
+   const auto diskTime = std::accumulate(bytesData.begin(), bytesData.end(), 0.,
+                                         [](double sum, const ByteData &o) { return sum + o.fDiskTime; });
+   const auto unzipTime = std::accumulate(bytesData.begin(), bytesData.end(), 0.,
+                                          [](double sum, const ByteData &o) { return sum + o.fUnzipTime; });
 
-   return {uncompressedBytes, compressedBytes};
+   return {uncompressedBytes, compressedBytes, diskTime, unzipTime};
 };
 
 // Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
 ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::vector<std::string> &branchNames,
-                             EntryRange range)
+                             EntryRange range, bool stageTimes)
 {
    std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
    if (t == nullptr)
@@ -155,6 +160,11 @@ ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::v
                                t->GetName() + "' in file '" + t->GetCurrentFile()->GetName() + "' with " +
                                std::to_string(nEntries) + " entries.");
 
+   // TTreePerfStats is notified of every read from the file and of every basket decompression of this tree
+   std::unique_ptr<TTreePerfStats> perfStats;
+   if (stageTimes)
+      perfStats = std::make_unique<TTreePerfStats>("readspeed", t.get());
+
    ULong64_t bytesRead = 0;
    const ULong64_t fileStartBytes = f->GetBytesRead();
    for (auto e = range.fStart; e < range.fEnd; ++e)
@@ -162,7 +172,11 @@ ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::v
          bytesRead += b->GetEntry(e);
 
    const ULong64_t fileBytesRead = f->GetBytesRead() - fileStartBytes;
-   return {bytesRead, fileBytesRead};
+   if (!perfStats)
+      return {bytesRead, fileBytesRead};
+
+   t->SetPerfStats(nullptr);
+   return {bytesRead, fileBytesRead, perfStats->GetDiskTime(), perfStats->GetUnzipTime()};
 }
 
 Result ReadSpeed::EvalThroughputST(const Data &d)
@@ -171,6 +185,8 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
    auto fileIdx = 0;
    ULong64_t uncompressedBytesRead = 0;
    ULong64_t compressedBytesRead = 0;
+   double diskTime = 0.;
+   double unzipTime = 0.;
 
    TStopwatch sw;
    const auto fileBranchNames = GetPerFileBranchNames(d);
@@ -182,9 +198,11 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
 
       sw.Start(kFALSE);
 
-      const auto byteData = ReadTree(f.get(), d.fTreeNames[treeIdx], fileBranchNames[fileIdx]);
+      const auto byteData = ReadTree(f.get(), d.fTreeNames[treeIdx], fileBranchNames[fileIdx], {-1, -1}, d.fStageTimes);
       uncompressedBytesRead += byteData.fUncompressedBytesRead;
       compressedBytesRead += byteData.fCompressedBytesRead;
+      diskTime += byteData.fDiskTime;
+      unzipTime += byteData.fUnzipTime;
 
       if (d.fTreeNames.size() > 1)
          ++treeIdx;
@@ -193,7 +211,7 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
       sw.Stop();
    }
 
-   return {sw.RealTime(), sw.CpuTime(), 0., 0., uncompressedBytesRead, compressedBytesRead, 0};
+   return {sw.RealTime(), sw.CpuTime(), 0., 0., uncompressedBytesRead, compressedBytesRead, 0, diskTime, unzipTime};
 }
 
 // Return a vector of EntryRanges per file, i.e. a vector of vectors of EntryRanges with outer size equal to
@@ -314,7 +332,7 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
          if (file == nullptr || file->IsZombie())
             throw std::runtime_error("Could not open file '" + fileName + '\'');
 
-         auto result = ReadTree(file.get(), treeName, branchNames, range);
+         auto result = ReadTree(file.get(), treeName, branchNames, range, d.fStageTimes);
 
          return result;
       };
@@ -335,7 +353,9 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
            clsw.CpuTime(),
            totalByteData.fUncompressedBytesRead,
            totalByteData.fCompressedBytesRead,
-           actualThreads};
+           actualThreads,
+           totalByteData.fDiskTime,
+           totalByteData.fUnzipTime};
 #else
    (void)d;
    (void)nThreads;
@@ -26,6 +26,8 @@ const auto usageText = "Usage:\n"
                        "[bregex2 ...])\n"
                        "               [--threads nthreads]\n"
                        "               [--tasks-per-worker ntasks]\n"
+                       "               [--stage-timings]\n"
+                       "               [--json]\n"
                        " rootreadspeed (--help|-h)\n"
                        " \n"
                        " Use -h for usage help, --help for detailed information.\n";
@@ -34,7 +36,8 @@ const auto argUsageText =
    "Arguments:\n"
    " Specifying files and trees:\n"
    "   --files fname1 [fname2...]\n"
-   "    The list of root files to read from.\n"
+   "    The list of root files to read from. Any URL supported by TFile::Open can be used,\n"
+   "    for example root:// (XRootD) or https:// (Davix) to measure remote access.\n"
    "\n"
    "   --trees tname1 [tname2...]\n"
    "    The list of trees to read from the files. If only one tree is provided then it will\n"
@@ -62,7 +65,15 @@ const auto argUsageText =
    "    available threads on the machine.\n"
    "\n"
    "   --tasks-per-worker ntasks\n"
-   "    The number of tasks to generate for each worker thread when using multithreading.\n";
+   "    The number of tasks to generate for each worker thread when using multithreading.\n"
+   "\n"
+   "   --stage-timings\n"
+   "    Also measure the time spent waiting for storage reads and decompressing baskets, summed\n"
+   "    over all threads. The remaining CPU time is mostly spent deserializing the branch values.\n"
+   "    The bookkeeping adds a small overhead.\n"
+   "\n"
+   "   --json\n"
+   "    Print the results as a JSON object, for comparisons by scripts.\n";
 
 const auto fullUsageText =
    "Description:\n"
@@ -173,6 +184,13 @@ void ReadSpeed::PrintThroughput(const Result &r)
 
    const float cpuEfficiency = (r.fCpuTime / effectiveThreads) / r.fRealTime;
 
+   if (r.fDiskTime > 0. || r.fUnzipTime > 0.) {
+      std::cout << "Storage read time:\t\t" << r.fDiskTime << " s\n";
+      std::cout << "Decompression time:\t\t" << r.fUnzipTime << " s\n";
+      std::cout << "Deserialization time:\t\t" << std::max(r.fCpuTime - r.fUnzipTime, 0.)
+                << " s (CPU time minus decompression time)\n\n";
+   }
+
    std::cout << "CPU Efficiency: \t\t" << (cpuEfficiency * 100) << "%\n";
    std::cout << "Reading data is ";
    if (cpuEfficiency > 0.80f) {
@@ -185,6 +203,25 @@ void ReadSpeed::PrintThroughput(const Result &r)
    std::cout << "For details run with the --help command.\n";
 }
 
+void ReadSpeed::PrintThroughputJSON(const Result &r)
+{
+   const unsigned int effectiveThreads = std::max(r.fThreadPoolSize, 1u);
+   std::cout << "{\n"
+             << "  \"threadPoolSize\": " << r.fThreadPoolSize << ",\n"
+             << "  \"mtSetupRealTime\": " << r.fMTSetupRealTime << ",\n"
+             << "  \"mtSetupCpuTime\": " << r.fMTSetupCpuTime << ",\n"
+             << "  \"realTime\": " << r.fRealTime << ",\n"
+             << "  \"cpuTime\": " << r.fCpuTime << ",\n"
+             << "  \"diskTime\": " << r.fDiskTime << ",\n"
+             << "  \"unzipTime\": " << r.fUnzipTime << ",\n"
+             << "  \"uncompressedBytes\": " << r.fUncompressedBytesRead << ",\n"
+             << "  \"compressedBytes\": " << r.fCompressedBytesRead << ",\n"
+             << "  \"uncompressedThroughputMBs\": " << r.fUncompressedBytesRead / r.fRealTime / 1024 / 1024 << ",\n"
+             << "  \"compressedThroughputMBs\": " << r.fCompressedBytesRead / r.fRealTime / 1024 / 1024 << ",\n"
+             << "  \"cpuEfficiency\": " << (r.fCpuTime / effectiveThreads) / r.fRealTime << "\n"
+             << "}" << std::endl;
+}
+
 Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 {
    // Print help message and exit if "--help"
@@ -205,6 +242,7 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 
    Data d;
    unsigned int nThreads = 0;
+   bool jsonOutput = false;
 
    enum class EArgState { kNone, kTrees, kFiles, kBranches, kThreads, kTasksPerWorkerHint } argState = EArgState::kNone;
    enum class EBranchState { kNone, kRegular, kRegex, kAll } branchState = EBranchState::kNone;
@@ -246,6 +284,12 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
          argState = EArgState::kThreads;
       } else if (arg == "--tasks-per-worker") {
          argState = EArgState::kTasksPerWorkerHint;
+      } else if (arg == "--stage-timings") {
+         argState = EArgState::kNone;
+         d.fStageTimes = true;
+      } else if (arg == "--json") {
+         argState = EArgState::kNone;
+         jsonOutput = true;
       } else if (arg[0] == '-') {
          std::cerr << "Unrecognized option '" << arg << "'\n";
          return {};
@@ -272,7 +316,7 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
       }
    }
 
-   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true, jsonOutput};
 }
 
 Args ReadSpeed::ParseArgs(int argc, char **argv)
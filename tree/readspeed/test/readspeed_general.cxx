@@ -69,6 +69,17 @@ TEST_F(ReadSpeedIntegration, SingleThread)
    EXPECT_EQ(result.fCompressedBytesRead, 643934) << "Wrong number of compressed bytes read";
 }
 
+TEST_F(ReadSpeedIntegration, StageTimes)
+{
+   Data d{{"t"}, {"readspeedinput1.root"}, {"x"}};
+   d.fStageTimes = true;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fUncompressedBytesRead, 40000000) << "Wrong number of uncompressed bytes read";
+   EXPECT_GT(result.fUnzipTime, 0.) << "Decompression time not measured";
+   EXPECT_GE(result.fDiskTime, 0.) << "Storage read time not measured";
+}
+
 #ifdef R__USE_IMT
 TEST_F(ReadSpeedIntegration, MultiThread)
 {
@@ -261,6 +272,20 @@ TEST(ReadSpeedCLI, MultipleThreads)
    EXPECT_EQ(parsedArgs.fNThreads, threads) << "Program not using the correct amount of threads";
 }
 
+TEST(ReadSpeedCLI, StageTimesAndJSON)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--trees", "t", "--stage-timings", "--json", "--branches", "x",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_TRUE(parsedArgs.fData.fStageTimes) << "Stage timings not requested";
+   EXPECT_TRUE(parsedArgs.fJSONOutput) << "JSON output not requested";
+   EXPECT_EQ(parsedArgs.fData.fBranchNames, std::vector<std::string>{"x"}) << "Branch names not parsed correctly";
+}
+
 #ifdef R__USE_IMT
 TEST(ReadSpeedCLI, WorkerThreadsHint)
 {
@@ -46,6 +46,20 @@ std::vector<std::string> GetTreeFullPaths(const TTree &tree);
 
 void ClearMustCleanupBits(TObjArray &arr);
 
+/// Number of entries and cluster boundaries of a tree stored in a file, see GetTreeMetadata()
+struct RTreeMetadata {
+   /// The number of entries of the tree, -1 if the file could not be opened or the tree could not be read
+   Long64_t fEntries = -1;
+   /// The [begin, end) entry ranges of the clusters of the tree; only filled on request
+   std::vector<std::pair<Long64_t, Long64_t>> fClusters;
+   /// If fEntries is -1, describes what went wrong
+   std::string fError;
+};
+
+RTreeMetadata GetTreeMetadata(const std::string &fileName, const std::string &treeName, bool withClusters = false);
+std::vector<RTreeMetadata> GetTreeMetadata(const std::vector<std::string> &fileNames,
+                                           const std::vector<std::string> &treeNames, bool withClusters = false);
+
 class RNoCleanupNotifierHelper {
    TChain *fChain = nullptr;
 
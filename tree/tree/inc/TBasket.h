@@ -27,6 +27,8 @@
 
 #include "TKey.h"
 
+#include "ROOT/RMemoryAccounting.hxx"
+
 class TFile;
 class TTree;
 class TBranch;
@@ -75,10 +77,14 @@ protected:
    Int_t       fLastWriteBufferSize[3] = {0,0,0}; ///<! Size of the buffer last three buffers we wrote it to disk
    Bool_t      fResetAllocation{false};           ///<! True if last reset re-allocated the memory
    UChar_t     fNextBufferSizeRecord{0};          ///<! Index into fLastWriteBufferSize of the last buffer written to disk
+   Int_t       fWriteCycle{-1};                   ///<! Key cycle for the next WriteBuffer() if set by PrepareAsyncWrite(), -1 otherwise
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    ULong64_t   fResetAllocationTime{0};           ///<! Time spent reallocating baskets in microseconds during last Reset operation.
 #endif
+   /// Size of the owned buffers, reported to ROOT::Experimental::MemoryAccounting
+   ROOT::Experimental::MemoryAccounting::RAccountedSize fAccountedBuffers{ROOT::Experimental::EMemoryTag::kBasket}; //!
 
+   void            AccountBuffers();
    virtual void    ReadResetBuffer(Int_t basketnumber);
 
 public:
@@ -131,6 +137,7 @@ public:
            Int_t   GetLast() const {return fLast;}
    virtual void    MoveEntries(Int_t dentries);
    virtual void    PrepareBasket(Long64_t /* entry */) {};
+           void    PrepareAsyncWrite(Int_t cycle);
            Int_t   ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file);
            Int_t   ReadBasketBytes(Long64_t pos, TFile *file);
    virtual void    WriteReset();
@@ -144,6 +151,7 @@ public:
 
    Int_t           LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tree = nullptr);
    Long64_t        CopyTo(TFile *to);
+   Int_t           Recompress(Int_t cxlevel, Int_t cxAlgorithm);
 
            void    SetBranch(TBranch *branch) { fBranch = branch; }
            void    SetNevBufSize(Int_t n) { fNevBufSize=n; }
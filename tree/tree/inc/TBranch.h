@@ -31,6 +31,8 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -71,9 +73,11 @@ class TBulkBranchRead {
 
 public:
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
+   Int_t GetBulkEntriesJagged(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
    Bool_t SupportsBulkRead() const;
+   Bool_t SupportsBulkReadJagged() const;
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -150,6 +154,18 @@ protected:
 
    Bool_t      fSkipZip;          ///<! After being read, the buffer will not be unzipped.
 
+   TBasket    *fPipelinedBasket{nullptr};  ///<! Basket being written by a task of the pipelined TTree::Fill()
+   Int_t       fPipelinedWhere{-1};        ///<! Basket number of fPipelinedBasket
+   Int_t       fPipelinedNout{0};          ///<! Return value of fPipelinedBasket->WriteBuffer(), set by the task
+   TBasket    *fPipelinedSpare{nullptr};   ///<! Written pipelined basket, reused as a later write basket
+   ROOT::Internal::TBranchIMTHelper *fPipelineHelper{nullptr}; ///<! Runs the write task of fPipelinedBasket
+
+   std::vector<char>   fCompressionDict;              ///<  ZSTD dictionary trained on the first baskets (algorithm kZSTDDict)
+   UInt_t              fCompressionDictID{0};         ///<! Identifier of the registered fCompressionDict, 0 if none
+   Bool_t              fCompressionDictDone{kFALSE};  ///<! Dictionary trained or training given up
+   std::vector<char>   fDictSamples;                  ///<! Beginning of the first baskets, to train fCompressionDict
+   std::vector<size_t> fDictSampleSizes;              ///<! Size of each sample in fDictSamples
+
    using CacheInfo_t = ROOT::Internal::TBranchCacheInfo;
    CacheInfo_t fCacheInfo;        ///<! Hold info about which basket are in the cache and if they have been retrieved from the cache.
 
@@ -169,6 +185,7 @@ protected:
    TBasket *GetFreshBasket(Int_t basketnumber, TBuffer *user_buffer);
    TBasket *GetFreshCluster(TBuffer *user_buffer);
    Int_t    WriteBasket(TBasket* basket, Int_t where) { return WriteBasketImpl(basket, where, nullptr); }
+   Int_t    FinishPipelinedBasket();
 
    TString  GetRealFileName() const;
 
@@ -178,6 +195,7 @@ private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
    TBasket *GetBasketImpl(Int_t basket, TBuffer* user_buffer);
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
+   Int_t    GetBulkEntriesJagged(Long64_t, TBuffer&, std::vector<Int_t>&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
@@ -217,6 +235,8 @@ public:
            Int_t     GetCompressionAlgorithm() const;
            Int_t     GetCompressionLevel() const;
            Int_t     GetCompressionSettings() const;
+           UInt_t    GetCompressionDictionaryID() const { return fCompressionDictID; }
+           UInt_t    PrepareCompressionDictionary(const char *buf, Int_t len);
    TDirectory       *GetDirectory() const {return fDirectory;}
    virtual Int_t     GetEntry(Long64_t entry=0, Int_t getall = 0);
    virtual Int_t     GetEntryExport(Long64_t entry, Int_t getall, TClonesArray *list, Int_t n);
@@ -252,6 +272,7 @@ public:
            TBranch  *GetSubBranch(const TBranch *br) const;
            TBuffer  *GetTransientBuffer(Int_t size);
            Bool_t    IsAutoDelete() const;
+           Bool_t    IsEntryInCurrentBaskets(Long64_t entry) const;
            Bool_t    IsFolder() const override;
    virtual void      KeepCircular(Long64_t maxEntries);
    virtual Int_t     LoadBaskets();
@@ -283,12 +304,13 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree; }
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           Bool_t    SupportsBulkReadJagged() const;
    virtual void      UpdateAddress() {}
    virtual void      UpdateFile();
 
    static  void      ResetCount();
 
-   ClassDefOverride(TBranch, 13); // Branch descriptor
+   ClassDefOverride(TBranch, 14); // Branch descriptor
 };
 
 //______________________________________________________________________________
@@ -314,9 +336,11 @@ namespace Experimental {
 namespace Internal {
 
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntriesJagged(Long64_t evt, TBuffer& user_buf, std::vector<Int_t> &offsets) { return fParent.GetBulkEntriesJagged(evt, user_buf, offsets); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsBulkReadJagged() const { return fParent.SupportsBulkReadJagged(); }
 
 }  // Internal
 }  // Experimental
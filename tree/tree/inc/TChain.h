@@ -52,6 +52,7 @@ private:
 
 protected:
    void InvalidateCurrentTree();
+   void PrefetchEntries();
    void ReleaseChainProof();
 
 public:
@@ -47,6 +47,11 @@ class TEntryList: public TNamed
                                         ///<  (when the entry list is used as input in TChain)
    TDirectory      *fDirectory;         ///<! Pointer to directory holding this tree
    Bool_t           fReapply;           ///<  If true, TTree::Draw will 'reapply' the original cut
+   TString          fLastUrl;           ///<! Last file name given to GetFileName()
+   TString          fLastUrlFile;       ///<! Corresponding result of GetFileName()
+   Bool_t           fLastUrlLocal = kFALSE; ///<! Corresponding locality of the file
+   TString          fLastTreeFile;      ///<! Name of the file of the last tree given to SetTree(const TTree*)
+   TString          fLastTreeFileUrl;   ///<! Corresponding full url
 
    void             GetFileName(const char *filename, TString &fn, Bool_t * = nullptr);
 
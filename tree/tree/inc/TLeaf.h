@@ -89,6 +89,8 @@ protected:
                                                                   // polymorphism!), this will generate an appropriate
                                                                   // offset array.
 
+  static bool SwapJaggedValues(TBuffer &b, Int_t start, Long64_t nvalues, Int_t size); // Helper for ReadBasketJagged.
+
 
 public:
    enum EStatusBits {
@@ -153,10 +155,12 @@ public:
    virtual void     ReadBasketExport(TBuffer &, TClonesArray *, Int_t) {}
    virtual bool     ReadBasketFast(TBuffer&, Long64_t) { return false; }  // Read contents of leaf into a user-provided buffer.
    virtual bool     ReadBasketSerialized(TBuffer&, Long64_t) { return true; }
+   virtual bool     ReadBasketJagged(TBuffer &b, Long64_t N, const Int_t *entryOffset, Int_t last, std::vector<Int_t> &offsets); // Read variable-size entries into contiguous values plus offsets.
    virtual void     ReadValue(std::istream & /*s*/, Char_t /*delim*/ = ' ') {
       Error("ReadValue", "Not implemented!");
    }
            Int_t    ResetAddress(void *add, Bool_t calledFromDestructor = kFALSE);
+   virtual Bool_t   SupportsBulkReadJagged() const;
    virtual void     SetAddress(void *add = nullptr);
    virtual void     SetBranch(TBranch *branch) { fBranch = branch; }
    virtual void     SetLeafCount(TLeaf *leaf);
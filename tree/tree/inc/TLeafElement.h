@@ -40,6 +40,7 @@ protected:
 
 private:
    Int_t            GetOffsetHeaderSize() const override {return 1;}
+   EDataType        GetVectorValueType() const;
 
 public:
    TLeafElement();
@@ -64,12 +65,14 @@ public:
    template<typename T> T GetTypedValueSubArray(Int_t i=0, Int_t j=0) const {return ((TBranchElement*)fBranch)->GetTypedValue<T>(i, j, kTRUE);}
 
    bool             ReadBasketFast(TBuffer&, Long64_t) override;
+   bool             ReadBasketJagged(TBuffer &b, Long64_t N, const Int_t *entryOffset, Int_t last, std::vector<Int_t> &offsets) override;
 
    void            *GetValuePointer() const override { return ((TBranchElement*)fBranch)->GetValuePointer(); }
    Bool_t           IncludeRange(TLeaf *) override;
    Bool_t           IsOnTerminalBranch() const override;
    void             PrintValue(Int_t i=0) const override {((TBranchElement*)fBranch)->PrintValue(i);}
    void             SetLeafCount(TLeaf *leaf) override { fLeafCount = leaf; }
+   Bool_t           SupportsBulkReadJagged() const override { return GetVectorValueType() != kOther_t; }
 
    ClassDefOverride(TLeafElement,1);  //A TLeaf for a general object derived from TObject.
 };
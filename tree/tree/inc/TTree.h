@@ -50,6 +50,7 @@ class TList;
 
 #include <array>
 #include <atomic>
+#include <string>
 #include <vector>
 #include <utility>
 
@@ -140,6 +141,7 @@ protected:
    UInt_t         fNEntriesSinceSorting;  ///<! Number of entries processed since the last re-sorting of branches
    std::vector<std::pair<Long64_t,TBranch*>> fSortedBranches; ///<! Branches to be processed in parallel when IMT is on, sorted by average task time
    std::vector<TBranch*> fSeqBranches;    ///<! Branches to be processed sequentially when IMT is on
+   std::vector<Int_t> fParBranchesToLoad; ///<! Indices in fSortedBranches of the branches loading new baskets in GetEntry
    Float_t fTargetMemoryRatio{1.1f};      ///<! Ratio for memory usage in uncompressed buffers versus actual occupancy.  1.0
                                            /// indicates basket should be resized to exact memory usage, but causes significant
 /// memory churn.
@@ -156,8 +158,12 @@ private:
    mutable Bool_t fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   Bool_t fIMTPipelinedFill{kFALSE};              ///<! True if full baskets are written by tasks while Fill() continues.
+   Int_t fOptimizeBasketsInterval{0};             ///<! Number of clusters between two OptimizeBaskets done by Fill(), 0 for the first cluster only
+   std::vector<std::string> fHotBranches;         ///<! Branches read most often, see SetHotBranches()
 
    void             InitializeBranchLists(bool checkLeafCount);
+   Int_t            FinishPipelinedBaskets() const;
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
    void             MarkEventCluster();
@@ -218,7 +224,8 @@ protected:
       kLoadTree          = BIT(9),
       kPrint             = BIT(10),
       kRemoveFriend      = BIT(11),
-      kSetBranchStatus   = BIT(12)
+      kSetBranchStatus   = BIT(12),
+      kSetCacheEntryRange = BIT(13)
    };
 
 public:
@@ -473,7 +480,9 @@ public:
    virtual TTree          *GetFriend(const char*) const;
    virtual const char     *GetFriendAlias(TTree*) const;
            TH1            *GetHistogram() { return GetPlayer()->GetHistogram(); }
+   const std::vector<std::string> &GetHotBranches() const { return fHotBranches; }
    virtual Bool_t          GetImplicitMT() { return fIMTEnabled; }
+           Bool_t          GetImplicitMTPipelinedFill() const { return fIMTPipelinedFill; }
    virtual Int_t          *GetIndex() { return &fIndex.fArray[0]; }
    virtual Double_t       *GetIndexValues() { return &fIndexValues.fArray[0]; }
            ROOT::TIOFeatures GetIOFeatures() const;
@@ -497,6 +506,7 @@ public:
    virtual Double_t        GetMinimum(const char* columname);
    virtual Int_t           GetNbranches() { return fBranches.GetEntriesFast(); }
            TObject        *GetNotify() const { return fNotify; }
+           Int_t           GetOptimizeBasketsInterval() const { return fOptimizeBasketsInterval; }
    TVirtualTreePlayer     *GetPlayer();
    virtual Int_t           GetPacketSize() const { return fPacketSize; }
    virtual TVirtualPerfStats *GetPerfStats() const { return fPerfStats; }
@@ -543,6 +553,7 @@ public:
            Bool_t          IsFolder() const override { return kTRUE; }
    virtual Bool_t          InPlaceClone(TDirectory *newdirectory, const char *options = "");
    virtual Int_t           LoadBaskets(Long64_t maxmemory = 2000000000);
+           Int_t           LoadHotBranches(const char *profile);
    virtual Long64_t        LoadTree(Long64_t entry);
    virtual Long64_t        LoadTreeFriend(Long64_t entry, TTree* T);
    virtual Int_t           MakeClass(const char *classname = nullptr, Option_t* option = "");
@@ -578,6 +589,8 @@ public:
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
    virtual void            SetBasketSize(const char* bname, Int_t buffsize = 16000);
+           void            SetHotBranches(const std::vector<std::string> &branches) { fHotBranches = branches; }
+           void            SetOptimizeBasketsInterval(Int_t nclusters) { fOptimizeBasketsInterval = nclusters; }
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TBranch **ptr = nullptr);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TClass *realClass, EDataType datatype, Bool_t isptr);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TBranch **ptr, TClass *realClass, EDataType datatype, Bool_t isptr);
@@ -615,6 +628,7 @@ public:
    virtual void            SetEventList(TEventList* list);
    virtual void            SetEntryList(TEntryList* list, Option_t *opt="");
    virtual void            SetImplicitMT(Bool_t enabled) { fIMTEnabled = enabled; }
+           void            SetImplicitMTPipelinedFill(Bool_t enabled);
    virtual void            SetMakeClass(Int_t make);
    virtual void            SetMaxEntryLoop(Long64_t maxev = kMaxEntries) { fMaxEntryLoop = maxev; } // *MENU*
    static  void            SetMaxTreeSize(Long64_t maxsize = 100000000000LL);
@@ -23,6 +23,7 @@
 
 #include "TFileCacheRead.h"
 
+#include <string>
 #include <vector>
 
 class TTree;
@@ -66,6 +67,7 @@ protected:
    Bool_t       fAutoCreated{kFALSE}; ///<! true if cache was automatically created
 
    Bool_t       fLearnPrefilling{kFALSE}; ///<! true if we are in the process of executing LearnPrefill
+   Bool_t       fProfileLoaded{kFALSE};   ///<! true if the cached branches were taken from a learned-branch profile
 
    // These members hold cached data for missed branches when miss optimization
    // is enabled.  Pointers are only initialized if the miss cache is enabled.
@@ -138,11 +140,13 @@ public:
    Bool_t               GetOptimizeMisses() const { return fOptimizeMisses; }
    const TObjArray     *GetCachedBranches() const { return fBranches; }
    EPrefillType         GetConfiguredPrefillType() const;
+   static const char   *GetConfiguredProfile();
    Double_t             GetEfficiency() const;
    Double_t             GetEfficiencyRel() const;
    virtual Int_t        GetEntryMin() const {return fEntryMin;}
    virtual Int_t        GetEntryMax() const {return fEntryMax;}
    static Int_t         GetLearnEntries();
+   std::vector<std::string> GetLearnedBranches() const;
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
@@ -154,6 +158,7 @@ public:
    virtual Bool_t       FillBuffer();
    Int_t                LearnBranch(TBranch *b, Bool_t subgbranches = kFALSE) override;
    virtual void         LearnPrefill();
+   Int_t                LoadLearnedBranches(const char *filename = nullptr);
 
    void                 Print(Option_t *option="") const override;
    Int_t                ReadBuffer(char *buf, Long64_t pos, Int_t len) override;
@@ -161,12 +166,14 @@ public:
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
    void                 ResetMissCache(); // Reset the miss cache.
+   Int_t                SaveLearnedBranches(const char *filename = nullptr) const;
    void                 SetAutoCreated(Bool_t val) {fAutoCreated = val;}
    Int_t                SetBufferSize(Int_t buffersize) override;
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
    void                 SetFile(TFile *file, TFile::ECacheAction action=TFile::kDisconnect) override;
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
+   Int_t                SetLearnedBranches(const std::vector<std::string> &branches);
    void                 SetOptimizeMisses(Bool_t opt);
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
@@ -91,11 +91,16 @@ protected:
 #ifdef R__USE_IMT
    std::unique_ptr<ROOT::Experimental::TTaskGroup> fUnzipTaskGroup;
 #endif
+   std::vector<Long64_t> fSeekEntry;       ///<! [fNseek] First entry of the basket behind each prefetched block
+   std::vector<Int_t>    fUnzipOrder;      ///<! Prefetched blocks in the order in which the reader needs them
+   Int_t                 fUnzipNext{0};    ///<! Next position in fUnzipOrder to be handed to an unzip task
+   std::atomic<Long64_t> fUnzipHeld{0};    ///<! Bytes of unzipped blocks not yet picked up by the reader
+   std::atomic<Long64_t> fUnzipInFlight{0}; ///<! Compressed bytes of the blocks handed to unzip tasks and not done yet
 
    // Unzipping related members
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
    Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of a group of baskets ready to be unzipped by a IMT task
-   Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready unzipped blocks (default is 2*fBufferSize)
+   Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready and in-flight unzipped blocks (default is fgRelBuffSize*fBufferSize)
 
    static Double_t fgRelBuffSize; ///< This is the percentage of the TTreeCacheUnzip that will be used
 
@@ -114,6 +119,10 @@ private:
 
    // Private methods
    void  Init();
+#ifdef R__USE_IMT
+   void  ScheduleUnzipTasks();
+   void  WaitUnzipTasks();
+#endif
 
 public:
    TTreeCacheUnzip();
@@ -87,6 +87,8 @@ class TTreeCloner {
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
+   Bool_t NeedRecompression(TBranch *from, TBranch *to) const;
+   void WriteBasketsRecompressed();
 
 private:
    TTreeCloner(const TTreeCloner&) = delete;
@@ -99,7 +101,8 @@ public:
       kNone       = 0,
       kNoWarnings = BIT(1),
       kIgnoreMissingTopLevel = BIT(2),
-      kNoFileCache = BIT(3)
+      kNoFileCache = BIT(3),
+      kRecompress = BIT(4)   ///< Recompress the baskets of the branches whose input and output compression differ
    };
 
    TTreeCloner(TTree *from, TTree *to, Option_t *method, UInt_t options = kNone);
@@ -39,6 +39,8 @@ public:
    virtual Long64_t       GetEntryNumberFriend(const TTree * /*parent*/) = 0;
    virtual Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const = 0;
    virtual Long64_t       GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const = 0;
+   virtual void           GetEntryNumbersWithIndex(Long64_t n, const Long64_t *major, const Long64_t *minor,
+                                                   Long64_t *entries) const;
    virtual const char    *GetMajorName()    const = 0;
    virtual const char    *GetMinorName()    const = 0;
    virtual Bool_t         IsValidFor(const TTree *parent) = 0;
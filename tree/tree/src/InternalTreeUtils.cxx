@@ -7,13 +7,21 @@
  *************************************************************************/
 
 #include "ROOT/InternalTreeUtils.hxx"
+#include "RConfigure.h" // R__USE_IMT
 #include "TBranch.h" // Usage of TBranch in ClearMustCleanupBits
 #include "TChain.h"
 #include "TCollection.h" // TRangeStaticCast
 #include "TFile.h"
 #include "TFriendElement.h"
+#include "TROOT.h" // ROOT::IsImplicitMTEnabled
 #include "TTree.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm> // std::min
 #include <utility> // std::pair
 #include <vector>
 #include <stdexcept> // std::runtime_error
@@ -296,6 +304,93 @@ void ClearMustCleanupBits(TObjArray &branches)
    }
 }
 
+namespace {
+
+/// Number of asynchronous open requests that GetTreeMetadata() keeps in flight if it cannot use a thread pool
+constexpr std::size_t kAsyncOpenWindow = 16;
+
+ROOT::Internal::TreeUtils::RTreeMetadata
+ReadTreeMetadata(TFile *f, const std::string &fileName, const std::string &treeName, bool withClusters)
+{
+   ROOT::Internal::TreeUtils::RTreeMetadata metadata;
+   if (!f || f->IsZombie()) {
+      metadata.fError = "an error occurred while opening file \"" + fileName + "\"";
+      return metadata;
+   }
+   auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
+   if (!t) {
+      metadata.fError = "an error occurred while getting tree \"" + treeName + "\" from file \"" + fileName + "\"";
+      return metadata;
+   }
+
+   // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
+   t->ResetBit(kMustCleanup);
+   ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
+   metadata.fEntries = t->GetEntries();
+   if (withClusters) {
+      auto clusterIter = t->GetClusterIterator(0);
+      Long64_t clusterStart = 0ll;
+      while ((clusterStart = clusterIter()) < metadata.fEntries)
+         metadata.fClusters.emplace_back(clusterStart, clusterIter.GetNextEntry());
+   }
+   return metadata;
+}
+
+} // anonymous namespace
+
+/// \brief Open a file and read the number of entries and, optionally, the cluster boundaries of a tree in it.
+///
+/// The file is opened without global registration and closed before returning. Failures are reported
+/// through RTreeMetadata::fError.
+RTreeMetadata GetTreeMetadata(const std::string &fileName, const std::string &treeName, bool withClusters)
+{
+   TDirectory::TContext ctxt;
+   // need TFile::Open to load plugins if need be
+   std::unique_ptr<TFile> f(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+   return ReadTreeMetadata(f.get(), fileName, treeName, withClusters);
+}
+
+/// \brief Read the number of entries and, optionally, the cluster boundaries of many trees, overlapping the
+/// round trips to the files.
+///
+/// If implicit multi-threading is enabled, the files are opened and read concurrently by the tasks of a
+/// TThreadExecutor. Otherwise, the files are read one after the other, but with up to 16 asynchronous open
+/// requests (TFile::AsyncOpen()) in flight, so that the connection setup of remote files overlaps. In both cases,
+/// StreamerInfo records already read from another file are recognized by their checksum and not parsed again,
+/// and remote protocols such as XRootD reuse the connection to a server across its files.
+///
+/// The result has one entry per file, in the order of fileNames.
+std::vector<RTreeMetadata> GetTreeMetadata(const std::vector<std::string> &fileNames,
+                                           const std::vector<std::string> &treeNames, bool withClusters)
+{
+   R__ASSERT(fileNames.size() == treeNames.size());
+   const auto nFiles = fileNames.size();
+   std::vector<RTreeMetadata> result(nFiles);
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nFiles > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](std::size_t i) { result[i] = GetTreeMetadata(fileNames[i], treeNames[i], withClusters); },
+                   ROOT::TSeq<std::size_t>(nFiles));
+      return result;
+   }
+#endif
+
+   std::vector<TFileOpenHandle *> handles(nFiles, nullptr);
+   std::size_t nSubmitted = 0;
+   for (std::size_t i = 0; i < nFiles; ++i) {
+      TDirectory::TContext ctxt;
+      for (; nSubmitted < std::min(nFiles, i + kAsyncOpenWindow); ++nSubmitted)
+         handles[nSubmitted] = TFile::AsyncOpen(fileNames[nSubmitted].c_str(), "READ_WITHOUT_GLOBALREGISTRATION");
+      // The file adopts the handle; only a failed open leaves it to us
+      std::unique_ptr<TFile> f(handles[i] ? TFile::Open(handles[i]) : nullptr);
+      if (!f)
+         delete handles[i];
+      result[i] = ReadTreeMetadata(f.get(), fileNames[i], treeNames[i], withClusters);
+   }
+   return result;
+}
+
 /// \brief Create a TChain object with options that avoid common causes of thread contention.
 ///
 /// In particular, set its kWithoutGlobalRegistration mode and reset its kMustCleanup bit.
@@ -23,10 +23,12 @@
 #include "TVirtualMutex.h"
 #include "TVirtualPerfStats.h"
 #include "TTimeStamp.h"
+#include "ROOT/RBufferPool.hxx"
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
 
 #include <bitset>
+#include <vector>
 
 const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest bytes of
                                               // the fEntryOffset are used to stored displacement.
@@ -66,7 +68,7 @@ TBasket::TBasket(const char *name, const char *title, TBranch *branch)
    SetTitle(title);
    fClassName   = "TBasket";
    fBuffer = nullptr;
-   fBufferRef   = new TBufferFile(TBuffer::kWrite, fBufferSize);
+   fBufferRef   = ROOT::Internal::RBufferPool::AcquireBuffer(TBuffer::kWrite, fBufferSize);
    fVersion    += 1000;
    if (branch->GetDirectory()) {
       TFile *file = branch->GetFile();
@@ -80,7 +82,7 @@ TBasket::TBasket(const char *name, const char *title, TBranch *branch)
 #endif
       fOwnsCompressedBuffer = kFALSE;
       if (!fCompressedBufferRef) {
-         fCompressedBufferRef = new TBufferFile(TBuffer::kRead, fBufferSize);
+         fCompressedBufferRef = ROOT::Internal::RBufferPool::AcquireBuffer(TBuffer::kRead, fBufferSize);
          fOwnsCompressedBuffer = kTRUE;
       }
    }
@@ -96,6 +98,7 @@ TBasket::TBasket(const char *name, const char *title, TBranch *branch)
       for (Int_t i=0;i<fNevBufSize;i++) fEntryOffset[i] = 0;
    }
    branch->GetTree()->IncrementTotalBuffers(fBufferSize);
+   AccountBuffers();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -105,13 +108,13 @@ TBasket::~TBasket()
 {
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
-   if (fBufferRef) delete fBufferRef;
+   ROOT::Internal::RBufferPool::ReleaseBuffer(fBufferRef);
    fBufferRef = 0;
    fBuffer = 0;
    fDisplacement= 0;
    // Note we only delete the compressed buffer if we own it
    if (fCompressedBufferRef && fOwnsCompressedBuffer) {
-      delete fCompressedBufferRef;
+      ROOT::Internal::RBufferPool::ReleaseBuffer(fCompressedBufferRef);
       fCompressedBufferRef = 0;
    }
    // TKey::~TKey will use fMotherDir to attempt to remove they key
@@ -138,6 +141,21 @@ void TBasket::AdjustSize(Int_t newsize)
    fLastWriteBufferSize[1] = 0;
    fLastWriteBufferSize[2] = 0;
    fNextBufferSizeRecord = 1;
+   AccountBuffers();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Report the size of the buffers owned by this basket to
+/// ROOT::Experimental::MemoryAccounting.
+
+void TBasket::AccountBuffers()
+{
+   std::size_t size = 0;
+   if (fBufferRef && fBufferRef->TestBit(TBuffer::kIsOwner))
+      size += fBufferRef->BufferSize();
+   if (fCompressedBufferRef && fOwnsCompressedBuffer && fCompressedBufferRef->TestBit(TBuffer::kIsOwner))
+      size += fCompressedBufferRef->BufferSize();
+   fAccountedBuffers.Set(size);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -158,6 +176,86 @@ Long64_t TBasket::CopyTo(TFile *to)
    return nBytes>0 ? nBytes : -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Replace the payload of a basket loaded with LoadBasketBuffers by the same
+/// data compressed with the given level and algorithm, for CopyTo.
+///
+/// The payload is unzipped and zipped again without being unstreamed, only
+/// the buffers of this basket are used so that several baskets can be
+/// recompressed at the same time in different threads.
+/// Returns 0 on success and 1 if the basket could not be recompressed, in
+/// which case it is left unchanged.
+
+Int_t TBasket::Recompress(Int_t cxlevel, Int_t cxAlgorithm)
+{
+   if (!fBufferRef || fObjlen <= 0 || fNbytes <= fKeylen || TestBit(TBufferFile::kNotDecompressed))
+      return 1;
+
+   char *buffer = fBufferRef->Buffer();
+   std::vector<char> unzipped;
+   const char *objbuf = buffer + fKeylen;
+   if (fObjlen > fNbytes - fKeylen) {
+      unzipped.resize(fObjlen);
+      UChar_t *src = (UChar_t *)buffer + fKeylen;
+      UChar_t *tgt = (UChar_t *)unzipped.data();
+      Int_t nin, nbuf, nout = 0, noutot = 0;
+      while (noutot < fObjlen) {
+         if (R__unzip_header(&nin, src, &nbuf) != 0 || nbuf > fObjlen - noutot)
+            return 1;
+         R__unzip(&nin, src, &nbuf, tgt + noutot, &nout);
+         if (!nout)
+            break;
+         noutot += nout;
+         src += nin;
+      }
+      if (noutot != fObjlen)
+         return 1;
+      objbuf = unzipped.data();
+   } else if (fObjlen != fNbytes - fKeylen) {
+      return 1;
+   }
+
+   Int_t noutot = fObjlen;
+   std::vector<char> zipped;
+   if (cxlevel > 0) {
+      Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
+      zipped.resize(fObjlen + 9 * nbuffers + 28);
+      char *bufcur = zipped.data();
+      Int_t nzip = 0;
+      noutot = 0;
+      for (Int_t i = 0; i < nbuffers; ++i) {
+         Int_t bufmax = (i == nbuffers - 1) ? fObjlen - nzip : kMAXZIPBUF;
+         Int_t nout = 0;
+         R__zipMultipleAlgorithm(cxlevel, &bufmax, const_cast<char *>(objbuf) + nzip, &bufmax, bufcur, &nout,
+                                 static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(cxAlgorithm));
+         // As in WriteBuffer, a basket that does not shrink is stored uncompressed.
+         if (nout == 0 || nout >= fObjlen) {
+            noutot = fObjlen;
+            zipped.clear();
+            break;
+         }
+         bufcur += nout;
+         noutot += nout;
+         nzip += kMAXZIPBUF;
+      }
+   }
+   const char *payload = zipped.empty() ? objbuf : zipped.data();
+
+   if (payload != buffer + fKeylen) {
+      Bool_t reading = fBufferRef->IsReading();
+      fBufferRef->SetWriteMode();
+      if (fBufferRef->BufferSize() < fKeylen + noutot) {
+         fBufferRef->Expand(fKeylen + noutot);
+         AccountBuffers();
+      }
+      if (reading)
+         fBufferRef->SetReadMode();
+      memcpy(fBufferRef->Buffer() + fKeylen, payload, noutot);
+   }
+   fNbytes = fKeylen + noutot;
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///  Delete fEntryOffset array.
 
@@ -176,13 +274,15 @@ Int_t TBasket::DropBuffers()
 
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
-   if (fBufferRef)    delete fBufferRef;
-   if (fCompressedBufferRef && fOwnsCompressedBuffer) delete fCompressedBufferRef;
+   ROOT::Internal::RBufferPool::ReleaseBuffer(fBufferRef);
+   if (fCompressedBufferRef && fOwnsCompressedBuffer)
+      ROOT::Internal::RBufferPool::ReleaseBuffer(fCompressedBufferRef);
    fBufferRef   = 0;
    fCompressedBufferRef = 0;
    fBuffer      = 0;
    fDisplacement= 0;
    fEntryOffset = 0;
+   fAccountedBuffers.Set(0);
    fBranch->GetTree()->IncrementTotalBuffers(-fBufferSize);
    return fBufferSize;
 }
@@ -256,9 +356,10 @@ Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tr
       }
       fBufferRef->SetReadMode();
    } else {
-      fBufferRef = new TBufferFile(TBuffer::kRead, len);
+      fBufferRef = ROOT::Internal::RBufferPool::AcquireBuffer(TBuffer::kRead, len);
    }
    fBufferRef->SetParent(file);
+   AccountBuffers();
    char *buffer = fBufferRef->Buffer();
    file->Seek(pos);
    TFileCacheRead *pf = tree->GetReadCache(file);
@@ -387,6 +488,7 @@ Int_t TBasket::ReadBasketBuffersUnzip(char* buffer, Int_t size, Bool_t mustFree,
       fBufferRef = new TBufferFile(TBuffer::kRead, size, buffer, mustFree);
    }
    fBufferRef->SetParent(file);
+   AccountBuffers();
 
    Streamer(*fBufferRef);
 
@@ -420,7 +522,7 @@ static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t l
       bufferRef->Reset();
       result = bufferRef;
    } else {
-      result = new TBufferFile(TBuffer::kRead, len);
+      result = ROOT::Internal::RBufferPool::AcquireBuffer(TBuffer::kRead, len);
    }
    result->SetParent(file);
    return result;
@@ -436,6 +538,7 @@ void inline TBasket::InitializeCompressedBuffer(Int_t len, TFile* file)
    if (R__unlikely(!compressedBufferExists)) {
       fOwnsCompressedBuffer = kTRUE;
    }
+   AccountBuffers();
 }
 
 void TBasket::ResetEntryOffset()
@@ -470,6 +573,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    Bool_t oldCase;
    char *rawUncompressedBuffer, *rawCompressedBuffer;
    Int_t uncompressedBufferLen;
+   const char *mappedBuffer = nullptr;
 
    // See if the cache has already unzipped the buffer for us.
    TFileCacheRead *pf = nullptr;
@@ -491,10 +595,22 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       }
    }
 
+   // If the file is memory-mapped (see TFile::EnableMemoryMap()) and there is no read cache,
+   // the basket header is unstreamed and the payload decompressed straight from the mapping.
+   if (!pf) {
+      TVirtualPerfStats* temp = gPerfStats;
+      if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
+      R__LOCKGUARD_IMT(gROOTMutex); // Lock for parallel TTree I/O
+      mappedBuffer = file->GetMemoryMappedBuffer(pos, len);
+      gPerfStats = temp;
+   }
+
    // Determine which buffer to use, so that we can avoid a memcpy in case of
    // the basket was not compressed.
    TBuffer* readBufferRef;
-   if (R__unlikely(fBranch->GetCompressionLevel()==0)) {
+   if (mappedBuffer) {
+      readBufferRef = nullptr;
+   } else if (R__unlikely(fBranch->GetCompressionLevel()==0)) {
       // Initialize the buffer to hold the uncompressed data.
       fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, len, file);
       readBufferRef = fBufferRef;
@@ -503,17 +619,27 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file);
       readBufferRef = fCompressedBufferRef;
    }
+   AccountBuffers();
 
    // fBufferSize is likely to be change in the Streamer call (below)
    // and we will re-add the new size later on.
    fBranch->GetTree()->IncrementTotalBuffers(-fBufferSize);
 
-   if (!readBufferRef) {
+   if (!readBufferRef && !mappedBuffer) {
       Error("ReadBasketBuffers", "Unable to allocate buffer.");
       return 1;
    }
 
-   if (pf) {
+   if (mappedBuffer) {
+      // The TBufferFile does not own the mapped memory and is only used to unstream the header
+      TBufferFile mappedBufferRef(TBuffer::kRead, len, const_cast<char *>(mappedBuffer), kFALSE);
+      mappedBufferRef.SetParent(file);
+      Streamer(mappedBufferRef);
+      if (IsZombie()) {
+         return 1;
+      }
+      rawCompressedBuffer = const_cast<char *>(mappedBuffer);
+   } else if (pf) {
       TVirtualPerfStats* temp = gPerfStats;
       if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
       Int_t st = 0;
@@ -550,15 +676,17 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       }
       else gPerfStats = temp;
    }
-   Streamer(*readBufferRef);
-   if (IsZombie()) {
-      return 1;
-   }
+   if (!mappedBuffer) {
+      Streamer(*readBufferRef);
+      if (IsZombie()) {
+         return 1;
+      }
 
-   rawCompressedBuffer = readBufferRef->Buffer();
+      rawCompressedBuffer = readBufferRef->Buffer();
+   }
 
    // Are we done?
-   if (R__unlikely(readBufferRef == fBufferRef)) // We expect most basket to be compressed.
+   if (R__unlikely(!mappedBuffer && readBufferRef == fBufferRef)) // We expect most basket to be compressed.
    {
       if (R__likely(fObjlen+fKeylen == fNbytes)) {
          // The basket was really not compressed as expected.
@@ -583,6 +711,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    // to the TBranch.
    uncompressedBufferLen = len > fObjlen+fKeylen ? len : fObjlen+fKeylen;
    fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, uncompressedBufferLen, file);
+   AccountBuffers();
    rawUncompressedBuffer = fBufferRef->Buffer();
    fBuffer = rawUncompressedBuffer;
 
@@ -638,6 +767,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
       if (R__unlikely(gPerfStats)) {
          gPerfStats->UnzipEvent(fBranch->GetTree(),pos,start,nintot,fObjlen);
+         gPerfStats->BranchUnzipEvent(fBranch,start,nintot,fObjlen);
       }
       gPerfStats = temp;
    } else {
@@ -713,6 +843,7 @@ Int_t TBasket::ReadBasketBytes(Long64_t pos, TFile *file)
 void TBasket::DisownBuffer()
 {
    fBufferRef = NULL;
+   AccountBuffers();
 }
 
 
@@ -720,8 +851,9 @@ void TBasket::DisownBuffer()
 /// Adopt a buffer from an external entity
 void TBasket::AdoptBuffer(TBuffer *user_buffer)
 {
-   delete fBufferRef;
+   ROOT::Internal::RBufferPool::ReleaseBuffer(fBufferRef);
    fBufferRef = user_buffer;
+   AccountBuffers();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -789,6 +921,7 @@ void TBasket::ReadResetBuffer(Int_t basketnumber)
          start = std::chrono::high_resolution_clock::now();
 #endif
          fBufferRef->Expand(newSize, kFALSE); // Expand without copying the existing data.
+         AccountBuffers();
 #ifdef R__TRACK_BASKET_ALLOC_TIME
          end = std::chrono::high_resolution_clock::now();
          auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
@@ -870,6 +1003,7 @@ void TBasket::WriteReset()
       start = std::chrono::high_resolution_clock::now();
 #endif
       fBufferRef->Expand(newSize,kFALSE);     // Expand without copying the existing data.
+      AccountBuffers();
 #ifdef R__TRACK_BASKET_ALLOC_TIME
       end = std::chrono::high_resolution_clock::now();
       auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
@@ -1015,8 +1149,9 @@ void TBasket::Streamer(TBuffer &b)
          fEntryOffset = reinterpret_cast<Int_t *>(-1);
       }
       if (flag == 1 || flag > 10) {
-         fBufferRef = new TBufferFile(TBuffer::kRead,fBufferSize);
+         fBufferRef = ROOT::Internal::RBufferPool::AcquireBuffer(TBuffer::kRead, fBufferSize);
          fBufferRef->SetParent(b.GetParent());
+         AccountBuffers();
          char *buf  = fBufferRef->Buffer();
          if (v > 1) b.ReadFastArray(buf,fLast);
          else       b.ReadArray(buf);
@@ -1121,6 +1256,23 @@ void TBasket::Update(Int_t offset, Int_t skipped)
    fNevBuf++;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare this basket to be written by WriteBuffer() in a separate task, while
+/// its branch already continues to be filled into another basket (pipelined
+/// TTree::Fill()).
+///
+/// The key cycle is fixed to `cycle`, the basket number of this basket in its
+/// branch, and the basket stops sharing the compression buffer of its branch.
+
+void TBasket::PrepareAsyncWrite(Int_t cycle)
+{
+   fWriteCycle = cycle;
+   if (!fOwnsCompressedBuffer) {
+      // A private compression buffer is allocated by the next WriteBuffer()
+      fCompressedBufferRef = nullptr;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write buffer of this basket on the current file.
 ///
@@ -1138,6 +1290,7 @@ Int_t TBasket::WriteBuffer()
       return -1;
    }
    fMotherDir = file; // fBranch->GetDirectory();
+   AccountBuffers(); // the buffer grew while filling
 
    // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
    // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
@@ -1209,7 +1362,8 @@ Int_t TBasket::WriteBuffer()
    fObjlen = fBufferRef->Length() - fKeylen;
 
    fHeaderOnly = kTRUE;
-   fCycle = fBranch->GetWriteBasket();
+   fCycle = (fWriteCycle >= 0) ? fWriteCycle : fBranch->GetWriteBasket();
+   fWriteCycle = -1;
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
@@ -1228,6 +1382,10 @@ Int_t TBasket::WriteBuffer()
       fBuffer = fCompressedBufferRef->Buffer();
       char *objbuf = fBufferRef->Buffer() + fKeylen;
       char *bufcur = &fBuffer[fKeylen];
+      // With kZSTDDict the first baskets train the branch dictionary, used from then on.
+      UInt_t dictID = 0;
+      if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTDDict)
+         dictID = fBranch->PrepareCompressionDictionary(objbuf, fObjlen);
       noutot = 0;
       nzip   = 0;
       for (Int_t i = 0; i < nbuffers; ++i) {
@@ -1242,7 +1400,10 @@ Int_t TBasket::WriteBuffer()
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
          // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+         if (dictID)
+            R__zipWithDictionary(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, dictID);
+         else
+            R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
 #ifdef R__USE_IMT
          sentry.lock();
 #endif  // R__USE_IMT
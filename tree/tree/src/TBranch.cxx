@@ -52,7 +52,9 @@
 #include "TBranchIMTHelper.h"
 
 #include "ROOT/TIOFeatures.hxx"
+#include "RZip.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
@@ -449,6 +451,12 @@ void TBranch::Init(const char* name, const char* leaflist, Int_t compress)
 
 TBranch::~TBranch()
 {
+   FinishPipelinedBasket();
+   delete fPipelineHelper;
+   fPipelineHelper = nullptr;
+   delete fPipelinedSpare;
+   fPipelinedSpare = nullptr;
+
    delete fBrowsables;
    fBrowsables = 0;
 
@@ -754,6 +762,8 @@ void TBranch::DeleteBaskets(Option_t* option)
 
 void TBranch::DropBaskets(Option_t* options)
 {
+   FinishPipelinedBasket();
+
    Bool_t all = kFALSE;
    if (options && options[0]) {
       TString opt = options;
@@ -1136,6 +1146,9 @@ Int_t TBranch::FlushBaskets()
    UInt_t nerror = 0;
    Int_t nbytes = 0;
 
+   if (FinishPipelinedBasket() < 0)
+      ++nerror;
+
    Int_t maxbasket = fWriteBasket + 1;
    // The following protection is not necessary since we should always
    // have fWriteBasket < fBasket.GetSize()
@@ -1229,6 +1242,9 @@ TBasket* TBranch::GetBasketImpl(Int_t basketnumber, TBuffer *user_buffer)
    // different files processed simultaneously.
    static std::atomic<Int_t> nerrors(0);
 
+   // A basket read back while the tree is filled might still be written by the pipelined TTree::Fill()
+   if (R__unlikely(fPipelinedBasket)) FinishPipelinedBasket();
+
       // reference to an existing basket in memory ?
    if (basketnumber <0 || basketnumber > fWriteBasket) return 0;
    TBasket *basket = (TBasket*)fBaskets.UncheckedAt(basketnumber);
@@ -1431,6 +1447,14 @@ Bool_t TBranch::SupportsBulkRead() const {
           (static_cast<TLeaf*>(fLeaves.UncheckedAt(0))->GetDeserializeType() != TLeaf::DeserializeType::kExternal);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch supports bulk IO of variable-size entries,
+/// see GetBulkEntriesJagged().
+
+Bool_t TBranch::SupportsBulkReadJagged() const {
+   return (fNleaves == 1) && static_cast<TLeaf*>(fLeaves.UncheckedAt(0))->SupportsBulkReadJagged();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read as many events as possible into the given buffer, using zero-copy
 /// mechanisms.
@@ -1528,6 +1552,103 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
    return N;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the entries of a basket of a branch with variable-size entries
+/// (e.g. `float[n]` or `std::vector<float>`) into the given buffer, using
+/// zero-copy mechanisms where possible.
+///
+/// Returns -1 in case of a failure.  On success, returns the (non-zero) number
+/// N of entries read.  The values of all N entries are then stored contiguously
+/// and in host byte order, starting at user_buf.GetCurrent(); offsets holds
+/// N+1 elements and the values of entry `entry + i` are the elements
+/// [offsets[i], offsets[i+1]) of
+///
+/// static_cast<T*>(user_buf.GetCurrent())
+///
+/// As for GetBulkEntries(), entry must be the first entry of a basket; the
+/// basket must have been written to the file.
+
+Int_t TBranch::GetBulkEntriesJagged(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   // TODO: eventually support multiple leaves.
+   if (R__unlikely(fNleaves != 1)) return -1;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   if (R__unlikely(!leaf->SupportsBulkReadJagged())) {
+      return -1;
+   }
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   Bool_t enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) return -1;
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result < 0)) return -1;
+   // Only support reading from full baskets that are stored in the file: the bounds of
+   // the last entry of a basket still being filled are not known yet.
+   if (R__unlikely(entry != first || !fBasketSeek[result])) {
+      return -1;
+   }
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetBulkEntriesJagged", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetBulkEntriesJagged", "Basket has displacement.\n");
+      return -1;
+   }
+
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+   Int_t *entryOffset = basket->GetEntryOffset();
+   if (R__unlikely(N <= 0 || !entryOffset)) {
+      Error("GetBulkEntriesJagged", "Basket has no entry offsets.\n");
+      return -1;
+   }
+   // The basket might be reused below, keep its entry boundaries.
+   std::vector<Int_t> entryStart(entryOffset, entryOffset + N);
+   const Int_t last = basket->GetLast();
+
+   if (&user_buf != buf) {
+      // The basket was already in memory and might (and might not) be backed by persistent
+      // storage.
+      R__ASSERT(result == fReadBasket);
+      if (fBasketSeek[fReadBasket]) {
+         // It is backed, so we can be destructive
+         user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
+         buf->ResetBit(TBufferIO::kIsOwner);
+         fCurrentBasket = nullptr;
+         fBaskets[fReadBasket] = nullptr;
+      } else {
+         // This is the only copy, we can't return it as is to the user, just make a copy.
+         if (user_buf.BufferSize() < buf->BufferSize()) {
+            user_buf.AutoExpand(buf->BufferSize());
+         }
+         memcpy(user_buf.Buffer(), buf->Buffer(), buf->BufferSize());
+      }
+   }
+
+   if (R__unlikely(!leaf->ReadBasketJagged(user_buf, N, entryStart.data(), last, offsets))) {
+      Error("GetBulkEntriesJagged", "Leaf failed to read.\n");
+      return -1;
+   }
+
+   if (fCurrentBasket == nullptr) {
+      R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+      fExtraBasket = basket;
+      basket->DisownBuffer();
+   }
+
+   return N;
+}
+
 // TODO: Template this and the call above; only difference is the TLeaf function (ReadBasketFast vs
 // ReadBasketSerialized
 Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *count_buf)
@@ -2195,6 +2316,25 @@ ROOT::TIOFeatures TBranch::GetIOFeatures() const
    return fIOFeatures;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if reading entry does not need to load a new basket, neither
+/// for this branch nor for any of its active sub-branches.
+
+Bool_t TBranch::IsEntryInCurrentBaskets(Long64_t entry) const
+{
+   const Int_t nbranches = fBranches.GetEntriesFast();
+   if (nbranches) {
+      for (Int_t i = 0; i < nbranches; ++i) {
+         if (!static_cast<TBranch *>(fBranches.UncheckedAt(i))->IsEntryInCurrentBaskets(entry))
+            return kFALSE;
+      }
+      return kTRUE;
+   }
+   if (TestBit(kDoNotProcess))
+      return kTRUE;
+   return fCurrentBasket && fFirstBasketEntry <= entry && entry < fNextBasketEntry;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return kTRUE if an existing object in a TBranchObject must be deleted.
 
@@ -2494,6 +2634,8 @@ void TBranch::Refresh(TBranch* b)
 
 void TBranch::Reset(Option_t*)
 {
+   FinishPipelinedBasket();
+
    fReadBasket = 0;
    fReadEntry = -1;
    fFirstBasketEntry = -1;
@@ -2535,6 +2677,8 @@ void TBranch::Reset(Option_t*)
 
 void TBranch::ResetAfterMerge(TFileMergeInfo *)
 {
+   FinishPipelinedBasket();
+
    fReadBasket       = 0;
    fReadEntry        = -1;
    fFirstBasketEntry = -1;
@@ -2751,6 +2895,59 @@ void TBranch::SetCompressionSettings(Int_t settings)
    }
 }
 
+namespace {
+
+/// The dictionary is trained once this many baskets were sampled...
+constexpr std::size_t kDictTrainingBaskets = 32;
+/// ... or once this many bytes were sampled, whichever comes first.
+constexpr std::size_t kDictTrainingBytes = 1024 * 1024;
+/// At most this many bytes are sampled from the beginning of each basket.
+constexpr Int_t kDictMaxSampleSize = 64 * 1024;
+/// Maximum size of a trained dictionary.
+constexpr std::size_t kDictMaxSize = 16 * 1024;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the identifier of the ZSTD dictionary to compress the basket content
+/// `buf` of `len` bytes with, or 0 to compress it without dictionary.
+///
+/// Used by TBasket::WriteBuffer for the kZSTDDict compression algorithm: the
+/// content of the first baskets is kept as training samples; once enough was
+/// collected a dictionary is trained and is then used for all the following
+/// baskets. The dictionary is stored once, with the branch meta data, and
+/// registered again when the branch is read back.
+
+UInt_t TBranch::PrepareCompressionDictionary(const char *buf, Int_t len)
+{
+   if (fCompressionDictDone)
+      return fCompressionDictID;
+
+   const Int_t nsample = std::min(len, kDictMaxSampleSize);
+   fDictSamples.insert(fDictSamples.end(), buf, buf + nsample);
+   fDictSampleSizes.push_back(nsample);
+   if (fDictSampleSizes.size() < kDictTrainingBaskets && fDictSamples.size() < kDictTrainingBytes)
+      return 0;
+
+   // zstd recommends about a hundred times more samples than the dictionary size; it still helps with less.
+   std::vector<char> dict(std::max<std::size_t>(std::min(kDictMaxSize, fDictSamples.size() / 8), 256));
+   std::size_t dictSize = dict.size();
+   UInt_t id = R__zipTrainDictionary(dict.data(), &dictSize, fDictSamples.data(), fDictSampleSizes.data(),
+                                     fDictSampleSizes.size());
+   if (id) {
+      dict.resize(dictSize);
+      fCompressionDict = std::move(dict);
+      fCompressionDictID = R__zipRegisterDictionary(fCompressionDict.data(), fCompressionDict.size());
+   } else if (gDebug > 0) {
+      Info("PrepareCompressionDictionary", "Could not train a compression dictionary for %s, using plain ZSTD.",
+           GetName());
+   }
+   fCompressionDictDone = kTRUE;
+   std::vector<char>().swap(fDictSamples);
+   std::vector<size_t>().swap(fDictSampleSizes);
+   return fCompressionDictID;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Update the default value for the branch's fEntryOffsetLen if and only if
 /// it was already non zero (and the new value is not zero)
@@ -2909,6 +3106,12 @@ void TBranch::Streamer(TBuffer& b)
       if (v > 9) {
          b.ReadClassBuffer(TBranch::Class(), this, v, R__s, R__c);
 
+         if (!fCompressionDict.empty()) {
+            // Baskets written after the training need the dictionary to be unzipped.
+            fCompressionDictID = R__zipRegisterDictionary(fCompressionDict.data(), fCompressionDict.size());
+            fCompressionDictDone = kTRUE;
+         }
+
          if (fWriteBasket>=fBaskets.GetSize()) {
             fBaskets.Expand(fWriteBasket+1);
          }
@@ -3105,6 +3308,9 @@ void TBranch::Streamer(TBuffer& b)
          }
       }
    } else {
+      // The on-file location of a basket still written by the pipelined TTree::Fill() is needed below
+      FinishPipelinedBasket();
+
       Int_t maxBaskets = fMaxBaskets;
       fMaxBaskets = fWriteBasket+1;
       Int_t lastBasket = fMaxBaskets;
@@ -3203,7 +3409,42 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       }
       return nout;
    };
-   if (imtHelper) {
+   if (imtHelper && fTree->GetImplicitMTPipelinedFill() && where == fWriteBasket &&
+       !basket->GetBufferRef()->TestBit(TBufferFile::kNotDecompressed)) {
+      // Pipelined fill: the full basket is written by a task, while the branch immediately continues with the
+      // next write basket.  The task only writes the basket; the branch bookkeeping of the written basket is done
+      // by FinishPipelinedBasket() on the filling thread.  We keep at most one basket of this branch in flight.
+      FinishPipelinedBasket();
+      fBaskets[where] = 0;
+      ++fWriteBasket;
+      if (fWriteBasket >= fMaxBaskets) {
+         ExpandBasketArrays();
+      }
+      if (basket == fCurrentBasket) {
+         fCurrentBasket    = 0;
+         fFirstBasketEntry = -1;
+         fNextBasketEntry  = -1;
+      }
+      if (fPipelinedSpare) {
+         fBaskets.AddAtAndExpand(fPipelinedSpare, fWriteBasket);
+         fPipelinedSpare = nullptr;
+      } else {
+         // No basket in memory for fWriteBasket: the next FillImpl() creates one
+         --fNBaskets;
+      }
+      fBasketEntry[fWriteBasket] = fEntryNumber;
+
+      basket->PrepareAsyncWrite(where);
+      fPipelinedBasket = basket;
+      fPipelinedWhere = where;
+      if (!fPipelineHelper)
+         fPipelineHelper = new ROOT::Internal::TBranchIMTHelper();
+      fPipelineHelper->Run([this, basket]() {
+         fPipelinedNout = basket->WriteBuffer();
+         return fPipelinedNout;
+      });
+      return 0;
+   } else if (imtHelper) {
       imtHelper->Run(doUpdates);
       return 0;
    } else {
@@ -3211,6 +3452,52 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the basket handed off by the pipelined TTree::Fill(), if any, and
+/// update the branch with the result of the write.  The written basket is kept
+/// for reuse as a later write basket of this branch.
+///
+/// Returns the number of bytes written, 0 if there was no basket in flight
+/// and -1 in case of a write error.
+
+Int_t TBranch::FinishPipelinedBasket()
+{
+   if (!fPipelinedBasket)
+      return 0;
+   fPipelineHelper->Wait();
+
+   TBasket *basket = fPipelinedBasket;
+   const Int_t where = fPipelinedWhere;
+   const Int_t nout = fPipelinedNout;
+   fPipelinedBasket = nullptr;
+   fPipelinedWhere = -1;
+
+   if (nout < 0)
+      Error("FinishPipelinedBasket", "basket's WriteBuffer failed.");
+   fBasketBytes[where] = basket->GetNbytes();
+   fBasketSeek[where]  = basket->GetSeekKey();
+   if (nout > 0) {
+      Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+      basket->WriteReset();
+      fZipBytes += nout;
+      fTotBytes += addbytes;
+      fTree->AddTotBytes(addbytes);
+      fTree->AddZipBytes(nout);
+#ifdef R__TRACK_BASKET_ALLOC_TIME
+      fTree->AddAllocationTime(basket->GetResetAllocationTime());
+#endif
+      fTree->AddAllocationCount(basket->GetResetAllocationCount());
+   }
+
+   if (nout > 0 && !fPipelinedSpare) {
+      fPipelinedSpare = basket;
+   } else {
+      basket->DropBuffers();
+      delete basket;
+   }
+   return nout;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///set the first entry number (case of TBranchSTL)
 
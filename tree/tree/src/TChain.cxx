@@ -25,6 +25,7 @@ the trees in the chain.
 */
 
 #include "TChain.h"
+#include "ROOT/InternalTreeUtils.hxx"
 
 #include <iostream>
 #include <cfloat>
@@ -965,11 +966,55 @@ Long64_t TChain::GetEntries() const
       return fProofChain->GetEntries();
    }
    if (fEntries == TTree::kMaxEntries) {
-      const_cast<TChain*>(this)->LoadTree(TTree::kMaxEntries-1);
+      const_cast<TChain*>(this)->PrefetchEntries();
+      if (fEntries == TTree::kMaxEntries)
+         const_cast<TChain*>(this)->LoadTree(TTree::kMaxEntries-1);
    }
    return fEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the number of entries of all the trees of the chain that are not known yet and
+/// update the offset table accordingly.
+///
+/// The files are opened concurrently, or at least with overlapping open requests, by
+/// ROOT::Internal::TreeUtils::GetTreeMetadata(), instead of one after the other by LoadTree().
+/// Trees that cannot be read keep an unknown number of entries, so that LoadTree() reports
+/// them as usual.
+
+void TChain::PrefetchEntries()
+{
+   std::vector<Int_t> treeNumbers;
+   std::vector<std::string> fileNames;
+   std::vector<std::string> treeNames;
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      auto element = static_cast<TChainElement *>(fFiles->UncheckedAt(i));
+      if (element->GetEntries() != TTree::kMaxEntries)
+         continue;
+      treeNumbers.push_back(i);
+      fileNames.emplace_back(element->GetTitle());
+      treeNames.emplace_back(element->GetName());
+   }
+   // A single file is read by LoadTree() just as fast
+   if (fileNames.size() < 2)
+      return;
+
+   const auto metadata = ROOT::Internal::TreeUtils::GetTreeMetadata(fileNames, treeNames);
+   for (std::size_t i = 0; i < treeNumbers.size(); ++i) {
+      if (metadata[i].fEntries >= 0)
+         static_cast<TChainElement *>(fFiles->UncheckedAt(treeNumbers[i]))->SetNumberEntries(metadata[i].fEntries);
+   }
+
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      const auto nentries = static_cast<TChainElement *>(fFiles->UncheckedAt(i))->GetEntries();
+      if (nentries == TTree::kMaxEntries || fTreeOffset[i] == TTree::kMaxEntries)
+         fTreeOffset[i + 1] = TTree::kMaxEntries;
+      else
+         fTreeOffset[i + 1] = fTreeOffset[i] + nentries;
+   }
+   fEntries = fTreeOffset[fNtrees];
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get entry from the file to memory.
 ///
@@ -865,6 +865,13 @@ Long64_t TEntryList::GetEntryAndTree(Long64_t index, Int_t &treenum)
 
 void TEntryList::GetFileName(const char *filename, TString &fn, Bool_t *local)
 {
+   // Parsing the url is costly compared to the lookups done by Contains() or
+   // Enter() with a tree: remember the last result
+   if (fLastUrl.Length() && fLastUrl == filename) {
+      fn = fLastUrlFile;
+      if (local) *local = fLastUrlLocal;
+      return;
+   }
    TUrl u(filename, kTRUE);
    if (local) *local = (!strcmp(u.GetProtocol(), "file")) ? kTRUE : kFALSE;
    if (strlen(u.GetAnchor()) > 0) {
@@ -872,6 +879,9 @@ void TEntryList::GetFileName(const char *filename, TString &fn, Bool_t *local)
    } else {
       fn = u.GetFile();
    }
+   fLastUrl = filename;
+   fLastUrlFile = fn;
+   fLastUrlLocal = !strcmp(u.GetProtocol(), "file");
    // Done
    return;
 }
@@ -1305,15 +1315,22 @@ void TEntryList::SetTree(const TTree *tree)
    TString filename;
    if (tree->GetTree()->GetCurrentFile()){
       filename = tree->GetTree()->GetCurrentFile()->GetName();
-      TUrl url(filename.Data(), kTRUE);
-      if (!strcmp(url.GetProtocol(), "file")){
-         gSystem->ExpandPathName(filename);
-         if (!gSystem->IsAbsoluteFileName(filename))
-            gSystem->PrependPathName(gSystem->pwd(), filename);
-         filename = gSystem->UnixPathName(filename);
-         url.SetFile(filename);
+      if (fLastTreeFile.Length() && filename == fLastTreeFile) {
+         // same file as in the previous call, e.g. Contains() or Enter() in a loop
+         filename = fLastTreeFileUrl;
+      } else {
+         fLastTreeFile = filename;
+         TUrl url(filename.Data(), kTRUE);
+         if (!strcmp(url.GetProtocol(), "file")){
+            gSystem->ExpandPathName(filename);
+            if (!gSystem->IsAbsoluteFileName(filename))
+               gSystem->PrependPathName(gSystem->pwd(), filename);
+            filename = gSystem->UnixPathName(filename);
+            url.SetFile(filename);
+         }
+         filename = url.GetUrl();
+         fLastTreeFileUrl = filename;
       }
-      filename = url.GetUrl();
    } else {
       //memory-resident
       filename = "";
@@ -1335,13 +1352,17 @@ void TEntryList::Subtract(const TEntryList *elist)
          //second list is also only for 1 tree
          if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
              !strcmp(elist->fFileName.Data(),fFileName.Data())){
-            //same tree
-            Long64_t n2 = elist->GetN();
-            Long64_t entry;
-            for (Int_t i=0; i<n2; i++){
-               entry = (const_cast<TEntryList*>(elist))->GetEntry(i);
-               Remove(entry);
+            //same tree, subtract block by block
+            if (!elist->fBlocks) return;
+            Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
+            for (Int_t i=0; i<nmin; i++){
+               TEntryListBlock *block1 = (TEntryListBlock*)fBlocks->UncheckedAt(i);
+               TEntryListBlock *block2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(i);
+               Long64_t nold = block1->GetNPassed();
+               fN = fN - nold + block1->Subtract(block2);
             }
+            fLastIndexQueried = -1;
+            fLastIndexReturned = 0;
          } else {
             //different trees
             return;
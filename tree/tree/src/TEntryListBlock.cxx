@@ -46,6 +46,10 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+
 ClassImp(TEntryListBlock);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -206,14 +210,13 @@ Int_t TEntryListBlock::Contains(Int_t entry)
       Bool_t result = (fIndices[i] & (1<<j))!=0;
       return result;
    }
-   //list
+   //list, sorted: binary search from the last position found
    if (entry < fCurrent) fCurrent = 0;
    if (fPassing && fIndices){
-      for (Int_t i = fCurrent; i<fNPassed; i++){
-         if (fIndices[i]==entry){
-            fCurrent = i;
-            return kTRUE;
-         }
+      UShort_t *found = std::lower_bound(fIndices + fCurrent, fIndices + fNPassed, entry);
+      if (found != fIndices + fNPassed && *found == entry){
+         fCurrent = found - fIndices;
+         return kTRUE;
       }
    } else {
       if (!fIndices || fNPassed==0){
@@ -222,27 +225,51 @@ Int_t TEntryListBlock::Contains(Int_t entry)
       }
       if (entry > fIndices[fNPassed-1])
          return kTRUE;
-      for (Int_t i= fCurrent; i<fNPassed; i++){
-         if (fIndices[i]==entry){
-            fCurrent = i;
-            return kFALSE;
-         }
-         if (fIndices[i]>entry){
-            fCurrent = i;
-            return kTRUE;
-         }
+      UShort_t *found = std::lower_bound(fIndices + fCurrent, fIndices + fNPassed, entry);
+      if (found != fIndices + fNPassed){
+         fCurrent = found - fIndices;
+         return *found != entry;
       }
    }
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill bits, an array of kBlockSize words, with the bits representation of the
+/// entries of this block, whatever the representation of the block
+
+void TEntryListBlock::FillBits(UShort_t *bits) const
+{
+   if (fType == 0 && fIndices) {
+      memcpy(bits, fIndices, kBlockSize * sizeof(UShort_t));
+      return;
+   }
+   // a list of the entries that pass, or of the entries that do not pass
+   const UShort_t init = fPassing ? 0 : 0xFFFF;
+   std::fill(bits, bits + kBlockSize, init);
+   if (!fIndices)
+      return;
+   for (Int_t i = 0; i < fNPassed; i++)
+      bits[fIndices[i] >> 4] ^= 1 << (fIndices[i] & 15);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Recount the entries of a block stored as bits
+
+void TEntryListBlock::CountBits()
+{
+   fNPassed = 0;
+   for (Int_t i = 0; i < kBlockSize; i++)
+      fNPassed += std::bitset<16>(fIndices[i]).count();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge with the other block
 /// Returns the resulting number of entries in the block
 
 Int_t TEntryListBlock::Merge(TEntryListBlock *block)
 {
-   Int_t i, j;
+   Int_t i;
    if (block->GetNPassed() == 0) return GetNPassed();
    if (GetNPassed() == 0){
       //this block is empty
@@ -259,36 +286,12 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
       return fNPassed;
    }
    if (fType==0){
-      //stored as bits
-      if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
-         }
-      } else {
-         if (block->fPassing){
-            //the other block stores entries that pass
-            for (i=0; i<block->fNPassed; i++){
-               Enter(block->fIndices[i]);
-            }
-         } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
-               }
-            }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
-         }
-      }
+      //stored as bits: word by word union
+      UShort_t bits[kBlockSize];
+      block->FillBits(bits);
+      for (i=0; i<kBlockSize; i++)
+         fIndices[i] |= bits[i];
+      CountBits();
    } else {
       //stored as a list
       if (GetNPassed() + block->GetNPassed() > kBlockSize){
@@ -363,6 +366,30 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    return GetNPassed();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Remove from this block all the entries of the other block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Subtract(TEntryListBlock *block)
+{
+   if (block->GetNPassed() == 0 || GetNPassed() == 0) return GetNPassed();
+   if (fType != 0) {
+      //change to bits
+      UShort_t *bits = new UShort_t[kBlockSize];
+      Transform(1, bits);
+   }
+   UShort_t bits[kBlockSize];
+   block->FillBits(bits);
+   for (Int_t i = 0; i < kBlockSize; i++)
+      fIndices[i] &= ~bits[i];
+   CountBits();
+   fCurrent = 0;
+   fLastIndexQueried = -1;
+   fLastIndexReturned = -1;
+   OptimizeStorage();
+   return GetNPassed();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the number of entries, passing the selection.
 /// In case, when the block stores entries that pass (fPassing=1) returns fNPassed
@@ -47,6 +47,7 @@ of elements
 #include "strlcpy.h"
 
 #include <cctype>
+#include <cstring>
 
 ClassImp(TLeaf);
 
@@ -398,6 +399,68 @@ const TLeaf::Counts_t *TLeaf::GetLeafCountValues(Long64_t start, Long64_t len)
    return &(fLeafCountValues->fValues);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the entries of this leaf can be read in bulk with
+/// ReadBasketJagged(): a variable-size array of a basic type whose on-disk and
+/// in-memory representations have the same size.
+
+Bool_t TLeaf::SupportsBulkReadJagged() const
+{
+   const auto type = GetDeserializeType();
+   return fLeafCount && GetLenType() > 0 &&
+          (type == DeserializeType::kInPlace || type == DeserializeType::kZeroCopy);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Deserialize the N variable-size entries of a basket held in b.
+/// entryOffset gives the position of each entry in the buffer and last the end
+/// of the data of the last entry.
+///
+/// On success, the values of all entries are stored contiguously and in host
+/// byte order starting at b.GetCurrent(), suitably aligned for any basic type,
+/// and offsets holds the N+1 boundaries (in number of values) of the entries.
+
+bool TLeaf::ReadBasketJagged(TBuffer &b, Long64_t N, const Int_t *entryOffset, Int_t last, std::vector<Int_t> &offsets)
+{
+   if (R__unlikely(!SupportsBulkReadJagged()))
+      return false;
+
+   // The values of consecutive entries are already contiguous.
+   const Int_t size = GetLenType();
+   offsets.resize(N + 1);
+   offsets[0] = 0;
+   for (Long64_t i = 0; i < N; ++i) {
+      const Int_t end = (i + 1 < N) ? entryOffset[i + 1] : last;
+      const Int_t nbytes = end - entryOffset[i];
+      if (R__unlikely(nbytes < 0 || nbytes % size))
+         return false;
+      offsets[i + 1] = offsets[i] + nbytes / size;
+   }
+
+   const Int_t start = entryOffset[0] & ~7;
+   memmove(b.Buffer() + start, b.Buffer() + entryOffset[0], Long64_t(offsets[N]) * size);
+   return SwapJaggedValues(b, start, offsets[N], size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Convert nvalues values of the given size starting at position start of b
+/// to host byte order and leave the buffer pointing at the first of them.
+
+bool TLeaf::SwapJaggedValues(TBuffer &b, Int_t start, Long64_t nvalues, Int_t size)
+{
+   b.SetBufferOffset(start);
+   bool ok = true;
+   switch (size) {
+   case 1: break;
+   case 2: ok = b.ByteSwapBuffer(nvalues, kShort_t); break;
+   case 4: ok = b.ByteSwapBuffer(nvalues, kInt_t); break;
+   case 8: ok = b.ByteSwapBuffer(nvalues, kLong64_t); break;
+   default: ok = false;
+   }
+   b.SetBufferOffset(start);
+   return ok;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the number of effective elements of this leaf, for the current entry.
 
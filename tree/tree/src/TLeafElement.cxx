@@ -21,6 +21,10 @@ a TStreamerInfo (i.e. using TBranchElement).
 #include "TVirtualStreamerInfo.h"
 #include "Bytes.h"
 #include "TBuffer.h"
+#include "TClass.h"
+#include "TVirtualCollectionProxy.h"
+
+#include <cstring>
 
 ClassImp(TLeafElement);
 
@@ -149,6 +153,86 @@ Bool_t TLeafElement::ReadBasketFast(TBuffer &input_buf, Long64_t N)
    return input_buf.ByteSwapBuffer(fLen*N, type);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the type of the values if this leaf holds a `std::vector` of a basic
+/// type, streamed object-wise, and kOther_t otherwise.
+
+EDataType TLeafElement::GetVectorValueType() const
+{
+   TClass *clptr = nullptr;
+   EDataType type = EDataType::kOther_t;
+   if (fBranch->GetExpectedType(clptr, type) || !clptr)
+      return EDataType::kOther_t;
+   TVirtualCollectionProxy *proxy = clptr->GetCollectionProxy();
+   if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass())
+      return EDataType::kOther_t;
+
+   switch (proxy->GetType()) {
+   case EDataType::kChar_t:
+   case EDataType::kUChar_t:
+   case EDataType::kBool_t:
+   case EDataType::kShort_t:
+   case EDataType::kUShort_t:
+   case EDataType::kInt_t:
+   case EDataType::kUInt_t:
+   case EDataType::kLong64_t:
+   case EDataType::kULong64_t:
+   case EDataType::kFloat_t:
+   case EDataType::kDouble_t: return proxy->GetType();
+   default: return EDataType::kOther_t;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Deserialize the N entries of a basket of a `std::vector` of a basic type,
+/// see TLeaf::ReadBasketJagged().
+/// Each entry holds the byte count, the version and the size of the vector
+/// followed by its values; the values are packed in place, dropping the headers.
+/// The headers are checked against the entry boundaries, a mismatch makes the
+/// read fail rather than return garbage.
+
+bool TLeafElement::ReadBasketJagged(TBuffer &b, Long64_t N, const Int_t *entryOffset, Int_t last,
+                                    std::vector<Int_t> &offsets)
+{
+   const EDataType type = GetVectorValueType();
+   if (R__unlikely(type == EDataType::kOther_t))
+      return false;
+   const Int_t size = TDataType::GetDataType(type)->Size();
+
+   constexpr UInt_t kByteCountMask = 0x40000000;
+   constexpr Int_t kHeaderSize = sizeof(UInt_t) + sizeof(Version_t) + sizeof(Int_t);
+
+   char *buffer = b.Buffer();
+   const Int_t start = entryOffset[0] & ~7;
+   Long64_t dest = start;
+   offsets.resize(N + 1);
+   offsets[0] = 0;
+   for (Long64_t i = 0; i < N; ++i) {
+      const Int_t end = (i + 1 < N) ? entryOffset[i + 1] : last;
+      if (R__unlikely(end - entryOffset[i] < kHeaderSize))
+         return false;
+      b.SetBufferOffset(entryOffset[i]);
+      UInt_t bcnt;
+      Version_t version;
+      Int_t nvalues;
+      b >> bcnt;
+      b >> version;
+      b >> nvalues;
+      if (R__unlikely(!(bcnt & kByteCountMask) || nvalues < 0))
+         return false;
+      const Long64_t nbytes = Long64_t(nvalues) * size;
+      if (R__unlikely((bcnt & ~kByteCountMask) != sizeof(Version_t) + sizeof(Int_t) + nbytes ||
+                      entryOffset[i] + kHeaderSize + nbytes != end))
+         return false;
+      // The destination never overtakes the next entry's header.
+      memmove(buffer + dest, buffer + entryOffset[i] + kHeaderSize, nbytes);
+      dest += nbytes;
+      offsets[i + 1] = offsets[i] + nvalues;
+   }
+
+   return SwapJaggedValues(b, start, offsets[N], size);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns pointer to method corresponding to name name is a string
 /// with the general form "method(list of params)" If list of params is
@@ -419,6 +419,7 @@ End_Macro
 #include "TEmulatedCollectionProxy.h"
 #include "TVirtualIndex.h"
 #include "TVirtualPerfStats.h"
+#include "TTimeStamp.h"
 #include "TVirtualPad.h"
 #include "TBranchSTL.h"
 #include "TSchemaRuleSet.h"
@@ -919,6 +920,7 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 
 TTree::~TTree()
 {
+   FinishPipelinedBaskets();
    if (auto link = dynamic_cast<TNotifyLinkBase*>(fNotify)) {
       link->Clear();
    }
@@ -1508,6 +1510,9 @@ Long64_t TTree::AutoSave(Option_t* option)
    if (opt.Contains("flushbaskets")) {
       if (gDebug > 0) Info("AutoSave", "calling FlushBaskets \n");
       FlushBasketsImpl();
+   } else {
+      // The tree header refers to the file location of the baskets written by the pipelined Fill()
+      FinishPipelinedBaskets();
    }
 
    fSavedBytes = GetZipBytes();
@@ -3492,6 +3497,11 @@ namespace {
 ///
 /// See TTree::CloneTree for a detailed explanation of the semantics of these 3 options.
 ///
+/// When 'fast' is specified together with 'recompress', the baskets of the branches
+/// whose compression settings differ between the input and this tree are unzipped
+/// and zipped again with the settings of this tree, still without being unstreamed
+/// (in parallel when implicit multi-threading is enabled), see TTreeCloner::kRecompress.
+///
 /// If the tree or any of the underlying tree of the chain has an index, that index and any
 /// index in the subsequent underlying TTree objects will be merged.
 ///
@@ -3512,6 +3522,9 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
    TString opt = option;
    opt.ToLower();
    Bool_t fastClone = opt.Contains("fast");
+   UInt_t clonerOptions = TTreeCloner::kNoWarnings;
+   if (opt.Contains("recompress"))
+      clonerOptions |= TTreeCloner::kRecompress;
    Bool_t withIndex = !opt.Contains("noindex");
    EOnIndexError onIndexError;
    if (opt.Contains("asisindex")) {
@@ -3568,7 +3581,7 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
                }
             }
          }
-         TTreeCloner cloner(tree->GetTree(), this, option, TTreeCloner::kNoWarnings);
+         TTreeCloner cloner(tree->GetTree(), this, option, clonerOptions);
          if (cloner.IsValid()) {
             this->SetEntries(this->GetEntries() + tree->GetTree()->GetEntries());
             if (cacheSize != -1) cloner.SetCacheSize(cacheSize);
@@ -3718,6 +3731,7 @@ TBasket* TTree::CreateBasket(TBranch* branch)
 
 void TTree::Delete(Option_t* option /* = "" */)
 {
+   FinishPipelinedBaskets();
    TFile *file = GetCurrentFile();
 
    // delete all baskets and header from file
@@ -4732,6 +4746,14 @@ Int_t TTree::Fill()
          Info("TTree::Fill", "FlushBaskets() called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n", fEntries,
               GetZipBytes(), fFlushedBytes);
       fFlushedBytes = GetZipBytes();
+
+      // Rebalance the basket sizes with the proportions observed over all the clusters written so far.
+      if (fOptimizeBasketsInterval > 0 && fAutoFlush > 0 && !TestBit(TTree::kOnlyFlushAtCluster) &&
+          (fEntries / fAutoFlush) % fOptimizeBasketsInterval == 0) {
+         OptimizeBaskets(ULong64_t(Double_t(GetTotBytes()) * fAutoFlush / fEntries), 1, "");
+         if (gDebug > 0)
+            Info("TTree::Fill", "OptimizeBaskets called at entry %lld\n", fEntries);
+      }
    }
 
    if (autoSave) {
@@ -5117,6 +5139,13 @@ Int_t TTree::FlushBasketsImpl() const
    if (!fDirectory) return 0;
    Int_t nbytes = 0;
    Int_t nerror = 0;
+
+   // The pending writes of the pipelined Fill() need to be accounted for before the baskets are flushed
+   const auto nbpipelined = FinishPipelinedBaskets();
+   if (nbpipelined < 0)
+      ++nerror;
+   else
+      nbytes += nbpipelined;
    TObjArray *lb = const_cast<TTree*>(this)->GetListOfBranches();
    Int_t nb = lb->GetEntriesFast();
 
@@ -5168,7 +5197,7 @@ Int_t TTree::FlushBasketsImpl() const
       const_cast<TTree*>(this)->AddTotBytes(fIMTTotBytes);
       const_cast<TTree*>(this)->AddZipBytes(fIMTZipBytes);
 
-      return nerrpar ? -1 : nbpar.load();
+      return (nerrpar || nerror) ? -1 : (nbpar.load() + nbytes);
    }
 #endif
    for (Int_t j = 0; j < nb; j++) {
@@ -5632,7 +5661,13 @@ Int_t TTree::GetEntry(Long64_t entry, Int_t getall)
       TBranch *branch;
       for (i=0;i<nbranches;i++)  {
          branch = (TBranch*)fBranches.UncheckedAt(i);
-         nb = branch->GetEntry(entry, getall);
+         if (R__unlikely(fPerfStats)) {
+            Double_t start = TTimeStamp();
+            nb = branch->GetEntry(entry, getall);
+            fPerfStats->BranchReadEvent(branch, nb, start);
+         } else {
+            nb = branch->GetEntry(entry, getall);
+         }
          if (nb < 0) break;
          nbytes += nb;
       }
@@ -5651,46 +5686,81 @@ Int_t TTree::GetEntry(Long64_t entry, Int_t getall)
       }
       if (nb < 0) return nb;
 
+      // Only the branches that have to read and decompress a new basket for this entry are
+      // worth a task; the others just deserialize from the basket they already hold. For
+      // wide trees with clustered baskets, this means that the baskets of all the branches
+      // are loaded concurrently at the first entry of each cluster and that the remaining
+      // entries of the cluster are read sequentially, without the overhead of one task per
+      // branch and per entry.
+      fParBranchesToLoad.clear();
+      for (Int_t j = 0, n = fSortedBranches.size(); j < n; ++j) {
+         if (!fSortedBranches[j].second->IsEntryInCurrentBaskets(entry))
+            fParBranchesToLoad.push_back(j);
+      }
+
       // Enable this IMT use case (activate its locks)
       ROOT::Internal::TParBranchProcessingRAII pbpRAII;
 
       Int_t errnb = 0;
       std::atomic<Int_t> pos(0);
       std::atomic<Int_t> nbpar(0);
+      const Int_t ntoload = fParBranchesToLoad.size();
 
       auto mapFunction = [&]() {
-            // The branch to process is obtained when the task starts to run.
-            // This way, since branches are sorted, we make sure that branches
-            // leading to big tasks are processed first. If we assigned the
-            // branch at task creation time, the scheduler would not necessarily
-            // respect our sorting.
-            Int_t j = pos.fetch_add(1);
-
-            Int_t nbtask = 0;
-            auto branch = fSortedBranches[j].second;
-
-            if (gDebug > 0) {
-               std::stringstream ss;
-               ss << std::this_thread::get_id();
-               Info("GetEntry", "[IMT] Thread %s", ss.str().c_str());
-               Info("GetEntry", "[IMT] Running task for branch #%d: %s", j, branch->GetName());
-            }
+            // The branches to process are obtained while the task runs, each task
+            // taking the next one until none is left. This way, since branches are
+            // sorted, we make sure that branches leading to big tasks are processed
+            // first. If we assigned the branch at task creation time, the scheduler
+            // would not necessarily respect our sorting.
+            for (Int_t k = pos.fetch_add(1); k < ntoload; k = pos.fetch_add(1)) {
+               const Int_t j = fParBranchesToLoad[k];
+               Int_t nbtask = 0;
+               auto branch = fSortedBranches[j].second;
+
+               if (gDebug > 0) {
+                  std::stringstream ss;
+                  ss << std::this_thread::get_id();
+                  Info("GetEntry", "[IMT] Thread %s", ss.str().c_str());
+                  Info("GetEntry", "[IMT] Running task for branch #%d: %s", j, branch->GetName());
+               }
 
-            std::chrono::time_point<std::chrono::system_clock> start, end;
+               std::chrono::time_point<std::chrono::system_clock> start, end;
 
-            start = std::chrono::system_clock::now();
-            nbtask = branch->GetEntry(entry, getall);
-            end = std::chrono::system_clock::now();
+               start = std::chrono::system_clock::now();
+               nbtask = branch->GetEntry(entry, getall);
+               end = std::chrono::system_clock::now();
 
-            Long64_t tasktime = (Long64_t)std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
-            fSortedBranches[j].first += tasktime;
+               Long64_t tasktime = (Long64_t)std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+               fSortedBranches[j].first += tasktime;
 
-            if (nbtask < 0) errnb = nbtask;
-            else            nbpar += nbtask;
+               if (nbtask < 0) errnb = nbtask;
+               else            nbpar += nbtask;
+            }
          };
 
-      ROOT::TThreadExecutor pool;
-      pool.Foreach(mapFunction, fSortedBranches.size());
+      if (ntoload > 1) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(mapFunction, std::min<Int_t>(ntoload, pool.GetPoolSize()));
+      } else {
+         mapFunction();
+      }
+
+      // The branches that stay in their current baskets are cheap to read sequentially
+      if (errnb >= 0) {
+         auto toload = fParBranchesToLoad.begin();
+         for (Int_t j = 0, n = fSortedBranches.size(); j < n; ++j) {
+            if (toload != fParBranchesToLoad.end() && *toload == j) {
+               ++toload;
+               continue;
+            }
+            nb = fSortedBranches[j].second->GetEntry(entry, getall);
+            if (nb < 0) {
+               errnb = nb;
+               break;
+            }
+            nbpar += nb;
+         }
+      }
 
       if (errnb < 0) {
          nb = errnb;
@@ -6411,6 +6481,30 @@ void TTree::KeepCircular()
    fReadEntry = -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the branches to be favored by OptimizeBaskets from a read profile, in
+/// the format written by TTreeCache::SaveLearnedBranches(): one branch name per
+/// line, empty lines and lines starting with '#' being ignored.
+/// See SetHotBranches(). Returns the number of branches read, -1 on error.
+
+Int_t TTree::LoadHotBranches(const char *profile)
+{
+   std::ifstream in(profile);
+   if (!in) {
+      Error("LoadHotBranches", "cannot open %s", profile);
+      return -1;
+   }
+   std::vector<std::string> names;
+   std::string line;
+   while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#')
+         continue;
+      names.emplace_back(line);
+   }
+   SetHotBranches(names);
+   return names.size();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read in memory all baskets from all branches up to the limit of maxmemory bytes.
 ///
@@ -6908,7 +7002,7 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
          SetDirectory(info->fOutputDirectory);
          FlushBasketsImpl();
          fDirectory->WriteTObject(this);
-      } else if (info->fOptions.Contains("fast")) {
+      } else if (info->fOptions.Contains("fast") && !info->fOptions.Contains("recompress")) {
          InPlaceClone(info->fOutputDirectory);
       } else {
          TDirectory::TContext ctxt(info->fOutputDirectory);
@@ -7027,6 +7121,15 @@ Bool_t TTree::Notify()
 /// In case the branch compression factor for the data written so far is less
 /// than compMin, the compression is disabled.
 ///
+/// The branches given by SetHotBranches() (or LoadHotBranches() from a read
+/// profile) are not shrunk to fit in maxMemory and their baskets are made large
+/// enough to hold a whole cluster, so that a job reading only those branches
+/// needs a single read per branch and cluster; the other branches absorb the
+/// memory constraint.
+///
+/// TTree::Fill calls this function after the first cluster and, if
+/// SetOptimizeBasketsInterval() was called, again every that many clusters.
+///
 /// if option ="d" an analysis report is printed.
 
 void TTree::OptimizeBaskets(ULong64_t maxMemory, Float_t minComp, Option_t *option)
@@ -7046,6 +7149,11 @@ void TTree::OptimizeBaskets(ULong64_t maxMemory, Float_t minComp, Option_t *opti
       return;
    }
    Double_t aveSize = treeSize/nleaves;
+   std::set<TBranch*> hotBranches;
+   for (const auto &name : fHotBranches) {
+      if (TBranch *hot = GetBranch(name.c_str()))
+         hotBranches.insert(hot);
+   }
    UInt_t bmin = 512;
    UInt_t bmax = 256000;
    Double_t memFactor = 1;
@@ -7080,16 +7188,23 @@ void TTree::OptimizeBaskets(ULong64_t maxMemory, Float_t minComp, Option_t *opti
             newBaskets += 1+Int_t(totBytes/oldBsize);
             continue;
          }
-         Double_t bsize = oldBsize*idealFactor*memFactor; //bsize can be very large !
+         const Bool_t isHot = hotBranches.count(branch);
+         Double_t bsize = oldBsize*idealFactor*(isHot ? TMath::Max(memFactor, 1.) : memFactor); //bsize can be very large !
          if (bsize < 0) bsize = bmax;
-         if (bsize > bmax) bsize = bmax;
+         // If fAutoFlush is not set yet, let's assume that it is 'in the process of being set' to
+         // the value of GetEntries().
+         Long64_t clusterSize = (fAutoFlush > 0) ? fAutoFlush : branch->GetEntries();
+         if (isHot) {
+            if (branch->GetEntries() > 0)
+               bsize = TMath::Max(bsize, totBytes / branch->GetEntries() * clusterSize);
+            if (bsize > 10000000) bsize = 10000000;
+         } else if (bsize > bmax) {
+            bsize = bmax;
+         }
          UInt_t newBsize = UInt_t(bsize);
          if (pass) { // only on the second pass so that it doesn't interfere with scaling
             // If there is an entry offset, it will be stored in the same buffer as the object data; hence,
             // we must bump up the size of the branch to account for this extra footprint.
-            // If fAutoFlush is not set yet, let's assume that it is 'in the process of being set' to
-            // the value of GetEntries().
-            Long64_t clusterSize = (fAutoFlush > 0) ? fAutoFlush : branch->GetEntries();
             if (branch->GetEntryOffsetLen()) {
                newBsize = newBsize + (clusterSize * sizeof(Int_t) * 2);
             }
@@ -8782,6 +8897,7 @@ Int_t TTree::SetCacheSizeAux(Bool_t autocache /* = kTRUE */, Long64_t cacheSize
       pf = new TTreeCache(this, cacheSize);
 
    pf->SetAutoCreated(autocache);
+   pf->LoadLearnedBranches();
 
    return 0;
 }
@@ -8789,6 +8905,12 @@ Int_t TTree::SetCacheSizeAux(Bool_t autocache /* = kTRUE */, Long64_t cacheSize
 ////////////////////////////////////////////////////////////////////////////////
 ///interface to TTreeCache to set the cache entry range
 ///
+/// The same range is set on the caches of the friend trees that are
+/// aligned entry by entry with this tree (plain TTree friends without a
+/// tree index), so that their prefetching follows the entries actually
+/// read instead of the whole friend tree. Friends using an index and friends
+/// managed by a TChain are left untouched.
+///
 /// Returns:
 /// - 0 entry range set
 /// - -1 on error
@@ -8821,6 +8943,24 @@ Int_t TTree::SetCacheEntryRange(Long64_t first, Long64_t last)
       return -1;
    }
    tc->SetEntryRange(first,last);
+
+   if (fFriends && !(fFriendLockStatus & kSetCacheEntryRange)) {
+      TFriendLock lock(this, kSetCacheEntryRange);
+      TIter nextf(fFriends);
+      TFriendElement *fe = nullptr;
+      while ((fe = (TFriendElement *)nextf())) {
+         if (fe->TestBit(TFriendElement::kFromChain))
+            continue;
+         TTree *friendTree = fe->GetTree();
+         // A TChain would interpret the range with its own global numbering
+         if (!friendTree || friendTree->GetTree() != friendTree || friendTree->GetTreeIndex())
+            continue;
+         TFile *ff = friendTree->GetCurrentFile();
+         TTreeCache *ftc = ff ? friendTree->GetReadCache(ff, kTRUE) : nullptr;
+         if (ftc)
+            ftc->SetEntryRange(first, last);
+      }
+   }
    return 0;
 }
 
@@ -9066,6 +9206,67 @@ void TTree::SetEventList(TEventList *evlist)
    fEntryList->SetBit(kCanDelete, kTRUE);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the pipelined Fill() for this tree.
+///
+/// Only effective if implicit multi-threading is enabled for this tree (see
+/// SetImplicitMT()).  By default, the baskets that become full during Fill()
+/// are compressed in parallel tasks, but Fill() waits for these tasks before
+/// returning.  In pipelined mode, a full basket is instead handed off to a task
+/// that compresses and writes it, and Fill() returns immediately: filling
+/// continues in a fresh basket of the branch while the previous one is written.
+/// Each branch has at most one basket in flight.  The pending writes are waited
+/// for when the baskets are flushed (in particular at the AutoFlush boundaries),
+/// when the tree header is written and when the tree is deleted.
+///
+/// Note that in pipelined mode, the byte counters of the tree and the branches
+/// (GetZipBytes(), GetTotBytes(), ...) can lag behind by the baskets that are
+/// still in flight.
+
+void TTree::SetImplicitMTPipelinedFill(Bool_t enabled)
+{
+   if (!enabled)
+      FinishPipelinedBaskets();
+   fIMTPipelinedFill = enabled;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the baskets that are handed off to tasks by the pipelined Fill()
+/// and update the branches accordingly.
+///
+/// Returns the number of bytes written by these tasks or -1 in case of a write
+/// error.
+
+Int_t TTree::FinishPipelinedBaskets() const
+{
+   Int_t nbytes = 0;
+   Int_t nerror = 0;
+   auto fnFinish = [&](TBranch *branch) {
+      const auto nwrite = branch->FinishPipelinedBasket();
+      if (nwrite < 0)
+         ++nerror;
+      else
+         nbytes += nwrite;
+   };
+
+   std::vector<const TObjArray *> stack{&fBranches};
+   while (!stack.empty()) {
+      const TObjArray *branches = stack.back();
+      stack.pop_back();
+      for (Int_t i = 0, n = branches->GetEntriesFast(); i < n; ++i) {
+         auto branch = static_cast<TBranch *>(branches->UncheckedAt(i));
+         if (!branch)
+            continue;
+         fnFinish(branch);
+         stack.push_back(branch->GetListOfBranches());
+      }
+   }
+   if (fBranchRef)
+      fnFinish(fBranchRef);
+
+   return nerror ? -1 : nbytes;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set number of entries to estimate variable limits.
 /// If n is -1, the estimate is set to be the current maximum
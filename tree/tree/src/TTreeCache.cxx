@@ -20,6 +20,7 @@
 - [General Description](\ref description)
 - [Changes in behaviour](\ref changesbehaviour)
 - [Self-optimization](\ref cachemisses)
+- [Reusing the learned branches](\ref learnedprofile)
 - [Examples of usage](\ref examples)
 - [Check performance and stats](\ref checkPerf)
 
@@ -106,6 +107,26 @@ The learning period is stopped (and prefetching is started) when:
      fEntryMin + fgLearnEntries.
    - A 'cached' TChain switches over to a new file.
 
+\anchor learnedprofile
+## Reusing the learned branches in later jobs
+
+The outcome of the learning phase, i.e. the list of branches that were read,
+can be exported with GetLearnedBranches() or SaveLearnedBranches() and fed
+to a later cache with SetLearnedBranches() or LoadLearnedBranches(). The
+learning phase is then skipped and the very first cluster is prefetched.
+This matters for many short jobs over many files.
+
+The profile file is a plain text file with one branch name per line.
+When the TTreeCache.Profile resource or the environment variable
+`ROOT_TTREECACHE_PROFILE` names such a file, the caches created by
+TTree::SetCacheSize (including the automatic ones) load it if it exists.
+If it does not exist yet, a cache that learned its branches saves them there
+when it is deleted, so that the first job of a campaign produces the profile
+for the following ones:
+~~~ {.cpp}
+    gEnv->SetValue("TTreeCache.Profile", "analysis.ttreecache");
+~~~
+
 
 \anchor cachemisses
 ## Self-optimization in presence of cache misses
@@ -301,6 +322,8 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TVirtualPerfStats.h"
 #include <limits.h>
 
+#include <fstream>
+
 Int_t TTreeCache::fgLearnEntries = 100;
 
 ClassImp(TTreeCache);
@@ -333,6 +356,11 @@ TTreeCache::~TTreeCache()
    // we are deleted explicitly by legacy user code).
    if (fFile) fFile->SetCacheRead(0, fTree);
 
+   // Leave the learned branches to the next job if a profile is configured
+   // but could not be used by this one.
+   if (!fProfileLoaded && !fIsLearning && fBrNames && fBrNames->GetEntries() > 0 && GetConfiguredProfile())
+      SaveLearnedBranches();
+
    delete fBranches;
    if (fBrNames) {fBrNames->Delete(); delete fBrNames; fBrNames=0;}
 }
@@ -1800,6 +1828,19 @@ TTreeCache::EPrefillType TTreeCache::GetConfiguredPrefillType() const
    return static_cast<TTreeCache::EPrefillType>(s);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the learned-branch profile from the environment variable
+/// ROOT_TTREECACHE_PROFILE or the resource variable TTreeCache.Profile, or
+/// nullptr if none is configured. See LoadLearnedBranches().
+
+const char *TTreeCache::GetConfiguredProfile()
+{
+   const char *profile = gSystem->Getenv("ROOT_TTREECACHE_PROFILE");
+   if (!profile || !*profile)
+      profile = gEnv->GetValue("TTreeCache.Profile", "");
+   return (profile && *profile) ? profile : nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Give the total efficiency of the primary cache... defined as the ratio
 /// of blocks found in the cache vs. the number of blocks prefetched
@@ -1863,6 +1904,23 @@ Int_t TTreeCache::GetLearnEntries()
    return fgLearnEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the names of the branches registered in the cache so far, i.e. the
+/// outcome of the learning phase once it is over. The list can be given to
+/// SetLearnedBranches() of a cache in a later session.
+
+std::vector<std::string> TTreeCache::GetLearnedBranches() const
+{
+   std::vector<std::string> names;
+   if (!fBrNames)
+      return names;
+   names.reserve(fBrNames->GetEntries());
+   TIter next(fBrNames);
+   while (auto os = static_cast<TObjString *>(next()))
+      names.emplace_back(os->GetName());
+   return names;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print cache statistics. Like:
 ///
@@ -2301,3 +2359,112 @@ void TTreeCache::LearnPrefill()
 
    fLearnPrefilling = kFALSE;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Put the given branches in the cache and stop the learning phase, as if
+/// the cache had learned them. Typically the list comes from
+/// GetLearnedBranches() of a cache in an earlier session.
+/// Branches that do not exist in the current tree are silently ignored, the
+/// list may come from a file with a slightly different layout.
+/// Returns:
+///  - the number of branches put in the cache
+///  - -1 on error
+
+Int_t TTreeCache::SetLearnedBranches(const std::vector<std::string> &branches)
+{
+   if (!fTree)
+      return -1;
+
+   Int_t nadded = 0;
+   for (const auto &name : branches) {
+      TBranch *b = fTree->GetBranch(name.c_str());
+      if (!b)
+         continue;
+      if (AddBranch(b) == 0)
+         ++nadded;
+   }
+   if (nadded == 0)
+      return 0;
+
+   fProfileLoaded = kTRUE;
+   StopLearningPhase();
+   return nadded;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the names of the learned branches to a profile file, one per line,
+/// such that LoadLearnedBranches() can skip the learning phase in later jobs.
+/// If filename is null, the configured profile is used (see
+/// GetConfiguredProfile()). The file is replaced atomically, concurrent jobs
+/// saving the same profile do not see partial files.
+/// Returns:
+///  - the number of branches written
+///  - -1 on error
+
+Int_t TTreeCache::SaveLearnedBranches(const char *filename) const
+{
+   if (!filename)
+      filename = GetConfiguredProfile();
+   if (!filename) {
+      Error("SaveLearnedBranches", "no profile file name given or configured");
+      return -1;
+   }
+
+   const auto names = GetLearnedBranches();
+   TString tmpname = TString::Format("%s.%d.tmp", filename, gSystem->GetPid());
+   {
+      std::ofstream out(tmpname.Data());
+      if (!out) {
+         Error("SaveLearnedBranches", "cannot open %s for writing", tmpname.Data());
+         return -1;
+      }
+      out << "# TTreeCache learned branches\n";
+      for (const auto &name : names)
+         out << name << '\n';
+      if (!out) {
+         Error("SaveLearnedBranches", "cannot write %s", tmpname.Data());
+         gSystem->Unlink(tmpname);
+         return -1;
+      }
+   }
+   if (gSystem->Rename(tmpname, filename) != 0) {
+      Error("SaveLearnedBranches", "cannot rename %s to %s", tmpname.Data(), filename);
+      gSystem->Unlink(tmpname);
+      return -1;
+   }
+   return names.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read a profile written by SaveLearnedBranches() and pass its branches to
+/// SetLearnedBranches(). Empty lines and lines starting with '#' are ignored.
+/// If filename is null, the configured profile is used (see
+/// GetConfiguredProfile()); in that case a missing profile is not an error,
+/// the cache then learns as usual and saves the profile when it is deleted.
+/// Returns:
+///  - the number of branches put in the cache
+///  - -1 on error
+
+Int_t TTreeCache::LoadLearnedBranches(const char *filename)
+{
+   const bool configured = !filename;
+   if (configured) {
+      filename = GetConfiguredProfile();
+      if (!filename || gSystem->AccessPathName(filename))
+         return 0;
+   }
+
+   std::ifstream in(filename);
+   if (!in) {
+      Error("LoadLearnedBranches", "cannot open %s", filename);
+      return -1;
+   }
+   std::vector<std::string> names;
+   std::string line;
+   while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#')
+         continue;
+      names.emplace_back(line);
+   }
+   return SetLearnedBranches(names);
+}
@@ -16,6 +16,14 @@
 
 A TTreeCache which exploits parallelized decompression of its own content.
 
+When implicit multi-threading is enabled, the baskets of the current cache
+content are unzipped by tasks of a ROOT::Experimental::TTaskGroup, ahead of
+the reader: the blocks are handed to the tasks in entry order, which is the
+order in which the reader asks for them, and only as long as the unzipped
+blocks not yet picked up plus the blocks being unzipped fit in the unzip
+buffer size (see SetUnzipBufferSize()). Every basket picked up by the reader
+frees room for the next ones.
+
 */
 
 #include "TTreeCacheUnzip.h"
@@ -29,11 +37,12 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMutex.h"
 
 #ifdef R__USE_IMT
-#include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
@@ -307,6 +316,7 @@ Bool_t TTreeCacheUnzip::FillBuffer()
 
    //clear cache buffer
    TFileCacheRead::Prefetch(0,0);
+   fSeekEntry.clear();
 
    //store baskets
    for (Int_t i = 0; i < fNbranches; i++) {
@@ -338,6 +348,7 @@ Bool_t TTreeCacheUnzip::FillBuffer()
          fNReadPref++;
 
          TFileCacheRead::Prefetch(pos, len);
+         fSeekEntry.push_back(entries[j]);
       }
       if (gDebug > 0) printf("Entry: %lld, registering baskets branch %s, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, ((TBranch*)fBranches->UncheckedAt(i))->GetName(), fEntryNext, fNseek, fNtot);
    }
@@ -500,9 +511,17 @@ Int_t TTreeCacheUnzip::GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes,
 
 void TTreeCacheUnzip::ResetCache()
 {
+#ifdef R__USE_IMT
+   // The tasks must not touch the state arrays while they are resized or wiped.
+   WaitUnzipTasks();
+#endif
    // Reset all the lists and wipe all the chunks
    fCycle++;
    fUnzipState.Clear(fNseekMax);
+   fUnzipHeld = 0;
+   fUnzipInFlight = 0;
+   fUnzipOrder.clear();
+   fUnzipNext = 0;
 
    if(fNseekMax < fNseek){
       if (gDebug > 0)
@@ -594,6 +613,7 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
          return 1;
       }
       fUnzipState.SetUnzipped(index, ptr, loclen); // Set it as done
+      fUnzipHeld += loclen;
       fNUnzip++;
    } else {
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
@@ -606,52 +626,90 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 
 #ifdef R__USE_IMT
 ////////////////////////////////////////////////////////////////////////////////
-/// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
-/// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping
-/// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// Start unzipping the current content of the cache in the background.
+/// The blocks are ordered by the first entry of their basket, since they were
+/// registered branch by branch, and handed to TTaskGroup tasks in groups of at
+/// least fUnzipGroupSize bytes by ScheduleUnzipTasks().
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
-   auto mapFunction = [&]() {
-      auto unzipFunction = [&](const std::vector<Int_t> &indices) {
-         // If cache is invalidated and we should return immediately.
-         if (!fIsTransferred) return nullptr;
+   WaitUnzipTasks();
+   fUnzipInFlight = 0;
+
+   fUnzipOrder.resize(fNseek);
+   std::iota(fUnzipOrder.begin(), fUnzipOrder.end(), 0);
+   if (fSeekEntry.size() == static_cast<std::size_t>(fNseek)) {
+      std::stable_sort(fUnzipOrder.begin(), fUnzipOrder.end(),
+                       [this](Int_t a, Int_t b) { return fSeekEntry[a] < fSeekEntry[b]; });
+   }
+   fUnzipNext = 0;
+
+   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
+   ScheduleUnzipTasks();
+
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the next groups of blocks in fUnzipOrder to unzip tasks, as long as the
+/// bytes held by unzipped blocks plus the compressed bytes of the blocks being
+/// unzipped stay below fUnzipBufferSize. At least one group is always kept
+/// going, such that a block larger than the budget does not stall the
+/// pipeline. Only called by the main thread.
+
+void TTreeCacheUnzip::ScheduleUnzipTasks()
+{
+   if (!fUnzipTaskGroup || !fIsTransferred)
+      return;
+   if (fUnzipGroupSize <= 0)
+      fUnzipGroupSize = 102400;
+
+   const Int_t nblocks = fUnzipOrder.size();
+   while (fUnzipNext < nblocks) {
+      const Long64_t used = fUnzipHeld + fUnzipInFlight;
+      if (fUnzipBufferSize > 0 && used > 0 && used >= fUnzipBufferSize)
+         break;
+
+      std::vector<Int_t> indices;
+      Long64_t groupBytes = 0;
+      while (fUnzipNext < nblocks && groupBytes < fUnzipGroupSize) {
+         const Int_t idx = fUnzipOrder[fUnzipNext++];
+         if (!fUnzipState.IsUntouched(idx))
+            continue;
+         indices.push_back(idx);
+         groupBytes += fSeekLen[idx];
+         if (fUnzipBufferSize > 0 && used + groupBytes >= fUnzipBufferSize)
+            break;
+      }
+      if (indices.empty())
+         break;
 
+      fUnzipInFlight += groupBytes;
+      fUnzipTaskGroup->Run([this, indices, groupBytes]() {
          for (auto ii : indices) {
-            if(fUnzipState.TryUnzipping(ii)) {
+            // If cache is invalidated we return immediately.
+            if (!fIsTransferred)
+               break;
+            if (fUnzipState.TryUnzipping(ii)) {
                Int_t res = UnzipCache(ii);
-               if(res)
-                  if (gDebug > 0)
-                     Info("UnzipCache", "Unzipping failed or cache is in learning state");
+               if (res && gDebug > 0)
+                  Info("UnzipCache", "Unzipping failed or cache is in learning state");
             }
          }
-         return nullptr;
-      };
-
-      Int_t accusz = 0;
-      std::vector<std::vector<Int_t>> basketIndices;
-      std::vector<Int_t> indices;
-      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
-      for (Int_t i = 0; i < fNseek; i++) {
-         while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
-            i++;
-            if (i >= fNseek) break;
-         }
-         if (i < fNseek) i--;
-         basketIndices.push_back(indices);
-         indices.clear();
-         accusz = 0;
-      }
-      ROOT::TThreadExecutor pool;
-      pool.Foreach(unzipFunction, basketIndices);
-   };
+         fUnzipInFlight -= groupBytes;
+      });
+   }
+}
 
-   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
-   fUnzipTaskGroup->Run(mapFunction);
+////////////////////////////////////////////////////////////////////////////////
+/// Cancel the unzip tasks that did not start yet and wait for the running ones.
 
-   return 0;
+void TTreeCacheUnzip::WaitUnzipTasks()
+{
+   if (fUnzipTaskGroup) {
+      fUnzipTaskGroup->Cancel();
+      fUnzipTaskGroup.reset();
+   }
 }
 #endif
 
@@ -715,6 +773,10 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
                }
 
                fNFound++;
+               fUnzipHeld -= fUnzipState.fUnzipLen[seekidx];
+#ifdef R__USE_IMT
+               ScheduleUnzipTasks();
+#endif
                return fUnzipState.fUnzipLen[seekidx];
             }
 
@@ -723,8 +785,10 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
 
             if (fUnzipState.IsProgress(seekidx)) {
                if (fEmpty) {
-                  for (Int_t ii = 0; ii < fNseek; ++ii) {
-                     Int_t idx = (seekidx + 1 + ii) % fNseek;
+                  // Only steal among the blocks already handed to the tasks, the others are
+                  // beyond the unzip budget.
+                  for (Int_t ii = 0; ii < fUnzipNext; ++ii) {
+                     Int_t idx = fUnzipOrder[ii];
                      if (fUnzipState.IsUntouched(idx)) {
                         if(fUnzipState.TryUnzipping(idx)) {
                            reqi = idx;
@@ -764,6 +828,10 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
             }
 
             fNStalls++;
+            fUnzipHeld -= fUnzipState.fUnzipLen[seekidx];
+#ifdef R__USE_IMT
+            ScheduleUnzipTasks();
+#endif
             return fUnzipState.fUnzipLen[seekidx];
          } else {
             // This is a complete miss. We want to avoid the background tasks
@@ -792,10 +860,7 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
    if (!ReadBufferExt(fCompBuffer, pos, len, loc)) {
       // Cache is invalidated and we need to wait for all unzipping tasks to be finished before fill new baskets in cache.
 #ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled() && fUnzipTaskGroup) {
-         fUnzipTaskGroup->Cancel();
-         fUnzipTaskGroup.reset();
-      }
+      WaitUnzipTasks();
 #endif
       {
          // Fill new baskets into cache.
@@ -833,8 +898,10 @@ void TTreeCacheUnzip::SetUnzipRelBufferSize(Float_t relbufferSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Sets the size for the unzipping cache... by default it should be
-/// two times the size of the prefetching cache
+/// Sets the size for the unzipping cache, i.e. the byte budget for the blocks
+/// unzipped ahead of the reader and not yet picked up, plus the blocks being
+/// unzipped. By default it is fgRelBuffSize times the size of the prefetching
+/// cache (see SetUnzipRelBufferSize()). A value <= 0 disables the limit.
 
 void TTreeCacheUnzip::SetUnzipBufferSize(Long64_t bufferSize)
 {
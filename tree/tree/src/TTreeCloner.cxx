@@ -34,9 +34,33 @@ Class implementing or helping  the various TTree cloning method
 #include "TLeafC.h"
 #include "TFileCacheRead.h"
 #include "TTreeCache.h"
+#include "TROOT.h"
 #include "snprintf.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
+
 #include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace {
+
+/// Compression level and algorithm of the baskets of a branch, resolved as in TBasket::WriteBuffer
+void GetBasketCompression(const TBranch *branch, const TFile *file, Int_t &level, Int_t &algorithm)
+{
+   level = branch->GetCompressionLevel();
+   if (level == ROOT::RCompressionSetting::ELevel::kInherit)
+      level = file ? file->GetCompressionLevel() : 0;
+   algorithm = branch->GetCompressionAlgorithm();
+   if (algorithm == ROOT::RCompressionSetting::EAlgorithm::kInherit)
+      algorithm = file ? file->GetCompressionAlgorithm() : 0;
+   if (level <= 0)
+      algorithm = 0;
+}
+
+} // anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -345,6 +369,28 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
 
    }
 
+   // Recompressed baskets do not need the dictionary of the input branch.
+   if (from->fCompressionDictID && from->fCompressionDictID != to->fCompressionDictID &&
+       !NeedRecompression(from, to)) {
+      if (to->fCompressionDictID == 0) {
+         // The output baskets were compressed without dictionary so far; adopt the one the copied baskets need.
+         to->fCompressionDict = from->fCompressionDict;
+         to->fCompressionDictID = from->fCompressionDictID;
+         to->fCompressionDictDone = kTRUE;
+         to->fDictSamples.clear();
+         to->fDictSampleSizes.clear();
+      } else {
+         fWarningMsg.Form("The export branch and the import branch (%s) use different compression dictionaries.",
+                          from->GetName());
+         if (!(fOptions & kNoWarnings)) {
+            Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+         }
+         fIsValid = kFALSE;
+         fNeedConversion = kTRUE;
+         return 0;
+      }
+   }
+
    fFromBranches.AddLast(from);
    if (!from->TestBit(TBranch::kDoNotUseBufferMap)) {
       // Make sure that we reset the Buffer's map if needed.
@@ -643,6 +689,20 @@ void TTreeCloner::ImportClusterRanges()
    fToTree->SetEntries(fToTree->GetEntries() + fFromTree->GetTree()->GetEntries());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the baskets of 'from' must be recompressed to match the
+/// compression settings of 'to' (only with the kRecompress option).
+
+Bool_t TTreeCloner::NeedRecompression(TBranch *from, TBranch *to) const
+{
+   if (!(fOptions & kRecompress) || IsInPlace())
+      return kFALSE;
+   Int_t fromLevel, fromAlgorithm, toLevel, toAlgorithm;
+   GetBasketCompression(from, from->GetFile(0), fromLevel, fromAlgorithm);
+   GetBasketCompression(to, fToFile, toLevel, toAlgorithm);
+   return fromLevel != toLevel || fromAlgorithm != toAlgorithm;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the TFile cache size to be used.
 /// Note that the default is to use the same size as the default TTreeCache for
@@ -724,6 +784,10 @@ UInt_t TTreeCloner::FillCache(UInt_t from)
 
 void TTreeCloner::WriteBaskets()
 {
+   if ((fOptions & kRecompress) && !IsInPlace()) {
+      WriteBasketsRecompressed();
+      return;
+   }
    TBasket *basket = new TBasket();
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
@@ -776,3 +840,97 @@ void TTreeCloner::WriteBaskets()
    }
    delete basket;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the baskets from the input file to the output file, recompressing
+/// the ones of the branches whose compression settings differ (kRecompress).
+///
+/// The baskets are handled in groups, in the order chosen by SortBaskets: the
+/// group is read, its baskets are unzipped and zipped again with the settings of
+/// the output branch, in parallel tasks when implicit multi-threading is
+/// enabled, and then written. A basket that can not be recompressed is copied
+/// as is, since each basket records its own compression algorithm.
+
+void TTreeCloner::WriteBasketsRecompressed()
+{
+   const Int_t nbranches = fFromBranches.GetEntriesFast();
+   std::vector<Int_t> cxLevel(nbranches, -1);
+   std::vector<Int_t> cxAlgorithm(nbranches, 0);
+   for (Int_t i = 0; i < nbranches; ++i) {
+      TBranch *from = (TBranch*)fFromBranches.UncheckedAt(i);
+      TBranch *to   = (TBranch*)fToBranches.UncheckedAt(i);
+      if (NeedRecompression(from, to))
+         GetBasketCompression(to, fToFile, cxLevel[i], cxAlgorithm[i]);
+   }
+
+   const UInt_t groupSize = 128;
+   std::vector<std::unique_ptr<TBasket>> baskets(groupSize);
+   std::vector<UInt_t> toRecompress;
+   toRecompress.reserve(groupSize);
+   auto recompress = [&](UInt_t j) {
+      const UInt_t b = fBasketBranchNum[fBasketIndex[j]];
+      baskets[j % groupSize]->Recompress(cxLevel[b], cxAlgorithm[b]);
+   };
+
+   for (UInt_t first = 0, notCached = 0; first < fMaxBaskets; first += groupSize) {
+      const UInt_t last = std::min(first + groupSize, fMaxBaskets);
+
+      toRecompress.clear();
+      for (UInt_t j = first; j < last; ++j) {
+         auto &basket = baskets[j % groupSize];
+         basket.reset();
+         const UInt_t b = fBasketBranchNum[fBasketIndex[j]];
+         TBranch *from = (TBranch*)fFromBranches.UncheckedAt(b);
+         Int_t index = fBasketNum[fBasketIndex[j]];
+         Long64_t pos = from->GetBasketSeek(index);
+         if (pos == 0)
+            continue;
+         if (fFileCache && j >= notCached) {
+            notCached = FillCache(notCached);
+         }
+         TFile *fromfile = from->GetFile(0);
+         basket.reset(new TBasket());
+         if (from->GetBasketBytes()[index] == 0) {
+            from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
+         }
+         Int_t len = from->GetBasketBytes()[index];
+         basket->LoadBasketBuffers(pos,len,fromfile,fFromTree);
+         if (cxLevel[b] >= 0)
+            toRecompress.push_back(j);
+      }
+
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && toRecompress.size() > 1) {
+         ROOT::Experimental::TTaskGroup tg;
+         for (auto j : toRecompress)
+            tg.Run([&recompress, j]() { recompress(j); });
+         tg.Wait();
+      } else
+#endif
+      {
+         for (auto j : toRecompress)
+            recompress(j);
+      }
+
+      for (UInt_t j = first; j < last; ++j) {
+         TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+         TBranch *to   = (TBranch*)fToBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+         Int_t index = fBasketNum[ fBasketIndex[j] ];
+         auto &basket = baskets[j % groupSize];
+         if (basket) {
+            basket->IncrementPidOffset(fPidOffset);
+            basket->CopyTo(fToFile);
+            to->AddBasket(*basket,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
+            basket.reset();
+         } else {
+            TBasket *frombasket = from->GetBasket( index );
+            if (frombasket && frombasket->GetNevBuf()>0) {
+               TBasket *tobasket = (TBasket*)frombasket->Clone();
+               tobasket->SetBranch(to);
+               to->AddBasket(*tobasket, kFALSE, fToStartEntries+from->GetBasketEntry()[index]);
+               to->FlushOneBasket(to->GetWriteBasket());
+            }
+         }
+      }
+   }
+}
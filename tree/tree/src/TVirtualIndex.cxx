@@ -32,3 +32,17 @@ TVirtualIndex::TVirtualIndex(): TNamed()
 TVirtualIndex::~TVirtualIndex()
 {
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill entries[i] with the entry number corresponding to major[i] and minor[i],
+/// or -1 if there is none, for i in [0, n). See GetEntryNumberWithIndex.
+///
+/// Implementations may take advantage of the pairs being sorted, as when matching
+/// the entries of two trees ordered by run and event numbers.
+
+void TVirtualIndex::GetEntryNumbersWithIndex(Long64_t n, const Long64_t *major, const Long64_t *minor,
+                                             Long64_t *entries) const
+{
+   for (Long64_t i = 0; i < n; ++i)
+      entries[i] = GetEntryNumberWithIndex(major[i], minor[i]);
+}
@@ -5,6 +5,9 @@
 
 #include "gtest/gtest.h"
 
+#include <string>
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +31,99 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, pipelinedFill)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "pipelinedFillMT.root";
+   const Long64_t nEntries = 100000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetImplicitMTPipelinedFill(true);
+      EXPECT_TRUE(t.GetImplicitMTPipelinedFill());
+      t.SetAutoFlush(10000);
+      Long64_t i = 0;
+      double x = 0.;
+      int v[8] = {};
+      t.Branch("i", &i);
+      t.Branch("x", &x);
+      t.Branch("v", v, "v[8]/I");
+      // Small baskets so that many baskets are handed off between the AutoFlush boundaries
+      t.SetBasketSize("*", 1000);
+      for (; i < nEntries; ++i) {
+         x = 0.5 * i;
+         for (int j = 0; j < 8; ++j)
+            v[j] = i + j;
+         t.Fill();
+         if (i == nEntries / 2)
+            t.AutoSave("SaveSelf");
+      }
+      t.Write();
+      EXPECT_GT(t.GetZipBytes(), 0);
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   EXPECT_EQ(nEntries, t->GetEntries());
+   Long64_t i = -1;
+   double x = -1.;
+   int v[8] = {};
+   t->SetBranchAddress("i", &i);
+   t->SetBranchAddress("x", &x);
+   t->SetBranchAddress("v", v);
+   for (Long64_t e = 0; e < nEntries; ++e) {
+      t->GetEntry(e);
+      ASSERT_EQ(e, i);
+      ASSERT_DOUBLE_EQ(0.5 * e, x);
+      ASSERT_EQ(e + 7, v[7]);
+   }
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, wideTreeGetEntry)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "wideTreeGetEntryMT.root";
+   const Long64_t nEntries = 5000;
+   const int nBranches = 200;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(700);
+      std::vector<int> values(nBranches);
+      for (int b = 0; b < nBranches; ++b)
+         t.Branch(("b" + std::to_string(b)).c_str(), &values[b]);
+      // Baskets of different branches end at different entries
+      t.SetBasketSize("b1*", 1000);
+      for (Long64_t e = 0; e < nEntries; ++e) {
+         for (int b = 0; b < nBranches; ++b)
+            values[b] = e * b;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   std::vector<int> values(nBranches, -1);
+   for (int b = 0; b < nBranches; ++b)
+      t->SetBranchAddress(("b" + std::to_string(b)).c_str(), &values[b]);
+   // Sequential and random access
+   for (Long64_t e : {0LL, 1LL, 699LL, 700LL, 4999LL, 3LL, 2000LL, 2001LL}) {
+      EXPECT_GT(t->GetEntry(e), 0);
+      for (int b = 0; b < nBranches; ++b)
+         ASSERT_EQ(e * b, values[b]) << "entry " << e << " branch " << b;
+   }
+   for (Long64_t e = 0; e < nEntries; ++e) {
+      t->GetEntry(e);
+      for (int b = 0; b < nBranches; ++b)
+         ASSERT_EQ(e * b, values[b]) << "entry " << e << " branch " << b;
+   }
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
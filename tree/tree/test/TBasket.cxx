@@ -411,3 +411,41 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<Bool_t *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, kTRUE);
 }
+
+TEST(TBasket, ZSTDDictionary)
+{
+   TMemFile f("tbasket_zstddict.root", "CREATE", "",
+              ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kZSTDDict, 5));
+   ASSERT_FALSE(f.IsZombie());
+
+   const Int_t nEntries = 20000;
+   {
+      TTree t1("t1", "Tree with small baskets compressed with a ZSTD dictionary.");
+      Int_t idx;
+      Float_t x;
+      TBranch *br = t1.Branch("idx", &idx, "idx/I", 2048);
+      t1.Branch("x", &x, "x/F", 2048);
+      for (idx = 0; idx < nEntries; idx++) {
+         x = (idx % 37) * 0.5f;
+         t1.Fill();
+      }
+      EXPECT_NE(br->GetCompressionDictionaryID(), 0u);
+      t1.Write();
+   }
+
+   TTree *saved_t1 = nullptr;
+   f.GetObject("t1", saved_t1);
+   ASSERT_NE(saved_t1, nullptr);
+   EXPECT_NE(saved_t1->GetBranch("idx")->GetCompressionDictionaryID(), 0u);
+
+   Int_t idx;
+   Float_t x;
+   saved_t1->SetBranchAddress("idx", &idx);
+   saved_t1->SetBranchAddress("x", &x);
+   ASSERT_EQ(saved_t1->GetEntries(), nEntries);
+   for (Long64_t i = 0; i < nEntries; i++) {
+      saved_t1->GetEntry(i);
+      EXPECT_EQ(idx, i);
+      EXPECT_FLOAT_EQ(x, (i % 37) * 0.5f);
+   }
+}
@@ -2,6 +2,8 @@
 #include <TFile.h>
 #include <TSystem.h>
 #include <TTree.h>
+
+#include <string>
  
 #include "gtest/gtest.h"
 
@@ -30,3 +32,33 @@ TEST(TChain, GetReadCacheBug)
 
    gSystem->Unlink(filename);
 }
+
+TEST(TChain, GetEntriesManyFiles)
+{
+   const auto treename = "tree";
+   const auto nFiles = 5;
+   TChain chain(treename);
+   Long64_t expected = 0;
+   for (int i = 0; i < nFiles; ++i) {
+      const auto filename = "tchain_getentriesmanyfiles_" + std::to_string(i) + ".root";
+      TFile f(filename.c_str(), "recreate");
+      ASSERT_FALSE(f.IsZombie());
+      TTree t(treename, treename);
+      int x = 0;
+      t.Branch("x", &x);
+      for (x = 0; x < 10 * (i + 1); ++x)
+         t.Fill();
+      expected += t.GetEntries();
+      t.Write();
+      f.Close();
+      chain.Add(filename.c_str());
+   }
+   // The number of entries of all files is read up front, without loading each tree in turn
+   EXPECT_EQ(chain.GetEntries(), expected);
+   EXPECT_EQ(chain.GetTreeOffset()[nFiles], expected);
+   EXPECT_EQ(chain.GetEntry(expected - 1), 4);
+   EXPECT_EQ(chain.GetTreeNumber(), nFiles - 1);
+
+   for (int i = 0; i < nFiles; ++i)
+      gSystem->Unlink(("tchain_getentriesmanyfiles_" + std::to_string(i) + ".root").c_str());
+}
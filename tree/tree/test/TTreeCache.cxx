@@ -0,0 +1,108 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+TEST(TTreeCache, LearnedBranchesProfile)
+{
+   const auto fname = "ttreecache_learnedbranchesprofile.root";
+   const auto profile = "ttreecache_learnedbranchesprofile.txt";
+   {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      int a = 0, b = 0, c = 0;
+      t.Branch("a", &a);
+      t.Branch("b", &b);
+      t.Branch("c", &c);
+      for (int i = 0; i < 1000; ++i) {
+         a = i;
+         b = 2 * i;
+         c = 3 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   {
+      TFile f(fname);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(1000000);
+      int b = 0;
+      t->SetBranchStatus("*", false);
+      t->SetBranchStatus("b", true);
+      t->SetBranchAddress("b", &b);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i)
+         t->GetEntry(i);
+      auto cache = t->GetReadCache(&f);
+      ASSERT_NE(cache, nullptr);
+      EXPECT_FALSE(cache->IsLearning());
+      EXPECT_EQ(cache->GetLearnedBranches(), std::vector<std::string>{"b"});
+      EXPECT_EQ(cache->SaveLearnedBranches(profile), 1);
+   }
+
+   {
+      TFile f(fname);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(1000000);
+      auto cache = t->GetReadCache(&f);
+      ASSERT_NE(cache, nullptr);
+      EXPECT_EQ(cache->LoadLearnedBranches(profile), 1);
+      EXPECT_FALSE(cache->IsLearning());
+      ASSERT_EQ(cache->GetCachedBranches()->GetEntriesFast(), 1);
+      EXPECT_STREQ(cache->GetCachedBranches()->At(0)->GetName(), "b");
+
+      // Branches that are not in the tree are skipped.
+      EXPECT_EQ(cache->SetLearnedBranches({"doesnotexist"}), 0);
+
+      int b = 0;
+      t->SetBranchAddress("b", &b);
+      t->GetEntry(42);
+      EXPECT_EQ(b, 84);
+   }
+
+   gSystem->Unlink(fname);
+   gSystem->Unlink(profile);
+}
+
+TEST(TTreeCache, EntryRangeOfFriends)
+{
+   const auto fname = "ttreecache_entryrangeoffriends.root";
+   const auto ffname = "ttreecache_entryrangeoffriends_friend.root";
+   for (auto name : {fname, ffname}) {
+      TFile f(name, "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      t.Branch("x", &x);
+      for (int i = 0; i < 1000; ++i) {
+         x = i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   {
+      TFile f(fname);
+      TFile ff(ffname);
+      auto t = f.Get<TTree>("t");
+      auto ft = ff.Get<TTree>("t");
+      t->AddFriend(ft, "ft");
+      t->SetCacheSize(1000000);
+      ft->SetCacheSize(1000000);
+      EXPECT_EQ(t->SetCacheEntryRange(100, 200), 0);
+
+      auto cache = t->GetReadCache(&f);
+      auto fcache = ft->GetReadCache(&ff);
+      ASSERT_NE(cache, nullptr);
+      ASSERT_NE(fcache, nullptr);
+      EXPECT_EQ(fcache->GetEntryMin(), 100);
+      EXPECT_EQ(fcache->GetEntryMax(), 200);
+   }
+
+   gSystem->Unlink(fname);
+   gSystem->Unlink(ffname);
+}
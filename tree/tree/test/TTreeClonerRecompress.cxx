@@ -0,0 +1,64 @@
+#include "Compression.h"
+#include "TBranch.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+TEST(TTreeCloner, FastCloneRecompress)
+{
+   const auto inName = "ttreecloner_recompress_in.root";
+   const auto outName = "ttreecloner_recompress_out.root";
+   {
+      TFile f(inName, "RECREATE", "", ROOT::CompressionSettings(ROOT::kZLIB, 1));
+      TTree t("t", "t");
+      t.SetAutoFlush(1000);
+      int x = 0;
+      double y = 0.;
+      t.Branch("x", &x);
+      t.Branch("y", &y);
+      for (int i = 0; i < 10000; ++i) {
+         x = i % 17;
+         y = 0.5 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   {
+      TFile in(inName);
+      auto t = in.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      TFile out(outName, "RECREATE", "", ROOT::CompressionSettings(ROOT::kLZ4, 4));
+      std::unique_ptr<TTree> clone(t->CloneTree(-1, "fast recompress"));
+      ASSERT_NE(clone, nullptr);
+      EXPECT_EQ(clone->GetEntries(), 10000);
+      EXPECT_EQ(clone->GetBranch("x")->GetCompressionSettings(), ROOT::CompressionSettings(ROOT::kLZ4, 4));
+      // The baskets are copied, not rebuilt.
+      EXPECT_EQ(clone->GetBranch("x")->GetWriteBasket(), t->GetBranch("x")->GetWriteBasket());
+      EXPECT_EQ(clone->GetBranch("x")->GetTotBytes(), t->GetBranch("x")->GetTotBytes());
+      EXPECT_NE(clone->GetBranch("y")->GetZipBytes(), t->GetBranch("y")->GetZipBytes());
+      clone->Write();
+   }
+
+   {
+      TFile f(outName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      int x = -1;
+      double y = -1.;
+      t->SetBranchAddress("x", &x);
+      t->SetBranchAddress("y", &y);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         EXPECT_EQ(x, i % 17);
+         EXPECT_DOUBLE_EQ(y, 0.5 * i);
+      }
+   }
+
+   gSystem->Unlink(inName);
+   gSystem->Unlink(outName);
+}
@@ -2,9 +2,12 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TSystem.h"
 
 #include "gtest/gtest.h"
 
+#include <fstream>
+
 class TTreeClusterTest : public ::testing::Test {
 protected:
    virtual void SetUp()
@@ -53,3 +56,40 @@ TEST_F(TTreeClusterTest, countBaskets)
 
    delete file;
 }
+
+TEST(TTreeCluster, HotBranchesOptimizeBaskets)
+{
+   const auto fname = "TTreeClusterTest_hotbranches.root";
+   const auto profile = "TTreeClusterTest_hotbranches.txt";
+   {
+      std::ofstream out(profile);
+      out << "# TTreeCache learned branches\n" << "hot\n";
+   }
+   {
+      TFile file(fname, "RECREATE");
+      TTree tree("tree", "tree");
+      tree.SetAutoFlush(1000);
+      Int_t hot = 0, cold = 0;
+      tree.Branch("hot", &hot);
+      tree.Branch("cold", &cold);
+      for (Int_t i = 0; i < 1000; ++i) {
+         hot = cold = i;
+         tree.Fill();
+      }
+
+      EXPECT_EQ(tree.LoadHotBranches(profile), 1);
+      tree.SetOptimizeBasketsInterval(1);
+      for (Int_t i = 0; i < 1000; ++i) {
+         hot = cold = i;
+         tree.Fill();
+      }
+      // Rebalanced at the second cluster: the hot branch holds a whole cluster in one basket.
+      EXPECT_GE(tree.GetBranch("hot")->GetBasketSize(), Int_t(1000 * sizeof(Int_t)));
+
+      tree.OptimizeBaskets(2000, 1, "");
+      EXPECT_GE(tree.GetBranch("hot")->GetBasketSize(), Int_t(1000 * sizeof(Int_t)));
+      EXPECT_LT(tree.GetBranch("cold")->GetBasketSize(), tree.GetBranch("hot")->GetBasketSize());
+   }
+   gSystem->Unlink(fname);
+   gSystem->Unlink(profile);
+}
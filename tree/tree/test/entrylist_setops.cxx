@@ -0,0 +1,63 @@
+#include "TEntryList.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+
+namespace {
+
+// Entries spread over several blocks, with dense and sparse regions so that the
+// blocks use both the bits and the list representations
+std::set<Long64_t> MakeEntries(int seed)
+{
+   std::set<Long64_t> entries;
+   for (Long64_t i = 0; i < 200000; ++i) {
+      const bool dense = (i / 64000) % 2 == 0;
+      if ((dense && (i * seed) % 3 != 0) || (!dense && (i * seed) % 97 == 0))
+         entries.insert(i);
+   }
+   return entries;
+}
+
+void Fill(TEntryList &elist, const std::set<Long64_t> &entries)
+{
+   for (auto entry : entries)
+      elist.Enter(entry);
+   elist.OptimizeStorage();
+}
+
+void ExpectEntries(TEntryList &elist, const std::set<Long64_t> &expected)
+{
+   ASSERT_EQ(elist.GetN(), Long64_t(expected.size()));
+   Long64_t i = 0;
+   for (auto entry : expected)
+      EXPECT_EQ(elist.GetEntry(i++), entry);
+   for (Long64_t entry = 0; entry < 200000; entry += 7)
+      EXPECT_EQ(elist.Contains(entry) != 0, expected.count(entry) != 0) << entry;
+}
+
+} // anonymous namespace
+
+TEST(TEntryList, AddSubtract)
+{
+   const auto entries1 = MakeEntries(1);
+   const auto entries2 = MakeEntries(5);
+
+   TEntryList elist1("elist1", "elist1"), elist2("elist2", "elist2");
+   Fill(elist1, entries1);
+   Fill(elist2, entries2);
+
+   std::set<Long64_t> difference;
+   for (auto entry : entries1)
+      if (!entries2.count(entry))
+         difference.insert(entry);
+   TEntryList sub(elist1);
+   sub.Subtract(&elist2);
+   ExpectEntries(sub, difference);
+
+   std::set<Long64_t> both(entries1);
+   both.insert(entries2.begin(), entries2.end());
+   TEntryList add(elist1);
+   add.Add(&elist2);
+   ExpectEntries(add, both);
+}
@@ -139,6 +139,16 @@ namespace Detail {
          return fIsaPointer;
       }
 
+      /// Return the entry to be read, in the tree of this proxy.
+      Long64_t GetReadEntry() const {
+         return fDirector->GetReadEntry();
+      }
+
+      /// Return true if `entry` is the entry to be read and has already been read by this proxy.
+      Bool_t IsEntryRead(Long64_t entry) const {
+         return fRead == entry && fDirector->GetReadEntry() == entry;
+      }
+
       Bool_t Read() {
          if (R__unlikely(fDirector == nullptr)) return false;
 
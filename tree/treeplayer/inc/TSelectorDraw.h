@@ -77,6 +77,7 @@ public:
    virtual ~TSelectorDraw();
 
    virtual void      Begin(TTree *tree);
+   virtual Bool_t    CanProcessMT() const;
    virtual Int_t     GetAction() const {return fAction;}
    virtual Bool_t    GetCleanElist() const {return fCleanElist;}
    virtual Int_t     GetDimension() const {return fDimension;}
@@ -112,6 +113,7 @@ public:
    virtual void      ProcessFill(Long64_t entry);
    virtual void      ProcessFillMultiple(Long64_t entry);
    virtual void      ProcessFillObject(Long64_t entry);
+   virtual Long64_t  ProcessMT(Long64_t firstentry, Long64_t nentries);
    virtual void      SetEstimate(Long64_t n);
    virtual UInt_t    SplitNames(const TString &varexp, std::vector<TString> &names);
    virtual void      TakeAction();
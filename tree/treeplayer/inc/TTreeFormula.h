@@ -131,6 +131,8 @@ protected:
 
    RealInstanceCache fRealInstanceCache;              ///<! Cache accelerating the GetRealInstance function
 
+   void                *fJitFunction = nullptr;       ///<! Compiled version of the expression, see JitExpression()
+
    TTreeFormula(const char *name, const char *formula, TTree *tree, const std::vector<std::string>& aliases);
    void Init(const char *name, const char *formula);
    Bool_t      BranchHasMethod(TLeaf* leaf, TBranch* branch, const char* method,const char* params, Long64_t readentry) const;
@@ -149,6 +151,9 @@ protected:
    virtual void*     GetValuePointerFromMethod(Int_t i, TLeaf *leaf) const;
    Int_t             GetRealInstance(Int_t instance, Int_t codeindex);
 
+   Bool_t            EvalJitted(Int_t instance, Double_t &result);
+   void              JitExpression();
+
    void              LoadBranches();
    Bool_t            LoadCurrentDim();
    void              ResetDimensions();
@@ -205,6 +210,9 @@ public:
    virtual char       *PrintValue(Int_t mode, Int_t instance, const char *decform = "9.9") const;
    virtual void        SetAxis(TAxis *axis = nullptr);
            void        SetQuickLoad(Bool_t quick) { fQuickLoad = quick; }
+   static  void        SetJitEnabled(Bool_t enable);
+   static  Bool_t      IsJitEnabled();
+           Bool_t      IsJitted() const { return fJitFunction != nullptr; }
    virtual void        SetTree(TTree *tree) {fTree = tree;}
    virtual void        ResetLoading();
    virtual TTree*      GetTree() const {return fTree;}
@@ -39,9 +39,12 @@ protected:
    TTreeFormula  *fMinorFormula;        ///<! Pointer to minor TreeFormula
    TTreeFormula  *fMajorFormulaParent;  ///<! Pointer to major TreeFormula in Parent tree (if any)
    TTreeFormula  *fMinorFormulaParent;  ///<! Pointer to minor TreeFormula in Parent tree (if any)
+   Long64_t       fLastFriendPos = 0;   ///<! Position of the last pair found by GetEntryNumberFriend
 
    TTreeFormula  *GetMajorFormulaParent(const TTree *parent);
    TTreeFormula  *GetMinorFormulaParent(const TTree *parent);
+   Long64_t       FindValues(Long64_t major, Long64_t minor, Long64_t begin, Long64_t end) const;
+   Long64_t       FindValuesFrom(Long64_t major, Long64_t minor, Long64_t hint) const;
 
 private:
    TTreeIndex(const TTreeIndex&) = delete;            // Not implemented.
@@ -57,6 +60,8 @@ public:
    virtual Long64_t       GetEntryNumberFriend(const TTree *parent);
    virtual Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const;
    virtual Long64_t       GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const;
+   virtual void           GetEntryNumbersWithIndex(Long64_t n, const Long64_t *major, const Long64_t *minor,
+                                                   Long64_t *entries) const;
    virtual Long64_t      *GetIndex()        const {return fIndex;}
    virtual Long64_t      *GetIndexValues()  const {return fIndexValues;}
    virtual Long64_t      *GetIndexValuesMinor()  const;
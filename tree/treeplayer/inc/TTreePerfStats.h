@@ -23,6 +23,8 @@
 
 #include "TVirtualPerfStats.h"
 #include "TString.h"
+#include <map>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -45,6 +47,17 @@ public:
       UInt_t fMissed = {0};      ///<  Number of times the basket was read directly from the file.
    };
 
+   /// I/O and decompression breakdown of one top-level branch
+   struct BranchInfo {
+      Long64_t fEntriesRead = {0};    ///<  Number of entries read by TTree::GetEntry
+      Long64_t fBytesRead = {0};      ///<  Uncompressed bytes returned by TBranch::GetEntry
+      Long64_t fUnzipInputSize = {0}; ///<  Compressed bytes of the decompressed baskets
+      Long64_t fUnzipObjSize = {0};   ///<  Uncompressed bytes of the decompressed baskets
+      Int_t    fNUnzip = {0};         ///<  Number of decompressed baskets
+      Double_t fReadTime = {0};       ///<  Time spent in TBranch::GetEntry, including decompression
+      Double_t fUnzipTime = {0};      ///<  Time spent decompressing baskets
+   };
+
    using BasketList_t = std::vector<std::pair<TBranch*, std::vector<size_t>>>;
 
 protected:
@@ -75,6 +88,7 @@ protected:
 
    std::unordered_map<TBranch*, size_t>  fBranchIndexCache; // Cache the index of the branch in the cache's array.
    std::vector<std::vector<BasketInfo> > fBasketsInfo;      // Details on which baskets was used, cached, 'miss-cached' or read uncached.Browse
+   std::unordered_map<TBranch*, BranchInfo> fBranchInfo;    ///<! Per top-level branch breakdown, filled when reading with TTree::GetEntry
 
    BasketInfo &GetBasketInfo(TBranch *b, size_t basketNumber);
    BasketInfo &GetBasketInfo(size_t bi, size_t basketNumber);
@@ -119,6 +133,8 @@ public:
    virtual void     FileOpenEvent(TFile *, const char *, Double_t) {}
    virtual void     FileReadEvent(TFile *file, Int_t len, Double_t start);
    virtual void     UnzipEvent(TObject *tree, Long64_t pos, Double_t start, Int_t complen, Int_t objlen);
+   virtual void     BranchReadEvent(TBranch *branch, Int_t nbytes, Double_t start);
+   virtual void     BranchUnzipEvent(TBranch *branch, Double_t start, Int_t complen, Int_t objlen);
    virtual void     RateEvent(Double_t , Double_t , Long64_t , Long64_t) {}
 
    virtual void     SaveAs(const char *filename="",Option_t *option="") const;
@@ -142,6 +158,8 @@ public:
    virtual void     SetUnzipTime(Double_t uztime) {fUnzipTime = uztime;}
 
    virtual void     PrintBasketInfo(Option_t *option = "") const;
+   virtual void     PrintBranchInfo() const;
+   std::map<std::string, BranchInfo> GetBranchInfo() const;
    virtual void     SetLoaded(TBranch *b, size_t basketNumber) { ++GetBasketInfo(b, basketNumber).fLoaded; }
    virtual void     SetLoaded(size_t bi, size_t basketNumber) { ++GetBasketInfo(bi, basketNumber).fLoaded; }
    virtual void     SetLoadedMiss(TBranch *b, size_t basketNumber) { ++GetBasketInfo(b, basketNumber).fLoadedMiss; }
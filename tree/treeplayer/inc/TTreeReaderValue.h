@@ -113,7 +113,14 @@ Base class of TTreeReaderValue.
 
       Detail::TBranchProxy* GetProxy() const { return fProxy; }
 
-      void MarkTreeReaderUnavailable() { fTreeReader = nullptr; fSetupStatus = kSetupTreeDestructed; }
+      void MarkTreeReaderUnavailable()
+      {
+         fTreeReader = nullptr;
+         fSetupStatus = kSetupTreeDestructed;
+         fCachedEntry = -1;
+      }
+
+      void *GetAddressAndCache();
 
       /// Stringify the template argument.
       static std::string GetElementTypeName(const std::type_info& ti);
@@ -131,6 +138,8 @@ Base class of TTreeReaderValue.
       std::vector<Long64_t> fStaticClassOffsets;
       typedef EReadStatus (TTreeReaderValueBase::*Read_t)();
       Read_t fProxyReadFunc = &TTreeReaderValueBase::ProxyReadDefaultImpl;      ///<! Pointer to the Read implementation to use.
+      Long64_t fCachedEntry = -1;                 ///<! Tree entry for which fCachedAddress was computed, -1 if none
+      void *fCachedAddress = nullptr;             ///<! Address of the value of fCachedEntry, as returned by Get()
 
       // FIXME: re-introduce once we have ClassDefInline!
       //ClassDef(TTreeReaderValueBase, 0);//Base class for accessors to data via TTreeReader
@@ -160,13 +169,15 @@ public:
    /// The address might also change when the underlying TTree/TFile is switched, e.g. when a TChain switches files.
    T *Get()
    {
+      // Fast path: the value of the entry being read has already been looked up
+      if (fCachedEntry >= 0 && fProxy->IsEntryRead(fCachedEntry))
+         return static_cast<T *>(fCachedAddress);
       if (!fProxy) {
          Error("TTreeReaderValue::Get()", "Value reader not properly initialized, did you call "
                                           "TTreeReader::Set(Next)Entry() or TTreeReader::Next()?");
          return nullptr;
       }
-      void *address = GetAddress(); // Needed to figure out if it's a pointer
-      return fProxy->IsaPointer() ? *(T **)address : (T *)address;
+      return static_cast<T *>(GetAddressAndCache());
    }
 
    /// Return a pointer to the value of the current entry.
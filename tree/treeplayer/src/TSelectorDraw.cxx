@@ -37,6 +37,14 @@ A specialized TSelector for TTree::Draw.
 #include "TColor.h"
 #include "strlcpy.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TTreeProcessorMT.hxx"
+#include "TTreeReader.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#endif
+
 ClassImp(TSelectorDraw);
 
 const Int_t kCustomHistogram = BIT(17);
@@ -1270,6 +1278,248 @@ void TSelectorDraw::ProcessFillMultiple(Long64_t entry)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the remaining entries can be processed in parallel by ProcessMT().
+///
+/// This is the case when implicit multi-threading is enabled and the expression
+/// fills a histogram (1-D, 2-D, profile or 2-D profile) whose binning is known,
+/// either given by the user or already estimated from the first entries. The tree
+/// must be stored in files, without entry list or aliases, and the expressions
+/// must not depend on the entry numbers (Entry$, Entries$...) since they differ
+/// in the trees processed by the tasks.
+
+Bool_t TSelectorDraw::CanProcessMT() const
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || !fTree || !fObject || fObjEval || fTreeElist || fTree->GetUpdate())
+      return kFALSE;
+   if (fTree->GetEntryList() || fTree->GetEventList() || !fTree->GetCurrentFile())
+      return kFALSE;
+   if (fTree->GetListOfAliases() && fTree->GetListOfAliases()->GetEntries())
+      return kFALSE;
+
+   Int_t action = fAction;
+   if (action < 0) {
+      // the limits are still to be estimated, unless the binning is fixed
+      TH1 *hist = dynamic_cast<TH1 *>(fObject);
+      if (!hist || hist->GetXaxis()->CanExtend() || hist->GetYaxis()->CanExtend() || hist->GetZaxis()->CanExtend())
+         return kFALSE;
+      action = -action;
+   }
+   if (action != 1 && action != 2 && action != 4 && action != 23)
+      return kFALSE;
+
+   auto dependsOnEntry = [](const TTreeFormula *formula) {
+      TString expr = formula ? formula->GetTitle() : "";
+      return expr.Contains("Entry$") || expr.Contains("Entries$");
+   };
+   if (dependsOnEntry(fSelect))
+      return kFALSE;
+   for (Int_t i = 0; i < fDimension; ++i) {
+      if (!fVar[i] || dependsOnEntry(fVar[i]))
+         return kFALSE;
+   }
+   return kTRUE;
+#else
+   return kFALSE;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Process nentries entries from firstentry in parallel, see CanProcessMT().
+///
+/// The clusters of the tree are processed by ROOT::TTreeProcessorMT. Each task
+/// compiles its own formulas on the tree it reads and fills the clone of the
+/// histogram belonging to its thread; the clones are merged into the histogram
+/// at the end. Return the number of selected rows, or -1 if the parallel
+/// processing could not be set up and the entries must be processed serially.
+
+Long64_t TSelectorDraw::ProcessMT(Long64_t firstentry, Long64_t nentries)
+{
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TTreeProcessorMT> processor;
+   try {
+      processor = std::make_unique<ROOT::TTreeProcessorMT>(
+         *fTree, 0u, std::make_pair(firstentry, firstentry + nentries));
+   } catch (const std::exception &e) {
+      Warning("ProcessMT", "processing the entries serially: %s", e.what());
+      return -1;
+   }
+
+   if (fAction < 0)
+      fAction = -fAction;
+   const Int_t action = fAction;
+   const Int_t dimension = fDimension;
+   const Double_t weight = fWeight;
+   const Bool_t forceRead = fForceRead;
+   const TString selection = fSelect ? fSelect->GetTitle() : "";
+   std::vector<TString> varexps;
+   for (Int_t i = 0; i < dimension; ++i)
+      varexps.emplace_back(fVar[i]->GetTitle());
+
+   // One clone of the histogram per worker thread, taken by a task for its duration
+   TH1 *hist = (TH1 *)fObject;
+   auto makeClone = [hist]() {
+      TH1 *clone = (TH1 *)hist->Clone();
+      clone->SetDirectory(nullptr);
+      clone->Reset();
+      return std::unique_ptr<TH1>(clone);
+   };
+   std::vector<std::unique_ptr<TH1>> idle;
+   for (UInt_t i = 0; i < ROOT::GetThreadPoolSize(); ++i)
+      idle.emplace_back(makeClone());
+   std::mutex cloneMutex;
+   std::atomic<Long64_t> nselected(0);
+
+   auto processTask = [&](TTreeReader &reader) {
+      TTree *tree = reader.GetTree();
+      const auto range = reader.GetEntriesRange();
+      if (range.first >= range.second || tree->LoadTree(range.first) < 0)
+         return;
+
+      std::unique_ptr<TH1> h;
+      {
+         std::lock_guard<std::mutex> lock(cloneMutex);
+         if (idle.empty()) {
+            R__LOCKGUARD(gROOTMutex);
+            h = makeClone();
+         } else {
+            h = std::move(idle.back());
+            idle.pop_back();
+         }
+      }
+
+      std::unique_ptr<TTreeFormula> select;
+      std::vector<std::unique_ptr<TTreeFormula>> vars;
+      TTreeFormulaManager *manager = nullptr;
+      {
+         R__LOCKGUARD(gROOTMutex);
+         manager = new TTreeFormulaManager(); // owned by the formulas
+         if (selection.Length()) {
+            select = std::make_unique<TTreeFormula>("Selection", selection, tree);
+            select->SetQuickLoad(kTRUE);
+            manager->Add(select.get());
+         }
+         for (Int_t i = 0; i < dimension; ++i) {
+            vars.emplace_back(std::make_unique<TTreeFormula>(TString::Format("Var%i", i + 1), varexps[i], tree));
+            vars.back()->SetQuickLoad(kTRUE);
+            manager->Add(vars.back().get());
+         }
+         manager->Sync();
+      }
+      const Int_t multiplicity = manager->GetMultiplicity();
+      const Bool_t selectMultiple = select && select->GetMultiplicity();
+      Bool_t varMultiple[4];
+      for (Int_t k = 0; k < dimension; ++k)
+         varMultiple[k] = vars[k]->GetMultiplicity();
+
+      auto fill = [&h, action](const Double_t *v, Double_t w) {
+         if (action == 1)
+            h->Fill(v[0], w);
+         else if (action == 2)
+            ((TH2 *)h.get())->Fill(v[1], v[0], w);
+         else if (action == 4)
+            ((TProfile *)h.get())->Fill(v[1], v[0], w);
+         else
+            ((TProfile2D *)h.get())->Fill(v[2], v[1], v[0], w);
+      };
+
+      // Same logic as ProcessFill and ProcessFillMultiple
+      Double_t v0[4], v[4];
+      Long64_t nfill = 0;
+      Int_t treeNumber = -1;
+      for (Long64_t entry = range.first; entry < range.second; ++entry) {
+         if (tree->LoadTree(entry) < 0)
+            break;
+         if (tree->GetTreeNumber() != treeNumber) {
+            treeNumber = tree->GetTreeNumber();
+            if (select)
+               select->UpdateFormulaLeaves();
+            for (auto &var : vars)
+               var->UpdateFormulaLeaves();
+         }
+
+         if (!multiplicity) {
+            if (forceRead && manager->GetNdata() <= 0)
+               continue;
+            Double_t w = weight;
+            if (select) {
+               w *= select->EvalInstance(0);
+               if (!w)
+                  continue;
+            }
+            for (Int_t k = 0; k < dimension; ++k)
+               v[k] = vars[k]->EvalInstance(0);
+            fill(v, w);
+            ++nfill;
+            continue;
+         }
+
+         const Int_t ndata = manager->GetNdata();
+         if (!ndata)
+            continue;
+         const Double_t w = select ? weight * select->EvalInstance(0) : weight;
+         if (!w && !selectMultiple)
+            continue;
+         Bool_t loaded = kFALSE;
+         if (w) {
+            for (Int_t k = 0; k < dimension; ++k)
+               v0[k] = vars[k]->EvalInstance(0);
+            fill(v0, w);
+            ++nfill;
+            loaded = kTRUE;
+         } else {
+            for (auto &var : vars)
+               var->ResetLoading();
+         }
+         Double_t ww = w;
+         for (Int_t i = 1; i < ndata; ++i) {
+            if (selectMultiple) {
+               ww = weight * select->EvalInstance(i);
+               if (ww == 0)
+                  continue;
+               if (!loaded) {
+                  for (Int_t k = 0; k < dimension; ++k)
+                     if (!varMultiple[k])
+                        v0[k] = vars[k]->EvalInstance(0);
+                  loaded = kTRUE;
+               }
+            }
+            for (Int_t k = 0; k < dimension; ++k)
+               v[k] = varMultiple[k] ? vars[k]->EvalInstance(i) : v0[k];
+            fill(v, ww);
+            ++nfill;
+         }
+      }
+      nselected += nfill;
+
+      std::lock_guard<std::mutex> lock(cloneMutex);
+      idle.emplace_back(std::move(h));
+   };
+
+   try {
+      processor->Process(processTask);
+   } catch (const std::exception &e) {
+      Abort(TString::Format("parallel processing failed: %s", e.what()), kAbortProcess);
+      return 0;
+   }
+
+   TList partials;
+   for (auto &clone : idle)
+      if (clone->GetEntries())
+         partials.Add(clone.get());
+   if (partials.GetSize())
+      hist->Merge(&partials);
+
+   fSelectedRows += nselected;
+   return nselected;
+#else
+   (void)firstentry;
+   (void)nentries;
+   return -1;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Called in the entry loop for all entries accepted by Select.
 /// Case where the only variable returns an object (or pointer to).
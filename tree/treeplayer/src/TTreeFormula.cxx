@@ -44,6 +44,7 @@
 #include "strlcpy.h"
 #include "snprintf.h"
 #include "TEntryList.h"
+#include "TEnv.h"
 
 #include <cctype>
 #include <cstdio>
@@ -51,6 +52,10 @@
 #include <cstdlib>
 #include <typeinfo>
 #include <algorithm>
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 const Int_t kMaxLen     = 1024;
 
@@ -315,6 +320,8 @@ void TTreeFormula::Init(const char*name, const char* expression)
 
    }
 
+   JitExpression();
+
    if(savedir) savedir->cd();
 }
 
@@ -3935,6 +3942,227 @@ template<> inline LongDouble_t TTreeFormula::GetConstant(Int_t k) {
 }
 template<> inline Long64_t TTreeFormula::GetConstant(Int_t k) { return (Long64_t)GetConstant<LongDouble_t>(k); }
 
+namespace {
+
+/// Functions declared once in the interpreter for the compiled expressions: they
+/// reproduce the special cases (domain errors, division by zero) of EvalInstance.
+const char *kJitPreamble = R"CODE(
+#include "TMath.h"
+#include <algorithm>
+#include <cmath>
+namespace R__TTreeFormulaJit {
+inline double Div(double a, double b) { return b == 0 ? 0 : a / b; }
+inline double Mod(double a, double b) { return double(Long64_t(a) % Long64_t(b)); }
+inline double Tan(double x) { return TMath::Cos(x) == 0 ? 0 : TMath::Tan(x); }
+inline double ACos(double x) { return TMath::Abs(x) > 1 ? 0 : TMath::ACos(x); }
+inline double ASin(double x) { return TMath::Abs(x) > 1 ? 0 : TMath::ASin(x); }
+inline double TanH(double x) { return TMath::CosH(x) == 0 ? 0 : TMath::TanH(x); }
+inline double ACosH(double x) { return x < 1 ? 0 : TMath::ACosH(x); }
+inline double ATanH(double x) { return TMath::Abs(x) > 1 ? 0 : TMath::ATanH(x); }
+inline double Log(double x) { return x > 0 ? TMath::Log(x) : 0; }
+inline double Log10(double x) { return x > 0 ? TMath::Log10(x) : 0; }
+inline double Exp(double x) { return x < -700 ? 0 : TMath::Exp(x > 700 ? 700 : x); }
+inline double Sign(double x) { return x < 0 ? -1 : 1; }
+}
+)CODE";
+
+std::atomic<Bool_t> &JitEnabled()
+{
+   static std::atomic<Bool_t> enabled(gEnv->GetValue("TreeFormula.Jit", 0) != 0);
+   return enabled;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the compilation of the expressions of the TTreeFormula
+/// created afterwards, see JitExpression(). The default is given by the rootrc
+/// entry `TreeFormula.Jit`.
+
+void TTreeFormula::SetJitEnabled(Bool_t enable)
+{
+   JitEnabled() = enable;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return whether the expressions of new TTreeFormula are compiled.
+
+Bool_t TTreeFormula::IsJitEnabled()
+{
+   return JitEnabled();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the expression into a C++ function compiled by the interpreter.
+///
+/// Only expressions made of constants, numeric leaves or data members (possibly
+/// indexed arrays), arithmetic, comparison, logical and bitwise operators and
+/// the mathematical functions of TFormula are translated. Strings, aliases,
+/// ternary operators, method and function calls, TCutG and special variables
+/// like Entry$ are left to the interpreted evaluation, as are the expressions
+/// made of a single operand. The function takes the values of all the operands
+/// of one instance and is shared by the formulas with the same expression.
+
+void TTreeFormula::JitExpression()
+{
+   fJitFunction = nullptr;
+   if (!IsJitEnabled() || fNoper < 2 || fNstring > 0 || TestBit(kIsCharacter) || !gInterpreter)
+      return;
+   for (Int_t code = 0; code < fNcodes; ++code) {
+      if (fCodes[code] < 0 || (fLookupType[code] != kDirect && fLookupType[code] != kDataMember))
+         return;
+   }
+
+   std::vector<std::string> stack;
+   auto unary = [&stack](const char *prefix, const char *suffix) {
+      if (stack.empty())
+         return kFALSE;
+      stack.back() = prefix + stack.back() + suffix;
+      return kTRUE;
+   };
+   auto binary = [&stack](const char *prefix, const char *middle, const char *suffix) {
+      if (stack.size() < 2)
+         return kFALSE;
+      std::string right = std::move(stack.back());
+      stack.pop_back();
+      stack.back() = prefix + stack.back() + middle + right + suffix;
+      return kTRUE;
+   };
+
+   for (Int_t i = 0; i < fNoper; ++i) {
+      const Int_t oper = GetOper()[i];
+      const Int_t action = oper >> kTFOperShift;
+      const Int_t param = oper & kTFOperMask;
+      Bool_t ok = kTRUE;
+      switch (action) {
+         case kEnd: i = fNoper; break;
+         case kConstant: {
+            const Double_t value = GetConstant<Double_t>(param);
+            if (!std::isfinite(value))
+               return;
+            stack.emplace_back(TString::Format("%.17g", value).Data());
+            break;
+         }
+         case kDefinedVariable: stack.emplace_back("v[" + std::to_string(param) + "]"); break;
+         case kBoolOptimize: break; // both sides are always evaluated by the compiled function
+         case kpi: stack.emplace_back("TMath::Pi()"); break;
+
+         case kAdd: ok = binary("(", " + ", ")"); break;
+         case kSubstract: ok = binary("(", " - ", ")"); break;
+         case kMultiply: ok = binary("(", " * ", ")"); break;
+         case kDivide: ok = binary("R__TTreeFormulaJit::Div(", ", ", ")"); break;
+         case kModulo: ok = binary("R__TTreeFormulaJit::Mod(", ", ", ")"); break;
+         case katan2: ok = binary("TMath::ATan2(", ", ", ")"); break;
+         case kfmod: ok = binary("std::fmod(", ", ", ")"); break;
+         case kpow: ok = binary("TMath::Power(", ", ", ")"); break;
+         case kmin: ok = binary("std::min<double>(", ", ", ")"); break;
+         case kmax: ok = binary("std::max<double>(", ", ", ")"); break;
+
+         case kAnd: ok = binary("double((", ") != 0 && (", ") != 0)"); break;
+         case kOr: ok = binary("double((", ") != 0 || (", ") != 0)"); break;
+         case kEqual: ok = binary("double(", " == ", ")"); break;
+         case kNotEqual: ok = binary("double(", " != ", ")"); break;
+         case kLess: ok = binary("double(", " < ", ")"); break;
+         case kGreater: ok = binary("double(", " > ", ")"); break;
+         case kLessThan: ok = binary("double(", " <= ", ")"); break;
+         case kGreaterThan: ok = binary("double(", " >= ", ")"); break;
+         case kBitAnd: ok = binary("double(ULong64_t(", ") & ULong64_t(", "))"); break;
+         case kBitOr: ok = binary("double(ULong64_t(", ") | ULong64_t(", "))"); break;
+         case kLeftShift: ok = binary("double(ULong64_t(", ") << ULong64_t(", "))"); break;
+         case kRightShift: ok = binary("double(ULong64_t(", ") >> ULong64_t(", "))"); break;
+
+         case kNot: ok = unary("double((", ") == 0)"); break;
+         case kcos: ok = unary("TMath::Cos(", ")"); break;
+         case ksin: ok = unary("TMath::Sin(", ")"); break;
+         case ktan: ok = unary("R__TTreeFormulaJit::Tan(", ")"); break;
+         case kacos: ok = unary("R__TTreeFormulaJit::ACos(", ")"); break;
+         case kasin: ok = unary("R__TTreeFormulaJit::ASin(", ")"); break;
+         case katan: ok = unary("TMath::ATan(", ")"); break;
+         case kcosh: ok = unary("TMath::CosH(", ")"); break;
+         case ksinh: ok = unary("TMath::SinH(", ")"); break;
+         case ktanh: ok = unary("R__TTreeFormulaJit::TanH(", ")"); break;
+         case kacosh: ok = unary("R__TTreeFormulaJit::ACosH(", ")"); break;
+         case kasinh: ok = unary("TMath::ASinH(", ")"); break;
+         case katanh: ok = unary("R__TTreeFormulaJit::ATanH(", ")"); break;
+         case ksq: ok = unary("TMath::Sq(", ")"); break;
+         case ksqrt: ok = unary("TMath::Sqrt(TMath::Abs(", "))"); break;
+         case klog: ok = unary("R__TTreeFormulaJit::Log(", ")"); break;
+         case kexp: ok = unary("R__TTreeFormulaJit::Exp(", ")"); break;
+         case klog10: ok = unary("R__TTreeFormulaJit::Log10(", ")"); break;
+         case kabs: ok = unary("TMath::Abs(", ")"); break;
+         case ksign: ok = unary("R__TTreeFormulaJit::Sign(", ")"); break;
+         case kint: ok = unary("double(Long64_t(", "))"); break;
+         case kSignInv: ok = unary("(-", ")"); break;
+
+         default: return;
+      }
+      if (!ok)
+         return;
+   }
+   if (stack.size() != 1)
+      return;
+
+   R__LOCKGUARD(gROOTMutex);
+   static std::unordered_map<std::string, void *> jitted;
+   static Bool_t preambleDeclared = gInterpreter->Declare(kJitPreamble);
+   if (!preambleDeclared)
+      return;
+
+   const std::string &body = stack.back();
+   auto it = jitted.find(body);
+   if (it == jitted.end()) {
+      const std::string funcName = "Expr" + std::to_string(jitted.size());
+      const std::string decl =
+         "namespace R__TTreeFormulaJit { double " + funcName + "(const double *v) { return " + body + "; } }";
+      void *func = nullptr;
+      if (gInterpreter->Declare(decl.c_str()))
+         func = reinterpret_cast<void *>(gInterpreter->Calc(("(Longptr_t)&R__TTreeFormulaJit::" + funcName).c_str()));
+      it = jitted.emplace(body, func).first;
+   }
+   fJitFunction = it->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the compiled expression for the given instance.
+///
+/// The operands are loaded and read before evaluating the function, instead of
+/// on demand. If one of them does not have this instance, the boolean
+/// optimization of the interpreted evaluation may not need it: return false to
+/// let EvalInstance take over.
+
+Bool_t TTreeFormula::EvalJitted(Int_t instance, Double_t &result)
+{
+   const Bool_t willLoad = (instance == 0 || fNeedLoading);
+   Double_t values[kMAXCODES];
+   for (Int_t code = 0; code < fNcodes; ++code) {
+      TLeaf *leaf = (TLeaf *)fLeaves.UncheckedAt(code);
+      const Int_t real_instance = GetRealInstance(instance, code);
+      if (willLoad || fDidBooleanOptimization) {
+         TBranch *branch = (TBranch *)fBranches.UncheckedAt(code);
+         if (branch) {
+            R__LoadBranch(branch, branch->GetTree()->GetReadEntry(), fQuickLoad);
+         } else {
+            branch = leaf->GetBranch();
+            Long64_t treeEntry = branch->GetTree()->GetReadEntry();
+            if (branch->GetReadEntry() != treeEntry)
+               branch->GetEntry(treeEntry);
+         }
+      }
+      if (real_instance >= fNdata[code])
+         return kFALSE;
+      if (fLookupType[code] == kDirect)
+         values[code] = leaf->GetTypedValue<Double_t>(real_instance);
+      else
+         values[code] = ((TFormLeafInfo *)fDataMembers.UncheckedAt(code))->GetTypedValue<Double_t>(leaf, real_instance);
+   }
+   if (willLoad) {
+      fNeedLoading = kFALSE;
+      fDidBooleanOptimization = kFALSE;
+   }
+   result = reinterpret_cast<Double_t (*)(const Double_t *)>(fJitFunction)(values);
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Evaluate this treeformula.
 
@@ -4006,6 +4234,12 @@ T TTreeFormula::EvalInstance(Int_t instance, const char *stringStackArg[])
       }
    }
 
+   if (fJitFunction && std::is_same<T, Double_t>::value && !stringStackArg) {
+      Double_t result;
+      if (EvalJitted(instance, result))
+         return result;
+   }
+
    T tab[kMAXFOUND];
    const Int_t kMAXSTRINGFOUND = 10;
    const char *stringStackLocal[kMAXSTRINGFOUND];
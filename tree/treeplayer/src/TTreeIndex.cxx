@@ -19,6 +19,15 @@ A Tree Index with majorname and minorname.
 #include "TTree.h"
 #include "TBuffer.h"
 #include "TMath.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <vector>
 
 ClassImp(TTreeIndex);
 
@@ -30,7 +39,7 @@ struct IndexSortComparator {
   {}
 
    template<typename Index>
-   bool operator()(Index i1, Index i2) {
+   bool operator()(Index i1, Index i2) const {
       if( *(fValMajor + i1) == *(fValMajor + i2) )
          return *(fValMinor + i1) < *(fValMinor + i2);
       else
@@ -42,6 +51,45 @@ struct IndexSortComparator {
   Long64_t *fValMajor, *fValMinor;
 };
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sort the n entry numbers in index according to comp.
+///
+/// With implicit multi-threading enabled, large indices are sorted in parallel:
+/// chunks are sorted by different threads, then merged pairwise.
+
+void SortIndex(Long64_t *index, Long64_t n, const IndexSortComparator &comp)
+{
+#ifdef R__USE_IMT
+   const Long64_t kMinChunkSize = 1 << 20;
+   if (ROOT::IsImplicitMTEnabled() && n >= 2 * kMinChunkSize) {
+      ROOT::TThreadExecutor pool;
+      const UInt_t nchunks = std::min<Long64_t>(pool.GetPoolSize(), n / kMinChunkSize);
+      std::vector<Long64_t> bounds(nchunks + 1);
+      for (UInt_t i = 0; i <= nchunks; ++i)
+         bounds[i] = n * i / nchunks;
+      pool.Foreach([&](UInt_t i) { std::sort(index + bounds[i], index + bounds[i + 1], comp); },
+                   ROOT::TSeqU(nchunks));
+      for (UInt_t width = 1; width < nchunks; width *= 2) {
+         std::vector<UInt_t> firsts;
+         for (UInt_t i = 0; i + width < nchunks; i += 2 * width)
+            firsts.emplace_back(i);
+         pool.Foreach(
+            [&](UInt_t i) {
+               std::inplace_merge(index + bounds[i], index + bounds[i + width],
+                                  index + bounds[std::min(i + 2 * width, nchunks)], comp);
+            },
+            firsts);
+      }
+      return;
+   }
+#endif
+   std::sort(index, index + n, comp);
+}
+
+} // anonymous namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor for TTreeIndex
@@ -201,16 +249,14 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    }
    fIndex = new Long64_t[fN];
    for(i = 0; i < fN; i++) { fIndex[i] = i; }
-   std::sort(fIndex, fIndex + fN, IndexSortComparator(tmp_major, tmp_minor) );
+   SortIndex(fIndex, fN, IndexSortComparator(tmp_major, tmp_minor));
    //TMath::Sort(fN,w,fIndex,0);
+   // Release each temporary array as soon as it is sorted to limit the peak memory
    fIndexValues = new Long64_t[fN];
-   fIndexValuesMinor = new Long64_t[fN];
-   for (i=0;i<fN;i++) {
-      fIndexValues[i] = tmp_major[fIndex[i]];
-      fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
-   }
-
+   for (i=0;i<fN;i++) fIndexValues[i] = tmp_major[fIndex[i]];
    delete [] tmp_major;
+   fIndexValuesMinor = new Long64_t[fN];
+   for (i=0;i<fN;i++) fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
    delete [] tmp_minor;
    fTree->LoadTree(oldEntry);
 }
@@ -290,7 +336,7 @@ void TTreeIndex::Append(const TVirtualIndex *add, Bool_t delaySort )
       Long64_t *conv = new Long64_t[fN];
 
       for(Long64_t i = 0; i < fN; i++) { conv[i] = i; }
-      std::sort(conv, conv+fN, IndexSortComparator(addValues, addValues2) );
+      SortIndex(conv, fN, IndexSortComparator(addValues, addValues2));
       //Long64_t *w = fIndexValues;
       //TMath::Sort(fN,w,conv,0);
 
@@ -367,7 +413,14 @@ Long64_t TTreeIndex::GetEntryNumberFriend(const TTree *parent)
    // we check if this pair exist in the index.
    // if yes, we return the corresponding entry number
    // if not the function returns -1
-   return fTree->GetEntryNumberWithIndex(majorv,minorv);
+   if (fTree->GetTreeIndex() != this || fN == 0)
+      return fTree->GetEntryNumberWithIndex(majorv,minorv);
+   // The parent entries are usually read in the order of the index: start the
+   // search from the previous match.
+   fLastFriendPos = FindValuesFrom(majorv, minorv, fLastFriendPos);
+   if (fLastFriendPos < fN && fIndexValues[fLastFriendPos] == majorv && fIndexValuesMinor[fLastFriendPos] == minorv)
+      return fIndex[fLastFriendPos];
+   return -1;
 }
 
 
@@ -378,7 +431,15 @@ Long64_t TTreeIndex::GetEntryNumberFriend(const TTree *parent)
 
 Long64_t TTreeIndex::FindValues(Long64_t major, Long64_t minor) const
 {
-   Long64_t mid, step, pos = 0, count = fN;
+   return FindValues(major, minor, 0, fN);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Same as FindValues(major, minor), searching only the positions in [begin, end).
+
+Long64_t TTreeIndex::FindValues(Long64_t major, Long64_t minor, Long64_t begin, Long64_t end) const
+{
+   Long64_t mid, step, pos = begin, count = end - begin;
    // find lower bound using bisection
    while( count > 0 ) {
       step = count / 2;
@@ -395,6 +456,37 @@ Long64_t TTreeIndex::FindValues(Long64_t major, Long64_t minor) const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Same as FindValues(major, minor), with an exponential search starting from the
+/// position hint: the cost grows with the logarithm of the distance between the
+/// hint and the result instead of the logarithm of the index size.
+
+Long64_t TTreeIndex::FindValuesFrom(Long64_t major, Long64_t minor, Long64_t hint) const
+{
+   if (hint < 0 || hint >= fN)
+      return FindValues(major, minor);
+   auto less = [this, major, minor](Long64_t pos) {
+      return fIndexValues[pos] < major || (fIndexValues[pos] == major && fIndexValuesMinor[pos] < minor);
+   };
+   Long64_t step = 1;
+   if (less(hint)) {
+      // the result is after hint
+      Long64_t begin = hint + 1;
+      while (begin + step <= fN && less(begin + step - 1)) {
+         begin += step;
+         step *= 2;
+      }
+      return FindValues(major, minor, begin, std::min(begin + step, fN));
+   }
+   // the result is at or before hint
+   Long64_t end = hint;
+   while (end - step >= 0 && !less(end - step)) {
+      end -= step;
+      step *= 2;
+   }
+   return FindValues(major, minor, std::max(end - step, 0LL), end);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return entry number corresponding to major and minor number.
 /// Note that this function returns only the entry number, not the data
@@ -447,6 +539,31 @@ Long64_t TTreeIndex::GetEntryNumberWithIndex(Long64_t major, Long64_t minor) con
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill entries[i] with the entry number corresponding to major[i] and minor[i],
+/// or -1 if there is none, for i in [0, n).
+///
+/// Each search starts from the position of the previous pair, so looking up pairs
+/// sorted like the index (e.g. the run and event numbers of another tree written
+/// in the same order) costs much less than n independent binary searches.
+
+void TTreeIndex::GetEntryNumbersWithIndex(Long64_t n, const Long64_t *major, const Long64_t *minor,
+                                          Long64_t *entries) const
+{
+   Long64_t pos = 0;
+   for (Long64_t i = 0; i < n; ++i) {
+      if (fN == 0) {
+         entries[i] = -1;
+         continue;
+      }
+      pos = FindValuesFrom(major[i], minor[i], std::min(pos, fN - 1));
+      if (pos < fN && fIndexValues[pos] == major[i] && fIndexValuesMinor[pos] == minor[i])
+         entries[i] = fIndex[pos];
+      else
+         entries[i] = -1;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Long64_t* TTreeIndex::GetIndexValuesMinor()  const
@@ -333,6 +333,11 @@ Long64_t TTreePlayer::DrawScript(const char* wrapperPrefix,
 /// Draw expression varexp for specified entries that matches the selection.
 /// Returns -1 in case of error or number of selected events in case of success.
 ///
+/// When implicit multi-threading is enabled (ROOT::EnableImplicitMT()), histograms
+/// and profiles are filled in parallel over the clusters of the tree once their
+/// binning is known, see TSelectorDraw::CanProcessMT(). Other drawings, like the
+/// scatter plots, are done serially.
+///
 /// See the documentation of TTree::Draw for the complete details.
 
 Long64_t TTreePlayer::DrawSelect(const char *varexp0, const char *selection, Option_t *option,Long64_t nentries, Long64_t firstentry)
@@ -2273,6 +2278,8 @@ Long64_t TTreePlayer::Process(TSelector *selector,Option_t *option, Long64_t nen
       Long64_t entry, entryNumber, localEntry;
 
       Bool_t useCutFill = selector->Version() == 0;
+      Bool_t drawMT = useCutFill && selector == fSelector;
+      Int_t drawAction = 0;
 
       // force the first monitoring info
       if (gMonitoringWriter)
@@ -2285,6 +2292,13 @@ Long64_t TTreePlayer::Process(TSelector *selector,Option_t *option, Long64_t nen
       UpdateFormulaLeaves();
 
       for (entry=firstentry;entry<firstentry+nentries;entry++) {
+         if (drawMT && fSelector->GetAction() != drawAction) {
+            // TTree::Draw: the remaining entries can be processed in parallel once the
+            // binning of the histogram is known
+            drawAction = fSelector->GetAction();
+            if (fSelector->CanProcessMT() && fSelector->ProcessMT(entry, firstentry + nentries - entry) >= 0)
+               break;
+         }
          entryNumber = fTree->GetEntryNumber(entry);
          if (entryNumber < 0) break;
          if (timer && timer->ProcessEvents()) break;
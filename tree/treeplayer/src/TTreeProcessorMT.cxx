@@ -22,17 +22,63 @@ The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the
 each corresponding to a cluster in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
 objects.
+
+Ranges are made of whole clusters, fused together when files have many small clusters. A range
+that is much larger than the others (e.g. a file with few, huge clusters) is only split in smaller
+chunks when it is about to be processed while some of the workers are idle: the chunks are then
+processed by nested tasks that the idle workers steal, which avoids leaving cores unused at the
+tail of the processing while reading whole clusters in one go whenever possible.
 */
 
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <atomic>
+
 using namespace ROOT;
 
 namespace {
 
 using EntryRange = std::pair<Long64_t, Long64_t>;
 
+/// Number of files whose metadata MakeClusters() requests at once
+constexpr std::size_t kMetadataBatchSize = 64;
+
+/// Ranges are never split in chunks smaller than this number of entries
+constexpr Long64_t kMinEntriesPerChunk = 1000;
+
+/// Largest number of entries that a task should process, given the ranges of a file and the wanted number of tasks.
+static Long64_t GetMaxEntriesPerTask(const std::vector<EntryRange> &ranges, unsigned int maxTasksPerFile)
+{
+   Long64_t nEntries = 0;
+   for (const auto &r : ranges)
+      nEntries += r.second - r.first;
+   const Long64_t nTasks = std::max(maxTasksPerFile, 1u);
+   return std::max((nEntries + nTasks - 1) / nTasks, kMinEntriesPerChunk);
+}
+
+/// Split range in chunks of at most maxEntries entries.
+static std::vector<EntryRange> SplitRange(const EntryRange &range, Long64_t maxEntries)
+{
+   const auto nEntries = range.second - range.first;
+   const auto nChunks = (nEntries + maxEntries - 1) / maxEntries;
+   std::vector<EntryRange> chunks;
+   chunks.reserve(nChunks);
+   // distribute the remainder evenly onto the first chunks, as MakeClusters does when fusing clusters
+   const auto chunkSize = nEntries / nChunks;
+   auto remainder = nEntries % nChunks;
+   for (auto start = range.first; start < range.second;) {
+      auto end = start + chunkSize;
+      if (remainder > 0) {
+         ++end;
+         --remainder;
+      }
+      chunks.emplace_back(start, end);
+      start = end;
+   }
+   return chunks;
+}
+
 // note that this routine assumes global entry numbers
 static bool ClustersAreSortedAndContiguous(const std::vector<std::vector<EntryRange>> &cls)
 {
@@ -130,41 +176,38 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
-   TDirectory::TContext c;
    const auto nFileNames = fileNames.size();
    std::vector<std::vector<EntryRange>> clustersPerFile;
    std::vector<Long64_t> entriesPerFile;
    entriesPerFile.reserve(nFileNames);
    Long64_t offset = 0ll;
    bool rangeEndReached = false; // flag to break the outer loop
+   // The metadata of the files is fetched in batches, so that opening the files overlaps while we can still
+   // stop early if the end of the requested range falls into one of the first files.
+   std::vector<ROOT::Internal::TreeUtils::RTreeMetadata> metadata;
    for (auto i = 0u; i < nFileNames && !rangeEndReached; ++i) {
       const auto &fileName = fileNames[i];
       const auto &treeName = treeNames[i];
 
-      std::unique_ptr<TFile> f(TFile::Open(
-         fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
-      if (!f || f->IsZombie()) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
+      const auto batchIdx = i % kMetadataBatchSize;
+      if (batchIdx == 0) {
+         const auto batchEnd = std::min<std::size_t>(nFileNames, i + kMetadataBatchSize);
+         metadata = ROOT::Internal::TreeUtils::GetTreeMetadata(
+            std::vector<std::string>(fileNames.begin() + i, fileNames.begin() + batchEnd),
+            std::vector<std::string>(treeNames.begin() + i, treeNames.begin() + batchEnd), /*withClusters=*/true);
       }
-      auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
+      const auto &thisMetadata = metadata[batchIdx];
+      if (thisMetadata.fEntries < 0)
+         throw std::runtime_error("TTreeProcessorMT::Process: " + thisMetadata.fError);
 
-      if (!t) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
-                          "\" from file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
-      }
-
-      // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
-      t->ResetBit(kMustCleanup);
-      ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
-      auto clusterIter = t->GetClusterIterator(0);
-      Long64_t clusterStart = 0ll, clusterEnd = 0ll;
-      const Long64_t entries = t->GetEntries();
+      const Long64_t entries = thisMetadata.fEntries;
       // Iterate over the clusters in the current file
       std::vector<EntryRange> entryRanges;
-      while ((clusterStart = clusterIter()) < entries && !rangeEndReached) {
-         clusterEnd = clusterIter.GetNextEntry();
+      for (const auto &cluster : thisMetadata.fClusters) {
+         if (rangeEndReached)
+            break;
+         const auto clusterStart = cluster.first;
+         const auto clusterEnd = cluster.second;
          // Currently, if a user specified a range, the clusters will be only globally obtained
          // Assume that there are 3 files with entries: [0, 100], [0, 150], [0, 200] (in this order)
          // Since the cluster boundaries are obtained sequentially, applying the offsets, the boundaries
@@ -251,48 +294,40 @@ static std::vector<std::vector<Long64_t>> GetFriendEntries(const ROOT::TreeUtils
    const auto &friendFileNames = friendInfo.fFriendFileNames;
    const auto &friendChainSubNames = friendInfo.fFriendChainSubNames;
 
-   std::vector<std::vector<Long64_t>> friendEntries;
+   // Collect the files and tree names of all friends, so that their metadata is fetched concurrently.
+   // If a friend has chain sub names, it means it's a TChain and thisFriendChainSubNames[fileidx] stores
+   // the name of the subtree in the corresponding file. Otherwise it's a TTree and we can safely use the
+   // friend name as the name of the tree to retrieve from each file.
+   std::vector<std::string> allFileNames;
+   std::vector<std::string> allTreeNames;
    const auto nFriends = friendNames.size();
    for (auto i = 0u; i < nFriends; ++i) {
-      std::vector<Long64_t> nEntries;
-      const auto &thisFriendName = friendNames[i].first;
       const auto &thisFriendFiles = friendFileNames[i];
       const auto &thisFriendChainSubNames = friendChainSubNames[i];
-      // If this friend has chain sub names, it means it's a TChain.
-      // In this case, we need to traverse all files that make up the TChain,
-      // retrieve the correct sub tree from each file and store the number of
-      // entries for that sub tree.
-      if (!thisFriendChainSubNames.empty()) {
-         // Traverse together filenames and respective treenames
-         for (auto fileidx = 0u; fileidx < thisFriendFiles.size(); ++fileidx) {
-            std::unique_ptr<TFile> curfile(
-               TFile::Open(thisFriendFiles[fileidx].c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
-            if (!curfile || curfile->IsZombie())
-               throw std::runtime_error("TTreeProcessorMT::GetFriendEntries: Could not open file \"" +
-                                        thisFriendFiles[fileidx] + "\"");
-            // thisFriendChainSubNames[fileidx] stores the name of the current
-            // subtree in the TChain stored in the current file.
-            TTree *curtree = curfile->Get<TTree>(thisFriendChainSubNames[fileidx].c_str());
-            if (!curtree)
-               throw std::runtime_error("TTreeProcessorMT::GetFriendEntries: Could not retrieve TTree \"" +
-                                        thisFriendChainSubNames[fileidx] + "\" from file \"" +
-                                        thisFriendFiles[fileidx] + "\"");
-            nEntries.emplace_back(curtree->GetEntries());
-         }
-         // Otherwise, if there are no sub names for the current friend, it means
-         // it's a TTree. We can safely use `thisFriendName` as the name of the tree
-         // to retrieve from the file in `thisFriendFiles`
-      } else {
-         for (const auto &fname : thisFriendFiles) {
-            std::unique_ptr<TFile> f(TFile::Open(fname.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
-            if (!f || f->IsZombie())
-               throw std::runtime_error("TTreeProcessorMT::GetFriendEntries: Could not open file \"" + fname + "\"");
-            TTree *t = f->Get<TTree>(thisFriendName.c_str());
-            if (!t)
-               throw std::runtime_error("TTreeProcessorMT::GetFriendEntries: Could not retrieve TTree \"" +
-                                        thisFriendName + "\" from file \"" + fname + "\"");
-            nEntries.emplace_back(t->GetEntries());
+      for (auto fileidx = 0u; fileidx < thisFriendFiles.size(); ++fileidx) {
+         allFileNames.emplace_back(thisFriendFiles[fileidx]);
+         allTreeNames.emplace_back(thisFriendChainSubNames.empty() ? friendNames[i].first
+                                                                   : thisFriendChainSubNames[fileidx]);
+      }
+   }
+   const auto metadata = ROOT::Internal::TreeUtils::GetTreeMetadata(allFileNames, allTreeNames);
+
+   std::vector<std::vector<Long64_t>> friendEntries;
+   std::size_t metadataIdx = 0;
+   for (auto i = 0u; i < nFriends; ++i) {
+      std::vector<Long64_t> nEntries;
+      for (auto fileidx = 0u; fileidx < friendFileNames[i].size(); ++fileidx, ++metadataIdx) {
+         const auto &thisMetadata = metadata[metadataIdx];
+         if (thisMetadata.fEntries >= 0) {
+            nEntries.emplace_back(thisMetadata.fEntries);
+            continue;
          }
+         const auto &fileName = allFileNames[metadataIdx];
+         // Keep the messages of this function, the error of GetTreeMetadata() tells which step failed
+         if (thisMetadata.fError.rfind("an error occurred while opening file", 0) == 0)
+            throw std::runtime_error("TTreeProcessorMT::GetFriendEntries: Could not open file \"" + fileName + "\"");
+         throw std::runtime_error("TTreeProcessorMT::GetFriendEntries: Could not retrieve TTree \"" +
+                                  allTreeNames[metadataIdx] + "\" from file \"" + fileName + "\"");
       }
       // Store the vector with entries for each file in the current tree/chain.
       friendEntries.emplace_back(std::move(nEntries));
@@ -559,13 +594,35 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
    }
 
+   // The number of entries of the friends is the same for all clusters, retrieve it only once
+   const auto friendEntries =
+      hasFriends ? GetFriendEntries(fFriendInfo) : std::vector<std::vector<Long64_t>>{};
+
+   // Number of tasks currently running func: if it is smaller than the number of workers, some of them are idle
+   const auto poolSize = fPool.GetPoolSize();
+   std::atomic<unsigned int> nBusyTasks{0u};
+
+   // Process a range with processChunk, splitting it first if it is too large and there are idle workers
+   auto processRange = [&](const EntryRange &range, Long64_t maxEntries,
+                           const std::function<void(const EntryRange &)> &processChunk) {
+      if (poolSize > 1 && range.second - range.first > maxEntries && nBusyTasks.load() < poolSize) {
+         fPool.Foreach(processChunk, SplitRange(range, maxEntries));
+         return;
+      }
+      processChunk(range);
+   };
+
    // Per-file processing in case we retrieved all cluster info upfront
    auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
-      auto processCluster = [&](const EntryRange &c) {
+      auto processChunk = [&](const EntryRange &c) {
          auto r = fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList,
-                                           allEntries, GetFriendEntries(fFriendInfo));
+                                           allEntries, friendEntries);
+         ++nBusyTasks;
          func(*r);
+         --nBusyTasks;
       };
+      const auto maxEntries = GetMaxEntriesPerTask(allClusters[fileIdx], maxTasksPerFile);
+      auto processCluster = [&](const EntryRange &c) { processRange(c, maxEntries, processChunk); };
       fPool.Foreach(processCluster, allClusters[fileIdx]);
    };
 
@@ -577,11 +634,15 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
       const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
       const auto &clusters = clustersAndEntries.first[0];
       const auto &entries = clustersAndEntries.second[0];
-      auto processCluster = [&](const EntryRange &c) {
+      auto processChunk = [&](const EntryRange &c) {
          auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries},
                                            std::vector<std::vector<Long64_t>>{});
+         ++nBusyTasks;
          func(*r);
+         --nBusyTasks;
       };
+      const auto maxEntries = GetMaxEntriesPerTask(clusters, maxTasksPerFile);
+      auto processCluster = [&](const EntryRange &c) { processRange(c, maxEntries, processChunk); };
       fPool.Foreach(processCluster, clusters);
    };
 
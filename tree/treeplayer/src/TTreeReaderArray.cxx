@@ -11,6 +11,7 @@
 
 #include "TTreeReaderArray.h"
 
+#include "TBufferFile.h"
 #include "TBranchClones.h"
 #include "TBranchElement.h"
 #include "TBranchRef.h"
@@ -18,10 +19,12 @@
 #include "TBranchObject.h"
 #include "TBranchProxyDirector.h"
 #include "TClassEdit.h"
+#include "TEnv.h"
 #include "TFriendElement.h"
 #include "TFriendProxy.h"
 #include "TLeaf.h"
 #include "TList.h"
+#include "TMath.h"
 #include "TROOT.h"
 #include "TStreamerInfo.h"
 #include "TStreamerElement.h"
@@ -30,6 +33,8 @@
 #include "TRegexp.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 // pin vtable
 ROOT::Internal::TVirtualCollectionReader::~TVirtualCollectionReader() {}
@@ -386,6 +391,110 @@ namespace {
          return TDynamicArrayReader<TLeafReader>::GetSize(proxy);
       }
    };
+
+   // Reader interface for variable-size arrays and vectors of basic types using bulk IO:
+   // the values of all the entries of a basket are deserialized at once into a contiguous
+   // buffer, the entries are delimited by an offsets array. If bulk IO fails, e.g. because
+   // a basket has an unexpected layout, the reading continues with the fallback reader.
+   class TBulkJaggedReader final : public TVirtualCollectionReader {
+   private:
+      TTreeReader *fTreeReader;
+      std::string fBranchName;
+      Int_t fElementSize;
+      std::unique_ptr<TVirtualCollectionReader> fFallback;
+      TBufferFile fBuffer{TBuffer::kWrite, 32 * 1024};
+      std::vector<Int_t> fOffsets; // Entry boundaries of the basket in fBuffer, in number of values
+      Int_t fDataStart = 0;        // Position of the first value in fBuffer
+      TTree *fTree = nullptr;      // Tree of the current branch (changes with the files of a chain)
+      TBranch *fBranch = nullptr;
+      Long64_t fFirst = -1;        // First entry of the basket in fBuffer
+      Long64_t fEntry = -1;        // Current entry, relative to fFirst
+      Bool_t fUseFallback = kFALSE;
+
+      Bool_t Load()
+      {
+         TTree *tree = fTreeReader->GetTree()->GetTree();
+         if (tree != fTree) {
+            fTree = tree;
+            fBranch = tree ? tree->GetBranch(fBranchName.c_str()) : nullptr;
+            fFirst = -1;
+            fOffsets.clear();
+            if (!fBranch || !fBranch->GetBulkRead().SupportsBulkReadJagged()) {
+               fUseFallback = kTRUE;
+               return kFALSE;
+            }
+         }
+         const Long64_t entry = tree->GetReadEntry();
+         if (fFirst >= 0 && entry >= fFirst && entry + 1 < fFirst + Long64_t(fOffsets.size())) {
+            fEntry = entry - fFirst;
+            return kTRUE;
+         }
+
+         const Long64_t *basketEntry = fBranch->GetBasketEntry();
+         const Long64_t ib = TMath::BinarySearch(Long64_t(fBranch->GetWriteBasket() + 1), basketEntry, entry);
+         // Baskets that are only in memory are read entry by entry.
+         if (ib >= 0 && !fBranch->GetBasketSeek(ib))
+            return kFALSE;
+         if (ib < 0 || fBranch->GetBulkRead().GetBulkEntriesJagged(basketEntry[ib], fBuffer, fOffsets) <= 0) {
+            fUseFallback = kTRUE;
+            return kFALSE;
+         }
+         fFirst = basketEntry[ib];
+         fDataStart = fBuffer.Length();
+         fEntry = entry - fFirst;
+         if (entry + 1 >= fFirst + Long64_t(fOffsets.size())) {
+            fUseFallback = kTRUE;
+            return kFALSE;
+         }
+         return kTRUE;
+      }
+
+   public:
+      TBulkJaggedReader(TTreeReader *treeReader, TBranch *branch, Int_t elementSize,
+                        std::unique_ptr<TVirtualCollectionReader> fallback)
+         : fTreeReader(treeReader), fBranchName(branch->GetName()), fElementSize(elementSize),
+           fFallback(std::move(fallback))
+      {
+      }
+
+      size_t GetSize(ROOT::Detail::TBranchProxy *proxy) override
+      {
+         if (!fUseFallback && Load()) {
+            fReadStatus = TTreeReaderValueBase::kReadSuccess;
+            return fOffsets[fEntry + 1] - fOffsets[fEntry];
+         }
+         auto size = fFallback->GetSize(proxy);
+         fReadStatus = fFallback->fReadStatus;
+         return size;
+      }
+
+      void *At(ROOT::Detail::TBranchProxy *proxy, size_t idx) override
+      {
+         if (!fUseFallback && Load()) {
+            fReadStatus = TTreeReaderValueBase::kReadSuccess;
+            return fBuffer.Buffer() + fDataStart + (fOffsets[fEntry] + idx) * fElementSize;
+         }
+         auto address = fFallback->At(proxy, idx);
+         fReadStatus = fFallback->fReadStatus;
+         return address;
+      }
+   };
+
+   // Whether a TTreeReaderArray of the given element type can read the top-level branch
+   // with a TBulkJaggedReader. TTreeReader.BulkReadJagged: 0 in .rootrc disables it.
+   Bool_t CanReadBulkJagged(TTreeReader *treeReader, TBranch *branch, TDictionary *dict, EDataType branchType)
+   {
+      static const Bool_t enabled = gEnv->GetValue("TTreeReader.BulkReadJagged", 1);
+      if (!enabled || !treeReader->GetTree() || branch->GetMother() != branch)
+         return kFALSE;
+      // Friend trees are loaded independently of the main tree.
+      if (branch->GetTree() != treeReader->GetTree()->GetTree())
+         return kFALSE;
+      auto dataType = dynamic_cast<TDataType *>(dict);
+      if (!dataType || dataType->GetType() != branchType)
+         return kFALSE;
+      return branch->GetBulkRead().SupportsBulkReadJagged();
+   }
 }
 
 
@@ -706,8 +815,13 @@ void ROOT::Internal::TTreeReaderArrayBase::SetImpl(TBranch* branch, TLeaf* myLea
          }
       }
       else { // We are at root node?
-         if (branchElement->GetClass()->GetCollectionProxy()){
-            fImpl = std::make_unique<TCollectionLessSTLReader>(branchElement->GetClass()->GetCollectionProxy());
+         if (auto collProxy = branchElement->GetClass()->GetCollectionProxy()){
+            fImpl = std::make_unique<TCollectionLessSTLReader>(collProxy);
+            if (!collProxy->GetValueClass() &&
+                CanReadBulkJagged(fTreeReader, branch, fDict, collProxy->GetType())) {
+               fImpl = std::make_unique<TBulkJaggedReader>(fTreeReader, branch, ((TDataType *)fDict)->Size(),
+                                                           std::move(fImpl));
+            }
          }
       }
    } else if (branch->IsA() == TBranch::Class()) {
@@ -728,6 +842,13 @@ void ROOT::Internal::TTreeReaderArrayBase::SetImpl(TBranch* branch, TLeaf* myLea
          fImpl = std::make_unique<TArrayParameterSizeReader>(fTreeReader, sizeLeaf->GetName());
       }
       ((TObjectArrayReader*)fImpl.get())->SetBasicTypeSize(((TDataType*)fDict)->Size());
+      if (sizeLeaf) {
+         TDataType *leafType = gROOT->GetType(topLeaf->GetTypeName());
+         if (leafType && CanReadBulkJagged(fTreeReader, branch, fDict, (EDataType)leafType->GetType())) {
+            fImpl = std::make_unique<TBulkJaggedReader>(fTreeReader, branch, ((TDataType *)fDict)->Size(),
+                                                        std::move(fImpl));
+         }
+      }
    } else if (branch->IsA() == TBranchClones::Class()) {
       Error("TTreeReaderArrayBase::SetImpl", "Support for branches of type TBranchClones not implemented");
       fSetupStatus = kSetupInternalError;
@@ -105,6 +105,7 @@ ROOT::Internal::TTreeReaderValueBase::operator=(const TTreeReaderValueBase& rhs)
       fSetupStatus = rhs.fSetupStatus;
       fReadStatus = rhs.fReadStatus;
       fStaticClassOffsets = rhs.fStaticClassOffsets;
+      fCachedEntry = -1;
    }
    return *this;
 }
@@ -226,6 +227,7 @@ void ROOT::Internal::TTreeReaderValueBase::NotifyNewTree(TTree* newTree) {
    // Since the TTree structure might have change, let's make sure we
    // use the right reading function.
    fProxyReadFunc = &TTreeReaderValueBase::ProxyReadDefaultImpl;
+   fCachedEntry = -1;
 
    if (!fHaveLeaf || !newTree) {
       fLeaf = nullptr;
@@ -274,6 +276,26 @@ void* ROOT::Internal::TTreeReaderValueBase::GetAddress() {
    return (Byte_t*)fProxy->GetWhere();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the address of the value being read, dereferenced if the proxied
+/// data member is a pointer, and remembers it for the current entry so that
+/// subsequent calls of TTreeReaderValue::Get() for the same entry skip the
+/// read and address computation.
+
+void *ROOT::Internal::TTreeReaderValueBase::GetAddressAndCache()
+{
+   void *address = GetAddress(); // Needed to figure out if it's a pointer
+   if (address && fProxy->IsaPointer())
+      address = *(void **)address;
+   if (fReadStatus == kReadSuccess && !fHaveLeaf) {
+      fCachedEntry = fProxy->GetReadEntry();
+      fCachedAddress = address;
+   } else {
+      fCachedEntry = -1;
+   }
+   return address;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Search a branch the name of which contains a "."
 /// \param[out] myLeaf The leaf identified by the name if found (can be untouched).
@@ -340,3 +340,60 @@ TEST(TTreeReaderArray, ULong64Size)
 {
    TestReadingNonIntArraySizes<ULong64_t>();
 }
+
+// Jagged branches stored in a file are read in bulk, one basket at a time.
+TEST(TTreeReaderArray, BulkJagged)
+{
+   const auto fname = "treereaderarray_bulkjagged.root";
+   const int nEntries = 2000;
+   {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      int n = 0;
+      float arr[16];
+      std::vector<double> vec;
+      t.Branch("n", &n);
+      t.Branch("arr", arr, "arr[n]/F");
+      t.Branch("vec", &vec);
+      t.SetBasketSize("*", 512);
+      for (int i = 0; i < nEntries; ++i) {
+         n = i % 16;
+         vec.clear();
+         for (int j = 0; j < n; ++j) {
+            arr[j] = i + 0.5f * j;
+            vec.push_back(-i - 0.25 * j);
+         }
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fname);
+   TTreeReader r("t", &f);
+   TTreeReaderArray<float> arr(r, "arr");
+   TTreeReaderArray<double> vec(r, "vec");
+   // Read a few entries out of order first.
+   for (auto entry : {1234, 17, 1999, 0}) {
+      r.SetEntry(entry);
+      ASSERT_EQ(arr.GetSize(), std::size_t(entry % 16));
+      ASSERT_EQ(vec.GetSize(), std::size_t(entry % 16));
+      for (int j = 0; j < entry % 16; ++j) {
+         EXPECT_FLOAT_EQ(arr[j], entry + 0.5f * j);
+         EXPECT_DOUBLE_EQ(vec[j], -entry - 0.25 * j);
+      }
+   }
+   r.Restart();
+   int i = 0;
+   while (r.Next()) {
+      ASSERT_EQ(arr.GetSize(), std::size_t(i % 16));
+      ASSERT_EQ(vec.GetSize(), std::size_t(i % 16));
+      for (int j = 0; j < i % 16; ++j) {
+         EXPECT_FLOAT_EQ(arr[j], i + 0.5f * j);
+         EXPECT_DOUBLE_EQ(vec[j], -i - 0.25 * j);
+      }
+      ++i;
+   }
+   EXPECT_EQ(i, nEntries);
+
+   gSystem->Unlink(fname);
+}
@@ -14,6 +14,7 @@
 #include "ROOT/TestSupport.hxx"
 #include <stdlib.h>
 #include <memory>
+#include <string>
 
 #include "RErrorIgnoreRAII.hxx"
 
@@ -509,3 +510,51 @@ TEST(TTreeReaderBasic, DisappearingBranch)
    gSystem->Unlink("DisappearingBranch0.root");
    gSystem->Unlink("DisappearingBranch1.root");
 }
+
+TEST(TTreeReaderBasic, RepeatedGetAcrossEntriesAndTrees)
+{
+   auto createFile = [](const char *fileName, int first) {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      std::string s;
+      t.Branch("i", &i);
+      t.Branch("s", &s);
+      for (i = first; i < first + 3; ++i) {
+         s = std::to_string(i);
+         t.Fill();
+      }
+      t.Write();
+      f.Close();
+   };
+   createFile("RepeatedGet0.root", 0);
+   createFile("RepeatedGet1.root", 3);
+
+   TChain c("t");
+   c.Add("RepeatedGet0.root");
+   c.Add("RepeatedGet1.root");
+   TTreeReader r(&c);
+   TTreeReaderValue<int> iv(r, "i");
+   TTreeReaderValue<std::string> sv(r, "s");
+
+   int expected = 0;
+   while (r.Next()) {
+      // Same local entry numbers in both trees: the values must still follow the chain
+      const int *address = iv.Get();
+      EXPECT_EQ(address, iv.Get());
+      EXPECT_EQ(expected, *iv);
+      EXPECT_EQ(std::to_string(expected), *sv);
+      EXPECT_EQ(std::to_string(expected), *sv);
+      ++expected;
+   }
+   EXPECT_EQ(6, expected);
+
+   for (Long64_t entry : {4, 1, 1, 5, 0}) {
+      ASSERT_EQ(TTreeReader::kEntryValid, r.SetEntry(entry));
+      EXPECT_EQ(entry, *iv);
+      EXPECT_EQ(std::to_string(entry), *sv);
+   }
+
+   gSystem->Unlink("RepeatedGet0.root");
+   gSystem->Unlink("RepeatedGet1.root");
+}
@@ -0,0 +1,84 @@
+#include "TFile.h"
+#include "TH2.h"
+#include "TProfile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef R__USE_IMT
+
+namespace {
+
+void WriteTree(const char *fname)
+{
+   TFile f(fname, "RECREATE");
+   TTree t("t", "t");
+   t.SetAutoFlush(1000); // several clusters
+   int n = 0;
+   float x[4];
+   double y = 0;
+   t.Branch("n", &n);
+   t.Branch("x", x, "x[n]/F");
+   t.Branch("y", &y);
+   for (int i = 0; i < 20000; ++i) {
+      n = i % 4;
+      for (int j = 0; j < n; ++j)
+         x[j] = (i % 100) * 0.1 + j;
+      y = (i % 37) - 18;
+      t.Fill();
+   }
+   t.Write();
+}
+
+void ExpectSameHist(const TH1 &a, const TH1 &b)
+{
+   ASSERT_EQ(a.GetNcells(), b.GetNcells());
+   EXPECT_DOUBLE_EQ(a.GetEntries(), b.GetEntries());
+   for (Int_t bin = 0; bin < a.GetNcells(); ++bin)
+      EXPECT_DOUBLE_EQ(a.GetBinContent(bin), b.GetBinContent(bin)) << "bin " << bin;
+}
+
+} // anonymous namespace
+
+TEST(TTreeDraw, ImplicitMT)
+{
+   const auto fname = "ttreedraw_implicitmt.root";
+   WriteTree(fname);
+
+   const std::vector<std::pair<std::string, std::string>> draws = {
+      {"y>>h1(40,-20,20)", ""},
+      {"x>>h2(50,0,15)", "y > 0"},
+      {"x:y>>h3(20,-20,20,20,0,15)", "x > 1"},
+      {"x:y>>h4(20,-20,20)", ""},
+   };
+
+   TFile f(fname);
+   auto t = f.Get<TTree>("t");
+   for (const auto &draw : draws) {
+      const auto option = draw.first.find("h4") != std::string::npos ? "prof goff" : "colz goff";
+      const auto nserial = t->Draw(draw.first.c_str(), draw.second.c_str(), option);
+      auto serial = static_cast<TH1 *>(gDirectory->Get(draw.first.substr(draw.first.find(">>") + 2, 2).c_str()));
+      ASSERT_NE(serial, nullptr);
+      std::unique_ptr<TH1> expected(static_cast<TH1 *>(serial->Clone("expected")));
+
+      ROOT::EnableImplicitMT(4);
+      const auto nparallel = t->Draw(draw.first.c_str(), draw.second.c_str(), option);
+      ROOT::DisableImplicitMT();
+      auto parallel = static_cast<TH1 *>(gDirectory->Get(draw.first.substr(draw.first.find(">>") + 2, 2).c_str()));
+      ASSERT_NE(parallel, nullptr);
+
+      EXPECT_EQ(nserial, nparallel) << draw.first;
+      ExpectSameHist(*expected, *parallel);
+   }
+
+   gSystem->Unlink(fname);
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include "TTree.h"
+#include "TTreeFormula.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace {
+
+struct JitRAII {
+   Bool_t fOld = TTreeFormula::IsJitEnabled();
+   ~JitRAII() { TTreeFormula::SetJitEnabled(fOld); }
+};
+
+std::vector<double> EvalAll(TTree &t, const char *expr, bool jit)
+{
+   TTreeFormula::SetJitEnabled(jit);
+   TTreeFormula f("f", expr, &t);
+   EXPECT_EQ(f.IsJitted(), jit);
+   std::vector<double> values;
+   for (Long64_t i = 0; i < t.GetEntries(); ++i) {
+      t.LoadTree(i);
+      f.UpdateFormulaLeaves();
+      const Int_t ndata = f.GetNdata();
+      for (Int_t j = 0; j < ndata; ++j)
+         values.emplace_back(f.EvalInstance(j));
+   }
+   return values;
+}
+
+} // anonymous namespace
+
+TEST(TTreeFormula, Jit)
+{
+   JitRAII raii;
+   TTree t("t", "t");
+   int n = 0;
+   float x[5];
+   double y = 0;
+   t.Branch("n", &n);
+   t.Branch("x", x, "x[n]/F");
+   t.Branch("y", &y);
+   for (int i = 0; i < 20; ++i) {
+      n = i % 5;
+      for (int j = 0; j < n; ++j)
+         x[j] = i * 0.5 - j;
+      y = i - 10.;
+      t.Fill();
+   }
+
+   for (auto expr : {"y * 2 + 1", "x / y", "sqrt(y) + log(y) + exp(-y)", "x > 1 && y < 3", "n % 3 + abs(y)",
+                     "atan2(x, y) - pow(y, 2)", "!(y == 0) || x[0] >= 2"}) {
+      const auto expected = EvalAll(t, expr, false);
+      const auto jitted = EvalAll(t, expr, true);
+      ASSERT_EQ(jitted.size(), expected.size()) << expr;
+      for (std::size_t i = 0; i < expected.size(); ++i)
+         EXPECT_DOUBLE_EQ(jitted[i], expected[i]) << expr << " instance " << i;
+   }
+}
@@ -0,0 +1,44 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreePerfStats.h"
+
+#include "gtest/gtest.h"
+
+TEST(TTreePerfStats, BranchInfo)
+{
+   const auto fname = "ttreeperfstats_branchinfo.root";
+   {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      double y = 0;
+      t.Branch("x", &x);
+      t.Branch("y", &y);
+      for (int i = 0; i < 10000; ++i) {
+         x = i;
+         y = i * 0.5;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fname);
+   auto t = f.Get<TTree>("t");
+   TTreePerfStats ps("ioperf", t);
+   for (Long64_t i = 0; i < t->GetEntries(); ++i)
+      t->GetEntry(i);
+
+   const auto info = ps.GetBranchInfo();
+   ASSERT_EQ(info.size(), 2u);
+   const auto &x = info.at("x");
+   EXPECT_EQ(x.fEntriesRead, 10000);
+   EXPECT_EQ(x.fBytesRead, Long64_t(10000 * sizeof(int)));
+   EXPECT_GT(x.fNUnzip, 0);
+   EXPECT_GE(x.fUnzipObjSize, x.fUnzipInputSize);
+   EXPECT_GE(x.fReadTime, x.fUnzipTime);
+   EXPECT_EQ(info.at("y").fBytesRead, Long64_t(10000 * sizeof(double)));
+
+   t->SetPerfStats(nullptr);
+   gSystem->Unlink(fname);
+}
@@ -0,0 +1,40 @@
+#include "TTree.h"
+#include "TTreeIndex.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+TEST(TTreeIndex, GetEntryNumbersWithIndex)
+{
+   TTree t("t", "t");
+   int run = 0, event = 0;
+   t.Branch("run", &run);
+   t.Branch("event", &event);
+   // entries written in reverse order of the index
+   for (int i = 999; i >= 0; --i) {
+      run = i / 100;
+      event = 2 * (i % 100);
+      t.Fill();
+   }
+   ASSERT_EQ(t.BuildIndex("run", "event"), 1000);
+   auto index = static_cast<TTreeIndex *>(t.GetTreeIndex());
+
+   // sorted queries, half of them missing, then unsorted ones
+   std::vector<Long64_t> major, minor;
+   for (int i = 0; i < 2000; ++i) {
+      major.emplace_back(i / 200);
+      minor.emplace_back(i % 200);
+   }
+   for (int i = 0; i < 100; ++i) {
+      major.emplace_back((i * 37) % 12 - 1);
+      minor.emplace_back((i * 53) % 200);
+   }
+
+   std::vector<Long64_t> entries(major.size());
+   index->GetEntryNumbersWithIndex(major.size(), major.data(), minor.data(), entries.data());
+   for (std::size_t i = 0; i < major.size(); ++i)
+      EXPECT_EQ(entries[i], t.GetEntryNumberWithIndex(major[i], minor[i])) << major[i] << " " << minor[i];
+   EXPECT_EQ(entries[0], 999);
+   EXPECT_EQ(entries[1], -1);
+}
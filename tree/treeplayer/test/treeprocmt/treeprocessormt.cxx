@@ -362,6 +362,50 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, SplitLargeClusters)
+{
+   const auto nEvents = 100000;
+   const auto filename = "TreeProcessorMT_SplitLargeClusters.root";
+   const auto treename = "t";
+   {
+      int v = 0;
+      TFile file(filename, "recreate");
+      TTree t(treename, treename);
+      t.SetAutoFlush(0); // a single cluster
+      t.Branch("v", &v);
+      for (v = 0; v < nEvents; ++v)
+         t.Fill();
+      t.Write();
+   }
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   std::atomic<Long64_t> sum{0};
+   auto f = [&](TTreeReader &r) {
+      TTreeReaderValue<int> v(r, "v");
+      Long64_t localSum = 0;
+      while (r.Next())
+         localSum += *v;
+      sum += localSum;
+      std::lock_guard<std::mutex> l(m);
+      ranges.emplace_back(r.GetEntriesRange());
+   };
+
+   const unsigned int nslots = std::min(4U, std::thread::hardware_concurrency());
+   ROOT::EnableImplicitMT(nslots);
+   ROOT::TTreeProcessorMT p(filename, treename);
+   p.Process(f);
+
+   // the only cluster is split in chunks that the idle workers process concurrently
+   CheckClusters(ranges, nEvents);
+   if (nslots > 1)
+      EXPECT_GT(ranges.size(), 1u);
+   EXPECT_EQ(sum.load(), Long64_t(nEvents) * (nEvents - 1) / 2);
+
+   gSystem->Unlink(filename);
+   ROOT::DisableImplicitMT();
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};